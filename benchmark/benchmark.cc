@@ -1,6 +1,13 @@
 #include "benchmark/benchmark.h"
 
+#include <string>
+#include <vector>
+
 #include "phevaluator/card_sampler.h"
+#include "phevaluator/combinations.h"
+#include "phevaluator/equity.h"
+#include "phevaluator/evaluate.h"
+#include "phevaluator/hand.h"
 #include "phevaluator/phevaluator.h"
 
 using namespace phevaluator;
@@ -62,55 +69,184 @@ static void EvaluateAllSevenCards(benchmark::State& state) {
 }
 BENCHMARK(EvaluateAllSevenCards);
 
+// The same hands through Combinations, which can be split and resumed
+static void EnumerateAllSevenCards(benchmark::State& state) {
+  const Combinations combinations(7);
+  for (auto _ : state) {
+    combinations.forEach([](uint64_t mask) {
+      int c[7];
+      Combinations::Cards(mask, c);
+      benchmark::DoNotOptimize(
+          evaluate_7cards(c[0], c[1], c[2], c[3], c[4], c[5], c[6]));
+    });
+  }
+}
+BENCHMARK(EnumerateAllSevenCards);
+
 const int SIZE = 100;
 
 static void EvaluateRandomFiveCards(benchmark::State& state) {
-  std::vector<std::vector<int>> hands;
+  std::vector<Hand<5>> hands(SIZE);
   card_sampler::CardSampler cs{};
-  for (int i = 0; i < SIZE; i++) {
-    hands.push_back(cs.sample(5));
+
+  for (Hand<5>& hand : hands) {
+    cs.sample_into(hand);
   }
+
   for (auto _ : state) {
     for (int i = 0; i < SIZE; i++) {
-      EvaluateCards(hands[i][0], hands[i][1], hands[i][2], hands[i][3],
-                    hands[i][4]);
+      EvaluateHand(hands[i]);
     }
   }
 }
 BENCHMARK(EvaluateRandomFiveCards);
 
 static void EvaluateRandomSixCards(benchmark::State& state) {
-  std::vector<std::vector<int>> hands;
+  std::vector<Hand<6>> hands(SIZE);
   card_sampler::CardSampler cs{};
 
-  for (int i = 0; i < SIZE; i++) {
-    hands.push_back(cs.sample(6));
+  for (Hand<6>& hand : hands) {
+    cs.sample_into(hand);
   }
 
   for (auto _ : state) {
     for (int i = 0; i < SIZE; i++) {
-      EvaluateCards(hands[i][0], hands[i][1], hands[i][2], hands[i][3],
-                    hands[i][4], hands[i][5]);
+      EvaluateHand(hands[i]);
     }
   }
 }
 BENCHMARK(EvaluateRandomSixCards);
 
 static void EvaluateRandomSevenCards(benchmark::State& state) {
-  std::vector<std::vector<int>> hands;
+  std::vector<Hand<7>> hands(SIZE);
   card_sampler::CardSampler cs{};
 
-  for (int i = 0; i < SIZE; i++) {
-    hands.push_back(cs.sample(7));
+  for (Hand<7>& hand : hands) {
+    cs.sample_into(hand);
   }
 
   for (auto _ : state) {
     for (int i = 0; i < SIZE; i++) {
-      EvaluateCards(hands[i][0], hands[i][1], hands[i][2], hands[i][3],
-                    hands[i][4], hands[i][5], hands[i][6]);
+      EvaluateHand(hands[i]);
     }
   }
 }
 BENCHMARK(EvaluateRandomSevenCards);
 
+static void EvaluateRandomSevenCardsTemplate(benchmark::State& state) {
+  std::vector<Hand<7>> hands(SIZE);
+  card_sampler::CardSampler cs{};
+
+  for (Hand<7>& hand : hands) {
+    cs.sample_into(hand);
+  }
+
+  for (auto _ : state) {
+    for (int i = 0; i < SIZE; i++) {
+      benchmark::DoNotOptimize(Evaluate(hands[i]));
+    }
+  }
+}
+BENCHMARK(EvaluateRandomSevenCardsTemplate);
+
+static std::vector<std::string> RandomHandStrings(int cards) {
+  std::vector<std::string> hands;
+  card_sampler::CardSampler cs{};
+
+  for (int i = 0; i < SIZE; i++) {
+    std::string hand;
+    for (int id : cs.sample(cards)) hand += Card(id).describeCard();
+    hands.push_back(hand);
+  }
+  return hands;
+}
+
+static void ParseSevenCardsWithCard(benchmark::State& state) {
+  const std::vector<std::string> hands = RandomHandStrings(7);
+
+  for (auto _ : state) {
+    for (int i = 0; i < SIZE; i++) {
+      int cards[7];
+      for (int k = 0; k < 7; k++) cards[k] = Card(hands[i].c_str() + 2 * k);
+      benchmark::DoNotOptimize(cards);
+    }
+  }
+}
+BENCHMARK(ParseSevenCardsWithCard);
+
+static void ParseSevenCards(benchmark::State& state) {
+  const std::vector<std::string> hands = RandomHandStrings(7);
+
+  for (auto _ : state) {
+    for (int i = 0; i < SIZE; i++) {
+      int cards[7];
+      benchmark::DoNotOptimize(ParseHand(hands[i], cards, 7));
+    }
+  }
+}
+BENCHMARK(ParseSevenCards);
+
+static void ParseDecks(benchmark::State& state) {
+  const std::vector<std::string> hands = RandomHandStrings(52);
+
+  for (auto _ : state) {
+    for (int i = 0; i < SIZE; i++) {
+      uint64_t mask;
+      benchmark::DoNotOptimize(ParseHand(hands[i], mask));
+    }
+  }
+}
+BENCHMARK(ParseDecks);
+
+
+// Nine hands sharing a board, one evaluate_7cards each or through one
+// BoardEvaluator. The other hands may repeat cards, which doesn't change
+// the work.
+static void EvaluateSharedBoardSeparately(benchmark::State& state) {
+  card_sampler::CardSampler cs(42);
+  std::vector<Hand<7>> deals(SIZE);  // board, then 2 cards
+  for (Hand<7>& deal : deals) cs.sample_into(deal, 0);
+  for (auto _ : state) {
+    for (const Hand<7>& deal : deals) {
+      const uint8_t* c = deal.data();
+      for (int p = 0; p < 9; p++) {
+        benchmark::DoNotOptimize(
+            evaluate_7cards(c[0], c[1], c[2], c[3], c[4], (c[5] + 4 * p) % 52, c[6]));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * SIZE * 9);
+}
+BENCHMARK(EvaluateSharedBoardSeparately);
+
+static void EvaluateSharedBoard(benchmark::State& state) {
+  card_sampler::CardSampler cs(42);
+  std::vector<Hand<7>> deals(SIZE);
+  for (Hand<7>& deal : deals) cs.sample_into(deal, 0);
+  BoardEvaluator evaluator;
+  for (auto _ : state) {
+    for (const Hand<7>& deal : deals) {
+      const uint8_t* c = deal.data();
+      evaluator.setBoard(c);
+      for (int p = 0; p < 9; p++) {
+        benchmark::DoNotOptimize(evaluator.evaluate((c[5] + 4 * p) % 52, c[6]));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * SIZE * 9);
+}
+BENCHMARK(EvaluateSharedBoard);
+
+// Exact AcAd against KhKs: 1,712,304 boards, a quarter of them evaluated
+static void EnumerateHeadsUpEquity(benchmark::State& state) {
+  EquityCalculator calculator(2);
+  calculator.setHand(0, Hand<2>::Parse("AcAd"));
+  calculator.setHand(1, Hand<2>::Parse("KhKs"));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(calculator.enumerate().players[0].equity);
+  }
+  state.SetItemsProcessed(state.iterations() * 1712304);
+}
+BENCHMARK(EnumerateHeadsUpEquity)->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,148 @@
+#include <phevaluator/equity.h>
+#include <phevaluator/phevaluator.h>
+#include <phevaluator/range.h>
+#include <phevaluator/showdown.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Error against time for each EquitySampling mode: every iteration is one
+// calculate() with a new seed, and rms_error is its distance from the
+// exact equity over all iterations. Compare rows with the same error, not
+// the same trials, to see what a mode saves.
+
+using namespace phevaluator;
+
+static void SampleEquity(benchmark::State& state, const char* hero,
+                         const char* villain, const char* board) {
+  EquityCalculator calculator(2);
+  calculator.setHand(0, Hand<2>::Parse(hero));
+  calculator.setHand(1, Hand<2>::Parse(villain));
+  calculator.setBoard(Board::Parse(board));
+  const double exact = calculator.enumerate().players[0].equity;
+
+  EquityOptions options;
+  options.sampling = static_cast<EquitySampling>(state.range(0));
+  options.trials = state.range(1);
+  double squared_error = 0;
+  for (auto _ : state) {
+    options.seed++;
+    const double error = calculator.calculate(options).players[0].equity -
+                         exact;
+    squared_error += error * error;
+  }
+  state.counters["rms_error"] = std::sqrt(squared_error / state.iterations());
+  state.SetItemsProcessed(state.iterations() * options.trials);
+}
+
+static void SampleEquityPreflop(benchmark::State& state) {
+  SampleEquity(state, "AhKh", "7c7d", "");
+}
+
+static void SampleEquityFlop(benchmark::State& state) {
+  SampleEquity(state, "AhKh", "QcQd", "Jh7s2c");
+}
+
+// Modes: 0 plain, 1 stratified, 2 antithetic, 3 quasi-random
+BENCHMARK(SampleEquityPreflop)
+    ->ArgsProduct({{0, 1, 2, 3}, {4096, 16384, 65536}})
+    ->ArgNames({"mode", "trials"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(SampleEquityFlop)
+    ->ArgsProduct({{0, 1, 2, 3}, {4096, 16384, 65536}})
+    ->ArgNames({"mode", "trials"})
+    ->Unit(benchmark::kMillisecond);
+
+static void ParseRange(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        HoldemRange::Parse("22+, A2s+, K9s+, QTs+, JTs, ATo+, KJo+, QJo:0.5"));
+  }
+}
+BENCHMARK(ParseRange);
+
+// A range less the cards of a flop and a known hand
+static void RemoveRangeCards(benchmark::State& state) {
+  const HoldemRange range = HoldemRange::Parse("22+, A2s+, K9s+, ATo+");
+  const uint64_t dead = 0x1001001001ULL;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(range.without(dead).size());
+  }
+}
+BENCHMARK(RemoveRangeCards);
+
+// Narrow ranges that share their aces, heads-up and three-way on a flop
+static void SampleRangeEquity(benchmark::State& state) {
+  const char* ranges[] = {"AA, KK, AKs", "AA, AK, QQ", "AQs, KQs, JJ"};
+  const int players = state.range(0);
+  EquityCalculator calculator(players);
+  for (int p = 0; p < players; p++) {
+    calculator.setRange(p, HoldemRange::Parse(ranges[p]));
+  }
+  calculator.setBoard(Board::Parse("Kh7c2d"));
+  EquityOptions options;
+  options.trials = 65536;
+  ThreadPool pool;
+  for (auto _ : state) {
+    options.seed++;
+    benchmark::DoNotOptimize(calculator.calculate(options, &pool));
+  }
+  state.SetItemsProcessed(state.iterations() * options.trials);
+}
+BENCHMARK(SampleRangeEquity)->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
+
+// Exact equity of a wide range against a tight one, from the flop (0) or
+// the turn (1)
+static void EnumerateRanges(benchmark::State& state) {
+  const HoldemRange hero =
+      HoldemRange::Parse("22+, A2s+, K9s+, QTs+, JTs, ATo+, KJo+");
+  const HoldemRange villain = HoldemRange::Parse("TT+, AQs+, AKo");
+  const Board board = Board::Parse(state.range(0) ? "Kh7c2d9s" : "Kh7c2d");
+  ThreadPool pool;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        EnumerateRangeEquity(hero, villain, board, 0, &pool));
+  }
+}
+BENCHMARK(EnumerateRanges)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Payoffs of every hand of a wide range against a weighted one on a river:
+// through a ShowdownTable (0), or by comparing every pair of hands with
+// evaluate_7cards (1)
+static void RiverPayoffs(benchmark::State& state) {
+  const HoldemRange hero =
+      HoldemRange::Parse("22+, A2s+, K9s+, QTs+, JTs, ATo+, KJo+");
+  const HoldemRange villain = HoldemRange::Parse("TT+, AQs+, AKo, 76s:0.5");
+  const Board board = Board::Parse("Kh7c2d9sAs");
+  const uint8_t* b = board.data();
+  std::vector<double> weights(HoldemRange::kHands);
+  for (int i = 0; i < HoldemRange::kHands; i++) weights[i] = villain.weight(i);
+  std::vector<double> payoff(HoldemRange::kHands);
+  const HoldemRange hands = (hero | villain).without(board.mask());
+  ShowdownTable table;
+
+  for (auto _ : state) {
+    if (state.range(0) == 0) {
+      table.setBoard(b, hands);
+      table.payoffs(weights.data(), payoff.data());
+    } else {
+      hands.forEach([&](int h, int a, int c, double) {
+        if (!hero.contains(h)) return;
+        const int rank = evaluate_7cards(b[0], b[1], b[2], b[3], b[4], a, c);
+        double value = 0;
+        villain.without(board.mask() | uint64_t(1) << a | uint64_t(1) << c)
+            .forEach([&](int, int x, int y, double w) {
+              const int other =
+                  evaluate_7cards(b[0], b[1], b[2], b[3], b[4], x, y);
+              value += rank < other ? w : rank > other ? -w : 0;
+            });
+        payoff[h] = value;
+      });
+    }
+    benchmark::DoNotOptimize(payoff.data());
+  }
+}
+BENCHMARK(RiverPayoffs)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
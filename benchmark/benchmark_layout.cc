@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "phevaluator/phevaluator.h"
+
+extern "C" {
+#include "../cpp/database/tables/tables.h"
+#include "../cpp/math/hash/hash.h"
+}
+
+// Compares the noflush7 layout in use against the rank relabelling that
+// tools/optimize_table_layout.cc picks for the "holdem" workload (every
+// holding on a shared board). The relaid table is built at start-up.
+
+using Quinary = std::array<unsigned char, 13>;
+
+static const int kRankSlot[13] = {12, 7, 5, 2, 4, 3, 6, 0, 1, 9, 8, 10, 11};
+
+alignas(64) static short noflush7_relaid[49205];
+static unsigned char card_slot[52];
+static unsigned char card_rank[52];
+
+static void Relabel(Quinary& quinary, int rank, int left) {
+  if (rank == 13) {
+    if (left > 0) return;
+    Quinary relabelled{};
+    for (int r = 0; r < 13; r++) relabelled[kRankSlot[r]] = quinary[r];
+    noflush7_relaid[hash_quinary(relabelled.data(), 7)] =
+        noflush7[hash_quinary(quinary.data(), 7)];
+    return;
+  }
+  for (int n = 0; n <= std::min(4, left); n++) {
+    quinary[rank] = n;
+    Relabel(quinary, rank + 1, left - n);
+  }
+  quinary[rank] = 0;
+}
+
+static void BuildRelaidTable() {
+  static bool built = false;
+  if (built) return;
+  Quinary quinary{};
+  Relabel(quinary, 0, 7);
+  for (int id = 0; id < 52; id++) {
+    card_slot[id] = kRankSlot[id >> 2];
+    card_rank[id] = id >> 2;
+  }
+  built = true;
+}
+
+// evaluate_7cards with a card -> quinary slot table, flush path unchanged.
+// Both layouts are timed through this function so only the table differs.
+static int EvaluateWithLayout(const int* cards, const unsigned char* slot,
+                              const short* noflush) {
+  int suit_hash = 0;
+  for (int i = 0; i < 7; i++) suit_hash += bit_of_mod_4_x_3[cards[i]];
+
+  if (suits[suit_hash]) {
+    int suit_binary[4] = {0};
+    for (int i = 0; i < 7; i++)
+      suit_binary[cards[i] & 0x3] |= bit_of_div_4[cards[i]];
+    return flush[suit_binary[suits[suit_hash] - 1]];
+  }
+
+  unsigned char quinary[13] = {0};
+  for (int i = 0; i < 7; i++) quinary[slot[cards[i]]]++;
+  return noflush[hash_quinary(quinary, 7)];
+}
+
+// Every holding on 200 random boards, in board order
+static const std::vector<std::array<int, 7>>& HoldemHands() {
+  static std::vector<std::array<int, 7>> hands;
+  if (!hands.empty()) return hands;
+
+  std::mt19937_64 generator(42);
+  for (int b = 0; b < 200; b++) {
+    std::array<int, 52> deck;
+    std::iota(deck.begin(), deck.end(), 0);
+    std::shuffle(deck.begin(), deck.end(), generator);
+    for (int i = 5; i < 52; i++) {
+      for (int j = i + 1; j < 52; j++) {
+        hands.push_back(
+            {deck[0], deck[1], deck[2], deck[3], deck[4], deck[i], deck[j]});
+      }
+    }
+  }
+  return hands;
+}
+
+static void EvaluateHoldemCurrentLayout(benchmark::State& state) {
+  BuildRelaidTable();
+  const auto& hands = HoldemHands();
+  for (auto _ : state) {
+    for (const auto& h : hands) {
+      benchmark::DoNotOptimize(EvaluateWithLayout(h.data(), card_rank, noflush7));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * hands.size());
+}
+BENCHMARK(EvaluateHoldemCurrentLayout);
+
+static void EvaluateHoldemRelaidLayout(benchmark::State& state) {
+  BuildRelaidTable();
+  const auto& hands = HoldemHands();
+  for (auto _ : state) {
+    for (const auto& h : hands) {
+      benchmark::DoNotOptimize(
+          EvaluateWithLayout(h.data(), card_slot, noflush7_relaid));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * hands.size());
+}
+BENCHMARK(EvaluateHoldemRelaidLayout);
@@ -0,0 +1,72 @@
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "phevaluator/numa.h"
+#include "phevaluator/phevaluator.h"
+
+// Multi-threaded 7-card evaluation against the PHEVAL_NUMA replicas. Thread
+// i is pinned to replica i modulo the replica count, then reads either the
+// compiled-in tables (Shared), the replica of its own node (Local) or the
+// replica of the next node (Remote). On a single node build or machine the
+// three only differ by the binding overhead.
+
+using namespace phevaluator;
+
+static const std::vector<int>& RandomHands() {
+  static const std::vector<int> hands = []() {
+    std::mt19937 rng(11);
+    std::vector<int> cards;
+    for (int i = 0; i < 100000; i++) {
+      int deck[52];
+      for (int c = 0; c < 52; c++) deck[c] = c;
+      for (int c = 0; c < 7; c++) {
+        std::swap(deck[c], deck[c + rng() % (52 - c)]);
+        cards.push_back(deck[c]);
+      }
+    }
+    return cards;
+  }();
+  return hands;
+}
+
+enum class Placement { kShared, kLocal, kRemote };
+
+static void EvaluateSevenCardsPinned(benchmark::State& state,
+                                     Placement placement) {
+  const int replicas = pheval_numa_replicate(0);
+  const auto& hands = RandomHands();
+
+  if (replicas > 0) {
+    const int node = state.thread_index() % replicas;
+    pheval_numa_pin_thread(node);
+    if (placement == Placement::kShared) pheval_numa_unbind_thread();
+    if (placement == Placement::kRemote) {
+      pheval_numa_bind_thread((node + 1) % replicas);
+    }
+  }
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < hands.size(); i += 7) {
+      benchmark::DoNotOptimize(
+          evaluate_7cards(hands[i], hands[i + 1], hands[i + 2], hands[i + 3],
+                          hands[i + 4], hands[i + 5], hands[i + 6]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (hands.size() / 7));
+}
+
+static void EvaluateSevenCardsShared(benchmark::State& state) {
+  EvaluateSevenCardsPinned(state, Placement::kShared);
+}
+BENCHMARK(EvaluateSevenCardsShared)->ThreadRange(1, 64)->UseRealTime();
+
+static void EvaluateSevenCardsLocal(benchmark::State& state) {
+  EvaluateSevenCardsPinned(state, Placement::kLocal);
+}
+BENCHMARK(EvaluateSevenCardsLocal)->ThreadRange(1, 64)->UseRealTime();
+
+static void EvaluateSevenCardsRemote(benchmark::State& state) {
+  EvaluateSevenCardsPinned(state, Placement::kRemote);
+}
+BENCHMARK(EvaluateSevenCardsRemote)->ThreadRange(1, 64)->UseRealTime();
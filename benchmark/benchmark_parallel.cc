@@ -0,0 +1,106 @@
+#include <phevaluator/batch.h>
+#include <phevaluator/card_sampler.h>
+#include <phevaluator/parallel.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Scaling of ParallelEvaluate from 1 to N threads, over a set of hands much
+// larger than the caches, and the latency of short batches on a warm pool
+// against starting threads for every call as further_algo.md sketches.
+
+using namespace phevaluator;
+
+static const std::vector<uint8_t>& RandomHands(size_t n) {
+  static std::vector<uint8_t> hands;
+  if (hands.size() < n * 7) {
+    card_sampler::CardSampler cs(40);
+    hands.resize(n * 7);
+    int ids[7];
+    for (size_t i = 0; i < n; i++) {
+      cs.sample_into(ids, 7);
+      for (int k = 0; k < 7; k++) hands[i * 7 + k] = ids[k];
+    }
+  }
+  return hands;
+}
+
+static int MaxThreads() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+static void ParallelEvaluateSevenCards(benchmark::State& state) {
+  const size_t n = 1 << 23;
+  const std::vector<uint8_t>& hands = RandomHands(n);
+  std::vector<int16_t> out(n);
+  ThreadPool pool(state.range(0), state.range(1));
+
+  for (auto _ : state) {
+    ParallelEvaluate(pool, pheval_engine_7cards, hands.data(), n, 0,
+                     out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(ParallelEvaluateSevenCards)
+    ->ArgsProduct({benchmark::CreateDenseRange(1, MaxThreads(), 1), {0, 1}})
+    ->ArgNames({"threads", "pin"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+static void ShortBatchPool(benchmark::State& state) {
+  const size_t n = state.range(0);
+  const std::vector<uint8_t>& hands = RandomHands(n);
+  std::vector<int16_t> out(n);
+  ThreadPool pool;
+
+  for (auto _ : state) {
+    ParallelEvaluate(pool, pheval_engine_7cards, hands.data(), n, 0,
+                     out.data(), 1024);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(ShortBatchPool)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)
+    ->UseRealTime();
+
+static void ShortBatchThreadPerCall(benchmark::State& state) {
+  const size_t n = state.range(0);
+  const std::vector<uint8_t>& hands = RandomHands(n);
+  std::vector<int16_t> out(n);
+  const size_t threads = MaxThreads();
+
+  for (auto _ : state) {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+      const size_t begin = n * t / threads, end = n * (t + 1) / threads;
+      workers.emplace_back([&, begin, end] {
+        evaluate_7cards_batch(hands.data() + begin * 7, end - begin, 0,
+                              out.data() + begin);
+      });
+    }
+    for (std::thread& worker : workers) worker.join();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(ShortBatchThreadPerCall)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)
+    ->UseRealTime();
+
+static void ShortBatchSingleThread(benchmark::State& state) {
+  const size_t n = state.range(0);
+  const std::vector<uint8_t>& hands = RandomHands(n);
+  std::vector<int16_t> out(n);
+
+  for (auto _ : state) {
+    evaluate_7cards_batch(hands.data(), n, 0, out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(ShortBatchSingleThread)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)
+    ->UseRealTime();
@@ -1,5 +1,6 @@
 #include "benchmark/benchmark.h"
 #include "phevaluator/card_sampler.h"
+#include "phevaluator/hand.h"
 #include "phevaluator/phevaluator.h"
 
 using namespace phevaluator;
@@ -7,18 +8,23 @@ using namespace phevaluator;
 const int SIZE = 100;
 
 static void EvaluateRandomPlo4Cards(benchmark::State& state) {
-  std::vector<std::vector<int>> hands;
+  struct Plo4Hand {
+    Board board;
+    Hand<4> hole;
+  };
+  std::vector<Plo4Hand> hands(SIZE);
   card_sampler::CardSampler cs{};
 
-  for (int i = 0; i < SIZE; i++) {
-    hands.push_back(cs.sample(9));
+  for (Plo4Hand& hand : hands) {
+    int ids[9];
+    cs.sample_into(ids, 9);
+    hand.board = Board(ids, 5);
+    hand.hole = Hand<4>(ids + 5);
   }
 
   for (auto _ : state) {
     for (int i = 0; i < SIZE; i++) {
-      EvaluatePlo4Cards(hands[i][0], hands[i][1], hands[i][2], hands[i][3],
-                        hands[i][4], hands[i][5], hands[i][6], hands[i][7],
-                        hands[i][8]);
+      EvaluatePlo4Hand(hands[i].board, hands[i].hole);
     }
   }
 }
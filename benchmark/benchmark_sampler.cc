@@ -0,0 +1,135 @@
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "phevaluator/card_sampler.h"
+#include "phevaluator/dealer.h"
+
+// The sampler as it was: a shared std::default_random_engine, a modulo
+// reduction and a new vector for every hand.
+static void SampleSevenCardsDefaultEngine(benchmark::State& state) {
+  std::default_random_engine generator(1);
+  std::vector<int> deck(52);
+  for (int i = 0; i < 52; i++) deck[i] = i;
+
+  for (auto _ : state) {
+    std::vector<int> ret;
+    int residual_cards = 52;
+    for (int i = 0; i < 7; i++) {
+      int target_index = generator() % residual_cards;
+      std::swap(deck[target_index], deck[residual_cards - 1]);
+      ret.push_back(deck[--residual_cards]);
+    }
+    benchmark::DoNotOptimize(ret.data());
+  }
+}
+BENCHMARK(SampleSevenCardsDefaultEngine);
+
+static void SampleSevenCards(benchmark::State& state) {
+  card_sampler::CardSampler cs{};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cs.sample(7));
+  }
+}
+BENCHMARK(SampleSevenCards);
+
+static void SampleSevenCardsInto(benchmark::State& state) {
+  card_sampler::CardSampler cs{};
+  int cards[7];
+
+  for (auto _ : state) {
+    cs.sample_into(cards, 7);
+    benchmark::DoNotOptimize(cards);
+  }
+}
+BENCHMARK(SampleSevenCardsInto);
+
+// A river runout for two known hole cards and a known flop
+static void SampleRunoutDeadCards(benchmark::State& state) {
+  card_sampler::CardSampler cs{};
+  const uint64_t dead = 0x1f;
+  int cards[2];
+
+  for (auto _ : state) {
+    cs.sample_into(cards, 2, dead);
+    benchmark::DoNotOptimize(cards);
+  }
+}
+BENCHMARK(SampleRunoutDeadCards);
+
+static void SampleSevenCardMask(benchmark::State& state) {
+  card_sampler::CardSampler cs{};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cs.sample_mask(7));
+  }
+}
+BENCHMARK(SampleSevenCardMask);
+
+static void DealNinePlayers(benchmark::State& state) {
+  card_sampler::Dealer dealer(9, 2, 5, 1);
+  card_sampler::Deal deal;
+
+  for (auto _ : state) {
+    dealer.deal(deal);
+    benchmark::DoNotOptimize(deal);
+  }
+}
+BENCHMARK(DealNinePlayers);
+
+// Every hand containing an ace, 198 combos
+static card_sampler::HandRange AceRange() {
+  card_sampler::HandRange range(2);
+  for (int a = 48; a < 52; a++) {
+    for (int other = 0; other < a; other++) {
+      const int cards[] = {other, a};
+      range.add(cards);
+    }
+  }
+  return range;
+}
+
+// Players on overlapping ranges, redrawing per player on conflicts
+static void DealAceRanges(benchmark::State& state) {
+  const int players = state.range(0);
+  card_sampler::Dealer dealer(players, 2, 5, 1);
+  const card_sampler::HandRange range = AceRange();
+  for (int p = 0; p < players; p++) dealer.setRange(p, range);
+  card_sampler::Deal deal;
+
+  for (auto _ : state) {
+    dealer.deal(deal);
+    benchmark::DoNotOptimize(deal);
+  }
+}
+BENCHMARK(DealAceRanges)->DenseRange(2, 4);
+
+// The same deal by rejecting whole deals until the players' hands fit
+static void DealAceRangesRejection(benchmark::State& state) {
+  const int players = state.range(0);
+  card_sampler::CardSampler cs(1);
+  const card_sampler::HandRange range = AceRange();
+  const auto& combos = range.combos();
+  auto& rng = cs.generator();
+  int board[5];
+
+  for (auto _ : state) {
+    uint64_t taken;
+    bool ok;
+    do {
+      taken = 0;
+      ok = true;
+      for (int p = 0; p < players && ok; p++) {
+        const uint64_t mask = combos[rng.bounded(combos.size())].mask;
+        ok = (taken & mask) == 0;
+        taken |= mask;
+      }
+    } while (!ok);
+    cs.sample_into(board, 5, taken);
+    benchmark::DoNotOptimize(board);
+  }
+}
+BENCHMARK(DealAceRangesRejection)->DenseRange(2, 4);
@@ -0,0 +1,207 @@
+#include <phevaluator/card.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Bulk hand string parsing, see ParseHand in card.h
+//
+// Runs of cards without separators are parsed 16 bytes at a time with
+// SSSE3. A build for a CPU with SSSE3 (-mssse3, -march=native) always takes
+// that path; otherwise GCC and Clang on x86 compile it for SSSE3 alone and
+// pick it at run time when the CPU has it.
+#if defined(__SSSE3__)
+#define PHEVAL_PARSE_SSSE3
+#define PHEVAL_TARGET_SSSE3
+#elif (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define PHEVAL_PARSE_SSSE3
+#define PHEVAL_PARSE_DISPATCH
+#define PHEVAL_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+
+#ifdef PHEVAL_PARSE_SSSE3
+#include <tmmintrin.h>
+#endif
+
+namespace phevaluator {
+
+namespace {
+
+inline bool IsSeparator(unsigned char c) {
+  return c == ' ' || c == ',' || c == '\t' || c == '\n' || c == '\r';
+}
+
+#ifdef PHEVAL_PARSE_SSSE3
+// b where mask is set, a elsewhere (pblendvb needs SSE4.1)
+PHEVAL_TARGET_SSSE3 inline __m128i Select(__m128i a, __m128i b, __m128i mask) {
+  return _mm_or_si128(_mm_andnot_si128(mask, a), _mm_and_si128(mask, b));
+}
+
+// Parses 16 bytes of back-to-back cards, like "AsKdQhJcTs9s8d7h", into 8 card
+// ids, one per byte of *ids starting from the low byte. Each byte is split
+// into its high and low nibble; the low nibble picks the value out of a
+// shuffle table for each high nibble a rank or a suit can have, and anything
+// else leaves the top bit set. Returns false if any of
+// the 16 bytes isn't a rank (even offsets) or a suit (odd offsets).
+PHEVAL_TARGET_SSSE3 inline bool ParseBlock(const char* text, uint64_t* ids) {
+  const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text));
+  const __m128i nibble = _mm_set1_epi8(0x0f);
+  const __m128i lo = _mm_and_si128(x, nibble);
+  const __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+  const __m128i bad = _mm_set1_epi8(static_cast<char>(0x80));
+
+  // '2'..'9' are 0x32..0x39, 'A' 0x41, 'J' 0x4a, 'K' 0x4b, 'Q' 0x51, 'T' 0x54
+  const __m128i ranks3 = _mm_setr_epi8(
+      -128, -128, 0, 1, 2, 3, 4, 5, 6, 7, -128, -128, -128, -128, -128, -128);
+  const __m128i ranks4 = _mm_setr_epi8(
+      -128, 12, -128, -128, -128, -128, -128, -128, -128, -128, 9, 11, -128,
+      -128, -128, -128);
+  const __m128i ranks5 = _mm_setr_epi8(
+      -128, 10, -128, -128, 8, -128, -128, -128, -128, -128, -128, -128, -128,
+      -128, -128, -128);
+  __m128i rank = bad;
+  rank = Select(rank, _mm_shuffle_epi8(ranks3, lo),
+                _mm_cmpeq_epi8(hi, _mm_set1_epi8(3)));
+  rank = Select(rank, _mm_shuffle_epi8(ranks4, lo),
+                _mm_cmpeq_epi8(hi, _mm_set1_epi8(4)));
+  rank = Select(rank, _mm_shuffle_epi8(ranks5, lo),
+                _mm_cmpeq_epi8(hi, _mm_set1_epi8(5)));
+
+  // Setting bit 5 folds 'C', 'D', 'H', 'S' onto 'c' 0x63, 'd' 0x64, 'h' 0x68
+  // and 's' 0x73, and nothing else onto them.
+  const __m128i lower = _mm_or_si128(x, _mm_set1_epi8(0x20));
+  const __m128i suit_hi = _mm_and_si128(_mm_srli_epi16(lower, 4), nibble);
+  const __m128i suits6 = _mm_setr_epi8(
+      -128, -128, -128, 0, 1, -128, -128, -128, 2, -128, -128, -128, -128,
+      -128, -128, -128);
+  const __m128i suits7 = _mm_setr_epi8(
+      -128, -128, -128, 3, -128, -128, -128, -128, -128, -128, -128, -128,
+      -128, -128, -128, -128);
+  __m128i suit = bad;
+  suit = Select(suit, _mm_shuffle_epi8(suits6, lo),
+                _mm_cmpeq_epi8(suit_hi, _mm_set1_epi8(6)));
+  suit = Select(suit, _mm_shuffle_epi8(suits7, lo),
+                _mm_cmpeq_epi8(suit_hi, _mm_set1_epi8(7)));
+
+  // Ranks at even offsets, suits at odd ones
+  const __m128i odd = _mm_set1_epi16(static_cast<short>(0xff00));
+  const __m128i values = _mm_or_si128(_mm_andnot_si128(odd, rank),
+                                      _mm_and_si128(odd, suit));
+  if (_mm_movemask_epi8(values) != 0) return false;
+
+  // rank * 4 + suit for each byte pair, then narrowed back to bytes
+  const __m128i pairs =
+      _mm_maddubs_epi16(values, _mm_set1_epi16(0x0104));
+  *ids = static_cast<uint64_t>(
+      _mm_cvtsi128_si64(_mm_packus_epi16(pairs, pairs)));
+  return true;
+}
+#endif
+
+// The parser behind both ParseHand overloads, with or without the SSSE3
+// blocks. Card ids go to `cards` unless it is null; `seen` ends up with the
+// mask of every card parsed.
+template <bool kBlocks>
+inline ParseResult ParseCards(std::string_view text, int* cards,
+                              size_t capacity, uint64_t& seen) {
+  const size_t n = text.size();
+  size_t count = 0;
+  size_t i = 0;
+  seen = 0;
+#ifdef PHEVAL_PARSE_SSSE3
+  // After a block fails, e.g. on separators, stay scalar past it so text
+  // like "As Kd Qh" doesn't retry the vector path at every card.
+  size_t scalar_until = 0;
+#endif
+
+  auto result = [&](size_t position, ParseStatus status) {
+    return ParseResult{static_cast<int>(count), position, status};
+  };
+
+  while (i < n) {
+    const unsigned char c = static_cast<unsigned char>(text[i]);
+    if (IsSeparator(c)) {
+      i++;
+      continue;
+    }
+
+#ifdef PHEVAL_PARSE_SSSE3
+    if (kBlocks && i >= scalar_until && n - i >= 16 &&
+        capacity - count >= 8) {
+      uint64_t ids;
+      if (ParseBlock(text.data() + i, &ids)) {
+        uint64_t block = 0;
+        uint64_t repeats = 0;
+        for (int k = 0; k < 64; k += 8) {
+          const uint64_t bit = uint64_t(1) << ((ids >> k) & 0xff);
+          repeats |= block & bit;
+          block |= bit;
+        }
+        if (((block & seen) | repeats) == 0) {
+          if (cards != nullptr) {
+            for (int k = 0; k < 8; k++) {
+              cards[count + k] = static_cast<int>((ids >> (8 * k)) & 0xff);
+            }
+          }
+          seen |= block;
+          count += 8;
+          i += 16;
+          continue;
+        }
+      }
+      scalar_until = i + 16;
+    }
+#endif
+
+    const int rank = kRankIndex[c];
+    if (rank < 0) return result(i, ParseStatus::kInvalidRank);
+    if (i + 1 >= n) return result(i + 1, ParseStatus::kMissingSuit);
+    const int suit = kSuitIndex[static_cast<unsigned char>(text[i + 1])];
+    if (suit < 0) return result(i + 1, ParseStatus::kInvalidSuit);
+
+    const int id = rank * 4 + suit;
+    const uint64_t bit = uint64_t(1) << id;
+    if (seen & bit) return result(i, ParseStatus::kDuplicate);
+    if (count == capacity) return result(i, ParseStatus::kTooManyCards);
+    seen |= bit;
+    if (cards != nullptr) cards[count] = id;
+    count++;
+    i += 2;
+  }
+  return result(n, ParseStatus::kOk);
+}
+
+#ifdef PHEVAL_PARSE_SSSE3
+PHEVAL_TARGET_SSSE3 ParseResult ParseBlocks(std::string_view text, int* cards,
+                                            size_t capacity, uint64_t& seen) {
+  return ParseCards<true>(text, cards, capacity, seen);
+}
+#endif
+
+ParseResult Parse(std::string_view text, int* cards, size_t capacity,
+                  uint64_t& seen) {
+#if defined(PHEVAL_PARSE_DISPATCH)
+  static const bool ssse3 = __builtin_cpu_supports("ssse3");
+  if (ssse3) return ParseBlocks(text, cards, capacity, seen);
+  return ParseCards<false>(text, cards, capacity, seen);
+#elif defined(PHEVAL_PARSE_SSSE3)
+  return ParseBlocks(text, cards, capacity, seen);
+#else
+  return ParseCards<false>(text, cards, capacity, seen);
+#endif
+}
+
+}  // namespace
+
+ParseResult ParseHand(std::string_view text, int* cards, size_t capacity) {
+  uint64_t seen;
+  return Parse(text, cards, capacity, seen);
+}
+
+ParseResult ParseHand(std::string_view text, uint64_t& mask) {
+  // The duplicate check caps a mask at 52 cards, so no capacity is needed
+  return Parse(text, nullptr, 64, mask);
+}
+
+}  // namespace phevaluator
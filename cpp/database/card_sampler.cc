@@ -1,9 +1,10 @@
 #include <phevaluator/card_sampler.h>
 
 #include <array>
+#include <atomic>
 #include <chrono> //for the system clock
 #include <numeric>
-#include <random>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -12,39 +13,176 @@
 
 namespace card_sampler {
 
-static unsigned seed =
-    std::chrono::system_clock::now().time_since_epoch().count(); //for the seed
+static uint64_t splitmix64(uint64_t& x) {
+  uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
 
-static std::default_random_engine generator(seed); //for the random number generator 
+std::array<uint32_t, 4> Philox4x32(std::array<uint32_t, 4> c,
+                                   std::array<uint32_t, 2> key) {
+  for (int round = 0; round < 10; round++) {
+    const uint64_t p0 = uint64_t(0xD2511F53) * c[0];
+    const uint64_t p1 = uint64_t(0xCD9E8D57) * c[2];
+    c = {static_cast<uint32_t>(p1 >> 32) ^ c[1] ^ key[0],
+         static_cast<uint32_t>(p1),
+         static_cast<uint32_t>(p0 >> 32) ^ c[3] ^ key[1],
+         static_cast<uint32_t>(p0)};
+    key[0] += 0x9E3779B9;
+    key[1] += 0xBB67AE85;
+  }
+  return c;
+}
 
-CardSampler::CardSampler(void) { std::iota(deck.begin(), deck.end(), 0); } //for the initial deck
+Xoshiro256::Xoshiro256(uint64_t seed) {
+  for (uint64_t& word : s_) word = splitmix64(seed);
+}
+
+Xoshiro256 Xoshiro256::ForStream(uint64_t seed, uint64_t stream) {
+  const std::array<uint32_t, 2> key = {static_cast<uint32_t>(seed),
+                                       static_cast<uint32_t>(seed >> 32)};
+  Xoshiro256 rng;
+  for (uint32_t block = 0; block < 2; block++) {
+    const std::array<uint32_t, 4> x = Philox4x32(
+        {block, 0, static_cast<uint32_t>(stream),
+         static_cast<uint32_t>(stream >> 32)},
+        key);
+    rng.s_[2 * block] = x[0] | uint64_t(x[1]) << 32;
+    rng.s_[2 * block + 1] = x[2] | uint64_t(x[3]) << 32;
+  }
+  // The all-zero state is the one xoshiro can't leave
+  if ((rng.s_[0] | rng.s_[1] | rng.s_[2] | rng.s_[3]) == 0) rng.s_[0] = 1;
+  return rng;
+}
+
+void Xoshiro256::jump() {
+  static const uint64_t kJump[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+                                   0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+  uint64_t s[4] = {0, 0, 0, 0};
+  for (uint64_t word : kJump) {
+    for (int b = 0; b < 64; b++) {
+      if (word & uint64_t(1) << b) {
+        for (int i = 0; i < 4; i++) s[i] ^= s_[i];
+      }
+      operator()();
+    }
+  }
+  for (int i = 0; i < 4; i++) s_[i] = s[i];
+}
+
+// Samplers created at the same clock tick, e.g. one per thread, still get
+// different seeds from the counter.
+static uint64_t DefaultSeed(void) {
+  static std::atomic<uint64_t> counter{0};
+  uint64_t x = counter.fetch_add(1, std::memory_order_relaxed);
+  const uint64_t clock =
+      std::chrono::system_clock::now().time_since_epoch().count();
+  return splitmix64(x) ^ clock;
+}
+
+CardSampler::CardSampler(void) : rng(DefaultSeed()) {
+  std::iota(deck.begin(), deck.end(), 0); //for the initial deck
+}
+
+CardSampler::CardSampler(uint64_t seed, uint64_t stream)
+    : rng(Xoshiro256::ForStream(seed, stream)) {
+  std::iota(deck.begin(), deck.end(), 0);
+}
+
+void CardSampler::reseed(uint64_t seed, uint64_t stream) {
+  rng = Xoshiro256::ForStream(seed, stream);
+  std::iota(deck.begin(), deck.end(), 0);
+  live_count = 52;
+  dead = 0;
+}
+
+void CardSampler::setDeadCards(uint64_t dead_cards) {
+  live_count = 0;
+  for (int id = 0; id < 52; id++) {
+    if (!((dead_cards >> id) & 1)) deck[live_count++] = id;
+  }
+  dead = dead_cards;
+}
 
 // This function samples `size` unique cards from the deck using a partial Fisher-Yates shuffle.
 // Algorithm explanation:
-// - We maintain a "residual" deck of cards (initially all 52).
+// - We maintain a "residual" deck of cards (initially all live cards).
 // - For each card to sample:
 //   1. Pick a random index within the range of remaining (unpicked) cards.
 //   2. Swap the card at that index with the last unpicked card in the deck.
 //   3. Add the swapped card (now at the end of the unpicked range) to the result.
 //   4. Reduce the range of unpicked cards by one (so we don't pick the same card again).
 // - This ensures each card is sampled uniformly at random and without replacement.
+// The deck isn't reset between calls: any order of the live cards is as good
+// a starting point as the sorted one.
 
-std::vector<int> CardSampler::sample(int size) {
-  std::vector<int> ret;
-  int residual_cards = deck.size();
+static int LiveCards(uint64_t dead_cards) {
+  return 52 - __builtin_popcountll(dead_cards & 0xfffffffffffffULL);
+}
+
+void CardSampler::sample_into(int* out, int size, uint64_t dead_cards) {
+  if (dead_cards != dead) {
+    // For a dead mask that changes every call, as in a Dealer with ranges,
+    // rejecting taken cards beats rebuilding the deck while at least half
+    // of the live cards remain.
+    if (size >= 0 && size * 2 <= LiveCards(dead_cards)) {
+      uint64_t taken = dead_cards;
+      for (int i = 0; i < size; i++) {
+        int card;
+        do {
+          card = rng.bounded(52);
+        } while ((taken >> card) & 1);
+        taken |= uint64_t(1) << card;
+        out[i] = card;
+      }
+      return;
+    }
+    setDeadCards(dead_cards);
+  }
+  if (size < 0 || size > live_count) {
+    throw std::invalid_argument("Not enough cards to sample from");
+  }
 
-  
+  int residual_cards = live_count;
   for (int i = 0; i < size; i++) {
     // Pick a random index from the remaining unpicked cards
-    int target_index = generator() % residual_cards;
+    int target_index = rng.bounded(residual_cards);
     int tail_index = residual_cards - 1;
     // Swap the chosen card to the end of the unpicked range
     std::swap(deck[target_index], deck[tail_index]);
     // Add the selected card to the result
-    ret.push_back(deck[tail_index]);
+    out[i] = deck[tail_index];
     // Decrease the number of unpicked cards
     residual_cards--;
   }
+}
+
+uint64_t CardSampler::sample_mask(int size, uint64_t dead_cards) {
+  // With at least half of the deck left to draw from, rejecting repeats is
+  // cheaper than keeping the deck: no swaps, and under 2 draws per card.
+  if (size >= 0 && size * 2 <= LiveCards(dead_cards)) {
+    uint64_t taken = dead_cards;
+    for (int i = 0; i < size; i++) {
+      uint64_t bit;
+      do {
+        bit = uint64_t(1) << rng.bounded(52);
+      } while (taken & bit);
+      taken |= bit;
+    }
+    return taken & ~dead_cards;
+  }
+
+  int cards[52];
+  sample_into(cards, size, dead_cards);
+  uint64_t mask = 0;
+  for (int i = 0; i < size; i++) mask |= uint64_t(1) << cards[i];
+  return mask;
+}
+
+std::vector<int> CardSampler::sample(int size) {
+  std::vector<int> ret(size);
+  sample_into(ret.data(), size);
   return ret;
 }
-}  // namespace card_sampler
\ No newline at end of file
+}  // namespace card_sampler
@@ -0,0 +1,59 @@
+#include <phevaluator/combinations.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+extern "C" {
+#include "tables/tables.h"
+}
+
+namespace phevaluator {
+
+Combinations::Combinations(int k, uint64_t dead_cards)
+    : k_(k), dead_(dead_cards & ((uint64_t(1) << 52) - 1)) {
+  live_mask_ = ~dead_ & ((uint64_t(1) << 52) - 1);
+  live_ = __builtin_popcountll(live_mask_);
+  if (k < 1 || k > kMaxCards || live_ < k) {
+    throw std::invalid_argument("Invalid subset size");
+  }
+  size_ = choose[live_][k];
+
+  int position = 0;
+  for (int card = 0; card < 52; card++) {
+    dead_below_[card] = static_cast<uint8_t>(card - position);
+    if ((live_mask_ >> card) & 1) {
+      live_cards_[position++] = static_cast<uint8_t>(card);
+    }
+  }
+}
+
+uint64_t Combinations::rank(uint64_t mask) const {
+  if ((mask & ~live_mask_) || __builtin_popcountll(mask) != k_) {
+    throw std::invalid_argument("Not a subset of the live cards");
+  }
+  uint64_t position = compress(mask);
+  uint64_t index = 0;
+  for (int i = 1; position; i++, position &= position - 1) {
+    index += choose[__builtin_ctzll(position)][i];
+  }
+  return index;
+}
+
+uint64_t Combinations::unrank(uint64_t index) const {
+  if (index >= size_) {
+    throw std::out_of_range("Subset index out of range");
+  }
+  // Greedily the largest position p with C(p, i) <= what is left
+  uint64_t position = 0;
+  int p = live_;
+  for (int i = k_; i >= 1; i--) {
+    do {
+      p--;
+    } while (choose[p][i] > index);
+    index -= choose[p][i];
+    position |= uint64_t(1) << p;
+  }
+  return expand(position);
+}
+
+}  // namespace phevaluator
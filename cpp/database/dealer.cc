@@ -0,0 +1,260 @@
+#include <phevaluator/dealer.h>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace card_sampler {
+
+namespace {
+
+// Vose's alias method over positive weights, with the keep probability
+// scaled to 32 bits: entry i is kept if a 32-bit draw is below keep[i],
+// and replaced by alias[i] otherwise.
+void BuildAlias(const std::vector<double>& weights,
+                std::vector<uint32_t>& keep, std::vector<uint32_t>& alias) {
+  const size_t n = weights.size();
+  double total = 0;
+  for (double weight : weights) total += weight;
+
+  // Scaled so the average entry is 1; entries below 1 are topped up from
+  // one entry above 1, which then moves to the small list if it drops below.
+  std::vector<double> scaled(n);
+  std::vector<uint32_t> small, large;
+  for (size_t i = 0; i < n; i++) {
+    scaled[i] = weights[i] * n / total;
+    (scaled[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+  }
+
+  keep.assign(n, UINT32_MAX);
+  alias.resize(n);
+  for (size_t i = 0; i < n; i++) alias[i] = static_cast<uint32_t>(i);
+
+  while (!small.empty() && !large.empty()) {
+    const uint32_t s = small.back();
+    const uint32_t l = large.back();
+    small.pop_back();
+    keep[s] = static_cast<uint32_t>(scaled[s] * 4294967296.0);
+    alias[s] = l;
+    scaled[l] -= 1.0 - scaled[s];
+    if (scaled[l] < 1.0) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // Whatever is left is 1 up to rounding and always keeps itself
+}
+
+}  // namespace
+
+HandRange::HandRange(int hole_cards) : hole_cards_(hole_cards) {
+  if (hole_cards < 1 || hole_cards > kDealMaxHoleCards) {
+    throw std::invalid_argument("Invalid number of hole cards");
+  }
+}
+
+void HandRange::add(const int* cards, double weight) {
+  if (!(weight > 0)) {
+    throw std::invalid_argument("Range weights must be positive");
+  }
+  Combo combo{};
+  for (int i = 0; i < hole_cards_; i++) {
+    if (cards[i] < 0 || cards[i] >= 52 || ((combo.mask >> cards[i]) & 1)) {
+      throw std::invalid_argument("Invalid card in range");
+    }
+    combo.cards[i] = static_cast<uint8_t>(cards[i]);
+    combo.mask |= uint64_t(1) << cards[i];
+  }
+  combo.weight = weight;
+  combos_.push_back(combo);
+}
+
+Dealer::Dealer(int players, int hole_cards, int board_cards)
+    : players_(players),
+      hole_cards_(hole_cards),
+      board_cards_(board_cards),
+      ranges_(players > 0 ? players : 0) {
+  checkLayout();
+}
+
+Dealer::Dealer(int players, int hole_cards, int board_cards, uint64_t seed,
+               uint64_t stream)
+    : players_(players),
+      hole_cards_(hole_cards),
+      board_cards_(board_cards),
+      sampler_(seed, stream),
+      ranges_(players > 0 ? players : 0) {
+  checkLayout();
+}
+
+void Dealer::checkLayout() const {
+  if (players_ < 1 || players_ > kDealMaxPlayers || hole_cards_ < 0 ||
+      hole_cards_ > kDealMaxHoleCards || board_cards_ < 0 ||
+      board_cards_ > kDealMaxBoardCards ||
+      players_ * hole_cards_ + board_cards_ > 52) {
+    throw std::invalid_argument("Invalid deal layout");
+  }
+}
+
+Dealer::AliasTable Dealer::BuildAliasTable(const HandRange& range) {
+  AliasTable table;
+  table.combos = range.combos();
+  if (table.combos.empty()) {
+    throw std::invalid_argument("Empty range");
+  }
+  std::vector<double> weights;
+  for (const HandRange::Combo& combo : table.combos) {
+    weights.push_back(combo.weight);
+  }
+  BuildAlias(weights, table.keep, table.alias);
+  return table;
+}
+
+void Dealer::setRange(int player, const HandRange& range) {
+  if (player < 0 || player >= players_ || range.holeCards() != hole_cards_) {
+    throw std::invalid_argument("Range doesn't match the deal");
+  }
+  ranges_[player] = BuildAliasTable(range);
+}
+
+void Dealer::clearRange(int player) {
+  if (player < 0 || player >= players_) {
+    throw std::invalid_argument("Invalid player");
+  }
+  ranges_[player] = AliasTable();
+}
+
+bool Dealer::tryDeal(Deal& deal) {
+  Xoshiro256& rng = sampler_.generator();
+  uint64_t taken = dead_;
+
+  for (int p = 0; p < players_; p++) {
+    const AliasTable& table = ranges_[p];
+    if (table.combos.empty()) continue;
+
+    const HandRange::Combo* combo = nullptr;
+    for (int attempt = 0; attempt < kMaxRedraws; attempt++) {
+      const uint32_t i =
+          rng.bounded(static_cast<uint32_t>(table.combos.size()));
+      const uint32_t coin = static_cast<uint32_t>(rng());
+      const HandRange::Combo& pick =
+          table.combos[coin < table.keep[i] ? i : table.alias[i]];
+      if ((pick.mask & taken) == 0) {
+        combo = &pick;
+        break;
+      }
+    }
+    if (combo == nullptr) return false;
+
+    for (int i = 0; i < hole_cards_; i++) deal.hole[p][i] = combo->cards[i];
+    taken |= combo->mask;
+  }
+
+  // The random players' cards and the board in one draw
+  int cards[52];
+  int n = board_cards_;
+  for (int p = 0; p < players_; p++) {
+    if (ranges_[p].combos.empty()) n += hole_cards_;
+  }
+  sampler_.sample_into(cards, n, taken);
+
+  int next = 0;
+  for (int p = 0; p < players_; p++) {
+    if (!ranges_[p].combos.empty()) continue;
+    for (int i = 0; i < hole_cards_; i++) {
+      deal.hole[p][i] = static_cast<uint8_t>(cards[next++]);
+    }
+  }
+  for (int i = 0; i < board_cards_; i++) {
+    deal.board[i] = static_cast<uint8_t>(cards[next++]);
+  }
+  for (int i = 0; i < n; i++) taken |= uint64_t(1) << cards[i];
+
+  deal.mask = taken & ~dead_;
+  return true;
+}
+
+void Dealer::deal(Deal& deal) {
+  for (int restart = 0; restart < kMaxRestarts; restart++) {
+    if (tryDeal(deal)) return;
+  }
+  throw std::runtime_error("No deal possible with these ranges");
+}
+
+RangeDealer::RangeDealer(const std::vector<HandRange>& ranges,
+                         uint64_t dead_cards) {
+  if (ranges.empty() || ranges.size() > size_t(kDealMaxPlayers)) {
+    throw std::invalid_argument("Invalid number of players");
+  }
+  hole_cards_ = ranges[0].holeCards();
+  if (static_cast<int>(ranges.size()) * hole_cards_ > 52) {
+    throw std::invalid_argument("Deal needs more cards than a deck");
+  }
+
+  for (const HandRange& range : ranges) {
+    if (range.holeCards() != hole_cards_) {
+      throw std::invalid_argument("Ranges have different numbers of cards");
+    }
+    Table table;
+    std::vector<double> weights;
+    for (const HandRange::Combo& combo : range.combos()) {
+      if (combo.mask & dead_cards) continue;
+      table.combos.push_back(combo);
+      weights.push_back(combo.weight);
+    }
+    if (table.combos.empty()) {
+      throw std::runtime_error("No deal possible with these ranges");
+    }
+    BuildAlias(weights, table.keep, table.alias);
+    tables_.push_back(std::move(table));
+  }
+
+  if (tables_.size() < 2) return;
+  const std::vector<HandRange::Combo>& first = tables_[0].combos;
+  const std::vector<HandRange::Combo>& second = tables_[1].combos;
+  if (first.size() * second.size() > kMaxPairs) return;
+  std::vector<double> weights;
+  for (size_t i = 0; i < first.size(); i++) {
+    for (size_t j = 0; j < second.size(); j++) {
+      if (first[i].mask & second[j].mask) continue;
+      pairs_.push_back({static_cast<uint32_t>(i), static_cast<uint32_t>(j)});
+      weights.push_back(first[i].weight * second[j].weight);
+    }
+  }
+  if (pairs_.empty()) {
+    throw std::runtime_error("No deal possible with these ranges");
+  }
+  BuildAlias(weights, pair_table_.keep, pair_table_.alias);
+}
+
+void RangeDealer::deal(Xoshiro256& rng, Deal& deal) const {
+  const int players = this->players();
+  for (int attempt = 0; attempt < kMaxAttempts; attempt++) {
+    uint64_t taken = 0;
+    int p = 0;
+    if (!pairs_.empty()) {
+      const std::array<uint32_t, 2>& pair = pairs_[pair_table_.draw(rng)];
+      for (; p < 2; p++) {
+        const HandRange::Combo& combo = tables_[p].combos[pair[p]];
+        for (int i = 0; i < hole_cards_; i++) deal.hole[p][i] = combo.cards[i];
+        taken |= combo.mask;
+      }
+    }
+    for (; p < players; p++) {
+      const Table& table = tables_[p];
+      const HandRange::Combo& combo = table.combos[table.draw(rng)];
+      if (combo.mask & taken) break;
+      for (int i = 0; i < hole_cards_; i++) deal.hole[p][i] = combo.cards[i];
+      taken |= combo.mask;
+    }
+    if (p == players) {
+      deal.mask = taken;
+      return;
+    }
+  }
+  throw std::runtime_error("No deal possible with these ranges");
+}
+
+}  // namespace card_sampler
@@ -0,0 +1,875 @@
+#include <phevaluator/combinations.h>
+#include <phevaluator/equity.h>
+#include <phevaluator/numa.h>
+#include <phevaluator/phevaluator.h>
+#include <phevaluator/showdown.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+extern "C" {
+#include "tables/tables.h"
+}
+
+namespace phevaluator {
+
+BoardEvaluator::BoardEvaluator() {
+  const void* local = pheval_numa_local_table("noflush7");
+  noflush7_ = local ? static_cast<const short*>(local) : noflush7;
+}
+
+void BoardEvaluator::setBoard(const uint8_t board[5]) {
+  int suit_count[4] = {};
+  unsigned char quinary[13] = {};
+  for (int i = 0; i < 5; i++) {
+    suit_count[board[i] & 0x3]++;
+    quinary[board[i] >> 2]++;
+  }
+
+  flush_suit_ = -1;
+  flush_count_ = 0;
+  flush_binary_ = 0;
+  for (int s = 0; s < 4; s++) {
+    if (suit_count[s] >= 3) {
+      flush_suit_ = s;
+      flush_count_ = suit_count[s];
+    }
+  }
+  for (int i = 0; i < 5; i++) {
+    if ((board[i] & 0x3) == flush_suit_) flush_binary_ |= 1 << (board[i] >> 2);
+  }
+
+  // hash_quinary (math/hash/hash.c) adds dp[q[i]][12 - i][k] for every rank
+  // i while k, the cards not yet counted, is positive. Below the lower hole
+  // rank k starts from 7, between the hole ranks from 6 and above both from
+  // 5, with the board's counts everywhere else, so those sums are kept per
+  // rank and a hand only looks up the terms of its own two ranks.
+  int below = 0;
+  prefix7_[0] = 0;
+  prefix6_[0] = 0;
+  for (int i = 0; i < 13; i++) {
+    below_[i] = static_cast<unsigned char>(below);
+    quinary_[i] = quinary[i];
+    prefix7_[i + 1] = prefix7_[i] + Term(quinary[i], i, 7 - below);
+    prefix6_[i + 1] = prefix6_[i] + Term(quinary[i], i, 6 - below);
+    below += quinary[i];
+  }
+  suffix5_[13] = 0;
+  for (int i = 12; i >= 0; i--) {
+    suffix5_[i] = suffix5_[i + 1] + Term(quinary[i], i, 5 - below_[i]);
+  }
+}
+
+int BoardEvaluator::evaluate(int a, int b) const {
+  if (flush_suit_ >= 0) {
+    const bool a_suited = (a & 0x3) == flush_suit_;
+    const bool b_suited = (b & 0x3) == flush_suit_;
+    if (flush_count_ + a_suited + b_suited >= 5) {
+      // With 7 cards a flush beats anything the other cards can make
+      int binary = flush_binary_;
+      if (a_suited) binary |= 1 << (a >> 2);
+      if (b_suited) binary |= 1 << (b >> 2);
+      return flush[binary];
+    }
+  }
+
+  int low = a >> 2, high = b >> 2;
+  if (low > high) std::swap(low, high);
+  int hash;
+  if (low == high) {
+    hash = prefix7_[low] + Term(quinary_[low] + 2, low, 7 - below_[low]) +
+           suffix5_[low + 1];
+  } else {
+    hash = prefix7_[low] + Term(quinary_[low] + 1, low, 7 - below_[low]) +
+           prefix6_[high] - prefix6_[low + 1] +
+           Term(quinary_[high] + 1, high, 6 - below_[high]) +
+           suffix5_[high + 1];
+  }
+  return noflush7_[hash];
+}
+
+int BoardEvaluator::Term(int count, int rank, int k) {
+  return k > 0 ? dp[count][12 - rank][k] : 0;
+}
+
+namespace {
+
+// Pot shares are counted in units of 1 / 2520, the least common multiple
+// of 1 .. 10, so a k-way split is a whole number of units for any k.
+const uint64_t kShareUnits = 2520;
+
+struct alignas(64) Tally {
+  uint64_t wins[EquityCalculator::kMaxPlayers] = {};
+  uint64_t ties[EquityCalculator::kMaxPlayers] = {};
+  uint64_t units[EquityCalculator::kMaxPlayers] = {};
+  uint64_t units_squared[EquityCalculator::kMaxPlayers] = {};
+  uint64_t showdowns = 0;  // calls to add
+
+  // Counts one showdown `weight` times
+  void add(const int* ranks, int players, uint64_t weight) {
+    showdowns++;
+    int best = INT_MAX;
+    for (int p = 0; p < players; p++) best = std::min(best, ranks[p]);
+    int winners = 0;
+    for (int p = 0; p < players; p++) winners += ranks[p] == best;
+
+    const uint64_t share = kShareUnits / winners;
+    for (int p = 0; p < players; p++) {
+      if (ranks[p] != best) continue;
+      (winners == 1 ? wins : ties)[p] += weight;
+      units[p] += share * weight;
+      units_squared[p] += share * share * weight;
+    }
+  }
+};
+
+// Adds up the workers' tallies over n showdowns
+EquityResult Summarize(const std::vector<Tally>& tallies, int players,
+                       uint64_t n, bool with_error) {
+  Tally total;
+  for (const Tally& tally : tallies) {
+    total.showdowns += tally.showdowns;
+    for (int p = 0; p < players; p++) {
+      total.wins[p] += tally.wins[p];
+      total.ties[p] += tally.ties[p];
+      total.units[p] += tally.units[p];
+      total.units_squared[p] += tally.units_squared[p];
+    }
+  }
+
+  EquityResult result;
+  result.trials = n;
+  result.evaluated = total.showdowns;
+  result.players.resize(players);
+  const double count = static_cast<double>(n);
+  for (int p = 0; p < players; p++) {
+    EquityPlayerResult& player = result.players[p];
+    player.win = total.wins[p] / count;
+    player.tie = total.ties[p] / count;
+    const double mean = total.units[p] / count;
+    player.equity = mean / kShareUnits;
+    if (with_error && n > 1) {
+      const double variance =
+          (total.units_squared[p] - count * mean * mean) / (count - 1);
+      player.std_error =
+          variance > 0 ? std::sqrt(variance / count) / kShareUnits : 0.0;
+    }
+  }
+  return result;
+}
+
+// Chunks in the first round towards a target standard error
+const uint64_t kFirstRoundChunks = 4;
+
+// Runs the chunks of options.trials on the pool, or on the calling thread,
+// and returns the trials run. With a target, the chunks run in rounds and
+// std_error(trials) gives the largest error after each one.
+uint64_t RunChunks(const EquityOptions& options, ThreadPool* pool,
+                   const std::function<void(size_t, int)>& run_chunk,
+                   const std::function<double(uint64_t)>& std_error) {
+  const uint64_t chunks =
+      (options.trials + options.chunk_trials - 1) / options.chunk_trials;
+  auto run = [&](uint64_t begin, uint64_t end) {
+    if (pool) {
+      pool->parallelFor(end - begin, [&](size_t i, int worker) {
+        run_chunk(begin + i, worker);
+      });
+    } else {
+      for (uint64_t chunk = begin; chunk < end; chunk++) run_chunk(chunk, 0);
+    }
+  };
+  if (options.target_std_error == 0) {
+    run(0, chunks);
+    return options.trials;
+  }
+
+  uint64_t done = 0;
+  uint64_t round = std::min(chunks, kFirstRoundChunks);
+  while (true) {
+    run(done, done + round);
+    done += round;
+    const uint64_t trials = std::min(done * options.chunk_trials,
+                                     options.trials);
+    const double error = std_error(trials);
+    if (done == chunks || error <= options.target_std_error) return trials;
+
+    // The error falls as 1 / sqrt(trials)
+    const double ratio = error / options.target_std_error;
+    const double needed = std::ceil(done * ratio * ratio);
+    round = static_cast<uint64_t>(std::min<double>(needed, 2.0 * done)) - done;
+    round = std::min(std::max<uint64_t>(round, 1), chunks - done);
+  }
+}
+
+// Replaces the plain standard errors of result, over n trials, with ones
+// from the spread of the chunks' results, which are independent when the
+// trials within a chunk aren't. chunk_units holds each chunk's pot units
+// per player; they're added in chunk order so the errors don't depend on
+// the pool.
+void SetChunkErrors(const std::vector<uint64_t>& chunk_units,
+                    uint64_t chunk_trials, uint64_t n, EquityResult& result) {
+  const uint64_t chunks = (n + chunk_trials - 1) / chunk_trials;
+  if (chunks < 2) return;
+  const int players = static_cast<int>(result.players.size());
+  for (int p = 0; p < players; p++) {
+    const double mean = result.players[p].equity * kShareUnits;
+    double spread = 0;
+    for (uint64_t c = 0; c < chunks; c++) {
+      const uint64_t trials = std::min(chunk_trials, n - c * chunk_trials);
+      const double deviation = chunk_units[c * players + p] - mean * trials;
+      spread += deviation * deviation;
+    }
+    const double variance = spread * chunks / (chunks - 1) / n / n;
+    result.players[p].std_error = std::sqrt(variance) / kShareUnits;
+  }
+}
+
+// Bits of x in reverse order
+uint32_t BitReverse(uint32_t x) {
+  x = (x >> 1 & 0x55555555) | (x & 0x55555555) << 1;
+  x = (x >> 2 & 0x33333333) | (x & 0x33333333) << 2;
+  x = (x >> 4 & 0x0F0F0F0F) | (x & 0x0F0F0F0F) << 4;
+  x = (x >> 8 & 0x00FF00FF) | (x & 0x00FF00FF) << 8;
+  return x >> 16 | x << 16;
+}
+
+// Cards of suit 0 (bits 0, 4, .., 48); suit s is these shifted by s
+const uint64_t kSuitLanes = 0x1111111111111ULL;
+
+// The mask with every card's suit s replaced by permutation[s]
+uint64_t PermuteSuits(uint64_t mask, const uint8_t permutation[4]) {
+  uint64_t permuted = 0;
+  for (int s = 0; s < 4; s++) {
+    permuted |= ((mask >> s) & kSuitLanes) << permutation[s];
+  }
+  return permuted;
+}
+
+// The hands of one starting hand class
+struct HandClass {
+  int high, low;  // ranks
+  bool suited;
+  int count = 0;
+  uint8_t cards[12][2];
+  uint64_t masks[12];
+
+  HandClass(int row, int column)
+      : high(12 - std::min(row, column)),
+        low(12 - std::max(row, column)),
+        suited(row < column) {
+    for (int s = 0; s < 4; s++) {
+      for (int t = 0; t < 4; t++) {
+        const bool take = high == low ? s < t : suited ? s == t : s != t;
+        if (!take) continue;
+        cards[count][0] = static_cast<uint8_t>(high * 4 + s);
+        cards[count][1] = static_cast<uint8_t>(low * 4 + t);
+        masks[count] = uint64_t(1) << cards[count][0] |
+                       uint64_t(1) << cards[count][1];
+        count++;
+      }
+    }
+  }
+
+  // Hands of the class that avoid the cards in `taken`
+  int live(uint64_t taken) const {
+    // Set bits of a suit nibble; a table, as popcount may be a library call
+    static const uint8_t kSuits[16] = {0, 1, 1, 2, 1, 2, 2, 3,
+                                       1, 2, 2, 3, 2, 3, 3, 4};
+    const unsigned high_suits = ~(taken >> (high * 4)) & 0xF;
+    const unsigned low_suits = ~(taken >> (low * 4)) & 0xF;
+    const int h = kSuits[high_suits];
+    if (high == low) return h * (h - 1) / 2;
+    const int both = kSuits[high_suits & low_suits];
+    return suited ? both : h * kSuits[low_suits] - both;
+  }
+};
+
+// Sums over the trials of one grid cell, with w the trial's weight (live
+// hands of the class) and x the hand's pot share in units
+struct GridCell {
+  uint64_t weight = 0;          // w
+  uint64_t weight_squared = 0;  // w^2
+  uint64_t wins = 0;            // w, for the trials won outright
+  uint64_t ties = 0;            // w, for the trials split
+  uint64_t units = 0;           // w x
+  uint64_t units_weighted = 0;  // w^2 x
+  uint64_t units_squared = 0;   // w^2 x^2
+};
+
+struct alignas(64) GridTally {
+  GridCell cells[StartingHandGrid::kSize][StartingHandGrid::kSize];
+};
+
+StartingHandGrid SummarizeGrid(const std::vector<GridTally>& tallies,
+                               uint64_t trials) {
+  const int kSize = StartingHandGrid::kSize;
+  StartingHandGrid grid;
+  grid.trials = trials;
+  for (int row = 0; row < kSize; row++) {
+    for (int column = 0; column < kSize; column++) {
+      GridCell total;
+      for (const GridTally& tally : tallies) {
+        const GridCell& cell = tally.cells[row][column];
+        total.weight += cell.weight;
+        total.weight_squared += cell.weight_squared;
+        total.wins += cell.wins;
+        total.ties += cell.ties;
+        total.units += cell.units;
+        total.units_weighted += cell.units_weighted;
+        total.units_squared += cell.units_squared;
+      }
+      if (total.weight == 0) continue;
+
+      // The ratio estimate sum(w x) / sum(w) and its delta-method error
+      const double weight = static_cast<double>(total.weight);
+      const double mean = total.units / weight;
+      const double spread = total.units_squared -
+                            2 * mean * total.units_weighted +
+                            mean * mean * total.weight_squared;
+      EquityPlayerResult& result = grid.cells[row][column];
+      result.win = total.wins / weight;
+      result.tie = total.ties / weight;
+      result.equity = mean / kShareUnits;
+      result.std_error =
+          spread > 0 ? std::sqrt(spread) / weight / kShareUnits : 0.0;
+    }
+  }
+  return grid;
+}
+
+// Runouts of EnumerateRangeEquity are split into at most this many parts,
+// whatever the pool, and their sums added in order
+const uint64_t kRangeParts = 64;
+
+// Per hand of one range, the other range's weight that it beats, ties and
+// can face, added up over runouts
+struct RangeSums {
+  std::vector<double> beaten, tied, faced;
+
+  RangeSums()
+      : beaten(HoldemRange::kHands),
+        tied(HoldemRange::kHands),
+        faced(HoldemRange::kHands) {}
+};
+
+}  // namespace
+
+EquityCalculator::EquityCalculator(int players)
+    : players_(players),
+      seats_(players > 0 ? players : 0, Seat::kRandom),
+      hands_(players > 0 ? players : 0),
+      ranges_(players > 0 ? players : 0, card_sampler::HandRange(2)) {
+  if (players < kMinPlayers || players > kMaxPlayers) {
+    throw std::invalid_argument("Equity needs 2 to 10 players");
+  }
+}
+
+void EquityCalculator::setHand(int player, const Hand<2>& hand) {
+  if (player < 0 || player >= players_) {
+    throw std::invalid_argument("Invalid player");
+  }
+  seats_[player] = Seat::kKnown;
+  hands_[player] = hand;
+}
+
+void EquityCalculator::setRange(int player,
+                                const card_sampler::HandRange& range) {
+  if (player < 0 || player >= players_ || range.holeCards() != 2) {
+    throw std::invalid_argument("Invalid player or range");
+  }
+  seats_[player] = Seat::kRange;
+  ranges_[player] = range;
+}
+
+void EquityCalculator::setRandom(int player) {
+  if (player < 0 || player >= players_) {
+    throw std::invalid_argument("Invalid player");
+  }
+  seats_[player] = Seat::kRandom;
+}
+
+EquityResult EquityCalculator::calculate(const EquityOptions& options,
+                                         ThreadPool* pool) const {
+  if (options.trials == 0 || options.chunk_trials == 0) {
+    throw std::invalid_argument("No trials to run");
+  }
+  if (!(options.target_std_error >= 0)) {
+    throw std::invalid_argument("Negative target standard error");
+  }
+  const int board_cards = options.board_cards;
+  if (board_cards < 3 || board_cards > Board::kMaxCards ||
+      board_.size() > board_cards) {
+    throw std::invalid_argument("Invalid number of board cards");
+  }
+
+  // Known cards are dead to both dealers. The RangeDealer deals the ranged
+  // players together, and the Dealer deals the random players around them
+  const uint64_t known = knownCards();
+  int ranged[kMaxPlayers];  // the RangeDealer's player of each seat, or -1
+  int dealt[kMaxPlayers];   // the Dealer's player of each seat, or -1
+  std::vector<card_sampler::HandRange> ranges;
+  int dealt_players = 0;
+  for (int p = 0; p < players_; p++) {
+    ranged[p] = dealt[p] = -1;
+    if (seats_[p] == Seat::kRange) {
+      ranged[p] = static_cast<int>(ranges.size());
+      ranges.push_back(ranges_[p]);
+    } else if (seats_[p] == Seat::kRandom) {
+      dealt[p] = dealt_players++;
+    }
+  }
+  std::optional<card_sampler::RangeDealer> range_dealer;
+  if (!ranges.empty()) range_dealer.emplace(ranges, known);
+
+  const int board_known = board_.size();
+  const int runout_cards = board_cards - board_known;
+  // Outside kPlain the Dealer only deals the players, and the rest of the
+  // board comes from the index of its runout. With every hand known the
+  // Dealer only deals the board.
+  const EquitySampling sampling =
+      runout_cards > 0 ? options.sampling : EquitySampling::kPlain;
+  const bool indexed = sampling != EquitySampling::kPlain;
+  const bool fixed_hands = dealt_players == 0 && !range_dealer;
+  card_sampler::Dealer dealer(dealt_players ? dealt_players : 1,
+                              dealt_players ? 2 : 0,
+                              indexed ? 0 : runout_cards);
+  dealer.setDeadCards(known);
+  std::optional<Combinations> fixed_runouts;
+  if (indexed && fixed_hands) fixed_runouts.emplace(runout_cards, known);
+
+  const uint64_t chunks =
+      (options.trials + options.chunk_trials - 1) / options.chunk_trials;
+  const int threads = pool ? pool->threads() : 1;
+  std::vector<Tally> tallies(threads);
+  std::vector<card_sampler::Dealer> dealers(threads, dealer);
+  // Each chunk's pot units per player, for the indexed samplers' errors
+  std::vector<uint64_t> chunk_units(indexed ? chunks * players_ : 0);
+
+  auto run_chunk = [&](size_t chunk, int worker) {
+    card_sampler::Dealer& local = dealers[worker];
+    Tally& tally = tallies[worker];
+    const uint64_t stream = (options.stream << 32) + chunk;
+    local.reseed(options.seed, stream);
+    const uint64_t first = chunk * options.chunk_trials;
+    const uint64_t count =
+        std::min(options.chunk_trials, options.trials - first);
+    uint64_t units_before[kMaxPlayers];
+    std::copy(tally.units, tally.units + players_, units_before);
+
+    // Ranged hands and runout indices come from their own generator
+    card_sampler::Xoshiro256 picks =
+        card_sampler::Xoshiro256::ForStream(~options.seed, stream);
+    const uint64_t shift = picks();
+    uint64_t index = 0;
+
+    uint8_t board[Board::kMaxCards];
+    for (int i = 0; i < board_known; i++) board[i] = board_.data()[i];
+    BoardEvaluator evaluator;
+    card_sampler::Deal deal{};
+    card_sampler::Deal range_deal{};
+    int ranks[kMaxPlayers];
+
+    for (uint64_t trial = 0; trial < count; trial++) {
+      // The second runout of an antithetic pair keeps the first's hands
+      const bool paired = sampling == EquitySampling::kAntithetic && trial % 2;
+      if (range_dealer && !paired) {
+        range_dealer->deal(picks, range_deal);
+        local.setDeadCards(known | range_deal.mask);
+      }
+      if (!indexed || (dealt_players && !paired)) local.deal(deal);
+
+      if (indexed) {
+        std::optional<Combinations> dealt_runouts;
+        if (!fixed_runouts) {
+          dealt_runouts.emplace(runout_cards,
+                                known | range_deal.mask | deal.mask);
+        }
+        const Combinations& runouts =
+            fixed_runouts ? *fixed_runouts : *dealt_runouts;
+        const uint64_t size = runouts.size();
+        switch (sampling) {
+          case EquitySampling::kStratified: {
+            // floor((trial + v) * size / count) for a uniform v in [0, 1)
+            const double v = (picks() >> 11) * 0x1.0p-53;
+            index = std::min<uint64_t>(size - 1, (trial + v) * size / count);
+            break;
+          }
+          case EquitySampling::kAntithetic:
+            index = paired ? size - 1 - index
+                           : picks.bounded(static_cast<uint32_t>(size));
+            break;
+          default:
+            index = (uint64_t(BitReverse(static_cast<uint32_t>(trial)) ^
+                              static_cast<uint32_t>(shift)) *
+                     size) >> 32;
+            break;
+        }
+        int cards[Board::kMaxCards];
+        Combinations::Cards(runouts.unrank(index), cards);
+        for (int i = 0; i < runout_cards; i++) {
+          board[board_known + i] = static_cast<uint8_t>(cards[i]);
+        }
+      } else {
+        for (int i = board_known; i < board_cards; i++) {
+          board[i] = deal.board[i - board_known];
+        }
+      }
+      if (board_cards == 5) evaluator.setBoard(board);
+
+      for (int p = 0; p < players_; p++) {
+        const uint8_t* h = ranged[p] >= 0  ? range_deal.hole[ranged[p]]
+                           : dealt[p] >= 0 ? deal.hole[dealt[p]]
+                                           : hands_[p].data();
+        if (board_cards == 5) {
+          ranks[p] = evaluator.evaluate(h[0], h[1]);
+        } else if (board_cards == 4) {
+          ranks[p] = evaluate_6cards(board[0], board[1], board[2], board[3],
+                                     h[0], h[1]);
+        } else {
+          ranks[p] = evaluate_5cards(board[0], board[1], board[2], h[0], h[1]);
+        }
+      }
+      tally.add(ranks, players_, 1);
+    }
+
+    if (indexed) {
+      for (int p = 0; p < players_; p++) {
+        chunk_units[chunk * players_ + p] = tally.units[p] - units_before[p];
+      }
+    }
+  };
+
+  auto summarize = [&](uint64_t run) {
+    EquityResult result = Summarize(tallies, players_, run, true);
+    if (indexed) {
+      SetChunkErrors(chunk_units, options.chunk_trials, run, result);
+    }
+    return result;
+  };
+  const uint64_t trials =
+      RunChunks(options, pool, run_chunk, [&](uint64_t run) {
+        double error = 0;
+        for (const EquityPlayerResult& player : summarize(run).players) {
+          error = std::max(error, player.std_error);
+        }
+        return error;
+      });
+  return summarize(trials);
+}
+
+uint64_t EquityCalculator::knownCards() const {
+  uint64_t known = board_.mask();
+  if (known & dead_) {
+    throw std::invalid_argument("Dead cards on the board");
+  }
+  known |= dead_;
+  for (int p = 0; p < players_; p++) {
+    if (seats_[p] != Seat::kKnown) continue;
+    if (hands_[p].overlaps(known)) {
+      throw std::invalid_argument("Known cards overlap");
+    }
+    known |= hands_[p].mask();
+  }
+  return known;
+}
+
+EquityResult EquityCalculator::enumerate(ThreadPool* pool) const {
+  for (int p = 0; p < players_; p++) {
+    if (seats_[p] != Seat::kKnown) {
+      throw std::invalid_argument("Enumeration needs every hand known");
+    }
+  }
+  const uint64_t known = knownCards();
+
+  // The suit permutations that map every hand, the board and the dead
+  // cards onto themselves
+  std::vector<std::array<uint8_t, 4>> group;
+  std::array<uint8_t, 4> permutation = {0, 1, 2, 3};
+  do {
+    const uint8_t* g = permutation.data();
+    bool fixes = PermuteSuits(board_.mask(), g) == board_.mask() &&
+                 PermuteSuits(dead_, g) == dead_;
+    for (int p = 0; p < players_ && fixes; p++) {
+      fixes = PermuteSuits(hands_[p].mask(), g) == hands_[p].mask();
+    }
+    if (fixes) group.push_back(permutation);
+  } while (std::next_permutation(permutation.begin(), permutation.end()));
+
+  const int board_known = board_.size();
+  const int runout_cards = Board::kMaxCards - board_known;
+  const int threads = pool ? pool->threads() : 1;
+  std::vector<Tally> tallies(threads);
+  std::vector<BoardEvaluator> evaluators(threads);
+
+  auto showdown = [&](const uint8_t* board, uint64_t weight, int worker) {
+    BoardEvaluator& evaluator = evaluators[worker];
+    evaluator.setBoard(board);
+    int ranks[kMaxPlayers];
+    for (int p = 0; p < players_; p++) {
+      const uint8_t* h = hands_[p].data();
+      ranks[p] = evaluator.evaluate(h[0], h[1]);
+    }
+    tallies[worker].add(ranks, players_, weight);
+  };
+
+  if (runout_cards == 0) {
+    showdown(board_.data(), 1, 0);
+    return Summarize(tallies, players_, 1, false);
+  }
+
+  const Combinations runouts(runout_cards, known);
+  const uint64_t shards = std::min<uint64_t>(runouts.size(), threads * 16);
+  auto run_shard = [&](size_t shard, int worker) {
+    const Combinations::Range range = runouts.shard(shard, shards);
+    uint8_t board[Board::kMaxCards];
+    std::copy(board_.data(), board_.data() + board_known, board);
+    runouts.forEach(range.begin, range.end, [&](uint64_t runout) {
+      // Only the least runout of its class is evaluated, weighted by the
+      // number of distinct runouts in the class
+      uint64_t images[24];
+      int distinct = 0;
+      for (const std::array<uint8_t, 4>& g : group) {
+        const uint64_t image = PermuteSuits(runout, g.data());
+        if (image < runout) return;
+        bool seen = false;
+        for (int i = 0; i < distinct && !seen; i++) seen = images[i] == image;
+        if (!seen) images[distinct++] = image;
+      }
+      int cards[Board::kMaxCards];
+      Combinations::Cards(runout, cards);
+      for (int i = 0; i < runout_cards; i++) {
+        board[board_known + i] = static_cast<uint8_t>(cards[i]);
+      }
+      showdown(board, distinct, worker);
+    });
+  };
+
+  if (pool) {
+    pool->parallelFor(shards, run_shard);
+  } else {
+    for (uint64_t shard = 0; shard < shards; shard++) run_shard(shard, 0);
+  }
+  return Summarize(tallies, players_, runouts.size(), false);
+}
+
+StartingHandGrid CalculateStartingHandGrid(int opponents,
+                                           const EquityOptions& options,
+                                           ThreadPool* pool) {
+  const int kSize = StartingHandGrid::kSize;
+  if (opponents < 1 || opponents >= EquityCalculator::kMaxPlayers) {
+    throw std::invalid_argument("Invalid number of opponents");
+  }
+  if (options.trials == 0 || options.chunk_trials == 0) {
+    throw std::invalid_argument("No trials to run");
+  }
+  if (!(options.target_std_error >= 0)) {
+    throw std::invalid_argument("Negative target standard error");
+  }
+  const int board_cards = options.board_cards;
+  if (board_cards < 3 || board_cards > Board::kMaxCards) {
+    throw std::invalid_argument("Invalid number of board cards");
+  }
+
+  std::vector<HandClass> classes;
+  for (int row = 0; row < kSize; row++) {
+    for (int column = 0; column < kSize; column++) {
+      classes.emplace_back(row, column);
+    }
+  }
+
+  const card_sampler::Dealer dealer(opponents, 2, board_cards);
+  const int threads = pool ? pool->threads() : 1;
+  std::vector<GridTally> tallies(threads);
+  std::vector<card_sampler::Dealer> dealers(threads, dealer);
+
+  auto run_chunk = [&](size_t chunk, int worker) {
+    card_sampler::Dealer& local = dealers[worker];
+    GridCell* cells = &tallies[worker].cells[0][0];
+    const uint64_t stream = (options.stream << 32) + chunk;
+    local.reseed(options.seed, stream);
+    // The hands played for each class come from their own generator, so
+    // the deals don't depend on how often a pick was redrawn
+    card_sampler::Xoshiro256 picks =
+        card_sampler::Xoshiro256::ForStream(~options.seed, stream);
+    const uint64_t first = chunk * options.chunk_trials;
+    const uint64_t count =
+        std::min(options.chunk_trials, options.trials - first);
+
+    BoardEvaluator evaluator;
+    card_sampler::Deal deal;
+    const uint8_t* board = deal.board;
+    auto rank_of = [&](const uint8_t* h) {
+      if (board_cards == 5) return evaluator.evaluate(h[0], h[1]);
+      if (board_cards == 4) {
+        return evaluate_6cards(board[0], board[1], board[2], board[3], h[0],
+                               h[1]);
+      }
+      return evaluate_5cards(board[0], board[1], board[2], h[0], h[1]);
+    };
+
+    for (uint64_t trial = 0; trial < count; trial++) {
+      local.deal(deal);
+      if (board_cards == 5) evaluator.setBoard(board);
+      int best = INT_MAX, best_count = 0;
+      for (int p = 0; p < opponents; p++) {
+        const int rank = rank_of(deal.hole[p]);
+        if (rank < best) {
+          best = rank;
+          best_count = 0;
+        }
+        best_count += rank == best;
+      }
+      const uint64_t split = kShareUnits / (best_count + 1);
+
+      for (size_t c = 0; c < classes.size(); c++) {
+        const HandClass& hands = classes[c];
+        const uint64_t w = hands.live(deal.mask);
+        if (w == 0) continue;
+        // Uniform over the live hands, by redrawing dealt ones
+        int pick;
+        do {
+          pick = picks.bounded(hands.count);
+        } while (hands.masks[pick] & deal.mask);
+
+        const int rank = rank_of(hands.cards[pick]);
+        // Branch-free: the outcome is close to a coin flip for many classes
+        const uint64_t win = rank < best, tie = rank == best;
+        const uint64_t x = win * kShareUnits + tie * split;
+        GridCell& cell = cells[c];
+        cell.weight += w;
+        cell.weight_squared += w * w;
+        cell.wins += win * w;
+        cell.ties += tie * w;
+        cell.units += w * x;
+        cell.units_weighted += w * w * x;
+        cell.units_squared += w * w * x * x;
+      }
+    }
+  };
+
+  const uint64_t trials =
+      RunChunks(options, pool, run_chunk, [&](uint64_t run) {
+        double error = 0;
+        const StartingHandGrid grid = SummarizeGrid(tallies, run);
+        for (const auto& row : grid.cells) {
+          for (const EquityPlayerResult& cell : row) {
+            error = std::max(error, cell.std_error);
+          }
+        }
+        return error;
+      });
+  return SummarizeGrid(tallies, trials);
+}
+
+RangeEquity EnumerateRangeEquity(const HoldemRange& hero,
+                                 const HoldemRange& villain, const Board& board,
+                                 uint64_t dead_cards, ThreadPool* pool) {
+  if (board.size() < 3) {
+    throw std::invalid_argument("Range enumeration needs a flop");
+  }
+  if (board.mask() & dead_cards) {
+    throw std::invalid_argument("Dead cards on the board");
+  }
+  const uint64_t known = board.mask() | dead_cards;
+
+  // The live hands of either range, and each range's weights
+  const HoldemRange ranges[2] = {hero.without(known), villain.without(known)};
+  const HoldemRange live = ranges[0] | ranges[1];
+  std::vector<double> weights[2];
+  for (int s = 0; s < 2; s++) {
+    weights[s].resize(HoldemRange::kHands);
+    for (int i = 0; i < HoldemRange::kHands; i++) {
+      weights[s][i] = ranges[s].weight(i);
+    }
+  }
+
+  const int board_known = board.size();
+  const int runout_cards = Board::kMaxCards - board_known;
+  std::optional<Combinations> runouts;
+  if (runout_cards > 0) runouts.emplace(runout_cards, known);
+  const uint64_t size = runouts ? runouts->size() : 1;
+  const uint64_t parts = std::min(size, kRangeParts);
+  std::vector<std::array<RangeSums, 2>> sums(parts);
+
+  auto run_part = [&](size_t part, int) {
+    ShowdownTable table;
+    RangeSums runout_sums;
+    uint8_t cards[Board::kMaxCards];
+    std::copy(board.data(), board.data() + board_known, cards);
+    auto showdown = [&](uint64_t runout) {
+      int ids[Board::kMaxCards];
+      Combinations::Cards(runout, ids);
+      for (int i = 0; i < runout_cards; i++) {
+        cards[board_known + i] = static_cast<uint8_t>(ids[i]);
+      }
+      table.setBoard(cards, live);
+      for (int s = 0; s < 2; s++) {
+        table.showdown(weights[1 - s].data(), runout_sums.beaten.data(),
+                       runout_sums.tied.data(), runout_sums.faced.data());
+        RangeSums& part_sums = sums[part][s];
+        for (int position = 0; position < table.size(); position++) {
+          const int i = table.hands()[position];
+          if (weights[s][i] == 0) continue;
+          part_sums.beaten[i] += runout_sums.beaten[i];
+          part_sums.tied[i] += runout_sums.tied[i];
+          part_sums.faced[i] += runout_sums.faced[i];
+        }
+      }
+    };
+    if (runouts) {
+      const Combinations::Range range = runouts->shard(part, parts);
+      runouts->forEach(range.begin, range.end, showdown);
+    } else {
+      showdown(0);
+    }
+  };
+  if (pool) {
+    pool->parallelFor(parts, run_part);
+  } else {
+    for (uint64_t part = 0; part < parts; part++) run_part(part, 0);
+  }
+
+  RangeEquity result;
+  result.runouts = size;
+  for (int s = 0; s < 2; s++) {
+    RangeSums total;
+    for (const std::array<RangeSums, 2>& part : sums) {
+      for (int i = 0; i < HoldemRange::kHands; i++) {
+        total.beaten[i] += part[s].beaten[i];
+        total.tied[i] += part[s].tied[i];
+        total.faced[i] += part[s].faced[i];
+      }
+    }
+
+    double beaten = 0, tied = 0, faced = 0;
+    result.hands[s].assign(HoldemRange::kHands, 0.0);
+    for (int i = 0; i < HoldemRange::kHands; i++) {
+      if (total.faced[i] <= 0) continue;
+      const double w = ranges[s].weight(i);
+      beaten += w * total.beaten[i];
+      tied += w * total.tied[i];
+      faced += w * total.faced[i];
+      result.hands[s][i] = (total.beaten[i] + total.tied[i] / 2) /
+                           total.faced[i];
+    }
+    if (!(faced > 0)) {
+      throw std::runtime_error("No deal possible with these ranges");
+    }
+    EquityPlayerResult& player = result.players[s];
+    player.win = beaten / faced;
+    player.tie = tied / faced;
+    player.equity = (beaten + tied / 2) / faced;
+  }
+  return result;
+}
+
+}  // namespace phevaluator
@@ -0,0 +1,173 @@
+#include <phevaluator/equity_job.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace phevaluator {
+
+EquityJob::EquityJob(JobWork work, JobOptions options)
+    : state_(std::make_unique<State>()) {
+  if (!work || options.chunk_trials == 0) {
+    throw std::invalid_argument("Invalid job");
+  }
+  state_->options = std::move(options);
+  state_->future = state_->promise.get_future().share();
+  State* state = state_.get();
+  thread_ = std::thread([state, work = std::move(work)] { Run(state, work); });
+}
+
+EquityJob::~EquityJob() {
+  if (!thread_.joinable()) return;
+  state_->stop.store(true, std::memory_order_relaxed);
+  if (thread_.get_id() == std::this_thread::get_id()) {
+    // Destroyed by a continuation; Run no longer touches the state.
+    thread_.detach();
+  } else {
+    thread_.join();
+  }
+}
+
+EquityEstimate EquityJob::progress() const {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->estimate;
+}
+
+void EquityJob::then(std::function<void()> callback) {
+  if (!AddContinuation(state_.get(), callback)) callback();
+}
+
+bool EquityJob::AddContinuation(State* state, std::function<void()> callback) {
+  std::lock_guard<std::mutex> lock(state->mutex);
+  if (state->done.load(std::memory_order_relaxed)) return false;
+  state->continuations.push_back(std::move(callback));
+  return true;
+}
+
+void EquityJob::Run(State* state, const JobWork& work) {
+  using Clock = std::chrono::steady_clock;
+  const JobOptions& options = state->options;
+  EquityAccumulator acc;
+  JobStatus status = JobStatus::kComplete;
+  Clock::time_point next_progress = Clock::now() + options.progress_interval;
+
+  std::exception_ptr error;
+  try {
+    while (acc.trials() < options.max_trials) {
+      if (options.cancel.cancelled() ||
+          state->stop.load(std::memory_order_relaxed)) {
+        status = JobStatus::kCancelled;
+        break;
+      }
+      const Clock::time_point now = Clock::now();
+      if (now >= options.deadline) {
+        status = JobStatus::kDeadline;
+        break;
+      }
+
+      const uint64_t first = acc.trials();
+      const uint64_t count =
+          std::min(options.chunk_trials, options.max_trials - first);
+      EquityAccumulator chunk;
+      work(first, count, chunk);
+      acc.merge(chunk);
+
+      const EquityEstimate estimate{acc.trials(), acc.mean(), acc.stdError()};
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->estimate = estimate;
+      }
+      if (options.on_progress && now >= next_progress) {
+        options.on_progress(estimate);
+        next_progress = now + options.progress_interval;
+      }
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  // done() is true by the time the future is ready
+  std::vector<std::function<void()>> continuations;
+  {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->done.store(true, std::memory_order_release);
+    continuations.swap(state->continuations);
+  }
+  if (error) {
+    state->promise.set_exception(error);
+  } else {
+    state->promise.set_value(JobResult{
+        EquityEstimate{acc.trials(), acc.mean(), acc.stdError()}, status});
+  }
+  // The last use of state: a continuation may destroy the job.
+  for (std::function<void()>& continuation : continuations) continuation();
+}
+
+namespace {
+
+// One trial of Hold'em equity per call; see EquityQuery.
+class HoldemEquityWork {
+ public:
+  HoldemEquityWork(const EquityQuery& query, uint64_t seed)
+      : query_(query),
+        dealer_(std::make_shared<card_sampler::Dealer>(
+            query.opponents, 2, Board::kMaxCards - query.board.size(), seed)) {
+    if (query.ranges.size() > static_cast<size_t>(query.opponents)) {
+      throw std::invalid_argument("More ranges than opponents");
+    }
+    if (query.hero.overlaps(query.board.mask())) {
+      throw std::invalid_argument("The hero's cards are on the board");
+    }
+    dealer_->setDeadCards(query.hero.mask() | query.board.mask());
+    for (size_t p = 0; p < query.ranges.size(); p++) {
+      dealer_->setRange(static_cast<int>(p), query.ranges[p]);
+    }
+  }
+
+  void operator()(uint64_t, uint64_t count, EquityAccumulator& acc) const {
+    const int known = query_.board.size();
+    int board[Board::kMaxCards];
+    for (int i = 0; i < known; i++) board[i] = query_.board.data()[i];
+    const uint8_t* hero = query_.hero.data();
+
+    card_sampler::Deal deal;
+    for (uint64_t trial = 0; trial < count; trial++) {
+      dealer_->deal(deal);
+      for (int i = known; i < Board::kMaxCards; i++) {
+        board[i] = deal.board[i - known];
+      }
+      const int hero_rank = evaluate_7cards(board[0], board[1], board[2],
+                                            board[3], board[4], hero[0],
+                                            hero[1]);
+      int ties = 1;
+      bool lost = false;
+      for (int p = 0; p < query_.opponents && !lost; p++) {
+        const int rank = evaluate_7cards(board[0], board[1], board[2],
+                                         board[3], board[4], deal.hole[p][0],
+                                         deal.hole[p][1]);
+        lost = rank < hero_rank;
+        ties += rank == hero_rank;
+      }
+      acc.add(lost ? 0.0 : 1.0 / ties);
+    }
+  }
+
+ private:
+  EquityQuery query_;
+  // Shared so the work stays copyable as a std::function; a job calls it
+  // from one thread only.
+  std::shared_ptr<card_sampler::Dealer> dealer_;
+};
+
+}  // namespace
+
+JobWork MakeEquityWork(const EquityQuery& query, uint64_t seed) {
+  return HoldemEquityWork(query, seed);
+}
+
+}  // namespace phevaluator
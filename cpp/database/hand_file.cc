@@ -0,0 +1,420 @@
+#include <phevaluator/hand_file.h>
+#include <phevaluator/phevaluator.h>
+
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// this file reads and writes the binary hand files, see hand_file.h
+
+namespace phevaluator {
+
+namespace {
+
+const char kMagic[4] = {'P', 'H', 'H', 'F'};
+
+// records buffered by the writer and the streaming reader
+const size_t kBufferWords = 8192;
+
+// The format is little-endian, this is a no-op on little-endian hosts.
+inline uint64_t LittleEndian(uint64_t word) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  return __builtin_bswap64(word);
+#else
+  return word;
+#endif
+}
+
+void CheckHeader(const HandFileHeader& header) {
+  if (std::memcmp(header.magic, kMagic, 4) != 0) {
+    throw std::runtime_error("Not a hand file");
+  }
+  if (header.version != kHandFileVersion) {
+    throw std::runtime_error("Unsupported hand file version");
+  }
+  try {
+    MakeHandFileHeader(header.variant, header.encoding, header.board_cards,
+                       header.hole_cards, header.players);
+  } catch (const std::invalid_argument& e) {
+    throw std::runtime_error(e.what());
+  }
+}
+
+// Evaluates the players of one decoded record, returns the ranks written.
+inline int EvaluateRecord(const HandFileHeader& header, const int* cards,
+                          short* ranks) {
+  const int* board = cards;
+  const int* hole = cards + header.board_cards;
+
+  for (int p = 0; p < header.players; p++, hole += header.hole_cards) {
+    int hand[9];
+    int n = 0;
+    for (int i = 0; i < header.board_cards; i++) hand[n++] = board[i];
+    for (int i = 0; i < header.hole_cards; i++) hand[n++] = hole[i];
+
+    switch (n) {
+      case 5:
+        ranks[p] = evaluate_5cards(hand[0], hand[1], hand[2], hand[3], hand[4]);
+        break;
+      case 6:
+        ranks[p] = evaluate_6cards(hand[0], hand[1], hand[2], hand[3], hand[4],
+                                   hand[5]);
+        break;
+      case 7:
+        ranks[p] = evaluate_7cards(hand[0], hand[1], hand[2], hand[3], hand[4],
+                                   hand[5], hand[6]);
+        break;
+      case 8:
+        ranks[p] = evaluate_8cards(hand[0], hand[1], hand[2], hand[3], hand[4],
+                                   hand[5], hand[6], hand[7]);
+        break;
+      default:
+        ranks[p] = evaluate_9cards(hand[0], hand[1], hand[2], hand[3], hand[4],
+                                   hand[5], hand[6], hand[7], hand[8]);
+        break;
+    }
+  }
+  return header.players;
+}
+
+void CheckCardsVariant(const HandFileHeader& header) {
+  const int n = header.board_cards + header.hole_cards;
+  if (header.variant != HandVariant::kCards || n < 5 || n > 9) {
+    throw std::invalid_argument(
+        "EvaluateHandFile takes kCards files of 5 to 9 cards per player");
+  }
+}
+
+}  // namespace
+
+HandFileHeader MakeHandFileHeader(HandVariant variant, HandEncoding encoding,
+                                  int board_cards, int hole_cards,
+                                  int players) {
+  if (board_cards < 0 || hole_cards < 0 || players < 1 ||
+      board_cards + hole_cards * players > 52) {
+    throw std::invalid_argument("Invalid hand file layout");
+  }
+  if (variant == HandVariant::kCards &&
+      (board_cards + hole_cards < 5 || board_cards + hole_cards > 9)) {
+    throw std::invalid_argument("kCards needs 5 to 9 cards per player");
+  }
+  if (variant == HandVariant::kOmaha && (board_cards != 5 || hole_cards != 4)) {
+    throw std::invalid_argument("kOmaha needs 5 board and 4 hole cards");
+  }
+  if (variant != HandVariant::kCards && variant != HandVariant::kOmaha) {
+    throw std::invalid_argument("Invalid hand variant");
+  }
+  if (encoding != HandEncoding::kPacked6 && encoding != HandEncoding::kMask64) {
+    throw std::invalid_argument("Invalid hand encoding");
+  }
+
+  HandFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kMagic, 4);
+  header.version = kHandFileVersion;
+  header.variant = variant;
+  header.encoding = encoding;
+  header.board_cards = board_cards;
+  header.hole_cards = hole_cards;
+  header.players = players;
+  return header;
+}
+
+void EncodeHandRecord(const HandFileHeader& header, const int* cards,
+                      uint64_t* words) {
+  const int n = header.cards();
+  uint64_t seen = 0;
+
+  for (int i = 0; i < n; i++) {
+    if (cards[i] < 0 || cards[i] > 51) {
+      throw std::invalid_argument("Invalid card id");
+    }
+    if (seen & (1ull << cards[i])) {
+      throw std::invalid_argument("Duplicate card");
+    }
+    seen |= 1ull << cards[i];
+  }
+
+  std::memset(words, 0, header.words() * sizeof(uint64_t));
+  if (header.encoding == HandEncoding::kPacked6) {
+    for (int i = 0; i < n; i++) {
+      words[i / 10] |= uint64_t(cards[i]) << (i % 10 * 6);
+    }
+  } else {
+    int w = 0, i = 0;
+    if (header.board_cards > 0) {
+      for (; i < header.board_cards; i++) words[w] |= 1ull << cards[i];
+      w++;
+    }
+    for (int p = 0; p < header.players; p++, w++) {
+      for (int h = 0; h < header.hole_cards; h++, i++) {
+        words[w] |= 1ull << cards[i];
+      }
+    }
+  }
+  for (int w = 0; w < header.words(); w++) words[w] = LittleEndian(words[w]);
+}
+
+void DecodeHandRecord(const HandFileHeader& header, const uint64_t* words,
+                      int* cards) {
+  // Records come from files, so each one is checked against the header
+  // before its ids reach the caller's buffer or an evaluator's tables
+  const uint64_t kDeck = (1ull << 52) - 1;
+  uint64_t seen = 0;
+
+  if (header.encoding == HandEncoding::kPacked6) {
+    const int n = header.cards();
+    for (int i = 0; i < n; i += 10) {
+      uint64_t word = LittleEndian(words[i / 10]);
+      const int m = n - i < 10 ? n - i : 10;
+      for (int j = 0; j < m; j++, word >>= 6) {
+        const int id = word & 0x3f;
+        if (id > 51 || (seen >> id & 1)) {
+          throw std::runtime_error("Corrupt hand record");
+        }
+        seen |= 1ull << id;
+        cards[i + j] = id;
+      }
+    }
+    return;
+  }
+
+  const int masks = header.words();
+  for (int w = 0; w < masks; w++) {
+    uint64_t mask = LittleEndian(words[w]);
+    const int expected = w == 0 && header.board_cards > 0 ? header.board_cards
+                                                          : header.hole_cards;
+    if ((mask & ~kDeck) || (mask & seen) ||
+        __builtin_popcountll(mask) != expected) {
+      throw std::runtime_error("Corrupt hand record");
+    }
+    seen |= mask;
+    while (mask) {
+      *cards++ = __builtin_ctzll(mask);
+      mask &= mask - 1;
+    }
+  }
+}
+
+HandWriter::HandWriter(const std::string& path, const HandFileHeader& header)
+    : file_(std::fopen(path.c_str(), "wb")),
+      owns_file_(true),
+      header_(header) {
+  if (file_ == nullptr) {
+    throw std::runtime_error("Cannot create hand file " + path);
+  }
+  writeHeader();
+}
+
+HandWriter::HandWriter(std::FILE* stream, const HandFileHeader& header)
+    : file_(stream), owns_file_(false), header_(header) {
+  writeHeader();
+}
+
+void HandWriter::writeHeader() {
+  header_.count = kHandFileUnknownCount;
+  buffer_.resize(kBufferWords / header_.words() * header_.words());
+  HandFileHeader out = header_;
+  out.count = LittleEndian(out.count);
+  if (std::fwrite(&out, sizeof(out), 1, file_) != 1) {
+    if (owns_file_) std::fclose(file_);
+    throw std::runtime_error("Cannot write hand file header");
+  }
+}
+
+HandWriter::~HandWriter() { finish(); }
+
+void HandWriter::write(const int* cards) {
+  if (file_ == nullptr) throw std::runtime_error("Hand file is closed");
+  if (used_ == buffer_.size() && !flush()) {
+    throw std::runtime_error("Cannot write hand file");
+  }
+  EncodeHandRecord(header_, cards, buffer_.data() + used_);
+  used_ += header_.words();
+  count_++;
+}
+
+bool HandWriter::flush() {
+  const size_t words = used_;
+  used_ = 0;
+  if (std::fwrite(buffer_.data(), sizeof(uint64_t), words, file_) != words) {
+    failed_ = true;
+  }
+  return !failed_;
+}
+
+void HandWriter::close() {
+  if (!finish()) throw std::runtime_error("Cannot write hand file");
+}
+
+bool HandWriter::finish() {
+  if (file_ == nullptr) return true;
+
+  // Readers trust the count, so it only goes in once every record has
+  // reached the file; otherwise it stays kHandFileUnknownCount.
+  bool written = flush() && std::fflush(file_) == 0;
+  // Only patch the count of a file we created; a stream may be a pipe, or
+  // may not have the header at offset 0, and keeps kHandFileUnknownCount.
+  const long end = written && owns_file_ ? std::ftell(file_) : -1;
+  if (end >= 0 &&
+      std::fseek(file_, offsetof(HandFileHeader, count), SEEK_SET) == 0) {
+    const uint64_t count = LittleEndian(count_);
+    written = std::fwrite(&count, sizeof(count), 1, file_) == 1;
+    std::fseek(file_, end, SEEK_SET);
+  }
+
+  if (owns_file_) {
+    written = std::fclose(file_) == 0 && written;
+  } else {
+    written = std::fflush(file_) == 0 && written;
+  }
+  file_ = nullptr;
+  return written;
+}
+
+HandReader::HandReader(const std::string& path)
+    : file_(std::fopen(path.c_str(), "rb")), owns_file_(true) {
+  if (file_ == nullptr) {
+    throw std::runtime_error("Cannot open hand file " + path);
+  }
+  readHeader();
+}
+
+HandReader::HandReader(std::FILE* stream) : file_(stream), owns_file_(false) {
+  readHeader();
+}
+
+HandReader::~HandReader() {
+  if (owns_file_) std::fclose(file_);
+}
+
+void HandReader::readHeader() {
+  if (std::fread(&header_, sizeof(header_), 1, file_) != 1) {
+    if (owns_file_) std::fclose(file_);
+    throw std::runtime_error("Truncated hand file header");
+  }
+  header_.count = LittleEndian(header_.count);
+  try {
+    CheckHeader(header_);
+  } catch (...) {
+    if (owns_file_) std::fclose(file_);
+    throw;
+  }
+  remaining_ = header_.count;
+  buffer_.resize(kBufferWords / header_.words() * header_.words());
+}
+
+bool HandReader::next(int* cards) {
+  const size_t words = header_.words();
+
+  if (remaining_ == 0) return false;
+  if (end_ - begin_ < words) {
+    // keep a partial record from the last read in front of the new data
+    const size_t left = end_ - begin_;
+    std::memmove(buffer_.data(), buffer_.data() + begin_,
+                 left * sizeof(uint64_t));
+    begin_ = 0;
+    end_ = left + std::fread(buffer_.data() + left, sizeof(uint64_t),
+                             buffer_.size() - left, file_);
+    if (end_ < words) return false;
+  }
+
+  DecodeHandRecord(header_, buffer_.data() + begin_, cards);
+  begin_ += words;
+  if (remaining_ != kHandFileUnknownCount) remaining_--;
+  return true;
+}
+
+MappedHandFile::MappedHandFile(const std::string& path) {
+#ifdef _WIN32
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in) throw std::runtime_error("Cannot open hand file " + path);
+  bytes_ = static_cast<size_t>(in.tellg());
+  data_ = ::operator new(bytes_ > 0 ? bytes_ : 1);
+  in.seekg(0);
+  in.read(static_cast<char*>(data_), bytes_);
+#else
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("Cannot open hand file " + path);
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Cannot stat hand file " + path);
+  }
+  bytes_ = static_cast<size_t>(st.st_size);
+  if (bytes_ >= sizeof(HandFileHeader)) {
+    data_ = ::mmap(nullptr, bytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data_ == MAP_FAILED) data_ = nullptr;
+  }
+  ::close(fd);
+#endif
+
+  if (data_ == nullptr || bytes_ < sizeof(HandFileHeader)) {
+    unmap();
+    throw std::runtime_error("Cannot map hand file " + path);
+  }
+  std::memcpy(&header_, data_, sizeof(header_));
+  header_.count = LittleEndian(header_.count);
+  try {
+    CheckHeader(header_);
+  } catch (...) {
+    unmap();
+    throw;
+  }
+
+#ifndef _WIN32
+  ::madvise(data_, bytes_, MADV_SEQUENTIAL);
+#endif
+
+  records_ = reinterpret_cast<const uint64_t*>(
+      static_cast<const char*>(data_) + sizeof(HandFileHeader));
+  const uint64_t stored =
+      (bytes_ - sizeof(HandFileHeader)) / (header_.words() * sizeof(uint64_t));
+  count_ = header_.count < stored ? header_.count : stored;
+}
+
+MappedHandFile::~MappedHandFile() { unmap(); }
+
+void MappedHandFile::unmap() {
+  if (data_ == nullptr) return;
+#ifdef _WIN32
+  ::operator delete(data_);
+#else
+  ::munmap(data_, bytes_);
+#endif
+  data_ = nullptr;
+}
+
+size_t EvaluateHandFile(const MappedHandFile& file, short* ranks) {
+  const HandFileHeader& header = file.header();
+  CheckCardsVariant(header);
+
+  file.forEach([&](const int* cards) {
+    ranks += EvaluateRecord(header, cards, ranks);
+  });
+  return file.size() * header.players;
+}
+
+size_t EvaluateHands(HandReader& reader, short* ranks, size_t max_records) {
+  const HandFileHeader& header = reader.header();
+  CheckCardsVariant(header);
+
+  int cards[52];
+  size_t records = 0;
+  while (records < max_records && reader.next(cards)) {
+    ranks += EvaluateRecord(header, cards, ranks);
+    records++;
+  }
+  return records;
+}
+
+}  // namespace phevaluator
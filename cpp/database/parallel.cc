@@ -0,0 +1,216 @@
+#include <phevaluator/numa.h>
+#include <phevaluator/parallel.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace phevaluator {
+
+namespace {
+
+// Rounds before a finished worker goes to sleep; a call arriving in this
+// window doesn't pay for a wake-up.
+const int kSpinRounds = 1 << 10;
+
+void PinCurrentThread(int worker) {
+#ifdef __linux__
+  const unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(worker % cpus, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)worker;
+#endif
+  if (pheval_numa_enabled()) pheval_numa_bind_thread(-1);
+}
+
+}  // namespace
+
+ThreadPool::ThreadPool(int threads, bool pin) : pin_(pin) {
+  if (threads <= 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (int i = 0; i < threads; i++) runs_.push_back(std::make_unique<Run>());
+  for (int i = 1; i < threads; i++) {
+    workers_.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+}
+
+void ThreadPool::parallelFor(
+    size_t chunks, const std::function<void(size_t, int)>& body) {
+  if (chunks == 0) return;
+  if (chunks == 1) {
+    body(0, 0);
+    return;
+  }
+
+  std::lock_guard<std::mutex> call(call_mutex_);
+  const size_t threads = runs_.size();
+  for (size_t i = 0; i < threads; i++) {
+    std::lock_guard<std::mutex> lock(runs_[i]->mutex);
+    runs_[i]->begin = chunks * i / threads;
+    runs_[i]->end = chunks * (i + 1) / threads;
+  }
+  remaining_.store(chunks, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    body_ = &body;
+    error_ = nullptr;
+    finished_ = false;
+    generation_.fetch_add(1, std::memory_order_release);
+  }
+  wake_.notify_all();
+
+  runChunks(0);
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] {
+      return remaining_.load(std::memory_order_acquire) == 0 && active_ == 0;
+    });
+    // Workers that wake up from here on skip this call
+    finished_ = true;
+    body_ = nullptr;
+    error = error_;
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+void ThreadPool::workerLoop(int worker) {
+  if (pin_) PinCurrentThread(worker);
+  uint64_t seen = 0;
+  while (true) {
+    for (int i = 0; i < kSpinRounds; i++) {
+      if (generation_.load(std::memory_order_acquire) != seen) break;
+      std::this_thread::yield();
+    }
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [this, seen] {
+        return stop_ ||
+               (!finished_ &&
+                generation_.load(std::memory_order_relaxed) != seen);
+      });
+      if (stop_) return;
+      seen = generation_.load(std::memory_order_relaxed);
+      active_++;
+    }
+    runChunks(worker);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      active_--;
+    }
+    done_.notify_all();
+  }
+}
+
+void ThreadPool::runChunks(int worker) {
+  // body_ stays set while this worker is counted in active_ (or, for the
+  // caller, until it has waited for everyone).
+  const std::function<void(size_t, int)>* body;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    body = body_;
+  }
+  size_t chunk;
+  while (takeOwn(worker, chunk) || steal(worker, chunk)) {
+    try {
+      (*body)(chunk, worker);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) error_ = std::current_exception();
+    }
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      done_.notify_all();
+    }
+  }
+}
+
+bool ThreadPool::takeOwn(int worker, size_t& chunk) {
+  Run& run = *runs_[worker];
+  std::lock_guard<std::mutex> lock(run.mutex);
+  if (run.begin == run.end) return false;
+  chunk = run.begin++;
+  return true;
+}
+
+bool ThreadPool::steal(int worker, size_t& chunk) {
+  const int threads = static_cast<int>(runs_.size());
+  for (int i = 1; i < threads; i++) {
+    Run& victim = *runs_[(worker + i) % threads];
+    size_t begin, end;
+    {
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      const size_t left = victim.end - victim.begin;
+      if (left == 0) continue;
+      end = victim.end;
+      begin = end - (left + 1) / 2;
+      victim.end = begin;
+    }
+    // Run the first stolen chunk now and keep the rest as our own run
+    chunk = begin;
+    Run& own = *runs_[worker];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    own.begin = begin + 1;
+    own.end = end;
+    return true;
+  }
+  return false;
+}
+
+size_t ParallelEvaluate(ThreadPool& pool, const pheval_engine& engine,
+                        const uint8_t* cards, size_t n, size_t stride,
+                        int16_t* out, size_t chunk_hands) {
+  if (n == 0) return 0;
+  if (stride == 0) stride = engine.cards;
+  if (chunk_hands == 0) chunk_hands = kDefaultChunkHands;
+  // A whole number of 64-byte output lines per chunk
+  chunk_hands = (chunk_hands + 31) / 32 * 32;
+
+  // The first chunk is shortened to end on a line boundary of out
+  const size_t misalign = reinterpret_cast<uintptr_t>(out) % 64 / 2;
+  const size_t head = std::min(n, chunk_hands - misalign);
+  const size_t chunks = 1 + (n - head + chunk_hands - 1) / chunk_hands;
+
+  struct alignas(64) Count {
+    size_t invalid = 0;
+  };
+  std::vector<Count> counts(pool.threads());
+
+  pool.parallelFor(chunks, [&](size_t chunk, int worker) {
+    const size_t begin = chunk == 0 ? 0 : head + (chunk - 1) * chunk_hands;
+    const size_t end = chunk == 0 ? head : std::min(n, begin + chunk_hands);
+    counts[worker].invalid +=
+        engine.evaluate(cards + begin * stride, end - begin, stride,
+                        out + begin);
+  });
+
+  size_t invalid = 0;
+  for (const Count& count : counts) invalid += count.invalid;
+  return invalid;
+}
+
+}  // namespace phevaluator
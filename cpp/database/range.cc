@@ -0,0 +1,271 @@
+#include <phevaluator/card.h>
+#include <phevaluator/range.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace phevaluator {
+
+const std::array<std::array<uint8_t, 2>, HoldemRange::kHands>
+    HoldemRange::kHandCards = [] {
+      std::array<std::array<uint8_t, 2>, kHands> cards{};
+      for (int b = 1; b < 52; b++) {
+        for (int a = 0; a < b; a++) {
+          cards[Index(a, b)] = {static_cast<uint8_t>(a),
+                                static_cast<uint8_t>(b)};
+        }
+      }
+      return cards;
+    }();
+
+namespace {
+
+using Words = std::array<uint64_t, HoldemRange::kWords>;
+
+// The hands that use each card
+const std::array<Words, 52> kCardMasks = [] {
+  std::array<Words, 52> masks{};
+  for (int a = 0; a < 52; a++) {
+    for (int b = 0; b < 52; b++) {
+      if (a == b) continue;
+      const int index = HoldemRange::Index(a, b);
+      masks[a][index >> 6] |= uint64_t(1) << (index & 63);
+    }
+  }
+  return masks;
+}();
+
+enum class Suits { kAny, kSuited, kOffsuit };
+
+// Two ranks and which suits, like "AKs"; high >= low
+struct HandClass {
+  int high;
+  int low;
+  Suits suits;
+};
+
+bool IsSeparator(char c) {
+  return c == ',' || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+int RankOf(char c) { return kRankIndex[static_cast<unsigned char>(c)]; }
+
+// Reads a class at the start of text and moves past it
+bool ReadClass(std::string_view& text, HandClass& hand) {
+  if (text.size() < 2) return false;
+  const int first = RankOf(text[0]), second = RankOf(text[1]);
+  if (first < 0 || second < 0) return false;
+  hand.high = std::max(first, second);
+  hand.low = std::min(first, second);
+  hand.suits = Suits::kAny;
+  text.remove_prefix(2);
+  if (!text.empty() && (text[0] == 's' || text[0] == 'o')) {
+    if (hand.high == hand.low) return false;
+    hand.suits = text[0] == 's' ? Suits::kSuited : Suits::kOffsuit;
+    text.remove_prefix(1);
+  }
+  return true;
+}
+
+// A non-negative decimal like "0.5", "2" or ".25"
+bool ReadWeight(std::string_view text, double& weight) {
+  weight = 0;
+  size_t i = 0;
+  bool digits = false;
+  for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++) {
+    weight = weight * 10 + (text[i] - '0');
+    digits = true;
+  }
+  if (i < text.size() && text[i] == '.') {
+    double scale = 0.1;
+    for (i++; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++) {
+      weight += (text[i] - '0') * scale;
+      scale /= 10;
+      digits = true;
+    }
+  }
+  return digits && i == text.size();
+}
+
+void AddClass(HoldemRange& range, int high, int low, Suits suits,
+              double weight) {
+  for (int s = 0; s < 4; s++) {
+    for (int t = 0; t < 4; t++) {
+      if (high == low ? s >= t
+                      : (suits == Suits::kSuited && s != t) ||
+                            (suits == Suits::kOffsuit && s == t)) {
+        continue;
+      }
+      range.add(high * 4 + s, low * 4 + t, weight);
+    }
+  }
+}
+
+// Adds the hands of one item, its weight already split off; false if it
+// can't be read
+bool AddItem(HoldemRange& range, std::string_view item, double weight) {
+  if (item.size() == 4) {
+    const int a = CardIdOf(item[0], item[1]), b = CardIdOf(item[2], item[3]);
+    if (a >= 0 && b >= 0) {
+      if (a == b) return false;
+      range.add(a, b, weight);
+      return true;
+    }
+  }
+
+  HandClass from;
+  if (!ReadClass(item, from)) return false;
+  if (item.empty()) {
+    AddClass(range, from.high, from.low, from.suits, weight);
+    return true;
+  }
+
+  HandClass to = from;
+  if (item == "+") {
+    // Pairs up to aces, or kickers up to one below the top card
+    to.high = to.low = 12;
+    if (from.high != from.low) to = {from.high, from.high - 1, from.suits};
+  } else if (item[0] == '-') {
+    item.remove_prefix(1);
+    if (!ReadClass(item, to) || !item.empty() || to.suits != from.suits ||
+        (from.high == from.low) != (to.high == to.low) ||
+        (from.high != from.low && to.high != from.high)) {
+      return false;
+    }
+  } else {
+    return false;
+  }
+
+  if (from.high == from.low) {
+    const auto span = std::minmax(from.low, to.low);
+    for (int rank = span.first; rank <= span.second; rank++) {
+      AddClass(range, rank, rank, Suits::kAny, weight);
+    }
+  } else {
+    const auto span = std::minmax(from.low, to.low);
+    for (int kicker = span.first; kicker <= span.second; kicker++) {
+      AddClass(range, from.high, kicker, from.suits, weight);
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+HoldemRange HoldemRange::Parse(std::string_view text) {
+  HoldemRange range;
+  size_t i = 0;
+  while (i < text.size()) {
+    if (IsSeparator(text[i])) {
+      i++;
+      continue;
+    }
+    size_t end = i;
+    while (end < text.size() && !IsSeparator(text[end])) end++;
+    const std::string_view item = text.substr(i, end - i);
+    i = end;
+
+    std::string_view hands = item;
+    double weight = 1.0;
+    const size_t colon = item.find(':');
+    if (colon != std::string_view::npos) {
+      hands = item.substr(0, colon);
+      if (!ReadWeight(item.substr(colon + 1), weight) || !(weight > 0)) {
+        throw std::invalid_argument("Invalid range item: " +
+                                    std::string(item));
+      }
+    }
+    if (!AddItem(range, hands, weight)) {
+      throw std::invalid_argument("Invalid range item: " + std::string(item));
+    }
+  }
+  return range;
+}
+
+HoldemRange HoldemRange::All() {
+  HoldemRange range;
+  for (int w = 0; w < kWords; w++) range.bits_[w] = ~uint64_t(0);
+  range.bits_[kWords - 1] = (uint64_t(1) << (kHands % 64)) - 1;
+  return range;
+}
+
+void HoldemRange::add(int a, int b, double weight) {
+  if (a < 0 || a >= 52 || b < 0 || b >= 52 || a == b) {
+    throw std::invalid_argument("Invalid hand");
+  }
+  if (!(weight > 0)) {
+    throw std::invalid_argument("Range weights must be positive");
+  }
+  const int index = Index(a, b);
+  bits_[index >> 6] |= uint64_t(1) << (index & 63);
+  if (weight != 1.0 && weights_.empty()) weights_.assign(kHands, 1.0);
+  if (!weights_.empty()) weights_[index] = weight;
+}
+
+int HoldemRange::size() const {
+  int count = 0;
+  for (uint64_t word : bits_) count += __builtin_popcountll(word);
+  return count;
+}
+
+double HoldemRange::totalWeight() const {
+  if (weights_.empty()) return size();
+  double total = 0;
+  forEach([&](int, int, int, double weight) { total += weight; });
+  return total;
+}
+
+void HoldemRange::removeCards(uint64_t dead_cards) {
+  for (dead_cards &= (uint64_t(1) << 52) - 1; dead_cards;
+       dead_cards &= dead_cards - 1) {
+    const Words& mask = kCardMasks[__builtin_ctzll(dead_cards)];
+    for (int w = 0; w < kWords; w++) bits_[w] &= ~mask[w];
+  }
+}
+
+HoldemRange& HoldemRange::operator|=(const HoldemRange& other) {
+  if (!weights_.empty() || !other.weights_.empty()) {
+    std::vector<double> weights(kHands);
+    for (int i = 0; i < kHands; i++) {
+      weights[i] = std::max(weight(i), other.weight(i));
+    }
+    weights_ = std::move(weights);
+  }
+  for (int w = 0; w < kWords; w++) bits_[w] |= other.bits_[w];
+  return *this;
+}
+
+HoldemRange& HoldemRange::operator&=(const HoldemRange& other) {
+  if (!weights_.empty() || !other.weights_.empty()) {
+    std::vector<double> weights(kHands);
+    for (int i = 0; i < kHands; i++) {
+      weights[i] = std::min(weight(i), other.weight(i));
+    }
+    weights_ = std::move(weights);
+  }
+  for (int w = 0; w < kWords; w++) bits_[w] &= other.bits_[w];
+  return *this;
+}
+
+bool HoldemRange::operator==(const HoldemRange& other) const {
+  if (!std::equal(bits_, bits_ + kWords, other.bits_)) return false;
+  for (int i = 0; i < kHands; i++) {
+    if (weight(i) != other.weight(i)) return false;
+  }
+  return true;
+}
+
+card_sampler::HandRange HoldemRange::toHandRange() const {
+  card_sampler::HandRange range(2);
+  forEach([&](int, int a, int b, double weight) {
+    const int cards[] = {a, b};
+    range.add(cards, weight);
+  });
+  return range;
+}
+
+}  // namespace phevaluator
@@ -0,0 +1,148 @@
+#include <phevaluator/showdown.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+namespace phevaluator {
+
+namespace {
+
+// Ranks run from 1, the royal flush, to 7462; keys are ranks turned round
+// so that sorting keys up lists the weakest hands first, in 13 bits
+const int kKeyLimit = 8191;
+const int kLowBits = 7;
+const int kLowBuckets = 1 << kLowBits;
+const int kHighBuckets = (kKeyLimit >> kLowBits) + 1;
+
+}  // namespace
+
+ShowdownTable::ShowdownTable() {
+  std::fill(positions_, positions_ + HoldemRange::kHands, int16_t(-1));
+}
+
+ShowdownTable::ShowdownTable(const Board& board, const HoldemRange& hands) {
+  if (board.size() != Board::kMaxCards) {
+    throw std::invalid_argument("A showdown needs a 5-card board");
+  }
+  setBoard(board.data(), hands);
+}
+
+void ShowdownTable::setBoard(const uint8_t board[5],
+                             const HoldemRange& hands) {
+  evaluator_.setBoard(board);
+  uint64_t board_mask = 0;
+  for (int i = 0; i < 5; i++) board_mask |= uint64_t(1) << board[i];
+
+  // Evaluated in index order into `keyed`, then sorted into hands_ by the
+  // low bits of the key and back by the high bits, each pass stable
+  uint16_t keyed[HoldemRange::kHands];
+  uint16_t keys[HoldemRange::kHands];
+  uint16_t sorted_keys[HoldemRange::kHands];
+  int low_counts[kLowBuckets + 1] = {};
+  int high_counts[kHighBuckets + 1] = {};
+  std::fill(blockers_, blockers_ + 52, 0);
+  std::fill(positions_, positions_ + HoldemRange::kHands, int16_t(-1));
+
+  size_ = 0;
+  hands.forEach([&](int index, int a, int b, double) {
+    if ((board_mask >> a | board_mask >> b) & 1) return;
+    const uint16_t key =
+        static_cast<uint16_t>(kKeyLimit - evaluator_.evaluate(a, b));
+    keyed[size_] = static_cast<uint16_t>(index);
+    keys[size_] = key;
+    low_counts[(key & (kLowBuckets - 1)) + 1]++;
+    high_counts[(key >> kLowBits) + 1]++;
+    blockers_[a]++;
+    blockers_[b]++;
+    size_++;
+  });
+
+  for (int i = 0; i < kLowBuckets; i++) low_counts[i + 1] += low_counts[i];
+  for (int i = 0; i < kHighBuckets; i++) high_counts[i + 1] += high_counts[i];
+  uint16_t by_low[HoldemRange::kHands];
+  for (int i = 0; i < size_; i++) {
+    const int to = low_counts[keys[i] & (kLowBuckets - 1)]++;
+    by_low[to] = keyed[i];
+    sorted_keys[to] = keys[i];
+  }
+  for (int i = 0; i < size_; i++) {
+    const int to = high_counts[sorted_keys[i] >> kLowBits]++;
+    hands_[to] = by_low[i];
+    ranks_[to] = static_cast<uint16_t>(kKeyLimit - sorted_keys[i]);
+  }
+
+  groups_ = 0;
+  for (int i = 0; i < size_; i++) {
+    positions_[hands_[i]] = static_cast<int16_t>(i);
+    if (i == 0 || ranks_[i] != ranks_[i - 1]) group_begins_[groups_++] = i;
+  }
+  group_begins_[groups_] = static_cast<uint16_t>(size_);
+}
+
+template <class Visit>
+void ShowdownTable::sweep(const double* weights, Visit&& visit) const {
+  // The listed hands' weights in total and per card, for all of them, those
+  // below the current group and those in it. A hand's own cards take out
+  // every hand that shares one, and the hand itself twice.
+  double all = 0, below = 0, group = 0;
+  double all_cards[52] = {}, below_cards[52] = {}, group_cards[52] = {};
+  for (int i = 0; i < size_; i++) {
+    const std::array<uint8_t, 2>& cards = HoldemRange::kHandCards[hands_[i]];
+    const double w = weights[hands_[i]];
+    all += w;
+    all_cards[cards[0]] += w;
+    all_cards[cards[1]] += w;
+  }
+
+  for (int g = 0; g < groups_; g++) {
+    const int begin = group_begins_[g], end = group_begins_[g + 1];
+    for (int i = begin; i < end; i++) {
+      const std::array<uint8_t, 2>& cards = HoldemRange::kHandCards[hands_[i]];
+      const double w = weights[hands_[i]];
+      group += w;
+      group_cards[cards[0]] += w;
+      group_cards[cards[1]] += w;
+    }
+    for (int i = begin; i < end; i++) {
+      const std::array<uint8_t, 2>& cards = HoldemRange::kHandCards[hands_[i]];
+      const int a = cards[0], b = cards[1];
+      const double self = weights[hands_[i]];
+      visit(i, below - below_cards[a] - below_cards[b],
+            group - group_cards[a] - group_cards[b] + self,
+            all - all_cards[a] - all_cards[b] + self);
+    }
+    for (int i = begin; i < end; i++) {
+      const std::array<uint8_t, 2>& cards = HoldemRange::kHandCards[hands_[i]];
+      const double w = weights[hands_[i]];
+      below += w;
+      below_cards[cards[0]] += w;
+      below_cards[cards[1]] += w;
+      group_cards[cards[0]] = group_cards[cards[1]] = 0;
+    }
+    group = 0;
+  }
+}
+
+void ShowdownTable::showdown(const double* weights, double* beaten,
+                             double* tied, double* faced) const {
+  std::fill(beaten, beaten + HoldemRange::kHands, 0.0);
+  std::fill(tied, tied + HoldemRange::kHands, 0.0);
+  std::fill(faced, faced + HoldemRange::kHands, 0.0);
+  sweep(weights, [&](int position, double b, double t, double f) {
+    const int hand = hands_[position];
+    beaten[hand] = b;
+    tied[hand] = t;
+    faced[hand] = f;
+  });
+}
+
+void ShowdownTable::payoffs(const double* weights, double* payoff) const {
+  std::fill(payoff, payoff + HoldemRange::kHands, 0.0);
+  sweep(weights, [&](int position, double b, double t, double f) {
+    payoff[hands_[position]] = b - (f - b - t);
+  });
+}
+
+}  // namespace phevaluator
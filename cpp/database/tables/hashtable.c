@@ -17,687 +17,5 @@
  #include "tables.h"
 
  const short flush[8192] = {
-     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    9,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    1599,
-     0,    0,    0,    0,    0,    0,    0,    1598, 0,    0,    0,    1597,
-     0,    1596, 8,    8,    0,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    1595, 0,    0,    0,    0,
-     0,    0,    0,    1594, 0,    0,    0,    1593, 0,    1592, 1591, 9,
-     0,    0,    0,    0,    0,    0,    0,    1590, 0,    0,    0,    1589,
-     0,    1588, 1587, 1587, 0,    0,    0,    1586, 0,    1585, 1584, 1584,
-     0,    1583, 1582, 1582, 7,    7,    7,    7,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    1581,
-     0,    0,    0,    0,    0,    0,    0,    1580, 0,    0,    0,    1579,
-     0,    1578, 1577, 9,    0,    0,    0,    0,    0,    0,    0,    1576,
-     0,    0,    0,    1575, 0,    1574, 1573, 1573, 0,    0,    0,    1572,
-     0,    1571, 1570, 1570, 0,    1569, 1568, 1568, 1567, 1567, 8,    8,
-     0,    0,    0,    0,    0,    0,    0,    1566, 0,    0,    0,    1565,
-     0,    1564, 1563, 1563, 0,    0,    0,    1562, 0,    1561, 1560, 1560,
-     0,    1559, 1558, 1558, 1557, 1557, 1557, 9,    0,    0,    0,    1556,
-     0,    1555, 1554, 1554, 0,    1553, 1552, 1552, 1551, 1551, 1551, 1551,
-     0,    1550, 1549, 1549, 1548, 1548, 1548, 1548, 6,    6,    6,    6,
-     6,    6,    6,    6,    0,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    1547, 0,    0,    0,    0,
-     0,    0,    0,    1546, 0,    0,    0,    1545, 0,    1544, 1543, 9,
-     0,    0,    0,    0,    0,    0,    0,    1542, 0,    0,    0,    1541,
-     0,    1540, 1539, 1539, 0,    0,    0,    1538, 0,    1537, 1536, 1536,
-     0,    1535, 1534, 1534, 1533, 1533, 8,    8,    0,    0,    0,    0,
-     0,    0,    0,    1532, 0,    0,    0,    1531, 0,    1530, 1529, 1529,
-     0,    0,    0,    1528, 0,    1527, 1526, 1526, 0,    1525, 1524, 1524,
-     1523, 1523, 1523, 9,    0,    0,    0,    1522, 0,    1521, 1520, 1520,
-     0,    1519, 1518, 1518, 1517, 1517, 1517, 1517, 0,    1516, 1515, 1515,
-     1514, 1514, 1514, 1514, 1513, 1513, 1513, 1513, 7,    7,    7,    7,
-     0,    0,    0,    0,    0,    0,    0,    1512, 0,    0,    0,    1511,
-     0,    1510, 1509, 1509, 0,    0,    0,    1508, 0,    1507, 1506, 1506,
-     0,    1505, 1504, 1504, 1503, 1503, 1503, 9,    0,    0,    0,    1502,
-     0,    1501, 1500, 1500, 0,    1499, 1498, 1498, 1497, 1497, 1497, 1497,
-     0,    1496, 1495, 1495, 1494, 1494, 1494, 1494, 1493, 1493, 1493, 1493,
-     1493, 1493, 8,    8,    0,    0,    0,    1492, 0,    1491, 1490, 1490,
-     0,    1489, 1488, 1488, 1487, 1487, 1487, 1487, 0,    1486, 1485, 1485,
-     1484, 1484, 1484, 1484, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 9,
-     0,    1482, 1481, 1481, 1480, 1480, 1480, 1480, 1479, 1479, 1479, 1479,
-     1479, 1479, 1479, 1479, 5,    5,    5,    5,    5,    5,    5,    5,
-     5,    5,    5,    5,    5,    5,    5,    5,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    1478,
-     0,    0,    0,    0,    0,    0,    0,    1477, 0,    0,    0,    1476,
-     0,    1475, 1474, 9,    0,    0,    0,    0,    0,    0,    0,    1473,
-     0,    0,    0,    1472, 0,    1471, 1470, 1470, 0,    0,    0,    1469,
-     0,    1468, 1467, 1467, 0,    1466, 1465, 1465, 1464, 1464, 8,    8,
-     0,    0,    0,    0,    0,    0,    0,    1463, 0,    0,    0,    1462,
-     0,    1461, 1460, 1460, 0,    0,    0,    1459, 0,    1458, 1457, 1457,
-     0,    1456, 1455, 1455, 1454, 1454, 1454, 9,    0,    0,    0,    1453,
-     0,    1452, 1451, 1451, 0,    1450, 1449, 1449, 1448, 1448, 1448, 1448,
-     0,    1447, 1446, 1446, 1445, 1445, 1445, 1445, 1444, 1444, 1444, 1444,
-     7,    7,    7,    7,    0,    0,    0,    0,    0,    0,    0,    1443,
-     0,    0,    0,    1442, 0,    1441, 1440, 1440, 0,    0,    0,    1439,
-     0,    1438, 1437, 1437, 0,    1436, 1435, 1435, 1434, 1434, 1434, 9,
-     0,    0,    0,    1433, 0,    1432, 1431, 1431, 0,    1430, 1429, 1429,
-     1428, 1428, 1428, 1428, 0,    1427, 1426, 1426, 1425, 1425, 1425, 1425,
-     1424, 1424, 1424, 1424, 1424, 1424, 8,    8,    0,    0,    0,    1423,
-     0,    1422, 1421, 1421, 0,    1420, 1419, 1419, 1418, 1418, 1418, 1418,
-     0,    1417, 1416, 1416, 1415, 1415, 1415, 1415, 1414, 1414, 1414, 1414,
-     1414, 1414, 1414, 9,    0,    1413, 1412, 1412, 1411, 1411, 1411, 1411,
-     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1409, 1409, 1409, 1409,
-     1409, 1409, 1409, 1409, 6,    6,    6,    6,    6,    6,    6,    6,
-     0,    0,    0,    0,    0,    0,    0,    1408, 0,    0,    0,    1407,
-     0,    1406, 1405, 1405, 0,    0,    0,    1404, 0,    1403, 1402, 1402,
-     0,    1401, 1400, 1400, 1399, 1399, 1399, 9,    0,    0,    0,    1398,
-     0,    1397, 1396, 1396, 0,    1395, 1394, 1394, 1393, 1393, 1393, 1393,
-     0,    1392, 1391, 1391, 1390, 1390, 1390, 1390, 1389, 1389, 1389, 1389,
-     1389, 1389, 8,    8,    0,    0,    0,    1388, 0,    1387, 1386, 1386,
-     0,    1385, 1384, 1384, 1383, 1383, 1383, 1383, 0,    1382, 1381, 1381,
-     1380, 1380, 1380, 1380, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 9,
-     0,    1378, 1377, 1377, 1376, 1376, 1376, 1376, 1375, 1375, 1375, 1375,
-     1375, 1375, 1375, 1375, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
-     1374, 1374, 1374, 1374, 7,    7,    7,    7,    0,    0,    0,    1373,
-     0,    1372, 1371, 1371, 0,    1370, 1369, 1369, 1368, 1368, 1368, 1368,
-     0,    1367, 1366, 1366, 1365, 1365, 1365, 1365, 1364, 1364, 1364, 1364,
-     1364, 1364, 1364, 9,    0,    1363, 1362, 1362, 1361, 1361, 1361, 1361,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1359, 1359, 1359, 1359,
-     1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 8,    8,
-     0,    1358, 1357, 1357, 1356, 1356, 1356, 1356, 1355, 1355, 1355, 1355,
-     1355, 1355, 1355, 1355, 1354, 1354, 1354, 1354, 1354, 1354, 1354, 1354,
-     1354, 1354, 1354, 1354, 1354, 1354, 1354, 9,    4,    4,    4,    4,
-     4,    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-     4,    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-     4,    4,    4,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    1353, 0,    0,    0,    0,
-     0,    0,    0,    1352, 0,    0,    0,    1351, 0,    1350, 1349, 9,
-     0,    0,    0,    0,    0,    0,    0,    1348, 0,    0,    0,    1347,
-     0,    1346, 1345, 1345, 0,    0,    0,    1344, 0,    1343, 1342, 1342,
-     0,    1341, 1340, 1340, 1339, 1339, 8,    8,    0,    0,    0,    0,
-     0,    0,    0,    1338, 0,    0,    0,    1337, 0,    1336, 1335, 1335,
-     0,    0,    0,    1334, 0,    1333, 1332, 1332, 0,    1331, 1330, 1330,
-     1329, 1329, 1329, 9,    0,    0,    0,    1328, 0,    1327, 1326, 1326,
-     0,    1325, 1324, 1324, 1323, 1323, 1323, 1323, 0,    1322, 1321, 1321,
-     1320, 1320, 1320, 1320, 1319, 1319, 1319, 1319, 7,    7,    7,    7,
-     0,    0,    0,    0,    0,    0,    0,    1318, 0,    0,    0,    1317,
-     0,    1316, 1315, 1315, 0,    0,    0,    1314, 0,    1313, 1312, 1312,
-     0,    1311, 1310, 1310, 1309, 1309, 1309, 9,    0,    0,    0,    1308,
-     0,    1307, 1306, 1306, 0,    1305, 1304, 1304, 1303, 1303, 1303, 1303,
-     0,    1302, 1301, 1301, 1300, 1300, 1300, 1300, 1299, 1299, 1299, 1299,
-     1299, 1299, 8,    8,    0,    0,    0,    1298, 0,    1297, 1296, 1296,
-     0,    1295, 1294, 1294, 1293, 1293, 1293, 1293, 0,    1292, 1291, 1291,
-     1290, 1290, 1290, 1290, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 9,
-     0,    1288, 1287, 1287, 1286, 1286, 1286, 1286, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
-     6,    6,    6,    6,    6,    6,    6,    6,    0,    0,    0,    0,
-     0,    0,    0,    1283, 0,    0,    0,    1282, 0,    1281, 1280, 1280,
-     0,    0,    0,    1279, 0,    1278, 1277, 1277, 0,    1276, 1275, 1275,
-     1274, 1274, 1274, 9,    0,    0,    0,    1273, 0,    1272, 1271, 1271,
-     0,    1270, 1269, 1269, 1268, 1268, 1268, 1268, 0,    1267, 1266, 1266,
-     1265, 1265, 1265, 1265, 1264, 1264, 1264, 1264, 1264, 1264, 8,    8,
-     0,    0,    0,    1263, 0,    1262, 1261, 1261, 0,    1260, 1259, 1259,
-     1258, 1258, 1258, 1258, 0,    1257, 1256, 1256, 1255, 1255, 1255, 1255,
-     1254, 1254, 1254, 1254, 1254, 1254, 1254, 9,    0,    1253, 1252, 1252,
-     1251, 1251, 1251, 1251, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249,
-     7,    7,    7,    7,    0,    0,    0,    1248, 0,    1247, 1246, 1246,
-     0,    1245, 1244, 1244, 1243, 1243, 1243, 1243, 0,    1242, 1241, 1241,
-     1240, 1240, 1240, 1240, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 9,
-     0,    1238, 1237, 1237, 1236, 1236, 1236, 1236, 1235, 1235, 1235, 1235,
-     1235, 1235, 1235, 1235, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
-     1234, 1234, 1234, 1234, 1234, 1234, 8,    8,    0,    1233, 1232, 1232,
-     1231, 1231, 1231, 1231, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
-     1229, 1229, 1229, 9,    1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
-     1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 5,    5,    5,    5,
-     5,    5,    5,    5,    5,    5,    5,    5,    5,    5,    5,    0,
-     0,    0,    0,    0,    0,    0,    0,    1227, 0,    0,    0,    1226,
-     0,    1225, 1224, 1224, 0,    0,    0,    1223, 0,    1222, 1221, 1221,
-     0,    1220, 1219, 1219, 1218, 1218, 1218, 9,    0,    0,    0,    1217,
-     0,    1216, 1215, 1215, 0,    1214, 1213, 1213, 1212, 1212, 1212, 1212,
-     0,    1211, 1210, 1210, 1209, 1209, 1209, 1209, 1208, 1208, 1208, 1208,
-     1208, 1208, 8,    8,    0,    0,    0,    1207, 0,    1206, 1205, 1205,
-     0,    1204, 1203, 1203, 1202, 1202, 1202, 1202, 0,    1201, 1200, 1200,
-     1199, 1199, 1199, 1199, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 9,
-     0,    1197, 1196, 1196, 1195, 1195, 1195, 1195, 1194, 1194, 1194, 1194,
-     1194, 1194, 1194, 1194, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193,
-     1193, 1193, 1193, 1193, 7,    7,    7,    7,    0,    0,    0,    1192,
-     0,    1191, 1190, 1190, 0,    1189, 1188, 1188, 1187, 1187, 1187, 1187,
-     0,    1186, 1185, 1185, 1184, 1184, 1184, 1184, 1183, 1183, 1183, 1183,
-     1183, 1183, 1183, 9,    0,    1182, 1181, 1181, 1180, 1180, 1180, 1180,
-     1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1178, 1178, 1178, 1178,
-     1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 8,    8,
-     0,    1177, 1176, 1176, 1175, 1175, 1175, 1175, 1174, 1174, 1174, 1174,
-     1174, 1174, 1174, 1174, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173,
-     1173, 1173, 1173, 1173, 1173, 1173, 1173, 9,    1172, 1172, 1172, 1172,
-     1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172,
-     1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 6,    6,    6,    6,
-     6,    6,    6,    0,    0,    0,    0,    1171, 0,    1170, 1169, 1169,
-     0,    1168, 1167, 1167, 1166, 1166, 1166, 1166, 0,    1165, 1164, 1164,
-     1163, 1163, 1163, 1163, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 9,
-     0,    1161, 1160, 1160, 1159, 1159, 1159, 1159, 1158, 1158, 1158, 1158,
-     1158, 1158, 1158, 1158, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
-     1157, 1157, 1157, 1157, 1157, 1157, 8,    8,    0,    1156, 1155, 1155,
-     1154, 1154, 1154, 1154, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-     1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
-     1152, 1152, 1152, 9,    1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151,
-     1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151,
-     1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 7,    7,    7,    0,
-     0,    1150, 1149, 1149, 1148, 1148, 1148, 1148, 1147, 1147, 1147, 1147,
-     1147, 1147, 1147, 1147, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
-     1146, 1146, 1146, 1146, 1146, 1146, 1146, 9,    1145, 1145, 1145, 1145,
-     1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
-     1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
-     1145, 1145, 8,    0,    3,    3,    3,    3,    3,    3,    3,    3,
-     3,    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-     3,    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,    0,
-     3,    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-     3,    3,    3,    0,    3,    3,    3,    3,    3,    3,    3,    0,
-     3,    3,    3,    0,    3,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    1144,
-     0,    0,    0,    0,    0,    0,    0,    1143, 0,    0,    0,    1142,
-     0,    1141, 1140, 9,    0,    0,    0,    0,    0,    0,    0,    1139,
-     0,    0,    0,    1138, 0,    1137, 1136, 1136, 0,    0,    0,    1135,
-     0,    1134, 1133, 1133, 0,    1132, 1131, 1131, 1130, 1130, 8,    8,
-     0,    0,    0,    0,    0,    0,    0,    1129, 0,    0,    0,    1128,
-     0,    1127, 1126, 1126, 0,    0,    0,    1125, 0,    1124, 1123, 1123,
-     0,    1122, 1121, 1121, 1120, 1120, 1120, 9,    0,    0,    0,    1119,
-     0,    1118, 1117, 1117, 0,    1116, 1115, 1115, 1114, 1114, 1114, 1114,
-     0,    1113, 1112, 1112, 1111, 1111, 1111, 1111, 1110, 1110, 1110, 1110,
-     7,    7,    7,    7,    0,    0,    0,    0,    0,    0,    0,    1109,
-     0,    0,    0,    1108, 0,    1107, 1106, 1106, 0,    0,    0,    1105,
-     0,    1104, 1103, 1103, 0,    1102, 1101, 1101, 1100, 1100, 1100, 9,
-     0,    0,    0,    1099, 0,    1098, 1097, 1097, 0,    1096, 1095, 1095,
-     1094, 1094, 1094, 1094, 0,    1093, 1092, 1092, 1091, 1091, 1091, 1091,
-     1090, 1090, 1090, 1090, 1090, 1090, 8,    8,    0,    0,    0,    1089,
-     0,    1088, 1087, 1087, 0,    1086, 1085, 1085, 1084, 1084, 1084, 1084,
-     0,    1083, 1082, 1082, 1081, 1081, 1081, 1081, 1080, 1080, 1080, 1080,
-     1080, 1080, 1080, 9,    0,    1079, 1078, 1078, 1077, 1077, 1077, 1077,
-     1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1075, 1075, 1075, 1075,
-     1075, 1075, 1075, 1075, 6,    6,    6,    6,    6,    6,    6,    6,
-     0,    0,    0,    0,    0,    0,    0,    1074, 0,    0,    0,    1073,
-     0,    1072, 1071, 1071, 0,    0,    0,    1070, 0,    1069, 1068, 1068,
-     0,    1067, 1066, 1066, 1065, 1065, 1065, 9,    0,    0,    0,    1064,
-     0,    1063, 1062, 1062, 0,    1061, 1060, 1060, 1059, 1059, 1059, 1059,
-     0,    1058, 1057, 1057, 1056, 1056, 1056, 1056, 1055, 1055, 1055, 1055,
-     1055, 1055, 8,    8,    0,    0,    0,    1054, 0,    1053, 1052, 1052,
-     0,    1051, 1050, 1050, 1049, 1049, 1049, 1049, 0,    1048, 1047, 1047,
-     1046, 1046, 1046, 1046, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 9,
-     0,    1044, 1043, 1043, 1042, 1042, 1042, 1042, 1041, 1041, 1041, 1041,
-     1041, 1041, 1041, 1041, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040,
-     1040, 1040, 1040, 1040, 7,    7,    7,    7,    0,    0,    0,    1039,
-     0,    1038, 1037, 1037, 0,    1036, 1035, 1035, 1034, 1034, 1034, 1034,
-     0,    1033, 1032, 1032, 1031, 1031, 1031, 1031, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 9,    0,    1029, 1028, 1028, 1027, 1027, 1027, 1027,
-     1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1025, 1025, 1025, 1025,
-     1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 8,    8,
-     0,    1024, 1023, 1023, 1022, 1022, 1022, 1022, 1021, 1021, 1021, 1021,
-     1021, 1021, 1021, 1021, 1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
-     1020, 1020, 1020, 1020, 1020, 1020, 1020, 9,    1019, 1019, 1019, 1019,
-     1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019,
-     5,    5,    5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-     5,    5,    5,    0,    0,    0,    0,    0,    0,    0,    0,    1018,
-     0,    0,    0,    1017, 0,    1016, 1015, 1015, 0,    0,    0,    1014,
-     0,    1013, 1012, 1012, 0,    1011, 1010, 1010, 1009, 1009, 1009, 9,
-     0,    0,    0,    1008, 0,    1007, 1006, 1006, 0,    1005, 1004, 1004,
-     1003, 1003, 1003, 1003, 0,    1002, 1001, 1001, 1000, 1000, 1000, 1000,
-     999,  999,  999,  999,  999,  999,  8,    8,    0,    0,    0,    998,
-     0,    997,  996,  996,  0,    995,  994,  994,  993,  993,  993,  993,
-     0,    992,  991,  991,  990,  990,  990,  990,  989,  989,  989,  989,
-     989,  989,  989,  9,    0,    988,  987,  987,  986,  986,  986,  986,
-     985,  985,  985,  985,  985,  985,  985,  985,  984,  984,  984,  984,
-     984,  984,  984,  984,  984,  984,  984,  984,  7,    7,    7,    7,
-     0,    0,    0,    983,  0,    982,  981,  981,  0,    980,  979,  979,
-     978,  978,  978,  978,  0,    977,  976,  976,  975,  975,  975,  975,
-     974,  974,  974,  974,  974,  974,  974,  9,    0,    973,  972,  972,
-     971,  971,  971,  971,  970,  970,  970,  970,  970,  970,  970,  970,
-     969,  969,  969,  969,  969,  969,  969,  969,  969,  969,  969,  969,
-     969,  969,  8,    8,    0,    968,  967,  967,  966,  966,  966,  966,
-     965,  965,  965,  965,  965,  965,  965,  965,  964,  964,  964,  964,
-     964,  964,  964,  964,  964,  964,  964,  964,  964,  964,  964,  9,
-     963,  963,  963,  963,  963,  963,  963,  963,  963,  963,  963,  963,
-     963,  963,  963,  963,  963,  963,  963,  963,  963,  963,  963,  963,
-     6,    6,    6,    6,    6,    6,    6,    0,    0,    0,    0,    962,
-     0,    961,  960,  960,  0,    959,  958,  958,  957,  957,  957,  957,
-     0,    956,  955,  955,  954,  954,  954,  954,  953,  953,  953,  953,
-     953,  953,  953,  9,    0,    952,  951,  951,  950,  950,  950,  950,
-     949,  949,  949,  949,  949,  949,  949,  949,  948,  948,  948,  948,
-     948,  948,  948,  948,  948,  948,  948,  948,  948,  948,  8,    8,
-     0,    947,  946,  946,  945,  945,  945,  945,  944,  944,  944,  944,
-     944,  944,  944,  944,  943,  943,  943,  943,  943,  943,  943,  943,
-     943,  943,  943,  943,  943,  943,  943,  9,    942,  942,  942,  942,
-     942,  942,  942,  942,  942,  942,  942,  942,  942,  942,  942,  942,
-     942,  942,  942,  942,  942,  942,  942,  942,  942,  942,  942,  942,
-     7,    7,    7,    0,    0,    941,  940,  940,  939,  939,  939,  939,
-     938,  938,  938,  938,  938,  938,  938,  938,  937,  937,  937,  937,
-     937,  937,  937,  937,  937,  937,  937,  937,  937,  937,  937,  9,
-     936,  936,  936,  936,  936,  936,  936,  936,  936,  936,  936,  936,
-     936,  936,  936,  936,  936,  936,  936,  936,  936,  936,  936,  936,
-     936,  936,  936,  936,  936,  936,  8,    0,    935,  935,  935,  935,
-     935,  935,  935,  935,  935,  935,  935,  935,  935,  935,  935,  935,
-     935,  935,  935,  935,  935,  935,  935,  935,  935,  935,  935,  935,
-     935,  935,  935,  0,    4,    4,    4,    4,    4,    4,    4,    4,
-     4,    4,    4,    4,    4,    4,    4,    0,    4,    4,    4,    4,
-     4,    4,    4,    0,    4,    4,    4,    0,    4,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    934,  0,    0,    0,    933,
-     0,    932,  931,  931,  0,    0,    0,    930,  0,    929,  928,  928,
-     0,    927,  926,  926,  925,  925,  925,  9,    0,    0,    0,    924,
-     0,    923,  922,  922,  0,    921,  920,  920,  919,  919,  919,  919,
-     0,    918,  917,  917,  916,  916,  916,  916,  915,  915,  915,  915,
-     915,  915,  8,    8,    0,    0,    0,    914,  0,    913,  912,  912,
-     0,    911,  910,  910,  909,  909,  909,  909,  0,    908,  907,  907,
-     906,  906,  906,  906,  905,  905,  905,  905,  905,  905,  905,  9,
-     0,    904,  903,  903,  902,  902,  902,  902,  901,  901,  901,  901,
-     901,  901,  901,  901,  900,  900,  900,  900,  900,  900,  900,  900,
-     900,  900,  900,  900,  7,    7,    7,    7,    0,    0,    0,    899,
-     0,    898,  897,  897,  0,    896,  895,  895,  894,  894,  894,  894,
-     0,    893,  892,  892,  891,  891,  891,  891,  890,  890,  890,  890,
-     890,  890,  890,  9,    0,    889,  888,  888,  887,  887,  887,  887,
-     886,  886,  886,  886,  886,  886,  886,  886,  885,  885,  885,  885,
-     885,  885,  885,  885,  885,  885,  885,  885,  885,  885,  8,    8,
-     0,    884,  883,  883,  882,  882,  882,  882,  881,  881,  881,  881,
-     881,  881,  881,  881,  880,  880,  880,  880,  880,  880,  880,  880,
-     880,  880,  880,  880,  880,  880,  880,  9,    879,  879,  879,  879,
-     879,  879,  879,  879,  879,  879,  879,  879,  879,  879,  879,  879,
-     879,  879,  879,  879,  879,  879,  879,  879,  6,    6,    6,    6,
-     6,    6,    6,    0,    0,    0,    0,    878,  0,    877,  876,  876,
-     0,    875,  874,  874,  873,  873,  873,  873,  0,    872,  871,  871,
-     870,  870,  870,  870,  869,  869,  869,  869,  869,  869,  869,  9,
-     0,    868,  867,  867,  866,  866,  866,  866,  865,  865,  865,  865,
-     865,  865,  865,  865,  864,  864,  864,  864,  864,  864,  864,  864,
-     864,  864,  864,  864,  864,  864,  8,    8,    0,    863,  862,  862,
-     861,  861,  861,  861,  860,  860,  860,  860,  860,  860,  860,  860,
-     859,  859,  859,  859,  859,  859,  859,  859,  859,  859,  859,  859,
-     859,  859,  859,  9,    858,  858,  858,  858,  858,  858,  858,  858,
-     858,  858,  858,  858,  858,  858,  858,  858,  858,  858,  858,  858,
-     858,  858,  858,  858,  858,  858,  858,  858,  7,    7,    7,    0,
-     0,    857,  856,  856,  855,  855,  855,  855,  854,  854,  854,  854,
-     854,  854,  854,  854,  853,  853,  853,  853,  853,  853,  853,  853,
-     853,  853,  853,  853,  853,  853,  853,  9,    852,  852,  852,  852,
-     852,  852,  852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
-     852,  852,  852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
-     852,  852,  8,    0,    851,  851,  851,  851,  851,  851,  851,  851,
-     851,  851,  851,  851,  851,  851,  851,  851,  851,  851,  851,  851,
-     851,  851,  851,  851,  851,  851,  851,  851,  851,  851,  851,  0,
-     851,  851,  851,  851,  851,  851,  851,  851,  851,  851,  851,  851,
-     851,  851,  851,  0,    5,    5,    5,    5,    5,    5,    5,    0,
-     5,    5,    5,    0,    5,    0,    0,    0,    0,    0,    0,    850,
-     0,    849,  848,  848,  0,    847,  846,  846,  845,  845,  845,  845,
-     0,    844,  843,  843,  842,  842,  842,  842,  841,  841,  841,  841,
-     841,  841,  841,  9,    0,    840,  839,  839,  838,  838,  838,  838,
-     837,  837,  837,  837,  837,  837,  837,  837,  836,  836,  836,  836,
-     836,  836,  836,  836,  836,  836,  836,  836,  836,  836,  8,    8,
-     0,    835,  834,  834,  833,  833,  833,  833,  832,  832,  832,  832,
-     832,  832,  832,  832,  831,  831,  831,  831,  831,  831,  831,  831,
-     831,  831,  831,  831,  831,  831,  831,  9,    830,  830,  830,  830,
-     830,  830,  830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-     830,  830,  830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-     7,    7,    7,    0,    0,    829,  828,  828,  827,  827,  827,  827,
-     826,  826,  826,  826,  826,  826,  826,  826,  825,  825,  825,  825,
-     825,  825,  825,  825,  825,  825,  825,  825,  825,  825,  825,  9,
-     824,  824,  824,  824,  824,  824,  824,  824,  824,  824,  824,  824,
-     824,  824,  824,  824,  824,  824,  824,  824,  824,  824,  824,  824,
-     824,  824,  824,  824,  824,  824,  8,    0,    823,  823,  823,  823,
-     823,  823,  823,  823,  823,  823,  823,  823,  823,  823,  823,  823,
-     823,  823,  823,  823,  823,  823,  823,  823,  823,  823,  823,  823,
-     823,  823,  823,  0,    823,  823,  823,  823,  823,  823,  823,  823,
-     823,  823,  823,  823,  823,  823,  823,  0,    823,  823,  823,  823,
-     823,  823,  823,  0,    6,    6,    6,    0,    6,    0,    0,    0,
-     0,    822,  821,  821,  820,  820,  820,  820,  819,  819,  819,  819,
-     819,  819,  819,  819,  818,  818,  818,  818,  818,  818,  818,  818,
-     818,  818,  818,  818,  818,  818,  818,  9,    817,  817,  817,  817,
-     817,  817,  817,  817,  817,  817,  817,  817,  817,  817,  817,  817,
-     817,  817,  817,  817,  817,  817,  817,  817,  817,  817,  817,  817,
-     817,  817,  8,    0,    816,  816,  816,  816,  816,  816,  816,  816,
-     816,  816,  816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-     816,  816,  816,  816,  816,  816,  816,  816,  816,  816,  816,  0,
-     816,  816,  816,  816,  816,  816,  816,  816,  816,  816,  816,  816,
-     816,  816,  816,  0,    816,  816,  816,  816,  816,  816,  816,  0,
-     816,  816,  816,  0,    7,    0,    0,    0,    2,    2,    2,    2,
-     2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-     2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-     2,    2,    2,    0,    2,    2,    2,    2,    2,    2,    2,    2,
-     2,    2,    2,    2,    2,    2,    2,    0,    2,    2,    2,    2,
-     2,    2,    2,    0,    2,    2,    2,    0,    2,    0,    0,    0,
-     2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-     2,    2,    2,    0,    2,    2,    2,    2,    2,    2,    2,    0,
-     2,    2,    2,    0,    2,    0,    0,    0,    2,    2,    2,    2,
-     2,    2,    2,    0,    2,    2,    2,    0,    2,    0,    0,    0,
-     2,    2,    2,    0,    2,    0,    0,    0,    2,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    10,   0,    0,    0,    0,
-     0,    0,    0,    815,  0,    0,    0,    814,  0,    813,  812,  9,
-     0,    0,    0,    0,    0,    0,    0,    811,  0,    0,    0,    810,
-     0,    809,  808,  10,   0,    0,    0,    807,  0,    806,  805,  805,
-     0,    804,  803,  803,  802,  802,  8,    8,    0,    0,    0,    0,
-     0,    0,    0,    801,  0,    0,    0,    800,  0,    799,  798,  10,
-     0,    0,    0,    797,  0,    796,  795,  795,  0,    794,  793,  793,
-     792,  792,  792,  9,    0,    0,    0,    791,  0,    790,  789,  789,
-     0,    788,  787,  787,  786,  786,  786,  10,   0,    785,  784,  784,
-     783,  783,  783,  783,  782,  782,  782,  782,  7,    7,    7,    7,
-     0,    0,    0,    0,    0,    0,    0,    781,  0,    0,    0,    780,
-     0,    779,  778,  10,   0,    0,    0,    777,  0,    776,  775,  775,
-     0,    774,  773,  773,  772,  772,  772,  9,    0,    0,    0,    771,
-     0,    770,  769,  769,  0,    768,  767,  767,  766,  766,  766,  10,
-     0,    765,  764,  764,  763,  763,  763,  763,  762,  762,  762,  762,
-     762,  762,  8,    8,    0,    0,    0,    761,  0,    760,  759,  759,
-     0,    758,  757,  757,  756,  756,  756,  10,   0,    755,  754,  754,
-     753,  753,  753,  753,  752,  752,  752,  752,  752,  752,  752,  9,
-     0,    751,  750,  750,  749,  749,  749,  749,  748,  748,  748,  748,
-     748,  748,  748,  10,   747,  747,  747,  747,  747,  747,  747,  747,
-     6,    6,    6,    6,    6,    6,    6,    6,    0,    0,    0,    0,
-     0,    0,    0,    746,  0,    0,    0,    745,  0,    744,  743,  10,
-     0,    0,    0,    742,  0,    741,  740,  740,  0,    739,  738,  738,
-     737,  737,  737,  9,    0,    0,    0,    736,  0,    735,  734,  734,
-     0,    733,  732,  732,  731,  731,  731,  10,   0,    730,  729,  729,
-     728,  728,  728,  728,  727,  727,  727,  727,  727,  727,  8,    8,
-     0,    0,    0,    726,  0,    725,  724,  724,  0,    723,  722,  722,
-     721,  721,  721,  10,   0,    720,  719,  719,  718,  718,  718,  718,
-     717,  717,  717,  717,  717,  717,  717,  9,    0,    716,  715,  715,
-     714,  714,  714,  714,  713,  713,  713,  713,  713,  713,  713,  10,
-     712,  712,  712,  712,  712,  712,  712,  712,  712,  712,  712,  712,
-     7,    7,    7,    7,    0,    0,    0,    711,  0,    710,  709,  709,
-     0,    708,  707,  707,  706,  706,  706,  10,   0,    705,  704,  704,
-     703,  703,  703,  703,  702,  702,  702,  702,  702,  702,  702,  9,
-     0,    701,  700,  700,  699,  699,  699,  699,  698,  698,  698,  698,
-     698,  698,  698,  10,   697,  697,  697,  697,  697,  697,  697,  697,
-     697,  697,  697,  697,  697,  697,  8,    8,    0,    696,  695,  695,
-     694,  694,  694,  694,  693,  693,  693,  693,  693,  693,  693,  10,
-     692,  692,  692,  692,  692,  692,  692,  692,  692,  692,  692,  692,
-     692,  692,  692,  9,    691,  691,  691,  691,  691,  691,  691,  691,
-     691,  691,  691,  691,  691,  691,  691,  10,   5,    5,    5,    5,
-     5,    5,    5,    5,    5,    5,    5,    5,    5,    5,    5,    0,
-     0,    0,    0,    0,    0,    0,    0,    690,  0,    0,    0,    689,
-     0,    688,  687,  10,   0,    0,    0,    686,  0,    685,  684,  684,
-     0,    683,  682,  682,  681,  681,  681,  9,    0,    0,    0,    680,
-     0,    679,  678,  678,  0,    677,  676,  676,  675,  675,  675,  10,
-     0,    674,  673,  673,  672,  672,  672,  672,  671,  671,  671,  671,
-     671,  671,  8,    8,    0,    0,    0,    670,  0,    669,  668,  668,
-     0,    667,  666,  666,  665,  665,  665,  10,   0,    664,  663,  663,
-     662,  662,  662,  662,  661,  661,  661,  661,  661,  661,  661,  9,
-     0,    660,  659,  659,  658,  658,  658,  658,  657,  657,  657,  657,
-     657,  657,  657,  10,   656,  656,  656,  656,  656,  656,  656,  656,
-     656,  656,  656,  656,  7,    7,    7,    7,    0,    0,    0,    655,
-     0,    654,  653,  653,  0,    652,  651,  651,  650,  650,  650,  10,
-     0,    649,  648,  648,  647,  647,  647,  647,  646,  646,  646,  646,
-     646,  646,  646,  9,    0,    645,  644,  644,  643,  643,  643,  643,
-     642,  642,  642,  642,  642,  642,  642,  10,   641,  641,  641,  641,
-     641,  641,  641,  641,  641,  641,  641,  641,  641,  641,  8,    8,
-     0,    640,  639,  639,  638,  638,  638,  638,  637,  637,  637,  637,
-     637,  637,  637,  10,   636,  636,  636,  636,  636,  636,  636,  636,
-     636,  636,  636,  636,  636,  636,  636,  9,    635,  635,  635,  635,
-     635,  635,  635,  635,  635,  635,  635,  635,  635,  635,  635,  10,
-     635,  635,  635,  635,  635,  635,  635,  635,  6,    6,    6,    6,
-     6,    6,    6,    0,    0,    0,    0,    634,  0,    633,  632,  632,
-     0,    631,  630,  630,  629,  629,  629,  10,   0,    628,  627,  627,
-     626,  626,  626,  626,  625,  625,  625,  625,  625,  625,  625,  9,
-     0,    624,  623,  623,  622,  622,  622,  622,  621,  621,  621,  621,
-     621,  621,  621,  10,   620,  620,  620,  620,  620,  620,  620,  620,
-     620,  620,  620,  620,  620,  620,  8,    8,    0,    619,  618,  618,
-     617,  617,  617,  617,  616,  616,  616,  616,  616,  616,  616,  10,
-     615,  615,  615,  615,  615,  615,  615,  615,  615,  615,  615,  615,
-     615,  615,  615,  9,    614,  614,  614,  614,  614,  614,  614,  614,
-     614,  614,  614,  614,  614,  614,  614,  10,   614,  614,  614,  614,
-     614,  614,  614,  614,  614,  614,  614,  614,  7,    7,    7,    0,
-     0,    613,  612,  612,  611,  611,  611,  611,  610,  610,  610,  610,
-     610,  610,  610,  10,   609,  609,  609,  609,  609,  609,  609,  609,
-     609,  609,  609,  609,  609,  609,  609,  9,    608,  608,  608,  608,
-     608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  10,
-     608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,
-     608,  608,  8,    0,    607,  607,  607,  607,  607,  607,  607,  607,
-     607,  607,  607,  607,  607,  607,  607,  10,   607,  607,  607,  607,
-     607,  607,  607,  607,  607,  607,  607,  607,  607,  607,  607,  0,
-     4,    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-     4,    4,    4,    0,    4,    4,    4,    4,    4,    4,    4,    0,
-     4,    4,    4,    0,    4,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    606,  0,    0,    0,    605,  0,    604,  603,  10,
-     0,    0,    0,    602,  0,    601,  600,  600,  0,    599,  598,  598,
-     597,  597,  597,  9,    0,    0,    0,    596,  0,    595,  594,  594,
-     0,    593,  592,  592,  591,  591,  591,  10,   0,    590,  589,  589,
-     588,  588,  588,  588,  587,  587,  587,  587,  587,  587,  8,    8,
-     0,    0,    0,    586,  0,    585,  584,  584,  0,    583,  582,  582,
-     581,  581,  581,  10,   0,    580,  579,  579,  578,  578,  578,  578,
-     577,  577,  577,  577,  577,  577,  577,  9,    0,    576,  575,  575,
-     574,  574,  574,  574,  573,  573,  573,  573,  573,  573,  573,  10,
-     572,  572,  572,  572,  572,  572,  572,  572,  572,  572,  572,  572,
-     7,    7,    7,    7,    0,    0,    0,    571,  0,    570,  569,  569,
-     0,    568,  567,  567,  566,  566,  566,  10,   0,    565,  564,  564,
-     563,  563,  563,  563,  562,  562,  562,  562,  562,  562,  562,  9,
-     0,    561,  560,  560,  559,  559,  559,  559,  558,  558,  558,  558,
-     558,  558,  558,  10,   557,  557,  557,  557,  557,  557,  557,  557,
-     557,  557,  557,  557,  557,  557,  8,    8,    0,    556,  555,  555,
-     554,  554,  554,  554,  553,  553,  553,  553,  553,  553,  553,  10,
-     552,  552,  552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
-     552,  552,  552,  9,    551,  551,  551,  551,  551,  551,  551,  551,
-     551,  551,  551,  551,  551,  551,  551,  10,   551,  551,  551,  551,
-     551,  551,  551,  551,  6,    6,    6,    6,    6,    6,    6,    0,
-     0,    0,    0,    550,  0,    549,  548,  548,  0,    547,  546,  546,
-     545,  545,  545,  10,   0,    544,  543,  543,  542,  542,  542,  542,
-     541,  541,  541,  541,  541,  541,  541,  9,    0,    540,  539,  539,
-     538,  538,  538,  538,  537,  537,  537,  537,  537,  537,  537,  10,
-     536,  536,  536,  536,  536,  536,  536,  536,  536,  536,  536,  536,
-     536,  536,  8,    8,    0,    535,  534,  534,  533,  533,  533,  533,
-     532,  532,  532,  532,  532,  532,  532,  10,   531,  531,  531,  531,
-     531,  531,  531,  531,  531,  531,  531,  531,  531,  531,  531,  9,
-     530,  530,  530,  530,  530,  530,  530,  530,  530,  530,  530,  530,
-     530,  530,  530,  10,   530,  530,  530,  530,  530,  530,  530,  530,
-     530,  530,  530,  530,  7,    7,    7,    0,    0,    529,  528,  528,
-     527,  527,  527,  527,  526,  526,  526,  526,  526,  526,  526,  10,
-     525,  525,  525,  525,  525,  525,  525,  525,  525,  525,  525,  525,
-     525,  525,  525,  9,    524,  524,  524,  524,  524,  524,  524,  524,
-     524,  524,  524,  524,  524,  524,  524,  10,   524,  524,  524,  524,
-     524,  524,  524,  524,  524,  524,  524,  524,  524,  524,  8,    0,
-     523,  523,  523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
-     523,  523,  523,  10,   523,  523,  523,  523,  523,  523,  523,  523,
-     523,  523,  523,  523,  523,  523,  523,  0,    523,  523,  523,  523,
-     523,  523,  523,  523,  523,  523,  523,  523,  523,  523,  523,  0,
-     5,    5,    5,    5,    5,    5,    5,    0,    5,    5,    5,    0,
-     5,    0,    0,    0,    0,    0,    0,    522,  0,    521,  520,  520,
-     0,    519,  518,  518,  517,  517,  517,  10,   0,    516,  515,  515,
-     514,  514,  514,  514,  513,  513,  513,  513,  513,  513,  513,  9,
-     0,    512,  511,  511,  510,  510,  510,  510,  509,  509,  509,  509,
-     509,  509,  509,  10,   508,  508,  508,  508,  508,  508,  508,  508,
-     508,  508,  508,  508,  508,  508,  8,    8,    0,    507,  506,  506,
-     505,  505,  505,  505,  504,  504,  504,  504,  504,  504,  504,  10,
-     503,  503,  503,  503,  503,  503,  503,  503,  503,  503,  503,  503,
-     503,  503,  503,  9,    502,  502,  502,  502,  502,  502,  502,  502,
-     502,  502,  502,  502,  502,  502,  502,  10,   502,  502,  502,  502,
-     502,  502,  502,  502,  502,  502,  502,  502,  7,    7,    7,    0,
-     0,    501,  500,  500,  499,  499,  499,  499,  498,  498,  498,  498,
-     498,  498,  498,  10,   497,  497,  497,  497,  497,  497,  497,  497,
-     497,  497,  497,  497,  497,  497,  497,  9,    496,  496,  496,  496,
-     496,  496,  496,  496,  496,  496,  496,  496,  496,  496,  496,  10,
-     496,  496,  496,  496,  496,  496,  496,  496,  496,  496,  496,  496,
-     496,  496,  8,    0,    495,  495,  495,  495,  495,  495,  495,  495,
-     495,  495,  495,  495,  495,  495,  495,  10,   495,  495,  495,  495,
-     495,  495,  495,  495,  495,  495,  495,  495,  495,  495,  495,  0,
-     495,  495,  495,  495,  495,  495,  495,  495,  495,  495,  495,  495,
-     495,  495,  495,  0,    495,  495,  495,  495,  495,  495,  495,  0,
-     6,    6,    6,    0,    6,    0,    0,    0,    0,    494,  493,  493,
-     492,  492,  492,  492,  491,  491,  491,  491,  491,  491,  491,  10,
-     490,  490,  490,  490,  490,  490,  490,  490,  490,  490,  490,  490,
-     490,  490,  490,  9,    489,  489,  489,  489,  489,  489,  489,  489,
-     489,  489,  489,  489,  489,  489,  489,  10,   489,  489,  489,  489,
-     489,  489,  489,  489,  489,  489,  489,  489,  489,  489,  8,    0,
-     488,  488,  488,  488,  488,  488,  488,  488,  488,  488,  488,  488,
-     488,  488,  488,  10,   488,  488,  488,  488,  488,  488,  488,  488,
-     488,  488,  488,  488,  488,  488,  488,  0,    488,  488,  488,  488,
-     488,  488,  488,  488,  488,  488,  488,  488,  488,  488,  488,  0,
-     488,  488,  488,  488,  488,  488,  488,  0,    488,  488,  488,  0,
-     7,    0,    0,    0,    487,  487,  487,  487,  487,  487,  487,  487,
-     487,  487,  487,  487,  487,  487,  487,  10,   487,  487,  487,  487,
-     487,  487,  487,  487,  487,  487,  487,  487,  487,  487,  487,  0,
-     487,  487,  487,  487,  487,  487,  487,  487,  487,  487,  487,  487,
-     487,  487,  487,  0,    487,  487,  487,  487,  487,  487,  487,  0,
-     487,  487,  487,  0,    487,  0,    0,    0,    3,    3,    3,    3,
-     3,    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,    0,
-     3,    3,    3,    3,    3,    3,    3,    0,    3,    3,    3,    0,
-     3,    0,    0,    0,    3,    3,    3,    3,    3,    3,    3,    0,
-     3,    3,    3,    0,    3,    0,    0,    0,    3,    3,    3,    0,
-     3,    0,    0,    0,    3,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    486,  0,    0,    0,    485,
-     0,    484,  483,  10,   0,    0,    0,    482,  0,    481,  480,  480,
-     0,    479,  478,  478,  477,  477,  477,  9,    0,    0,    0,    476,
-     0,    475,  474,  474,  0,    473,  472,  472,  471,  471,  471,  10,
-     0,    470,  469,  469,  468,  468,  468,  468,  467,  467,  467,  467,
-     467,  467,  8,    8,    0,    0,    0,    466,  0,    465,  464,  464,
-     0,    463,  462,  462,  461,  461,  461,  10,   0,    460,  459,  459,
-     458,  458,  458,  458,  457,  457,  457,  457,  457,  457,  457,  9,
-     0,    456,  455,  455,  454,  454,  454,  454,  453,  453,  453,  453,
-     453,  453,  453,  10,   452,  452,  452,  452,  452,  452,  452,  452,
-     452,  452,  452,  452,  7,    7,    7,    7,    0,    0,    0,    451,
-     0,    450,  449,  449,  0,    448,  447,  447,  446,  446,  446,  10,
-     0,    445,  444,  444,  443,  443,  443,  443,  442,  442,  442,  442,
-     442,  442,  442,  9,    0,    441,  440,  440,  439,  439,  439,  439,
-     438,  438,  438,  438,  438,  438,  438,  10,   437,  437,  437,  437,
-     437,  437,  437,  437,  437,  437,  437,  437,  437,  437,  8,    8,
-     0,    436,  435,  435,  434,  434,  434,  434,  433,  433,  433,  433,
-     433,  433,  433,  10,   432,  432,  432,  432,  432,  432,  432,  432,
-     432,  432,  432,  432,  432,  432,  432,  9,    431,  431,  431,  431,
-     431,  431,  431,  431,  431,  431,  431,  431,  431,  431,  431,  10,
-     431,  431,  431,  431,  431,  431,  431,  431,  6,    6,    6,    6,
-     6,    6,    6,    0,    0,    0,    0,    430,  0,    429,  428,  428,
-     0,    427,  426,  426,  425,  425,  425,  10,   0,    424,  423,  423,
-     422,  422,  422,  422,  421,  421,  421,  421,  421,  421,  421,  9,
-     0,    420,  419,  419,  418,  418,  418,  418,  417,  417,  417,  417,
-     417,  417,  417,  10,   416,  416,  416,  416,  416,  416,  416,  416,
-     416,  416,  416,  416,  416,  416,  8,    8,    0,    415,  414,  414,
-     413,  413,  413,  413,  412,  412,  412,  412,  412,  412,  412,  10,
-     411,  411,  411,  411,  411,  411,  411,  411,  411,  411,  411,  411,
-     411,  411,  411,  9,    410,  410,  410,  410,  410,  410,  410,  410,
-     410,  410,  410,  410,  410,  410,  410,  10,   410,  410,  410,  410,
-     410,  410,  410,  410,  410,  410,  410,  410,  7,    7,    7,    0,
-     0,    409,  408,  408,  407,  407,  407,  407,  406,  406,  406,  406,
-     406,  406,  406,  10,   405,  405,  405,  405,  405,  405,  405,  405,
-     405,  405,  405,  405,  405,  405,  405,  9,    404,  404,  404,  404,
-     404,  404,  404,  404,  404,  404,  404,  404,  404,  404,  404,  10,
-     404,  404,  404,  404,  404,  404,  404,  404,  404,  404,  404,  404,
-     404,  404,  8,    0,    403,  403,  403,  403,  403,  403,  403,  403,
-     403,  403,  403,  403,  403,  403,  403,  10,   403,  403,  403,  403,
-     403,  403,  403,  403,  403,  403,  403,  403,  403,  403,  403,  0,
-     403,  403,  403,  403,  403,  403,  403,  403,  403,  403,  403,  403,
-     403,  403,  403,  0,    5,    5,    5,    5,    5,    5,    5,    0,
-     5,    5,    5,    0,    5,    0,    0,    0,    0,    0,    0,    402,
-     0,    401,  400,  400,  0,    399,  398,  398,  397,  397,  397,  10,
-     0,    396,  395,  395,  394,  394,  394,  394,  393,  393,  393,  393,
-     393,  393,  393,  9,    0,    392,  391,  391,  390,  390,  390,  390,
-     389,  389,  389,  389,  389,  389,  389,  10,   388,  388,  388,  388,
-     388,  388,  388,  388,  388,  388,  388,  388,  388,  388,  8,    8,
-     0,    387,  386,  386,  385,  385,  385,  385,  384,  384,  384,  384,
-     384,  384,  384,  10,   383,  383,  383,  383,  383,  383,  383,  383,
-     383,  383,  383,  383,  383,  383,  383,  9,    382,  382,  382,  382,
-     382,  382,  382,  382,  382,  382,  382,  382,  382,  382,  382,  10,
-     382,  382,  382,  382,  382,  382,  382,  382,  382,  382,  382,  382,
-     7,    7,    7,    0,    0,    381,  380,  380,  379,  379,  379,  379,
-     378,  378,  378,  378,  378,  378,  378,  10,   377,  377,  377,  377,
-     377,  377,  377,  377,  377,  377,  377,  377,  377,  377,  377,  9,
-     376,  376,  376,  376,  376,  376,  376,  376,  376,  376,  376,  376,
-     376,  376,  376,  10,   376,  376,  376,  376,  376,  376,  376,  376,
-     376,  376,  376,  376,  376,  376,  8,    0,    375,  375,  375,  375,
-     375,  375,  375,  375,  375,  375,  375,  375,  375,  375,  375,  10,
-     375,  375,  375,  375,  375,  375,  375,  375,  375,  375,  375,  375,
-     375,  375,  375,  0,    375,  375,  375,  375,  375,  375,  375,  375,
-     375,  375,  375,  375,  375,  375,  375,  0,    375,  375,  375,  375,
-     375,  375,  375,  0,    6,    6,    6,    0,    6,    0,    0,    0,
-     0,    374,  373,  373,  372,  372,  372,  372,  371,  371,  371,  371,
-     371,  371,  371,  10,   370,  370,  370,  370,  370,  370,  370,  370,
-     370,  370,  370,  370,  370,  370,  370,  9,    369,  369,  369,  369,
-     369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  10,
-     369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,
-     369,  369,  8,    0,    368,  368,  368,  368,  368,  368,  368,  368,
-     368,  368,  368,  368,  368,  368,  368,  10,   368,  368,  368,  368,
-     368,  368,  368,  368,  368,  368,  368,  368,  368,  368,  368,  0,
-     368,  368,  368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-     368,  368,  368,  0,    368,  368,  368,  368,  368,  368,  368,  0,
-     368,  368,  368,  0,    7,    0,    0,    0,    367,  367,  367,  367,
-     367,  367,  367,  367,  367,  367,  367,  367,  367,  367,  367,  10,
-     367,  367,  367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
-     367,  367,  367,  0,    367,  367,  367,  367,  367,  367,  367,  367,
-     367,  367,  367,  367,  367,  367,  367,  0,    367,  367,  367,  367,
-     367,  367,  367,  0,    367,  367,  367,  0,    367,  0,    0,    0,
-     367,  367,  367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
-     367,  367,  367,  0,    367,  367,  367,  367,  367,  367,  367,  0,
-     367,  367,  367,  0,    367,  0,    0,    0,    4,    4,    4,    4,
-     4,    4,    4,    0,    4,    4,    4,    0,    4,    0,    0,    0,
-     4,    4,    4,    0,    4,    0,    0,    0,    4,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    366,  0,    365,  364,  364,
-     0,    363,  362,  362,  361,  361,  361,  10,   0,    360,  359,  359,
-     358,  358,  358,  358,  357,  357,  357,  357,  357,  357,  357,  9,
-     0,    356,  355,  355,  354,  354,  354,  354,  353,  353,  353,  353,
-     353,  353,  353,  10,   352,  352,  352,  352,  352,  352,  352,  352,
-     352,  352,  352,  352,  352,  352,  8,    8,    0,    351,  350,  350,
-     349,  349,  349,  349,  348,  348,  348,  348,  348,  348,  348,  10,
-     347,  347,  347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-     347,  347,  347,  9,    346,  346,  346,  346,  346,  346,  346,  346,
-     346,  346,  346,  346,  346,  346,  346,  10,   346,  346,  346,  346,
-     346,  346,  346,  346,  346,  346,  346,  346,  7,    7,    7,    0,
-     0,    345,  344,  344,  343,  343,  343,  343,  342,  342,  342,  342,
-     342,  342,  342,  10,   341,  341,  341,  341,  341,  341,  341,  341,
-     341,  341,  341,  341,  341,  341,  341,  9,    340,  340,  340,  340,
-     340,  340,  340,  340,  340,  340,  340,  340,  340,  340,  340,  10,
-     340,  340,  340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
-     340,  340,  8,    0,    339,  339,  339,  339,  339,  339,  339,  339,
-     339,  339,  339,  339,  339,  339,  339,  10,   339,  339,  339,  339,
-     339,  339,  339,  339,  339,  339,  339,  339,  339,  339,  339,  0,
-     339,  339,  339,  339,  339,  339,  339,  339,  339,  339,  339,  339,
-     339,  339,  339,  0,    339,  339,  339,  339,  339,  339,  339,  0,
-     6,    6,    6,    0,    6,    0,    0,    0,    0,    338,  337,  337,
-     336,  336,  336,  336,  335,  335,  335,  335,  335,  335,  335,  10,
-     334,  334,  334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
-     334,  334,  334,  9,    333,  333,  333,  333,  333,  333,  333,  333,
-     333,  333,  333,  333,  333,  333,  333,  10,   333,  333,  333,  333,
-     333,  333,  333,  333,  333,  333,  333,  333,  333,  333,  8,    0,
-     332,  332,  332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
-     332,  332,  332,  10,   332,  332,  332,  332,  332,  332,  332,  332,
-     332,  332,  332,  332,  332,  332,  332,  0,    332,  332,  332,  332,
-     332,  332,  332,  332,  332,  332,  332,  332,  332,  332,  332,  0,
-     332,  332,  332,  332,  332,  332,  332,  0,    332,  332,  332,  0,
-     7,    0,    0,    0,    331,  331,  331,  331,  331,  331,  331,  331,
-     331,  331,  331,  331,  331,  331,  331,  10,   331,  331,  331,  331,
-     331,  331,  331,  331,  331,  331,  331,  331,  331,  331,  331,  0,
-     331,  331,  331,  331,  331,  331,  331,  331,  331,  331,  331,  331,
-     331,  331,  331,  0,    331,  331,  331,  331,  331,  331,  331,  0,
-     331,  331,  331,  0,    331,  0,    0,    0,    331,  331,  331,  331,
-     331,  331,  331,  331,  331,  331,  331,  331,  331,  331,  331,  0,
-     331,  331,  331,  331,  331,  331,  331,  0,    331,  331,  331,  0,
-     331,  0,    0,    0,    331,  331,  331,  331,  331,  331,  331,  0,
-     331,  331,  331,  0,    331,  0,    0,    0,    5,    5,    5,    0,
-     5,    0,    0,    0,    5,    0,    0,    0,    0,    0,    0,    0,
-     0,    330,  329,  329,  328,  328,  328,  328,  327,  327,  327,  327,
-     327,  327,  327,  10,   326,  326,  326,  326,  326,  326,  326,  326,
-     326,  326,  326,  326,  326,  326,  326,  9,    325,  325,  325,  325,
-     325,  325,  325,  325,  325,  325,  325,  325,  325,  325,  325,  10,
-     325,  325,  325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-     325,  325,  8,    0,    324,  324,  324,  324,  324,  324,  324,  324,
-     324,  324,  324,  324,  324,  324,  324,  10,   324,  324,  324,  324,
-     324,  324,  324,  324,  324,  324,  324,  324,  324,  324,  324,  0,
-     324,  324,  324,  324,  324,  324,  324,  324,  324,  324,  324,  324,
-     324,  324,  324,  0,    324,  324,  324,  324,  324,  324,  324,  0,
-     324,  324,  324,  0,    7,    0,    0,    0,    323,  323,  323,  323,
-     323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  10,
-     323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
-     323,  323,  323,  0,    323,  323,  323,  323,  323,  323,  323,  323,
-     323,  323,  323,  323,  323,  323,  323,  0,    323,  323,  323,  323,
-     323,  323,  323,  0,    323,  323,  323,  0,    323,  0,    0,    0,
-     323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
-     323,  323,  323,  0,    323,  323,  323,  323,  323,  323,  323,  0,
-     323,  323,  323,  0,    323,  0,    0,    0,    323,  323,  323,  323,
-     323,  323,  323,  0,    323,  323,  323,  0,    323,  0,    0,    0,
-     323,  323,  323,  0,    323,  0,    0,    0,    6,    0,    0,    0,
-     0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
-     1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-     1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    0,
-     1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-     1,    1,    1,    0,    1,    1,    1,    1,    1,    1,    1,    0,
-     1,    1,    1,    0,    1,    0,    0,    0,    1,    1,    1,    1,
-     1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    0,
-     1,    1,    1,    1,    1,    1,    1,    0,    1,    1,    1,    0,
-     1,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    0,
-     1,    1,    1,    0,    1,    0,    0,    0,    1,    1,    1,    0,
-     1,    0,    0,    0,    1,    0,    0,    0,    0,    0,    0,    0,
-     1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-     1,    1,    1,    0,    1,    1,    1,    1,    1,    1,    1,    0,
-     1,    1,    1,    0,    1,    0,    0,    0,    1,    1,    1,    1,
-     1,    1,    1,    0,    1,    1,    1,    0,    1,    0,    0,    0,
-     1,    1,    1,    0,    1,    0,    0,    0,    1,    0,    0,    0,
-     0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    0,
-     1,    1,    1,    0,    1,    0,    0,    0,    1,    1,    1,    0,
-     1,    0,    0,    0,    1,    0,    0,    0,    0,    0,    0,    0,
-     1,    1,    1,    0,    1,    0,    0,    0,    1,    0,    0,    0,
-     0,    0,    0,    0,    1,    0,    0,    0,    0,    0,    0,    0,
-     0,    0,    0,    0,    0,    0,    0,    0,
+#include <phevaluator/tables/flush.inc>
  };
\ No newline at end of file
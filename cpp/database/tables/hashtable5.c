@@ -17,519 +17,5 @@
  #include "tables.h"
 
  const short noflush5[6175] = {
-     11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600,
-     180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621,
-     3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611,
-     181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819,
-     205,  47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547,
-     1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381,
-     1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810,
-     1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733,
-     194,  2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,  215,
-     1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,
-     62,   15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689, 2482, 3768,
-     2603, 1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777,
-     3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,
-     1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230,
-     3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217,
-     4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63,   171,
-     2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635,
-     4436, 4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636, 4437, 4482,
-     2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,  227,  1940,
-     228,  1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953, 1962, 1970,
-     231,  71,   72,   73,   74,   75,   16,   1614, 2472, 1680, 28,   1624,
-     3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,   1633, 3338, 3558,
-     1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043,
-     2725, 1812, 1822, 1831, 52,   1641, 3346, 3566, 1707, 3391, 6195, 3611,
-     3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087,
-     1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878,
-     1888, 1897, 1905, 64,   1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793,
-     3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846,
-     3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278,
-     4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527,
-     2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76,
-     172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647,
-     2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657,
-     4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220,  2527,
-     4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754,
-     4782, 2945, 3018, 3019, 3020, 3021, 3022, 232,  239,  2006, 240,  2007,
-     2017, 241,  2008, 2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  2010,
-     2020, 2029, 2037, 2044, 244,  83,   84,   85,   86,   87,   88,   17,
-     1615, 2473, 1681, 29,   1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747,
-     1757, 41,   1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766,
-     2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53,   1642, 3347,
-     3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352,
-     6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737,
-     4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65,   1649, 3354, 3574,
-     1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687,
-     3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471,
-     6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439,
-     4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945,
-     1955, 1964, 1972, 1979, 77,   1655, 3360, 3580, 1721, 3405, 6209, 3625,
-     3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101,
-     1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240,
-     4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826,
-     7035, 4150, 6554, 6882, 7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590,
-     1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674,
-     4719, 4755, 4783, 2946, 4680, 4725, 4761, 4789, 4810, 3023, 2011, 2021,
-     2030, 2038, 2045, 2051, 89,   173,  2534, 2655, 185,  2535, 4866, 2656,
-     2765, 2766, 197,  2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866,
-     209,  2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952,
-     2953, 2954, 2955, 221,  2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931,
-     4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033,
-     233,  2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894,
-     4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096,
-     3097, 3098, 3099, 3100, 245,  251,  2072, 252,  2073, 2083, 253,  2074,
-     2084, 2093, 254,  2075, 2085, 2094, 2102, 255,  2076, 2086, 2095, 2103,
-     2110, 256,  2077, 2087, 2096, 2104, 2111, 2117, 257,  95,   96,   97,
-     98,   99,   100,  101,  18,   1616, 2474, 1682, 30,   1626, 3331, 3551,
-     1692, 2485, 3771, 2606, 1748, 1758, 42,   1635, 3340, 3560, 1701, 3385,
-     6189, 3605, 3780, 3825, 1767, 2496, 3991, 2617, 4000, 4045, 2727, 1814,
-     1824, 1833, 54,   1643, 3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833,
-     1775, 3429, 6233, 3649, 6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507,
-     4211, 2628, 4220, 4265, 2738, 4228, 4273, 4309, 2837, 1880, 1890, 1899,
-     1907, 66,   1650, 3355, 3575, 1716, 3400, 6204, 3620, 3795, 3840, 1782,
-     3436, 6240, 3656, 6360, 6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268,
-     3684, 6388, 6716, 3904, 6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344,
-     1914, 2518, 4431, 2639, 4440, 4485, 2749, 4448, 4493, 4529, 2848, 4455,
-     4500, 4536, 4564, 2936, 1946, 1956, 1965, 1973, 1980, 78,   1656, 3361,
-     3581, 1722, 3406, 6210, 3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366,
-     6694, 3882, 4021, 4066, 4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910,
-     6478, 6806, 7015, 4130, 4241, 4286, 4322, 4350, 1920, 3491, 6295, 3711,
-     6415, 6743, 3931, 6499, 6827, 7036, 4151, 6555, 6883, 7092, 7217, 4371,
-     4461, 4506, 4542, 4570, 4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760,
-     4668, 4713, 4749, 2859, 4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762,
-     4790, 4811, 3024, 2012, 2022, 2031, 2039, 2046, 2052, 90,   1661, 3366,
-     3586, 1727, 3411, 6215, 3631, 3806, 3851, 1793, 3447, 6251, 3667, 6371,
-     6699, 3887, 4026, 4071, 4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915,
-     6483, 6811, 7020, 4135, 4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716,
-     6420, 6748, 3936, 6504, 6832, 7041, 4156, 6560, 6888, 7097, 7222, 4376,
-     4466, 4511, 4547, 4575, 4596, 1991, 3511, 6315, 3731, 6435, 6763, 3951,
-     6519, 6847, 7056, 4171, 6575, 6903, 7112, 7237, 4391, 6610, 6938, 7147,
-     7272, 1604, 4611, 4686, 4731, 4767, 4795, 4816, 4831, 2057, 2540, 4871,
-     2661, 4880, 4925, 2771, 4888, 4933, 4969, 2870, 4895, 4940, 4976, 5004,
-     2958, 4901, 4946, 4982, 5010, 5031, 3035, 4906, 4951, 4987, 5015, 5036,
-     5051, 3101, 2078, 2088, 2097, 2105, 2112, 2118, 2123, 102,  174,  2545,
-     2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087, 2668, 5096,
-     5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097, 5142, 2779,
-     5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,  2549, 5089, 2670,
-     5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967,
-     3040, 3041, 3042, 3043, 3044, 234,  2550, 5090, 2671, 5099, 5144, 2781,
-     5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201,
-     5229, 5250, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246,  2551, 5091,
-     2672, 5100, 5145, 2782, 5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224,
-     2969, 5121, 5166, 5202, 5230, 5251, 3046, 5126, 5171, 5207, 5235, 5256,
-     5271, 3112, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 258,  263,  2138,
-     264,  2139, 2149, 265,  2140, 2150, 2159, 266,  2141, 2151, 2160, 2168,
-     267,  2142, 2152, 2161, 2169, 2176, 268,  2143, 2153, 2162, 2170, 2177,
-     2183, 269,  2144, 2154, 2163, 2171, 2178, 2184, 2189, 270,  107,  108,
-     109,  110,  111,  112,  113,  114,  19,   1617, 2475, 1683, 31,   1627,
-     3332, 3552, 1693, 2486, 3772, 2607, 1749, 1759, 43,   1636, 3341, 3561,
-     1702, 3386, 6190, 3606, 3781, 3826, 1768, 2497, 3992, 2618, 4001, 4046,
-     2728, 1815, 1825, 1834, 55,   1644, 3349, 3569, 1710, 3394, 6198, 3614,
-     3789, 3834, 1776, 3430, 6234, 3650, 6354, 6682, 3870, 4009, 4054, 4090,
-     1842, 2508, 4212, 2629, 4221, 4266, 2739, 4229, 4274, 4310, 2838, 1881,
-     1891, 1900, 1908, 67,   1651, 3356, 3576, 1717, 3401, 6205, 3621, 3796,
-     3841, 1783, 3437, 6241, 3657, 6361, 6689, 3877, 4016, 4061, 4097, 1849,
-     3465, 6269, 3685, 6389, 6717, 3905, 6473, 6801, 7010, 4125, 4236, 4281,
-     4317, 4345, 1915, 2519, 4432, 2640, 4441, 4486, 2750, 4449, 4494, 4530,
-     2849, 4456, 4501, 4537, 4565, 2937, 1947, 1957, 1966, 1974, 1981, 79,
-     1657, 3362, 3582, 1723, 3407, 6211, 3627, 3802, 3847, 1789, 3443, 6247,
-     3663, 6367, 6695, 3883, 4022, 4067, 4103, 1855, 3471, 6275, 3691, 6395,
-     6723, 3911, 6479, 6807, 7016, 4131, 4242, 4287, 4323, 4351, 1921, 3492,
-     6296, 3712, 6416, 6744, 3932, 6500, 6828, 7037, 4152, 6556, 6884, 7093,
-     7218, 4372, 4462, 4507, 4543, 4571, 4592, 1987, 2530, 4652, 2651, 4661,
-     4706, 2761, 4669, 4714, 4750, 2860, 4676, 4721, 4757, 4785, 2948, 4682,
-     4727, 4763, 4791, 4812, 3025, 2013, 2023, 2032, 2040, 2047, 2053, 91,
-     1662, 3367, 3587, 1728, 3412, 6216, 3632, 3807, 3852, 1794, 3448, 6252,
-     3668, 6372, 6700, 3888, 4027, 4072, 4108, 1860, 3476, 6280, 3696, 6400,
-     6728, 3916, 6484, 6812, 7021, 4136, 4247, 4292, 4328, 4356, 1926, 3497,
-     6301, 3717, 6421, 6749, 3937, 6505, 6833, 7042, 4157, 6561, 6889, 7098,
-     7223, 4377, 4467, 4512, 4548, 4576, 4597, 1992, 3512, 6316, 3732, 6436,
-     6764, 3952, 6520, 6848, 7057, 4172, 6576, 6904, 7113, 7238, 4392, 6611,
-     6939, 7148, 7273, 7342, 4612, 4687, 4732, 4768, 4796, 4817, 4832, 2058,
-     2541, 4872, 2662, 4881, 4926, 2772, 4889, 4934, 4970, 2871, 4896, 4941,
-     4977, 5005, 2959, 4902, 4947, 4983, 5011, 5032, 3036, 4907, 4952, 4988,
-     5016, 5037, 5052, 3102, 2079, 2089, 2098, 2106, 2113, 2119, 2124, 103,
-     1666, 3371, 3591, 1732, 3416, 6220, 3636, 3811, 3856, 1798, 3452, 6256,
-     3672, 6376, 6704, 3892, 4031, 4076, 4112, 1864, 3480, 6284, 3700, 6404,
-     6732, 3920, 6488, 6816, 7025, 4140, 4251, 4296, 4332, 4360, 1930, 3501,
-     6305, 3721, 6425, 6753, 3941, 6509, 6837, 7046, 4161, 6565, 6893, 7102,
-     7227, 4381, 4471, 4516, 4552, 4580, 4601, 1996, 3516, 6320, 3736, 6440,
-     6768, 3956, 6524, 6852, 7061, 4176, 6580, 6908, 7117, 7242, 4396, 6615,
-     6943, 7152, 7277, 7346, 4616, 4691, 4736, 4772, 4800, 4821, 4836, 2062,
-     3526, 6330, 3746, 6450, 6778, 3966, 6534, 6862, 7071, 4186, 6590, 6918,
-     7127, 7252, 4406, 6625, 6953, 7162, 7287, 7356, 4626, 6645, 6973, 7182,
-     7307, 7376, 1605, 4846, 4911, 4956, 4992, 5020, 5041, 5056, 5066, 2128,
-     2552, 5092, 2673, 5101, 5146, 2783, 5109, 5154, 5190, 2882, 5116, 5161,
-     5197, 5225, 2970, 5122, 5167, 5203, 5231, 5252, 3047, 5127, 5172, 5208,
-     5236, 5257, 5272, 3113, 5131, 5176, 5212, 5240, 5261, 5276, 5286, 3168,
-     2145, 2155, 2164, 2172, 2179, 2185, 2190, 2194, 115,  175,  2556, 2677,
-     187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361,
-     2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325,
-     5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2560, 5309, 2681, 5318,
-     5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051,
-     3052, 3053, 3054, 3055, 235,  2561, 5310, 2682, 5319, 5364, 2792, 5327,
-     5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449,
-     5470, 3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,  2562, 5311, 2683,
-     5320, 5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444, 2980,
-     5341, 5386, 5422, 5450, 5471, 3057, 5346, 5391, 5427, 5455, 5476, 5491,
-     3123, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 259,  2563, 5312, 2684,
-     5321, 5366, 2794, 5329, 5374, 5410, 2893, 5336, 5381, 5417, 5445, 2981,
-     5342, 5387, 5423, 5451, 5472, 3058, 5347, 5392, 5428, 5456, 5477, 5492,
-     3124, 5351, 5396, 5432, 5460, 5481, 5496, 5506, 3179, 3216, 3217, 3218,
-     3219, 3220, 3221, 3222, 3223, 271,  275,  2204, 276,  2205, 2215, 277,
-     2206, 2216, 2225, 278,  2207, 2217, 2226, 2234, 279,  2208, 2218, 2227,
-     2235, 2242, 280,  2209, 2219, 2228, 2236, 2243, 2249, 281,  2210, 2220,
-     2229, 2237, 2244, 2250, 2255, 282,  2211, 2221, 2230, 2238, 2245, 2251,
-     2256, 2260, 283,  119,  120,  121,  122,  123,  124,  125,  126,  127,
-     20,   1618, 2476, 1684, 32,   1628, 3333, 3553, 1694, 2487, 3773, 2608,
-     1750, 1760, 44,   1637, 3342, 3562, 1703, 3387, 6191, 3607, 3782, 3827,
-     1769, 2498, 3993, 2619, 4002, 4047, 2729, 1816, 1826, 1835, 56,   1645,
-     3350, 3570, 1711, 3395, 6199, 3615, 3790, 3835, 1777, 3431, 6235, 3651,
-     6355, 6683, 3871, 4010, 4055, 4091, 1843, 2509, 4213, 2630, 4222, 4267,
-     2740, 4230, 4275, 4311, 2839, 1882, 1892, 1901, 1909, 68,   1652, 3357,
-     3577, 1718, 3402, 6206, 3622, 3797, 3842, 1784, 3438, 6242, 3658, 6362,
-     6690, 3878, 4017, 4062, 4098, 1850, 3466, 6270, 3686, 6390, 6718, 3906,
-     6474, 6802, 7011, 4126, 4237, 4282, 4318, 4346, 1916, 2520, 4433, 2641,
-     4442, 4487, 2751, 4450, 4495, 4531, 2850, 4457, 4502, 4538, 4566, 2938,
-     1948, 1958, 1967, 1975, 1982, 80,   1658, 3363, 3583, 1724, 3408, 6212,
-     3628, 3803, 3848, 1790, 3444, 6248, 3664, 6368, 6696, 3884, 4023, 4068,
-     4104, 1856, 3472, 6276, 3692, 6396, 6724, 3912, 6480, 6808, 7017, 4132,
-     4243, 4288, 4324, 4352, 1922, 3493, 6297, 3713, 6417, 6745, 3933, 6501,
-     6829, 7038, 4153, 6557, 6885, 7094, 7219, 4373, 4463, 4508, 4544, 4572,
-     4593, 1988, 2531, 4653, 2652, 4662, 4707, 2762, 4670, 4715, 4751, 2861,
-     4677, 4722, 4758, 4786, 2949, 4683, 4728, 4764, 4792, 4813, 3026, 2014,
-     2024, 2033, 2041, 2048, 2054, 92,   1663, 3368, 3588, 1729, 3413, 6217,
-     3633, 3808, 3853, 1795, 3449, 6253, 3669, 6373, 6701, 3889, 4028, 4073,
-     4109, 1861, 3477, 6281, 3697, 6401, 6729, 3917, 6485, 6813, 7022, 4137,
-     4248, 4293, 4329, 4357, 1927, 3498, 6302, 3718, 6422, 6750, 3938, 6506,
-     6834, 7043, 4158, 6562, 6890, 7099, 7224, 4378, 4468, 4513, 4549, 4577,
-     4598, 1993, 3513, 6317, 3733, 6437, 6765, 3953, 6521, 6849, 7058, 4173,
-     6577, 6905, 7114, 7239, 4393, 6612, 6940, 7149, 7274, 7343, 4613, 4688,
-     4733, 4769, 4797, 4818, 4833, 2059, 2542, 4873, 2663, 4882, 4927, 2773,
-     4890, 4935, 4971, 2872, 4897, 4942, 4978, 5006, 2960, 4903, 4948, 4984,
-     5012, 5033, 3037, 4908, 4953, 4989, 5017, 5038, 5053, 3103, 2080, 2090,
-     2099, 2107, 2114, 2120, 2125, 104,  1667, 3372, 3592, 1733, 3417, 6221,
-     3637, 3812, 3857, 1799, 3453, 6257, 3673, 6377, 6705, 3893, 4032, 4077,
-     4113, 1865, 3481, 6285, 3701, 6405, 6733, 3921, 6489, 6817, 7026, 4141,
-     4252, 4297, 4333, 4361, 1931, 3502, 6306, 3722, 6426, 6754, 3942, 6510,
-     6838, 7047, 4162, 6566, 6894, 7103, 7228, 4382, 4472, 4517, 4553, 4581,
-     4602, 1997, 3517, 6321, 3737, 6441, 6769, 3957, 6525, 6853, 7062, 4177,
-     6581, 6909, 7118, 7243, 4397, 6616, 6944, 7153, 7278, 7347, 4617, 4692,
-     4737, 4773, 4801, 4822, 4837, 2063, 3527, 6331, 3747, 6451, 6779, 3967,
-     6535, 6863, 7072, 4187, 6591, 6919, 7128, 7253, 4407, 6626, 6954, 7163,
-     7288, 7357, 4627, 6646, 6974, 7183, 7308, 7377, 7411, 4847, 4912, 4957,
-     4993, 5021, 5042, 5057, 5067, 2129, 2553, 5093, 2674, 5102, 5147, 2784,
-     5110, 5155, 5191, 2883, 5117, 5162, 5198, 5226, 2971, 5123, 5168, 5204,
-     5232, 5253, 3048, 5128, 5173, 5209, 5237, 5258, 5273, 3114, 5132, 5177,
-     5213, 5241, 5262, 5277, 5287, 3169, 2146, 2156, 2165, 2173, 2180, 2186,
-     2191, 2195, 116,  1670, 3375, 3595, 1736, 3420, 6224, 3640, 3815, 3860,
-     1802, 3456, 6260, 3676, 6380, 6708, 3896, 4035, 4080, 4116, 1868, 3484,
-     6288, 3704, 6408, 6736, 3924, 6492, 6820, 7029, 4144, 4255, 4300, 4336,
-     4364, 1934, 3505, 6309, 3725, 6429, 6757, 3945, 6513, 6841, 7050, 4165,
-     6569, 6897, 7106, 7231, 4385, 4475, 4520, 4556, 4584, 4605, 2000, 3520,
-     6324, 3740, 6444, 6772, 3960, 6528, 6856, 7065, 4180, 6584, 6912, 7121,
-     7246, 4400, 6619, 6947, 7156, 7281, 7350, 4620, 4695, 4740, 4776, 4804,
-     4825, 4840, 2066, 3530, 6334, 3750, 6454, 6782, 3970, 6538, 6866, 7075,
-     4190, 6594, 6922, 7131, 7256, 4410, 6629, 6957, 7166, 7291, 7360, 4630,
-     6649, 6977, 7186, 7311, 7380, 7414, 4850, 4915, 4960, 4996, 5024, 5045,
-     5060, 5070, 2132, 3536, 6340, 3756, 6460, 6788, 3976, 6544, 6872, 7081,
-     4196, 6600, 6928, 7137, 7262, 4416, 6635, 6963, 7172, 7297, 7366, 4636,
-     6655, 6983, 7192, 7317, 7386, 7420, 4856, 6665, 6993, 7202, 7327, 7396,
-     7430, 1606, 5076, 5135, 5180, 5216, 5244, 5265, 5280, 5290, 5296, 2198,
-     2564, 5313, 2685, 5322, 5367, 2795, 5330, 5375, 5411, 2894, 5337, 5382,
-     5418, 5446, 2982, 5343, 5388, 5424, 5452, 5473, 3059, 5348, 5393, 5429,
-     5457, 5478, 5493, 3125, 5352, 5397, 5433, 5461, 5482, 5497, 5507, 3180,
-     5355, 5400, 5436, 5464, 5485, 5500, 5510, 5516, 3224, 2212, 2222, 2231,
-     2239, 2246, 2252, 2257, 2261, 2264, 128,  176,  2567, 2688, 188,  2568,
-     5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800, 2897,
-     2898, 2899, 212,  2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626,
-     2900, 2985, 2986, 2987, 2988, 224,  2571, 5529, 2692, 5538, 5583, 2802,
-     5546, 5591, 5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064,
-     3065, 3066, 236,  2572, 5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628,
-     2902, 5554, 5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067,
-     3128, 3129, 3130, 3131, 3132, 3133, 248,  2573, 5531, 2694, 5540, 5585,
-     2804, 5548, 5593, 5629, 2903, 5555, 5600, 5636, 5664, 2991, 5561, 5606,
-     5642, 5670, 5691, 3068, 5566, 5611, 5647, 5675, 5696, 5711, 3134, 3183,
-     3184, 3185, 3186, 3187, 3188, 3189, 260,  2574, 5532, 2695, 5541, 5586,
-     2805, 5549, 5594, 5630, 2904, 5556, 5601, 5637, 5665, 2992, 5562, 5607,
-     5643, 5671, 5692, 3069, 5567, 5612, 5648, 5676, 5697, 5712, 3135, 5571,
-     5616, 5652, 5680, 5701, 5716, 5726, 3190, 3227, 3228, 3229, 3230, 3231,
-     3232, 3233, 3234, 272,  2575, 5533, 2696, 5542, 5587, 2806, 5550, 5595,
-     5631, 2905, 5557, 5602, 5638, 5666, 2993, 5563, 5608, 5644, 5672, 5693,
-     3070, 5568, 5613, 5649, 5677, 5698, 5713, 3136, 5572, 5617, 5653, 5681,
-     5702, 5717, 5727, 3191, 5575, 5620, 5656, 5684, 5705, 5720, 5730, 5736,
-     3235, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 3268, 284,  287,
-     2270, 288,  2271, 2281, 289,  2272, 2282, 2291, 290,  2273, 2283, 2292,
-     2300, 291,  2274, 2284, 2293, 2301, 2308, 292,  2275, 2285, 2294, 2302,
-     2309, 2315, 293,  2276, 2286, 2295, 2303, 2310, 2316, 2321, 294,  2277,
-     2287, 2296, 2304, 2311, 2317, 2322, 2326, 295,  2278, 2288, 2297, 2305,
-     2312, 2318, 2323, 2327, 2330, 296,  131,  132,  133,  134,  135,  136,
-     137,  138,  139,  140,  21,   1619, 2477, 1685, 33,   1629, 3334, 3554,
-     1695, 2488, 3774, 2609, 1751, 1761, 45,   1638, 3343, 3563, 1704, 3388,
-     6192, 3608, 3783, 3828, 1770, 2499, 3994, 2620, 4003, 4048, 2730, 1817,
-     1827, 1836, 57,   1646, 3351, 3571, 1712, 3396, 6200, 3616, 3791, 3836,
-     1778, 3432, 6236, 3652, 6356, 6684, 3872, 4011, 4056, 4092, 1844, 2510,
-     4214, 2631, 4223, 4268, 2741, 4231, 4276, 4312, 2840, 1883, 1893, 1902,
-     1910, 69,   1653, 3358, 3578, 1719, 3403, 6207, 3623, 3798, 3843, 1785,
-     3439, 6243, 3659, 6363, 6691, 3879, 4018, 4063, 4099, 1851, 3467, 6271,
-     3687, 6391, 6719, 3907, 6475, 6803, 7012, 4127, 4238, 4283, 4319, 4347,
-     1917, 2521, 4434, 2642, 4443, 4488, 2752, 4451, 4496, 4532, 2851, 4458,
-     4503, 4539, 4567, 2939, 1949, 1959, 1968, 1976, 1983, 81,   1659, 3364,
-     3584, 1725, 3409, 6213, 3629, 3804, 3849, 1791, 3445, 6249, 3665, 6369,
-     6697, 3885, 4024, 4069, 4105, 1857, 3473, 6277, 3693, 6397, 6725, 3913,
-     6481, 6809, 7018, 4133, 4244, 4289, 4325, 4353, 1923, 3494, 6298, 3714,
-     6418, 6746, 3934, 6502, 6830, 7039, 4154, 6558, 6886, 7095, 7220, 4374,
-     4464, 4509, 4545, 4573, 4594, 1989, 2532, 4654, 2653, 4663, 4708, 2763,
-     4671, 4716, 4752, 2862, 4678, 4723, 4759, 4787, 2950, 4684, 4729, 4765,
-     4793, 4814, 3027, 2015, 2025, 2034, 2042, 2049, 2055, 93,   1664, 3369,
-     3589, 1730, 3414, 6218, 3634, 3809, 3854, 1796, 3450, 6254, 3670, 6374,
-     6702, 3890, 4029, 4074, 4110, 1862, 3478, 6282, 3698, 6402, 6730, 3918,
-     6486, 6814, 7023, 4138, 4249, 4294, 4330, 4358, 1928, 3499, 6303, 3719,
-     6423, 6751, 3939, 6507, 6835, 7044, 4159, 6563, 6891, 7100, 7225, 4379,
-     4469, 4514, 4550, 4578, 4599, 1994, 3514, 6318, 3734, 6438, 6766, 3954,
-     6522, 6850, 7059, 4174, 6578, 6906, 7115, 7240, 4394, 6613, 6941, 7150,
-     7275, 7344, 4614, 4689, 4734, 4770, 4798, 4819, 4834, 2060, 2543, 4874,
-     2664, 4883, 4928, 2774, 4891, 4936, 4972, 2873, 4898, 4943, 4979, 5007,
-     2961, 4904, 4949, 4985, 5013, 5034, 3038, 4909, 4954, 4990, 5018, 5039,
-     5054, 3104, 2081, 2091, 2100, 2108, 2115, 2121, 2126, 105,  1668, 3373,
-     3593, 1734, 3418, 6222, 3638, 3813, 3858, 1800, 3454, 6258, 3674, 6378,
-     6706, 3894, 4033, 4078, 4114, 1866, 3482, 6286, 3702, 6406, 6734, 3922,
-     6490, 6818, 7027, 4142, 4253, 4298, 4334, 4362, 1932, 3503, 6307, 3723,
-     6427, 6755, 3943, 6511, 6839, 7048, 4163, 6567, 6895, 7104, 7229, 4383,
-     4473, 4518, 4554, 4582, 4603, 1998, 3518, 6322, 3738, 6442, 6770, 3958,
-     6526, 6854, 7063, 4178, 6582, 6910, 7119, 7244, 4398, 6617, 6945, 7154,
-     7279, 7348, 4618, 4693, 4738, 4774, 4802, 4823, 4838, 2064, 3528, 6332,
-     3748, 6452, 6780, 3968, 6536, 6864, 7073, 4188, 6592, 6920, 7129, 7254,
-     4408, 6627, 6955, 7164, 7289, 7358, 4628, 6647, 6975, 7184, 7309, 7378,
-     7412, 4848, 4913, 4958, 4994, 5022, 5043, 5058, 5068, 2130, 2554, 5094,
-     2675, 5103, 5148, 2785, 5111, 5156, 5192, 2884, 5118, 5163, 5199, 5227,
-     2972, 5124, 5169, 5205, 5233, 5254, 3049, 5129, 5174, 5210, 5238, 5259,
-     5274, 3115, 5133, 5178, 5214, 5242, 5263, 5278, 5288, 3170, 2147, 2157,
-     2166, 2174, 2181, 2187, 2192, 2196, 117,  1671, 3376, 3596, 1737, 3421,
-     6225, 3641, 3816, 3861, 1803, 3457, 6261, 3677, 6381, 6709, 3897, 4036,
-     4081, 4117, 1869, 3485, 6289, 3705, 6409, 6737, 3925, 6493, 6821, 7030,
-     4145, 4256, 4301, 4337, 4365, 1935, 3506, 6310, 3726, 6430, 6758, 3946,
-     6514, 6842, 7051, 4166, 6570, 6898, 7107, 7232, 4386, 4476, 4521, 4557,
-     4585, 4606, 2001, 3521, 6325, 3741, 6445, 6773, 3961, 6529, 6857, 7066,
-     4181, 6585, 6913, 7122, 7247, 4401, 6620, 6948, 7157, 7282, 7351, 4621,
-     4696, 4741, 4777, 4805, 4826, 4841, 2067, 3531, 6335, 3751, 6455, 6783,
-     3971, 6539, 6867, 7076, 4191, 6595, 6923, 7132, 7257, 4411, 6630, 6958,
-     7167, 7292, 7361, 4631, 6650, 6978, 7187, 7312, 7381, 7415, 4851, 4916,
-     4961, 4997, 5025, 5046, 5061, 5071, 2133, 3537, 6341, 3757, 6461, 6789,
-     3977, 6545, 6873, 7082, 4197, 6601, 6929, 7138, 7263, 4417, 6636, 6964,
-     7173, 7298, 7367, 4637, 6656, 6984, 7193, 7318, 7387, 7421, 4857, 6666,
-     6994, 7203, 7328, 7397, 7431, 7445, 5077, 5136, 5181, 5217, 5245, 5266,
-     5281, 5291, 5297, 2199, 2565, 5314, 2686, 5323, 5368, 2796, 5331, 5376,
-     5412, 2895, 5338, 5383, 5419, 5447, 2983, 5344, 5389, 5425, 5453, 5474,
-     3060, 5349, 5394, 5430, 5458, 5479, 5494, 3126, 5353, 5398, 5434, 5462,
-     5483, 5498, 5508, 3181, 5356, 5401, 5437, 5465, 5486, 5501, 5511, 5517,
-     3225, 2213, 2223, 2232, 2240, 2247, 2253, 2258, 2262, 2265, 129,  1673,
-     3378, 3598, 1739, 3423, 6227, 3643, 3818, 3863, 1805, 3459, 6263, 3679,
-     6383, 6711, 3899, 4038, 4083, 4119, 1871, 3487, 6291, 3707, 6411, 6739,
-     3927, 6495, 6823, 7032, 4147, 4258, 4303, 4339, 4367, 1937, 3508, 6312,
-     3728, 6432, 6760, 3948, 6516, 6844, 7053, 4168, 6572, 6900, 7109, 7234,
-     4388, 4478, 4523, 4559, 4587, 4608, 2003, 3523, 6327, 3743, 6447, 6775,
-     3963, 6531, 6859, 7068, 4183, 6587, 6915, 7124, 7249, 4403, 6622, 6950,
-     7159, 7284, 7353, 4623, 4698, 4743, 4779, 4807, 4828, 4843, 2069, 3533,
-     6337, 3753, 6457, 6785, 3973, 6541, 6869, 7078, 4193, 6597, 6925, 7134,
-     7259, 4413, 6632, 6960, 7169, 7294, 7363, 4633, 6652, 6980, 7189, 7314,
-     7383, 7417, 4853, 4918, 4963, 4999, 5027, 5048, 5063, 5073, 2135, 3539,
-     6343, 3759, 6463, 6791, 3979, 6547, 6875, 7084, 4199, 6603, 6931, 7140,
-     7265, 4419, 6638, 6966, 7175, 7300, 7369, 4639, 6658, 6986, 7195, 7320,
-     7389, 7423, 4859, 6668, 6996, 7205, 7330, 7399, 7433, 7447, 5079, 5138,
-     5183, 5219, 5247, 5268, 5283, 5293, 5299, 2201, 3542, 6346, 3762, 6466,
-     6794, 3982, 6550, 6878, 7087, 4202, 6606, 6934, 7143, 7268, 4422, 6641,
-     6969, 7178, 7303, 7372, 4642, 6661, 6989, 7198, 7323, 7392, 7426, 4862,
-     6671, 6999, 7208, 7333, 7402, 7436, 7450, 5082, 6675, 7003, 7212, 7337,
-     7406, 7440, 7454, 1607, 5302, 5358, 5403, 5439, 5467, 5488, 5503, 5513,
-     5519, 5522, 2267, 2576, 5534, 2697, 5543, 5588, 2807, 5551, 5596, 5632,
-     2906, 5558, 5603, 5639, 5667, 2994, 5564, 5609, 5645, 5673, 5694, 3071,
-     5569, 5614, 5650, 5678, 5699, 5714, 3137, 5573, 5618, 5654, 5682, 5703,
-     5718, 5728, 3192, 5576, 5621, 5657, 5685, 5706, 5721, 5731, 5737, 3236,
-     5578, 5623, 5659, 5687, 5708, 5723, 5733, 5739, 5742, 3269, 2279, 2289,
-     2298, 2306, 2313, 2319, 2324, 2328, 2331, 2333, 141,  177,  2578, 2699,
-     189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756, 5801,
-     2811, 2908, 2909, 2910, 213,  2581, 5748, 2702, 5757, 5802, 2812, 5765,
-     5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,  2582, 5749, 2703, 5758,
-     5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073,
-     3074, 3075, 3076, 3077, 237,  2583, 5750, 2704, 5759, 5804, 2814, 5767,
-     5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825, 5861, 5889,
-     5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249,  2584, 5751, 2705,
-     5760, 5805, 2815, 5768, 5813, 5849, 2914, 5775, 5820, 5856, 5884, 3002,
-     5781, 5826, 5862, 5890, 5911, 3079, 5786, 5831, 5867, 5895, 5916, 5931,
-     3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 261,  2585, 5752, 2706,
-     5761, 5806, 2816, 5769, 5814, 5850, 2915, 5776, 5821, 5857, 5885, 3003,
-     5782, 5827, 5863, 5891, 5912, 3080, 5787, 5832, 5868, 5896, 5917, 5932,
-     3146, 5791, 5836, 5872, 5900, 5921, 5936, 5946, 3201, 3238, 3239, 3240,
-     3241, 3242, 3243, 3244, 3245, 273,  2586, 5753, 2707, 5762, 5807, 2817,
-     5770, 5815, 5851, 2916, 5777, 5822, 5858, 5886, 3004, 5783, 5828, 5864,
-     5892, 5913, 3081, 5788, 5833, 5869, 5897, 5918, 5933, 3147, 5792, 5837,
-     5873, 5901, 5922, 5937, 5947, 3202, 5795, 5840, 5876, 5904, 5925, 5940,
-     5950, 5956, 3246, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279,
-     285,  2587, 5754, 2708, 5763, 5808, 2818, 5771, 5816, 5852, 2917, 5778,
-     5823, 5859, 5887, 3005, 5784, 5829, 5865, 5893, 5914, 3082, 5789, 5834,
-     5870, 5898, 5919, 5934, 3148, 5793, 5838, 5874, 5902, 5923, 5938, 5948,
-     3203, 5796, 5841, 5877, 5905, 5926, 5941, 5951, 5957, 3247, 5798, 5843,
-     5879, 5907, 5928, 5943, 5953, 5959, 5962, 3280, 3293, 3294, 3295, 3296,
-     3297, 3298, 3299, 3300, 3301, 3302, 297,  299,  2336, 300,  2337, 2347,
-     301,  2338, 2348, 2357, 302,  2339, 2349, 2358, 2366, 303,  2340, 2350,
-     2359, 2367, 2374, 304,  2341, 2351, 2360, 2368, 2375, 2381, 305,  2342,
-     2352, 2361, 2369, 2376, 2382, 2387, 306,  2343, 2353, 2362, 2370, 2377,
-     2383, 2388, 2392, 307,  2344, 2354, 2363, 2371, 2378, 2384, 2389, 2393,
-     2396, 308,  2345, 2355, 2364, 2372, 2379, 2385, 2390, 2394, 2397, 2399,
-     309,  143,  144,  145,  146,  147,  148,  149,  150,  151,  152,  153,
-     22,   1620, 2478, 1686, 34,   1630, 3335, 3555, 1696, 2489, 3775, 2610,
-     1752, 1762, 46,   1639, 3344, 3564, 1705, 3389, 6193, 3609, 3784, 3829,
-     1771, 2500, 3995, 2621, 4004, 4049, 2731, 1818, 1828, 1837, 58,   1647,
-     3352, 3572, 1713, 3397, 6201, 3617, 3792, 3837, 1779, 3433, 6237, 3653,
-     6357, 6685, 3873, 4012, 4057, 4093, 1845, 2511, 4215, 2632, 4224, 4269,
-     2742, 4232, 4277, 4313, 2841, 1884, 1894, 1903, 1911, 70,   1654, 3359,
-     3579, 1720, 3404, 6208, 3624, 3799, 3844, 1786, 3440, 6244, 3660, 6364,
-     6692, 3880, 4019, 4064, 4100, 1852, 3468, 6272, 3688, 6392, 6720, 3908,
-     6476, 6804, 7013, 4128, 4239, 4284, 4320, 4348, 1918, 2522, 4435, 2643,
-     4444, 4489, 2753, 4452, 4497, 4533, 2852, 4459, 4504, 4540, 4568, 2940,
-     1950, 1960, 1969, 1977, 1984, 82,   1660, 3365, 3585, 1726, 3410, 6214,
-     3630, 3805, 3850, 1792, 3446, 6250, 3666, 6370, 6698, 3886, 4025, 4070,
-     4106, 1858, 3474, 6278, 3694, 6398, 6726, 3914, 6482, 6810, 7019, 4134,
-     4245, 4290, 4326, 4354, 1924, 3495, 6299, 3715, 6419, 6747, 3935, 6503,
-     6831, 7040, 4155, 6559, 6887, 7096, 7221, 4375, 4465, 4510, 4546, 4574,
-     4595, 1990, 2533, 4655, 2654, 4664, 4709, 2764, 4672, 4717, 4753, 2863,
-     4679, 4724, 4760, 4788, 2951, 4685, 4730, 4766, 4794, 4815, 3028, 2016,
-     2026, 2035, 2043, 2050, 2056, 94,   1665, 3370, 3590, 1731, 3415, 6219,
-     3635, 3810, 3855, 1797, 3451, 6255, 3671, 6375, 6703, 3891, 4030, 4075,
-     4111, 1863, 3479, 6283, 3699, 6403, 6731, 3919, 6487, 6815, 7024, 4139,
-     4250, 4295, 4331, 4359, 1929, 3500, 6304, 3720, 6424, 6752, 3940, 6508,
-     6836, 7045, 4160, 6564, 6892, 7101, 7226, 4380, 4470, 4515, 4551, 4579,
-     4600, 1995, 3515, 6319, 3735, 6439, 6767, 3955, 6523, 6851, 7060, 4175,
-     6579, 6907, 7116, 7241, 4395, 6614, 6942, 7151, 7276, 7345, 4615, 4690,
-     4735, 4771, 4799, 4820, 4835, 2061, 2544, 4875, 2665, 4884, 4929, 2775,
-     4892, 4937, 4973, 2874, 4899, 4944, 4980, 5008, 2962, 4905, 4950, 4986,
-     5014, 5035, 3039, 4910, 4955, 4991, 5019, 5040, 5055, 3105, 2082, 2092,
-     2101, 2109, 2116, 2122, 2127, 106,  1669, 3374, 3594, 1735, 3419, 6223,
-     3639, 3814, 3859, 1801, 3455, 6259, 3675, 6379, 6707, 3895, 4034, 4079,
-     4115, 1867, 3483, 6287, 3703, 6407, 6735, 3923, 6491, 6819, 7028, 4143,
-     4254, 4299, 4335, 4363, 1933, 3504, 6308, 3724, 6428, 6756, 3944, 6512,
-     6840, 7049, 4164, 6568, 6896, 7105, 7230, 4384, 4474, 4519, 4555, 4583,
-     4604, 1999, 3519, 6323, 3739, 6443, 6771, 3959, 6527, 6855, 7064, 4179,
-     6583, 6911, 7120, 7245, 4399, 6618, 6946, 7155, 7280, 7349, 4619, 4694,
-     4739, 4775, 4803, 4824, 4839, 2065, 3529, 6333, 3749, 6453, 6781, 3969,
-     6537, 6865, 7074, 4189, 6593, 6921, 7130, 7255, 4409, 6628, 6956, 7165,
-     7290, 7359, 4629, 6648, 6976, 7185, 7310, 7379, 7413, 4849, 4914, 4959,
-     4995, 5023, 5044, 5059, 5069, 2131, 2555, 5095, 2676, 5104, 5149, 2786,
-     5112, 5157, 5193, 2885, 5119, 5164, 5200, 5228, 2973, 5125, 5170, 5206,
-     5234, 5255, 3050, 5130, 5175, 5211, 5239, 5260, 5275, 3116, 5134, 5179,
-     5215, 5243, 5264, 5279, 5289, 3171, 2148, 2158, 2167, 2175, 2182, 2188,
-     2193, 2197, 118,  1672, 3377, 3597, 1738, 3422, 6226, 3642, 3817, 3862,
-     1804, 3458, 6262, 3678, 6382, 6710, 3898, 4037, 4082, 4118, 1870, 3486,
-     6290, 3706, 6410, 6738, 3926, 6494, 6822, 7031, 4146, 4257, 4302, 4338,
-     4366, 1936, 3507, 6311, 3727, 6431, 6759, 3947, 6515, 6843, 7052, 4167,
-     6571, 6899, 7108, 7233, 4387, 4477, 4522, 4558, 4586, 4607, 2002, 3522,
-     6326, 3742, 6446, 6774, 3962, 6530, 6858, 7067, 4182, 6586, 6914, 7123,
-     7248, 4402, 6621, 6949, 7158, 7283, 7352, 4622, 4697, 4742, 4778, 4806,
-     4827, 4842, 2068, 3532, 6336, 3752, 6456, 6784, 3972, 6540, 6868, 7077,
-     4192, 6596, 6924, 7133, 7258, 4412, 6631, 6959, 7168, 7293, 7362, 4632,
-     6651, 6979, 7188, 7313, 7382, 7416, 4852, 4917, 4962, 4998, 5026, 5047,
-     5062, 5072, 2134, 3538, 6342, 3758, 6462, 6790, 3978, 6546, 6874, 7083,
-     4198, 6602, 6930, 7139, 7264, 4418, 6637, 6965, 7174, 7299, 7368, 4638,
-     6657, 6985, 7194, 7319, 7388, 7422, 4858, 6667, 6995, 7204, 7329, 7398,
-     7432, 7446, 5078, 5137, 5182, 5218, 5246, 5267, 5282, 5292, 5298, 2200,
-     2566, 5315, 2687, 5324, 5369, 2797, 5332, 5377, 5413, 2896, 5339, 5384,
-     5420, 5448, 2984, 5345, 5390, 5426, 5454, 5475, 3061, 5350, 5395, 5431,
-     5459, 5480, 5495, 3127, 5354, 5399, 5435, 5463, 5484, 5499, 5509, 3182,
-     5357, 5402, 5438, 5466, 5487, 5502, 5512, 5518, 3226, 2214, 2224, 2233,
-     2241, 2248, 2254, 2259, 2263, 2266, 130,  1674, 3379, 3599, 1740, 3424,
-     6228, 3644, 3819, 3864, 1806, 3460, 6264, 3680, 6384, 6712, 3900, 4039,
-     4084, 4120, 1872, 3488, 6292, 3708, 6412, 6740, 3928, 6496, 6824, 7033,
-     4148, 4259, 4304, 4340, 4368, 1938, 3509, 6313, 3729, 6433, 6761, 3949,
-     6517, 6845, 7054, 4169, 6573, 6901, 7110, 7235, 4389, 4479, 4524, 4560,
-     4588, 4609, 2004, 3524, 6328, 3744, 6448, 6776, 3964, 6532, 6860, 7069,
-     4184, 6588, 6916, 7125, 7250, 4404, 6623, 6951, 7160, 7285, 7354, 4624,
-     4699, 4744, 4780, 4808, 4829, 4844, 2070, 3534, 6338, 3754, 6458, 6786,
-     3974, 6542, 6870, 7079, 4194, 6598, 6926, 7135, 7260, 4414, 6633, 6961,
-     7170, 7295, 7364, 4634, 6653, 6981, 7190, 7315, 7384, 7418, 4854, 4919,
-     4964, 5000, 5028, 5049, 5064, 5074, 2136, 3540, 6344, 3760, 6464, 6792,
-     3980, 6548, 6876, 7085, 4200, 6604, 6932, 7141, 7266, 4420, 6639, 6967,
-     7176, 7301, 7370, 4640, 6659, 6987, 7196, 7321, 7390, 7424, 4860, 6669,
-     6997, 7206, 7331, 7400, 7434, 7448, 5080, 5139, 5184, 5220, 5248, 5269,
-     5284, 5294, 5300, 2202, 3543, 6347, 3763, 6467, 6795, 3983, 6551, 6879,
-     7088, 4203, 6607, 6935, 7144, 7269, 4423, 6642, 6970, 7179, 7304, 7373,
-     4643, 6662, 6990, 7199, 7324, 7393, 7427, 4863, 6672, 7000, 7209, 7334,
-     7403, 7437, 7451, 5083, 6676, 7004, 7213, 7338, 7407, 7441, 7455, 7459,
-     5303, 5359, 5404, 5440, 5468, 5489, 5504, 5514, 5520, 5523, 2268, 2577,
-     5535, 2698, 5544, 5589, 2808, 5552, 5597, 5633, 2907, 5559, 5604, 5640,
-     5668, 2995, 5565, 5610, 5646, 5674, 5695, 3072, 5570, 5615, 5651, 5679,
-     5700, 5715, 3138, 5574, 5619, 5655, 5683, 5704, 5719, 5729, 3193, 5577,
-     5622, 5658, 5686, 5707, 5722, 5732, 5738, 3237, 5579, 5624, 5660, 5688,
-     5709, 5724, 5734, 5740, 5743, 3270, 2280, 2290, 2299, 2307, 2314, 2320,
-     2325, 2329, 2332, 2334, 142,  1675, 3380, 3600, 1741, 3425, 6229, 3645,
-     3820, 3865, 1807, 3461, 6265, 3681, 6385, 6713, 3901, 4040, 4085, 4121,
-     1873, 3489, 6293, 3709, 6413, 6741, 3929, 6497, 6825, 7034, 4149, 4260,
-     4305, 4341, 4369, 1939, 3510, 6314, 3730, 6434, 6762, 3950, 6518, 6846,
-     7055, 4170, 6574, 6902, 7111, 7236, 4390, 4480, 4525, 4561, 4589, 4610,
-     2005, 3525, 6329, 3745, 6449, 6777, 3965, 6533, 6861, 7070, 4185, 6589,
-     6917, 7126, 7251, 4405, 6624, 6952, 7161, 7286, 7355, 4625, 4700, 4745,
-     4781, 4809, 4830, 4845, 2071, 3535, 6339, 3755, 6459, 6787, 3975, 6543,
-     6871, 7080, 4195, 6599, 6927, 7136, 7261, 4415, 6634, 6962, 7171, 7296,
-     7365, 4635, 6654, 6982, 7191, 7316, 7385, 7419, 4855, 4920, 4965, 5001,
-     5029, 5050, 5065, 5075, 2137, 3541, 6345, 3761, 6465, 6793, 3981, 6549,
-     6877, 7086, 4201, 6605, 6933, 7142, 7267, 4421, 6640, 6968, 7177, 7302,
-     7371, 4641, 6660, 6988, 7197, 7322, 7391, 7425, 4861, 6670, 6998, 7207,
-     7332, 7401, 7435, 7449, 5081, 5140, 5185, 5221, 5249, 5270, 5285, 5295,
-     5301, 2203, 3544, 6348, 3764, 6468, 6796, 3984, 6552, 6880, 7089, 4204,
-     6608, 6936, 7145, 7270, 4424, 6643, 6971, 7180, 7305, 7374, 4644, 6663,
-     6991, 7200, 7325, 7394, 7428, 4864, 6673, 7001, 7210, 7335, 7404, 7438,
-     7452, 5084, 6677, 7005, 7214, 7339, 7408, 7442, 7456, 7460, 5304, 5360,
-     5405, 5441, 5469, 5490, 5505, 5515, 5521, 5524, 2269, 3545, 6349, 3765,
-     6469, 6797, 3985, 6553, 6881, 7090, 4205, 6609, 6937, 7146, 7271, 4425,
-     6644, 6972, 7181, 7306, 7375, 4645, 6664, 6992, 7201, 7326, 7395, 7429,
-     4865, 6674, 7002, 7211, 7336, 7405, 7439, 7453, 5085, 6678, 7006, 7215,
-     7340, 7409, 7443, 7457, 7461, 5305, 1609, 7007, 7216, 7341, 7410, 7444,
-     7458, 7462, 1608, 5525, 5580, 5625, 5661, 5689, 5710, 5725, 5735, 5741,
-     5744, 5745, 2335, 2588, 5755, 2709, 5764, 5809, 2819, 5772, 5817, 5853,
-     2918, 5779, 5824, 5860, 5888, 3006, 5785, 5830, 5866, 5894, 5915, 3083,
-     5790, 5835, 5871, 5899, 5920, 5935, 3149, 5794, 5839, 5875, 5903, 5924,
-     5939, 5949, 3204, 5797, 5842, 5878, 5906, 5927, 5942, 5952, 5958, 3248,
-     5799, 5844, 5880, 5908, 5929, 5944, 5954, 5960, 5963, 3281, 5800, 5845,
-     5881, 5909, 5930, 5945, 5955, 5961, 5964, 5965, 3303, 2346, 2356, 2365,
-     2373, 2380, 2386, 2391, 2395, 2398, 2400, 2401, 154,  178,  2589, 2710,
-     190,  2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021,
-     2822, 2919, 2920, 2921, 214,  2592, 5968, 2713, 5977, 6022, 2823, 5985,
-     6030, 6066, 2922, 3007, 3008, 3009, 3010, 226,  2593, 5969, 2714, 5978,
-     6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084,
-     3085, 3086, 3087, 3088, 238,  2594, 5970, 2715, 5979, 6024, 2825, 5987,
-     6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045, 6081, 6109,
-     6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250,  2595, 5971, 2716,
-     5980, 6025, 2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076, 6104, 3013,
-     6001, 6046, 6082, 6110, 6131, 3090, 6006, 6051, 6087, 6115, 6136, 6151,
-     3156, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 262,  2596, 5972, 2717,
-     5981, 6026, 2827, 5989, 6034, 6070, 2926, 5996, 6041, 6077, 6105, 3014,
-     6002, 6047, 6083, 6111, 6132, 3091, 6007, 6052, 6088, 6116, 6137, 6152,
-     3157, 6011, 6056, 6092, 6120, 6141, 6156, 6166, 3212, 3249, 3250, 3251,
-     3252, 3253, 3254, 3255, 3256, 274,  2597, 5973, 2718, 5982, 6027, 2828,
-     5990, 6035, 6071, 2927, 5997, 6042, 6078, 6106, 3015, 6003, 6048, 6084,
-     6112, 6133, 3092, 6008, 6053, 6089, 6117, 6138, 6153, 3158, 6012, 6057,
-     6093, 6121, 6142, 6157, 6167, 3213, 6015, 6060, 6096, 6124, 6145, 6160,
-     6170, 6176, 3257, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290,
-     286,  2598, 5974, 2719, 5983, 6028, 2829, 5991, 6036, 6072, 2928, 5998,
-     6043, 6079, 6107, 3016, 6004, 6049, 6085, 6113, 6134, 3093, 6009, 6054,
-     6090, 6118, 6139, 6154, 3159, 6013, 6058, 6094, 6122, 6143, 6158, 6168,
-     3214, 6016, 6061, 6097, 6125, 6146, 6161, 6171, 6177, 3258, 6018, 6063,
-     6099, 6127, 6148, 6163, 6173, 6179, 6182, 3291, 3304, 3305, 3306, 3307,
-     3308, 3309, 3310, 3311, 3312, 3313, 298,  2599, 5975, 2720, 5984, 6029,
-     2830, 5992, 6037, 6073, 2929, 5999, 6044, 6080, 6108, 3017, 6005, 6050,
-     6086, 6114, 6135, 3094, 6010, 6055, 6091, 6119, 6140, 6155, 3160, 6014,
-     6059, 6095, 6123, 6144, 6159, 6169, 3215, 6017, 6062, 6098, 6126, 6147,
-     6162, 6172, 6178, 3259, 6019, 6064, 6100, 6128, 6149, 6164, 6174, 6180,
-     6183, 3292, 6020, 6065, 6101, 6129, 6150, 6165, 6175, 6181, 6184, 6185,
-     3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325,
-     310,  311,  2402, 312,  2403, 2413, 313,  2404, 2414, 2423, 314,  2405,
-     2415, 2424, 2432, 315,  2406, 2416, 2425, 2433, 2440, 316,  2407, 2417,
-     2426, 2434, 2441, 2447, 317,  2408, 2418, 2427, 2435, 2442, 2448, 2453,
-     318,  2409, 2419, 2428, 2436, 2443, 2449, 2454, 2458, 319,  2410, 2420,
-     2429, 2437, 2444, 2450, 2455, 2459, 2462, 320,  2411, 2421, 2430, 2438,
-     2445, 2451, 2456, 2460, 2463, 2465, 321,  2412, 2422, 2431, 2439, 2446,
-     2452, 2457, 2461, 2464, 2466, 2467, 322,  155,  156,  157,  158,  159,
-     160,  161,  162,  163,  164,  165,  166,
+#include <phevaluator/tables/noflush5.inc>
  };
\ No newline at end of file
@@ -1,4105 +1,5 @@
 #include "tables.h"
 
 const short noflush7[49205] = {
-    11,   23,   11,   167,  23,   11,   167,  179,  23,   12,   168,  191,
-    180,  24,   35,   35,   35,   36,   11,   167,  23,   11,   167,  179,
-    23,   12,   168,  2468, 180,  24,   168,  191,  192,  180,  35,   35,
-    36,   11,   167,  179,  23,   12,   169,  2468, 181,  24,   168,  2479,
-    2600, 180,  191,  193,  192,  35,   36,   13,   169,  203,  181,  25,
-    169,  203,  204,  181,  203,  205,  204,  193,  193,  37,   47,   47,
-    47,   48,   47,   47,   48,   47,   48,   49,   11,   167,  23,   11,
-    167,  179,  23,   12,   168,  2468, 180,  24,   168,  191,  192,  180,
-    35,   35,   36,   11,   167,  179,  23,   12,   1600, 1600, 1600, 24,
-    168,  1600, 1600, 180,  191,  1600, 192,  35,   36,   13,   169,  2469,
-    181,  25,   169,  1600, 1600, 181,  2480, 1600, 2601, 193,  193,  37,
-    169,  203,  204,  181,  203,  1600, 204,  205,  205,  193,  47,   47,
-    48,   47,   48,   49,   11,   167,  179,  23,   12,   170,  2468, 182,
-    24,   168,  2479, 2600, 180,  191,  194,  192,  35,   36,   13,   170,
-    2469, 182,  25,   170,  1600, 1600, 182,  2480, 1600, 2601, 194,  194,
-    37,   169,  2490, 2611, 181,  2491, 1600, 2612, 2721, 2722, 193,  203,
-    206,  204,  206,  206,  205,  47,   48,   49,   14,   170,  215,  182,
-    26,   170,  215,  216,  182,  215,  217,  216,  194,  194,  38,   170,
-    215,  216,  182,  215,  1600, 216,  217,  217,  194,  215,  218,  216,
-    218,  218,  217,  206,  206,  206,  50,   59,   59,   59,   60,   59,
-    59,   60,   59,   60,   61,   59,   59,   60,   59,   60,   61,   59,
-    60,   61,   62,   11,   167,  23,   11,   167,  179,  23,   12,   168,
-    2468, 180,  24,   168,  191,  192,  180,  35,   35,   36,   11,   167,
-    179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,
-    1742, 192,  35,   36,   13,   169,  2469, 181,  25,   169,  2490, 2611,
-    181,  2480, 2721, 2601, 193,  193,  37,   169,  203,  204,  181,  203,
-    1808, 204,  205,  205,  193,  47,   47,   48,   47,   48,   49,   11,
-    167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,
-    191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 1600,
-    1600, 1601, 2480, 1600, 1601, 1743, 1601, 37,   169,  2490, 2611, 181,
-    2491, 1600, 1601, 2721, 1601, 193,  203,  1808, 204,  1809, 1601, 205,
-    47,   48,   49,   14,   170,  2470, 182,  26,   170,  2501, 2622, 182,
-    2481, 2732, 2602, 194,  194,  38,   170,  2501, 2622, 182,  2502, 1600,
-    1601, 2732, 1601, 194,  2492, 2831, 2613, 2831, 1601, 2723, 206,  206,
-    206,  50,   170,  215,  216,  182,  215,  1874, 216,  217,  217,  194,
-    215,  1874, 216,  1875, 1601, 217,  218,  218,  218,  206,  59,   59,
-    60,   59,   60,   61,   59,   60,   61,   62,   11,   167,  179,  23,
-    12,   171,  2468, 183,  24,   168,  2479, 2600, 180,  191,  195,  192,
-    35,   36,   13,   171,  2469, 183,  25,   171,  2512, 2633, 183,  2480,
-    2743, 2601, 195,  195,  37,   169,  2490, 2611, 181,  2491, 2842, 2612,
-    2721, 2722, 193,  203,  207,  204,  207,  207,  205,  47,   48,   49,
-    14,   171,  2470, 183,  26,   171,  2512, 2633, 183,  2481, 2743, 2602,
-    195,  195,  38,   171,  2512, 2633, 183,  2513, 1600, 1601, 2743, 1601,
-    195,  2492, 2842, 2613, 2842, 1601, 2723, 207,  207,  207,  50,   170,
-    2501, 2622, 182,  2502, 2930, 2623, 2732, 2733, 194,  2503, 2930, 2624,
-    2930, 1601, 2734, 2831, 2832, 2833, 206,  215,  219,  216,  219,  219,
-    217,  219,  219,  219,  218,  59,   60,   61,   62,   15,   171,  227,
-    183,  27,   171,  227,  228,  183,  227,  229,  228,  195,  195,  39,
-    171,  227,  228,  183,  227,  1940, 228,  229,  229,  195,  227,  230,
-    228,  230,  230,  229,  207,  207,  207,  51,   171,  227,  228,  183,
-    227,  1940, 228,  229,  229,  195,  227,  1940, 228,  1941, 1601, 229,
-    230,  230,  230,  207,  227,  231,  228,  231,  231,  229,  231,  231,
-    231,  230,  219,  219,  219,  219,  63,   71,   71,   71,   72,   71,
-    71,   72,   71,   72,   73,   71,   71,   72,   71,   72,   73,   71,
-    72,   73,   74,   71,   71,   72,   71,   72,   73,   71,   72,   73,
-    74,   71,   72,   73,   74,   75,   11,   167,  23,   11,   167,  179,
-    23,   12,   168,  2468, 180,  24,   168,  191,  192,  180,  35,   35,
-    36,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479,
-    2600, 180,  191,  1742, 192,  35,   36,   13,   169,  2469, 181,  25,
-    169,  2490, 2611, 181,  2480, 2721, 2601, 193,  193,  37,   169,  203,
-    204,  181,  203,  1808, 204,  205,  205,  193,  47,   47,   48,   47,
-    48,   49,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,
-    2479, 2600, 180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677,
-    25,   1621, 1600, 1600, 1687, 2480, 1600, 2601, 1743, 1753, 37,   169,
-    2490, 2611, 181,  2491, 1600, 2612, 2721, 2722, 193,  203,  1808, 204,
-    1809, 1819, 205,  47,   48,   49,   14,   170,  2470, 182,  26,   170,
-    2501, 2622, 182,  2481, 2732, 2602, 194,  194,  38,   170,  2501, 2622,
-    182,  2502, 1600, 2623, 2732, 2733, 194,  2492, 2831, 2613, 2831, 2832,
-    2723, 206,  206,  206,  50,   170,  215,  216,  182,  215,  1874, 216,
-    217,  217,  194,  215,  1874, 216,  1875, 1885, 217,  218,  218,  218,
-    206,  59,   59,   60,   59,   60,   61,   59,   60,   61,   62,   11,
-    167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,
-    191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326,
-    3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,
-    2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,
-    47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688,
-    2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 1602, 1600,
-    1601, 1602, 1601, 1602, 2492, 3987, 2613, 1602, 1601, 1602, 1810, 1820,
-    1602, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,
-    2503, 4207, 2624, 1602, 1601, 1602, 2831, 2832, 1602, 206,  215,  1874,
-    216,  1875, 1885, 217,  1876, 1886, 1602, 218,  59,   60,   61,   62,
-    15,   171,  2471, 183,  27,   171,  2512, 2633, 183,  2482, 2743, 2603,
-    195,  195,  39,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743, 2744,
-    195,  2493, 2842, 2614, 2842, 2843, 2724, 207,  207,  207,  51,   171,
-    2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635,
-    1602, 1601, 1602, 2842, 2843, 1602, 207,  2504, 2930, 2625, 2930, 2931,
-    2735, 2930, 2931, 1602, 2834, 219,  219,  219,  219,  63,   171,  227,
-    228,  183,  227,  1940, 228,  229,  229,  195,  227,  1940, 228,  1941,
-    1951, 229,  230,  230,  230,  207,  227,  1940, 228,  1941, 1951, 229,
-    1942, 1952, 1602, 230,  231,  231,  231,  231,  219,  71,   71,   72,
-    71,   72,   73,   71,   72,   73,   74,   71,   72,   73,   74,   75,
-    11,   167,  179,  23,   12,   172,  2468, 184,  24,   168,  2479, 2600,
-    180,  191,  196,  192,  35,   36,   13,   172,  2469, 184,  25,   172,
-    2523, 2644, 184,  2480, 2754, 2601, 196,  196,  37,   169,  2490, 2611,
-    181,  2491, 2853, 2612, 2721, 2722, 193,  203,  208,  204,  208,  208,
-    205,  47,   48,   49,   14,   172,  2470, 184,  26,   172,  2523, 2644,
-    184,  2481, 2754, 2602, 196,  196,  38,   172,  2523, 2644, 184,  2524,
-    1600, 2645, 2754, 2755, 196,  2492, 2853, 2613, 2853, 2854, 2723, 208,
-    208,  208,  50,   170,  2501, 2622, 182,  2502, 2941, 2623, 2732, 2733,
-    194,  2503, 2941, 2624, 2941, 2942, 2734, 2831, 2832, 2833, 206,  215,
-    220,  216,  220,  220,  217,  220,  220,  220,  218,  59,   60,   61,
-    62,   15,   172,  2471, 184,  27,   172,  2523, 2644, 184,  2482, 2754,
-    2603, 196,  196,  39,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754,
-    2755, 196,  2493, 2853, 2614, 2853, 2854, 2724, 208,  208,  208,  51,
-    172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647,
-    2646, 1602, 1601, 1602, 2853, 2854, 1602, 208,  2504, 2941, 2625, 2941,
-    2942, 2735, 2941, 2942, 1602, 2834, 220,  220,  220,  220,  63,   171,
-    2512, 2633, 183,  2513, 3018, 2634, 2743, 2744, 195,  2514, 3018, 2635,
-    3018, 3019, 2745, 2842, 2843, 2844, 207,  2515, 3018, 2636, 3018, 3019,
-    2746, 3018, 3019, 1602, 2845, 2930, 2931, 2932, 2933, 219,  227,  232,
-    228,  232,  232,  229,  232,  232,  232,  230,  232,  232,  232,  232,
-    231,  71,   72,   73,   74,   75,   16,   172,  239,  184,  28,   172,
-    239,  240,  184,  239,  241,  240,  196,  196,  40,   172,  239,  240,
-    184,  239,  2006, 240,  241,  241,  196,  239,  242,  240,  242,  242,
-    241,  208,  208,  208,  52,   172,  239,  240,  184,  239,  2006, 240,
-    241,  241,  196,  239,  2006, 240,  2007, 2017, 241,  242,  242,  242,
-    208,  239,  243,  240,  243,  243,  241,  243,  243,  243,  242,  220,
-    220,  220,  220,  64,   172,  239,  240,  184,  239,  2006, 240,  241,
-    241,  196,  239,  2006, 240,  2007, 2017, 241,  242,  242,  242,  208,
-    239,  2006, 240,  2007, 2017, 241,  2008, 2018, 1602, 242,  243,  243,
-    243,  243,  220,  239,  244,  240,  244,  244,  241,  244,  244,  244,
-    242,  244,  244,  244,  244,  243,  232,  232,  232,  232,  232,  76,
-    83,   83,   83,   84,   83,   83,   84,   83,   84,   85,   83,   83,
-    84,   83,   84,   85,   83,   84,   85,   86,   83,   83,   84,   83,
-    84,   85,   83,   84,   85,   86,   83,   84,   85,   86,   87,   83,
-    83,   84,   83,   84,   85,   83,   84,   85,   86,   83,   84,   85,
-    86,   87,   83,   84,   85,   86,   87,   88,   11,   167,  23,   11,
-    167,  179,  23,   12,   168,  2468, 180,  24,   168,  191,  192,  180,
-    35,   35,   36,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,
-    168,  2479, 2600, 180,  191,  1742, 192,  35,   36,   13,   169,  2469,
-    181,  25,   169,  2490, 2611, 181,  2480, 2721, 2601, 193,  193,  37,
-    169,  203,  204,  181,  203,  1808, 204,  205,  205,  193,  47,   47,
-    48,   47,   48,   49,   11,   167,  179,  23,   12,   1610, 2468, 1676,
-    24,   168,  2479, 2600, 180,  191,  1742, 192,  35,   36,   13,   1611,
-    2469, 1677, 25,   1621, 1600, 1600, 1687, 2480, 1600, 2601, 1743, 1753,
-    37,   169,  2490, 2611, 181,  2491, 1600, 2612, 2721, 2722, 193,  203,
-    1808, 204,  1809, 1819, 205,  47,   48,   49,   14,   170,  2470, 182,
-    26,   170,  2501, 2622, 182,  2481, 2732, 2602, 194,  194,  38,   170,
-    2501, 2622, 182,  2502, 1600, 2623, 2732, 2733, 194,  2492, 2831, 2613,
-    2831, 2832, 2723, 206,  206,  206,  50,   170,  215,  216,  182,  215,
-    1874, 216,  217,  217,  194,  215,  1874, 216,  1875, 1885, 217,  218,
-    218,  218,  206,  59,   59,   60,   59,   60,   61,   59,   60,   61,
-    62,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479,
-    2600, 180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,
-    1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490,
-    2611, 181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809,
-    1819, 205,  47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327,
-    3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697,
-    3381, 1600, 1601, 3776, 1601, 1763, 2492, 3987, 2613, 3996, 1601, 2723,
-    1810, 1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732,
-    2733, 194,  2503, 4207, 2624, 4216, 1601, 2734, 2831, 2832, 2833, 206,
-    215,  1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,
-    61,   62,   15,   171,  2471, 183,  27,   171,  2512, 2633, 183,  2482,
-    2743, 2603, 195,  195,  39,   171,  2512, 2633, 183,  2513, 4426, 2634,
-    2743, 2744, 195,  2493, 2842, 2614, 2842, 2843, 2724, 207,  207,  207,
-    51,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514,
-    4427, 2635, 4436, 1601, 2745, 2842, 2843, 2844, 207,  2504, 2930, 2625,
-    2930, 2931, 2735, 2930, 2931, 2932, 2834, 219,  219,  219,  219,  63,
-    171,  227,  228,  183,  227,  1940, 228,  229,  229,  195,  227,  1940,
-    228,  1941, 1951, 229,  230,  230,  230,  207,  227,  1940, 228,  1941,
-    1951, 229,  1942, 1952, 1961, 230,  231,  231,  231,  231,  219,  71,
-    71,   72,   71,   72,   73,   71,   72,   73,   74,   71,   72,   73,
-    74,   75,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,
-    2479, 2600, 180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677,
-    25,   1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,
-    2490, 2611, 181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,
-    1809, 1819, 205,  47,   48,   49,   14,   1612, 2470, 1678, 26,   1622,
-    3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556,
-    1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041,
-    2723, 1810, 1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623,
-    2732, 2733, 194,  2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833,
-    206,  215,  1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,
-    60,   61,   62,   15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689,
-    2482, 3768, 2603, 1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186,
-    3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821,
-    1830, 51,   1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772,
-    1603, 1603, 1603, 1602, 1601, 1602, 1603, 1603, 1602, 1603, 2504, 4208,
-    2625, 4217, 4262, 2735, 1603, 1603, 1602, 1603, 1877, 1887, 1896, 1603,
-    63,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514,
-    4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636,
-    4437, 4482, 2746, 1603, 1603, 1602, 1603, 2930, 2931, 2932, 1603, 219,
-    227,  1940, 228,  1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953,
-    1962, 1603, 231,  71,   72,   73,   74,   75,   16,   172,  2472, 184,
-    28,   172,  2523, 2644, 184,  2483, 2754, 2604, 196,  196,  40,   172,
-    2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2494, 2853, 2615,
-    2853, 2854, 2725, 208,  208,  208,  52,   172,  2523, 2644, 184,  2524,
-    4646, 2645, 2754, 2755, 196,  2525, 4647, 2646, 4656, 4701, 2756, 2853,
-    2854, 2855, 208,  2505, 2941, 2626, 2941, 2942, 2736, 2941, 2942, 2943,
-    2835, 220,  220,  220,  220,  64,   172,  2523, 2644, 184,  2524, 4646,
-    2645, 2754, 2755, 196,  2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854,
-    2855, 208,  2526, 4648, 2647, 4657, 4702, 2757, 1603, 1603, 1602, 1603,
-    2941, 2942, 2943, 1603, 220,  2516, 3018, 2637, 3018, 3019, 2747, 3018,
-    3019, 3020, 2846, 3018, 3019, 3020, 1603, 2934, 232,  232,  232,  232,
-    232,  76,   172,  239,  240,  184,  239,  2006, 240,  241,  241,  196,
-    239,  2006, 240,  2007, 2017, 241,  242,  242,  242,  208,  239,  2006,
-    240,  2007, 2017, 241,  2008, 2018, 2027, 242,  243,  243,  243,  243,
-    220,  239,  2006, 240,  2007, 2017, 241,  2008, 2018, 2027, 242,  2009,
-    2019, 2028, 1603, 243,  244,  244,  244,  244,  244,  232,  83,   83,
-    84,   83,   84,   85,   83,   84,   85,   86,   83,   84,   85,   86,
-    87,   83,   84,   85,   86,   87,   88,   11,   167,  179,  23,   12,
-    173,  2468, 185,  24,   168,  2479, 2600, 180,  191,  197,  192,  35,
-    36,   13,   173,  2469, 185,  25,   173,  2534, 2655, 185,  2480, 2765,
-    2601, 197,  197,  37,   169,  2490, 2611, 181,  2491, 2864, 2612, 2721,
-    2722, 193,  203,  209,  204,  209,  209,  205,  47,   48,   49,   14,
-    173,  2470, 185,  26,   173,  2534, 2655, 185,  2481, 2765, 2602, 197,
-    197,  38,   173,  2534, 2655, 185,  2535, 1600, 2656, 2765, 2766, 197,
-    2492, 2864, 2613, 2864, 2865, 2723, 209,  209,  209,  50,   170,  2501,
-    2622, 182,  2502, 2952, 2623, 2732, 2733, 194,  2503, 2952, 2624, 2952,
-    2953, 2734, 2831, 2832, 2833, 206,  215,  221,  216,  221,  221,  217,
-    221,  221,  221,  218,  59,   60,   61,   62,   15,   173,  2471, 185,
-    27,   173,  2534, 2655, 185,  2482, 2765, 2603, 197,  197,  39,   173,
-    2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2493, 2864, 2614,
-    2864, 2865, 2724, 209,  209,  209,  51,   173,  2534, 2655, 185,  2535,
-    4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876, 1601, 2767, 2864,
-    2865, 2866, 209,  2504, 2952, 2625, 2952, 2953, 2735, 2952, 2953, 2954,
-    2834, 221,  221,  221,  221,  63,   171,  2512, 2633, 183,  2513, 3029,
-    2634, 2743, 2744, 195,  2514, 3029, 2635, 3029, 3030, 2745, 2842, 2843,
-    2844, 207,  2515, 3029, 2636, 3029, 3030, 2746, 3029, 3030, 3031, 2845,
-    2930, 2931, 2932, 2933, 219,  227,  233,  228,  233,  233,  229,  233,
-    233,  233,  230,  233,  233,  233,  233,  231,  71,   72,   73,   74,
-    75,   16,   173,  2472, 185,  28,   173,  2534, 2655, 185,  2483, 2765,
-    2604, 197,  197,  40,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765,
-    2766, 197,  2494, 2864, 2615, 2864, 2865, 2725, 209,  209,  209,  52,
-    173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2536, 4867,
-    2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,  2505, 2952, 2626, 2952,
-    2953, 2736, 2952, 2953, 2954, 2835, 221,  221,  221,  221,  64,   173,
-    2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657,
-    4876, 4921, 2767, 2864, 2865, 2866, 209,  2537, 4868, 2658, 4877, 4922,
-    2768, 1603, 1603, 1602, 1603, 2952, 2953, 2954, 1603, 221,  2516, 3029,
-    2637, 3029, 3030, 2747, 3029, 3030, 3031, 2846, 3029, 3030, 3031, 1603,
-    2934, 233,  233,  233,  233,  233,  76,   172,  2523, 2644, 184,  2524,
-    3095, 2645, 2754, 2755, 196,  2525, 3095, 2646, 3095, 3096, 2756, 2853,
-    2854, 2855, 208,  2526, 3095, 2647, 3095, 3096, 2757, 3095, 3096, 3097,
-    2856, 2941, 2942, 2943, 2944, 220,  2527, 3095, 2648, 3095, 3096, 2758,
-    3095, 3096, 3097, 2857, 3095, 3096, 3097, 1603, 2945, 3018, 3019, 3020,
-    3021, 3022, 232,  239,  245,  240,  245,  245,  241,  245,  245,  245,
-    242,  245,  245,  245,  245,  243,  245,  245,  245,  245,  245,  244,
-    83,   84,   85,   86,   87,   88,   17,   173,  251,  185,  29,   173,
-    251,  252,  185,  251,  253,  252,  197,  197,  41,   173,  251,  252,
-    185,  251,  2072, 252,  253,  253,  197,  251,  254,  252,  254,  254,
-    253,  209,  209,  209,  53,   173,  251,  252,  185,  251,  2072, 252,
-    253,  253,  197,  251,  2072, 252,  2073, 2083, 253,  254,  254,  254,
-    209,  251,  255,  252,  255,  255,  253,  255,  255,  255,  254,  221,
-    221,  221,  221,  65,   173,  251,  252,  185,  251,  2072, 252,  253,
-    253,  197,  251,  2072, 252,  2073, 2083, 253,  254,  254,  254,  209,
-    251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,  255,  255,
-    255,  255,  221,  251,  256,  252,  256,  256,  253,  256,  256,  256,
-    254,  256,  256,  256,  256,  255,  233,  233,  233,  233,  233,  77,
-    173,  251,  252,  185,  251,  2072, 252,  253,  253,  197,  251,  2072,
-    252,  2073, 2083, 253,  254,  254,  254,  209,  251,  2072, 252,  2073,
-    2083, 253,  2074, 2084, 2093, 254,  255,  255,  255,  255,  221,  251,
-    2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,  2075, 2085, 2094,
-    1603, 255,  256,  256,  256,  256,  256,  233,  251,  257,  252,  257,
-    257,  253,  257,  257,  257,  254,  257,  257,  257,  257,  255,  257,
-    257,  257,  257,  257,  256,  245,  245,  245,  245,  245,  245,  89,
-    95,   95,   95,   96,   95,   95,   96,   95,   96,   97,   95,   95,
-    96,   95,   96,   97,   95,   96,   97,   98,   95,   95,   96,   95,
-    96,   97,   95,   96,   97,   98,   95,   96,   97,   98,   99,   95,
-    95,   96,   95,   96,   97,   95,   96,   97,   98,   95,   96,   97,
-    98,   99,   95,   96,   97,   98,   99,   100,  95,   95,   96,   95,
-    96,   97,   95,   96,   97,   98,   95,   96,   97,   98,   99,   95,
-    96,   97,   98,   99,   100,  95,   96,   97,   98,   99,   100,  101,
-    11,   167,  23,   11,   167,  179,  23,   12,   168,  2468, 180,  24,
-    168,  191,  192,  180,  35,   35,   36,   11,   167,  179,  23,   12,
-    1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,
-    36,   13,   169,  2469, 181,  25,   169,  2490, 2611, 181,  2480, 2721,
-    2601, 193,  193,  37,   169,  203,  204,  181,  203,  1808, 204,  205,
-    205,  193,  47,   47,   48,   47,   48,   49,   11,   167,  179,  23,
-    12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,
-    35,   36,   13,   1611, 2469, 1677, 25,   1621, 1600, 1600, 1687, 2480,
-    1600, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,  2491, 1600, 2612,
-    2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,  47,   48,   49,
-    14,   170,  2470, 182,  26,   170,  2501, 2622, 182,  2481, 2732, 2602,
-    194,  194,  38,   170,  2501, 2622, 182,  2502, 1600, 2623, 2732, 2733,
-    194,  2492, 2831, 2613, 2831, 2832, 2723, 206,  206,  206,  50,   170,
-    215,  216,  182,  215,  1874, 216,  217,  217,  194,  215,  1874, 216,
-    1875, 1885, 217,  218,  218,  218,  206,  59,   59,   60,   59,   60,
-    61,   59,   60,   61,   62,   11,   167,  179,  23,   12,   1610, 2468,
-    1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,   36,   13,
-    1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743,
-    1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612, 2721, 2722, 193,
-    203,  1808, 204,  1809, 1819, 205,  47,   48,   49,   14,   1612, 2470,
-    1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,
-    1631, 3336, 3556, 1697, 3381, 1600, 1601, 3776, 1601, 1763, 2492, 3987,
-    2613, 3996, 1601, 2723, 1810, 1820, 1829, 50,   170,  2501, 2622, 182,
-    2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624, 4216, 1601, 2734,
-    2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885, 217,  1876, 1886,
-    1895, 218,  59,   60,   61,   62,   15,   171,  2471, 183,  27,   171,
-    2512, 2633, 183,  2482, 2743, 2603, 195,  195,  39,   171,  2512, 2633,
-    183,  2513, 4426, 2634, 2743, 2744, 195,  2493, 2842, 2614, 2842, 2843,
-    2724, 207,  207,  207,  51,   171,  2512, 2633, 183,  2513, 4426, 2634,
-    2743, 2744, 195,  2514, 4427, 2635, 4436, 1601, 2745, 2842, 2843, 2844,
-    207,  2504, 2930, 2625, 2930, 2931, 2735, 2930, 2931, 2932, 2834, 219,
-    219,  219,  219,  63,   171,  227,  228,  183,  227,  1940, 228,  229,
-    229,  195,  227,  1940, 228,  1941, 1951, 229,  230,  230,  230,  207,
-    227,  1940, 228,  1941, 1951, 229,  1942, 1952, 1961, 230,  231,  231,
-    231,  231,  219,  71,   71,   72,   71,   72,   73,   71,   72,   73,
-    74,   71,   72,   73,   74,   75,   11,   167,  179,  23,   12,   1610,
-    2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,   36,
-    13,   1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480, 3766, 2601,
-    1743, 1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612, 2721, 2722,
-    193,  203,  1808, 204,  1809, 1819, 205,  47,   48,   49,   14,   1612,
-    2470, 1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754,
-    38,   1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492,
-    3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,   170,  2501, 2622,
-    182,  2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624, 4216, 4261,
-    2734, 2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885, 217,  1876,
-    1886, 1895, 218,  59,   60,   61,   62,   15,   1613, 2471, 1679, 27,
-    1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39,   1632, 3337,
-    3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997,
-    4042, 2724, 1811, 1821, 1830, 51,   1640, 3345, 3565, 1706, 3390, 6194,
-    3610, 3785, 3830, 1772, 3426, 6230, 3646, 1602, 1601, 1602, 4005, 4050,
-    1602, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 1602, 2834,
-    1877, 1887, 1896, 1904, 63,   171,  2512, 2633, 183,  2513, 4426, 2634,
-    2743, 2744, 195,  2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844,
-    207,  2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 1602, 2845, 2930,
-    2931, 2932, 2933, 219,  227,  1940, 228,  1941, 1951, 229,  1942, 1952,
-    1961, 230,  1943, 1953, 1962, 1970, 231,  71,   72,   73,   74,   75,
-    16,   172,  2472, 184,  28,   172,  2523, 2644, 184,  2483, 2754, 2604,
-    196,  196,  40,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755,
-    196,  2494, 2853, 2615, 2853, 2854, 2725, 208,  208,  208,  52,   172,
-    2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646,
-    4656, 4701, 2756, 2853, 2854, 2855, 208,  2505, 2941, 2626, 2941, 2942,
-    2736, 2941, 2942, 2943, 2835, 220,  220,  220,  220,  64,   172,  2523,
-    2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646, 4656,
-    4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657, 4702, 2757,
-    4665, 4710, 1602, 2856, 2941, 2942, 2943, 2944, 220,  2516, 3018, 2637,
-    3018, 3019, 2747, 3018, 3019, 3020, 2846, 3018, 3019, 3020, 3021, 2934,
-    232,  232,  232,  232,  232,  76,   172,  239,  240,  184,  239,  2006,
-    240,  241,  241,  196,  239,  2006, 240,  2007, 2017, 241,  242,  242,
-    242,  208,  239,  2006, 240,  2007, 2017, 241,  2008, 2018, 2027, 242,
-    243,  243,  243,  243,  220,  239,  2006, 240,  2007, 2017, 241,  2008,
-    2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  244,  244,  244,  244,
-    244,  232,  83,   83,   84,   83,   84,   85,   83,   84,   85,   86,
-    83,   84,   85,   86,   87,   83,   84,   85,   86,   87,   88,   11,
-    167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,
-    191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326,
-    3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,
-    2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,
-    47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688,
-    2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600,
-    3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820,
-    1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,
-    2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,  215,  1874,
-    216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,   62,
-    15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689, 2482, 3768, 2603,
-    1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822,
-    1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,   1640,
-    3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646,
-    6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262,
-    2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63,   171,  2512,
-    2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635, 4436,
-    4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636, 4437, 4482, 2746,
-    4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,  227,  1940, 228,
-    1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953, 1962, 1970, 231,
-    71,   72,   73,   74,   75,   16,   1614, 2472, 1680, 28,   1624, 3329,
-    3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,   1633, 3338, 3558, 1699,
-    3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725,
-    1812, 1822, 1831, 52,   1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786,
-    3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839,
-    2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888,
-    1897, 1905, 64,   1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838,
-    1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 1604,
-    1604, 1604, 1604, 1604, 1604, 1603, 1603, 1602, 1603, 1604, 1604, 1604,
-    1603, 1604, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846,
-    1604, 1604, 1604, 1603, 1604, 1944, 1954, 1963, 1971, 1604, 76,   172,
-    2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646,
-    4656, 4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657, 4702,
-    2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220,  2527, 4649,
-    2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 1604, 1604, 1604, 1603,
-    1604, 3018, 3019, 3020, 3021, 1604, 232,  239,  2006, 240,  2007, 2017,
-    241,  2008, 2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  2010, 2020,
-    2029, 2037, 1604, 244,  83,   84,   85,   86,   87,   88,   17,   173,
-    2473, 185,  29,   173,  2534, 2655, 185,  2484, 2765, 2605, 197,  197,
-    41,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2495,
-    2864, 2616, 2864, 2865, 2726, 209,  209,  209,  53,   173,  2534, 2655,
-    185,  2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876, 4921,
-    2767, 2864, 2865, 2866, 209,  2506, 2952, 2627, 2952, 2953, 2737, 2952,
-    2953, 2954, 2836, 221,  221,  221,  221,  65,   173,  2534, 2655, 185,
-    2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876, 4921, 2767,
-    2864, 2865, 2866, 209,  2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930,
-    4966, 2867, 2952, 2953, 2954, 2955, 221,  2517, 3029, 2638, 3029, 3030,
-    2748, 3029, 3030, 3031, 2847, 3029, 3030, 3031, 3032, 2935, 233,  233,
-    233,  233,  233,  77,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765,
-    2766, 197,  2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,
-    2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953,
-    2954, 2955, 221,  2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967,
-    2868, 1604, 1604, 1604, 1603, 1604, 3029, 3030, 3031, 3032, 1604, 233,
-    2528, 3095, 2649, 3095, 3096, 2759, 3095, 3096, 3097, 2858, 3095, 3096,
-    3097, 3098, 2946, 3095, 3096, 3097, 3098, 1604, 3023, 245,  245,  245,
-    245,  245,  245,  89,   173,  251,  252,  185,  251,  2072, 252,  253,
-    253,  197,  251,  2072, 252,  2073, 2083, 253,  254,  254,  254,  209,
-    251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,  255,  255,
-    255,  255,  221,  251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093,
-    254,  2075, 2085, 2094, 2102, 255,  256,  256,  256,  256,  256,  233,
-    251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,  2075, 2085,
-    2094, 2102, 255,  2076, 2086, 2095, 2103, 1604, 256,  257,  257,  257,
-    257,  257,  257,  245,  95,   95,   96,   95,   96,   97,   95,   96,
-    97,   98,   95,   96,   97,   98,   99,   95,   96,   97,   98,   99,
-    100,  95,   96,   97,   98,   99,   100,  101,  11,   167,  179,  23,
-    12,   174,  2468, 186,  24,   168,  2479, 2600, 180,  191,  198,  192,
-    35,   36,   13,   174,  2469, 186,  25,   174,  2545, 2666, 186,  2480,
-    2776, 2601, 198,  198,  37,   169,  2490, 2611, 181,  2491, 2875, 2612,
-    2721, 2722, 193,  203,  210,  204,  210,  210,  205,  47,   48,   49,
-    14,   174,  2470, 186,  26,   174,  2545, 2666, 186,  2481, 2776, 2602,
-    198,  198,  38,   174,  2545, 2666, 186,  2546, 1600, 2667, 2776, 2777,
-    198,  2492, 2875, 2613, 2875, 2876, 2723, 210,  210,  210,  50,   170,
-    2501, 2622, 182,  2502, 2963, 2623, 2732, 2733, 194,  2503, 2963, 2624,
-    2963, 2964, 2734, 2831, 2832, 2833, 206,  215,  222,  216,  222,  222,
-    217,  222,  222,  222,  218,  59,   60,   61,   62,   15,   174,  2471,
-    186,  27,   174,  2545, 2666, 186,  2482, 2776, 2603, 198,  198,  39,
-    174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2493, 2875,
-    2614, 2875, 2876, 2724, 210,  210,  210,  51,   174,  2545, 2666, 186,
-    2546, 5086, 2667, 2776, 2777, 198,  2547, 5087, 2668, 5096, 1601, 2778,
-    2875, 2876, 2877, 210,  2504, 2963, 2625, 2963, 2964, 2735, 2963, 2964,
-    2965, 2834, 222,  222,  222,  222,  63,   171,  2512, 2633, 183,  2513,
-    3040, 2634, 2743, 2744, 195,  2514, 3040, 2635, 3040, 3041, 2745, 2842,
-    2843, 2844, 207,  2515, 3040, 2636, 3040, 3041, 2746, 3040, 3041, 3042,
-    2845, 2930, 2931, 2932, 2933, 219,  227,  234,  228,  234,  234,  229,
-    234,  234,  234,  230,  234,  234,  234,  234,  231,  71,   72,   73,
-    74,   75,   16,   174,  2472, 186,  28,   174,  2545, 2666, 186,  2483,
-    2776, 2604, 198,  198,  40,   174,  2545, 2666, 186,  2546, 5086, 2667,
-    2776, 2777, 198,  2494, 2875, 2615, 2875, 2876, 2725, 210,  210,  210,
-    52,   174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547,
-    5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2505, 2963, 2626,
-    2963, 2964, 2736, 2963, 2964, 2965, 2835, 222,  222,  222,  222,  64,
-    174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087,
-    2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097,
-    5142, 2779, 5105, 5150, 1602, 2878, 2963, 2964, 2965, 2966, 222,  2516,
-    3040, 2637, 3040, 3041, 2747, 3040, 3041, 3042, 2846, 3040, 3041, 3042,
-    3043, 2934, 234,  234,  234,  234,  234,  76,   172,  2523, 2644, 184,
-    2524, 3106, 2645, 2754, 2755, 196,  2525, 3106, 2646, 3106, 3107, 2756,
-    2853, 2854, 2855, 208,  2526, 3106, 2647, 3106, 3107, 2757, 3106, 3107,
-    3108, 2856, 2941, 2942, 2943, 2944, 220,  2527, 3106, 2648, 3106, 3107,
-    2758, 3106, 3107, 3108, 2857, 3106, 3107, 3108, 3109, 2945, 3018, 3019,
-    3020, 3021, 3022, 232,  239,  246,  240,  246,  246,  241,  246,  246,
-    246,  242,  246,  246,  246,  246,  243,  246,  246,  246,  246,  246,
-    244,  83,   84,   85,   86,   87,   88,   17,   174,  2473, 186,  29,
-    174,  2545, 2666, 186,  2484, 2776, 2605, 198,  198,  41,   174,  2545,
-    2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2495, 2875, 2616, 2875,
-    2876, 2726, 210,  210,  210,  53,   174,  2545, 2666, 186,  2546, 5086,
-    2667, 2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876,
-    2877, 210,  2506, 2963, 2627, 2963, 2964, 2737, 2963, 2964, 2965, 2836,
-    222,  222,  222,  222,  65,   174,  2545, 2666, 186,  2546, 5086, 2667,
-    2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877,
-    210,  2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963,
-    2964, 2965, 2966, 222,  2517, 3040, 2638, 3040, 3041, 2748, 3040, 3041,
-    3042, 2847, 3040, 3041, 3042, 3043, 2935, 234,  234,  234,  234,  234,
-    77,   174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547,
-    5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669,
-    5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,
-    2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 1604, 1604,
-    1604, 1603, 1604, 3040, 3041, 3042, 3043, 1604, 234,  2528, 3106, 2649,
-    3106, 3107, 2759, 3106, 3107, 3108, 2858, 3106, 3107, 3108, 3109, 2946,
-    3106, 3107, 3108, 3109, 1604, 3023, 246,  246,  246,  246,  246,  246,
-    89,   173,  2534, 2655, 185,  2535, 3161, 2656, 2765, 2766, 197,  2536,
-    3161, 2657, 3161, 3162, 2767, 2864, 2865, 2866, 209,  2537, 3161, 2658,
-    3161, 3162, 2768, 3161, 3162, 3163, 2867, 2952, 2953, 2954, 2955, 221,
-    2538, 3161, 2659, 3161, 3162, 2769, 3161, 3162, 3163, 2868, 3161, 3162,
-    3163, 3164, 2956, 3029, 3030, 3031, 3032, 3033, 233,  2539, 3161, 2660,
-    3161, 3162, 2770, 3161, 3162, 3163, 2869, 3161, 3162, 3163, 3164, 2957,
-    3161, 3162, 3163, 3164, 1604, 3034, 3095, 3096, 3097, 3098, 3099, 3100,
-    245,  251,  258,  252,  258,  258,  253,  258,  258,  258,  254,  258,
-    258,  258,  258,  255,  258,  258,  258,  258,  258,  256,  258,  258,
-    258,  258,  258,  258,  257,  95,   96,   97,   98,   99,   100,  101,
-    18,   174,  263,  186,  30,   174,  263,  264,  186,  263,  265,  264,
-    198,  198,  42,   174,  263,  264,  186,  263,  2138, 264,  265,  265,
-    198,  263,  266,  264,  266,  266,  265,  210,  210,  210,  54,   174,
-    263,  264,  186,  263,  2138, 264,  265,  265,  198,  263,  2138, 264,
-    2139, 2149, 265,  266,  266,  266,  210,  263,  267,  264,  267,  267,
-    265,  267,  267,  267,  266,  222,  222,  222,  222,  66,   174,  263,
-    264,  186,  263,  2138, 264,  265,  265,  198,  263,  2138, 264,  2139,
-    2149, 265,  266,  266,  266,  210,  263,  2138, 264,  2139, 2149, 265,
-    2140, 2150, 2159, 266,  267,  267,  267,  267,  222,  263,  268,  264,
-    268,  268,  265,  268,  268,  268,  266,  268,  268,  268,  268,  267,
-    234,  234,  234,  234,  234,  78,   174,  263,  264,  186,  263,  2138,
-    264,  265,  265,  198,  263,  2138, 264,  2139, 2149, 265,  266,  266,
-    266,  210,  263,  2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,
-    267,  267,  267,  267,  222,  263,  2138, 264,  2139, 2149, 265,  2140,
-    2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  268,  268,  268,  268,
-    268,  234,  263,  269,  264,  269,  269,  265,  269,  269,  269,  266,
-    269,  269,  269,  269,  267,  269,  269,  269,  269,  269,  268,  246,
-    246,  246,  246,  246,  246,  90,   174,  263,  264,  186,  263,  2138,
-    264,  265,  265,  198,  263,  2138, 264,  2139, 2149, 265,  266,  266,
-    266,  210,  263,  2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,
-    267,  267,  267,  267,  222,  263,  2138, 264,  2139, 2149, 265,  2140,
-    2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  268,  268,  268,  268,
-    268,  234,  263,  2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,
-    2141, 2151, 2160, 2168, 267,  2142, 2152, 2161, 2169, 1604, 268,  269,
-    269,  269,  269,  269,  269,  246,  263,  270,  264,  270,  270,  265,
-    270,  270,  270,  266,  270,  270,  270,  270,  267,  270,  270,  270,
-    270,  270,  268,  270,  270,  270,  270,  270,  270,  269,  258,  258,
-    258,  258,  258,  258,  258,  102,  107,  107,  107,  108,  107,  107,
-    108,  107,  108,  109,  107,  107,  108,  107,  108,  109,  107,  108,
-    109,  110,  107,  107,  108,  107,  108,  109,  107,  108,  109,  110,
-    107,  108,  109,  110,  111,  107,  107,  108,  107,  108,  109,  107,
-    108,  109,  110,  107,  108,  109,  110,  111,  107,  108,  109,  110,
-    111,  112,  107,  107,  108,  107,  108,  109,  107,  108,  109,  110,
-    107,  108,  109,  110,  111,  107,  108,  109,  110,  111,  112,  107,
-    108,  109,  110,  111,  112,  113,  107,  107,  108,  107,  108,  109,
-    107,  108,  109,  110,  107,  108,  109,  110,  111,  107,  108,  109,
-    110,  111,  112,  107,  108,  109,  110,  111,  112,  113,  107,  108,
-    109,  110,  111,  112,  113,  114,  11,   167,  23,   11,   167,  179,
-    23,   12,   168,  2468, 180,  24,   168,  191,  192,  180,  35,   35,
-    36,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479,
-    2600, 180,  191,  1742, 192,  35,   36,   13,   169,  2469, 181,  25,
-    169,  2490, 2611, 181,  2480, 2721, 2601, 193,  193,  37,   169,  203,
-    204,  181,  203,  1808, 204,  205,  205,  193,  47,   47,   48,   47,
-    48,   49,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,
-    2479, 2600, 180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677,
-    25,   1621, 1600, 1600, 1687, 2480, 1600, 2601, 1743, 1753, 37,   169,
-    2490, 2611, 181,  2491, 1600, 2612, 2721, 2722, 193,  203,  1808, 204,
-    1809, 1819, 205,  47,   48,   49,   14,   170,  2470, 182,  26,   170,
-    2501, 2622, 182,  2481, 2732, 2602, 194,  194,  38,   170,  2501, 2622,
-    182,  2502, 1600, 2623, 2732, 2733, 194,  2492, 2831, 2613, 2831, 2832,
-    2723, 206,  206,  206,  50,   170,  215,  216,  182,  215,  1874, 216,
-    217,  217,  194,  215,  1874, 216,  1875, 1885, 217,  218,  218,  218,
-    206,  59,   59,   60,   59,   60,   61,   59,   60,   61,   62,   11,
-    167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,
-    191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326,
-    3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,
-    2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,
-    47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688,
-    2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600,
-    1601, 3776, 1601, 1763, 2492, 3987, 2613, 3996, 1601, 2723, 1810, 1820,
-    1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,
-    2503, 4207, 2624, 4216, 1601, 2734, 2831, 2832, 2833, 206,  215,  1874,
-    216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,   62,
-    15,   171,  2471, 183,  27,   171,  2512, 2633, 183,  2482, 2743, 2603,
-    195,  195,  39,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743, 2744,
-    195,  2493, 2842, 2614, 2842, 2843, 2724, 207,  207,  207,  51,   171,
-    2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635,
-    4436, 1601, 2745, 2842, 2843, 2844, 207,  2504, 2930, 2625, 2930, 2931,
-    2735, 2930, 2931, 2932, 2834, 219,  219,  219,  219,  63,   171,  227,
-    228,  183,  227,  1940, 228,  229,  229,  195,  227,  1940, 228,  1941,
-    1951, 229,  230,  230,  230,  207,  227,  1940, 228,  1941, 1951, 229,
-    1942, 1952, 1961, 230,  231,  231,  231,  231,  219,  71,   71,   72,
-    71,   72,   73,   71,   72,   73,   74,   71,   72,   73,   74,   75,
-    11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600,
-    180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621,
-    3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611,
-    181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819,
-    205,  47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547,
-    1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381,
-    1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810,
-    1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733,
-    194,  2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,  215,
-    1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,
-    62,   15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689, 2482, 3768,
-    2603, 1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777,
-    3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,
-    1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230,
-    3646, 1602, 1601, 1602, 4005, 4050, 1602, 1838, 2504, 4208, 2625, 4217,
-    4262, 2735, 4225, 4270, 1602, 2834, 1877, 1887, 1896, 1904, 63,   171,
-    2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635,
-    4436, 4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636, 4437, 4482,
-    2746, 4445, 4490, 1602, 2845, 2930, 2931, 2932, 2933, 219,  227,  1940,
-    228,  1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953, 1962, 1970,
-    231,  71,   72,   73,   74,   75,   16,   172,  2472, 184,  28,   172,
-    2523, 2644, 184,  2483, 2754, 2604, 196,  196,  40,   172,  2523, 2644,
-    184,  2524, 4646, 2645, 2754, 2755, 196,  2494, 2853, 2615, 2853, 2854,
-    2725, 208,  208,  208,  52,   172,  2523, 2644, 184,  2524, 4646, 2645,
-    2754, 2755, 196,  2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855,
-    208,  2505, 2941, 2626, 2941, 2942, 2736, 2941, 2942, 2943, 2835, 220,
-    220,  220,  220,  64,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754,
-    2755, 196,  2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,
-    2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 1602, 2856, 2941, 2942,
-    2943, 2944, 220,  2516, 3018, 2637, 3018, 3019, 2747, 3018, 3019, 3020,
-    2846, 3018, 3019, 3020, 3021, 2934, 232,  232,  232,  232,  232,  76,
-    172,  239,  240,  184,  239,  2006, 240,  241,  241,  196,  239,  2006,
-    240,  2007, 2017, 241,  242,  242,  242,  208,  239,  2006, 240,  2007,
-    2017, 241,  2008, 2018, 2027, 242,  243,  243,  243,  243,  220,  239,
-    2006, 240,  2007, 2017, 241,  2008, 2018, 2027, 242,  2009, 2019, 2028,
-    2036, 243,  244,  244,  244,  244,  244,  232,  83,   83,   84,   83,
-    84,   85,   83,   84,   85,   86,   83,   84,   85,   86,   87,   83,
-    84,   85,   86,   87,   88,   11,   167,  179,  23,   12,   1610, 2468,
-    1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,   36,   13,
-    1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743,
-    1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612, 2721, 2722, 193,
-    203,  1808, 204,  1809, 1819, 205,  47,   48,   49,   14,   1612, 2470,
-    1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,
-    1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987,
-    2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,   170,  2501, 2622, 182,
-    2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624, 4216, 4261, 2734,
-    2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885, 217,  1876, 1886,
-    1895, 218,  59,   60,   61,   62,   15,   1613, 2471, 1679, 27,   1623,
-    3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39,   1632, 3337, 3557,
-    1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042,
-    2724, 1811, 1821, 1830, 51,   1640, 3345, 3565, 1706, 3390, 6194, 3610,
-    3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086,
-    1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877,
-    1887, 1896, 1904, 63,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743,
-    2744, 195,  2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207,
-    2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931,
-    2932, 2933, 219,  227,  1940, 228,  1941, 1951, 229,  1942, 1952, 1961,
-    230,  1943, 1953, 1962, 1970, 231,  71,   72,   73,   74,   75,   16,
-    1614, 2472, 1680, 28,   1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746,
-    1756, 40,   1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765,
-    2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52,   1641, 3346,
-    3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351,
-    6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736,
-    4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64,   1648, 3353, 3573,
-    1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686,
-    3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 1603,
-    1603, 1602, 1603, 4233, 4278, 4314, 1603, 1912, 2516, 4429, 2637, 4438,
-    4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 1603, 2934, 1944,
-    1954, 1963, 1971, 1978, 76,   172,  2523, 2644, 184,  2524, 4646, 2645,
-    2754, 2755, 196,  2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855,
-    208,  2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941,
-    2942, 2943, 2944, 220,  2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711,
-    4747, 2857, 4673, 4718, 4754, 1603, 2945, 3018, 3019, 3020, 3021, 3022,
-    232,  239,  2006, 240,  2007, 2017, 241,  2008, 2018, 2027, 242,  2009,
-    2019, 2028, 2036, 243,  2010, 2020, 2029, 2037, 2044, 244,  83,   84,
-    85,   86,   87,   88,   17,   173,  2473, 185,  29,   173,  2534, 2655,
-    185,  2484, 2765, 2605, 197,  197,  41,   173,  2534, 2655, 185,  2535,
-    4866, 2656, 2765, 2766, 197,  2495, 2864, 2616, 2864, 2865, 2726, 209,
-    209,  209,  53,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766,
-    197,  2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,  2506,
-    2952, 2627, 2952, 2953, 2737, 2952, 2953, 2954, 2836, 221,  221,  221,
-    221,  65,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,
-    2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,  2537, 4868,
-    2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955,
-    221,  2517, 3029, 2638, 3029, 3030, 2748, 3029, 3030, 3031, 2847, 3029,
-    3030, 3031, 3032, 2935, 233,  233,  233,  233,  233,  77,   173,  2534,
-    2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876,
-    4921, 2767, 2864, 2865, 2866, 209,  2537, 4868, 2658, 4877, 4922, 2768,
-    4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221,  2538, 4869, 2659,
-    4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 1603, 2956,
-    3029, 3030, 3031, 3032, 3033, 233,  2528, 3095, 2649, 3095, 3096, 2759,
-    3095, 3096, 3097, 2858, 3095, 3096, 3097, 3098, 2946, 3095, 3096, 3097,
-    3098, 3099, 3023, 245,  245,  245,  245,  245,  245,  89,   173,  251,
-    252,  185,  251,  2072, 252,  253,  253,  197,  251,  2072, 252,  2073,
-    2083, 253,  254,  254,  254,  209,  251,  2072, 252,  2073, 2083, 253,
-    2074, 2084, 2093, 254,  255,  255,  255,  255,  221,  251,  2072, 252,
-    2073, 2083, 253,  2074, 2084, 2093, 254,  2075, 2085, 2094, 2102, 255,
-    256,  256,  256,  256,  256,  233,  251,  2072, 252,  2073, 2083, 253,
-    2074, 2084, 2093, 254,  2075, 2085, 2094, 2102, 255,  2076, 2086, 2095,
-    2103, 2110, 256,  257,  257,  257,  257,  257,  257,  245,  95,   95,
-    96,   95,   96,   97,   95,   96,   97,   98,   95,   96,   97,   98,
-    99,   95,   96,   97,   98,   99,   100,  95,   96,   97,   98,   99,
-    100,  101,  11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,
-    2479, 2600, 180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677,
-    25,   1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,
-    2490, 2611, 181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,
-    1809, 1819, 205,  47,   48,   49,   14,   1612, 2470, 1678, 26,   1622,
-    3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556,
-    1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041,
-    2723, 1810, 1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623,
-    2732, 2733, 194,  2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833,
-    206,  215,  1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,
-    60,   61,   62,   15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689,
-    2482, 3768, 2603, 1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186,
-    3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821,
-    1830, 51,   1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772,
-    3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208,
-    2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904,
-    63,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514,
-    4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636,
-    4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,
-    227,  1940, 228,  1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953,
-    1962, 1970, 231,  71,   72,   73,   74,   75,   16,   1614, 2472, 1680,
-    28,   1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,   1633,
-    3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615,
-    3998, 4043, 2725, 1812, 1822, 1831, 52,   1641, 3346, 3566, 1707, 3391,
-    6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006,
-    4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307,
-    2835, 1878, 1888, 1897, 1905, 64,   1648, 3353, 3573, 1714, 3398, 6202,
-    3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058,
-    4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122,
-    4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446,
-    4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971,
-    1978, 76,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,
-    2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,  2526, 4648,
-    2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944,
-    220,  2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673,
-    4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021, 3022, 232,  239,  2006,
-    240,  2007, 2017, 241,  2008, 2018, 2027, 242,  2009, 2019, 2028, 2036,
-    243,  2010, 2020, 2029, 2037, 2044, 244,  83,   84,   85,   86,   87,
-    88,   17,   1615, 2473, 1681, 29,   1625, 3330, 3550, 1691, 2484, 3770,
-    2605, 1747, 1757, 41,   1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779,
-    3824, 1766, 2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53,
-    1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232,
-    3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219,
-    4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65,   1649,
-    3354, 3574, 1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655,
-    6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715,
-    3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430,
-    2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563,
-    2935, 1945, 1955, 1964, 1972, 1979, 77,   1655, 3360, 3580, 1721, 3405,
-    6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020,
-    4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014,
-    4129, 4240, 4285, 4321, 4349, 1919, 1605, 1605, 1605, 1605, 1605, 1605,
-    1605, 1605, 1605, 1605, 1604, 1604, 1604, 1603, 1604, 1605, 1605, 1605,
-    1605, 1604, 1605, 2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748,
-    2858, 4674, 4719, 4755, 4783, 2946, 1605, 1605, 1605, 1605, 1604, 1605,
-    2011, 2021, 2030, 2038, 2045, 1605, 89,   173,  2534, 2655, 185,  2535,
-    4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876, 4921, 2767, 2864,
-    2865, 2866, 209,  2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966,
-    2867, 2952, 2953, 2954, 2955, 221,  2538, 4869, 2659, 4878, 4923, 2769,
-    4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031,
-    3032, 3033, 233,  2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968,
-    2869, 4894, 4939, 4975, 5003, 2957, 1605, 1605, 1605, 1605, 1604, 1605,
-    3095, 3096, 3097, 3098, 3099, 1605, 245,  251,  2072, 252,  2073, 2083,
-    253,  2074, 2084, 2093, 254,  2075, 2085, 2094, 2102, 255,  2076, 2086,
-    2095, 2103, 2110, 256,  2077, 2087, 2096, 2104, 2111, 1605, 257,  95,
-    96,   97,   98,   99,   100,  101,  18,   174,  2474, 186,  30,   174,
-    2545, 2666, 186,  2485, 2776, 2606, 198,  198,  42,   174,  2545, 2666,
-    186,  2546, 5086, 2667, 2776, 2777, 198,  2496, 2875, 2617, 2875, 2876,
-    2727, 210,  210,  210,  54,   174,  2545, 2666, 186,  2546, 5086, 2667,
-    2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877,
-    210,  2507, 2963, 2628, 2963, 2964, 2738, 2963, 2964, 2965, 2837, 222,
-    222,  222,  222,  66,   174,  2545, 2666, 186,  2546, 5086, 2667, 2776,
-    2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,
-    2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964,
-    2965, 2966, 222,  2518, 3040, 2639, 3040, 3041, 2749, 3040, 3041, 3042,
-    2848, 3040, 3041, 3042, 3043, 2936, 234,  234,  234,  234,  234,  78,
-    174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087,
-    2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097,
-    5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,  2549,
-    5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194,
-    5222, 2967, 3040, 3041, 3042, 3043, 3044, 234,  2529, 3106, 2650, 3106,
-    3107, 2760, 3106, 3107, 3108, 2859, 3106, 3107, 3108, 3109, 2947, 3106,
-    3107, 3108, 3109, 3110, 3024, 246,  246,  246,  246,  246,  246,  90,
-    174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087,
-    2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097,
-    5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,  2549,
-    5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194,
-    5222, 2967, 3040, 3041, 3042, 3043, 3044, 234,  2550, 5090, 2671, 5099,
-    5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 1605,
-    1605, 1605, 1605, 1604, 1605, 3106, 3107, 3108, 3109, 3110, 1605, 246,
-    2540, 3161, 2661, 3161, 3162, 2771, 3161, 3162, 3163, 2870, 3161, 3162,
-    3163, 3164, 2958, 3161, 3162, 3163, 3164, 3165, 3035, 3161, 3162, 3163,
-    3164, 3165, 1605, 3101, 258,  258,  258,  258,  258,  258,  258,  102,
-    174,  263,  264,  186,  263,  2138, 264,  265,  265,  198,  263,  2138,
-    264,  2139, 2149, 265,  266,  266,  266,  210,  263,  2138, 264,  2139,
-    2149, 265,  2140, 2150, 2159, 266,  267,  267,  267,  267,  222,  263,
-    2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,  2141, 2151, 2160,
-    2168, 267,  268,  268,  268,  268,  268,  234,  263,  2138, 264,  2139,
-    2149, 265,  2140, 2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  2142,
-    2152, 2161, 2169, 2176, 268,  269,  269,  269,  269,  269,  269,  246,
-    263,  2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,  2141, 2151,
-    2160, 2168, 267,  2142, 2152, 2161, 2169, 2176, 268,  2143, 2153, 2162,
-    2170, 2177, 1605, 269,  270,  270,  270,  270,  270,  270,  270,  258,
-    107,  107,  108,  107,  108,  109,  107,  108,  109,  110,  107,  108,
-    109,  110,  111,  107,  108,  109,  110,  111,  112,  107,  108,  109,
-    110,  111,  112,  113,  107,  108,  109,  110,  111,  112,  113,  114,
-    11,   167,  179,  23,   12,   175,  2468, 187,  24,   168,  2479, 2600,
-    180,  191,  199,  192,  35,   36,   13,   175,  2469, 187,  25,   175,
-    2556, 2677, 187,  2480, 2787, 2601, 199,  199,  37,   169,  2490, 2611,
-    181,  2491, 2886, 2612, 2721, 2722, 193,  203,  211,  204,  211,  211,
-    205,  47,   48,   49,   14,   175,  2470, 187,  26,   175,  2556, 2677,
-    187,  2481, 2787, 2602, 199,  199,  38,   175,  2556, 2677, 187,  2557,
-    1600, 2678, 2787, 2788, 199,  2492, 2886, 2613, 2886, 2887, 2723, 211,
-    211,  211,  50,   170,  2501, 2622, 182,  2502, 2974, 2623, 2732, 2733,
-    194,  2503, 2974, 2624, 2974, 2975, 2734, 2831, 2832, 2833, 206,  215,
-    223,  216,  223,  223,  217,  223,  223,  223,  218,  59,   60,   61,
-    62,   15,   175,  2471, 187,  27,   175,  2556, 2677, 187,  2482, 2787,
-    2603, 199,  199,  39,   175,  2556, 2677, 187,  2557, 5306, 2678, 2787,
-    2788, 199,  2493, 2886, 2614, 2886, 2887, 2724, 211,  211,  211,  51,
-    175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307,
-    2679, 5316, 1601, 2789, 2886, 2887, 2888, 211,  2504, 2974, 2625, 2974,
-    2975, 2735, 2974, 2975, 2976, 2834, 223,  223,  223,  223,  63,   171,
-    2512, 2633, 183,  2513, 3051, 2634, 2743, 2744, 195,  2514, 3051, 2635,
-    3051, 3052, 2745, 2842, 2843, 2844, 207,  2515, 3051, 2636, 3051, 3052,
-    2746, 3051, 3052, 3053, 2845, 2930, 2931, 2932, 2933, 219,  227,  235,
-    228,  235,  235,  229,  235,  235,  235,  230,  235,  235,  235,  235,
-    231,  71,   72,   73,   74,   75,   16,   175,  2472, 187,  28,   175,
-    2556, 2677, 187,  2483, 2787, 2604, 199,  199,  40,   175,  2556, 2677,
-    187,  2557, 5306, 2678, 2787, 2788, 199,  2494, 2886, 2615, 2886, 2887,
-    2725, 211,  211,  211,  52,   175,  2556, 2677, 187,  2557, 5306, 2678,
-    2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888,
-    211,  2505, 2974, 2626, 2974, 2975, 2736, 2974, 2975, 2976, 2835, 223,
-    223,  223,  223,  64,   175,  2556, 2677, 187,  2557, 5306, 2678, 2787,
-    2788, 199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,
-    2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 1602, 2889, 2974, 2975,
-    2976, 2977, 223,  2516, 3051, 2637, 3051, 3052, 2747, 3051, 3052, 3053,
-    2846, 3051, 3052, 3053, 3054, 2934, 235,  235,  235,  235,  235,  76,
-    172,  2523, 2644, 184,  2524, 3117, 2645, 2754, 2755, 196,  2525, 3117,
-    2646, 3117, 3118, 2756, 2853, 2854, 2855, 208,  2526, 3117, 2647, 3117,
-    3118, 2757, 3117, 3118, 3119, 2856, 2941, 2942, 2943, 2944, 220,  2527,
-    3117, 2648, 3117, 3118, 2758, 3117, 3118, 3119, 2857, 3117, 3118, 3119,
-    3120, 2945, 3018, 3019, 3020, 3021, 3022, 232,  239,  247,  240,  247,
-    247,  241,  247,  247,  247,  242,  247,  247,  247,  247,  243,  247,
-    247,  247,  247,  247,  244,  83,   84,   85,   86,   87,   88,   17,
-    175,  2473, 187,  29,   175,  2556, 2677, 187,  2484, 2787, 2605, 199,
-    199,  41,   175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,
-    2495, 2886, 2616, 2886, 2887, 2726, 211,  211,  211,  53,   175,  2556,
-    2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316,
-    5361, 2789, 2886, 2887, 2888, 211,  2506, 2974, 2627, 2974, 2975, 2737,
-    2974, 2975, 2976, 2836, 223,  223,  223,  223,  65,   175,  2556, 2677,
-    187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361,
-    2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325,
-    5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2517, 3051, 2638, 3051,
-    3052, 2748, 3051, 3052, 3053, 2847, 3051, 3052, 3053, 3054, 2935, 235,
-    235,  235,  235,  235,  77,   175,  2556, 2677, 187,  2557, 5306, 2678,
-    2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888,
-    211,  2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974,
-    2975, 2976, 2977, 223,  2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371,
-    5407, 2890, 5333, 5378, 5414, 1603, 2978, 3051, 3052, 3053, 3054, 3055,
-    235,  2528, 3117, 2649, 3117, 3118, 2759, 3117, 3118, 3119, 2858, 3117,
-    3118, 3119, 3120, 2946, 3117, 3118, 3119, 3120, 3121, 3023, 247,  247,
-    247,  247,  247,  247,  89,   173,  2534, 2655, 185,  2535, 3172, 2656,
-    2765, 2766, 197,  2536, 3172, 2657, 3172, 3173, 2767, 2864, 2865, 2866,
-    209,  2537, 3172, 2658, 3172, 3173, 2768, 3172, 3173, 3174, 2867, 2952,
-    2953, 2954, 2955, 221,  2538, 3172, 2659, 3172, 3173, 2769, 3172, 3173,
-    3174, 2868, 3172, 3173, 3174, 3175, 2956, 3029, 3030, 3031, 3032, 3033,
-    233,  2539, 3172, 2660, 3172, 3173, 2770, 3172, 3173, 3174, 2869, 3172,
-    3173, 3174, 3175, 2957, 3172, 3173, 3174, 3175, 3176, 3034, 3095, 3096,
-    3097, 3098, 3099, 3100, 245,  251,  259,  252,  259,  259,  253,  259,
-    259,  259,  254,  259,  259,  259,  259,  255,  259,  259,  259,  259,
-    259,  256,  259,  259,  259,  259,  259,  259,  257,  95,   96,   97,
-    98,   99,   100,  101,  18,   175,  2474, 187,  30,   175,  2556, 2677,
-    187,  2485, 2787, 2606, 199,  199,  42,   175,  2556, 2677, 187,  2557,
-    5306, 2678, 2787, 2788, 199,  2496, 2886, 2617, 2886, 2887, 2727, 211,
-    211,  211,  54,   175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788,
-    199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,  2507,
-    2974, 2628, 2974, 2975, 2738, 2974, 2975, 2976, 2837, 223,  223,  223,
-    223,  66,   175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,
-    2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,  2559, 5308,
-    2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977,
-    223,  2518, 3051, 2639, 3051, 3052, 2749, 3051, 3052, 3053, 2848, 3051,
-    3052, 3053, 3054, 2936, 235,  235,  235,  235,  235,  78,   175,  2556,
-    2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316,
-    5361, 2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317, 5362, 2790,
-    5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2560, 5309, 2681,
-    5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978,
-    3051, 3052, 3053, 3054, 3055, 235,  2529, 3117, 2650, 3117, 3118, 2760,
-    3117, 3118, 3119, 2859, 3117, 3118, 3119, 3120, 2947, 3117, 3118, 3119,
-    3120, 3121, 3024, 247,  247,  247,  247,  247,  247,  90,   175,  2556,
-    2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316,
-    5361, 2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317, 5362, 2790,
-    5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2560, 5309, 2681,
-    5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978,
-    3051, 3052, 3053, 3054, 3055, 235,  2561, 5310, 2682, 5319, 5364, 2792,
-    5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 1605, 1605, 1605,
-    1605, 1604, 1605, 3117, 3118, 3119, 3120, 3121, 1605, 247,  2540, 3172,
-    2661, 3172, 3173, 2771, 3172, 3173, 3174, 2870, 3172, 3173, 3174, 3175,
-    2958, 3172, 3173, 3174, 3175, 3176, 3035, 3172, 3173, 3174, 3175, 3176,
-    1605, 3101, 259,  259,  259,  259,  259,  259,  259,  102,  174,  2545,
-    2666, 186,  2546, 3216, 2667, 2776, 2777, 198,  2547, 3216, 2668, 3216,
-    3217, 2778, 2875, 2876, 2877, 210,  2548, 3216, 2669, 3216, 3217, 2779,
-    3216, 3217, 3218, 2878, 2963, 2964, 2965, 2966, 222,  2549, 3216, 2670,
-    3216, 3217, 2780, 3216, 3217, 3218, 2879, 3216, 3217, 3218, 3219, 2967,
-    3040, 3041, 3042, 3043, 3044, 234,  2550, 3216, 2671, 3216, 3217, 2781,
-    3216, 3217, 3218, 2880, 3216, 3217, 3218, 3219, 2968, 3216, 3217, 3218,
-    3219, 3220, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246,  2551, 3216,
-    2672, 3216, 3217, 2782, 3216, 3217, 3218, 2881, 3216, 3217, 3218, 3219,
-    2969, 3216, 3217, 3218, 3219, 3220, 3046, 3216, 3217, 3218, 3219, 3220,
-    1605, 3112, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 258,  263,  271,
-    264,  271,  271,  265,  271,  271,  271,  266,  271,  271,  271,  271,
-    267,  271,  271,  271,  271,  271,  268,  271,  271,  271,  271,  271,
-    271,  269,  271,  271,  271,  271,  271,  271,  271,  270,  107,  108,
-    109,  110,  111,  112,  113,  114,  19,   175,  275,  187,  31,   175,
-    275,  276,  187,  275,  277,  276,  199,  199,  43,   175,  275,  276,
-    187,  275,  2204, 276,  277,  277,  199,  275,  278,  276,  278,  278,
-    277,  211,  211,  211,  55,   175,  275,  276,  187,  275,  2204, 276,
-    277,  277,  199,  275,  2204, 276,  2205, 2215, 277,  278,  278,  278,
-    211,  275,  279,  276,  279,  279,  277,  279,  279,  279,  278,  223,
-    223,  223,  223,  67,   175,  275,  276,  187,  275,  2204, 276,  277,
-    277,  199,  275,  2204, 276,  2205, 2215, 277,  278,  278,  278,  211,
-    275,  2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,  279,  279,
-    279,  279,  223,  275,  280,  276,  280,  280,  277,  280,  280,  280,
-    278,  280,  280,  280,  280,  279,  235,  235,  235,  235,  235,  79,
-    175,  275,  276,  187,  275,  2204, 276,  277,  277,  199,  275,  2204,
-    276,  2205, 2215, 277,  278,  278,  278,  211,  275,  2204, 276,  2205,
-    2215, 277,  2206, 2216, 2225, 278,  279,  279,  279,  279,  223,  275,
-    2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226,
-    2234, 279,  280,  280,  280,  280,  280,  235,  275,  281,  276,  281,
-    281,  277,  281,  281,  281,  278,  281,  281,  281,  281,  279,  281,
-    281,  281,  281,  281,  280,  247,  247,  247,  247,  247,  247,  91,
-    175,  275,  276,  187,  275,  2204, 276,  277,  277,  199,  275,  2204,
-    276,  2205, 2215, 277,  278,  278,  278,  211,  275,  2204, 276,  2205,
-    2215, 277,  2206, 2216, 2225, 278,  279,  279,  279,  279,  223,  275,
-    2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226,
-    2234, 279,  280,  280,  280,  280,  280,  235,  275,  2204, 276,  2205,
-    2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226, 2234, 279,  2208,
-    2218, 2227, 2235, 2242, 280,  281,  281,  281,  281,  281,  281,  247,
-    275,  282,  276,  282,  282,  277,  282,  282,  282,  278,  282,  282,
-    282,  282,  279,  282,  282,  282,  282,  282,  280,  282,  282,  282,
-    282,  282,  282,  281,  259,  259,  259,  259,  259,  259,  259,  103,
-    175,  275,  276,  187,  275,  2204, 276,  277,  277,  199,  275,  2204,
-    276,  2205, 2215, 277,  278,  278,  278,  211,  275,  2204, 276,  2205,
-    2215, 277,  2206, 2216, 2225, 278,  279,  279,  279,  279,  223,  275,
-    2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226,
-    2234, 279,  280,  280,  280,  280,  280,  235,  275,  2204, 276,  2205,
-    2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226, 2234, 279,  2208,
-    2218, 2227, 2235, 2242, 280,  281,  281,  281,  281,  281,  281,  247,
-    275,  2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,  2207, 2217,
-    2226, 2234, 279,  2208, 2218, 2227, 2235, 2242, 280,  2209, 2219, 2228,
-    2236, 2243, 1605, 281,  282,  282,  282,  282,  282,  282,  282,  259,
-    275,  283,  276,  283,  283,  277,  283,  283,  283,  278,  283,  283,
-    283,  283,  279,  283,  283,  283,  283,  283,  280,  283,  283,  283,
-    283,  283,  283,  281,  283,  283,  283,  283,  283,  283,  283,  282,
-    271,  271,  271,  271,  271,  271,  271,  271,  115,  119,  119,  119,
-    120,  119,  119,  120,  119,  120,  121,  119,  119,  120,  119,  120,
-    121,  119,  120,  121,  122,  119,  119,  120,  119,  120,  121,  119,
-    120,  121,  122,  119,  120,  121,  122,  123,  119,  119,  120,  119,
-    120,  121,  119,  120,  121,  122,  119,  120,  121,  122,  123,  119,
-    120,  121,  122,  123,  124,  119,  119,  120,  119,  120,  121,  119,
-    120,  121,  122,  119,  120,  121,  122,  123,  119,  120,  121,  122,
-    123,  124,  119,  120,  121,  122,  123,  124,  125,  119,  119,  120,
-    119,  120,  121,  119,  120,  121,  122,  119,  120,  121,  122,  123,
-    119,  120,  121,  122,  123,  124,  119,  120,  121,  122,  123,  124,
-    125,  119,  120,  121,  122,  123,  124,  125,  126,  119,  119,  120,
-    119,  120,  121,  119,  120,  121,  122,  119,  120,  121,  122,  123,
-    119,  120,  121,  122,  123,  124,  119,  120,  121,  122,  123,  124,
-    125,  119,  120,  121,  122,  123,  124,  125,  126,  119,  120,  121,
-    122,  123,  124,  125,  126,  127,  11,   167,  23,   11,   167,  179,
-    23,   12,   168,  2468, 180,  24,   168,  191,  192,  180,  35,   35,
-    36,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479,
-    2600, 180,  191,  1742, 192,  35,   36,   13,   169,  2469, 181,  25,
-    169,  2490, 2611, 181,  2480, 2721, 2601, 193,  193,  37,   169,  203,
-    204,  181,  203,  1808, 204,  205,  205,  193,  47,   47,   48,   47,
-    48,   49,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,
-    2479, 2600, 180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677,
-    25,   1621, 1600, 1600, 1687, 2480, 1600, 2601, 1743, 1753, 37,   169,
-    2490, 2611, 181,  2491, 1600, 2612, 2721, 2722, 193,  203,  1808, 204,
-    1809, 1819, 205,  47,   48,   49,   14,   170,  2470, 182,  26,   170,
-    2501, 2622, 182,  2481, 2732, 2602, 194,  194,  38,   170,  2501, 2622,
-    182,  2502, 1600, 2623, 2732, 2733, 194,  2492, 2831, 2613, 2831, 2832,
-    2723, 206,  206,  206,  50,   170,  215,  216,  182,  215,  1874, 216,
-    217,  217,  194,  215,  1874, 216,  1875, 1885, 217,  218,  218,  218,
-    206,  59,   59,   60,   59,   60,   61,   59,   60,   61,   62,   11,
-    167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,
-    191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326,
-    3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,
-    2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,
-    47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688,
-    2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600,
-    1601, 3776, 1601, 1763, 2492, 3987, 2613, 3996, 1601, 2723, 1810, 1820,
-    1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,
-    2503, 4207, 2624, 4216, 1601, 2734, 2831, 2832, 2833, 206,  215,  1874,
-    216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,   62,
-    15,   171,  2471, 183,  27,   171,  2512, 2633, 183,  2482, 2743, 2603,
-    195,  195,  39,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743, 2744,
-    195,  2493, 2842, 2614, 2842, 2843, 2724, 207,  207,  207,  51,   171,
-    2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635,
-    4436, 1601, 2745, 2842, 2843, 2844, 207,  2504, 2930, 2625, 2930, 2931,
-    2735, 2930, 2931, 2932, 2834, 219,  219,  219,  219,  63,   171,  227,
-    228,  183,  227,  1940, 228,  229,  229,  195,  227,  1940, 228,  1941,
-    1951, 229,  230,  230,  230,  207,  227,  1940, 228,  1941, 1951, 229,
-    1942, 1952, 1961, 230,  231,  231,  231,  231,  219,  71,   71,   72,
-    71,   72,   73,   71,   72,   73,   74,   71,   72,   73,   74,   75,
-    11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600,
-    180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621,
-    3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611,
-    181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819,
-    205,  47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547,
-    1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381,
-    1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810,
-    1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733,
-    194,  2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,  215,
-    1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,
-    62,   15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689, 2482, 3768,
-    2603, 1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777,
-    3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,
-    1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230,
-    3646, 1602, 1601, 1602, 4005, 4050, 1602, 1838, 2504, 4208, 2625, 4217,
-    4262, 2735, 4225, 4270, 1602, 2834, 1877, 1887, 1896, 1904, 63,   171,
-    2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635,
-    4436, 4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636, 4437, 4482,
-    2746, 4445, 4490, 1602, 2845, 2930, 2931, 2932, 2933, 219,  227,  1940,
-    228,  1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953, 1962, 1970,
-    231,  71,   72,   73,   74,   75,   16,   172,  2472, 184,  28,   172,
-    2523, 2644, 184,  2483, 2754, 2604, 196,  196,  40,   172,  2523, 2644,
-    184,  2524, 4646, 2645, 2754, 2755, 196,  2494, 2853, 2615, 2853, 2854,
-    2725, 208,  208,  208,  52,   172,  2523, 2644, 184,  2524, 4646, 2645,
-    2754, 2755, 196,  2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855,
-    208,  2505, 2941, 2626, 2941, 2942, 2736, 2941, 2942, 2943, 2835, 220,
-    220,  220,  220,  64,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754,
-    2755, 196,  2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,
-    2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 1602, 2856, 2941, 2942,
-    2943, 2944, 220,  2516, 3018, 2637, 3018, 3019, 2747, 3018, 3019, 3020,
-    2846, 3018, 3019, 3020, 3021, 2934, 232,  232,  232,  232,  232,  76,
-    172,  239,  240,  184,  239,  2006, 240,  241,  241,  196,  239,  2006,
-    240,  2007, 2017, 241,  242,  242,  242,  208,  239,  2006, 240,  2007,
-    2017, 241,  2008, 2018, 2027, 242,  243,  243,  243,  243,  220,  239,
-    2006, 240,  2007, 2017, 241,  2008, 2018, 2027, 242,  2009, 2019, 2028,
-    2036, 243,  244,  244,  244,  244,  244,  232,  83,   83,   84,   83,
-    84,   85,   83,   84,   85,   86,   83,   84,   85,   86,   87,   83,
-    84,   85,   86,   87,   88,   11,   167,  179,  23,   12,   1610, 2468,
-    1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,   36,   13,
-    1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743,
-    1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612, 2721, 2722, 193,
-    203,  1808, 204,  1809, 1819, 205,  47,   48,   49,   14,   1612, 2470,
-    1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,
-    1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987,
-    2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,   170,  2501, 2622, 182,
-    2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624, 4216, 4261, 2734,
-    2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885, 217,  1876, 1886,
-    1895, 218,  59,   60,   61,   62,   15,   1613, 2471, 1679, 27,   1623,
-    3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39,   1632, 3337, 3557,
-    1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042,
-    2724, 1811, 1821, 1830, 51,   1640, 3345, 3565, 1706, 3390, 6194, 3610,
-    3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086,
-    1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877,
-    1887, 1896, 1904, 63,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743,
-    2744, 195,  2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207,
-    2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931,
-    2932, 2933, 219,  227,  1940, 228,  1941, 1951, 229,  1942, 1952, 1961,
-    230,  1943, 1953, 1962, 1970, 231,  71,   72,   73,   74,   75,   16,
-    1614, 2472, 1680, 28,   1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746,
-    1756, 40,   1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765,
-    2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52,   1641, 3346,
-    3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351,
-    6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736,
-    4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64,   1648, 3353, 3573,
-    1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686,
-    3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 1603,
-    1603, 1602, 1603, 4233, 4278, 4314, 1603, 1912, 2516, 4429, 2637, 4438,
-    4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 1603, 2934, 1944,
-    1954, 1963, 1971, 1978, 76,   172,  2523, 2644, 184,  2524, 4646, 2645,
-    2754, 2755, 196,  2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855,
-    208,  2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941,
-    2942, 2943, 2944, 220,  2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711,
-    4747, 2857, 4673, 4718, 4754, 1603, 2945, 3018, 3019, 3020, 3021, 3022,
-    232,  239,  2006, 240,  2007, 2017, 241,  2008, 2018, 2027, 242,  2009,
-    2019, 2028, 2036, 243,  2010, 2020, 2029, 2037, 2044, 244,  83,   84,
-    85,   86,   87,   88,   17,   173,  2473, 185,  29,   173,  2534, 2655,
-    185,  2484, 2765, 2605, 197,  197,  41,   173,  2534, 2655, 185,  2535,
-    4866, 2656, 2765, 2766, 197,  2495, 2864, 2616, 2864, 2865, 2726, 209,
-    209,  209,  53,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766,
-    197,  2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,  2506,
-    2952, 2627, 2952, 2953, 2737, 2952, 2953, 2954, 2836, 221,  221,  221,
-    221,  65,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,
-    2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,  2537, 4868,
-    2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955,
-    221,  2517, 3029, 2638, 3029, 3030, 2748, 3029, 3030, 3031, 2847, 3029,
-    3030, 3031, 3032, 2935, 233,  233,  233,  233,  233,  77,   173,  2534,
-    2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876,
-    4921, 2767, 2864, 2865, 2866, 209,  2537, 4868, 2658, 4877, 4922, 2768,
-    4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221,  2538, 4869, 2659,
-    4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 1603, 2956,
-    3029, 3030, 3031, 3032, 3033, 233,  2528, 3095, 2649, 3095, 3096, 2759,
-    3095, 3096, 3097, 2858, 3095, 3096, 3097, 3098, 2946, 3095, 3096, 3097,
-    3098, 3099, 3023, 245,  245,  245,  245,  245,  245,  89,   173,  251,
-    252,  185,  251,  2072, 252,  253,  253,  197,  251,  2072, 252,  2073,
-    2083, 253,  254,  254,  254,  209,  251,  2072, 252,  2073, 2083, 253,
-    2074, 2084, 2093, 254,  255,  255,  255,  255,  221,  251,  2072, 252,
-    2073, 2083, 253,  2074, 2084, 2093, 254,  2075, 2085, 2094, 2102, 255,
-    256,  256,  256,  256,  256,  233,  251,  2072, 252,  2073, 2083, 253,
-    2074, 2084, 2093, 254,  2075, 2085, 2094, 2102, 255,  2076, 2086, 2095,
-    2103, 2110, 256,  257,  257,  257,  257,  257,  257,  245,  95,   95,
-    96,   95,   96,   97,   95,   96,   97,   98,   95,   96,   97,   98,
-    99,   95,   96,   97,   98,   99,   100,  95,   96,   97,   98,   99,
-    100,  101,  11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,
-    2479, 2600, 180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677,
-    25,   1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,
-    2490, 2611, 181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,
-    1809, 1819, 205,  47,   48,   49,   14,   1612, 2470, 1678, 26,   1622,
-    3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556,
-    1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041,
-    2723, 1810, 1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623,
-    2732, 2733, 194,  2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833,
-    206,  215,  1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,
-    60,   61,   62,   15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689,
-    2482, 3768, 2603, 1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186,
-    3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821,
-    1830, 51,   1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772,
-    3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208,
-    2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904,
-    63,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514,
-    4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636,
-    4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,
-    227,  1940, 228,  1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953,
-    1962, 1970, 231,  71,   72,   73,   74,   75,   16,   1614, 2472, 1680,
-    28,   1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,   1633,
-    3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615,
-    3998, 4043, 2725, 1812, 1822, 1831, 52,   1641, 3346, 3566, 1707, 3391,
-    6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006,
-    4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307,
-    2835, 1878, 1888, 1897, 1905, 64,   1648, 3353, 3573, 1714, 3398, 6202,
-    3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058,
-    4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122,
-    4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446,
-    4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971,
-    1978, 76,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,
-    2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,  2526, 4648,
-    2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944,
-    220,  2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673,
-    4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021, 3022, 232,  239,  2006,
-    240,  2007, 2017, 241,  2008, 2018, 2027, 242,  2009, 2019, 2028, 2036,
-    243,  2010, 2020, 2029, 2037, 2044, 244,  83,   84,   85,   86,   87,
-    88,   17,   1615, 2473, 1681, 29,   1625, 3330, 3550, 1691, 2484, 3770,
-    2605, 1747, 1757, 41,   1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779,
-    3824, 1766, 2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53,
-    1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232,
-    3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219,
-    4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65,   1649,
-    3354, 3574, 1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655,
-    6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715,
-    3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430,
-    2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563,
-    2935, 1945, 1955, 1964, 1972, 1979, 77,   1655, 3360, 3580, 1721, 3405,
-    6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020,
-    4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014,
-    4129, 4240, 4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930,
-    6498, 6826, 7035, 4150, 1604, 1604, 1604, 1603, 1604, 4460, 4505, 4541,
-    4569, 1604, 1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748,
-    2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725, 4761, 4789, 1604, 3023,
-    2011, 2021, 2030, 2038, 2045, 2051, 89,   173,  2534, 2655, 185,  2535,
-    4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876, 4921, 2767, 2864,
-    2865, 2866, 209,  2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966,
-    2867, 2952, 2953, 2954, 2955, 221,  2538, 4869, 2659, 4878, 4923, 2769,
-    4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031,
-    3032, 3033, 233,  2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968,
-    2869, 4894, 4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009, 1604, 3034,
-    3095, 3096, 3097, 3098, 3099, 3100, 245,  251,  2072, 252,  2073, 2083,
-    253,  2074, 2084, 2093, 254,  2075, 2085, 2094, 2102, 255,  2076, 2086,
-    2095, 2103, 2110, 256,  2077, 2087, 2096, 2104, 2111, 2117, 257,  95,
-    96,   97,   98,   99,   100,  101,  18,   174,  2474, 186,  30,   174,
-    2545, 2666, 186,  2485, 2776, 2606, 198,  198,  42,   174,  2545, 2666,
-    186,  2546, 5086, 2667, 2776, 2777, 198,  2496, 2875, 2617, 2875, 2876,
-    2727, 210,  210,  210,  54,   174,  2545, 2666, 186,  2546, 5086, 2667,
-    2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877,
-    210,  2507, 2963, 2628, 2963, 2964, 2738, 2963, 2964, 2965, 2837, 222,
-    222,  222,  222,  66,   174,  2545, 2666, 186,  2546, 5086, 2667, 2776,
-    2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,
-    2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964,
-    2965, 2966, 222,  2518, 3040, 2639, 3040, 3041, 2749, 3040, 3041, 3042,
-    2848, 3040, 3041, 3042, 3043, 2936, 234,  234,  234,  234,  234,  78,
-    174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087,
-    2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097,
-    5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,  2549,
-    5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194,
-    5222, 2967, 3040, 3041, 3042, 3043, 3044, 234,  2529, 3106, 2650, 3106,
-    3107, 2760, 3106, 3107, 3108, 2859, 3106, 3107, 3108, 3109, 2947, 3106,
-    3107, 3108, 3109, 3110, 3024, 246,  246,  246,  246,  246,  246,  90,
-    174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087,
-    2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097,
-    5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,  2549,
-    5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194,
-    5222, 2967, 3040, 3041, 3042, 3043, 3044, 234,  2550, 5090, 2671, 5099,
-    5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120,
-    5165, 5201, 5229, 1604, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246,
-    2540, 3161, 2661, 3161, 3162, 2771, 3161, 3162, 3163, 2870, 3161, 3162,
-    3163, 3164, 2958, 3161, 3162, 3163, 3164, 3165, 3035, 3161, 3162, 3163,
-    3164, 3165, 3166, 3101, 258,  258,  258,  258,  258,  258,  258,  102,
-    174,  263,  264,  186,  263,  2138, 264,  265,  265,  198,  263,  2138,
-    264,  2139, 2149, 265,  266,  266,  266,  210,  263,  2138, 264,  2139,
-    2149, 265,  2140, 2150, 2159, 266,  267,  267,  267,  267,  222,  263,
-    2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,  2141, 2151, 2160,
-    2168, 267,  268,  268,  268,  268,  268,  234,  263,  2138, 264,  2139,
-    2149, 265,  2140, 2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  2142,
-    2152, 2161, 2169, 2176, 268,  269,  269,  269,  269,  269,  269,  246,
-    263,  2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,  2141, 2151,
-    2160, 2168, 267,  2142, 2152, 2161, 2169, 2176, 268,  2143, 2153, 2162,
-    2170, 2177, 2183, 269,  270,  270,  270,  270,  270,  270,  270,  258,
-    107,  107,  108,  107,  108,  109,  107,  108,  109,  110,  107,  108,
-    109,  110,  111,  107,  108,  109,  110,  111,  112,  107,  108,  109,
-    110,  111,  112,  113,  107,  108,  109,  110,  111,  112,  113,  114,
-    11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600,
-    180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621,
-    3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611,
-    181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819,
-    205,  47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547,
-    1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381,
-    1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810,
-    1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733,
-    194,  2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,  215,
-    1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,
-    62,   15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689, 2482, 3768,
-    2603, 1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777,
-    3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,
-    1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230,
-    3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217,
-    4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63,   171,
-    2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635,
-    4436, 4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636, 4437, 4482,
-    2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,  227,  1940,
-    228,  1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953, 1962, 1970,
-    231,  71,   72,   73,   74,   75,   16,   1614, 2472, 1680, 28,   1624,
-    3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,   1633, 3338, 3558,
-    1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043,
-    2725, 1812, 1822, 1831, 52,   1641, 3346, 3566, 1707, 3391, 6195, 3611,
-    3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087,
-    1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878,
-    1888, 1897, 1905, 64,   1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793,
-    3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846,
-    3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278,
-    4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527,
-    2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76,
-    172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647,
-    2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657,
-    4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220,  2527,
-    4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754,
-    4782, 2945, 3018, 3019, 3020, 3021, 3022, 232,  239,  2006, 240,  2007,
-    2017, 241,  2008, 2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  2010,
-    2020, 2029, 2037, 2044, 244,  83,   84,   85,   86,   87,   88,   17,
-    1615, 2473, 1681, 29,   1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747,
-    1757, 41,   1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766,
-    2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53,   1642, 3347,
-    3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352,
-    6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737,
-    4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65,   1649, 3354, 3574,
-    1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687,
-    3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471,
-    6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439,
-    4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945,
-    1955, 1964, 1972, 1979, 77,   1655, 3360, 3580, 1721, 3405, 6209, 3625,
-    3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101,
-    1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240,
-    4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826,
-    7035, 4150, 6554, 6882, 7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590,
-    1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674,
-    4719, 4755, 4783, 2946, 4680, 4725, 4761, 4789, 4810, 3023, 2011, 2021,
-    2030, 2038, 2045, 2051, 89,   173,  2534, 2655, 185,  2535, 4866, 2656,
-    2765, 2766, 197,  2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866,
-    209,  2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952,
-    2953, 2954, 2955, 221,  2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931,
-    4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033,
-    233,  2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894,
-    4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096,
-    3097, 3098, 3099, 3100, 245,  251,  2072, 252,  2073, 2083, 253,  2074,
-    2084, 2093, 254,  2075, 2085, 2094, 2102, 255,  2076, 2086, 2095, 2103,
-    2110, 256,  2077, 2087, 2096, 2104, 2111, 2117, 257,  95,   96,   97,
-    98,   99,   100,  101,  18,   1616, 2474, 1682, 30,   1626, 3331, 3551,
-    1692, 2485, 3771, 2606, 1748, 1758, 42,   1635, 3340, 3560, 1701, 3385,
-    6189, 3605, 3780, 3825, 1767, 2496, 3991, 2617, 4000, 4045, 2727, 1814,
-    1824, 1833, 54,   1643, 3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833,
-    1775, 3429, 6233, 3649, 6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507,
-    4211, 2628, 4220, 4265, 2738, 4228, 4273, 4309, 2837, 1880, 1890, 1899,
-    1907, 66,   1650, 3355, 3575, 1716, 3400, 6204, 3620, 3795, 3840, 1782,
-    3436, 6240, 3656, 6360, 6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268,
-    3684, 6388, 6716, 3904, 6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344,
-    1914, 2518, 4431, 2639, 4440, 4485, 2749, 4448, 4493, 4529, 2848, 4455,
-    4500, 4536, 4564, 2936, 1946, 1956, 1965, 1973, 1980, 78,   1656, 3361,
-    3581, 1722, 3406, 6210, 3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366,
-    6694, 3882, 4021, 4066, 4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910,
-    6478, 6806, 7015, 4130, 4241, 4286, 4322, 4350, 1920, 3491, 6295, 3711,
-    6415, 6743, 3931, 6499, 6827, 7036, 4151, 6555, 6883, 7092, 7217, 4371,
-    4461, 4506, 4542, 4570, 4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760,
-    4668, 4713, 4749, 2859, 4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762,
-    4790, 4811, 3024, 2012, 2022, 2031, 2039, 2046, 2052, 90,   1661, 3366,
-    3586, 1727, 3411, 6215, 3631, 3806, 3851, 1793, 3447, 6251, 3667, 6371,
-    6699, 3887, 4026, 4071, 4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915,
-    6483, 6811, 7020, 4135, 4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716,
-    6420, 6748, 3936, 6504, 6832, 7041, 4156, 6560, 6888, 7097, 7222, 4376,
-    4466, 4511, 4547, 4575, 4596, 1991, 1606, 1606, 1606, 1606, 1606, 1606,
-    1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1605, 1605, 1605,
-    1605, 1604, 1605, 1606, 1606, 1606, 1606, 1606, 1605, 1606, 2540, 4871,
-    2661, 4880, 4925, 2771, 4888, 4933, 4969, 2870, 4895, 4940, 4976, 5004,
-    2958, 4901, 4946, 4982, 5010, 5031, 3035, 1606, 1606, 1606, 1606, 1606,
-    1605, 1606, 2078, 2088, 2097, 2105, 2112, 2118, 1606, 102,  174,  2545,
-    2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087, 2668, 5096,
-    5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097, 5142, 2779,
-    5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,  2549, 5089, 2670,
-    5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967,
-    3040, 3041, 3042, 3043, 3044, 234,  2550, 5090, 2671, 5099, 5144, 2781,
-    5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201,
-    5229, 5250, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246,  2551, 5091,
-    2672, 5100, 5145, 2782, 5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224,
-    2969, 5121, 5166, 5202, 5230, 5251, 3046, 1606, 1606, 1606, 1606, 1606,
-    1605, 1606, 3161, 3162, 3163, 3164, 3165, 3166, 1606, 258,  263,  2138,
-    264,  2139, 2149, 265,  2140, 2150, 2159, 266,  2141, 2151, 2160, 2168,
-    267,  2142, 2152, 2161, 2169, 2176, 268,  2143, 2153, 2162, 2170, 2177,
-    2183, 269,  2144, 2154, 2163, 2171, 2178, 2184, 1606, 270,  107,  108,
-    109,  110,  111,  112,  113,  114,  19,   175,  2475, 187,  31,   175,
-    2556, 2677, 187,  2486, 2787, 2607, 199,  199,  43,   175,  2556, 2677,
-    187,  2557, 5306, 2678, 2787, 2788, 199,  2497, 2886, 2618, 2886, 2887,
-    2728, 211,  211,  211,  55,   175,  2556, 2677, 187,  2557, 5306, 2678,
-    2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888,
-    211,  2508, 2974, 2629, 2974, 2975, 2739, 2974, 2975, 2976, 2838, 223,
-    223,  223,  223,  67,   175,  2556, 2677, 187,  2557, 5306, 2678, 2787,
-    2788, 199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,
-    2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975,
-    2976, 2977, 223,  2519, 3051, 2640, 3051, 3052, 2750, 3051, 3052, 3053,
-    2849, 3051, 3052, 3053, 3054, 2937, 235,  235,  235,  235,  235,  79,
-    175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307,
-    2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317,
-    5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2560,
-    5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414,
-    5442, 2978, 3051, 3052, 3053, 3054, 3055, 235,  2530, 3117, 2651, 3117,
-    3118, 2761, 3117, 3118, 3119, 2860, 3117, 3118, 3119, 3120, 2948, 3117,
-    3118, 3119, 3120, 3121, 3025, 247,  247,  247,  247,  247,  247,  91,
-    175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307,
-    2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317,
-    5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2560,
-    5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414,
-    5442, 2978, 3051, 3052, 3053, 3054, 3055, 235,  2561, 5310, 2682, 5319,
-    5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340,
-    5385, 5421, 5449, 5470, 3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,
-    2541, 3172, 2662, 3172, 3173, 2772, 3172, 3173, 3174, 2871, 3172, 3173,
-    3174, 3175, 2959, 3172, 3173, 3174, 3175, 3176, 3036, 3172, 3173, 3174,
-    3175, 3176, 3177, 3102, 259,  259,  259,  259,  259,  259,  259,  103,
-    175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307,
-    2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317,
-    5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2560,
-    5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414,
-    5442, 2978, 3051, 3052, 3053, 3054, 3055, 235,  2561, 5310, 2682, 5319,
-    5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340,
-    5385, 5421, 5449, 5470, 3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,
-    2562, 5311, 2683, 5320, 5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380,
-    5416, 5444, 2980, 5341, 5386, 5422, 5450, 5471, 3057, 1606, 1606, 1606,
-    1606, 1606, 1605, 1606, 3172, 3173, 3174, 3175, 3176, 3177, 1606, 259,
-    2552, 3216, 2673, 3216, 3217, 2783, 3216, 3217, 3218, 2882, 3216, 3217,
-    3218, 3219, 2970, 3216, 3217, 3218, 3219, 3220, 3047, 3216, 3217, 3218,
-    3219, 3220, 3221, 3113, 3216, 3217, 3218, 3219, 3220, 3221, 1606, 3168,
-    271,  271,  271,  271,  271,  271,  271,  271,  115,  175,  275,  276,
-    187,  275,  2204, 276,  277,  277,  199,  275,  2204, 276,  2205, 2215,
-    277,  278,  278,  278,  211,  275,  2204, 276,  2205, 2215, 277,  2206,
-    2216, 2225, 278,  279,  279,  279,  279,  223,  275,  2204, 276,  2205,
-    2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226, 2234, 279,  280,
-    280,  280,  280,  280,  235,  275,  2204, 276,  2205, 2215, 277,  2206,
-    2216, 2225, 278,  2207, 2217, 2226, 2234, 279,  2208, 2218, 2227, 2235,
-    2242, 280,  281,  281,  281,  281,  281,  281,  247,  275,  2204, 276,
-    2205, 2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226, 2234, 279,
-    2208, 2218, 2227, 2235, 2242, 280,  2209, 2219, 2228, 2236, 2243, 2249,
-    281,  282,  282,  282,  282,  282,  282,  282,  259,  275,  2204, 276,
-    2205, 2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226, 2234, 279,
-    2208, 2218, 2227, 2235, 2242, 280,  2209, 2219, 2228, 2236, 2243, 2249,
-    281,  2210, 2220, 2229, 2237, 2244, 2250, 1606, 282,  283,  283,  283,
-    283,  283,  283,  283,  283,  271,  119,  119,  120,  119,  120,  121,
-    119,  120,  121,  122,  119,  120,  121,  122,  123,  119,  120,  121,
-    122,  123,  124,  119,  120,  121,  122,  123,  124,  125,  119,  120,
-    121,  122,  123,  124,  125,  126,  119,  120,  121,  122,  123,  124,
-    125,  126,  127,  11,   167,  179,  23,   12,   176,  2468, 188,  24,
-    168,  2479, 2600, 180,  191,  200,  192,  35,   36,   13,   176,  2469,
-    188,  25,   176,  2567, 2688, 188,  2480, 2798, 2601, 200,  200,  37,
-    169,  2490, 2611, 181,  2491, 2897, 2612, 2721, 2722, 193,  203,  212,
-    204,  212,  212,  205,  47,   48,   49,   14,   176,  2470, 188,  26,
-    176,  2567, 2688, 188,  2481, 2798, 2602, 200,  200,  38,   176,  2567,
-    2688, 188,  2568, 1600, 2689, 2798, 2799, 200,  2492, 2897, 2613, 2897,
-    2898, 2723, 212,  212,  212,  50,   170,  2501, 2622, 182,  2502, 2985,
-    2623, 2732, 2733, 194,  2503, 2985, 2624, 2985, 2986, 2734, 2831, 2832,
-    2833, 206,  215,  224,  216,  224,  224,  217,  224,  224,  224,  218,
-    59,   60,   61,   62,   15,   176,  2471, 188,  27,   176,  2567, 2688,
-    188,  2482, 2798, 2603, 200,  200,  39,   176,  2567, 2688, 188,  2568,
-    5526, 2689, 2798, 2799, 200,  2493, 2897, 2614, 2897, 2898, 2724, 212,
-    212,  212,  51,   176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799,
-    200,  2569, 5527, 2690, 5536, 1601, 2800, 2897, 2898, 2899, 212,  2504,
-    2985, 2625, 2985, 2986, 2735, 2985, 2986, 2987, 2834, 224,  224,  224,
-    224,  63,   171,  2512, 2633, 183,  2513, 3062, 2634, 2743, 2744, 195,
-    2514, 3062, 2635, 3062, 3063, 2745, 2842, 2843, 2844, 207,  2515, 3062,
-    2636, 3062, 3063, 2746, 3062, 3063, 3064, 2845, 2930, 2931, 2932, 2933,
-    219,  227,  236,  228,  236,  236,  229,  236,  236,  236,  230,  236,
-    236,  236,  236,  231,  71,   72,   73,   74,   75,   16,   176,  2472,
-    188,  28,   176,  2567, 2688, 188,  2483, 2798, 2604, 200,  200,  40,
-    176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2494, 2897,
-    2615, 2897, 2898, 2725, 212,  212,  212,  52,   176,  2567, 2688, 188,
-    2568, 5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800,
-    2897, 2898, 2899, 212,  2505, 2985, 2626, 2985, 2986, 2736, 2985, 2986,
-    2987, 2835, 224,  224,  224,  224,  64,   176,  2567, 2688, 188,  2568,
-    5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800, 2897,
-    2898, 2899, 212,  2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 1602,
-    2900, 2985, 2986, 2987, 2988, 224,  2516, 3062, 2637, 3062, 3063, 2747,
-    3062, 3063, 3064, 2846, 3062, 3063, 3064, 3065, 2934, 236,  236,  236,
-    236,  236,  76,   172,  2523, 2644, 184,  2524, 3128, 2645, 2754, 2755,
-    196,  2525, 3128, 2646, 3128, 3129, 2756, 2853, 2854, 2855, 208,  2526,
-    3128, 2647, 3128, 3129, 2757, 3128, 3129, 3130, 2856, 2941, 2942, 2943,
-    2944, 220,  2527, 3128, 2648, 3128, 3129, 2758, 3128, 3129, 3130, 2857,
-    3128, 3129, 3130, 3131, 2945, 3018, 3019, 3020, 3021, 3022, 232,  239,
-    248,  240,  248,  248,  241,  248,  248,  248,  242,  248,  248,  248,
-    248,  243,  248,  248,  248,  248,  248,  244,  83,   84,   85,   86,
-    87,   88,   17,   176,  2473, 188,  29,   176,  2567, 2688, 188,  2484,
-    2798, 2605, 200,  200,  41,   176,  2567, 2688, 188,  2568, 5526, 2689,
-    2798, 2799, 200,  2495, 2897, 2616, 2897, 2898, 2726, 212,  212,  212,
-    53,   176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2569,
-    5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2506, 2985, 2627,
-    2985, 2986, 2737, 2985, 2986, 2987, 2836, 224,  224,  224,  224,  65,
-    176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2569, 5527,
-    2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570, 5528, 2691, 5537,
-    5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224,  2517,
-    3062, 2638, 3062, 3063, 2748, 3062, 3063, 3064, 2847, 3062, 3063, 3064,
-    3065, 2935, 236,  236,  236,  236,  236,  77,   176,  2567, 2688, 188,
-    2568, 5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800,
-    2897, 2898, 2899, 212,  2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590,
-    5626, 2900, 2985, 2986, 2987, 2988, 224,  2571, 5529, 2692, 5538, 5583,
-    2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634, 1603, 2989, 3062, 3063,
-    3064, 3065, 3066, 236,  2528, 3128, 2649, 3128, 3129, 2759, 3128, 3129,
-    3130, 2858, 3128, 3129, 3130, 3131, 2946, 3128, 3129, 3130, 3131, 3132,
-    3023, 248,  248,  248,  248,  248,  248,  89,   173,  2534, 2655, 185,
-    2535, 3183, 2656, 2765, 2766, 197,  2536, 3183, 2657, 3183, 3184, 2767,
-    2864, 2865, 2866, 209,  2537, 3183, 2658, 3183, 3184, 2768, 3183, 3184,
-    3185, 2867, 2952, 2953, 2954, 2955, 221,  2538, 3183, 2659, 3183, 3184,
-    2769, 3183, 3184, 3185, 2868, 3183, 3184, 3185, 3186, 2956, 3029, 3030,
-    3031, 3032, 3033, 233,  2539, 3183, 2660, 3183, 3184, 2770, 3183, 3184,
-    3185, 2869, 3183, 3184, 3185, 3186, 2957, 3183, 3184, 3185, 3186, 3187,
-    3034, 3095, 3096, 3097, 3098, 3099, 3100, 245,  251,  260,  252,  260,
-    260,  253,  260,  260,  260,  254,  260,  260,  260,  260,  255,  260,
-    260,  260,  260,  260,  256,  260,  260,  260,  260,  260,  260,  257,
-    95,   96,   97,   98,   99,   100,  101,  18,   176,  2474, 188,  30,
-    176,  2567, 2688, 188,  2485, 2798, 2606, 200,  200,  42,   176,  2567,
-    2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2496, 2897, 2617, 2897,
-    2898, 2727, 212,  212,  212,  54,   176,  2567, 2688, 188,  2568, 5526,
-    2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898,
-    2899, 212,  2507, 2985, 2628, 2985, 2986, 2738, 2985, 2986, 2987, 2837,
-    224,  224,  224,  224,  66,   176,  2567, 2688, 188,  2568, 5526, 2689,
-    2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899,
-    212,  2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985,
-    2986, 2987, 2988, 224,  2518, 3062, 2639, 3062, 3063, 2749, 3062, 3063,
-    3064, 2848, 3062, 3063, 3064, 3065, 2936, 236,  236,  236,  236,  236,
-    78,   176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2569,
-    5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570, 5528, 2691,
-    5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224,
-    2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598,
-    5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2529, 3128, 2650,
-    3128, 3129, 2760, 3128, 3129, 3130, 2859, 3128, 3129, 3130, 3131, 2947,
-    3128, 3129, 3130, 3131, 3132, 3024, 248,  248,  248,  248,  248,  248,
-    90,   176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2569,
-    5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570, 5528, 2691,
-    5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224,
-    2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598,
-    5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2572, 5530, 2693,
-    5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990,
-    5560, 5605, 5641, 5669, 1604, 3067, 3128, 3129, 3130, 3131, 3132, 3133,
-    248,  2540, 3183, 2661, 3183, 3184, 2771, 3183, 3184, 3185, 2870, 3183,
-    3184, 3185, 3186, 2958, 3183, 3184, 3185, 3186, 3187, 3035, 3183, 3184,
-    3185, 3186, 3187, 3188, 3101, 260,  260,  260,  260,  260,  260,  260,
-    102,  174,  2545, 2666, 186,  2546, 3227, 2667, 2776, 2777, 198,  2547,
-    3227, 2668, 3227, 3228, 2778, 2875, 2876, 2877, 210,  2548, 3227, 2669,
-    3227, 3228, 2779, 3227, 3228, 3229, 2878, 2963, 2964, 2965, 2966, 222,
-    2549, 3227, 2670, 3227, 3228, 2780, 3227, 3228, 3229, 2879, 3227, 3228,
-    3229, 3230, 2967, 3040, 3041, 3042, 3043, 3044, 234,  2550, 3227, 2671,
-    3227, 3228, 2781, 3227, 3228, 3229, 2880, 3227, 3228, 3229, 3230, 2968,
-    3227, 3228, 3229, 3230, 3231, 3045, 3106, 3107, 3108, 3109, 3110, 3111,
-    246,  2551, 3227, 2672, 3227, 3228, 2782, 3227, 3228, 3229, 2881, 3227,
-    3228, 3229, 3230, 2969, 3227, 3228, 3229, 3230, 3231, 3046, 3227, 3228,
-    3229, 3230, 3231, 3232, 3112, 3161, 3162, 3163, 3164, 3165, 3166, 3167,
-    258,  263,  272,  264,  272,  272,  265,  272,  272,  272,  266,  272,
-    272,  272,  272,  267,  272,  272,  272,  272,  272,  268,  272,  272,
-    272,  272,  272,  272,  269,  272,  272,  272,  272,  272,  272,  272,
-    270,  107,  108,  109,  110,  111,  112,  113,  114,  19,   176,  2475,
-    188,  31,   176,  2567, 2688, 188,  2486, 2798, 2607, 200,  200,  43,
-    176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2497, 2897,
-    2618, 2897, 2898, 2728, 212,  212,  212,  55,   176,  2567, 2688, 188,
-    2568, 5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800,
-    2897, 2898, 2899, 212,  2508, 2985, 2629, 2985, 2986, 2739, 2985, 2986,
-    2987, 2838, 224,  224,  224,  224,  67,   176,  2567, 2688, 188,  2568,
-    5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800, 2897,
-    2898, 2899, 212,  2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626,
-    2900, 2985, 2986, 2987, 2988, 224,  2519, 3062, 2640, 3062, 3063, 2750,
-    3062, 3063, 3064, 2849, 3062, 3063, 3064, 3065, 2937, 236,  236,  236,
-    236,  236,  79,   176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799,
-    200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570,
-    5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987,
-    2988, 224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901,
-    5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2530,
-    3128, 2651, 3128, 3129, 2761, 3128, 3129, 3130, 2860, 3128, 3129, 3130,
-    3131, 2948, 3128, 3129, 3130, 3131, 3132, 3025, 248,  248,  248,  248,
-    248,  248,  91,   176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799,
-    200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570,
-    5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987,
-    2988, 224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901,
-    5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2572,
-    5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635,
-    5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131,
-    3132, 3133, 248,  2541, 3183, 2662, 3183, 3184, 2772, 3183, 3184, 3185,
-    2871, 3183, 3184, 3185, 3186, 2959, 3183, 3184, 3185, 3186, 3187, 3036,
-    3183, 3184, 3185, 3186, 3187, 3188, 3102, 260,  260,  260,  260,  260,
-    260,  260,  103,  176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799,
-    200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570,
-    5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987,
-    2988, 224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901,
-    5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2572,
-    5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635,
-    5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131,
-    3132, 3133, 248,  2573, 5531, 2694, 5540, 5585, 2804, 5548, 5593, 5629,
-    2903, 5555, 5600, 5636, 5664, 2991, 5561, 5606, 5642, 5670, 5691, 3068,
-    1606, 1606, 1606, 1606, 1606, 1605, 1606, 3183, 3184, 3185, 3186, 3187,
-    3188, 1606, 260,  2552, 3227, 2673, 3227, 3228, 2783, 3227, 3228, 3229,
-    2882, 3227, 3228, 3229, 3230, 2970, 3227, 3228, 3229, 3230, 3231, 3047,
-    3227, 3228, 3229, 3230, 3231, 3232, 3113, 3227, 3228, 3229, 3230, 3231,
-    3232, 1606, 3168, 272,  272,  272,  272,  272,  272,  272,  272,  115,
-    175,  2556, 2677, 187,  2557, 3260, 2678, 2787, 2788, 199,  2558, 3260,
-    2679, 3260, 3261, 2789, 2886, 2887, 2888, 211,  2559, 3260, 2680, 3260,
-    3261, 2790, 3260, 3261, 3262, 2889, 2974, 2975, 2976, 2977, 223,  2560,
-    3260, 2681, 3260, 3261, 2791, 3260, 3261, 3262, 2890, 3260, 3261, 3262,
-    3263, 2978, 3051, 3052, 3053, 3054, 3055, 235,  2561, 3260, 2682, 3260,
-    3261, 2792, 3260, 3261, 3262, 2891, 3260, 3261, 3262, 3263, 2979, 3260,
-    3261, 3262, 3263, 3264, 3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,
-    2562, 3260, 2683, 3260, 3261, 2793, 3260, 3261, 3262, 2892, 3260, 3261,
-    3262, 3263, 2980, 3260, 3261, 3262, 3263, 3264, 3057, 3260, 3261, 3262,
-    3263, 3264, 3265, 3123, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 259,
-    2563, 3260, 2684, 3260, 3261, 2794, 3260, 3261, 3262, 2893, 3260, 3261,
-    3262, 3263, 2981, 3260, 3261, 3262, 3263, 3264, 3058, 3260, 3261, 3262,
-    3263, 3264, 3265, 3124, 3260, 3261, 3262, 3263, 3264, 3265, 1606, 3179,
-    3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 271,  275,  284,  276,
-    284,  284,  277,  284,  284,  284,  278,  284,  284,  284,  284,  279,
-    284,  284,  284,  284,  284,  280,  284,  284,  284,  284,  284,  284,
-    281,  284,  284,  284,  284,  284,  284,  284,  282,  284,  284,  284,
-    284,  284,  284,  284,  284,  283,  119,  120,  121,  122,  123,  124,
-    125,  126,  127,  20,   176,  287,  188,  32,   176,  287,  288,  188,
-    287,  289,  288,  200,  200,  44,   176,  287,  288,  188,  287,  2270,
-    288,  289,  289,  200,  287,  290,  288,  290,  290,  289,  212,  212,
-    212,  56,   176,  287,  288,  188,  287,  2270, 288,  289,  289,  200,
-    287,  2270, 288,  2271, 2281, 289,  290,  290,  290,  212,  287,  291,
-    288,  291,  291,  289,  291,  291,  291,  290,  224,  224,  224,  224,
-    68,   176,  287,  288,  188,  287,  2270, 288,  289,  289,  200,  287,
-    2270, 288,  2271, 2281, 289,  290,  290,  290,  212,  287,  2270, 288,
-    2271, 2281, 289,  2272, 2282, 2291, 290,  291,  291,  291,  291,  224,
-    287,  292,  288,  292,  292,  289,  292,  292,  292,  290,  292,  292,
-    292,  292,  291,  236,  236,  236,  236,  236,  80,   176,  287,  288,
-    188,  287,  2270, 288,  289,  289,  200,  287,  2270, 288,  2271, 2281,
-    289,  290,  290,  290,  212,  287,  2270, 288,  2271, 2281, 289,  2272,
-    2282, 2291, 290,  291,  291,  291,  291,  224,  287,  2270, 288,  2271,
-    2281, 289,  2272, 2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  292,
-    292,  292,  292,  292,  236,  287,  293,  288,  293,  293,  289,  293,
-    293,  293,  290,  293,  293,  293,  293,  291,  293,  293,  293,  293,
-    293,  292,  248,  248,  248,  248,  248,  248,  92,   176,  287,  288,
-    188,  287,  2270, 288,  289,  289,  200,  287,  2270, 288,  2271, 2281,
-    289,  290,  290,  290,  212,  287,  2270, 288,  2271, 2281, 289,  2272,
-    2282, 2291, 290,  291,  291,  291,  291,  224,  287,  2270, 288,  2271,
-    2281, 289,  2272, 2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  292,
-    292,  292,  292,  292,  236,  287,  2270, 288,  2271, 2281, 289,  2272,
-    2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  2274, 2284, 2293, 2301,
-    2308, 292,  293,  293,  293,  293,  293,  293,  248,  287,  294,  288,
-    294,  294,  289,  294,  294,  294,  290,  294,  294,  294,  294,  291,
-    294,  294,  294,  294,  294,  292,  294,  294,  294,  294,  294,  294,
-    293,  260,  260,  260,  260,  260,  260,  260,  104,  176,  287,  288,
-    188,  287,  2270, 288,  289,  289,  200,  287,  2270, 288,  2271, 2281,
-    289,  290,  290,  290,  212,  287,  2270, 288,  2271, 2281, 289,  2272,
-    2282, 2291, 290,  291,  291,  291,  291,  224,  287,  2270, 288,  2271,
-    2281, 289,  2272, 2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  292,
-    292,  292,  292,  292,  236,  287,  2270, 288,  2271, 2281, 289,  2272,
-    2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  2274, 2284, 2293, 2301,
-    2308, 292,  293,  293,  293,  293,  293,  293,  248,  287,  2270, 288,
-    2271, 2281, 289,  2272, 2282, 2291, 290,  2273, 2283, 2292, 2300, 291,
-    2274, 2284, 2293, 2301, 2308, 292,  2275, 2285, 2294, 2302, 2309, 2315,
-    293,  294,  294,  294,  294,  294,  294,  294,  260,  287,  295,  288,
-    295,  295,  289,  295,  295,  295,  290,  295,  295,  295,  295,  291,
-    295,  295,  295,  295,  295,  292,  295,  295,  295,  295,  295,  295,
-    293,  295,  295,  295,  295,  295,  295,  295,  294,  272,  272,  272,
-    272,  272,  272,  272,  272,  116,  176,  287,  288,  188,  287,  2270,
-    288,  289,  289,  200,  287,  2270, 288,  2271, 2281, 289,  290,  290,
-    290,  212,  287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291, 290,
-    291,  291,  291,  291,  224,  287,  2270, 288,  2271, 2281, 289,  2272,
-    2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  292,  292,  292,  292,
-    292,  236,  287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291, 290,
-    2273, 2283, 2292, 2300, 291,  2274, 2284, 2293, 2301, 2308, 292,  293,
-    293,  293,  293,  293,  293,  248,  287,  2270, 288,  2271, 2281, 289,
-    2272, 2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  2274, 2284, 2293,
-    2301, 2308, 292,  2275, 2285, 2294, 2302, 2309, 2315, 293,  294,  294,
-    294,  294,  294,  294,  294,  260,  287,  2270, 288,  2271, 2281, 289,
-    2272, 2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  2274, 2284, 2293,
-    2301, 2308, 292,  2275, 2285, 2294, 2302, 2309, 2315, 293,  2276, 2286,
-    2295, 2303, 2310, 2316, 1606, 294,  295,  295,  295,  295,  295,  295,
-    295,  295,  272,  287,  296,  288,  296,  296,  289,  296,  296,  296,
-    290,  296,  296,  296,  296,  291,  296,  296,  296,  296,  296,  292,
-    296,  296,  296,  296,  296,  296,  293,  296,  296,  296,  296,  296,
-    296,  296,  294,  296,  296,  296,  296,  296,  296,  296,  296,  295,
-    284,  284,  284,  284,  284,  284,  284,  284,  284,  128,  131,  131,
-    131,  132,  131,  131,  132,  131,  132,  133,  131,  131,  132,  131,
-    132,  133,  131,  132,  133,  134,  131,  131,  132,  131,  132,  133,
-    131,  132,  133,  134,  131,  132,  133,  134,  135,  131,  131,  132,
-    131,  132,  133,  131,  132,  133,  134,  131,  132,  133,  134,  135,
-    131,  132,  133,  134,  135,  136,  131,  131,  132,  131,  132,  133,
-    131,  132,  133,  134,  131,  132,  133,  134,  135,  131,  132,  133,
-    134,  135,  136,  131,  132,  133,  134,  135,  136,  137,  131,  131,
-    132,  131,  132,  133,  131,  132,  133,  134,  131,  132,  133,  134,
-    135,  131,  132,  133,  134,  135,  136,  131,  132,  133,  134,  135,
-    136,  137,  131,  132,  133,  134,  135,  136,  137,  138,  131,  131,
-    132,  131,  132,  133,  131,  132,  133,  134,  131,  132,  133,  134,
-    135,  131,  132,  133,  134,  135,  136,  131,  132,  133,  134,  135,
-    136,  137,  131,  132,  133,  134,  135,  136,  137,  138,  131,  132,
-    133,  134,  135,  136,  137,  138,  139,  131,  131,  132,  131,  132,
-    133,  131,  132,  133,  134,  131,  132,  133,  134,  135,  131,  132,
-    133,  134,  135,  136,  131,  132,  133,  134,  135,  136,  137,  131,
-    132,  133,  134,  135,  136,  137,  138,  131,  132,  133,  134,  135,
-    136,  137,  138,  139,  131,  132,  133,  134,  135,  136,  137,  138,
-    139,  140,  11,   167,  23,   11,   167,  179,  23,   12,   168,  2468,
-    180,  24,   168,  191,  192,  180,  35,   35,   36,   11,   167,  179,
-    23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742,
-    192,  35,   36,   13,   169,  2469, 181,  25,   169,  2490, 2611, 181,
-    2480, 2721, 2601, 193,  193,  37,   169,  203,  204,  181,  203,  1808,
-    204,  205,  205,  193,  47,   47,   48,   47,   48,   49,   11,   167,
-    179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,
-    1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 1600, 1600,
-    1687, 2480, 1600, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,  2491,
-    1600, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,  47,
-    48,   49,   14,   170,  2470, 182,  26,   170,  2501, 2622, 182,  2481,
-    2732, 2602, 194,  194,  38,   170,  2501, 2622, 182,  2502, 1600, 2623,
-    2732, 2733, 194,  2492, 2831, 2613, 2831, 2832, 2723, 206,  206,  206,
-    50,   170,  215,  216,  182,  215,  1874, 216,  217,  217,  194,  215,
-    1874, 216,  1875, 1885, 217,  218,  218,  218,  206,  59,   59,   60,
-    59,   60,   61,   59,   60,   61,   62,   11,   167,  179,  23,   12,
-    1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,
-    36,   13,   1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480, 3766,
-    2601, 1743, 1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612, 2721,
-    2722, 193,  203,  1808, 204,  1809, 1819, 205,  47,   48,   49,   14,
-    1612, 2470, 1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744,
-    1754, 38,   1631, 3336, 3556, 1697, 3381, 1600, 1601, 3776, 1601, 1763,
-    2492, 3987, 2613, 3996, 1601, 2723, 1810, 1820, 1829, 50,   170,  2501,
-    2622, 182,  2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624, 4216,
-    1601, 2734, 2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885, 217,
-    1876, 1886, 1895, 218,  59,   60,   61,   62,   15,   171,  2471, 183,
-    27,   171,  2512, 2633, 183,  2482, 2743, 2603, 195,  195,  39,   171,
-    2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2493, 2842, 2614,
-    2842, 2843, 2724, 207,  207,  207,  51,   171,  2512, 2633, 183,  2513,
-    4426, 2634, 2743, 2744, 195,  2514, 4427, 2635, 4436, 1601, 2745, 2842,
-    2843, 2844, 207,  2504, 2930, 2625, 2930, 2931, 2735, 2930, 2931, 2932,
-    2834, 219,  219,  219,  219,  63,   171,  227,  228,  183,  227,  1940,
-    228,  229,  229,  195,  227,  1940, 228,  1941, 1951, 229,  230,  230,
-    230,  207,  227,  1940, 228,  1941, 1951, 229,  1942, 1952, 1961, 230,
-    231,  231,  231,  231,  219,  71,   71,   72,   71,   72,   73,   71,
-    72,   73,   74,   71,   72,   73,   74,   75,   11,   167,  179,  23,
-    12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,
-    35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480,
-    3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612,
-    2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,  47,   48,   49,
-    14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602,
-    1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821,
-    1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,   170,
-    2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624,
-    4216, 4261, 2734, 2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885,
-    217,  1876, 1886, 1895, 218,  59,   60,   61,   62,   15,   1613, 2471,
-    1679, 27,   1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39,
-    1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988,
-    2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,   1640, 3345, 3565, 1706,
-    3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 1602, 1601, 1602,
-    4005, 4050, 1602, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270,
-    1602, 2834, 1877, 1887, 1896, 1904, 63,   171,  2512, 2633, 183,  2513,
-    4426, 2634, 2743, 2744, 195,  2514, 4427, 2635, 4436, 4481, 2745, 2842,
-    2843, 2844, 207,  2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 1602,
-    2845, 2930, 2931, 2932, 2933, 219,  227,  1940, 228,  1941, 1951, 229,
-    1942, 1952, 1961, 230,  1943, 1953, 1962, 1970, 231,  71,   72,   73,
-    74,   75,   16,   172,  2472, 184,  28,   172,  2523, 2644, 184,  2483,
-    2754, 2604, 196,  196,  40,   172,  2523, 2644, 184,  2524, 4646, 2645,
-    2754, 2755, 196,  2494, 2853, 2615, 2853, 2854, 2725, 208,  208,  208,
-    52,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525,
-    4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,  2505, 2941, 2626,
-    2941, 2942, 2736, 2941, 2942, 2943, 2835, 220,  220,  220,  220,  64,
-    172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647,
-    2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657,
-    4702, 2757, 4665, 4710, 1602, 2856, 2941, 2942, 2943, 2944, 220,  2516,
-    3018, 2637, 3018, 3019, 2747, 3018, 3019, 3020, 2846, 3018, 3019, 3020,
-    3021, 2934, 232,  232,  232,  232,  232,  76,   172,  239,  240,  184,
-    239,  2006, 240,  241,  241,  196,  239,  2006, 240,  2007, 2017, 241,
-    242,  242,  242,  208,  239,  2006, 240,  2007, 2017, 241,  2008, 2018,
-    2027, 242,  243,  243,  243,  243,  220,  239,  2006, 240,  2007, 2017,
-    241,  2008, 2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  244,  244,
-    244,  244,  244,  232,  83,   83,   84,   83,   84,   85,   83,   84,
-    85,   86,   83,   84,   85,   86,   87,   83,   84,   85,   86,   87,
-    88,   11,   167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479,
-    2600, 180,  191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,
-    1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490,
-    2611, 181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809,
-    1819, 205,  47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327,
-    3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697,
-    3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723,
-    1810, 1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732,
-    2733, 194,  2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,
-    215,  1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,
-    61,   62,   15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689, 2482,
-    3768, 2603, 1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186, 3602,
-    3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830,
-    51,   1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426,
-    6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625,
-    4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63,
-    171,  2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427,
-    2635, 4436, 4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636, 4437,
-    4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,  227,
-    1940, 228,  1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953, 1962,
-    1970, 231,  71,   72,   73,   74,   75,   16,   1614, 2472, 1680, 28,
-    1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,   1633, 3338,
-    3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998,
-    4043, 2725, 1812, 1822, 1831, 52,   1641, 3346, 3566, 1707, 3391, 6195,
-    3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051,
-    4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835,
-    1878, 1888, 1897, 1905, 64,   1648, 3353, 3573, 1714, 3398, 6202, 3618,
-    3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094,
-    1846, 3462, 6266, 3682, 6386, 6714, 3902, 1603, 1603, 1602, 1603, 4233,
-    4278, 4314, 1603, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491,
-    4527, 2846, 4453, 4498, 4534, 1603, 2934, 1944, 1954, 1963, 1971, 1978,
-    76,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525,
-    4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647,
-    4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220,
-    2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718,
-    4754, 1603, 2945, 3018, 3019, 3020, 3021, 3022, 232,  239,  2006, 240,
-    2007, 2017, 241,  2008, 2018, 2027, 242,  2009, 2019, 2028, 2036, 243,
-    2010, 2020, 2029, 2037, 2044, 244,  83,   84,   85,   86,   87,   88,
-    17,   173,  2473, 185,  29,   173,  2534, 2655, 185,  2484, 2765, 2605,
-    197,  197,  41,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766,
-    197,  2495, 2864, 2616, 2864, 2865, 2726, 209,  209,  209,  53,   173,
-    2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657,
-    4876, 4921, 2767, 2864, 2865, 2866, 209,  2506, 2952, 2627, 2952, 2953,
-    2737, 2952, 2953, 2954, 2836, 221,  221,  221,  221,  65,   173,  2534,
-    2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876,
-    4921, 2767, 2864, 2865, 2866, 209,  2537, 4868, 2658, 4877, 4922, 2768,
-    4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221,  2517, 3029, 2638,
-    3029, 3030, 2748, 3029, 3030, 3031, 2847, 3029, 3030, 3031, 3032, 2935,
-    233,  233,  233,  233,  233,  77,   173,  2534, 2655, 185,  2535, 4866,
-    2656, 2765, 2766, 197,  2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865,
-    2866, 209,  2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867,
-    2952, 2953, 2954, 2955, 221,  2538, 4869, 2659, 4878, 4923, 2769, 4886,
-    4931, 4967, 2868, 4893, 4938, 4974, 1603, 2956, 3029, 3030, 3031, 3032,
-    3033, 233,  2528, 3095, 2649, 3095, 3096, 2759, 3095, 3096, 3097, 2858,
-    3095, 3096, 3097, 3098, 2946, 3095, 3096, 3097, 3098, 3099, 3023, 245,
-    245,  245,  245,  245,  245,  89,   173,  251,  252,  185,  251,  2072,
-    252,  253,  253,  197,  251,  2072, 252,  2073, 2083, 253,  254,  254,
-    254,  209,  251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,
-    255,  255,  255,  255,  221,  251,  2072, 252,  2073, 2083, 253,  2074,
-    2084, 2093, 254,  2075, 2085, 2094, 2102, 255,  256,  256,  256,  256,
-    256,  233,  251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,
-    2075, 2085, 2094, 2102, 255,  2076, 2086, 2095, 2103, 2110, 256,  257,
-    257,  257,  257,  257,  257,  245,  95,   95,   96,   95,   96,   97,
-    95,   96,   97,   98,   95,   96,   97,   98,   99,   95,   96,   97,
-    98,   99,   100,  95,   96,   97,   98,   99,   100,  101,  11,   167,
-    179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,
-    1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326, 3546,
-    1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,  2491,
-    3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,  47,
-    48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688, 2481,
-    3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600, 3601,
-    3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829,
-    50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,  2503,
-    4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,  215,  1874, 216,
-    1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,   62,   15,
-    1613, 2471, 1679, 27,   1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745,
-    1755, 39,   1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764,
-    2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,   1640, 3345,
-    3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350,
-    1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735,
-    4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63,   171,  2512, 2633,
-    183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635, 4436, 4481,
-    2745, 2842, 2843, 2844, 207,  2515, 4428, 2636, 4437, 4482, 2746, 4445,
-    4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,  227,  1940, 228,  1941,
-    1951, 229,  1942, 1952, 1961, 230,  1943, 1953, 1962, 1970, 231,  71,
-    72,   73,   74,   75,   16,   1614, 2472, 1680, 28,   1624, 3329, 3549,
-    1690, 2483, 3769, 2604, 1746, 1756, 40,   1633, 3338, 3558, 1699, 3383,
-    6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812,
-    1822, 1831, 52,   1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831,
-    1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505,
-    4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897,
-    1905, 64,   1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780,
-    3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266,
-    3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342,
-    1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453,
-    4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76,   172,  2523,
-    2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646, 4656,
-    4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657, 4702, 2757,
-    4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220,  2527, 4649, 2648,
-    4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945,
-    3018, 3019, 3020, 3021, 3022, 232,  239,  2006, 240,  2007, 2017, 241,
-    2008, 2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  2010, 2020, 2029,
-    2037, 2044, 244,  83,   84,   85,   86,   87,   88,   17,   1615, 2473,
-    1681, 29,   1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747, 1757, 41,
-    1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990,
-    2616, 3999, 4044, 2726, 1813, 1823, 1832, 53,   1642, 3347, 3567, 1708,
-    3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868,
-    4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272,
-    4308, 2836, 1879, 1889, 1898, 1906, 65,   1649, 3354, 3574, 1715, 3399,
-    6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014,
-    4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008,
-    4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748,
-    4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964,
-    1972, 1979, 77,   1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845,
-    1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469,
-    6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321,
-    4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150,
-    1604, 1604, 1604, 1603, 1604, 4460, 4505, 4541, 4569, 1604, 1985, 2528,
-    4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755,
-    4783, 2946, 4680, 4725, 4761, 4789, 1604, 3023, 2011, 2021, 2030, 2038,
-    2045, 2051, 89,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766,
-    197,  2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,  2537,
-    4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954,
-    2955, 221,  2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868,
-    4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033, 233,  2539,
-    4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975,
-    5003, 2957, 4900, 4945, 4981, 5009, 1604, 3034, 3095, 3096, 3097, 3098,
-    3099, 3100, 245,  251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093,
-    254,  2075, 2085, 2094, 2102, 255,  2076, 2086, 2095, 2103, 2110, 256,
-    2077, 2087, 2096, 2104, 2111, 2117, 257,  95,   96,   97,   98,   99,
-    100,  101,  18,   174,  2474, 186,  30,   174,  2545, 2666, 186,  2485,
-    2776, 2606, 198,  198,  42,   174,  2545, 2666, 186,  2546, 5086, 2667,
-    2776, 2777, 198,  2496, 2875, 2617, 2875, 2876, 2727, 210,  210,  210,
-    54,   174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547,
-    5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2507, 2963, 2628,
-    2963, 2964, 2738, 2963, 2964, 2965, 2837, 222,  222,  222,  222,  66,
-    174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087,
-    2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097,
-    5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,  2518,
-    3040, 2639, 3040, 3041, 2749, 3040, 3041, 3042, 2848, 3040, 3041, 3042,
-    3043, 2936, 234,  234,  234,  234,  234,  78,   174,  2545, 2666, 186,
-    2546, 5086, 2667, 2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778,
-    2875, 2876, 2877, 210,  2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150,
-    5186, 2878, 2963, 2964, 2965, 2966, 222,  2549, 5089, 2670, 5098, 5143,
-    2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041,
-    3042, 3043, 3044, 234,  2529, 3106, 2650, 3106, 3107, 2760, 3106, 3107,
-    3108, 2859, 3106, 3107, 3108, 3109, 2947, 3106, 3107, 3108, 3109, 3110,
-    3024, 246,  246,  246,  246,  246,  246,  90,   174,  2545, 2666, 186,
-    2546, 5086, 2667, 2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778,
-    2875, 2876, 2877, 210,  2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150,
-    5186, 2878, 2963, 2964, 2965, 2966, 222,  2549, 5089, 2670, 5098, 5143,
-    2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041,
-    3042, 3043, 3044, 234,  2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152,
-    5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229, 1604,
-    3045, 3106, 3107, 3108, 3109, 3110, 3111, 246,  2540, 3161, 2661, 3161,
-    3162, 2771, 3161, 3162, 3163, 2870, 3161, 3162, 3163, 3164, 2958, 3161,
-    3162, 3163, 3164, 3165, 3035, 3161, 3162, 3163, 3164, 3165, 3166, 3101,
-    258,  258,  258,  258,  258,  258,  258,  102,  174,  263,  264,  186,
-    263,  2138, 264,  265,  265,  198,  263,  2138, 264,  2139, 2149, 265,
-    266,  266,  266,  210,  263,  2138, 264,  2139, 2149, 265,  2140, 2150,
-    2159, 266,  267,  267,  267,  267,  222,  263,  2138, 264,  2139, 2149,
-    265,  2140, 2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  268,  268,
-    268,  268,  268,  234,  263,  2138, 264,  2139, 2149, 265,  2140, 2150,
-    2159, 266,  2141, 2151, 2160, 2168, 267,  2142, 2152, 2161, 2169, 2176,
-    268,  269,  269,  269,  269,  269,  269,  246,  263,  2138, 264,  2139,
-    2149, 265,  2140, 2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  2142,
-    2152, 2161, 2169, 2176, 268,  2143, 2153, 2162, 2170, 2177, 2183, 269,
-    270,  270,  270,  270,  270,  270,  270,  258,  107,  107,  108,  107,
-    108,  109,  107,  108,  109,  110,  107,  108,  109,  110,  111,  107,
-    108,  109,  110,  111,  112,  107,  108,  109,  110,  111,  112,  113,
-    107,  108,  109,  110,  111,  112,  113,  114,  11,   167,  179,  23,
-    12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,
-    35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480,
-    3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612,
-    2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,  47,   48,   49,
-    14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602,
-    1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821,
-    1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,   170,
-    2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624,
-    4216, 4261, 2734, 2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885,
-    217,  1876, 1886, 1895, 218,  59,   60,   61,   62,   15,   1613, 2471,
-    1679, 27,   1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39,
-    1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988,
-    2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,   1640, 3345, 3565, 1706,
-    3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866,
-    4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270,
-    4306, 2834, 1877, 1887, 1896, 1904, 63,   171,  2512, 2633, 183,  2513,
-    4426, 2634, 2743, 2744, 195,  2514, 4427, 2635, 4436, 4481, 2745, 2842,
-    2843, 2844, 207,  2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526,
-    2845, 2930, 2931, 2932, 2933, 219,  227,  1940, 228,  1941, 1951, 229,
-    1942, 1952, 1961, 230,  1943, 1953, 1962, 1970, 231,  71,   72,   73,
-    74,   75,   16,   1614, 2472, 1680, 28,   1624, 3329, 3549, 1690, 2483,
-    3769, 2604, 1746, 1756, 40,   1633, 3338, 3558, 1699, 3383, 6187, 3603,
-    3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831,
-    52,   1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427,
-    6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626,
-    4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64,
-    1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238,
-    3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386,
-    6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912, 2516,
-    4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534,
-    4562, 2934, 1944, 1954, 1963, 1971, 1978, 76,   172,  2523, 2644, 184,
-    2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646, 4656, 4701, 2756,
-    2853, 2854, 2855, 208,  2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710,
-    4746, 2856, 2941, 2942, 2943, 2944, 220,  2527, 4649, 2648, 4658, 4703,
-    2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019,
-    3020, 3021, 3022, 232,  239,  2006, 240,  2007, 2017, 241,  2008, 2018,
-    2027, 242,  2009, 2019, 2028, 2036, 243,  2010, 2020, 2029, 2037, 2044,
-    244,  83,   84,   85,   86,   87,   88,   17,   1615, 2473, 1681, 29,
-    1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747, 1757, 41,   1634, 3339,
-    3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990, 2616, 3999,
-    4044, 2726, 1813, 1823, 1832, 53,   1642, 3347, 3567, 1708, 3392, 6196,
-    3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052,
-    4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836,
-    1879, 1889, 1898, 1906, 65,   1649, 3354, 3574, 1715, 3399, 6203, 3619,
-    3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059, 4095,
-    1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234,
-    4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492,
-    4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964, 1972, 1979,
-    77,   1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787, 3441,
-    6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689,
-    6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919,
-    3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150, 6554, 6882,
-    7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590, 1985, 2528, 4650, 2649,
-    4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946,
-    4680, 4725, 4761, 4789, 4810, 3023, 2011, 2021, 2030, 2038, 2045, 2051,
-    89,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2536,
-    4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,  2537, 4868, 2658,
-    4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221,
-    2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938,
-    4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033, 233,  2539, 4870, 2660,
-    4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003, 2957,
-    4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096, 3097, 3098, 3099, 3100,
-    245,  251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,  2075,
-    2085, 2094, 2102, 255,  2076, 2086, 2095, 2103, 2110, 256,  2077, 2087,
-    2096, 2104, 2111, 2117, 257,  95,   96,   97,   98,   99,   100,  101,
-    18,   1616, 2474, 1682, 30,   1626, 3331, 3551, 1692, 2485, 3771, 2606,
-    1748, 1758, 42,   1635, 3340, 3560, 1701, 3385, 6189, 3605, 3780, 3825,
-    1767, 2496, 3991, 2617, 4000, 4045, 2727, 1814, 1824, 1833, 54,   1643,
-    3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833, 1775, 3429, 6233, 3649,
-    6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507, 4211, 2628, 4220, 4265,
-    2738, 4228, 4273, 4309, 2837, 1880, 1890, 1899, 1907, 66,   1650, 3355,
-    3575, 1716, 3400, 6204, 3620, 3795, 3840, 1782, 3436, 6240, 3656, 6360,
-    6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268, 3684, 6388, 6716, 3904,
-    6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344, 1914, 2518, 4431, 2639,
-    4440, 4485, 2749, 4448, 4493, 4529, 2848, 4455, 4500, 4536, 4564, 2936,
-    1946, 1956, 1965, 1973, 1980, 78,   1656, 3361, 3581, 1722, 3406, 6210,
-    3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366, 6694, 3882, 4021, 4066,
-    4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910, 6478, 6806, 7015, 4130,
-    4241, 4286, 4322, 4350, 1920, 3491, 6295, 3711, 6415, 6743, 3931, 6499,
-    6827, 7036, 4151, 6555, 6883, 7092, 7217, 4371, 4461, 4506, 4542, 4570,
-    4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760, 4668, 4713, 4749, 2859,
-    4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762, 4790, 4811, 3024, 2012,
-    2022, 2031, 2039, 2046, 2052, 90,   1661, 3366, 3586, 1727, 3411, 6215,
-    3631, 3806, 3851, 1793, 3447, 6251, 3667, 6371, 6699, 3887, 4026, 4071,
-    4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915, 6483, 6811, 7020, 4135,
-    4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716, 6420, 6748, 3936, 6504,
-    6832, 7041, 4156, 6560, 6888, 7097, 7222, 4376, 4466, 4511, 4547, 4575,
-    4596, 1991, 3511, 6315, 3731, 6435, 6763, 3951, 6519, 6847, 7056, 4171,
-    6575, 6903, 7112, 7237, 4391, 1605, 1605, 1605, 1605, 1604, 1605, 4686,
-    4731, 4767, 4795, 4816, 1605, 2057, 2540, 4871, 2661, 4880, 4925, 2771,
-    4888, 4933, 4969, 2870, 4895, 4940, 4976, 5004, 2958, 4901, 4946, 4982,
-    5010, 5031, 3035, 4906, 4951, 4987, 5015, 5036, 1605, 3101, 2078, 2088,
-    2097, 2105, 2112, 2118, 2123, 102,  174,  2545, 2666, 186,  2546, 5086,
-    2667, 2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876,
-    2877, 210,  2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878,
-    2963, 2964, 2965, 2966, 222,  2549, 5089, 2670, 5098, 5143, 2780, 5106,
-    5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043,
-    3044, 234,  2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880,
-    5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229, 5250, 3045, 3106,
-    3107, 3108, 3109, 3110, 3111, 246,  2551, 5091, 2672, 5100, 5145, 2782,
-    5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224, 2969, 5121, 5166, 5202,
-    5230, 5251, 3046, 5126, 5171, 5207, 5235, 5256, 1605, 3112, 3161, 3162,
-    3163, 3164, 3165, 3166, 3167, 258,  263,  2138, 264,  2139, 2149, 265,
-    2140, 2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  2142, 2152, 2161,
-    2169, 2176, 268,  2143, 2153, 2162, 2170, 2177, 2183, 269,  2144, 2154,
-    2163, 2171, 2178, 2184, 2189, 270,  107,  108,  109,  110,  111,  112,
-    113,  114,  19,   175,  2475, 187,  31,   175,  2556, 2677, 187,  2486,
-    2787, 2607, 199,  199,  43,   175,  2556, 2677, 187,  2557, 5306, 2678,
-    2787, 2788, 199,  2497, 2886, 2618, 2886, 2887, 2728, 211,  211,  211,
-    55,   175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558,
-    5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,  2508, 2974, 2629,
-    2974, 2975, 2739, 2974, 2975, 2976, 2838, 223,  223,  223,  223,  67,
-    175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307,
-    2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317,
-    5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2519,
-    3051, 2640, 3051, 3052, 2750, 3051, 3052, 3053, 2849, 3051, 3052, 3053,
-    3054, 2937, 235,  235,  235,  235,  235,  79,   175,  2556, 2677, 187,
-    2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789,
-    2886, 2887, 2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370,
-    5406, 2889, 2974, 2975, 2976, 2977, 223,  2560, 5309, 2681, 5318, 5363,
-    2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052,
-    3053, 3054, 3055, 235,  2530, 3117, 2651, 3117, 3118, 2761, 3117, 3118,
-    3119, 2860, 3117, 3118, 3119, 3120, 2948, 3117, 3118, 3119, 3120, 3121,
-    3025, 247,  247,  247,  247,  247,  247,  91,   175,  2556, 2677, 187,
-    2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789,
-    2886, 2887, 2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370,
-    5406, 2889, 2974, 2975, 2976, 2977, 223,  2560, 5309, 2681, 5318, 5363,
-    2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052,
-    3053, 3054, 3055, 235,  2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372,
-    5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470,
-    3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,  2541, 3172, 2662, 3172,
-    3173, 2772, 3172, 3173, 3174, 2871, 3172, 3173, 3174, 3175, 2959, 3172,
-    3173, 3174, 3175, 3176, 3036, 3172, 3173, 3174, 3175, 3176, 3177, 3102,
-    259,  259,  259,  259,  259,  259,  259,  103,  175,  2556, 2677, 187,
-    2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789,
-    2886, 2887, 2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370,
-    5406, 2889, 2974, 2975, 2976, 2977, 223,  2560, 5309, 2681, 5318, 5363,
-    2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052,
-    3053, 3054, 3055, 235,  2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372,
-    5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470,
-    3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,  2562, 5311, 2683, 5320,
-    5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444, 2980, 5341,
-    5386, 5422, 5450, 5471, 3057, 5346, 5391, 5427, 5455, 5476, 1605, 3123,
-    3172, 3173, 3174, 3175, 3176, 3177, 3178, 259,  2552, 3216, 2673, 3216,
-    3217, 2783, 3216, 3217, 3218, 2882, 3216, 3217, 3218, 3219, 2970, 3216,
-    3217, 3218, 3219, 3220, 3047, 3216, 3217, 3218, 3219, 3220, 3221, 3113,
-    3216, 3217, 3218, 3219, 3220, 3221, 3222, 3168, 271,  271,  271,  271,
-    271,  271,  271,  271,  115,  175,  275,  276,  187,  275,  2204, 276,
-    277,  277,  199,  275,  2204, 276,  2205, 2215, 277,  278,  278,  278,
-    211,  275,  2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,  279,
-    279,  279,  279,  223,  275,  2204, 276,  2205, 2215, 277,  2206, 2216,
-    2225, 278,  2207, 2217, 2226, 2234, 279,  280,  280,  280,  280,  280,
-    235,  275,  2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,  2207,
-    2217, 2226, 2234, 279,  2208, 2218, 2227, 2235, 2242, 280,  281,  281,
-    281,  281,  281,  281,  247,  275,  2204, 276,  2205, 2215, 277,  2206,
-    2216, 2225, 278,  2207, 2217, 2226, 2234, 279,  2208, 2218, 2227, 2235,
-    2242, 280,  2209, 2219, 2228, 2236, 2243, 2249, 281,  282,  282,  282,
-    282,  282,  282,  282,  259,  275,  2204, 276,  2205, 2215, 277,  2206,
-    2216, 2225, 278,  2207, 2217, 2226, 2234, 279,  2208, 2218, 2227, 2235,
-    2242, 280,  2209, 2219, 2228, 2236, 2243, 2249, 281,  2210, 2220, 2229,
-    2237, 2244, 2250, 2255, 282,  283,  283,  283,  283,  283,  283,  283,
-    283,  271,  119,  119,  120,  119,  120,  121,  119,  120,  121,  122,
-    119,  120,  121,  122,  123,  119,  120,  121,  122,  123,  124,  119,
-    120,  121,  122,  123,  124,  125,  119,  120,  121,  122,  123,  124,
-    125,  126,  119,  120,  121,  122,  123,  124,  125,  126,  127,  11,
-    167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,
-    191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326,
-    3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,
-    2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,
-    47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688,
-    2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600,
-    3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820,
-    1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,
-    2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,  215,  1874,
-    216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,   62,
-    15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689, 2482, 3768, 2603,
-    1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822,
-    1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,   1640,
-    3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646,
-    6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262,
-    2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63,   171,  2512,
-    2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635, 4436,
-    4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636, 4437, 4482, 2746,
-    4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,  227,  1940, 228,
-    1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953, 1962, 1970, 231,
-    71,   72,   73,   74,   75,   16,   1614, 2472, 1680, 28,   1624, 3329,
-    3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,   1633, 3338, 3558, 1699,
-    3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725,
-    1812, 1822, 1831, 52,   1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786,
-    3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839,
-    2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888,
-    1897, 1905, 64,   1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838,
-    1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462,
-    6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314,
-    4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846,
-    4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76,   172,
-    2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646,
-    4656, 4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657, 4702,
-    2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220,  2527, 4649,
-    2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 4782,
-    2945, 3018, 3019, 3020, 3021, 3022, 232,  239,  2006, 240,  2007, 2017,
-    241,  2008, 2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  2010, 2020,
-    2029, 2037, 2044, 244,  83,   84,   85,   86,   87,   88,   17,   1615,
-    2473, 1681, 29,   1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747, 1757,
-    41,   1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495,
-    3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53,   1642, 3347, 3567,
-    1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680,
-    3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737, 4227,
-    4272, 4308, 2836, 1879, 1889, 1898, 1906, 65,   1649, 3354, 3574, 1715,
-    3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875,
-    4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799,
-    7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439, 4484,
-    2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955,
-    1964, 1972, 1979, 77,   1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800,
-    3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853,
-    3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240, 4285,
-    4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035,
-    4150, 6554, 6882, 7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590, 1985,
-    2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719,
-    4755, 4783, 2946, 4680, 4725, 4761, 4789, 4810, 3023, 2011, 2021, 2030,
-    2038, 2045, 2051, 89,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765,
-    2766, 197,  2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,
-    2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953,
-    2954, 2955, 221,  2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967,
-    2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033, 233,
-    2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939,
-    4975, 5003, 2957, 4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096, 3097,
-    3098, 3099, 3100, 245,  251,  2072, 252,  2073, 2083, 253,  2074, 2084,
-    2093, 254,  2075, 2085, 2094, 2102, 255,  2076, 2086, 2095, 2103, 2110,
-    256,  2077, 2087, 2096, 2104, 2111, 2117, 257,  95,   96,   97,   98,
-    99,   100,  101,  18,   1616, 2474, 1682, 30,   1626, 3331, 3551, 1692,
-    2485, 3771, 2606, 1748, 1758, 42,   1635, 3340, 3560, 1701, 3385, 6189,
-    3605, 3780, 3825, 1767, 2496, 3991, 2617, 4000, 4045, 2727, 1814, 1824,
-    1833, 54,   1643, 3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833, 1775,
-    3429, 6233, 3649, 6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507, 4211,
-    2628, 4220, 4265, 2738, 4228, 4273, 4309, 2837, 1880, 1890, 1899, 1907,
-    66,   1650, 3355, 3575, 1716, 3400, 6204, 3620, 3795, 3840, 1782, 3436,
-    6240, 3656, 6360, 6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268, 3684,
-    6388, 6716, 3904, 6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344, 1914,
-    2518, 4431, 2639, 4440, 4485, 2749, 4448, 4493, 4529, 2848, 4455, 4500,
-    4536, 4564, 2936, 1946, 1956, 1965, 1973, 1980, 78,   1656, 3361, 3581,
-    1722, 3406, 6210, 3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366, 6694,
-    3882, 4021, 4066, 4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910, 6478,
-    6806, 7015, 4130, 4241, 4286, 4322, 4350, 1920, 3491, 6295, 3711, 6415,
-    6743, 3931, 6499, 6827, 7036, 4151, 6555, 6883, 7092, 7217, 4371, 4461,
-    4506, 4542, 4570, 4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760, 4668,
-    4713, 4749, 2859, 4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762, 4790,
-    4811, 3024, 2012, 2022, 2031, 2039, 2046, 2052, 90,   1661, 3366, 3586,
-    1727, 3411, 6215, 3631, 3806, 3851, 1793, 3447, 6251, 3667, 6371, 6699,
-    3887, 4026, 4071, 4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915, 6483,
-    6811, 7020, 4135, 4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716, 6420,
-    6748, 3936, 6504, 6832, 7041, 4156, 6560, 6888, 7097, 7222, 4376, 4466,
-    4511, 4547, 4575, 4596, 1991, 3511, 6315, 3731, 6435, 6763, 3951, 6519,
-    6847, 7056, 4171, 6575, 6903, 7112, 7237, 4391, 6610, 6938, 7147, 7272,
-    1604, 4611, 4686, 4731, 4767, 4795, 4816, 4831, 2057, 2540, 4871, 2661,
-    4880, 4925, 2771, 4888, 4933, 4969, 2870, 4895, 4940, 4976, 5004, 2958,
-    4901, 4946, 4982, 5010, 5031, 3035, 4906, 4951, 4987, 5015, 5036, 5051,
-    3101, 2078, 2088, 2097, 2105, 2112, 2118, 2123, 102,  174,  2545, 2666,
-    186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087, 2668, 5096, 5141,
-    2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097, 5142, 2779, 5105,
-    5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,  2549, 5089, 2670, 5098,
-    5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040,
-    3041, 3042, 3043, 3044, 234,  2550, 5090, 2671, 5099, 5144, 2781, 5107,
-    5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229,
-    5250, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246,  2551, 5091, 2672,
-    5100, 5145, 2782, 5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224, 2969,
-    5121, 5166, 5202, 5230, 5251, 3046, 5126, 5171, 5207, 5235, 5256, 5271,
-    3112, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 258,  263,  2138, 264,
-    2139, 2149, 265,  2140, 2150, 2159, 266,  2141, 2151, 2160, 2168, 267,
-    2142, 2152, 2161, 2169, 2176, 268,  2143, 2153, 2162, 2170, 2177, 2183,
-    269,  2144, 2154, 2163, 2171, 2178, 2184, 2189, 270,  107,  108,  109,
-    110,  111,  112,  113,  114,  19,   1617, 2475, 1683, 31,   1627, 3332,
-    3552, 1693, 2486, 3772, 2607, 1749, 1759, 43,   1636, 3341, 3561, 1702,
-    3386, 6190, 3606, 3781, 3826, 1768, 2497, 3992, 2618, 4001, 4046, 2728,
-    1815, 1825, 1834, 55,   1644, 3349, 3569, 1710, 3394, 6198, 3614, 3789,
-    3834, 1776, 3430, 6234, 3650, 6354, 6682, 3870, 4009, 4054, 4090, 1842,
-    2508, 4212, 2629, 4221, 4266, 2739, 4229, 4274, 4310, 2838, 1881, 1891,
-    1900, 1908, 67,   1651, 3356, 3576, 1717, 3401, 6205, 3621, 3796, 3841,
-    1783, 3437, 6241, 3657, 6361, 6689, 3877, 4016, 4061, 4097, 1849, 3465,
-    6269, 3685, 6389, 6717, 3905, 6473, 6801, 7010, 4125, 4236, 4281, 4317,
-    4345, 1915, 2519, 4432, 2640, 4441, 4486, 2750, 4449, 4494, 4530, 2849,
-    4456, 4501, 4537, 4565, 2937, 1947, 1957, 1966, 1974, 1981, 79,   1657,
-    3362, 3582, 1723, 3407, 6211, 3627, 3802, 3847, 1789, 3443, 6247, 3663,
-    6367, 6695, 3883, 4022, 4067, 4103, 1855, 3471, 6275, 3691, 6395, 6723,
-    3911, 6479, 6807, 7016, 4131, 4242, 4287, 4323, 4351, 1921, 3492, 6296,
-    3712, 6416, 6744, 3932, 6500, 6828, 7037, 4152, 6556, 6884, 7093, 7218,
-    4372, 4462, 4507, 4543, 4571, 4592, 1987, 2530, 4652, 2651, 4661, 4706,
-    2761, 4669, 4714, 4750, 2860, 4676, 4721, 4757, 4785, 2948, 4682, 4727,
-    4763, 4791, 4812, 3025, 2013, 2023, 2032, 2040, 2047, 2053, 91,   1662,
-    3367, 3587, 1728, 3412, 6216, 3632, 3807, 3852, 1794, 3448, 6252, 3668,
-    6372, 6700, 3888, 4027, 4072, 4108, 1860, 3476, 6280, 3696, 6400, 6728,
-    3916, 6484, 6812, 7021, 4136, 4247, 4292, 4328, 4356, 1926, 3497, 6301,
-    3717, 6421, 6749, 3937, 6505, 6833, 7042, 4157, 6561, 6889, 7098, 7223,
-    4377, 4467, 4512, 4548, 4576, 4597, 1992, 3512, 6316, 3732, 6436, 6764,
-    3952, 6520, 6848, 7057, 4172, 6576, 6904, 7113, 7238, 4392, 6611, 6939,
-    7148, 7273, 7342, 4612, 4687, 4732, 4768, 4796, 4817, 4832, 2058, 2541,
-    4872, 2662, 4881, 4926, 2772, 4889, 4934, 4970, 2871, 4896, 4941, 4977,
-    5005, 2959, 4902, 4947, 4983, 5011, 5032, 3036, 4907, 4952, 4988, 5016,
-    5037, 5052, 3102, 2079, 2089, 2098, 2106, 2113, 2119, 2124, 103,  1666,
-    3371, 3591, 1732, 3416, 6220, 3636, 3811, 3856, 1798, 3452, 6256, 3672,
-    6376, 6704, 3892, 4031, 4076, 4112, 1864, 3480, 6284, 3700, 6404, 6732,
-    3920, 6488, 6816, 7025, 4140, 4251, 4296, 4332, 4360, 1930, 3501, 6305,
-    3721, 6425, 6753, 3941, 6509, 6837, 7046, 4161, 6565, 6893, 7102, 7227,
-    4381, 4471, 4516, 4552, 4580, 4601, 1996, 3516, 6320, 3736, 6440, 6768,
-    3956, 6524, 6852, 7061, 4176, 6580, 6908, 7117, 7242, 4396, 6615, 6943,
-    7152, 7277, 7346, 4616, 4691, 4736, 4772, 4800, 4821, 4836, 2062, 1607,
-    1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607,
-    1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1606, 1606, 1606, 1606,
-    1606, 1605, 1606, 1607, 1607, 1607, 1607, 1607, 1607, 1606, 1607, 2552,
-    5092, 2673, 5101, 5146, 2783, 5109, 5154, 5190, 2882, 5116, 5161, 5197,
-    5225, 2970, 5122, 5167, 5203, 5231, 5252, 3047, 5127, 5172, 5208, 5236,
-    5257, 5272, 3113, 1607, 1607, 1607, 1607, 1607, 1607, 1606, 1607, 2145,
-    2155, 2164, 2172, 2179, 2185, 2190, 1607, 115,  175,  2556, 2677, 187,
-    2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789,
-    2886, 2887, 2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370,
-    5406, 2889, 2974, 2975, 2976, 2977, 223,  2560, 5309, 2681, 5318, 5363,
-    2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052,
-    3053, 3054, 3055, 235,  2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372,
-    5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470,
-    3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,  2562, 5311, 2683, 5320,
-    5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444, 2980, 5341,
-    5386, 5422, 5450, 5471, 3057, 5346, 5391, 5427, 5455, 5476, 5491, 3123,
-    3172, 3173, 3174, 3175, 3176, 3177, 3178, 259,  2563, 5312, 2684, 5321,
-    5366, 2794, 5329, 5374, 5410, 2893, 5336, 5381, 5417, 5445, 2981, 5342,
-    5387, 5423, 5451, 5472, 3058, 5347, 5392, 5428, 5456, 5477, 5492, 3124,
-    1607, 1607, 1607, 1607, 1607, 1607, 1606, 1607, 3216, 3217, 3218, 3219,
-    3220, 3221, 3222, 1607, 271,  275,  2204, 276,  2205, 2215, 277,  2206,
-    2216, 2225, 278,  2207, 2217, 2226, 2234, 279,  2208, 2218, 2227, 2235,
-    2242, 280,  2209, 2219, 2228, 2236, 2243, 2249, 281,  2210, 2220, 2229,
-    2237, 2244, 2250, 2255, 282,  2211, 2221, 2230, 2238, 2245, 2251, 2256,
-    1607, 283,  119,  120,  121,  122,  123,  124,  125,  126,  127,  20,
-    176,  2476, 188,  32,   176,  2567, 2688, 188,  2487, 2798, 2608, 200,
-    200,  44,   176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,
-    2498, 2897, 2619, 2897, 2898, 2729, 212,  212,  212,  56,   176,  2567,
-    2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536,
-    5581, 2800, 2897, 2898, 2899, 212,  2509, 2985, 2630, 2985, 2986, 2740,
-    2985, 2986, 2987, 2839, 224,  224,  224,  224,  68,   176,  2567, 2688,
-    188,  2568, 5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581,
-    2800, 2897, 2898, 2899, 212,  2570, 5528, 2691, 5537, 5582, 2801, 5545,
-    5590, 5626, 2900, 2985, 2986, 2987, 2988, 224,  2520, 3062, 2641, 3062,
-    3063, 2751, 3062, 3063, 3064, 2850, 3062, 3063, 3064, 3065, 2938, 236,
-    236,  236,  236,  236,  80,   176,  2567, 2688, 188,  2568, 5526, 2689,
-    2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899,
-    212,  2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985,
-    2986, 2987, 2988, 224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591,
-    5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066,
-    236,  2531, 3128, 2652, 3128, 3129, 2762, 3128, 3129, 3130, 2861, 3128,
-    3129, 3130, 3131, 2949, 3128, 3129, 3130, 3131, 3132, 3026, 248,  248,
-    248,  248,  248,  248,  92,   176,  2567, 2688, 188,  2568, 5526, 2689,
-    2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899,
-    212,  2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985,
-    2986, 2987, 2988, 224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591,
-    5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066,
-    236,  2572, 5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554,
-    5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129,
-    3130, 3131, 3132, 3133, 248,  2542, 3183, 2663, 3183, 3184, 2773, 3183,
-    3184, 3185, 2872, 3183, 3184, 3185, 3186, 2960, 3183, 3184, 3185, 3186,
-    3187, 3037, 3183, 3184, 3185, 3186, 3187, 3188, 3103, 260,  260,  260,
-    260,  260,  260,  260,  104,  176,  2567, 2688, 188,  2568, 5526, 2689,
-    2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899,
-    212,  2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985,
-    2986, 2987, 2988, 224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591,
-    5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066,
-    236,  2572, 5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554,
-    5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129,
-    3130, 3131, 3132, 3133, 248,  2573, 5531, 2694, 5540, 5585, 2804, 5548,
-    5593, 5629, 2903, 5555, 5600, 5636, 5664, 2991, 5561, 5606, 5642, 5670,
-    5691, 3068, 5566, 5611, 5647, 5675, 5696, 5711, 3134, 3183, 3184, 3185,
-    3186, 3187, 3188, 3189, 260,  2553, 3227, 2674, 3227, 3228, 2784, 3227,
-    3228, 3229, 2883, 3227, 3228, 3229, 3230, 2971, 3227, 3228, 3229, 3230,
-    3231, 3048, 3227, 3228, 3229, 3230, 3231, 3232, 3114, 3227, 3228, 3229,
-    3230, 3231, 3232, 3233, 3169, 272,  272,  272,  272,  272,  272,  272,
-    272,  116,  176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,
-    2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570, 5528,
-    2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988,
-    224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553,
-    5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2572, 5530,
-    2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663,
-    2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131, 3132,
-    3133, 248,  2573, 5531, 2694, 5540, 5585, 2804, 5548, 5593, 5629, 2903,
-    5555, 5600, 5636, 5664, 2991, 5561, 5606, 5642, 5670, 5691, 3068, 5566,
-    5611, 5647, 5675, 5696, 5711, 3134, 3183, 3184, 3185, 3186, 3187, 3188,
-    3189, 260,  2574, 5532, 2695, 5541, 5586, 2805, 5549, 5594, 5630, 2904,
-    5556, 5601, 5637, 5665, 2992, 5562, 5607, 5643, 5671, 5692, 3069, 5567,
-    5612, 5648, 5676, 5697, 5712, 3135, 1607, 1607, 1607, 1607, 1607, 1607,
-    1606, 1607, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 1607, 272,  2564,
-    3260, 2685, 3260, 3261, 2795, 3260, 3261, 3262, 2894, 3260, 3261, 3262,
-    3263, 2982, 3260, 3261, 3262, 3263, 3264, 3059, 3260, 3261, 3262, 3263,
-    3264, 3265, 3125, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3180, 3260,
-    3261, 3262, 3263, 3264, 3265, 3266, 1607, 3224, 284,  284,  284,  284,
-    284,  284,  284,  284,  284,  128,  176,  287,  288,  188,  287,  2270,
-    288,  289,  289,  200,  287,  2270, 288,  2271, 2281, 289,  290,  290,
-    290,  212,  287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291, 290,
-    291,  291,  291,  291,  224,  287,  2270, 288,  2271, 2281, 289,  2272,
-    2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  292,  292,  292,  292,
-    292,  236,  287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291, 290,
-    2273, 2283, 2292, 2300, 291,  2274, 2284, 2293, 2301, 2308, 292,  293,
-    293,  293,  293,  293,  293,  248,  287,  2270, 288,  2271, 2281, 289,
-    2272, 2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  2274, 2284, 2293,
-    2301, 2308, 292,  2275, 2285, 2294, 2302, 2309, 2315, 293,  294,  294,
-    294,  294,  294,  294,  294,  260,  287,  2270, 288,  2271, 2281, 289,
-    2272, 2282, 2291, 290,  2273, 2283, 2292, 2300, 291,  2274, 2284, 2293,
-    2301, 2308, 292,  2275, 2285, 2294, 2302, 2309, 2315, 293,  2276, 2286,
-    2295, 2303, 2310, 2316, 2321, 294,  295,  295,  295,  295,  295,  295,
-    295,  295,  272,  287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291,
-    290,  2273, 2283, 2292, 2300, 291,  2274, 2284, 2293, 2301, 2308, 292,
-    2275, 2285, 2294, 2302, 2309, 2315, 293,  2276, 2286, 2295, 2303, 2310,
-    2316, 2321, 294,  2277, 2287, 2296, 2304, 2311, 2317, 2322, 1607, 295,
-    296,  296,  296,  296,  296,  296,  296,  296,  296,  284,  131,  131,
-    132,  131,  132,  133,  131,  132,  133,  134,  131,  132,  133,  134,
-    135,  131,  132,  133,  134,  135,  136,  131,  132,  133,  134,  135,
-    136,  137,  131,  132,  133,  134,  135,  136,  137,  138,  131,  132,
-    133,  134,  135,  136,  137,  138,  139,  131,  132,  133,  134,  135,
-    136,  137,  138,  139,  140,  11,   167,  179,  23,   12,   177,  2468,
-    189,  24,   168,  2479, 2600, 180,  191,  201,  192,  35,   36,   13,
-    177,  2469, 189,  25,   177,  2578, 2699, 189,  2480, 2809, 2601, 201,
-    201,  37,   169,  2490, 2611, 181,  2491, 2908, 2612, 2721, 2722, 193,
-    203,  213,  204,  213,  213,  205,  47,   48,   49,   14,   177,  2470,
-    189,  26,   177,  2578, 2699, 189,  2481, 2809, 2602, 201,  201,  38,
-    177,  2578, 2699, 189,  2579, 1600, 2700, 2809, 2810, 201,  2492, 2908,
-    2613, 2908, 2909, 2723, 213,  213,  213,  50,   170,  2501, 2622, 182,
-    2502, 2996, 2623, 2732, 2733, 194,  2503, 2996, 2624, 2996, 2997, 2734,
-    2831, 2832, 2833, 206,  215,  225,  216,  225,  225,  217,  225,  225,
-    225,  218,  59,   60,   61,   62,   15,   177,  2471, 189,  27,   177,
-    2578, 2699, 189,  2482, 2809, 2603, 201,  201,  39,   177,  2578, 2699,
-    189,  2579, 5746, 2700, 2809, 2810, 201,  2493, 2908, 2614, 2908, 2909,
-    2724, 213,  213,  213,  51,   177,  2578, 2699, 189,  2579, 5746, 2700,
-    2809, 2810, 201,  2580, 5747, 2701, 5756, 1601, 2811, 2908, 2909, 2910,
-    213,  2504, 2996, 2625, 2996, 2997, 2735, 2996, 2997, 2998, 2834, 225,
-    225,  225,  225,  63,   171,  2512, 2633, 183,  2513, 3073, 2634, 2743,
-    2744, 195,  2514, 3073, 2635, 3073, 3074, 2745, 2842, 2843, 2844, 207,
-    2515, 3073, 2636, 3073, 3074, 2746, 3073, 3074, 3075, 2845, 2930, 2931,
-    2932, 2933, 219,  227,  237,  228,  237,  237,  229,  237,  237,  237,
-    230,  237,  237,  237,  237,  231,  71,   72,   73,   74,   75,   16,
-    177,  2472, 189,  28,   177,  2578, 2699, 189,  2483, 2809, 2604, 201,
-    201,  40,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,
-    2494, 2908, 2615, 2908, 2909, 2725, 213,  213,  213,  52,   177,  2578,
-    2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756,
-    5801, 2811, 2908, 2909, 2910, 213,  2505, 2996, 2626, 2996, 2997, 2736,
-    2996, 2997, 2998, 2835, 225,  225,  225,  225,  64,   177,  2578, 2699,
-    189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756, 5801,
-    2811, 2908, 2909, 2910, 213,  2581, 5748, 2702, 5757, 5802, 2812, 5765,
-    5810, 1602, 2911, 2996, 2997, 2998, 2999, 225,  2516, 3073, 2637, 3073,
-    3074, 2747, 3073, 3074, 3075, 2846, 3073, 3074, 3075, 3076, 2934, 237,
-    237,  237,  237,  237,  76,   172,  2523, 2644, 184,  2524, 3139, 2645,
-    2754, 2755, 196,  2525, 3139, 2646, 3139, 3140, 2756, 2853, 2854, 2855,
-    208,  2526, 3139, 2647, 3139, 3140, 2757, 3139, 3140, 3141, 2856, 2941,
-    2942, 2943, 2944, 220,  2527, 3139, 2648, 3139, 3140, 2758, 3139, 3140,
-    3141, 2857, 3139, 3140, 3141, 3142, 2945, 3018, 3019, 3020, 3021, 3022,
-    232,  239,  249,  240,  249,  249,  241,  249,  249,  249,  242,  249,
-    249,  249,  249,  243,  249,  249,  249,  249,  249,  244,  83,   84,
-    85,   86,   87,   88,   17,   177,  2473, 189,  29,   177,  2578, 2699,
-    189,  2484, 2809, 2605, 201,  201,  41,   177,  2578, 2699, 189,  2579,
-    5746, 2700, 2809, 2810, 201,  2495, 2908, 2616, 2908, 2909, 2726, 213,
-    213,  213,  53,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810,
-    201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,  2506,
-    2996, 2627, 2996, 2997, 2737, 2996, 2997, 2998, 2836, 225,  225,  225,
-    225,  65,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,
-    2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,  2581, 5748,
-    2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999,
-    225,  2517, 3073, 2638, 3073, 3074, 2748, 3073, 3074, 3075, 2847, 3073,
-    3074, 3075, 3076, 2935, 237,  237,  237,  237,  237,  77,   177,  2578,
-    2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756,
-    5801, 2811, 2908, 2909, 2910, 213,  2581, 5748, 2702, 5757, 5802, 2812,
-    5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,  2582, 5749, 2703,
-    5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 1603, 3000,
-    3073, 3074, 3075, 3076, 3077, 237,  2528, 3139, 2649, 3139, 3140, 2759,
-    3139, 3140, 3141, 2858, 3139, 3140, 3141, 3142, 2946, 3139, 3140, 3141,
-    3142, 3143, 3023, 249,  249,  249,  249,  249,  249,  89,   173,  2534,
-    2655, 185,  2535, 3194, 2656, 2765, 2766, 197,  2536, 3194, 2657, 3194,
-    3195, 2767, 2864, 2865, 2866, 209,  2537, 3194, 2658, 3194, 3195, 2768,
-    3194, 3195, 3196, 2867, 2952, 2953, 2954, 2955, 221,  2538, 3194, 2659,
-    3194, 3195, 2769, 3194, 3195, 3196, 2868, 3194, 3195, 3196, 3197, 2956,
-    3029, 3030, 3031, 3032, 3033, 233,  2539, 3194, 2660, 3194, 3195, 2770,
-    3194, 3195, 3196, 2869, 3194, 3195, 3196, 3197, 2957, 3194, 3195, 3196,
-    3197, 3198, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245,  251,  261,
-    252,  261,  261,  253,  261,  261,  261,  254,  261,  261,  261,  261,
-    255,  261,  261,  261,  261,  261,  256,  261,  261,  261,  261,  261,
-    261,  257,  95,   96,   97,   98,   99,   100,  101,  18,   177,  2474,
-    189,  30,   177,  2578, 2699, 189,  2485, 2809, 2606, 201,  201,  42,
-    177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2496, 2908,
-    2617, 2908, 2909, 2727, 213,  213,  213,  54,   177,  2578, 2699, 189,
-    2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756, 5801, 2811,
-    2908, 2909, 2910, 213,  2507, 2996, 2628, 2996, 2997, 2738, 2996, 2997,
-    2998, 2837, 225,  225,  225,  225,  66,   177,  2578, 2699, 189,  2579,
-    5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756, 5801, 2811, 2908,
-    2909, 2910, 213,  2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846,
-    2911, 2996, 2997, 2998, 2999, 225,  2518, 3073, 2639, 3073, 3074, 2749,
-    3073, 3074, 3075, 2848, 3073, 3074, 3075, 3076, 2936, 237,  237,  237,
-    237,  237,  78,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810,
-    201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,  2581,
-    5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998,
-    2999, 225,  2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912,
-    5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237,  2529,
-    3139, 2650, 3139, 3140, 2760, 3139, 3140, 3141, 2859, 3139, 3140, 3141,
-    3142, 2947, 3139, 3140, 3141, 3142, 3143, 3024, 249,  249,  249,  249,
-    249,  249,  90,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810,
-    201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,  2581,
-    5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998,
-    2999, 225,  2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912,
-    5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237,  2583,
-    5750, 2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855,
-    5883, 3001, 5780, 5825, 5861, 5889, 1604, 3078, 3139, 3140, 3141, 3142,
-    3143, 3144, 249,  2540, 3194, 2661, 3194, 3195, 2771, 3194, 3195, 3196,
-    2870, 3194, 3195, 3196, 3197, 2958, 3194, 3195, 3196, 3197, 3198, 3035,
-    3194, 3195, 3196, 3197, 3198, 3199, 3101, 261,  261,  261,  261,  261,
-    261,  261,  102,  174,  2545, 2666, 186,  2546, 3238, 2667, 2776, 2777,
-    198,  2547, 3238, 2668, 3238, 3239, 2778, 2875, 2876, 2877, 210,  2548,
-    3238, 2669, 3238, 3239, 2779, 3238, 3239, 3240, 2878, 2963, 2964, 2965,
-    2966, 222,  2549, 3238, 2670, 3238, 3239, 2780, 3238, 3239, 3240, 2879,
-    3238, 3239, 3240, 3241, 2967, 3040, 3041, 3042, 3043, 3044, 234,  2550,
-    3238, 2671, 3238, 3239, 2781, 3238, 3239, 3240, 2880, 3238, 3239, 3240,
-    3241, 2968, 3238, 3239, 3240, 3241, 3242, 3045, 3106, 3107, 3108, 3109,
-    3110, 3111, 246,  2551, 3238, 2672, 3238, 3239, 2782, 3238, 3239, 3240,
-    2881, 3238, 3239, 3240, 3241, 2969, 3238, 3239, 3240, 3241, 3242, 3046,
-    3238, 3239, 3240, 3241, 3242, 3243, 3112, 3161, 3162, 3163, 3164, 3165,
-    3166, 3167, 258,  263,  273,  264,  273,  273,  265,  273,  273,  273,
-    266,  273,  273,  273,  273,  267,  273,  273,  273,  273,  273,  268,
-    273,  273,  273,  273,  273,  273,  269,  273,  273,  273,  273,  273,
-    273,  273,  270,  107,  108,  109,  110,  111,  112,  113,  114,  19,
-    177,  2475, 189,  31,   177,  2578, 2699, 189,  2486, 2809, 2607, 201,
-    201,  43,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,
-    2497, 2908, 2618, 2908, 2909, 2728, 213,  213,  213,  55,   177,  2578,
-    2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756,
-    5801, 2811, 2908, 2909, 2910, 213,  2508, 2996, 2629, 2996, 2997, 2739,
-    2996, 2997, 2998, 2838, 225,  225,  225,  225,  67,   177,  2578, 2699,
-    189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756, 5801,
-    2811, 2908, 2909, 2910, 213,  2581, 5748, 2702, 5757, 5802, 2812, 5765,
-    5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,  2519, 3073, 2640, 3073,
-    3074, 2750, 3073, 3074, 3075, 2849, 3073, 3074, 3075, 3076, 2937, 237,
-    237,  237,  237,  237,  79,   177,  2578, 2699, 189,  2579, 5746, 2700,
-    2809, 2810, 201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910,
-    213,  2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996,
-    2997, 2998, 2999, 225,  2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811,
-    5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077,
-    237,  2530, 3139, 2651, 3139, 3140, 2761, 3139, 3140, 3141, 2860, 3139,
-    3140, 3141, 3142, 2948, 3139, 3140, 3141, 3142, 3143, 3025, 249,  249,
-    249,  249,  249,  249,  91,   177,  2578, 2699, 189,  2579, 5746, 2700,
-    2809, 2810, 201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910,
-    213,  2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996,
-    2997, 2998, 2999, 225,  2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811,
-    5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077,
-    237,  2583, 5750, 2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774,
-    5819, 5855, 5883, 3001, 5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140,
-    3141, 3142, 3143, 3144, 249,  2541, 3194, 2662, 3194, 3195, 2772, 3194,
-    3195, 3196, 2871, 3194, 3195, 3196, 3197, 2959, 3194, 3195, 3196, 3197,
-    3198, 3036, 3194, 3195, 3196, 3197, 3198, 3199, 3102, 261,  261,  261,
-    261,  261,  261,  261,  103,  177,  2578, 2699, 189,  2579, 5746, 2700,
-    2809, 2810, 201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910,
-    213,  2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996,
-    2997, 2998, 2999, 225,  2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811,
-    5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077,
-    237,  2583, 5750, 2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774,
-    5819, 5855, 5883, 3001, 5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140,
-    3141, 3142, 3143, 3144, 249,  2584, 5751, 2705, 5760, 5805, 2815, 5768,
-    5813, 5849, 2914, 5775, 5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890,
-    5911, 3079, 5786, 5831, 5867, 5895, 5916, 1605, 3145, 3194, 3195, 3196,
-    3197, 3198, 3199, 3200, 261,  2552, 3238, 2673, 3238, 3239, 2783, 3238,
-    3239, 3240, 2882, 3238, 3239, 3240, 3241, 2970, 3238, 3239, 3240, 3241,
-    3242, 3047, 3238, 3239, 3240, 3241, 3242, 3243, 3113, 3238, 3239, 3240,
-    3241, 3242, 3243, 3244, 3168, 273,  273,  273,  273,  273,  273,  273,
-    273,  115,  175,  2556, 2677, 187,  2557, 3271, 2678, 2787, 2788, 199,
-    2558, 3271, 2679, 3271, 3272, 2789, 2886, 2887, 2888, 211,  2559, 3271,
-    2680, 3271, 3272, 2790, 3271, 3272, 3273, 2889, 2974, 2975, 2976, 2977,
-    223,  2560, 3271, 2681, 3271, 3272, 2791, 3271, 3272, 3273, 2890, 3271,
-    3272, 3273, 3274, 2978, 3051, 3052, 3053, 3054, 3055, 235,  2561, 3271,
-    2682, 3271, 3272, 2792, 3271, 3272, 3273, 2891, 3271, 3272, 3273, 3274,
-    2979, 3271, 3272, 3273, 3274, 3275, 3056, 3117, 3118, 3119, 3120, 3121,
-    3122, 247,  2562, 3271, 2683, 3271, 3272, 2793, 3271, 3272, 3273, 2892,
-    3271, 3272, 3273, 3274, 2980, 3271, 3272, 3273, 3274, 3275, 3057, 3271,
-    3272, 3273, 3274, 3275, 3276, 3123, 3172, 3173, 3174, 3175, 3176, 3177,
-    3178, 259,  2563, 3271, 2684, 3271, 3272, 2794, 3271, 3272, 3273, 2893,
-    3271, 3272, 3273, 3274, 2981, 3271, 3272, 3273, 3274, 3275, 3058, 3271,
-    3272, 3273, 3274, 3275, 3276, 3124, 3271, 3272, 3273, 3274, 3275, 3276,
-    3277, 3179, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 271,  275,
-    285,  276,  285,  285,  277,  285,  285,  285,  278,  285,  285,  285,
-    285,  279,  285,  285,  285,  285,  285,  280,  285,  285,  285,  285,
-    285,  285,  281,  285,  285,  285,  285,  285,  285,  285,  282,  285,
-    285,  285,  285,  285,  285,  285,  285,  283,  119,  120,  121,  122,
-    123,  124,  125,  126,  127,  20,   177,  2476, 189,  32,   177,  2578,
-    2699, 189,  2487, 2809, 2608, 201,  201,  44,   177,  2578, 2699, 189,
-    2579, 5746, 2700, 2809, 2810, 201,  2498, 2908, 2619, 2908, 2909, 2729,
-    213,  213,  213,  56,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809,
-    2810, 201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,
-    2509, 2996, 2630, 2996, 2997, 2740, 2996, 2997, 2998, 2839, 225,  225,
-    225,  225,  68,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810,
-    201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,  2581,
-    5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998,
-    2999, 225,  2520, 3073, 2641, 3073, 3074, 2751, 3073, 3074, 3075, 2850,
-    3073, 3074, 3075, 3076, 2938, 237,  237,  237,  237,  237,  80,   177,
-    2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701,
-    5756, 5801, 2811, 2908, 2909, 2910, 213,  2581, 5748, 2702, 5757, 5802,
-    2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,  2582, 5749,
-    2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882,
-    3000, 3073, 3074, 3075, 3076, 3077, 237,  2531, 3139, 2652, 3139, 3140,
-    2762, 3139, 3140, 3141, 2861, 3139, 3140, 3141, 3142, 2949, 3139, 3140,
-    3141, 3142, 3143, 3026, 249,  249,  249,  249,  249,  249,  92,   177,
-    2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701,
-    5756, 5801, 2811, 2908, 2909, 2910, 213,  2581, 5748, 2702, 5757, 5802,
-    2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,  2582, 5749,
-    2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882,
-    3000, 3073, 3074, 3075, 3076, 3077, 237,  2583, 5750, 2704, 5759, 5804,
-    2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825,
-    5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249,  2542,
-    3194, 2663, 3194, 3195, 2773, 3194, 3195, 3196, 2872, 3194, 3195, 3196,
-    3197, 2960, 3194, 3195, 3196, 3197, 3198, 3037, 3194, 3195, 3196, 3197,
-    3198, 3199, 3103, 261,  261,  261,  261,  261,  261,  261,  104,  177,
-    2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701,
-    5756, 5801, 2811, 2908, 2909, 2910, 213,  2581, 5748, 2702, 5757, 5802,
-    2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,  2582, 5749,
-    2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882,
-    3000, 3073, 3074, 3075, 3076, 3077, 237,  2583, 5750, 2704, 5759, 5804,
-    2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825,
-    5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249,  2584,
-    5751, 2705, 5760, 5805, 2815, 5768, 5813, 5849, 2914, 5775, 5820, 5856,
-    5884, 3002, 5781, 5826, 5862, 5890, 5911, 3079, 5786, 5831, 5867, 5895,
-    5916, 5931, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 261,  2553,
-    3238, 2674, 3238, 3239, 2784, 3238, 3239, 3240, 2883, 3238, 3239, 3240,
-    3241, 2971, 3238, 3239, 3240, 3241, 3242, 3048, 3238, 3239, 3240, 3241,
-    3242, 3243, 3114, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3169, 273,
-    273,  273,  273,  273,  273,  273,  273,  116,  177,  2578, 2699, 189,
-    2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756, 5801, 2811,
-    2908, 2909, 2910, 213,  2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810,
-    5846, 2911, 2996, 2997, 2998, 2999, 225,  2582, 5749, 2703, 5758, 5803,
-    2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074,
-    3075, 3076, 3077, 237,  2583, 5750, 2704, 5759, 5804, 2814, 5767, 5812,
-    5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825, 5861, 5889, 5910,
-    3078, 3139, 3140, 3141, 3142, 3143, 3144, 249,  2584, 5751, 2705, 5760,
-    5805, 2815, 5768, 5813, 5849, 2914, 5775, 5820, 5856, 5884, 3002, 5781,
-    5826, 5862, 5890, 5911, 3079, 5786, 5831, 5867, 5895, 5916, 5931, 3145,
-    3194, 3195, 3196, 3197, 3198, 3199, 3200, 261,  2585, 5752, 2706, 5761,
-    5806, 2816, 5769, 5814, 5850, 2915, 5776, 5821, 5857, 5885, 3003, 5782,
-    5827, 5863, 5891, 5912, 3080, 5787, 5832, 5868, 5896, 5917, 5932, 3146,
-    1607, 1607, 1607, 1607, 1607, 1607, 1606, 1607, 3238, 3239, 3240, 3241,
-    3242, 3243, 3244, 1607, 273,  2564, 3271, 2685, 3271, 3272, 2795, 3271,
-    3272, 3273, 2894, 3271, 3272, 3273, 3274, 2982, 3271, 3272, 3273, 3274,
-    3275, 3059, 3271, 3272, 3273, 3274, 3275, 3276, 3125, 3271, 3272, 3273,
-    3274, 3275, 3276, 3277, 3180, 3271, 3272, 3273, 3274, 3275, 3276, 3277,
-    1607, 3224, 285,  285,  285,  285,  285,  285,  285,  285,  285,  128,
-    176,  2567, 2688, 188,  2568, 3293, 2689, 2798, 2799, 200,  2569, 3293,
-    2690, 3293, 3294, 2800, 2897, 2898, 2899, 212,  2570, 3293, 2691, 3293,
-    3294, 2801, 3293, 3294, 3295, 2900, 2985, 2986, 2987, 2988, 224,  2571,
-    3293, 2692, 3293, 3294, 2802, 3293, 3294, 3295, 2901, 3293, 3294, 3295,
-    3296, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2572, 3293, 2693, 3293,
-    3294, 2803, 3293, 3294, 3295, 2902, 3293, 3294, 3295, 3296, 2990, 3293,
-    3294, 3295, 3296, 3297, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248,
-    2573, 3293, 2694, 3293, 3294, 2804, 3293, 3294, 3295, 2903, 3293, 3294,
-    3295, 3296, 2991, 3293, 3294, 3295, 3296, 3297, 3068, 3293, 3294, 3295,
-    3296, 3297, 3298, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260,
-    2574, 3293, 2695, 3293, 3294, 2805, 3293, 3294, 3295, 2904, 3293, 3294,
-    3295, 3296, 2992, 3293, 3294, 3295, 3296, 3297, 3069, 3293, 3294, 3295,
-    3296, 3297, 3298, 3135, 3293, 3294, 3295, 3296, 3297, 3298, 3299, 3190,
-    3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 272,  2575, 3293, 2696,
-    3293, 3294, 2806, 3293, 3294, 3295, 2905, 3293, 3294, 3295, 3296, 2993,
-    3293, 3294, 3295, 3296, 3297, 3070, 3293, 3294, 3295, 3296, 3297, 3298,
-    3136, 3293, 3294, 3295, 3296, 3297, 3298, 3299, 3191, 3293, 3294, 3295,
-    3296, 3297, 3298, 3299, 1607, 3235, 3260, 3261, 3262, 3263, 3264, 3265,
-    3266, 3267, 3268, 284,  287,  297,  288,  297,  297,  289,  297,  297,
-    297,  290,  297,  297,  297,  297,  291,  297,  297,  297,  297,  297,
-    292,  297,  297,  297,  297,  297,  297,  293,  297,  297,  297,  297,
-    297,  297,  297,  294,  297,  297,  297,  297,  297,  297,  297,  297,
-    295,  297,  297,  297,  297,  297,  297,  297,  297,  297,  296,  131,
-    132,  133,  134,  135,  136,  137,  138,  139,  140,  21,   177,  299,
-    189,  33,   177,  299,  300,  189,  299,  301,  300,  201,  201,  45,
-    177,  299,  300,  189,  299,  2336, 300,  301,  301,  201,  299,  302,
-    300,  302,  302,  301,  213,  213,  213,  57,   177,  299,  300,  189,
-    299,  2336, 300,  301,  301,  201,  299,  2336, 300,  2337, 2347, 301,
-    302,  302,  302,  213,  299,  303,  300,  303,  303,  301,  303,  303,
-    303,  302,  225,  225,  225,  225,  69,   177,  299,  300,  189,  299,
-    2336, 300,  301,  301,  201,  299,  2336, 300,  2337, 2347, 301,  302,
-    302,  302,  213,  299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357,
-    302,  303,  303,  303,  303,  225,  299,  304,  300,  304,  304,  301,
-    304,  304,  304,  302,  304,  304,  304,  304,  303,  237,  237,  237,
-    237,  237,  81,   177,  299,  300,  189,  299,  2336, 300,  301,  301,
-    201,  299,  2336, 300,  2337, 2347, 301,  302,  302,  302,  213,  299,
-    2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  303,  303,  303,
-    303,  225,  299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,
-    2339, 2349, 2358, 2366, 303,  304,  304,  304,  304,  304,  237,  299,
-    305,  300,  305,  305,  301,  305,  305,  305,  302,  305,  305,  305,
-    305,  303,  305,  305,  305,  305,  305,  304,  249,  249,  249,  249,
-    249,  249,  93,   177,  299,  300,  189,  299,  2336, 300,  301,  301,
-    201,  299,  2336, 300,  2337, 2347, 301,  302,  302,  302,  213,  299,
-    2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  303,  303,  303,
-    303,  225,  299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,
-    2339, 2349, 2358, 2366, 303,  304,  304,  304,  304,  304,  237,  299,
-    2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349, 2358,
-    2366, 303,  2340, 2350, 2359, 2367, 2374, 304,  305,  305,  305,  305,
-    305,  305,  249,  299,  306,  300,  306,  306,  301,  306,  306,  306,
-    302,  306,  306,  306,  306,  303,  306,  306,  306,  306,  306,  304,
-    306,  306,  306,  306,  306,  306,  305,  261,  261,  261,  261,  261,
-    261,  261,  105,  177,  299,  300,  189,  299,  2336, 300,  301,  301,
-    201,  299,  2336, 300,  2337, 2347, 301,  302,  302,  302,  213,  299,
-    2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  303,  303,  303,
-    303,  225,  299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,
-    2339, 2349, 2358, 2366, 303,  304,  304,  304,  304,  304,  237,  299,
-    2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349, 2358,
-    2366, 303,  2340, 2350, 2359, 2367, 2374, 304,  305,  305,  305,  305,
-    305,  305,  249,  299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357,
-    302,  2339, 2349, 2358, 2366, 303,  2340, 2350, 2359, 2367, 2374, 304,
-    2341, 2351, 2360, 2368, 2375, 2381, 305,  306,  306,  306,  306,  306,
-    306,  306,  261,  299,  307,  300,  307,  307,  301,  307,  307,  307,
-    302,  307,  307,  307,  307,  303,  307,  307,  307,  307,  307,  304,
-    307,  307,  307,  307,  307,  307,  305,  307,  307,  307,  307,  307,
-    307,  307,  306,  273,  273,  273,  273,  273,  273,  273,  273,  117,
-    177,  299,  300,  189,  299,  2336, 300,  301,  301,  201,  299,  2336,
-    300,  2337, 2347, 301,  302,  302,  302,  213,  299,  2336, 300,  2337,
-    2347, 301,  2338, 2348, 2357, 302,  303,  303,  303,  303,  225,  299,
-    2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349, 2358,
-    2366, 303,  304,  304,  304,  304,  304,  237,  299,  2336, 300,  2337,
-    2347, 301,  2338, 2348, 2357, 302,  2339, 2349, 2358, 2366, 303,  2340,
-    2350, 2359, 2367, 2374, 304,  305,  305,  305,  305,  305,  305,  249,
-    299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349,
-    2358, 2366, 303,  2340, 2350, 2359, 2367, 2374, 304,  2341, 2351, 2360,
-    2368, 2375, 2381, 305,  306,  306,  306,  306,  306,  306,  306,  261,
-    299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349,
-    2358, 2366, 303,  2340, 2350, 2359, 2367, 2374, 304,  2341, 2351, 2360,
-    2368, 2375, 2381, 305,  2342, 2352, 2361, 2369, 2376, 2382, 2387, 306,
-    307,  307,  307,  307,  307,  307,  307,  307,  273,  299,  308,  300,
-    308,  308,  301,  308,  308,  308,  302,  308,  308,  308,  308,  303,
-    308,  308,  308,  308,  308,  304,  308,  308,  308,  308,  308,  308,
-    305,  308,  308,  308,  308,  308,  308,  308,  306,  308,  308,  308,
-    308,  308,  308,  308,  308,  307,  285,  285,  285,  285,  285,  285,
-    285,  285,  285,  129,  177,  299,  300,  189,  299,  2336, 300,  301,
-    301,  201,  299,  2336, 300,  2337, 2347, 301,  302,  302,  302,  213,
-    299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  303,  303,
-    303,  303,  225,  299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357,
-    302,  2339, 2349, 2358, 2366, 303,  304,  304,  304,  304,  304,  237,
-    299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349,
-    2358, 2366, 303,  2340, 2350, 2359, 2367, 2374, 304,  305,  305,  305,
-    305,  305,  305,  249,  299,  2336, 300,  2337, 2347, 301,  2338, 2348,
-    2357, 302,  2339, 2349, 2358, 2366, 303,  2340, 2350, 2359, 2367, 2374,
-    304,  2341, 2351, 2360, 2368, 2375, 2381, 305,  306,  306,  306,  306,
-    306,  306,  306,  261,  299,  2336, 300,  2337, 2347, 301,  2338, 2348,
-    2357, 302,  2339, 2349, 2358, 2366, 303,  2340, 2350, 2359, 2367, 2374,
-    304,  2341, 2351, 2360, 2368, 2375, 2381, 305,  2342, 2352, 2361, 2369,
-    2376, 2382, 2387, 306,  307,  307,  307,  307,  307,  307,  307,  307,
-    273,  299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339,
-    2349, 2358, 2366, 303,  2340, 2350, 2359, 2367, 2374, 304,  2341, 2351,
-    2360, 2368, 2375, 2381, 305,  2342, 2352, 2361, 2369, 2376, 2382, 2387,
-    306,  2343, 2353, 2362, 2370, 2377, 2383, 2388, 1607, 307,  308,  308,
-    308,  308,  308,  308,  308,  308,  308,  285,  299,  309,  300,  309,
-    309,  301,  309,  309,  309,  302,  309,  309,  309,  309,  303,  309,
-    309,  309,  309,  309,  304,  309,  309,  309,  309,  309,  309,  305,
-    309,  309,  309,  309,  309,  309,  309,  306,  309,  309,  309,  309,
-    309,  309,  309,  309,  307,  309,  309,  309,  309,  309,  309,  309,
-    309,  309,  308,  297,  297,  297,  297,  297,  297,  297,  297,  297,
-    297,  141,  143,  143,  143,  144,  143,  143,  144,  143,  144,  145,
-    143,  143,  144,  143,  144,  145,  143,  144,  145,  146,  143,  143,
-    144,  143,  144,  145,  143,  144,  145,  146,  143,  144,  145,  146,
-    147,  143,  143,  144,  143,  144,  145,  143,  144,  145,  146,  143,
-    144,  145,  146,  147,  143,  144,  145,  146,  147,  148,  143,  143,
-    144,  143,  144,  145,  143,  144,  145,  146,  143,  144,  145,  146,
-    147,  143,  144,  145,  146,  147,  148,  143,  144,  145,  146,  147,
-    148,  149,  143,  143,  144,  143,  144,  145,  143,  144,  145,  146,
-    143,  144,  145,  146,  147,  143,  144,  145,  146,  147,  148,  143,
-    144,  145,  146,  147,  148,  149,  143,  144,  145,  146,  147,  148,
-    149,  150,  143,  143,  144,  143,  144,  145,  143,  144,  145,  146,
-    143,  144,  145,  146,  147,  143,  144,  145,  146,  147,  148,  143,
-    144,  145,  146,  147,  148,  149,  143,  144,  145,  146,  147,  148,
-    149,  150,  143,  144,  145,  146,  147,  148,  149,  150,  151,  143,
-    143,  144,  143,  144,  145,  143,  144,  145,  146,  143,  144,  145,
-    146,  147,  143,  144,  145,  146,  147,  148,  143,  144,  145,  146,
-    147,  148,  149,  143,  144,  145,  146,  147,  148,  149,  150,  143,
-    144,  145,  146,  147,  148,  149,  150,  151,  143,  144,  145,  146,
-    147,  148,  149,  150,  151,  152,  143,  143,  144,  143,  144,  145,
-    143,  144,  145,  146,  143,  144,  145,  146,  147,  143,  144,  145,
-    146,  147,  148,  143,  144,  145,  146,  147,  148,  149,  143,  144,
-    145,  146,  147,  148,  149,  150,  143,  144,  145,  146,  147,  148,
-    149,  150,  151,  143,  144,  145,  146,  147,  148,  149,  150,  151,
-    152,  143,  144,  145,  146,  147,  148,  149,  150,  151,  152,  153,
-    11,   167,  23,   11,   167,  179,  23,   12,   168,  2468, 180,  24,
-    168,  191,  192,  180,  35,   35,   36,   11,   167,  179,  23,   12,
-    1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,
-    36,   13,   169,  2469, 181,  25,   169,  2490, 2611, 181,  2480, 2721,
-    2601, 193,  193,  37,   169,  203,  204,  181,  203,  1808, 204,  205,
-    205,  193,  47,   47,   48,   47,   48,   49,   11,   167,  179,  23,
-    12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,
-    35,   36,   13,   1611, 2469, 1677, 25,   1621, 1600, 1600, 1687, 2480,
-    1600, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,  2491, 1600, 2612,
-    2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,  47,   48,   49,
-    14,   170,  2470, 182,  26,   170,  2501, 2622, 182,  2481, 2732, 2602,
-    194,  194,  38,   170,  2501, 2622, 182,  2502, 1600, 2623, 2732, 2733,
-    194,  2492, 2831, 2613, 2831, 2832, 2723, 206,  206,  206,  50,   170,
-    215,  216,  182,  215,  1874, 216,  217,  217,  194,  215,  1874, 216,
-    1875, 1885, 217,  218,  218,  218,  206,  59,   59,   60,   59,   60,
-    61,   59,   60,   61,   62,   11,   167,  179,  23,   12,   1610, 2468,
-    1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,   36,   13,
-    1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743,
-    1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612, 2721, 2722, 193,
-    203,  1808, 204,  1809, 1819, 205,  47,   48,   49,   14,   1612, 2470,
-    1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,
-    1631, 3336, 3556, 1697, 3381, 1600, 1601, 3776, 1601, 1763, 2492, 3987,
-    2613, 3996, 1601, 2723, 1810, 1820, 1829, 50,   170,  2501, 2622, 182,
-    2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624, 4216, 1601, 2734,
-    2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885, 217,  1876, 1886,
-    1895, 218,  59,   60,   61,   62,   15,   171,  2471, 183,  27,   171,
-    2512, 2633, 183,  2482, 2743, 2603, 195,  195,  39,   171,  2512, 2633,
-    183,  2513, 4426, 2634, 2743, 2744, 195,  2493, 2842, 2614, 2842, 2843,
-    2724, 207,  207,  207,  51,   171,  2512, 2633, 183,  2513, 4426, 2634,
-    2743, 2744, 195,  2514, 4427, 2635, 4436, 1601, 2745, 2842, 2843, 2844,
-    207,  2504, 2930, 2625, 2930, 2931, 2735, 2930, 2931, 2932, 2834, 219,
-    219,  219,  219,  63,   171,  227,  228,  183,  227,  1940, 228,  229,
-    229,  195,  227,  1940, 228,  1941, 1951, 229,  230,  230,  230,  207,
-    227,  1940, 228,  1941, 1951, 229,  1942, 1952, 1961, 230,  231,  231,
-    231,  231,  219,  71,   71,   72,   71,   72,   73,   71,   72,   73,
-    74,   71,   72,   73,   74,   75,   11,   167,  179,  23,   12,   1610,
-    2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,   36,
-    13,   1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480, 3766, 2601,
-    1743, 1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612, 2721, 2722,
-    193,  203,  1808, 204,  1809, 1819, 205,  47,   48,   49,   14,   1612,
-    2470, 1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754,
-    38,   1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492,
-    3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,   170,  2501, 2622,
-    182,  2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624, 4216, 4261,
-    2734, 2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885, 217,  1876,
-    1886, 1895, 218,  59,   60,   61,   62,   15,   1613, 2471, 1679, 27,
-    1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39,   1632, 3337,
-    3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997,
-    4042, 2724, 1811, 1821, 1830, 51,   1640, 3345, 3565, 1706, 3390, 6194,
-    3610, 3785, 3830, 1772, 3426, 6230, 3646, 1602, 1601, 1602, 4005, 4050,
-    1602, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 1602, 2834,
-    1877, 1887, 1896, 1904, 63,   171,  2512, 2633, 183,  2513, 4426, 2634,
-    2743, 2744, 195,  2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844,
-    207,  2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 1602, 2845, 2930,
-    2931, 2932, 2933, 219,  227,  1940, 228,  1941, 1951, 229,  1942, 1952,
-    1961, 230,  1943, 1953, 1962, 1970, 231,  71,   72,   73,   74,   75,
-    16,   172,  2472, 184,  28,   172,  2523, 2644, 184,  2483, 2754, 2604,
-    196,  196,  40,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755,
-    196,  2494, 2853, 2615, 2853, 2854, 2725, 208,  208,  208,  52,   172,
-    2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646,
-    4656, 4701, 2756, 2853, 2854, 2855, 208,  2505, 2941, 2626, 2941, 2942,
-    2736, 2941, 2942, 2943, 2835, 220,  220,  220,  220,  64,   172,  2523,
-    2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646, 4656,
-    4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657, 4702, 2757,
-    4665, 4710, 1602, 2856, 2941, 2942, 2943, 2944, 220,  2516, 3018, 2637,
-    3018, 3019, 2747, 3018, 3019, 3020, 2846, 3018, 3019, 3020, 3021, 2934,
-    232,  232,  232,  232,  232,  76,   172,  239,  240,  184,  239,  2006,
-    240,  241,  241,  196,  239,  2006, 240,  2007, 2017, 241,  242,  242,
-    242,  208,  239,  2006, 240,  2007, 2017, 241,  2008, 2018, 2027, 242,
-    243,  243,  243,  243,  220,  239,  2006, 240,  2007, 2017, 241,  2008,
-    2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  244,  244,  244,  244,
-    244,  232,  83,   83,   84,   83,   84,   85,   83,   84,   85,   86,
-    83,   84,   85,   86,   87,   83,   84,   85,   86,   87,   88,   11,
-    167,  179,  23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,
-    191,  1742, 192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326,
-    3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,
-    2491, 3986, 2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,
-    47,   48,   49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688,
-    2481, 3767, 2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600,
-    3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820,
-    1829, 50,   170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,
-    2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,  215,  1874,
-    216,  1875, 1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,   62,
-    15,   1613, 2471, 1679, 27,   1623, 3328, 3548, 1689, 2482, 3768, 2603,
-    1745, 1755, 39,   1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822,
-    1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,   1640,
-    3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646,
-    6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262,
-    2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63,   171,  2512,
-    2633, 183,  2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635, 4436,
-    4481, 2745, 2842, 2843, 2844, 207,  2515, 4428, 2636, 4437, 4482, 2746,
-    4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,  227,  1940, 228,
-    1941, 1951, 229,  1942, 1952, 1961, 230,  1943, 1953, 1962, 1970, 231,
-    71,   72,   73,   74,   75,   16,   1614, 2472, 1680, 28,   1624, 3329,
-    3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,   1633, 3338, 3558, 1699,
-    3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725,
-    1812, 1822, 1831, 52,   1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786,
-    3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839,
-    2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888,
-    1897, 1905, 64,   1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838,
-    1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462,
-    6266, 3682, 6386, 6714, 3902, 1603, 1603, 1602, 1603, 4233, 4278, 4314,
-    1603, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846,
-    4453, 4498, 4534, 1603, 2934, 1944, 1954, 1963, 1971, 1978, 76,   172,
-    2523, 2644, 184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646,
-    4656, 4701, 2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657, 4702,
-    2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220,  2527, 4649,
-    2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 1603,
-    2945, 3018, 3019, 3020, 3021, 3022, 232,  239,  2006, 240,  2007, 2017,
-    241,  2008, 2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  2010, 2020,
-    2029, 2037, 2044, 244,  83,   84,   85,   86,   87,   88,   17,   173,
-    2473, 185,  29,   173,  2534, 2655, 185,  2484, 2765, 2605, 197,  197,
-    41,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2495,
-    2864, 2616, 2864, 2865, 2726, 209,  209,  209,  53,   173,  2534, 2655,
-    185,  2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876, 4921,
-    2767, 2864, 2865, 2866, 209,  2506, 2952, 2627, 2952, 2953, 2737, 2952,
-    2953, 2954, 2836, 221,  221,  221,  221,  65,   173,  2534, 2655, 185,
-    2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876, 4921, 2767,
-    2864, 2865, 2866, 209,  2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930,
-    4966, 2867, 2952, 2953, 2954, 2955, 221,  2517, 3029, 2638, 3029, 3030,
-    2748, 3029, 3030, 3031, 2847, 3029, 3030, 3031, 3032, 2935, 233,  233,
-    233,  233,  233,  77,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765,
-    2766, 197,  2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,
-    2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953,
-    2954, 2955, 221,  2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967,
-    2868, 4893, 4938, 4974, 1603, 2956, 3029, 3030, 3031, 3032, 3033, 233,
-    2528, 3095, 2649, 3095, 3096, 2759, 3095, 3096, 3097, 2858, 3095, 3096,
-    3097, 3098, 2946, 3095, 3096, 3097, 3098, 3099, 3023, 245,  245,  245,
-    245,  245,  245,  89,   173,  251,  252,  185,  251,  2072, 252,  253,
-    253,  197,  251,  2072, 252,  2073, 2083, 253,  254,  254,  254,  209,
-    251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,  255,  255,
-    255,  255,  221,  251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093,
-    254,  2075, 2085, 2094, 2102, 255,  256,  256,  256,  256,  256,  233,
-    251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,  2075, 2085,
-    2094, 2102, 255,  2076, 2086, 2095, 2103, 2110, 256,  257,  257,  257,
-    257,  257,  257,  245,  95,   95,   96,   95,   96,   97,   95,   96,
-    97,   98,   95,   96,   97,   98,   99,   95,   96,   97,   98,   99,
-    100,  95,   96,   97,   98,   99,   100,  101,  11,   167,  179,  23,
-    12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,
-    35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480,
-    3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612,
-    2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,  47,   48,   49,
-    14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602,
-    1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821,
-    1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,   170,
-    2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624,
-    4216, 4261, 2734, 2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885,
-    217,  1876, 1886, 1895, 218,  59,   60,   61,   62,   15,   1613, 2471,
-    1679, 27,   1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39,
-    1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988,
-    2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,   1640, 3345, 3565, 1706,
-    3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866,
-    4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270,
-    4306, 2834, 1877, 1887, 1896, 1904, 63,   171,  2512, 2633, 183,  2513,
-    4426, 2634, 2743, 2744, 195,  2514, 4427, 2635, 4436, 4481, 2745, 2842,
-    2843, 2844, 207,  2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526,
-    2845, 2930, 2931, 2932, 2933, 219,  227,  1940, 228,  1941, 1951, 229,
-    1942, 1952, 1961, 230,  1943, 1953, 1962, 1970, 231,  71,   72,   73,
-    74,   75,   16,   1614, 2472, 1680, 28,   1624, 3329, 3549, 1690, 2483,
-    3769, 2604, 1746, 1756, 40,   1633, 3338, 3558, 1699, 3383, 6187, 3603,
-    3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831,
-    52,   1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427,
-    6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626,
-    4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64,
-    1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238,
-    3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386,
-    6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912, 2516,
-    4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534,
-    4562, 2934, 1944, 1954, 1963, 1971, 1978, 76,   172,  2523, 2644, 184,
-    2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646, 4656, 4701, 2756,
-    2853, 2854, 2855, 208,  2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710,
-    4746, 2856, 2941, 2942, 2943, 2944, 220,  2527, 4649, 2648, 4658, 4703,
-    2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019,
-    3020, 3021, 3022, 232,  239,  2006, 240,  2007, 2017, 241,  2008, 2018,
-    2027, 242,  2009, 2019, 2028, 2036, 243,  2010, 2020, 2029, 2037, 2044,
-    244,  83,   84,   85,   86,   87,   88,   17,   1615, 2473, 1681, 29,
-    1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747, 1757, 41,   1634, 3339,
-    3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990, 2616, 3999,
-    4044, 2726, 1813, 1823, 1832, 53,   1642, 3347, 3567, 1708, 3392, 6196,
-    3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052,
-    4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836,
-    1879, 1889, 1898, 1906, 65,   1649, 3354, 3574, 1715, 3399, 6203, 3619,
-    3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059, 4095,
-    1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234,
-    4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492,
-    4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964, 1972, 1979,
-    77,   1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787, 3441,
-    6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689,
-    6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919,
-    3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150, 1604, 1604,
-    1604, 1603, 1604, 4460, 4505, 4541, 4569, 1604, 1985, 2528, 4650, 2649,
-    4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946,
-    4680, 4725, 4761, 4789, 1604, 3023, 2011, 2021, 2030, 2038, 2045, 2051,
-    89,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2536,
-    4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,  2537, 4868, 2658,
-    4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221,
-    2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938,
-    4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033, 233,  2539, 4870, 2660,
-    4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003, 2957,
-    4900, 4945, 4981, 5009, 1604, 3034, 3095, 3096, 3097, 3098, 3099, 3100,
-    245,  251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,  2075,
-    2085, 2094, 2102, 255,  2076, 2086, 2095, 2103, 2110, 256,  2077, 2087,
-    2096, 2104, 2111, 2117, 257,  95,   96,   97,   98,   99,   100,  101,
-    18,   174,  2474, 186,  30,   174,  2545, 2666, 186,  2485, 2776, 2606,
-    198,  198,  42,   174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777,
-    198,  2496, 2875, 2617, 2875, 2876, 2727, 210,  210,  210,  54,   174,
-    2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087, 2668,
-    5096, 5141, 2778, 2875, 2876, 2877, 210,  2507, 2963, 2628, 2963, 2964,
-    2738, 2963, 2964, 2965, 2837, 222,  222,  222,  222,  66,   174,  2545,
-    2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547, 5087, 2668, 5096,
-    5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669, 5097, 5142, 2779,
-    5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,  2518, 3040, 2639,
-    3040, 3041, 2749, 3040, 3041, 3042, 2848, 3040, 3041, 3042, 3043, 2936,
-    234,  234,  234,  234,  234,  78,   174,  2545, 2666, 186,  2546, 5086,
-    2667, 2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876,
-    2877, 210,  2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878,
-    2963, 2964, 2965, 2966, 222,  2549, 5089, 2670, 5098, 5143, 2780, 5106,
-    5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043,
-    3044, 234,  2529, 3106, 2650, 3106, 3107, 2760, 3106, 3107, 3108, 2859,
-    3106, 3107, 3108, 3109, 2947, 3106, 3107, 3108, 3109, 3110, 3024, 246,
-    246,  246,  246,  246,  246,  90,   174,  2545, 2666, 186,  2546, 5086,
-    2667, 2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876,
-    2877, 210,  2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878,
-    2963, 2964, 2965, 2966, 222,  2549, 5089, 2670, 5098, 5143, 2780, 5106,
-    5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043,
-    3044, 234,  2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880,
-    5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229, 1604, 3045, 3106,
-    3107, 3108, 3109, 3110, 3111, 246,  2540, 3161, 2661, 3161, 3162, 2771,
-    3161, 3162, 3163, 2870, 3161, 3162, 3163, 3164, 2958, 3161, 3162, 3163,
-    3164, 3165, 3035, 3161, 3162, 3163, 3164, 3165, 3166, 3101, 258,  258,
-    258,  258,  258,  258,  258,  102,  174,  263,  264,  186,  263,  2138,
-    264,  265,  265,  198,  263,  2138, 264,  2139, 2149, 265,  266,  266,
-    266,  210,  263,  2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,
-    267,  267,  267,  267,  222,  263,  2138, 264,  2139, 2149, 265,  2140,
-    2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  268,  268,  268,  268,
-    268,  234,  263,  2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,
-    2141, 2151, 2160, 2168, 267,  2142, 2152, 2161, 2169, 2176, 268,  269,
-    269,  269,  269,  269,  269,  246,  263,  2138, 264,  2139, 2149, 265,
-    2140, 2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  2142, 2152, 2161,
-    2169, 2176, 268,  2143, 2153, 2162, 2170, 2177, 2183, 269,  270,  270,
-    270,  270,  270,  270,  270,  258,  107,  107,  108,  107,  108,  109,
-    107,  108,  109,  110,  107,  108,  109,  110,  111,  107,  108,  109,
-    110,  111,  112,  107,  108,  109,  110,  111,  112,  113,  107,  108,
-    109,  110,  111,  112,  113,  114,  11,   167,  179,  23,   12,   1610,
-    2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742, 192,  35,   36,
-    13,   1611, 2469, 1677, 25,   1621, 3326, 3546, 1687, 2480, 3766, 2601,
-    1743, 1753, 37,   169,  2490, 2611, 181,  2491, 3986, 2612, 2721, 2722,
-    193,  203,  1808, 204,  1809, 1819, 205,  47,   48,   49,   14,   1612,
-    2470, 1678, 26,   1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754,
-    38,   1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492,
-    3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,   170,  2501, 2622,
-    182,  2502, 4206, 2623, 2732, 2733, 194,  2503, 4207, 2624, 4216, 4261,
-    2734, 2831, 2832, 2833, 206,  215,  1874, 216,  1875, 1885, 217,  1876,
-    1886, 1895, 218,  59,   60,   61,   62,   15,   1613, 2471, 1679, 27,
-    1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39,   1632, 3337,
-    3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997,
-    4042, 2724, 1811, 1821, 1830, 51,   1640, 3345, 3565, 1706, 3390, 6194,
-    3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050,
-    4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834,
-    1877, 1887, 1896, 1904, 63,   171,  2512, 2633, 183,  2513, 4426, 2634,
-    2743, 2744, 195,  2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844,
-    207,  2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930,
-    2931, 2932, 2933, 219,  227,  1940, 228,  1941, 1951, 229,  1942, 1952,
-    1961, 230,  1943, 1953, 1962, 1970, 231,  71,   72,   73,   74,   75,
-    16,   1614, 2472, 1680, 28,   1624, 3329, 3549, 1690, 2483, 3769, 2604,
-    1746, 1756, 40,   1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823,
-    1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52,   1641,
-    3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647,
-    6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263,
-    2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64,   1648, 3353,
-    3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358,
-    6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902,
-    6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637,
-    4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934,
-    1944, 1954, 1963, 1971, 1978, 76,   172,  2523, 2644, 184,  2524, 4646,
-    2645, 2754, 2755, 196,  2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854,
-    2855, 208,  2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856,
-    2941, 2942, 2943, 2944, 220,  2527, 4649, 2648, 4658, 4703, 2758, 4666,
-    4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021,
-    3022, 232,  239,  2006, 240,  2007, 2017, 241,  2008, 2018, 2027, 242,
-    2009, 2019, 2028, 2036, 243,  2010, 2020, 2029, 2037, 2044, 244,  83,
-    84,   85,   86,   87,   88,   17,   1615, 2473, 1681, 29,   1625, 3330,
-    3550, 1691, 2484, 3770, 2605, 1747, 1757, 41,   1634, 3339, 3559, 1700,
-    3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990, 2616, 3999, 4044, 2726,
-    1813, 1823, 1832, 53,   1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787,
-    3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840,
-    2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889,
-    1898, 1906, 65,   1649, 3354, 3574, 1715, 3399, 6203, 3619, 3794, 3839,
-    1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463,
-    6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315,
-    4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847,
-    4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964, 1972, 1979, 77,   1655,
-    3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661,
-    6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721,
-    3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919, 3490, 6294,
-    3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150, 6554, 6882, 7091, 1603,
-    4370, 4460, 4505, 4541, 4569, 4590, 1985, 2528, 4650, 2649, 4659, 4704,
-    2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725,
-    4761, 4789, 4810, 3023, 2011, 2021, 2030, 2038, 2045, 2051, 89,   173,
-    2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657,
-    4876, 4921, 2767, 2864, 2865, 2866, 209,  2537, 4868, 2658, 4877, 4922,
-    2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221,  2538, 4869,
-    2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002,
-    2956, 3029, 3030, 3031, 3032, 3033, 233,  2539, 4870, 2660, 4879, 4924,
-    2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003, 2957, 4900, 4945,
-    4981, 5009, 5030, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245,  251,
-    2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,  2075, 2085, 2094,
-    2102, 255,  2076, 2086, 2095, 2103, 2110, 256,  2077, 2087, 2096, 2104,
-    2111, 2117, 257,  95,   96,   97,   98,   99,   100,  101,  18,   1616,
-    2474, 1682, 30,   1626, 3331, 3551, 1692, 2485, 3771, 2606, 1748, 1758,
-    42,   1635, 3340, 3560, 1701, 3385, 6189, 3605, 3780, 3825, 1767, 2496,
-    3991, 2617, 4000, 4045, 2727, 1814, 1824, 1833, 54,   1643, 3348, 3568,
-    1709, 3393, 6197, 3613, 3788, 3833, 1775, 3429, 6233, 3649, 6353, 6681,
-    3869, 4008, 4053, 4089, 1841, 2507, 4211, 2628, 4220, 4265, 2738, 4228,
-    4273, 4309, 2837, 1880, 1890, 1899, 1907, 66,   1650, 3355, 3575, 1716,
-    3400, 6204, 3620, 3795, 3840, 1782, 3436, 6240, 3656, 6360, 6688, 3876,
-    4015, 4060, 4096, 1848, 3464, 6268, 3684, 6388, 6716, 3904, 6472, 6800,
-    7009, 4124, 4235, 4280, 4316, 4344, 1914, 2518, 4431, 2639, 4440, 4485,
-    2749, 4448, 4493, 4529, 2848, 4455, 4500, 4536, 4564, 2936, 1946, 1956,
-    1965, 1973, 1980, 78,   1656, 3361, 3581, 1722, 3406, 6210, 3626, 3801,
-    3846, 1788, 3442, 6246, 3662, 6366, 6694, 3882, 4021, 4066, 4102, 1854,
-    3470, 6274, 3690, 6394, 6722, 3910, 6478, 6806, 7015, 4130, 4241, 4286,
-    4322, 4350, 1920, 3491, 6295, 3711, 6415, 6743, 3931, 6499, 6827, 7036,
-    4151, 6555, 6883, 7092, 7217, 4371, 4461, 4506, 4542, 4570, 4591, 1986,
-    2529, 4651, 2650, 4660, 4705, 2760, 4668, 4713, 4749, 2859, 4675, 4720,
-    4756, 4784, 2947, 4681, 4726, 4762, 4790, 4811, 3024, 2012, 2022, 2031,
-    2039, 2046, 2052, 90,   1661, 3366, 3586, 1727, 3411, 6215, 3631, 3806,
-    3851, 1793, 3447, 6251, 3667, 6371, 6699, 3887, 4026, 4071, 4107, 1859,
-    3475, 6279, 3695, 6399, 6727, 3915, 6483, 6811, 7020, 4135, 4246, 4291,
-    4327, 4355, 1925, 3496, 6300, 3716, 6420, 6748, 3936, 6504, 6832, 7041,
-    4156, 6560, 6888, 7097, 7222, 4376, 4466, 4511, 4547, 4575, 4596, 1991,
-    3511, 6315, 3731, 6435, 6763, 3951, 6519, 6847, 7056, 4171, 6575, 6903,
-    7112, 7237, 4391, 1605, 1605, 1605, 1605, 1604, 1605, 4686, 4731, 4767,
-    4795, 4816, 1605, 2057, 2540, 4871, 2661, 4880, 4925, 2771, 4888, 4933,
-    4969, 2870, 4895, 4940, 4976, 5004, 2958, 4901, 4946, 4982, 5010, 5031,
-    3035, 4906, 4951, 4987, 5015, 5036, 1605, 3101, 2078, 2088, 2097, 2105,
-    2112, 2118, 2123, 102,  174,  2545, 2666, 186,  2546, 5086, 2667, 2776,
-    2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,
-    2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964,
-    2965, 2966, 222,  2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187,
-    2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043, 3044, 234,
-    2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159,
-    5195, 5223, 2968, 5120, 5165, 5201, 5229, 5250, 3045, 3106, 3107, 3108,
-    3109, 3110, 3111, 246,  2551, 5091, 2672, 5100, 5145, 2782, 5108, 5153,
-    5189, 2881, 5115, 5160, 5196, 5224, 2969, 5121, 5166, 5202, 5230, 5251,
-    3046, 5126, 5171, 5207, 5235, 5256, 1605, 3112, 3161, 3162, 3163, 3164,
-    3165, 3166, 3167, 258,  263,  2138, 264,  2139, 2149, 265,  2140, 2150,
-    2159, 266,  2141, 2151, 2160, 2168, 267,  2142, 2152, 2161, 2169, 2176,
-    268,  2143, 2153, 2162, 2170, 2177, 2183, 269,  2144, 2154, 2163, 2171,
-    2178, 2184, 2189, 270,  107,  108,  109,  110,  111,  112,  113,  114,
-    19,   175,  2475, 187,  31,   175,  2556, 2677, 187,  2486, 2787, 2607,
-    199,  199,  43,   175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788,
-    199,  2497, 2886, 2618, 2886, 2887, 2728, 211,  211,  211,  55,   175,
-    2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679,
-    5316, 5361, 2789, 2886, 2887, 2888, 211,  2508, 2974, 2629, 2974, 2975,
-    2739, 2974, 2975, 2976, 2838, 223,  223,  223,  223,  67,   175,  2556,
-    2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307, 2679, 5316,
-    5361, 2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317, 5362, 2790,
-    5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2519, 3051, 2640,
-    3051, 3052, 2750, 3051, 3052, 3053, 2849, 3051, 3052, 3053, 3054, 2937,
-    235,  235,  235,  235,  235,  79,   175,  2556, 2677, 187,  2557, 5306,
-    2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887,
-    2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889,
-    2974, 2975, 2976, 2977, 223,  2560, 5309, 2681, 5318, 5363, 2791, 5326,
-    5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054,
-    3055, 235,  2530, 3117, 2651, 3117, 3118, 2761, 3117, 3118, 3119, 2860,
-    3117, 3118, 3119, 3120, 2948, 3117, 3118, 3119, 3120, 3121, 3025, 247,
-    247,  247,  247,  247,  247,  91,   175,  2556, 2677, 187,  2557, 5306,
-    2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887,
-    2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889,
-    2974, 2975, 2976, 2977, 223,  2560, 5309, 2681, 5318, 5363, 2791, 5326,
-    5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054,
-    3055, 235,  2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891,
-    5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470, 3056, 3117,
-    3118, 3119, 3120, 3121, 3122, 247,  2541, 3172, 2662, 3172, 3173, 2772,
-    3172, 3173, 3174, 2871, 3172, 3173, 3174, 3175, 2959, 3172, 3173, 3174,
-    3175, 3176, 3036, 3172, 3173, 3174, 3175, 3176, 3177, 3102, 259,  259,
-    259,  259,  259,  259,  259,  103,  175,  2556, 2677, 187,  2557, 5306,
-    2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887,
-    2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889,
-    2974, 2975, 2976, 2977, 223,  2560, 5309, 2681, 5318, 5363, 2791, 5326,
-    5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054,
-    3055, 235,  2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891,
-    5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470, 3056, 3117,
-    3118, 3119, 3120, 3121, 3122, 247,  2562, 5311, 2683, 5320, 5365, 2793,
-    5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444, 2980, 5341, 5386, 5422,
-    5450, 5471, 3057, 5346, 5391, 5427, 5455, 5476, 1605, 3123, 3172, 3173,
-    3174, 3175, 3176, 3177, 3178, 259,  2552, 3216, 2673, 3216, 3217, 2783,
-    3216, 3217, 3218, 2882, 3216, 3217, 3218, 3219, 2970, 3216, 3217, 3218,
-    3219, 3220, 3047, 3216, 3217, 3218, 3219, 3220, 3221, 3113, 3216, 3217,
-    3218, 3219, 3220, 3221, 3222, 3168, 271,  271,  271,  271,  271,  271,
-    271,  271,  115,  175,  275,  276,  187,  275,  2204, 276,  277,  277,
-    199,  275,  2204, 276,  2205, 2215, 277,  278,  278,  278,  211,  275,
-    2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,  279,  279,  279,
-    279,  223,  275,  2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,
-    2207, 2217, 2226, 2234, 279,  280,  280,  280,  280,  280,  235,  275,
-    2204, 276,  2205, 2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226,
-    2234, 279,  2208, 2218, 2227, 2235, 2242, 280,  281,  281,  281,  281,
-    281,  281,  247,  275,  2204, 276,  2205, 2215, 277,  2206, 2216, 2225,
-    278,  2207, 2217, 2226, 2234, 279,  2208, 2218, 2227, 2235, 2242, 280,
-    2209, 2219, 2228, 2236, 2243, 2249, 281,  282,  282,  282,  282,  282,
-    282,  282,  259,  275,  2204, 276,  2205, 2215, 277,  2206, 2216, 2225,
-    278,  2207, 2217, 2226, 2234, 279,  2208, 2218, 2227, 2235, 2242, 280,
-    2209, 2219, 2228, 2236, 2243, 2249, 281,  2210, 2220, 2229, 2237, 2244,
-    2250, 2255, 282,  283,  283,  283,  283,  283,  283,  283,  283,  271,
-    119,  119,  120,  119,  120,  121,  119,  120,  121,  122,  119,  120,
-    121,  122,  123,  119,  120,  121,  122,  123,  124,  119,  120,  121,
-    122,  123,  124,  125,  119,  120,  121,  122,  123,  124,  125,  126,
-    119,  120,  121,  122,  123,  124,  125,  126,  127,  11,   167,  179,
-    23,   12,   1610, 2468, 1676, 24,   168,  2479, 2600, 180,  191,  1742,
-    192,  35,   36,   13,   1611, 2469, 1677, 25,   1621, 3326, 3546, 1687,
-    2480, 3766, 2601, 1743, 1753, 37,   169,  2490, 2611, 181,  2491, 3986,
-    2612, 2721, 2722, 193,  203,  1808, 204,  1809, 1819, 205,  47,   48,
-    49,   14,   1612, 2470, 1678, 26,   1622, 3327, 3547, 1688, 2481, 3767,
-    2602, 1744, 1754, 38,   1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776,
-    3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,
-    170,  2501, 2622, 182,  2502, 4206, 2623, 2732, 2733, 194,  2503, 4207,
-    2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,  215,  1874, 216,  1875,
-    1885, 217,  1876, 1886, 1895, 218,  59,   60,   61,   62,   15,   1613,
-    2471, 1679, 27,   1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755,
-    39,   1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493,
-    3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,   1640, 3345, 3565,
-    1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601,
-    3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225,
-    4270, 4306, 2834, 1877, 1887, 1896, 1904, 63,   171,  2512, 2633, 183,
-    2513, 4426, 2634, 2743, 2744, 195,  2514, 4427, 2635, 4436, 4481, 2745,
-    2842, 2843, 2844, 207,  2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490,
-    4526, 2845, 2930, 2931, 2932, 2933, 219,  227,  1940, 228,  1941, 1951,
-    229,  1942, 1952, 1961, 230,  1943, 1953, 1962, 1970, 231,  71,   72,
-    73,   74,   75,   16,   1614, 2472, 1680, 28,   1624, 3329, 3549, 1690,
-    2483, 3769, 2604, 1746, 1756, 40,   1633, 3338, 3558, 1699, 3383, 6187,
-    3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822,
-    1831, 52,   1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773,
-    3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209,
-    2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905,
-    64,   1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434,
-    6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682,
-    6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912,
-    2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498,
-    4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76,   172,  2523, 2644,
-    184,  2524, 4646, 2645, 2754, 2755, 196,  2525, 4647, 2646, 4656, 4701,
-    2756, 2853, 2854, 2855, 208,  2526, 4648, 2647, 4657, 4702, 2757, 4665,
-    4710, 4746, 2856, 2941, 2942, 2943, 2944, 220,  2527, 4649, 2648, 4658,
-    4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018,
-    3019, 3020, 3021, 3022, 232,  239,  2006, 240,  2007, 2017, 241,  2008,
-    2018, 2027, 242,  2009, 2019, 2028, 2036, 243,  2010, 2020, 2029, 2037,
-    2044, 244,  83,   84,   85,   86,   87,   88,   17,   1615, 2473, 1681,
-    29,   1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747, 1757, 41,   1634,
-    3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990, 2616,
-    3999, 4044, 2726, 1813, 1823, 1832, 53,   1642, 3347, 3567, 1708, 3392,
-    6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007,
-    4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308,
-    2836, 1879, 1889, 1898, 1906, 65,   1649, 3354, 3574, 1715, 3399, 6203,
-    3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059,
-    4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123,
-    4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447,
-    4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964, 1972,
-    1979, 77,   1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787,
-    3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273,
-    3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349,
-    1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150, 6554,
-    6882, 7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590, 1985, 2528, 4650,
-    2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783,
-    2946, 4680, 4725, 4761, 4789, 4810, 3023, 2011, 2021, 2030, 2038, 2045,
-    2051, 89,   173,  2534, 2655, 185,  2535, 4866, 2656, 2765, 2766, 197,
-    2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209,  2537, 4868,
-    2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955,
-    221,  2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893,
-    4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033, 233,  2539, 4870,
-    2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003,
-    2957, 4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096, 3097, 3098, 3099,
-    3100, 245,  251,  2072, 252,  2073, 2083, 253,  2074, 2084, 2093, 254,
-    2075, 2085, 2094, 2102, 255,  2076, 2086, 2095, 2103, 2110, 256,  2077,
-    2087, 2096, 2104, 2111, 2117, 257,  95,   96,   97,   98,   99,   100,
-    101,  18,   1616, 2474, 1682, 30,   1626, 3331, 3551, 1692, 2485, 3771,
-    2606, 1748, 1758, 42,   1635, 3340, 3560, 1701, 3385, 6189, 3605, 3780,
-    3825, 1767, 2496, 3991, 2617, 4000, 4045, 2727, 1814, 1824, 1833, 54,
-    1643, 3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833, 1775, 3429, 6233,
-    3649, 6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507, 4211, 2628, 4220,
-    4265, 2738, 4228, 4273, 4309, 2837, 1880, 1890, 1899, 1907, 66,   1650,
-    3355, 3575, 1716, 3400, 6204, 3620, 3795, 3840, 1782, 3436, 6240, 3656,
-    6360, 6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268, 3684, 6388, 6716,
-    3904, 6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344, 1914, 2518, 4431,
-    2639, 4440, 4485, 2749, 4448, 4493, 4529, 2848, 4455, 4500, 4536, 4564,
-    2936, 1946, 1956, 1965, 1973, 1980, 78,   1656, 3361, 3581, 1722, 3406,
-    6210, 3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366, 6694, 3882, 4021,
-    4066, 4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910, 6478, 6806, 7015,
-    4130, 4241, 4286, 4322, 4350, 1920, 3491, 6295, 3711, 6415, 6743, 3931,
-    6499, 6827, 7036, 4151, 6555, 6883, 7092, 7217, 4371, 4461, 4506, 4542,
-    4570, 4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760, 4668, 4713, 4749,
-    2859, 4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762, 4790, 4811, 3024,
-    2012, 2022, 2031, 2039, 2046, 2052, 90,   1661, 3366, 3586, 1727, 3411,
-    6215, 3631, 3806, 3851, 1793, 3447, 6251, 3667, 6371, 6699, 3887, 4026,
-    4071, 4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915, 6483, 6811, 7020,
-    4135, 4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716, 6420, 6748, 3936,
-    6504, 6832, 7041, 4156, 6560, 6888, 7097, 7222, 4376, 4466, 4511, 4547,
-    4575, 4596, 1991, 3511, 6315, 3731, 6435, 6763, 3951, 6519, 6847, 7056,
-    4171, 6575, 6903, 7112, 7237, 4391, 6610, 6938, 7147, 7272, 1604, 4611,
-    4686, 4731, 4767, 4795, 4816, 4831, 2057, 2540, 4871, 2661, 4880, 4925,
-    2771, 4888, 4933, 4969, 2870, 4895, 4940, 4976, 5004, 2958, 4901, 4946,
-    4982, 5010, 5031, 3035, 4906, 4951, 4987, 5015, 5036, 5051, 3101, 2078,
-    2088, 2097, 2105, 2112, 2118, 2123, 102,  174,  2545, 2666, 186,  2546,
-    5086, 2667, 2776, 2777, 198,  2547, 5087, 2668, 5096, 5141, 2778, 2875,
-    2876, 2877, 210,  2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186,
-    2878, 2963, 2964, 2965, 2966, 222,  2549, 5089, 2670, 5098, 5143, 2780,
-    5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042,
-    3043, 3044, 234,  2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188,
-    2880, 5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229, 5250, 3045,
-    3106, 3107, 3108, 3109, 3110, 3111, 246,  2551, 5091, 2672, 5100, 5145,
-    2782, 5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224, 2969, 5121, 5166,
-    5202, 5230, 5251, 3046, 5126, 5171, 5207, 5235, 5256, 5271, 3112, 3161,
-    3162, 3163, 3164, 3165, 3166, 3167, 258,  263,  2138, 264,  2139, 2149,
-    265,  2140, 2150, 2159, 266,  2141, 2151, 2160, 2168, 267,  2142, 2152,
-    2161, 2169, 2176, 268,  2143, 2153, 2162, 2170, 2177, 2183, 269,  2144,
-    2154, 2163, 2171, 2178, 2184, 2189, 270,  107,  108,  109,  110,  111,
-    112,  113,  114,  19,   1617, 2475, 1683, 31,   1627, 3332, 3552, 1693,
-    2486, 3772, 2607, 1749, 1759, 43,   1636, 3341, 3561, 1702, 3386, 6190,
-    3606, 3781, 3826, 1768, 2497, 3992, 2618, 4001, 4046, 2728, 1815, 1825,
-    1834, 55,   1644, 3349, 3569, 1710, 3394, 6198, 3614, 3789, 3834, 1776,
-    3430, 6234, 3650, 6354, 6682, 3870, 4009, 4054, 4090, 1842, 2508, 4212,
-    2629, 4221, 4266, 2739, 4229, 4274, 4310, 2838, 1881, 1891, 1900, 1908,
-    67,   1651, 3356, 3576, 1717, 3401, 6205, 3621, 3796, 3841, 1783, 3437,
-    6241, 3657, 6361, 6689, 3877, 4016, 4061, 4097, 1849, 3465, 6269, 3685,
-    6389, 6717, 3905, 6473, 6801, 7010, 4125, 4236, 4281, 4317, 4345, 1915,
-    2519, 4432, 2640, 4441, 4486, 2750, 4449, 4494, 4530, 2849, 4456, 4501,
-    4537, 4565, 2937, 1947, 1957, 1966, 1974, 1981, 79,   1657, 3362, 3582,
-    1723, 3407, 6211, 3627, 3802, 3847, 1789, 3443, 6247, 3663, 6367, 6695,
-    3883, 4022, 4067, 4103, 1855, 3471, 6275, 3691, 6395, 6723, 3911, 6479,
-    6807, 7016, 4131, 4242, 4287, 4323, 4351, 1921, 3492, 6296, 3712, 6416,
-    6744, 3932, 6500, 6828, 7037, 4152, 6556, 6884, 7093, 7218, 4372, 4462,
-    4507, 4543, 4571, 4592, 1987, 2530, 4652, 2651, 4661, 4706, 2761, 4669,
-    4714, 4750, 2860, 4676, 4721, 4757, 4785, 2948, 4682, 4727, 4763, 4791,
-    4812, 3025, 2013, 2023, 2032, 2040, 2047, 2053, 91,   1662, 3367, 3587,
-    1728, 3412, 6216, 3632, 3807, 3852, 1794, 3448, 6252, 3668, 6372, 6700,
-    3888, 4027, 4072, 4108, 1860, 3476, 6280, 3696, 6400, 6728, 3916, 6484,
-    6812, 7021, 4136, 4247, 4292, 4328, 4356, 1926, 3497, 6301, 3717, 6421,
-    6749, 3937, 6505, 6833, 7042, 4157, 6561, 6889, 7098, 7223, 4377, 4467,
-    4512, 4548, 4576, 4597, 1992, 3512, 6316, 3732, 6436, 6764, 3952, 6520,
-    6848, 7057, 4172, 6576, 6904, 7113, 7238, 4392, 6611, 6939, 7148, 7273,
-    7342, 4612, 4687, 4732, 4768, 4796, 4817, 4832, 2058, 2541, 4872, 2662,
-    4881, 4926, 2772, 4889, 4934, 4970, 2871, 4896, 4941, 4977, 5005, 2959,
-    4902, 4947, 4983, 5011, 5032, 3036, 4907, 4952, 4988, 5016, 5037, 5052,
-    3102, 2079, 2089, 2098, 2106, 2113, 2119, 2124, 103,  1666, 3371, 3591,
-    1732, 3416, 6220, 3636, 3811, 3856, 1798, 3452, 6256, 3672, 6376, 6704,
-    3892, 4031, 4076, 4112, 1864, 3480, 6284, 3700, 6404, 6732, 3920, 6488,
-    6816, 7025, 4140, 4251, 4296, 4332, 4360, 1930, 3501, 6305, 3721, 6425,
-    6753, 3941, 6509, 6837, 7046, 4161, 6565, 6893, 7102, 7227, 4381, 4471,
-    4516, 4552, 4580, 4601, 1996, 3516, 6320, 3736, 6440, 6768, 3956, 6524,
-    6852, 7061, 4176, 6580, 6908, 7117, 7242, 4396, 6615, 6943, 7152, 7277,
-    7346, 4616, 4691, 4736, 4772, 4800, 4821, 4836, 2062, 3526, 6330, 3746,
-    6450, 6778, 3966, 6534, 6862, 7071, 4186, 6590, 6918, 7127, 7252, 4406,
-    6625, 6953, 7162, 7287, 7356, 4626, 1606, 1606, 1606, 1606, 1606, 1605,
-    1606, 4911, 4956, 4992, 5020, 5041, 5056, 1606, 2128, 2552, 5092, 2673,
-    5101, 5146, 2783, 5109, 5154, 5190, 2882, 5116, 5161, 5197, 5225, 2970,
-    5122, 5167, 5203, 5231, 5252, 3047, 5127, 5172, 5208, 5236, 5257, 5272,
-    3113, 5131, 5176, 5212, 5240, 5261, 5276, 1606, 3168, 2145, 2155, 2164,
-    2172, 2179, 2185, 2190, 2194, 115,  175,  2556, 2677, 187,  2557, 5306,
-    2678, 2787, 2788, 199,  2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887,
-    2888, 211,  2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889,
-    2974, 2975, 2976, 2977, 223,  2560, 5309, 2681, 5318, 5363, 2791, 5326,
-    5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054,
-    3055, 235,  2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891,
-    5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470, 3056, 3117,
-    3118, 3119, 3120, 3121, 3122, 247,  2562, 5311, 2683, 5320, 5365, 2793,
-    5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444, 2980, 5341, 5386, 5422,
-    5450, 5471, 3057, 5346, 5391, 5427, 5455, 5476, 5491, 3123, 3172, 3173,
-    3174, 3175, 3176, 3177, 3178, 259,  2563, 5312, 2684, 5321, 5366, 2794,
-    5329, 5374, 5410, 2893, 5336, 5381, 5417, 5445, 2981, 5342, 5387, 5423,
-    5451, 5472, 3058, 5347, 5392, 5428, 5456, 5477, 5492, 3124, 5351, 5396,
-    5432, 5460, 5481, 5496, 1606, 3179, 3216, 3217, 3218, 3219, 3220, 3221,
-    3222, 3223, 271,  275,  2204, 276,  2205, 2215, 277,  2206, 2216, 2225,
-    278,  2207, 2217, 2226, 2234, 279,  2208, 2218, 2227, 2235, 2242, 280,
-    2209, 2219, 2228, 2236, 2243, 2249, 281,  2210, 2220, 2229, 2237, 2244,
-    2250, 2255, 282,  2211, 2221, 2230, 2238, 2245, 2251, 2256, 2260, 283,
-    119,  120,  121,  122,  123,  124,  125,  126,  127,  20,   176,  2476,
-    188,  32,   176,  2567, 2688, 188,  2487, 2798, 2608, 200,  200,  44,
-    176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2498, 2897,
-    2619, 2897, 2898, 2729, 212,  212,  212,  56,   176,  2567, 2688, 188,
-    2568, 5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800,
-    2897, 2898, 2899, 212,  2509, 2985, 2630, 2985, 2986, 2740, 2985, 2986,
-    2987, 2839, 224,  224,  224,  224,  68,   176,  2567, 2688, 188,  2568,
-    5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536, 5581, 2800, 2897,
-    2898, 2899, 212,  2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626,
-    2900, 2985, 2986, 2987, 2988, 224,  2520, 3062, 2641, 3062, 3063, 2751,
-    3062, 3063, 3064, 2850, 3062, 3063, 3064, 3065, 2938, 236,  236,  236,
-    236,  236,  80,   176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799,
-    200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570,
-    5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987,
-    2988, 224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901,
-    5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2531,
-    3128, 2652, 3128, 3129, 2762, 3128, 3129, 3130, 2861, 3128, 3129, 3130,
-    3131, 2949, 3128, 3129, 3130, 3131, 3132, 3026, 248,  248,  248,  248,
-    248,  248,  92,   176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799,
-    200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570,
-    5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987,
-    2988, 224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901,
-    5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2572,
-    5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635,
-    5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131,
-    3132, 3133, 248,  2542, 3183, 2663, 3183, 3184, 2773, 3183, 3184, 3185,
-    2872, 3183, 3184, 3185, 3186, 2960, 3183, 3184, 3185, 3186, 3187, 3037,
-    3183, 3184, 3185, 3186, 3187, 3188, 3103, 260,  260,  260,  260,  260,
-    260,  260,  104,  176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799,
-    200,  2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570,
-    5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987,
-    2988, 224,  2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901,
-    5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2572,
-    5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635,
-    5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131,
-    3132, 3133, 248,  2573, 5531, 2694, 5540, 5585, 2804, 5548, 5593, 5629,
-    2903, 5555, 5600, 5636, 5664, 2991, 5561, 5606, 5642, 5670, 5691, 3068,
-    5566, 5611, 5647, 5675, 5696, 5711, 3134, 3183, 3184, 3185, 3186, 3187,
-    3188, 3189, 260,  2553, 3227, 2674, 3227, 3228, 2784, 3227, 3228, 3229,
-    2883, 3227, 3228, 3229, 3230, 2971, 3227, 3228, 3229, 3230, 3231, 3048,
-    3227, 3228, 3229, 3230, 3231, 3232, 3114, 3227, 3228, 3229, 3230, 3231,
-    3232, 3233, 3169, 272,  272,  272,  272,  272,  272,  272,  272,  116,
-    176,  2567, 2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2569, 5527,
-    2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,  2570, 5528, 2691, 5537,
-    5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224,  2571,
-    5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634,
-    5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,  2572, 5530, 2693, 5539,
-    5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990, 5560,
-    5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248,
-    2573, 5531, 2694, 5540, 5585, 2804, 5548, 5593, 5629, 2903, 5555, 5600,
-    5636, 5664, 2991, 5561, 5606, 5642, 5670, 5691, 3068, 5566, 5611, 5647,
-    5675, 5696, 5711, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260,
-    2574, 5532, 2695, 5541, 5586, 2805, 5549, 5594, 5630, 2904, 5556, 5601,
-    5637, 5665, 2992, 5562, 5607, 5643, 5671, 5692, 3069, 5567, 5612, 5648,
-    5676, 5697, 5712, 3135, 5571, 5616, 5652, 5680, 5701, 5716, 1606, 3190,
-    3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 272,  2564, 3260, 2685,
-    3260, 3261, 2795, 3260, 3261, 3262, 2894, 3260, 3261, 3262, 3263, 2982,
-    3260, 3261, 3262, 3263, 3264, 3059, 3260, 3261, 3262, 3263, 3264, 3265,
-    3125, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3180, 3260, 3261, 3262,
-    3263, 3264, 3265, 3266, 3267, 3224, 284,  284,  284,  284,  284,  284,
-    284,  284,  284,  128,  176,  287,  288,  188,  287,  2270, 288,  289,
-    289,  200,  287,  2270, 288,  2271, 2281, 289,  290,  290,  290,  212,
-    287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291, 290,  291,  291,
-    291,  291,  224,  287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291,
-    290,  2273, 2283, 2292, 2300, 291,  292,  292,  292,  292,  292,  236,
-    287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291, 290,  2273, 2283,
-    2292, 2300, 291,  2274, 2284, 2293, 2301, 2308, 292,  293,  293,  293,
-    293,  293,  293,  248,  287,  2270, 288,  2271, 2281, 289,  2272, 2282,
-    2291, 290,  2273, 2283, 2292, 2300, 291,  2274, 2284, 2293, 2301, 2308,
-    292,  2275, 2285, 2294, 2302, 2309, 2315, 293,  294,  294,  294,  294,
-    294,  294,  294,  260,  287,  2270, 288,  2271, 2281, 289,  2272, 2282,
-    2291, 290,  2273, 2283, 2292, 2300, 291,  2274, 2284, 2293, 2301, 2308,
-    292,  2275, 2285, 2294, 2302, 2309, 2315, 293,  2276, 2286, 2295, 2303,
-    2310, 2316, 2321, 294,  295,  295,  295,  295,  295,  295,  295,  295,
-    272,  287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291, 290,  2273,
-    2283, 2292, 2300, 291,  2274, 2284, 2293, 2301, 2308, 292,  2275, 2285,
-    2294, 2302, 2309, 2315, 293,  2276, 2286, 2295, 2303, 2310, 2316, 2321,
-    294,  2277, 2287, 2296, 2304, 2311, 2317, 2322, 2326, 295,  296,  296,
-    296,  296,  296,  296,  296,  296,  296,  284,  131,  131,  132,  131,
-    132,  133,  131,  132,  133,  134,  131,  132,  133,  134,  135,  131,
-    132,  133,  134,  135,  136,  131,  132,  133,  134,  135,  136,  137,
-    131,  132,  133,  134,  135,  136,  137,  138,  131,  132,  133,  134,
-    135,  136,  137,  138,  139,  131,  132,  133,  134,  135,  136,  137,
-    138,  139,  140,  11,   167,  179,  23,   12,   1610, 2468, 1676, 24,
-    168,  2479, 2600, 180,  191,  1742, 192,  35,   36,   13,   1611, 2469,
-    1677, 25,   1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37,
-    169,  2490, 2611, 181,  2491, 3986, 2612, 2721, 2722, 193,  203,  1808,
-    204,  1809, 1819, 205,  47,   48,   49,   14,   1612, 2470, 1678, 26,
-    1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,   1631, 3336,
-    3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996,
-    4041, 2723, 1810, 1820, 1829, 50,   170,  2501, 2622, 182,  2502, 4206,
-    2623, 2732, 2733, 194,  2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832,
-    2833, 206,  215,  1874, 216,  1875, 1885, 217,  1876, 1886, 1895, 218,
-    59,   60,   61,   62,   15,   1613, 2471, 1679, 27,   1623, 3328, 3548,
-    1689, 2482, 3768, 2603, 1745, 1755, 39,   1632, 3337, 3557, 1698, 3382,
-    6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811,
-    1821, 1830, 51,   1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830,
-    1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504,
-    4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896,
-    1904, 63,   171,  2512, 2633, 183,  2513, 4426, 2634, 2743, 2744, 195,
-    2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207,  2515, 4428,
-    2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933,
-    219,  227,  1940, 228,  1941, 1951, 229,  1942, 1952, 1961, 230,  1943,
-    1953, 1962, 1970, 231,  71,   72,   73,   74,   75,   16,   1614, 2472,
-    1680, 28,   1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,
-    1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989,
-    2615, 3998, 4043, 2725, 1812, 1822, 1831, 52,   1641, 3346, 3566, 1707,
-    3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867,
-    4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271,
-    4307, 2835, 1878, 1888, 1897, 1905, 64,   1648, 3353, 3573, 1714, 3398,
-    6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013,
-    4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602,
-    4122, 4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747,
-    4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963,
-    1971, 1978, 76,   172,  2523, 2644, 184,  2524, 4646, 2645, 2754, 2755,
-    196,  2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208,  2526,
-    4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943,
-    2944, 220,  2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857,
-    4673, 4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021, 3022, 232,  239,
-    2006, 240,  2007, 2017, 241,  2008, 2018, 2027, 242,  2009, 2019, 2028,
-    2036, 243,  2010, 2020, 2029, 2037, 2044, 244,  83,   84,   85,   86,
-    87,   88,   17,   1615, 2473, 1681, 29,   1625, 3330, 3550, 1691, 2484,
-    3770, 2605, 1747, 1757, 41,   1634, 3339, 3559, 1700, 3384, 6188, 3604,
-    3779, 3824, 1766, 2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832,
-    53,   1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428,
-    6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627,
-    4219, 4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65,
-    1649, 3354, 3574, 1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239,
-    3655, 6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387,
-    6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517,
-    4430, 2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535,
-    4563, 2935, 1945, 1955, 1964, 1972, 1979, 77,   1655, 3360, 3580, 1721,
-    3405, 6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881,
-    4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805,
-    7014, 4129, 4240, 4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742,
-    3930, 6498, 6826, 7035, 4150, 6554, 6882, 7091, 1603, 4370, 4460, 4505,
-    4541, 4569, 4590, 1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712,
-    4748, 2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725, 4761, 4789, 4810,
-    3023, 2011, 2021, 2030, 2038, 2045, 2051, 89,   173,  2534, 2655, 185,
-    2535, 4866, 2656, 2765, 2766, 197,  2536, 4867, 2657, 4876, 4921, 2767,
-    2864, 2865, 2866, 209,  2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930,
-    4966, 2867, 2952, 2953, 2954, 2955, 221,  2538, 4869, 2659, 4878, 4923,
-    2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030,
-    3031, 3032, 3033, 233,  2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932,
-    4968, 2869, 4894, 4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009, 5030,
-    3034, 3095, 3096, 3097, 3098, 3099, 3100, 245,  251,  2072, 252,  2073,
-    2083, 253,  2074, 2084, 2093, 254,  2075, 2085, 2094, 2102, 255,  2076,
-    2086, 2095, 2103, 2110, 256,  2077, 2087, 2096, 2104, 2111, 2117, 257,
-    95,   96,   97,   98,   99,   100,  101,  18,   1616, 2474, 1682, 30,
-    1626, 3331, 3551, 1692, 2485, 3771, 2606, 1748, 1758, 42,   1635, 3340,
-    3560, 1701, 3385, 6189, 3605, 3780, 3825, 1767, 2496, 3991, 2617, 4000,
-    4045, 2727, 1814, 1824, 1833, 54,   1643, 3348, 3568, 1709, 3393, 6197,
-    3613, 3788, 3833, 1775, 3429, 6233, 3649, 6353, 6681, 3869, 4008, 4053,
-    4089, 1841, 2507, 4211, 2628, 4220, 4265, 2738, 4228, 4273, 4309, 2837,
-    1880, 1890, 1899, 1907, 66,   1650, 3355, 3575, 1716, 3400, 6204, 3620,
-    3795, 3840, 1782, 3436, 6240, 3656, 6360, 6688, 3876, 4015, 4060, 4096,
-    1848, 3464, 6268, 3684, 6388, 6716, 3904, 6472, 6800, 7009, 4124, 4235,
-    4280, 4316, 4344, 1914, 2518, 4431, 2639, 4440, 4485, 2749, 4448, 4493,
-    4529, 2848, 4455, 4500, 4536, 4564, 2936, 1946, 1956, 1965, 1973, 1980,
-    78,   1656, 3361, 3581, 1722, 3406, 6210, 3626, 3801, 3846, 1788, 3442,
-    6246, 3662, 6366, 6694, 3882, 4021, 4066, 4102, 1854, 3470, 6274, 3690,
-    6394, 6722, 3910, 6478, 6806, 7015, 4130, 4241, 4286, 4322, 4350, 1920,
-    3491, 6295, 3711, 6415, 6743, 3931, 6499, 6827, 7036, 4151, 6555, 6883,
-    7092, 7217, 4371, 4461, 4506, 4542, 4570, 4591, 1986, 2529, 4651, 2650,
-    4660, 4705, 2760, 4668, 4713, 4749, 2859, 4675, 4720, 4756, 4784, 2947,
-    4681, 4726, 4762, 4790, 4811, 3024, 2012, 2022, 2031, 2039, 2046, 2052,
-    90,   1661, 3366, 3586, 1727, 3411, 6215, 3631, 3806, 3851, 1793, 3447,
-    6251, 3667, 6371, 6699, 3887, 4026, 4071, 4107, 1859, 3475, 6279, 3695,
-    6399, 6727, 3915, 6483, 6811, 7020, 4135, 4246, 4291, 4327, 4355, 1925,
-    3496, 6300, 3716, 6420, 6748, 3936, 6504, 6832, 7041, 4156, 6560, 6888,
-    7097, 7222, 4376, 4466, 4511, 4547, 4575, 4596, 1991, 3511, 6315, 3731,
-    6435, 6763, 3951, 6519, 6847, 7056, 4171, 6575, 6903, 7112, 7237, 4391,
-    6610, 6938, 7147, 7272, 1604, 4611, 4686, 4731, 4767, 4795, 4816, 4831,
-    2057, 2540, 4871, 2661, 4880, 4925, 2771, 4888, 4933, 4969, 2870, 4895,
-    4940, 4976, 5004, 2958, 4901, 4946, 4982, 5010, 5031, 3035, 4906, 4951,
-    4987, 5015, 5036, 5051, 3101, 2078, 2088, 2097, 2105, 2112, 2118, 2123,
-    102,  174,  2545, 2666, 186,  2546, 5086, 2667, 2776, 2777, 198,  2547,
-    5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,  2548, 5088, 2669,
-    5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222,
-    2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158,
-    5194, 5222, 2967, 3040, 3041, 3042, 3043, 3044, 234,  2550, 5090, 2671,
-    5099, 5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968,
-    5120, 5165, 5201, 5229, 5250, 3045, 3106, 3107, 3108, 3109, 3110, 3111,
-    246,  2551, 5091, 2672, 5100, 5145, 2782, 5108, 5153, 5189, 2881, 5115,
-    5160, 5196, 5224, 2969, 5121, 5166, 5202, 5230, 5251, 3046, 5126, 5171,
-    5207, 5235, 5256, 5271, 3112, 3161, 3162, 3163, 3164, 3165, 3166, 3167,
-    258,  263,  2138, 264,  2139, 2149, 265,  2140, 2150, 2159, 266,  2141,
-    2151, 2160, 2168, 267,  2142, 2152, 2161, 2169, 2176, 268,  2143, 2153,
-    2162, 2170, 2177, 2183, 269,  2144, 2154, 2163, 2171, 2178, 2184, 2189,
-    270,  107,  108,  109,  110,  111,  112,  113,  114,  19,   1617, 2475,
-    1683, 31,   1627, 3332, 3552, 1693, 2486, 3772, 2607, 1749, 1759, 43,
-    1636, 3341, 3561, 1702, 3386, 6190, 3606, 3781, 3826, 1768, 2497, 3992,
-    2618, 4001, 4046, 2728, 1815, 1825, 1834, 55,   1644, 3349, 3569, 1710,
-    3394, 6198, 3614, 3789, 3834, 1776, 3430, 6234, 3650, 6354, 6682, 3870,
-    4009, 4054, 4090, 1842, 2508, 4212, 2629, 4221, 4266, 2739, 4229, 4274,
-    4310, 2838, 1881, 1891, 1900, 1908, 67,   1651, 3356, 3576, 1717, 3401,
-    6205, 3621, 3796, 3841, 1783, 3437, 6241, 3657, 6361, 6689, 3877, 4016,
-    4061, 4097, 1849, 3465, 6269, 3685, 6389, 6717, 3905, 6473, 6801, 7010,
-    4125, 4236, 4281, 4317, 4345, 1915, 2519, 4432, 2640, 4441, 4486, 2750,
-    4449, 4494, 4530, 2849, 4456, 4501, 4537, 4565, 2937, 1947, 1957, 1966,
-    1974, 1981, 79,   1657, 3362, 3582, 1723, 3407, 6211, 3627, 3802, 3847,
-    1789, 3443, 6247, 3663, 6367, 6695, 3883, 4022, 4067, 4103, 1855, 3471,
-    6275, 3691, 6395, 6723, 3911, 6479, 6807, 7016, 4131, 4242, 4287, 4323,
-    4351, 1921, 3492, 6296, 3712, 6416, 6744, 3932, 6500, 6828, 7037, 4152,
-    6556, 6884, 7093, 7218, 4372, 4462, 4507, 4543, 4571, 4592, 1987, 2530,
-    4652, 2651, 4661, 4706, 2761, 4669, 4714, 4750, 2860, 4676, 4721, 4757,
-    4785, 2948, 4682, 4727, 4763, 4791, 4812, 3025, 2013, 2023, 2032, 2040,
-    2047, 2053, 91,   1662, 3367, 3587, 1728, 3412, 6216, 3632, 3807, 3852,
-    1794, 3448, 6252, 3668, 6372, 6700, 3888, 4027, 4072, 4108, 1860, 3476,
-    6280, 3696, 6400, 6728, 3916, 6484, 6812, 7021, 4136, 4247, 4292, 4328,
-    4356, 1926, 3497, 6301, 3717, 6421, 6749, 3937, 6505, 6833, 7042, 4157,
-    6561, 6889, 7098, 7223, 4377, 4467, 4512, 4548, 4576, 4597, 1992, 3512,
-    6316, 3732, 6436, 6764, 3952, 6520, 6848, 7057, 4172, 6576, 6904, 7113,
-    7238, 4392, 6611, 6939, 7148, 7273, 7342, 4612, 4687, 4732, 4768, 4796,
-    4817, 4832, 2058, 2541, 4872, 2662, 4881, 4926, 2772, 4889, 4934, 4970,
-    2871, 4896, 4941, 4977, 5005, 2959, 4902, 4947, 4983, 5011, 5032, 3036,
-    4907, 4952, 4988, 5016, 5037, 5052, 3102, 2079, 2089, 2098, 2106, 2113,
-    2119, 2124, 103,  1666, 3371, 3591, 1732, 3416, 6220, 3636, 3811, 3856,
-    1798, 3452, 6256, 3672, 6376, 6704, 3892, 4031, 4076, 4112, 1864, 3480,
-    6284, 3700, 6404, 6732, 3920, 6488, 6816, 7025, 4140, 4251, 4296, 4332,
-    4360, 1930, 3501, 6305, 3721, 6425, 6753, 3941, 6509, 6837, 7046, 4161,
-    6565, 6893, 7102, 7227, 4381, 4471, 4516, 4552, 4580, 4601, 1996, 3516,
-    6320, 3736, 6440, 6768, 3956, 6524, 6852, 7061, 4176, 6580, 6908, 7117,
-    7242, 4396, 6615, 6943, 7152, 7277, 7346, 4616, 4691, 4736, 4772, 4800,
-    4821, 4836, 2062, 3526, 6330, 3746, 6450, 6778, 3966, 6534, 6862, 7071,
-    4186, 6590, 6918, 7127, 7252, 4406, 6625, 6953, 7162, 7287, 7356, 4626,
-    6645, 6973, 7182, 7307, 7376, 1605, 4846, 4911, 4956, 4992, 5020, 5041,
-    5056, 5066, 2128, 2552, 5092, 2673, 5101, 5146, 2783, 5109, 5154, 5190,
-    2882, 5116, 5161, 5197, 5225, 2970, 5122, 5167, 5203, 5231, 5252, 3047,
-    5127, 5172, 5208, 5236, 5257, 5272, 3113, 5131, 5176, 5212, 5240, 5261,
-    5276, 5286, 3168, 2145, 2155, 2164, 2172, 2179, 2185, 2190, 2194, 115,
-    175,  2556, 2677, 187,  2557, 5306, 2678, 2787, 2788, 199,  2558, 5307,
-    2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,  2559, 5308, 2680, 5317,
-    5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,  2560,
-    5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414,
-    5442, 2978, 3051, 3052, 3053, 3054, 3055, 235,  2561, 5310, 2682, 5319,
-    5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340,
-    5385, 5421, 5449, 5470, 3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,
-    2562, 5311, 2683, 5320, 5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380,
-    5416, 5444, 2980, 5341, 5386, 5422, 5450, 5471, 3057, 5346, 5391, 5427,
-    5455, 5476, 5491, 3123, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 259,
-    2563, 5312, 2684, 5321, 5366, 2794, 5329, 5374, 5410, 2893, 5336, 5381,
-    5417, 5445, 2981, 5342, 5387, 5423, 5451, 5472, 3058, 5347, 5392, 5428,
-    5456, 5477, 5492, 3124, 5351, 5396, 5432, 5460, 5481, 5496, 5506, 3179,
-    3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 271,  275,  2204, 276,
-    2205, 2215, 277,  2206, 2216, 2225, 278,  2207, 2217, 2226, 2234, 279,
-    2208, 2218, 2227, 2235, 2242, 280,  2209, 2219, 2228, 2236, 2243, 2249,
-    281,  2210, 2220, 2229, 2237, 2244, 2250, 2255, 282,  2211, 2221, 2230,
-    2238, 2245, 2251, 2256, 2260, 283,  119,  120,  121,  122,  123,  124,
-    125,  126,  127,  20,   1618, 2476, 1684, 32,   1628, 3333, 3553, 1694,
-    2487, 3773, 2608, 1750, 1760, 44,   1637, 3342, 3562, 1703, 3387, 6191,
-    3607, 3782, 3827, 1769, 2498, 3993, 2619, 4002, 4047, 2729, 1816, 1826,
-    1835, 56,   1645, 3350, 3570, 1711, 3395, 6199, 3615, 3790, 3835, 1777,
-    3431, 6235, 3651, 6355, 6683, 3871, 4010, 4055, 4091, 1843, 2509, 4213,
-    2630, 4222, 4267, 2740, 4230, 4275, 4311, 2839, 1882, 1892, 1901, 1909,
-    68,   1652, 3357, 3577, 1718, 3402, 6206, 3622, 3797, 3842, 1784, 3438,
-    6242, 3658, 6362, 6690, 3878, 4017, 4062, 4098, 1850, 3466, 6270, 3686,
-    6390, 6718, 3906, 6474, 6802, 7011, 4126, 4237, 4282, 4318, 4346, 1916,
-    2520, 4433, 2641, 4442, 4487, 2751, 4450, 4495, 4531, 2850, 4457, 4502,
-    4538, 4566, 2938, 1948, 1958, 1967, 1975, 1982, 80,   1658, 3363, 3583,
-    1724, 3408, 6212, 3628, 3803, 3848, 1790, 3444, 6248, 3664, 6368, 6696,
-    3884, 4023, 4068, 4104, 1856, 3472, 6276, 3692, 6396, 6724, 3912, 6480,
-    6808, 7017, 4132, 4243, 4288, 4324, 4352, 1922, 3493, 6297, 3713, 6417,
-    6745, 3933, 6501, 6829, 7038, 4153, 6557, 6885, 7094, 7219, 4373, 4463,
-    4508, 4544, 4572, 4593, 1988, 2531, 4653, 2652, 4662, 4707, 2762, 4670,
-    4715, 4751, 2861, 4677, 4722, 4758, 4786, 2949, 4683, 4728, 4764, 4792,
-    4813, 3026, 2014, 2024, 2033, 2041, 2048, 2054, 92,   1663, 3368, 3588,
-    1729, 3413, 6217, 3633, 3808, 3853, 1795, 3449, 6253, 3669, 6373, 6701,
-    3889, 4028, 4073, 4109, 1861, 3477, 6281, 3697, 6401, 6729, 3917, 6485,
-    6813, 7022, 4137, 4248, 4293, 4329, 4357, 1927, 3498, 6302, 3718, 6422,
-    6750, 3938, 6506, 6834, 7043, 4158, 6562, 6890, 7099, 7224, 4378, 4468,
-    4513, 4549, 4577, 4598, 1993, 3513, 6317, 3733, 6437, 6765, 3953, 6521,
-    6849, 7058, 4173, 6577, 6905, 7114, 7239, 4393, 6612, 6940, 7149, 7274,
-    7343, 4613, 4688, 4733, 4769, 4797, 4818, 4833, 2059, 2542, 4873, 2663,
-    4882, 4927, 2773, 4890, 4935, 4971, 2872, 4897, 4942, 4978, 5006, 2960,
-    4903, 4948, 4984, 5012, 5033, 3037, 4908, 4953, 4989, 5017, 5038, 5053,
-    3103, 2080, 2090, 2099, 2107, 2114, 2120, 2125, 104,  1667, 3372, 3592,
-    1733, 3417, 6221, 3637, 3812, 3857, 1799, 3453, 6257, 3673, 6377, 6705,
-    3893, 4032, 4077, 4113, 1865, 3481, 6285, 3701, 6405, 6733, 3921, 6489,
-    6817, 7026, 4141, 4252, 4297, 4333, 4361, 1931, 3502, 6306, 3722, 6426,
-    6754, 3942, 6510, 6838, 7047, 4162, 6566, 6894, 7103, 7228, 4382, 4472,
-    4517, 4553, 4581, 4602, 1997, 3517, 6321, 3737, 6441, 6769, 3957, 6525,
-    6853, 7062, 4177, 6581, 6909, 7118, 7243, 4397, 6616, 6944, 7153, 7278,
-    7347, 4617, 4692, 4737, 4773, 4801, 4822, 4837, 2063, 3527, 6331, 3747,
-    6451, 6779, 3967, 6535, 6863, 7072, 4187, 6591, 6919, 7128, 7253, 4407,
-    6626, 6954, 7163, 7288, 7357, 4627, 6646, 6974, 7183, 7308, 7377, 7411,
-    4847, 4912, 4957, 4993, 5021, 5042, 5057, 5067, 2129, 2553, 5093, 2674,
-    5102, 5147, 2784, 5110, 5155, 5191, 2883, 5117, 5162, 5198, 5226, 2971,
-    5123, 5168, 5204, 5232, 5253, 3048, 5128, 5173, 5209, 5237, 5258, 5273,
-    3114, 5132, 5177, 5213, 5241, 5262, 5277, 5287, 3169, 2146, 2156, 2165,
-    2173, 2180, 2186, 2191, 2195, 116,  1609, 1609, 1609, 1736, 1609, 1609,
-    3640, 1609, 3860, 1802, 1609, 1609, 3676, 1609, 6708, 3896, 1609, 4080,
-    4116, 1868, 1609, 1609, 3704, 1609, 6736, 3924, 1609, 6820, 7029, 4144,
-    1609, 4300, 4336, 4364, 1934, 1609, 1609, 3725, 1609, 6757, 3945, 1609,
-    6841, 7050, 4165, 1609, 6897, 7106, 7231, 4385, 1609, 4520, 4556, 4584,
-    4605, 2000, 1609, 1609, 3740, 1609, 6772, 3960, 1609, 6856, 7065, 4180,
-    1609, 6912, 7121, 7246, 4400, 1609, 6947, 7156, 7281, 7350, 4620, 1609,
-    4740, 4776, 4804, 4825, 4840, 2066, 1609, 1609, 3750, 1609, 6782, 3970,
-    1609, 6866, 7075, 4190, 1609, 6922, 7131, 7256, 4410, 1609, 6957, 7166,
-    7291, 7360, 4630, 1609, 6977, 7186, 7311, 7380, 7414, 4850, 1609, 4960,
-    4996, 5024, 5045, 5060, 5070, 2132, 1608, 1608, 1608, 1608, 1608, 1608,
-    1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608,
-    1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1607, 1607,
-    1607, 1607, 1607, 1607, 1606, 1607, 1608, 1608, 1608, 1608, 1608, 1608,
-    1608, 1607, 1608, 1609, 1609, 2685, 1609, 5367, 2795, 1609, 5375, 5411,
-    2894, 1609, 5382, 5418, 5446, 2982, 1609, 5388, 5424, 5452, 5473, 3059,
-    1609, 5393, 5429, 5457, 5478, 5493, 3125, 1609, 5397, 5433, 5461, 5482,
-    5497, 5507, 3180, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1607, 1608,
-    1609, 2222, 2231, 2239, 2246, 2252, 2257, 2261, 1608, 128,  176,  2567,
-    2688, 188,  2568, 5526, 2689, 2798, 2799, 200,  2569, 5527, 2690, 5536,
-    5581, 2800, 2897, 2898, 2899, 212,  2570, 5528, 2691, 5537, 5582, 2801,
-    5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224,  2571, 5529, 2692,
-    5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634, 5662, 2989,
-    3062, 3063, 3064, 3065, 3066, 236,  2572, 5530, 2693, 5539, 5584, 2803,
-    5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990, 5560, 5605, 5641,
-    5669, 5690, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248,  2573, 5531,
-    2694, 5540, 5585, 2804, 5548, 5593, 5629, 2903, 5555, 5600, 5636, 5664,
-    2991, 5561, 5606, 5642, 5670, 5691, 3068, 5566, 5611, 5647, 5675, 5696,
-    5711, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260,  2574, 5532,
-    2695, 5541, 5586, 2805, 5549, 5594, 5630, 2904, 5556, 5601, 5637, 5665,
-    2992, 5562, 5607, 5643, 5671, 5692, 3069, 5567, 5612, 5648, 5676, 5697,
-    5712, 3135, 5571, 5616, 5652, 5680, 5701, 5716, 5726, 3190, 3227, 3228,
-    3229, 3230, 3231, 3232, 3233, 3234, 272,  1609, 1609, 2696, 1609, 5587,
-    2806, 1609, 5595, 5631, 2905, 1609, 5602, 5638, 5666, 2993, 1609, 5608,
-    5644, 5672, 5693, 3070, 1609, 5613, 5649, 5677, 5698, 5713, 3136, 1609,
-    5617, 5653, 5681, 5702, 5717, 5727, 3191, 1608, 1608, 1608, 1608, 1608,
-    1608, 1608, 1607, 1608, 1609, 3261, 3262, 3263, 3264, 3265, 3266, 3267,
-    1608, 284,  287,  2270, 288,  2271, 2281, 289,  2272, 2282, 2291, 290,
-    2273, 2283, 2292, 2300, 291,  2274, 2284, 2293, 2301, 2308, 292,  2275,
-    2285, 2294, 2302, 2309, 2315, 293,  2276, 2286, 2295, 2303, 2310, 2316,
-    2321, 294,  2277, 2287, 2296, 2304, 2311, 2317, 2322, 2326, 295,  1609,
-    2288, 2297, 2305, 2312, 2318, 2323, 2327, 1608, 296,  131,  132,  133,
-    134,  135,  136,  137,  138,  139,  140,  21,   177,  2477, 189,  33,
-    177,  2578, 2699, 189,  2488, 2809, 2609, 201,  201,  45,   177,  2578,
-    2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2499, 2908, 2620, 2908,
-    2909, 2730, 213,  213,  213,  57,   177,  2578, 2699, 189,  2579, 5746,
-    2700, 2809, 2810, 201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909,
-    2910, 213,  2510, 2996, 2631, 2996, 2997, 2741, 2996, 2997, 2998, 2840,
-    225,  225,  225,  225,  69,   177,  2578, 2699, 189,  2579, 5746, 2700,
-    2809, 2810, 201,  2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910,
-    213,  2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996,
-    2997, 2998, 2999, 225,  2521, 3073, 2642, 3073, 3074, 2752, 3073, 3074,
-    3075, 2851, 3073, 3074, 3075, 3076, 2939, 237,  237,  237,  237,  237,
-    81,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580,
-    5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,  2581, 5748, 2702,
-    5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,
-    2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818,
-    5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237,  2532, 3139, 2653,
-    3139, 3140, 2763, 3139, 3140, 3141, 2862, 3139, 3140, 3141, 3142, 2950,
-    3139, 3140, 3141, 3142, 3143, 3027, 249,  249,  249,  249,  249,  249,
-    93,   177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580,
-    5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,  2581, 5748, 2702,
-    5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,
-    2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818,
-    5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237,  2583, 5750, 2704,
-    5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001,
-    5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144,
-    249,  2543, 3194, 2664, 3194, 3195, 2774, 3194, 3195, 3196, 2873, 3194,
-    3195, 3196, 3197, 2961, 3194, 3195, 3196, 3197, 3198, 3038, 3194, 3195,
-    3196, 3197, 3198, 3199, 3104, 261,  261,  261,  261,  261,  261,  261,
-    105,  177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580,
-    5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,  2581, 5748, 2702,
-    5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,
-    2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818,
-    5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237,  2583, 5750, 2704,
-    5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001,
-    5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144,
-    249,  2584, 5751, 2705, 5760, 5805, 2815, 5768, 5813, 5849, 2914, 5775,
-    5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890, 5911, 3079, 5786, 5831,
-    5867, 5895, 5916, 5931, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200,
-    261,  2554, 3238, 2675, 3238, 3239, 2785, 3238, 3239, 3240, 2884, 3238,
-    3239, 3240, 3241, 2972, 3238, 3239, 3240, 3241, 3242, 3049, 3238, 3239,
-    3240, 3241, 3242, 3243, 3115, 3238, 3239, 3240, 3241, 3242, 3243, 3244,
-    3170, 273,  273,  273,  273,  273,  273,  273,  273,  117,  177,  2578,
-    2699, 189,  2579, 5746, 2700, 2809, 2810, 201,  2580, 5747, 2701, 5756,
-    5801, 2811, 2908, 2909, 2910, 213,  2581, 5748, 2702, 5757, 5802, 2812,
-    5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,  2582, 5749, 2703,
-    5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000,
-    3073, 3074, 3075, 3076, 3077, 237,  2583, 5750, 2704, 5759, 5804, 2814,
-    5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825, 5861,
-    5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249,  2584, 5751,
-    2705, 5760, 5805, 2815, 5768, 5813, 5849, 2914, 5775, 5820, 5856, 5884,
-    3002, 5781, 5826, 5862, 5890, 5911, 3079, 5786, 5831, 5867, 5895, 5916,
-    5931, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 261,  2585, 5752,
-    2706, 5761, 5806, 2816, 5769, 5814, 5850, 2915, 5776, 5821, 5857, 5885,
-    3003, 5782, 5827, 5863, 5891, 5912, 3080, 5787, 5832, 5868, 5896, 5917,
-    5932, 3146, 5791, 5836, 5872, 5900, 5921, 5936, 5946, 3201, 3238, 3239,
-    3240, 3241, 3242, 3243, 3244, 3245, 273,  2565, 3271, 2686, 3271, 3272,
-    2796, 3271, 3272, 3273, 2895, 3271, 3272, 3273, 3274, 2983, 3271, 3272,
-    3273, 3274, 3275, 3060, 3271, 3272, 3273, 3274, 3275, 3276, 3126, 3271,
-    3272, 3273, 3274, 3275, 3276, 3277, 3181, 3271, 3272, 3273, 3274, 3275,
-    3276, 3277, 3278, 3225, 285,  285,  285,  285,  285,  285,  285,  285,
-    285,  129,  177,  2578, 2699, 189,  2579, 5746, 2700, 2809, 2810, 201,
-    2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,  2581, 5748,
-    2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999,
-    225,  2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773,
-    5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237,  2583, 5750,
-    2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883,
-    3001, 5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143,
-    3144, 249,  2584, 5751, 2705, 5760, 5805, 2815, 5768, 5813, 5849, 2914,
-    5775, 5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890, 5911, 3079, 5786,
-    5831, 5867, 5895, 5916, 5931, 3145, 3194, 3195, 3196, 3197, 3198, 3199,
-    3200, 261,  2585, 5752, 2706, 5761, 5806, 2816, 5769, 5814, 5850, 2915,
-    5776, 5821, 5857, 5885, 3003, 5782, 5827, 5863, 5891, 5912, 3080, 5787,
-    5832, 5868, 5896, 5917, 5932, 3146, 5791, 5836, 5872, 5900, 5921, 5936,
-    5946, 3201, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 273,  1609,
-    1609, 2707, 1609, 5807, 2817, 1609, 5815, 5851, 2916, 1609, 5822, 5858,
-    5886, 3004, 1609, 5828, 5864, 5892, 5913, 3081, 1609, 5833, 5869, 5897,
-    5918, 5933, 3147, 1609, 5837, 5873, 5901, 5922, 5937, 5947, 3202, 1608,
-    1608, 1608, 1608, 1608, 1608, 1608, 1607, 1608, 1609, 3272, 3273, 3274,
-    3275, 3276, 3277, 3278, 1608, 285,  2576, 3293, 2697, 3293, 3294, 2807,
-    3293, 3294, 3295, 2906, 3293, 3294, 3295, 3296, 2994, 3293, 3294, 3295,
-    3296, 3297, 3071, 3293, 3294, 3295, 3296, 3297, 3298, 3137, 3293, 3294,
-    3295, 3296, 3297, 3298, 3299, 3192, 3293, 3294, 3295, 3296, 3297, 3298,
-    3299, 3300, 3236, 1609, 3294, 3295, 3296, 3297, 3298, 3299, 3300, 1608,
-    3269, 297,  297,  297,  297,  297,  297,  297,  297,  297,  297,  141,
-    177,  299,  300,  189,  299,  2336, 300,  301,  301,  201,  299,  2336,
-    300,  2337, 2347, 301,  302,  302,  302,  213,  299,  2336, 300,  2337,
-    2347, 301,  2338, 2348, 2357, 302,  303,  303,  303,  303,  225,  299,
-    2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349, 2358,
-    2366, 303,  304,  304,  304,  304,  304,  237,  299,  2336, 300,  2337,
-    2347, 301,  2338, 2348, 2357, 302,  2339, 2349, 2358, 2366, 303,  2340,
-    2350, 2359, 2367, 2374, 304,  305,  305,  305,  305,  305,  305,  249,
-    299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349,
-    2358, 2366, 303,  2340, 2350, 2359, 2367, 2374, 304,  2341, 2351, 2360,
-    2368, 2375, 2381, 305,  306,  306,  306,  306,  306,  306,  306,  261,
-    299,  2336, 300,  2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349,
-    2358, 2366, 303,  2340, 2350, 2359, 2367, 2374, 304,  2341, 2351, 2360,
-    2368, 2375, 2381, 305,  2342, 2352, 2361, 2369, 2376, 2382, 2387, 306,
-    307,  307,  307,  307,  307,  307,  307,  307,  273,  299,  2336, 300,
-    2337, 2347, 301,  2338, 2348, 2357, 302,  2339, 2349, 2358, 2366, 303,
-    2340, 2350, 2359, 2367, 2374, 304,  2341, 2351, 2360, 2368, 2375, 2381,
-    305,  2342, 2352, 2361, 2369, 2376, 2382, 2387, 306,  2343, 2353, 2362,
-    2370, 2377, 2383, 2388, 2392, 307,  308,  308,  308,  308,  308,  308,
-    308,  308,  308,  285,  299,  2336, 300,  2337, 2347, 301,  2338, 2348,
-    2357, 302,  2339, 2349, 2358, 2366, 303,  2340, 2350, 2359, 2367, 2374,
-    304,  2341, 2351, 2360, 2368, 2375, 2381, 305,  2342, 2352, 2361, 2369,
-    2376, 2382, 2387, 306,  2343, 2353, 2362, 2370, 2377, 2383, 2388, 2392,
-    307,  1609, 2354, 2363, 2371, 2378, 2384, 2389, 2393, 1608, 308,  309,
-    309,  309,  309,  309,  309,  309,  309,  309,  309,  297,  143,  143,
-    144,  143,  144,  145,  143,  144,  145,  146,  143,  144,  145,  146,
-    147,  143,  144,  145,  146,  147,  148,  143,  144,  145,  146,  147,
-    148,  149,  143,  144,  145,  146,  147,  148,  149,  150,  143,  144,
-    145,  146,  147,  148,  149,  150,  151,  143,  144,  145,  146,  147,
-    148,  149,  150,  151,  152,  143,  144,  145,  146,  147,  148,  149,
-    150,  151,  152,  153,  11,   167,  179,  23,   12,   178,  2468, 190,
-    24,   168,  2479, 2600, 180,  191,  202,  192,  35,   36,   13,   178,
-    2469, 190,  25,   178,  2589, 2710, 190,  2480, 2820, 2601, 202,  202,
-    37,   169,  2490, 2611, 181,  2491, 2919, 2612, 2721, 2722, 193,  203,
-    214,  204,  214,  214,  205,  47,   48,   49,   14,   178,  2470, 190,
-    26,   178,  2589, 2710, 190,  2481, 2820, 2602, 202,  202,  38,   178,
-    2589, 2710, 190,  2590, 1600, 2711, 2820, 2821, 202,  2492, 2919, 2613,
-    2919, 2920, 2723, 214,  214,  214,  50,   170,  2501, 2622, 182,  2502,
-    3007, 2623, 2732, 2733, 194,  2503, 3007, 2624, 3007, 3008, 2734, 2831,
-    2832, 2833, 206,  215,  226,  216,  226,  226,  217,  226,  226,  226,
-    218,  59,   60,   61,   62,   15,   178,  2471, 190,  27,   178,  2589,
-    2710, 190,  2482, 2820, 2603, 202,  202,  39,   178,  2589, 2710, 190,
-    2590, 5966, 2711, 2820, 2821, 202,  2493, 2919, 2614, 2919, 2920, 2724,
-    214,  214,  214,  51,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820,
-    2821, 202,  2591, 5967, 2712, 5976, 1601, 2822, 2919, 2920, 2921, 214,
-    2504, 3007, 2625, 3007, 3008, 2735, 3007, 3008, 3009, 2834, 226,  226,
-    226,  226,  63,   171,  2512, 2633, 183,  2513, 3084, 2634, 2743, 2744,
-    195,  2514, 3084, 2635, 3084, 3085, 2745, 2842, 2843, 2844, 207,  2515,
-    3084, 2636, 3084, 3085, 2746, 3084, 3085, 3086, 2845, 2930, 2931, 2932,
-    2933, 219,  227,  238,  228,  238,  238,  229,  238,  238,  238,  230,
-    238,  238,  238,  238,  231,  71,   72,   73,   74,   75,   16,   178,
-    2472, 190,  28,   178,  2589, 2710, 190,  2483, 2820, 2604, 202,  202,
-    40,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,  2494,
-    2919, 2615, 2919, 2920, 2725, 214,  214,  214,  52,   178,  2589, 2710,
-    190,  2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021,
-    2822, 2919, 2920, 2921, 214,  2505, 3007, 2626, 3007, 3008, 2736, 3007,
-    3008, 3009, 2835, 226,  226,  226,  226,  64,   178,  2589, 2710, 190,
-    2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021, 2822,
-    2919, 2920, 2921, 214,  2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030,
-    1602, 2922, 3007, 3008, 3009, 3010, 226,  2516, 3084, 2637, 3084, 3085,
-    2747, 3084, 3085, 3086, 2846, 3084, 3085, 3086, 3087, 2934, 238,  238,
-    238,  238,  238,  76,   172,  2523, 2644, 184,  2524, 3150, 2645, 2754,
-    2755, 196,  2525, 3150, 2646, 3150, 3151, 2756, 2853, 2854, 2855, 208,
-    2526, 3150, 2647, 3150, 3151, 2757, 3150, 3151, 3152, 2856, 2941, 2942,
-    2943, 2944, 220,  2527, 3150, 2648, 3150, 3151, 2758, 3150, 3151, 3152,
-    2857, 3150, 3151, 3152, 3153, 2945, 3018, 3019, 3020, 3021, 3022, 232,
-    239,  250,  240,  250,  250,  241,  250,  250,  250,  242,  250,  250,
-    250,  250,  243,  250,  250,  250,  250,  250,  244,  83,   84,   85,
-    86,   87,   88,   17,   178,  2473, 190,  29,   178,  2589, 2710, 190,
-    2484, 2820, 2605, 202,  202,  41,   178,  2589, 2710, 190,  2590, 5966,
-    2711, 2820, 2821, 202,  2495, 2919, 2616, 2919, 2920, 2726, 214,  214,
-    214,  53,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,
-    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2506, 3007,
-    2627, 3007, 3008, 2737, 3007, 3008, 3009, 2836, 226,  226,  226,  226,
-    65,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,  2591,
-    5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2592, 5968, 2713,
-    5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226,
-    2517, 3084, 2638, 3084, 3085, 2748, 3084, 3085, 3086, 2847, 3084, 3085,
-    3086, 3087, 2935, 238,  238,  238,  238,  238,  77,   178,  2589, 2710,
-    190,  2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021,
-    2822, 2919, 2920, 2921, 214,  2592, 5968, 2713, 5977, 6022, 2823, 5985,
-    6030, 6066, 2922, 3007, 3008, 3009, 3010, 226,  2593, 5969, 2714, 5978,
-    6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 1603, 3011, 3084,
-    3085, 3086, 3087, 3088, 238,  2528, 3150, 2649, 3150, 3151, 2759, 3150,
-    3151, 3152, 2858, 3150, 3151, 3152, 3153, 2946, 3150, 3151, 3152, 3153,
-    3154, 3023, 250,  250,  250,  250,  250,  250,  89,   173,  2534, 2655,
-    185,  2535, 3205, 2656, 2765, 2766, 197,  2536, 3205, 2657, 3205, 3206,
-    2767, 2864, 2865, 2866, 209,  2537, 3205, 2658, 3205, 3206, 2768, 3205,
-    3206, 3207, 2867, 2952, 2953, 2954, 2955, 221,  2538, 3205, 2659, 3205,
-    3206, 2769, 3205, 3206, 3207, 2868, 3205, 3206, 3207, 3208, 2956, 3029,
-    3030, 3031, 3032, 3033, 233,  2539, 3205, 2660, 3205, 3206, 2770, 3205,
-    3206, 3207, 2869, 3205, 3206, 3207, 3208, 2957, 3205, 3206, 3207, 3208,
-    3209, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245,  251,  262,  252,
-    262,  262,  253,  262,  262,  262,  254,  262,  262,  262,  262,  255,
-    262,  262,  262,  262,  262,  256,  262,  262,  262,  262,  262,  262,
-    257,  95,   96,   97,   98,   99,   100,  101,  18,   178,  2474, 190,
-    30,   178,  2589, 2710, 190,  2485, 2820, 2606, 202,  202,  42,   178,
-    2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,  2496, 2919, 2617,
-    2919, 2920, 2727, 214,  214,  214,  54,   178,  2589, 2710, 190,  2590,
-    5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021, 2822, 2919,
-    2920, 2921, 214,  2507, 3007, 2628, 3007, 3008, 2738, 3007, 3008, 3009,
-    2837, 226,  226,  226,  226,  66,   178,  2589, 2710, 190,  2590, 5966,
-    2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920,
-    2921, 214,  2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922,
-    3007, 3008, 3009, 3010, 226,  2518, 3084, 2639, 3084, 3085, 2749, 3084,
-    3085, 3086, 2848, 3084, 3085, 3086, 3087, 2936, 238,  238,  238,  238,
-    238,  78,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,
-    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2592, 5968,
-    2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010,
-    226,  2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993,
-    6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,  2529, 3150,
-    2650, 3150, 3151, 2760, 3150, 3151, 3152, 2859, 3150, 3151, 3152, 3153,
-    2947, 3150, 3151, 3152, 3153, 3154, 3024, 250,  250,  250,  250,  250,
-    250,  90,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,
-    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2592, 5968,
-    2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010,
-    226,  2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993,
-    6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,  2594, 5970,
-    2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103,
-    3012, 6000, 6045, 6081, 6109, 1604, 3089, 3150, 3151, 3152, 3153, 3154,
-    3155, 250,  2540, 3205, 2661, 3205, 3206, 2771, 3205, 3206, 3207, 2870,
-    3205, 3206, 3207, 3208, 2958, 3205, 3206, 3207, 3208, 3209, 3035, 3205,
-    3206, 3207, 3208, 3209, 3210, 3101, 262,  262,  262,  262,  262,  262,
-    262,  102,  174,  2545, 2666, 186,  2546, 3249, 2667, 2776, 2777, 198,
-    2547, 3249, 2668, 3249, 3250, 2778, 2875, 2876, 2877, 210,  2548, 3249,
-    2669, 3249, 3250, 2779, 3249, 3250, 3251, 2878, 2963, 2964, 2965, 2966,
-    222,  2549, 3249, 2670, 3249, 3250, 2780, 3249, 3250, 3251, 2879, 3249,
-    3250, 3251, 3252, 2967, 3040, 3041, 3042, 3043, 3044, 234,  2550, 3249,
-    2671, 3249, 3250, 2781, 3249, 3250, 3251, 2880, 3249, 3250, 3251, 3252,
-    2968, 3249, 3250, 3251, 3252, 3253, 3045, 3106, 3107, 3108, 3109, 3110,
-    3111, 246,  2551, 3249, 2672, 3249, 3250, 2782, 3249, 3250, 3251, 2881,
-    3249, 3250, 3251, 3252, 2969, 3249, 3250, 3251, 3252, 3253, 3046, 3249,
-    3250, 3251, 3252, 3253, 3254, 3112, 3161, 3162, 3163, 3164, 3165, 3166,
-    3167, 258,  263,  274,  264,  274,  274,  265,  274,  274,  274,  266,
-    274,  274,  274,  274,  267,  274,  274,  274,  274,  274,  268,  274,
-    274,  274,  274,  274,  274,  269,  274,  274,  274,  274,  274,  274,
-    274,  270,  107,  108,  109,  110,  111,  112,  113,  114,  19,   178,
-    2475, 190,  31,   178,  2589, 2710, 190,  2486, 2820, 2607, 202,  202,
-    43,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,  2497,
-    2919, 2618, 2919, 2920, 2728, 214,  214,  214,  55,   178,  2589, 2710,
-    190,  2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021,
-    2822, 2919, 2920, 2921, 214,  2508, 3007, 2629, 3007, 3008, 2739, 3007,
-    3008, 3009, 2838, 226,  226,  226,  226,  67,   178,  2589, 2710, 190,
-    2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021, 2822,
-    2919, 2920, 2921, 214,  2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030,
-    6066, 2922, 3007, 3008, 3009, 3010, 226,  2519, 3084, 2640, 3084, 3085,
-    2750, 3084, 3085, 3086, 2849, 3084, 3085, 3086, 3087, 2937, 238,  238,
-    238,  238,  238,  79,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820,
-    2821, 202,  2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,
-    2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008,
-    3009, 3010, 226,  2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067,
-    2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,
-    2530, 3150, 2651, 3150, 3151, 2761, 3150, 3151, 3152, 2860, 3150, 3151,
-    3152, 3153, 2948, 3150, 3151, 3152, 3153, 3154, 3025, 250,  250,  250,
-    250,  250,  250,  91,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820,
-    2821, 202,  2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,
-    2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008,
-    3009, 3010, 226,  2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067,
-    2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,
-    2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039,
-    6075, 6103, 3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152,
-    3153, 3154, 3155, 250,  2541, 3205, 2662, 3205, 3206, 2772, 3205, 3206,
-    3207, 2871, 3205, 3206, 3207, 3208, 2959, 3205, 3206, 3207, 3208, 3209,
-    3036, 3205, 3206, 3207, 3208, 3209, 3210, 3102, 262,  262,  262,  262,
-    262,  262,  262,  103,  178,  2589, 2710, 190,  2590, 5966, 2711, 2820,
-    2821, 202,  2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,
-    2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008,
-    3009, 3010, 226,  2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067,
-    2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,
-    2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039,
-    6075, 6103, 3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152,
-    3153, 3154, 3155, 250,  2595, 5971, 2716, 5980, 6025, 2826, 5988, 6033,
-    6069, 2925, 5995, 6040, 6076, 6104, 3013, 6001, 6046, 6082, 6110, 6131,
-    3090, 6006, 6051, 6087, 6115, 6136, 1605, 3156, 3205, 3206, 3207, 3208,
-    3209, 3210, 3211, 262,  2552, 3249, 2673, 3249, 3250, 2783, 3249, 3250,
-    3251, 2882, 3249, 3250, 3251, 3252, 2970, 3249, 3250, 3251, 3252, 3253,
-    3047, 3249, 3250, 3251, 3252, 3253, 3254, 3113, 3249, 3250, 3251, 3252,
-    3253, 3254, 3255, 3168, 274,  274,  274,  274,  274,  274,  274,  274,
-    115,  175,  2556, 2677, 187,  2557, 3282, 2678, 2787, 2788, 199,  2558,
-    3282, 2679, 3282, 3283, 2789, 2886, 2887, 2888, 211,  2559, 3282, 2680,
-    3282, 3283, 2790, 3282, 3283, 3284, 2889, 2974, 2975, 2976, 2977, 223,
-    2560, 3282, 2681, 3282, 3283, 2791, 3282, 3283, 3284, 2890, 3282, 3283,
-    3284, 3285, 2978, 3051, 3052, 3053, 3054, 3055, 235,  2561, 3282, 2682,
-    3282, 3283, 2792, 3282, 3283, 3284, 2891, 3282, 3283, 3284, 3285, 2979,
-    3282, 3283, 3284, 3285, 3286, 3056, 3117, 3118, 3119, 3120, 3121, 3122,
-    247,  2562, 3282, 2683, 3282, 3283, 2793, 3282, 3283, 3284, 2892, 3282,
-    3283, 3284, 3285, 2980, 3282, 3283, 3284, 3285, 3286, 3057, 3282, 3283,
-    3284, 3285, 3286, 3287, 3123, 3172, 3173, 3174, 3175, 3176, 3177, 3178,
-    259,  2563, 3282, 2684, 3282, 3283, 2794, 3282, 3283, 3284, 2893, 3282,
-    3283, 3284, 3285, 2981, 3282, 3283, 3284, 3285, 3286, 3058, 3282, 3283,
-    3284, 3285, 3286, 3287, 3124, 3282, 3283, 3284, 3285, 3286, 3287, 3288,
-    3179, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 271,  275,  286,
-    276,  286,  286,  277,  286,  286,  286,  278,  286,  286,  286,  286,
-    279,  286,  286,  286,  286,  286,  280,  286,  286,  286,  286,  286,
-    286,  281,  286,  286,  286,  286,  286,  286,  286,  282,  286,  286,
-    286,  286,  286,  286,  286,  286,  283,  119,  120,  121,  122,  123,
-    124,  125,  126,  127,  20,   178,  2476, 190,  32,   178,  2589, 2710,
-    190,  2487, 2820, 2608, 202,  202,  44,   178,  2589, 2710, 190,  2590,
-    5966, 2711, 2820, 2821, 202,  2498, 2919, 2619, 2919, 2920, 2729, 214,
-    214,  214,  56,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821,
-    202,  2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2509,
-    3007, 2630, 3007, 3008, 2740, 3007, 3008, 3009, 2839, 226,  226,  226,
-    226,  68,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,
-    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2592, 5968,
-    2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010,
-    226,  2520, 3084, 2641, 3084, 3085, 2751, 3084, 3085, 3086, 2850, 3084,
-    3085, 3086, 3087, 2938, 238,  238,  238,  238,  238,  80,   178,  2589,
-    2710, 190,  2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976,
-    6021, 2822, 2919, 2920, 2921, 214,  2592, 5968, 2713, 5977, 6022, 2823,
-    5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226,  2593, 5969, 2714,
-    5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011,
-    3084, 3085, 3086, 3087, 3088, 238,  2531, 3150, 2652, 3150, 3151, 2762,
-    3150, 3151, 3152, 2861, 3150, 3151, 3152, 3153, 2949, 3150, 3151, 3152,
-    3153, 3154, 3026, 250,  250,  250,  250,  250,  250,  92,   178,  2589,
-    2710, 190,  2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976,
-    6021, 2822, 2919, 2920, 2921, 214,  2592, 5968, 2713, 5977, 6022, 2823,
-    5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226,  2593, 5969, 2714,
-    5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011,
-    3084, 3085, 3086, 3087, 3088, 238,  2594, 5970, 2715, 5979, 6024, 2825,
-    5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045, 6081,
-    6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250,  2542, 3205,
-    2663, 3205, 3206, 2773, 3205, 3206, 3207, 2872, 3205, 3206, 3207, 3208,
-    2960, 3205, 3206, 3207, 3208, 3209, 3037, 3205, 3206, 3207, 3208, 3209,
-    3210, 3103, 262,  262,  262,  262,  262,  262,  262,  104,  178,  2589,
-    2710, 190,  2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976,
-    6021, 2822, 2919, 2920, 2921, 214,  2592, 5968, 2713, 5977, 6022, 2823,
-    5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226,  2593, 5969, 2714,
-    5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011,
-    3084, 3085, 3086, 3087, 3088, 238,  2594, 5970, 2715, 5979, 6024, 2825,
-    5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045, 6081,
-    6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250,  2595, 5971,
-    2716, 5980, 6025, 2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076, 6104,
-    3013, 6001, 6046, 6082, 6110, 6131, 3090, 6006, 6051, 6087, 6115, 6136,
-    6151, 3156, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 262,  2553, 3249,
-    2674, 3249, 3250, 2784, 3249, 3250, 3251, 2883, 3249, 3250, 3251, 3252,
-    2971, 3249, 3250, 3251, 3252, 3253, 3048, 3249, 3250, 3251, 3252, 3253,
-    3254, 3114, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3169, 274,  274,
-    274,  274,  274,  274,  274,  274,  116,  178,  2589, 2710, 190,  2590,
-    5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021, 2822, 2919,
-    2920, 2921, 214,  2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066,
-    2922, 3007, 3008, 3009, 3010, 226,  2593, 5969, 2714, 5978, 6023, 2824,
-    5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086,
-    3087, 3088, 238,  2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068,
-    2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045, 6081, 6109, 6130, 3089,
-    3150, 3151, 3152, 3153, 3154, 3155, 250,  2595, 5971, 2716, 5980, 6025,
-    2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076, 6104, 3013, 6001, 6046,
-    6082, 6110, 6131, 3090, 6006, 6051, 6087, 6115, 6136, 6151, 3156, 3205,
-    3206, 3207, 3208, 3209, 3210, 3211, 262,  2596, 5972, 2717, 5981, 6026,
-    2827, 5989, 6034, 6070, 2926, 5996, 6041, 6077, 6105, 3014, 6002, 6047,
-    6083, 6111, 6132, 3091, 6007, 6052, 6088, 6116, 6137, 6152, 3157, 6011,
-    6056, 6092, 6120, 6141, 6156, 1606, 3212, 3249, 3250, 3251, 3252, 3253,
-    3254, 3255, 3256, 274,  2564, 3282, 2685, 3282, 3283, 2795, 3282, 3283,
-    3284, 2894, 3282, 3283, 3284, 3285, 2982, 3282, 3283, 3284, 3285, 3286,
-    3059, 3282, 3283, 3284, 3285, 3286, 3287, 3125, 3282, 3283, 3284, 3285,
-    3286, 3287, 3288, 3180, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289,
-    3224, 286,  286,  286,  286,  286,  286,  286,  286,  286,  128,  176,
-    2567, 2688, 188,  2568, 3304, 2689, 2798, 2799, 200,  2569, 3304, 2690,
-    3304, 3305, 2800, 2897, 2898, 2899, 212,  2570, 3304, 2691, 3304, 3305,
-    2801, 3304, 3305, 3306, 2900, 2985, 2986, 2987, 2988, 224,  2571, 3304,
-    2692, 3304, 3305, 2802, 3304, 3305, 3306, 2901, 3304, 3305, 3306, 3307,
-    2989, 3062, 3063, 3064, 3065, 3066, 236,  2572, 3304, 2693, 3304, 3305,
-    2803, 3304, 3305, 3306, 2902, 3304, 3305, 3306, 3307, 2990, 3304, 3305,
-    3306, 3307, 3308, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248,  2573,
-    3304, 2694, 3304, 3305, 2804, 3304, 3305, 3306, 2903, 3304, 3305, 3306,
-    3307, 2991, 3304, 3305, 3306, 3307, 3308, 3068, 3304, 3305, 3306, 3307,
-    3308, 3309, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260,  2574,
-    3304, 2695, 3304, 3305, 2805, 3304, 3305, 3306, 2904, 3304, 3305, 3306,
-    3307, 2992, 3304, 3305, 3306, 3307, 3308, 3069, 3304, 3305, 3306, 3307,
-    3308, 3309, 3135, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3190, 3227,
-    3228, 3229, 3230, 3231, 3232, 3233, 3234, 272,  2575, 3304, 2696, 3304,
-    3305, 2806, 3304, 3305, 3306, 2905, 3304, 3305, 3306, 3307, 2993, 3304,
-    3305, 3306, 3307, 3308, 3070, 3304, 3305, 3306, 3307, 3308, 3309, 3136,
-    3304, 3305, 3306, 3307, 3308, 3309, 3310, 3191, 3304, 3305, 3306, 3307,
-    3308, 3309, 3310, 3311, 3235, 3260, 3261, 3262, 3263, 3264, 3265, 3266,
-    3267, 3268, 284,  287,  298,  288,  298,  298,  289,  298,  298,  298,
-    290,  298,  298,  298,  298,  291,  298,  298,  298,  298,  298,  292,
-    298,  298,  298,  298,  298,  298,  293,  298,  298,  298,  298,  298,
-    298,  298,  294,  298,  298,  298,  298,  298,  298,  298,  298,  295,
-    298,  298,  298,  298,  298,  298,  298,  298,  298,  296,  131,  132,
-    133,  134,  135,  136,  137,  138,  139,  140,  21,   178,  2477, 190,
-    33,   178,  2589, 2710, 190,  2488, 2820, 2609, 202,  202,  45,   178,
-    2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,  2499, 2919, 2620,
-    2919, 2920, 2730, 214,  214,  214,  57,   178,  2589, 2710, 190,  2590,
-    5966, 2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021, 2822, 2919,
-    2920, 2921, 214,  2510, 3007, 2631, 3007, 3008, 2741, 3007, 3008, 3009,
-    2840, 226,  226,  226,  226,  69,   178,  2589, 2710, 190,  2590, 5966,
-    2711, 2820, 2821, 202,  2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920,
-    2921, 214,  2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922,
-    3007, 3008, 3009, 3010, 226,  2521, 3084, 2642, 3084, 3085, 2752, 3084,
-    3085, 3086, 2851, 3084, 3085, 3086, 3087, 2939, 238,  238,  238,  238,
-    238,  81,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,
-    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2592, 5968,
-    2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010,
-    226,  2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993,
-    6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,  2532, 3150,
-    2653, 3150, 3151, 2763, 3150, 3151, 3152, 2862, 3150, 3151, 3152, 3153,
-    2950, 3150, 3151, 3152, 3153, 3154, 3027, 250,  250,  250,  250,  250,
-    250,  93,   178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,
-    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2592, 5968,
-    2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010,
-    226,  2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993,
-    6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,  2594, 5970,
-    2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103,
-    3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154,
-    3155, 250,  2543, 3205, 2664, 3205, 3206, 2774, 3205, 3206, 3207, 2873,
-    3205, 3206, 3207, 3208, 2961, 3205, 3206, 3207, 3208, 3209, 3038, 3205,
-    3206, 3207, 3208, 3209, 3210, 3104, 262,  262,  262,  262,  262,  262,
-    262,  105,  178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,
-    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2592, 5968,
-    2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010,
-    226,  2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993,
-    6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,  2594, 5970,
-    2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103,
-    3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154,
-    3155, 250,  2595, 5971, 2716, 5980, 6025, 2826, 5988, 6033, 6069, 2925,
-    5995, 6040, 6076, 6104, 3013, 6001, 6046, 6082, 6110, 6131, 3090, 6006,
-    6051, 6087, 6115, 6136, 6151, 3156, 3205, 3206, 3207, 3208, 3209, 3210,
-    3211, 262,  2554, 3249, 2675, 3249, 3250, 2785, 3249, 3250, 3251, 2884,
-    3249, 3250, 3251, 3252, 2972, 3249, 3250, 3251, 3252, 3253, 3049, 3249,
-    3250, 3251, 3252, 3253, 3254, 3115, 3249, 3250, 3251, 3252, 3253, 3254,
-    3255, 3170, 274,  274,  274,  274,  274,  274,  274,  274,  117,  178,
-    2589, 2710, 190,  2590, 5966, 2711, 2820, 2821, 202,  2591, 5967, 2712,
-    5976, 6021, 2822, 2919, 2920, 2921, 214,  2592, 5968, 2713, 5977, 6022,
-    2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226,  2593, 5969,
-    2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102,
-    3011, 3084, 3085, 3086, 3087, 3088, 238,  2594, 5970, 2715, 5979, 6024,
-    2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045,
-    6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250,  2595,
-    5971, 2716, 5980, 6025, 2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076,
-    6104, 3013, 6001, 6046, 6082, 6110, 6131, 3090, 6006, 6051, 6087, 6115,
-    6136, 6151, 3156, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 262,  2596,
-    5972, 2717, 5981, 6026, 2827, 5989, 6034, 6070, 2926, 5996, 6041, 6077,
-    6105, 3014, 6002, 6047, 6083, 6111, 6132, 3091, 6007, 6052, 6088, 6116,
-    6137, 6152, 3157, 6011, 6056, 6092, 6120, 6141, 6156, 6166, 3212, 3249,
-    3250, 3251, 3252, 3253, 3254, 3255, 3256, 274,  2565, 3282, 2686, 3282,
-    3283, 2796, 3282, 3283, 3284, 2895, 3282, 3283, 3284, 3285, 2983, 3282,
-    3283, 3284, 3285, 3286, 3060, 3282, 3283, 3284, 3285, 3286, 3287, 3126,
-    3282, 3283, 3284, 3285, 3286, 3287, 3288, 3181, 3282, 3283, 3284, 3285,
-    3286, 3287, 3288, 3289, 3225, 286,  286,  286,  286,  286,  286,  286,
-    286,  286,  129,  178,  2589, 2710, 190,  2590, 5966, 2711, 2820, 2821,
-    202,  2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,  2592,
-    5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009,
-    3010, 226,  2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923,
-    5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,  2594,
-    5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075,
-    6103, 3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153,
-    3154, 3155, 250,  2595, 5971, 2716, 5980, 6025, 2826, 5988, 6033, 6069,
-    2925, 5995, 6040, 6076, 6104, 3013, 6001, 6046, 6082, 6110, 6131, 3090,
-    6006, 6051, 6087, 6115, 6136, 6151, 3156, 3205, 3206, 3207, 3208, 3209,
-    3210, 3211, 262,  2596, 5972, 2717, 5981, 6026, 2827, 5989, 6034, 6070,
-    2926, 5996, 6041, 6077, 6105, 3014, 6002, 6047, 6083, 6111, 6132, 3091,
-    6007, 6052, 6088, 6116, 6137, 6152, 3157, 6011, 6056, 6092, 6120, 6141,
-    6156, 6166, 3212, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 274,
-    1609, 1609, 2718, 1609, 6027, 2828, 1609, 6035, 6071, 2927, 1609, 6042,
-    6078, 6106, 3015, 1609, 6048, 6084, 6112, 6133, 3092, 1609, 6053, 6089,
-    6117, 6138, 6153, 3158, 1609, 6057, 6093, 6121, 6142, 6157, 6167, 3213,
-    1608, 1608, 1608, 1608, 1608, 1608, 1608, 1607, 1608, 1609, 3283, 3284,
-    3285, 3286, 3287, 3288, 3289, 1608, 286,  2576, 3304, 2697, 3304, 3305,
-    2807, 3304, 3305, 3306, 2906, 3304, 3305, 3306, 3307, 2994, 3304, 3305,
-    3306, 3307, 3308, 3071, 3304, 3305, 3306, 3307, 3308, 3309, 3137, 3304,
-    3305, 3306, 3307, 3308, 3309, 3310, 3192, 3304, 3305, 3306, 3307, 3308,
-    3309, 3310, 3311, 3236, 1609, 3305, 3306, 3307, 3308, 3309, 3310, 3311,
-    1608, 3269, 298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
-    141,  177,  2578, 2699, 189,  2579, 3315, 2700, 2809, 2810, 201,  2580,
-    3315, 2701, 3315, 3316, 2811, 2908, 2909, 2910, 213,  2581, 3315, 2702,
-    3315, 3316, 2812, 3315, 3316, 3317, 2911, 2996, 2997, 2998, 2999, 225,
-    2582, 3315, 2703, 3315, 3316, 2813, 3315, 3316, 3317, 2912, 3315, 3316,
-    3317, 3318, 3000, 3073, 3074, 3075, 3076, 3077, 237,  2583, 3315, 2704,
-    3315, 3316, 2814, 3315, 3316, 3317, 2913, 3315, 3316, 3317, 3318, 3001,
-    3315, 3316, 3317, 3318, 3319, 3078, 3139, 3140, 3141, 3142, 3143, 3144,
-    249,  2584, 3315, 2705, 3315, 3316, 2815, 3315, 3316, 3317, 2914, 3315,
-    3316, 3317, 3318, 3002, 3315, 3316, 3317, 3318, 3319, 3079, 3315, 3316,
-    3317, 3318, 3319, 3320, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200,
-    261,  2585, 3315, 2706, 3315, 3316, 2816, 3315, 3316, 3317, 2915, 3315,
-    3316, 3317, 3318, 3003, 3315, 3316, 3317, 3318, 3319, 3080, 3315, 3316,
-    3317, 3318, 3319, 3320, 3146, 3315, 3316, 3317, 3318, 3319, 3320, 3321,
-    3201, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 273,  2586, 3315,
-    2707, 3315, 3316, 2817, 3315, 3316, 3317, 2916, 3315, 3316, 3317, 3318,
-    3004, 3315, 3316, 3317, 3318, 3319, 3081, 3315, 3316, 3317, 3318, 3319,
-    3320, 3147, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3202, 3315, 3316,
-    3317, 3318, 3319, 3320, 3321, 3322, 3246, 3271, 3272, 3273, 3274, 3275,
-    3276, 3277, 3278, 3279, 285,  2587, 3315, 2708, 3315, 3316, 2818, 3315,
-    3316, 3317, 2917, 3315, 3316, 3317, 3318, 3005, 3315, 3316, 3317, 3318,
-    3319, 3082, 3315, 3316, 3317, 3318, 3319, 3320, 3148, 3315, 3316, 3317,
-    3318, 3319, 3320, 3321, 3203, 3315, 3316, 3317, 3318, 3319, 3320, 3321,
-    3322, 3247, 1609, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 1608, 3280,
-    3293, 3294, 3295, 3296, 3297, 3298, 3299, 3300, 3301, 3302, 297,  299,
-    310,  300,  310,  310,  301,  310,  310,  310,  302,  310,  310,  310,
-    310,  303,  310,  310,  310,  310,  310,  304,  310,  310,  310,  310,
-    310,  310,  305,  310,  310,  310,  310,  310,  310,  310,  306,  310,
-    310,  310,  310,  310,  310,  310,  310,  307,  310,  310,  310,  310,
-    310,  310,  310,  310,  310,  308,  310,  310,  310,  310,  310,  310,
-    310,  310,  310,  310,  309,  143,  144,  145,  146,  147,  148,  149,
-    150,  151,  152,  153,  22,   178,  311,  190,  34,   178,  311,  312,
-    190,  311,  313,  312,  202,  202,  46,   178,  311,  312,  190,  311,
-    2402, 312,  313,  313,  202,  311,  314,  312,  314,  314,  313,  214,
-    214,  214,  58,   178,  311,  312,  190,  311,  2402, 312,  313,  313,
-    202,  311,  2402, 312,  2403, 2413, 313,  314,  314,  314,  214,  311,
-    315,  312,  315,  315,  313,  315,  315,  315,  314,  226,  226,  226,
-    226,  70,   178,  311,  312,  190,  311,  2402, 312,  313,  313,  202,
-    311,  2402, 312,  2403, 2413, 313,  314,  314,  314,  214,  311,  2402,
-    312,  2403, 2413, 313,  2404, 2414, 2423, 314,  315,  315,  315,  315,
-    226,  311,  316,  312,  316,  316,  313,  316,  316,  316,  314,  316,
-    316,  316,  316,  315,  238,  238,  238,  238,  238,  82,   178,  311,
-    312,  190,  311,  2402, 312,  313,  313,  202,  311,  2402, 312,  2403,
-    2413, 313,  314,  314,  314,  214,  311,  2402, 312,  2403, 2413, 313,
-    2404, 2414, 2423, 314,  315,  315,  315,  315,  226,  311,  2402, 312,
-    2403, 2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,
-    316,  316,  316,  316,  316,  238,  311,  317,  312,  317,  317,  313,
-    317,  317,  317,  314,  317,  317,  317,  317,  315,  317,  317,  317,
-    317,  317,  316,  250,  250,  250,  250,  250,  250,  94,   178,  311,
-    312,  190,  311,  2402, 312,  313,  313,  202,  311,  2402, 312,  2403,
-    2413, 313,  314,  314,  314,  214,  311,  2402, 312,  2403, 2413, 313,
-    2404, 2414, 2423, 314,  315,  315,  315,  315,  226,  311,  2402, 312,
-    2403, 2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,
-    316,  316,  316,  316,  316,  238,  311,  2402, 312,  2403, 2413, 313,
-    2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  2406, 2416, 2425,
-    2433, 2440, 316,  317,  317,  317,  317,  317,  317,  250,  311,  318,
-    312,  318,  318,  313,  318,  318,  318,  314,  318,  318,  318,  318,
-    315,  318,  318,  318,  318,  318,  316,  318,  318,  318,  318,  318,
-    318,  317,  262,  262,  262,  262,  262,  262,  262,  106,  178,  311,
-    312,  190,  311,  2402, 312,  313,  313,  202,  311,  2402, 312,  2403,
-    2413, 313,  314,  314,  314,  214,  311,  2402, 312,  2403, 2413, 313,
-    2404, 2414, 2423, 314,  315,  315,  315,  315,  226,  311,  2402, 312,
-    2403, 2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,
-    316,  316,  316,  316,  316,  238,  311,  2402, 312,  2403, 2413, 313,
-    2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  2406, 2416, 2425,
-    2433, 2440, 316,  317,  317,  317,  317,  317,  317,  250,  311,  2402,
-    312,  2403, 2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432,
-    315,  2406, 2416, 2425, 2433, 2440, 316,  2407, 2417, 2426, 2434, 2441,
-    2447, 317,  318,  318,  318,  318,  318,  318,  318,  262,  311,  319,
-    312,  319,  319,  313,  319,  319,  319,  314,  319,  319,  319,  319,
-    315,  319,  319,  319,  319,  319,  316,  319,  319,  319,  319,  319,
-    319,  317,  319,  319,  319,  319,  319,  319,  319,  318,  274,  274,
-    274,  274,  274,  274,  274,  274,  118,  178,  311,  312,  190,  311,
-    2402, 312,  313,  313,  202,  311,  2402, 312,  2403, 2413, 313,  314,
-    314,  314,  214,  311,  2402, 312,  2403, 2413, 313,  2404, 2414, 2423,
-    314,  315,  315,  315,  315,  226,  311,  2402, 312,  2403, 2413, 313,
-    2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  316,  316,  316,
-    316,  316,  238,  311,  2402, 312,  2403, 2413, 313,  2404, 2414, 2423,
-    314,  2405, 2415, 2424, 2432, 315,  2406, 2416, 2425, 2433, 2440, 316,
-    317,  317,  317,  317,  317,  317,  250,  311,  2402, 312,  2403, 2413,
-    313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  2406, 2416,
-    2425, 2433, 2440, 316,  2407, 2417, 2426, 2434, 2441, 2447, 317,  318,
-    318,  318,  318,  318,  318,  318,  262,  311,  2402, 312,  2403, 2413,
-    313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  2406, 2416,
-    2425, 2433, 2440, 316,  2407, 2417, 2426, 2434, 2441, 2447, 317,  2408,
-    2418, 2427, 2435, 2442, 2448, 2453, 318,  319,  319,  319,  319,  319,
-    319,  319,  319,  274,  311,  320,  312,  320,  320,  313,  320,  320,
-    320,  314,  320,  320,  320,  320,  315,  320,  320,  320,  320,  320,
-    316,  320,  320,  320,  320,  320,  320,  317,  320,  320,  320,  320,
-    320,  320,  320,  318,  320,  320,  320,  320,  320,  320,  320,  320,
-    319,  286,  286,  286,  286,  286,  286,  286,  286,  286,  130,  178,
-    311,  312,  190,  311,  2402, 312,  313,  313,  202,  311,  2402, 312,
-    2403, 2413, 313,  314,  314,  314,  214,  311,  2402, 312,  2403, 2413,
-    313,  2404, 2414, 2423, 314,  315,  315,  315,  315,  226,  311,  2402,
-    312,  2403, 2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432,
-    315,  316,  316,  316,  316,  316,  238,  311,  2402, 312,  2403, 2413,
-    313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  2406, 2416,
-    2425, 2433, 2440, 316,  317,  317,  317,  317,  317,  317,  250,  311,
-    2402, 312,  2403, 2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424,
-    2432, 315,  2406, 2416, 2425, 2433, 2440, 316,  2407, 2417, 2426, 2434,
-    2441, 2447, 317,  318,  318,  318,  318,  318,  318,  318,  262,  311,
-    2402, 312,  2403, 2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424,
-    2432, 315,  2406, 2416, 2425, 2433, 2440, 316,  2407, 2417, 2426, 2434,
-    2441, 2447, 317,  2408, 2418, 2427, 2435, 2442, 2448, 2453, 318,  319,
-    319,  319,  319,  319,  319,  319,  319,  274,  311,  2402, 312,  2403,
-    2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  2406,
-    2416, 2425, 2433, 2440, 316,  2407, 2417, 2426, 2434, 2441, 2447, 317,
-    2408, 2418, 2427, 2435, 2442, 2448, 2453, 318,  2409, 2419, 2428, 2436,
-    2443, 2449, 2454, 2458, 319,  320,  320,  320,  320,  320,  320,  320,
-    320,  320,  286,  311,  321,  312,  321,  321,  313,  321,  321,  321,
-    314,  321,  321,  321,  321,  315,  321,  321,  321,  321,  321,  316,
-    321,  321,  321,  321,  321,  321,  317,  321,  321,  321,  321,  321,
-    321,  321,  318,  321,  321,  321,  321,  321,  321,  321,  321,  319,
-    321,  321,  321,  321,  321,  321,  321,  321,  321,  320,  298,  298,
-    298,  298,  298,  298,  298,  298,  298,  298,  142,  178,  311,  312,
-    190,  311,  2402, 312,  313,  313,  202,  311,  2402, 312,  2403, 2413,
-    313,  314,  314,  314,  214,  311,  2402, 312,  2403, 2413, 313,  2404,
-    2414, 2423, 314,  315,  315,  315,  315,  226,  311,  2402, 312,  2403,
-    2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  316,
-    316,  316,  316,  316,  238,  311,  2402, 312,  2403, 2413, 313,  2404,
-    2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  2406, 2416, 2425, 2433,
-    2440, 316,  317,  317,  317,  317,  317,  317,  250,  311,  2402, 312,
-    2403, 2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,
-    2406, 2416, 2425, 2433, 2440, 316,  2407, 2417, 2426, 2434, 2441, 2447,
-    317,  318,  318,  318,  318,  318,  318,  318,  262,  311,  2402, 312,
-    2403, 2413, 313,  2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,
-    2406, 2416, 2425, 2433, 2440, 316,  2407, 2417, 2426, 2434, 2441, 2447,
-    317,  2408, 2418, 2427, 2435, 2442, 2448, 2453, 318,  319,  319,  319,
-    319,  319,  319,  319,  319,  274,  311,  2402, 312,  2403, 2413, 313,
-    2404, 2414, 2423, 314,  2405, 2415, 2424, 2432, 315,  2406, 2416, 2425,
-    2433, 2440, 316,  2407, 2417, 2426, 2434, 2441, 2447, 317,  2408, 2418,
-    2427, 2435, 2442, 2448, 2453, 318,  2409, 2419, 2428, 2436, 2443, 2449,
-    2454, 2458, 319,  320,  320,  320,  320,  320,  320,  320,  320,  320,
-    286,  311,  2402, 312,  2403, 2413, 313,  2404, 2414, 2423, 314,  2405,
-    2415, 2424, 2432, 315,  2406, 2416, 2425, 2433, 2440, 316,  2407, 2417,
-    2426, 2434, 2441, 2447, 317,  2408, 2418, 2427, 2435, 2442, 2448, 2453,
-    318,  2409, 2419, 2428, 2436, 2443, 2449, 2454, 2458, 319,  1609, 2420,
-    2429, 2437, 2444, 2450, 2455, 2459, 1608, 320,  321,  321,  321,  321,
-    321,  321,  321,  321,  321,  321,  298,  311,  322,  312,  322,  322,
-    313,  322,  322,  322,  314,  322,  322,  322,  322,  315,  322,  322,
-    322,  322,  322,  316,  322,  322,  322,  322,  322,  322,  317,  322,
-    322,  322,  322,  322,  322,  322,  318,  322,  322,  322,  322,  322,
-    322,  322,  322,  319,  322,  322,  322,  322,  322,  322,  322,  322,
-    322,  320,  322,  322,  322,  322,  322,  322,  322,  322,  322,  322,
-    321,  310,  310,  310,  310,  310,  310,  310,  310,  310,  310,  310,
-    154,  155,  155,  155,  156,  155,  155,  156,  155,  156,  157,  155,
-    155,  156,  155,  156,  157,  155,  156,  157,  158,  155,  155,  156,
-    155,  156,  157,  155,  156,  157,  158,  155,  156,  157,  158,  159,
-    155,  155,  156,  155,  156,  157,  155,  156,  157,  158,  155,  156,
-    157,  158,  159,  155,  156,  157,  158,  159,  160,  155,  155,  156,
-    155,  156,  157,  155,  156,  157,  158,  155,  156,  157,  158,  159,
-    155,  156,  157,  158,  159,  160,  155,  156,  157,  158,  159,  160,
-    161,  155,  155,  156,  155,  156,  157,  155,  156,  157,  158,  155,
-    156,  157,  158,  159,  155,  156,  157,  158,  159,  160,  155,  156,
-    157,  158,  159,  160,  161,  155,  156,  157,  158,  159,  160,  161,
-    162,  155,  155,  156,  155,  156,  157,  155,  156,  157,  158,  155,
-    156,  157,  158,  159,  155,  156,  157,  158,  159,  160,  155,  156,
-    157,  158,  159,  160,  161,  155,  156,  157,  158,  159,  160,  161,
-    162,  155,  156,  157,  158,  159,  160,  161,  162,  163,  155,  155,
-    156,  155,  156,  157,  155,  156,  157,  158,  155,  156,  157,  158,
-    159,  155,  156,  157,  158,  159,  160,  155,  156,  157,  158,  159,
-    160,  161,  155,  156,  157,  158,  159,  160,  161,  162,  155,  156,
-    157,  158,  159,  160,  161,  162,  163,  155,  156,  157,  158,  159,
-    160,  161,  162,  163,  164,  155,  155,  156,  155,  156,  157,  155,
-    156,  157,  158,  155,  156,  157,  158,  159,  155,  156,  157,  158,
-    159,  160,  155,  156,  157,  158,  159,  160,  161,  155,  156,  157,
-    158,  159,  160,  161,  162,  155,  156,  157,  158,  159,  160,  161,
-    162,  163,  155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
-    155,  156,  157,  158,  159,  160,  161,  162,  163,  164,  165,  155,
-    155,  156,  155,  156,  157,  155,  156,  157,  158,  155,  156,  157,
-    158,  159,  155,  156,  157,  158,  159,  160,  155,  156,  157,  158,
-    159,  160,  161,  155,  156,  157,  158,  159,  160,  161,  162,  155,
-    156,  157,  158,  159,  160,  161,  162,  163,  155,  156,  157,  158,
-    159,  160,  161,  162,  163,  164,  155,  156,  157,  158,  159,  160,
-    161,  162,  163,  164,  165,  155,  156,  157,  158,  159,  160,  161,
-    162,  163,  164,  165,  166,
+#include <phevaluator/tables/noflush7.inc>
 };
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+/*
+ * Definitions behind phevaluator/batch.h. An evaluator file defines its
+ * batch function and engine with PHEVAL_DEFINE_BATCH, giving the engine
+ * name, the cards per hand and an expression evaluating the hand `c`, a
+ * const uint8_t* to its first card.
+ */
+
+#include <phevaluator/batch.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 1 if the n ids at c are all below 52 and distinct
+static inline int pheval_batch_valid(const uint8_t* c, int n) {
+  uint64_t seen = 0;
+  int ok = 1;
+  for (int i = 0; i < n; i++) {
+    const uint64_t bit = (uint64_t)1 << (c[i] & 63);
+    ok &= (c[i] < 52) & ((seen & bit) == 0);
+    seen |= bit;
+  }
+  return ok;
+}
+
+#define PHEVAL_DEFINE_BATCH(fn, engine, label, ncards, expr)             \
+  size_t fn(const uint8_t* cards, size_t n, size_t stride, int16_t* out) { \
+    size_t invalid = 0;                                                  \
+    if (stride == 0) stride = (ncards);                                  \
+    for (size_t i = 0; i < n; i++, cards += stride) {                    \
+      const uint8_t* c = cards;                                          \
+      if (!pheval_batch_valid(c, (ncards))) {                            \
+        out[i] = PHEVAL_INVALID_HAND;                                    \
+        invalid++;                                                       \
+        continue;                                                        \
+      }                                                                  \
+      out[i] = (int16_t)(expr);                                          \
+    }                                                                    \
+    return invalid;                                                      \
+  }                                                                      \
+  const pheval_engine engine = {label, (ncards), fn}
+
+#endif  // BATCH_H
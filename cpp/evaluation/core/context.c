@@ -0,0 +1,71 @@
+// Context handles for batch evaluation, see phevaluator/batch.h
+
+#include <phevaluator/batch.h>
+#include <phevaluator/numa.h>
+
+#include <stdlib.h>
+
+struct pheval_context {
+  const pheval_engine* engine;
+  int numa_replica;  // -1 for the compiled-in tables
+  uint64_t hands;
+  uint64_t invalid_hands;
+};
+
+pheval_context* pheval_context_create(const pheval_engine* engine) {
+  if (engine == NULL) return NULL;
+  pheval_context* context = (pheval_context*)malloc(sizeof(pheval_context));
+  if (context == NULL) return NULL;
+  context->engine = engine;
+  context->numa_replica = -1;
+  context->hands = 0;
+  context->invalid_hands = 0;
+  return context;
+}
+
+void pheval_context_destroy(pheval_context* context) { free(context); }
+
+int pheval_context_cards(const pheval_context* context) {
+  return context->engine->cards;
+}
+
+int pheval_context_set_numa_replica(pheval_context* context, int replica) {
+  if (replica < 0) {
+    context->numa_replica = -1;
+    return -1;
+  }
+  // Checked without creating the copies, whose count the first
+  // pheval_numa_replicate call decides; until then, against the nodes
+  const int replicas = pheval_numa_replicas();
+  if (replica >= (replicas > 0 ? replicas : pheval_numa_nodes())) return -1;
+  context->numa_replica = replica;
+  return replica;
+}
+
+size_t pheval_context_evaluate(pheval_context* context, const uint8_t* cards,
+                               size_t n, size_t stride, int16_t* out) {
+  // The thread may have a binding of its own, e.g. in a pinned pool
+  const int bound = pheval_numa_bound_replica();
+  if (context->numa_replica >= 0) {
+    pheval_numa_bind_thread(context->numa_replica);
+  }
+  const size_t invalid = context->engine->evaluate(cards, n, stride, out);
+  if (context->numa_replica >= 0) {
+    if (bound >= 0) {
+      pheval_numa_bind_thread(bound);
+    } else {
+      pheval_numa_unbind_thread();
+    }
+  }
+  context->hands += n;
+  context->invalid_hands += invalid;
+  return invalid;
+}
+
+uint64_t pheval_context_hands(const pheval_context* context) {
+  return context->hands;
+}
+
+uint64_t pheval_context_invalid_hands(const pheval_context* context) {
+  return context->invalid_hands;
+}
@@ -4,6 +4,8 @@
 
 #include "../../math/hash/hash.h"
 #include "../../database/tables/tables.h"
+#include "probes.h"
+#include "batch.h"
 
 /*
 * Card id, ranged from 0 to 51.
@@ -17,6 +19,8 @@
 int evaluate_5cards(int a, int b, int c, int d, int e) {
 int suit_hash = 0;
 
+PHEVAL_STATS_CALL(PHEVAL_STATS_5CARDS);
+
 suit_hash += bit_of_mod_4_x_3[a];  // (1 << ((a % 4) * 3))
 suit_hash += bit_of_mod_4_x_3[b];  // (1 << ((b % 4) * 3))
 suit_hash += bit_of_mod_4_x_3[c];  // (1 << ((c % 4) * 3))
@@ -32,7 +36,12 @@ if (suits[suit_hash]) {
     suit_binary[d & 0x3] |= bit_of_div_4[d];  // (1 << (d / 4))
     suit_binary[e & 0x3] |= bit_of_div_4[e];  // (1 << (e / 4))
 
-    return flush[suit_binary[suits[suit_hash] - 1]];
+    const int rank = flush[suit_binary[suits[suit_hash] - 1]];
+    PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_FLUSH, flush, suit_binary[suits[suit_hash] - 1]);
+    PHEVAL_STATS_FLUSH_HIT(PHEVAL_STATS_5CARDS);
+    PHEVAL_PROBE_FLUSH(PHEVAL_STATS_5CARDS, rank);
+
+    return rank;
 }
 
 unsigned char quinary[13] = {0};
@@ -45,5 +54,13 @@ quinary[(e >> 2)]++;
 
 const int hash = hash_quinary(quinary, 5);
 
+PHEVAL_STATS_NOFLUSH_ONLY(PHEVAL_STATS_5CARDS);
+PHEVAL_STATS_REGION(PHEVAL_STATS_5CARDS, hash, 6175);
+PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_NOFLUSH5, noflush5, hash);
+PHEVAL_PROBE_NOFLUSH(PHEVAL_STATS_5CARDS, hash, noflush5[hash]);
+
 return noflush5[hash];
-}
\ No newline at end of file
+}
+
+PHEVAL_DEFINE_BATCH(evaluate_5cards_batch, pheval_engine_5cards, "5cards", 5,
+                    evaluate_5cards(c[0], c[1], c[2], c[3], c[4]));
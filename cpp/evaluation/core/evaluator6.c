@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include "../../math/hash/hash.h"
 #include "../../database/tables/tables.h"
+#include "probes.h"
+#include "batch.h"
 
 // This file is used to evaluate the 6-card poker hand
 // It finds the best 5-card hand from 6 cards
@@ -13,6 +15,10 @@
 */
 int evaluate_6cards(int a, int b, int c, int d, int e, int f) {
     int best_rank = 10000; // Start with worst possible rank
+
+    // Only calls and flush reads are counted here, the 6 lookups per call
+    // don't map onto a single noflush table.
+    PHEVAL_STATS_CALL(PHEVAL_STATS_6CARDS);
     
     // Try all possible 5-card combinations from the 6 cards
     int cards[6] = {a, b, c, d, e, f};
@@ -46,6 +52,8 @@ int evaluate_6cards(int a, int b, int c, int d, int e, int f) {
             suit_binary[combinations[i][4] & 0x3] |= bit_of_div_4[combinations[i][4]];
             
             current_rank = flush[suit_binary[suits[suit_hash] - 1]];
+            PHEVAL_STATS_FLUSH_HIT(PHEVAL_STATS_6CARDS);
+            PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_FLUSH, flush, suit_binary[suits[suit_hash] - 1]);
         }
         
         unsigned char quinary[13] = {0};
@@ -57,6 +65,7 @@ int evaluate_6cards(int a, int b, int c, int d, int e, int f) {
         
         const int hash = hash_quinary(quinary, 5);
         int noflush_rank = noflush5[hash];
+        PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_NOFLUSH5, noflush5, hash);
         
         if (noflush_rank < current_rank) {
             current_rank = noflush_rank;
@@ -68,4 +77,7 @@ int evaluate_6cards(int a, int b, int c, int d, int e, int f) {
     }
     
     return best_rank;
-}
\ No newline at end of file
+}
+
+PHEVAL_DEFINE_BATCH(evaluate_6cards_batch, pheval_engine_6cards, "6cards", 6,
+                    evaluate_6cards(c[0], c[1], c[2], c[3], c[4], c[5]));
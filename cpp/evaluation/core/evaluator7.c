@@ -3,6 +3,11 @@
 
  #include "../../math/hash/hash.h"
 #include "../../database/tables/tables.h"
+ #include "probes.h"
+ #include "batch.h"
+ #include "replicas.h"
+
+PHEVAL_REPLICATED_TABLE(short, noflush7);
  
  /*
   * Card id, ranged from 0 to 51.
@@ -12,6 +17,8 @@
   */
  int evaluate_7cards(int a, int b, int c, int d, int e, int f, int g) {
    int suit_hash = 0;
+
+   PHEVAL_STATS_CALL(PHEVAL_STATS_7CARDS);
  
    suit_hash += bit_of_mod_4_x_3[a];  // (1 << ((a % 4) * 3))
    suit_hash += bit_of_mod_4_x_3[b];  // (1 << ((b % 4) * 3))
@@ -32,7 +39,12 @@
      suit_binary[f & 0x3] |= bit_of_div_4[f];  // (1 << (f / 4))
      suit_binary[g & 0x3] |= bit_of_div_4[g];  // (1 << (g / 4))
  
-     return flush[suit_binary[suits[suit_hash] - 1]];
+     const int rank = flush[suit_binary[suits[suit_hash] - 1]];
+     PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_FLUSH, flush, suit_binary[suits[suit_hash] - 1]);
+     PHEVAL_STATS_FLUSH_HIT(PHEVAL_STATS_7CARDS);
+     PHEVAL_PROBE_FLUSH(PHEVAL_STATS_7CARDS, rank);
+
+     return rank;
    }
  
    unsigned char quinary[13] = {0};
@@ -46,6 +58,15 @@
    quinary[(g >> 2)]++;
  
    const int hash = hash_quinary(quinary, 7);
+
+   PHEVAL_STATS_NOFLUSH_ONLY(PHEVAL_STATS_7CARDS);
+   PHEVAL_STATS_REGION(PHEVAL_STATS_7CARDS, hash, 49205);
+   PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_NOFLUSH7, noflush7, hash);
+   PHEVAL_PROBE_NOFLUSH(PHEVAL_STATS_7CARDS, hash,
+                        PHEVAL_LOCAL_TABLE(noflush7)[hash]);
  
-   return noflush7[hash];
- }
\ No newline at end of file
+   return PHEVAL_LOCAL_TABLE(noflush7)[hash];
+ }
+
+PHEVAL_DEFINE_BATCH(evaluate_7cards_batch, pheval_engine_7cards, "7cards", 7,
+                    evaluate_7cards(c[0], c[1], c[2], c[3], c[4], c[5], c[6]));
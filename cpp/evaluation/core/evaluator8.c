@@ -18,6 +18,11 @@
 
  #include "../../math/hash/hash.h"
 #include "../../database/tables/tables.h"
+ #include "probes.h"
+ #include "batch.h"
+ #include "replicas.h"
+
+PHEVAL_REPLICATED_TABLE(short, noflush8);
  
  static short binaries_by_id[52] = {
      0x1,   0x1,   0x1,   0x1,    0x2,    0x2,    0x2,    0x2,   0x4,
@@ -46,6 +51,8 @@
    int suit_hash = 0;
    int value_flush = 10000;
    int value_noflush = 10000;
+
+   PHEVAL_STATS_CALL(PHEVAL_STATS_8CARDS);
  
    suit_hash += suitbit_by_id[a];
    suit_hash += suitbit_by_id[b];
@@ -68,6 +75,9 @@
      suit_binary[h & 0x3] |= binaries_by_id[h];
  
      value_flush = flush[suit_binary[suits[suit_hash] - 1]];
+     PHEVAL_STATS_FLUSH_HIT(PHEVAL_STATS_8CARDS);
+     PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_FLUSH, flush, suit_binary[suits[suit_hash] - 1]);
+     PHEVAL_PROBE_FLUSH(PHEVAL_STATS_8CARDS, value_flush);
    }
  
    unsigned char quinary[13] = {0};
@@ -82,10 +92,19 @@
  
    const int hash = hash_quinary(quinary, 8);
  
-   value_noflush = noflush8[hash];
+   value_noflush = PHEVAL_LOCAL_TABLE(noflush8)[hash];
+   PHEVAL_STATS_REGION(PHEVAL_STATS_8CARDS, hash, 120055);
+   PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_NOFLUSH8, noflush8, hash);
+   PHEVAL_PROBE_NOFLUSH(PHEVAL_STATS_8CARDS, hash, value_noflush);
  
    if (value_flush < value_noflush)
      return value_flush;
-   else
+   else {
+     PHEVAL_STATS_NOFLUSH_ONLY(PHEVAL_STATS_8CARDS);
      return value_noflush;
- }
\ No newline at end of file
+   }
+ }
+
+PHEVAL_DEFINE_BATCH(evaluate_8cards_batch, pheval_engine_8cards, "8cards", 8,
+                    evaluate_8cards(c[0], c[1], c[2], c[3], c[4], c[5], c[6],
+                                    c[7]));
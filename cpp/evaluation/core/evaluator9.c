@@ -1,6 +1,11 @@
 #include <stdio.h>
 #include "../../math/hash/hash.h"
 #include "../../database/tables/tables.h"
+#include "probes.h"
+#include "batch.h"
+#include "replicas.h"
+
+PHEVAL_REPLICATED_TABLE(short, noflush9);
 
 static short binaries_by_id[52] = {
     0x1,   0x1,   0x1,   0x1,    0x2,    0x2,    0x2,    0x2,   0x4,
@@ -31,6 +36,8 @@ int value_flush = 10000;
 int value_noflush = 10000;
 int suit_counter[4] = {0};
 
+PHEVAL_STATS_CALL(PHEVAL_STATS_9CARDS);
+
 suit_counter[a & 0x3]++;
 suit_counter[b & 0x3]++;
 suit_counter[c & 0x3]++;
@@ -55,6 +62,9 @@ for (int l = 0; l < 4; l++) {
     suit_binary[i & 0x3] |= binaries_by_id[i];
 
     value_flush = flush[suit_binary[l]];
+    PHEVAL_STATS_FLUSH_HIT(PHEVAL_STATS_9CARDS);
+    PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_FLUSH, flush, suit_binary[l]);
+    PHEVAL_PROBE_FLUSH(PHEVAL_STATS_9CARDS, value_flush);
 
     break;
     }
@@ -73,10 +83,19 @@ quinary[(i >> 2)]++;
 
 const int hash = hash_quinary(quinary, 9);
 
-value_noflush = noflush9[hash];
+value_noflush = PHEVAL_LOCAL_TABLE(noflush9)[hash];
+PHEVAL_STATS_REGION(PHEVAL_STATS_9CARDS, hash, 270270);
+PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_NOFLUSH9, noflush9, hash);
+PHEVAL_PROBE_NOFLUSH(PHEVAL_STATS_9CARDS, hash, value_noflush);
 
 if (value_flush < value_noflush)
     return value_flush;
-else
+else {
+    PHEVAL_STATS_NOFLUSH_ONLY(PHEVAL_STATS_9CARDS);
     return value_noflush;
-}
\ No newline at end of file
+}
+}
+
+PHEVAL_DEFINE_BATCH(evaluate_9cards_batch, pheval_engine_9cards, "9cards", 9,
+                    evaluate_9cards(c[0], c[1], c[2], c[3], c[4], c[5], c[6],
+                                    c[7], c[8]));
@@ -0,0 +1,143 @@
+// Runtime of the PHEVAL_HEATMAP counters, see phevaluator/heatmap.h
+
+#include <phevaluator/heatmap.h>
+
+#include <string.h>
+
+#ifdef PHEVAL_HEATMAP
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "probes.h"
+
+struct heatmap_block {
+  unsigned long long* lines[PHEVAL_HEATMAP_TABLE_COUNT];
+  struct heatmap_block* next;
+};
+
+// Blocks stay registered after their thread exits and are never freed, the
+// same as the PHEVAL_STATS blocks.
+static struct heatmap_block* blocks = NULL;
+static pthread_mutex_t blocks_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static __thread struct heatmap_block* local_block = NULL;
+
+// Line count of each table, learnt from the first touch so that this file
+// doesn't pull every table into every library. 0 lines means the table
+// hasn't been read yet.
+static size_t table_lines[PHEVAL_HEATMAP_TABLE_COUNT];
+
+static size_t line_of(const char* base, const char* entry) {
+  return ((uintptr_t)entry / PHEVAL_HEATMAP_LINE_SIZE) -
+         ((uintptr_t)base / PHEVAL_HEATMAP_LINE_SIZE);
+}
+
+static struct heatmap_block* register_block(void) {
+  struct heatmap_block* block = calloc(1, sizeof(struct heatmap_block));
+
+  if (block == NULL) abort();
+
+  pthread_mutex_lock(&blocks_lock);
+  block->next = blocks;
+  blocks = block;
+  pthread_mutex_unlock(&blocks_lock);
+
+  local_block = block;
+  return block;
+}
+
+static unsigned long long* allocate_lines(enum pheval_heatmap_table table,
+                                          const void* base, size_t bytes) {
+  const size_t lines = line_of(base, (const char*)base + bytes - 1) + 1;
+  unsigned long long* counts = calloc(lines, sizeof(unsigned long long));
+
+  if (counts == NULL) abort();
+
+  pthread_mutex_lock(&blocks_lock);
+  table_lines[table] = lines;
+  local_block->lines[table] = counts;
+  pthread_mutex_unlock(&blocks_lock);
+
+  return counts;
+}
+
+void pheval_heatmap_touch(enum pheval_heatmap_table table, const void* base,
+                          size_t bytes, const void* entry) {
+  struct heatmap_block* block = local_block ? local_block : register_block();
+  unsigned long long* counts = block->lines[table];
+  unsigned long long* count;
+
+  if (counts == NULL) counts = allocate_lines(table, base, bytes);
+
+  count = &counts[line_of(base, entry)];
+  __atomic_store_n(count, __atomic_load_n(count, __ATOMIC_RELAXED) + 1,
+                   __ATOMIC_RELAXED);
+}
+
+size_t pheval_heatmap_lines(enum pheval_heatmap_table table) {
+  size_t lines;
+
+  pthread_mutex_lock(&blocks_lock);
+  lines = table_lines[table];
+  pthread_mutex_unlock(&blocks_lock);
+
+  return lines;
+}
+
+int pheval_heatmap_enabled(void) { return 1; }
+
+void pheval_heatmap_snapshot(enum pheval_heatmap_table table,
+                             unsigned long long* out) {
+  struct heatmap_block* block;
+  size_t lines;
+  size_t i;
+
+  pthread_mutex_lock(&blocks_lock);
+  lines = table_lines[table];
+  memset(out, 0, lines * sizeof(unsigned long long));
+  for (block = blocks; block != NULL; block = block->next) {
+    if (block->lines[table] == NULL) continue;
+    for (i = 0; i < lines; i++) {
+      out[i] += __atomic_load_n(&block->lines[table][i], __ATOMIC_RELAXED);
+    }
+  }
+  pthread_mutex_unlock(&blocks_lock);
+}
+
+void pheval_heatmap_reset(void) {
+  struct heatmap_block* block;
+  size_t i;
+  int table;
+
+  pthread_mutex_lock(&blocks_lock);
+  for (block = blocks; block != NULL; block = block->next) {
+    for (table = 0; table < PHEVAL_HEATMAP_TABLE_COUNT; table++) {
+      if (block->lines[table] == NULL) continue;
+      for (i = 0; i < table_lines[table]; i++) {
+        __atomic_store_n(&block->lines[table][i], 0, __ATOMIC_RELAXED);
+      }
+    }
+  }
+  pthread_mutex_unlock(&blocks_lock);
+}
+
+#else
+
+int pheval_heatmap_enabled(void) { return 0; }
+
+size_t pheval_heatmap_lines(enum pheval_heatmap_table table) {
+  (void)table;
+  return 0;
+}
+
+void pheval_heatmap_snapshot(enum pheval_heatmap_table table,
+                             unsigned long long* out) {
+  (void)table;
+  (void)out;
+}
+
+void pheval_heatmap_reset(void) {}
+
+#endif  // PHEVAL_HEATMAP
@@ -0,0 +1,199 @@
+// Runtime of the PHEVAL_NUMA table replicas, see phevaluator/numa.h
+
+#define _GNU_SOURCE  // sched_getcpu
+
+#include <phevaluator/numa.h>
+
+#include <stddef.h>
+
+#ifdef PHEVAL_NUMA
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef PHEVAL_HAVE_LIBNUMA
+#include <numa.h>
+#endif
+
+#include "replicas.h"
+
+static struct pheval_replicated_table* tables = NULL;
+static int replica_count = 0;
+static int replica_nodes = 1;
+static pthread_mutex_t replicas_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread int bound_replica = -1;
+
+void pheval_numa_register(struct pheval_replicated_table* table) {
+  pthread_mutex_lock(&replicas_lock);
+  table->next = tables;
+  tables = table;
+  pthread_mutex_unlock(&replicas_lock);
+}
+
+int pheval_numa_enabled(void) { return 1; }
+
+int pheval_numa_available(void) {
+#ifdef PHEVAL_HAVE_LIBNUMA
+  return numa_available() >= 0;
+#else
+  return 0;
+#endif
+}
+
+static const void* copy_to_node(const struct pheval_replicated_table* table,
+                                int node) {
+#ifdef PHEVAL_HAVE_LIBNUMA
+  if (pheval_numa_available()) {
+    // numa_alloc_onnode binds the pages to the node, so they land there
+    // when memcpy first touches them, whichever CPU runs this.
+    void* copy = numa_alloc_onnode(table->bytes, node);
+    if (copy == NULL) abort();
+    memcpy(copy, table->master, table->bytes);
+    return copy;
+  }
+#endif
+  (void)node;
+  return table->master;
+}
+
+int pheval_numa_nodes(void) {
+  int nodes = 1;
+#ifdef PHEVAL_HAVE_LIBNUMA
+  if (pheval_numa_available()) nodes = numa_num_configured_nodes();
+#endif
+  return nodes < 1 ? 1 : nodes;
+}
+
+int pheval_numa_replicate(int replicas) {
+  struct pheval_replicated_table* table;
+  int i;
+
+  pthread_mutex_lock(&replicas_lock);
+  if (replica_count == 0) {
+    replica_nodes = pheval_numa_nodes();
+    replica_count = replicas > 0 ? replicas : replica_nodes;
+    if (replica_count > PHEVAL_NUMA_MAX_REPLICAS) {
+      replica_count = PHEVAL_NUMA_MAX_REPLICAS;
+    }
+
+    for (table = tables; table != NULL; table = table->next) {
+      for (i = 0; i < replica_count; i++) {
+        table->replicas[i] = copy_to_node(table, i % replica_nodes);
+      }
+    }
+  }
+  replicas = replica_count;
+  pthread_mutex_unlock(&replicas_lock);
+
+  return replicas;
+}
+
+int pheval_numa_replicas(void) {
+  int replicas;
+
+  pthread_mutex_lock(&replicas_lock);
+  replicas = replica_count;
+  pthread_mutex_unlock(&replicas_lock);
+
+  return replicas;
+}
+
+static int current_node(void) {
+#ifdef PHEVAL_HAVE_LIBNUMA
+  if (pheval_numa_available()) {
+    const int cpu = sched_getcpu();
+    if (cpu >= 0) {
+      const int node = numa_node_of_cpu(cpu);
+      if (node >= 0) return node;
+    }
+  }
+#endif
+  return 0;
+}
+
+int pheval_numa_bind_thread(int replica) {
+  struct pheval_replicated_table* table;
+  const int count = pheval_numa_replicate(0);
+
+  if (replica < 0) replica = current_node() % count;
+  if (replica >= count) return -1;
+
+  // The list and the replicas don't change after the first replicate call.
+  for (table = tables; table != NULL; table = table->next) {
+    table->bind(table->replicas[replica]);
+  }
+  bound_replica = replica;
+  return replica;
+}
+
+void pheval_numa_unbind_thread(void) {
+  struct pheval_replicated_table* table;
+
+  for (table = tables; table != NULL; table = table->next) {
+    table->bind(table->master);
+  }
+  bound_replica = -1;
+}
+
+int pheval_numa_bound_replica(void) { return bound_replica; }
+
+int pheval_numa_pin_thread(int replica) {
+  const int count = pheval_numa_replicate(0);
+
+  if (replica < 0 || replica >= count) return -1;
+#ifdef PHEVAL_HAVE_LIBNUMA
+  if (pheval_numa_available()) numa_run_on_node(replica % replica_nodes);
+#endif
+  return pheval_numa_bind_thread(replica);
+}
+
+const void* pheval_numa_local_table(const char* name) {
+  struct pheval_replicated_table* table;
+  const void* local = NULL;
+
+  pthread_mutex_lock(&replicas_lock);
+  for (table = tables; table != NULL; table = table->next) {
+    if (strcmp(table->name, name) == 0) local = table->local();
+  }
+  pthread_mutex_unlock(&replicas_lock);
+
+  return local;
+}
+
+#else
+
+int pheval_numa_enabled(void) { return 0; }
+
+int pheval_numa_available(void) { return 0; }
+
+int pheval_numa_replicate(int replicas) {
+  (void)replicas;
+  return 0;
+}
+
+int pheval_numa_replicas(void) { return 0; }
+
+int pheval_numa_nodes(void) { return 0; }
+
+int pheval_numa_bind_thread(int replica) {
+  (void)replica;
+  return -1;
+}
+
+void pheval_numa_unbind_thread(void) {}
+
+int pheval_numa_bound_replica(void) { return -1; }
+
+int pheval_numa_pin_thread(int replica) {
+  (void)replica;
+  return -1;
+}
+
+const void* pheval_numa_local_table(const char* name) {
+  (void)name;
+  return NULL;
+}
+
+#endif  // PHEVAL_NUMA
@@ -0,0 +1,89 @@
+#ifndef PROBES_H
+#define PROBES_H
+
+/*
+ * Instrumentation points of the evaluators, see phevaluator/stats.h and
+ * phevaluator/heatmap.h. Everything here expands to ((void)0) unless
+ * PHEVAL_STATS (or PHEVAL_HEATMAP for the table touches) is defined, and
+ * the USDT probes additionally need PHEVAL_HAVE_SDT (set by CMake when
+ * <sys/sdt.h> is found).
+ */
+
+#include <phevaluator/stats.h>
+
+#ifdef PHEVAL_STATS
+
+extern __thread struct pheval_stats* pheval_stats_local;
+struct pheval_stats* pheval_stats_register(void);
+
+#define PHEVAL_STATS_BLOCK() \
+  (pheval_stats_local ? pheval_stats_local : pheval_stats_register())
+
+// Only the owning thread writes a counter, so a relaxed load and store is
+// enough and avoids a locked instruction on the hot path.
+#define PHEVAL_STATS_BUMP(counter)                                         \
+  __atomic_store_n(&(counter), __atomic_load_n(&(counter), __ATOMIC_RELAXED) + 1, \
+                   __ATOMIC_RELAXED)
+
+#define PHEVAL_STATS_CALL(e) \
+  PHEVAL_STATS_BUMP(PHEVAL_STATS_BLOCK()->evaluator[e].calls)
+#define PHEVAL_STATS_FLUSH_HIT(e) \
+  PHEVAL_STATS_BUMP(PHEVAL_STATS_BLOCK()->evaluator[e].flush_hits)
+#define PHEVAL_STATS_NOFLUSH_ONLY(e) \
+  PHEVAL_STATS_BUMP(PHEVAL_STATS_BLOCK()->evaluator[e].noflush_only)
+#define PHEVAL_STATS_REGION(e, index, size)                         \
+  PHEVAL_STATS_BUMP(PHEVAL_STATS_BLOCK()->evaluator[e].region_hits  \
+                        [(unsigned long long)(index) *              \
+                         PHEVAL_STATS_REGIONS / (size)])
+#define PHEVAL_STATS_QUINARY_DEPTH(depth)                        \
+  do {                                                           \
+    PHEVAL_STATS_BUMP(PHEVAL_STATS_BLOCK()->quinary_calls);      \
+    PHEVAL_STATS_BUMP(PHEVAL_STATS_BLOCK()->quinary_depth[depth]); \
+  } while (0)
+
+#else
+
+#define PHEVAL_STATS_CALL(e) ((void)0)
+#define PHEVAL_STATS_FLUSH_HIT(e) ((void)0)
+#define PHEVAL_STATS_NOFLUSH_ONLY(e) ((void)0)
+#define PHEVAL_STATS_REGION(e, index, size) ((void)0)
+#define PHEVAL_STATS_QUINARY_DEPTH(depth) ((void)0)
+
+#endif  // PHEVAL_STATS
+
+#ifdef PHEVAL_HEATMAP
+
+#include <phevaluator/heatmap.h>
+
+void pheval_heatmap_touch(enum pheval_heatmap_table table, const void* base,
+                          size_t bytes, const void* entry);
+
+// table must be one of the sized arrays declared in tables.h
+#define PHEVAL_HEATMAP_TOUCH(t, table, index) \
+  pheval_heatmap_touch(t, table, sizeof(table), &(table)[index])
+
+#else
+
+#define PHEVAL_HEATMAP_TOUCH(t, table, index) ((void)0)
+
+#endif  // PHEVAL_HEATMAP
+
+#if defined(PHEVAL_STATS) && defined(PHEVAL_HAVE_SDT)
+
+#include <sys/sdt.h>
+
+#define PHEVAL_PROBE_FLUSH(e, rank) DTRACE_PROBE2(pheval, flush, e, rank)
+#define PHEVAL_PROBE_NOFLUSH(e, hash, rank) \
+  DTRACE_PROBE3(pheval, noflush, e, hash, rank)
+#define PHEVAL_PROBE_QUINARY_DEPTH(depth) \
+  DTRACE_PROBE1(pheval, quinary_depth, depth)
+
+#else
+
+#define PHEVAL_PROBE_FLUSH(e, rank) ((void)0)
+#define PHEVAL_PROBE_NOFLUSH(e, hash, rank) ((void)0)
+#define PHEVAL_PROBE_QUINARY_DEPTH(depth) ((void)0)
+
+#endif
+
+#endif  // PROBES_H
@@ -0,0 +1,63 @@
+#ifndef REPLICAS_H
+#define REPLICAS_H
+
+/*
+ * Thread-local table pointers of the PHEVAL_NUMA build, see
+ * phevaluator/numa.h. A file that reads a replicated table declares it once
+ * with PHEVAL_REPLICATED_TABLE and reads it through PHEVAL_LOCAL_TABLE.
+ * Without PHEVAL_NUMA the declaration is empty and PHEVAL_LOCAL_TABLE is the
+ * table itself.
+ */
+
+#ifdef PHEVAL_NUMA
+
+#include <stddef.h>
+
+#define PHEVAL_NUMA_MAX_REPLICAS 64
+
+struct pheval_replicated_table {
+  const char* name;
+  const void* master;
+  size_t bytes;
+  void (*bind)(const void* replica);
+  const void* (*local)(void);
+  const void* replicas[PHEVAL_NUMA_MAX_REPLICAS];
+  struct pheval_replicated_table* next;
+};
+
+void pheval_numa_register(struct pheval_replicated_table* table);
+
+// The registration runs as a constructor, so a table is replicated exactly
+// when its evaluator is linked in. The trailing redeclaration of the table
+// is only there to take the semicolon after the macro.
+#define PHEVAL_REPLICATED_TABLE(type, table)                                 \
+  static __thread const type* pheval_local_##table = table;                  \
+  static void pheval_bind_##table(const void* replica) {                     \
+    pheval_local_##table = (const type*)replica;                             \
+  }                                                                          \
+  static const void* pheval_get_##table(void) {                              \
+    return pheval_local_##table;                                             \
+  }                                                                          \
+  static struct pheval_replicated_table pheval_replicated_##table = {        \
+      .name = #table,                                                        \
+      .master = table,                                                       \
+      .bytes = sizeof(table),                                                \
+      .bind = pheval_bind_##table,                                           \
+      .local = pheval_get_##table,                                           \
+      .replicas = {0},                                                       \
+      .next = 0};                                                            \
+  __attribute__((constructor)) static void pheval_register_##table(void) {   \
+    pheval_numa_register(&pheval_replicated_##table);                        \
+  }                                                                          \
+  extern const type table[]
+
+#define PHEVAL_LOCAL_TABLE(table) pheval_local_##table
+
+#else
+
+#define PHEVAL_REPLICATED_TABLE(type, table) extern const type table[]
+#define PHEVAL_LOCAL_TABLE(table) (table)
+
+#endif  // PHEVAL_NUMA
+
+#endif  // REPLICAS_H
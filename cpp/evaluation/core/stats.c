@@ -0,0 +1,85 @@
+// Runtime of the PHEVAL_STATS counters, see phevaluator/stats.h
+
+#include <phevaluator/stats.h>
+
+#include <string.h>
+
+#ifdef PHEVAL_STATS
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "probes.h"
+
+#define COUNTERS (sizeof(struct pheval_stats) / sizeof(unsigned long long))
+
+// Blocks stay registered after their thread exits, so their counts still
+// show up in a snapshot. They are never freed.
+struct stats_block {
+  struct pheval_stats stats;
+  struct stats_block* next;
+};
+
+static struct stats_block* blocks = NULL;
+static pthread_mutex_t blocks_lock = PTHREAD_MUTEX_INITIALIZER;
+
+__thread struct pheval_stats* pheval_stats_local = NULL;
+
+struct pheval_stats* pheval_stats_register(void) {
+  struct stats_block* block = calloc(1, sizeof(struct stats_block));
+
+  if (block == NULL) abort();
+
+  pthread_mutex_lock(&blocks_lock);
+  block->next = blocks;
+  blocks = block;
+  pthread_mutex_unlock(&blocks_lock);
+
+  pheval_stats_local = &block->stats;
+  return pheval_stats_local;
+}
+
+int pheval_stats_enabled(void) { return 1; }
+
+void pheval_stats_snapshot(struct pheval_stats* out) {
+  unsigned long long* sum = (unsigned long long*)out;
+  struct stats_block* block;
+  size_t i;
+
+  memset(out, 0, sizeof(struct pheval_stats));
+
+  pthread_mutex_lock(&blocks_lock);
+  for (block = blocks; block != NULL; block = block->next) {
+    unsigned long long* counters = (unsigned long long*)&block->stats;
+    for (i = 0; i < COUNTERS; i++) {
+      sum[i] += __atomic_load_n(&counters[i], __ATOMIC_RELAXED);
+    }
+  }
+  pthread_mutex_unlock(&blocks_lock);
+}
+
+void pheval_stats_reset(void) {
+  struct stats_block* block;
+  size_t i;
+
+  pthread_mutex_lock(&blocks_lock);
+  for (block = blocks; block != NULL; block = block->next) {
+    unsigned long long* counters = (unsigned long long*)&block->stats;
+    for (i = 0; i < COUNTERS; i++) {
+      __atomic_store_n(&counters[i], 0, __ATOMIC_RELAXED);
+    }
+  }
+  pthread_mutex_unlock(&blocks_lock);
+}
+
+#else
+
+int pheval_stats_enabled(void) { return 0; }
+
+void pheval_stats_snapshot(struct pheval_stats* out) {
+  memset(out, 0, sizeof(struct pheval_stats));
+}
+
+void pheval_stats_reset(void) {}
+
+#endif  // PHEVAL_STATS
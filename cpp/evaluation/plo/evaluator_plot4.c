@@ -1,5 +1,11 @@
 #include "../../math/hash/hash.h"
 #include "../../database/tables/tables.h"
+#include "../core/probes.h"
+#include "../core/batch.h"
+#include "../core/replicas.h"
+
+PHEVAL_REPLICATED_TABLE(short, flush_plo4);
+PHEVAL_REPLICATED_TABLE(short, noflush_plo4);
 
 static int hash_binary(const int binary, int k) {
 // The binary should have 15 bits
@@ -38,6 +44,8 @@ int value_noflush = 10000;
 int suit_count_board[4] = {0};
 int suit_count_hole[4] = {0};
 
+PHEVAL_STATS_CALL(PHEVAL_STATS_PLO4);
+
 suit_count_board[c1 & 0x3]++;
 suit_count_board[c2 & 0x3]++;
 suit_count_board[c3 & 0x3]++;
@@ -67,6 +75,8 @@ for (int i = 0; i < 4; i++) {
 
     if (suit_count_board[i] == 3 && suit_count_hole[i] == 2) {
         value_flush = flush[suit_binary_board[i] | suit_binary_hole[i]];
+        PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_FLUSH, flush,
+                             suit_binary_board[i] | suit_binary_hole[i]);
     } else {
         // Padding is trying to make sure the binary has the same amount of
         // bits set. For the board cards, we want 5 bits set, and for the hole
@@ -83,9 +93,14 @@ for (int i = 0; i < 4; i++) {
         const int board_hash = hash_binary(suit_binary_board[i], 5);
         const int hole_hash = hash_binary(suit_binary_hole[i], 4);
 
-        value_flush = flush_plo4[board_hash * 1365 + hole_hash];
+        value_flush = PHEVAL_LOCAL_TABLE(flush_plo4)[board_hash * 1365 + hole_hash];
+        PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_FLUSH_PLO4, flush_plo4,
+                             board_hash * 1365 + hole_hash);
     }
 
+    PHEVAL_STATS_FLUSH_HIT(PHEVAL_STATS_PLO4);
+    PHEVAL_PROBE_FLUSH(PHEVAL_STATS_PLO4, value_flush);
+
     break;
     }
 }
@@ -107,15 +122,26 @@ quinary_hole[(h4 >> 2)]++;
 const int board_hash = hash_quinary(quinary_board, 5);
 const int hole_hash = hash_quinary(quinary_hole, 4);
 
-value_noflush = noflush_plo4[board_hash * 1820 + hole_hash];
+value_noflush = PHEVAL_LOCAL_TABLE(noflush_plo4)[board_hash * 1820 + hole_hash];
+PHEVAL_STATS_REGION(PHEVAL_STATS_PLO4, board_hash * 1820 + hole_hash, 11238500);
+PHEVAL_HEATMAP_TOUCH(PHEVAL_HEATMAP_NOFLUSH_PLO4, noflush_plo4,
+                     board_hash * 1820 + hole_hash);
+PHEVAL_PROBE_NOFLUSH(PHEVAL_STATS_PLO4, board_hash * 1820 + hole_hash,
+                     value_noflush);
 
 if (value_flush < value_noflush)
     return value_flush;
-else
+else {
+    PHEVAL_STATS_NOFLUSH_ONLY(PHEVAL_STATS_PLO4);
     return value_noflush;
 }
+}
 
 int evaluate_omaha_cards(int c1, int c2, int c3, int c4, int c5, int h1, int h2,
                         int h3, int h4) {
 return evaluate_plo4_cards(c1, c2, c3, c4, c5, h1, h2, h3, h4);
-}
\ No newline at end of file
+}
+
+PHEVAL_DEFINE_BATCH(evaluate_plo4_batch, pheval_engine_plo4, "plo4", 9,
+                    evaluate_plo4_cards(c[0], c[1], c[2], c[3], c[4], c[5],
+                                        c[6], c[7], c[8]));
@@ -0,0 +1,56 @@
+#include <phevaluator/hand_file.h>
+#include <phevaluator/phevaluator.h>
+
+#include <stdexcept>
+
+// PLO4 evaluation of the binary hand files, see hand_file.h
+
+namespace phevaluator {
+
+namespace {
+
+inline int EvaluatePlo4Record(const HandFileHeader& header, const int* cards,
+                              short* ranks) {
+  const int* b = cards;
+  const int* h = cards + 5;
+
+  for (int p = 0; p < header.players; p++, h += 4) {
+    ranks[p] = evaluate_plo4_cards(b[0], b[1], b[2], b[3], b[4], h[0], h[1],
+                                   h[2], h[3]);
+  }
+  return header.players;
+}
+
+void CheckPlo4Variant(const HandFileHeader& header) {
+  if (header.variant != HandVariant::kOmaha) {
+    throw std::invalid_argument("EvaluatePlo4HandFile takes kOmaha files");
+  }
+}
+
+}  // namespace
+
+size_t EvaluatePlo4HandFile(const MappedHandFile& file, short* ranks) {
+  const HandFileHeader& header = file.header();
+  CheckPlo4Variant(header);
+
+  file.forEach([&](const int* cards) {
+    ranks += EvaluatePlo4Record(header, cards, ranks);
+  });
+  return file.size() * header.players;
+}
+
+size_t EvaluatePlo4Hands(HandReader& reader, short* ranks,
+                         size_t max_records) {
+  const HandFileHeader& header = reader.header();
+  CheckPlo4Variant(header);
+
+  int cards[52];
+  size_t records = 0;
+  while (records < max_records && reader.next(cards)) {
+    ranks += EvaluatePlo4Record(header, cards, ranks);
+    records++;
+  }
+  return records;
+}
+
+}  // namespace phevaluator
@@ -4,12 +4,20 @@ Compile:
   //in the home directory of the project
  cd cpp && clang++ -std=c++17 -O3 -I./include -o evaluation/standalone/sim evaluation/standalone/sim.cc -L. -lpheval
 Run: (all arguments are optional, defaults to 9 player full runouts)
-  ./sim [number of other players 1-8] [cards on the board 3-5] [top % highlighted] [number of runouts per hand]
+  ./sim [number of other players 1-8] [cards on the board 3-5] [top % highlighted] [number of runouts per hand] [seed] [+-% wanted]
 e.g.
 x
   plays out 6 handed, just the flop, highlights the top 10% of hands, only runs 1000 simulations per hand (1M is better, but takes longer)
 
-this is the function to generate the runouts for the simulation
+The seed is printed with the results; passing it back replays the run exactly.
+
+With a last argument, e.g. 0.5, the runs stop as soon as every hand's equity is known to
++-0.5% (95% confidence), and the number of runouts becomes a maximum.
+
+The whole chart comes from one CalculateStartingHandGrid call (phevaluator/equity.h),
+which plays every simulated deal against a hand of each of the 169 classes on every
+core, so the cells share their noise and their order settles quickly.
+
 link to the original code: https://gist.github.com/bwasti/c2ca972c57f4fb581813f82f010c7cb2
 */
 
@@ -17,16 +25,17 @@ link to the original code: https://gist.github.com/bwasti/c2ca972c57f4fb581813f8
 #include <iomanip>
 #include <iostream>
 #include <iterator>
-#include <phevaluator/phevaluator.h>
+#include <phevaluator/equity.h>
 #include <random>
 #include <set>
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <cassert>
+#include <cstdlib>
 
 using namespace phevaluator;
-static std::vector<int> in;
 
 #define ITERS 10000
 
@@ -54,124 +63,11 @@ const std::unordered_map<int, char> suitMap = {
 
 int main(int argc, char **argv)
 {
-  for (auto i = 0; i < 52; ++i)
+  uint64_t seed = std::random_device{}();      // obtain a random number from hardware
+  if (argc > 5)
   {
-    in.emplace_back(i);
+    seed = std::strtoull(argv[5], nullptr, 10);
   }
-  std::random_device rd;                        // obtain a random number from hardware
-  std::mt19937 gen(rd());                       // seed the generator
-  std::uniform_int_distribution<> distr(0, 51); // define the range
-
-  auto gen_rollout = [&](int hole0, int hole1, int other_players,
-                         int cards_on_board) -> bool
-  {
-    std::vector<int> villains;
-    villains.reserve(other_players * 2);
-    std::vector<int> board;
-    board.reserve(cards_on_board);
-
-    std::vector<int> out;
-    auto gen_card = [&]()
-    {
-      auto card = 52;
-      bool valid = false;
-      while (!valid)
-      {
-        card = distr(gen);
-        if (card == hole0)
-        {
-          continue;
-        }
-        if (card == hole1)
-        {
-          continue;
-        }
-        bool match = false;
-        for (auto v : villains)
-        {
-          if (card == v)
-          {
-            match = true;
-            break;
-          }
-        }
-        if (match)
-        {
-          continue;
-        }
-        for (auto v : board)
-        {
-          if (card == v)
-          {
-            match = true;
-            break;
-          }
-        }
-        if (match)
-        {
-          continue;
-        }
-        break;
-      }
-      assert(card < 52);
-      assert(card >= 0);
-      return card;
-    };
-
-    for (auto v = 0; v < other_players * 2; ++v)
-    {
-      villains.emplace_back(gen_card());
-    }
-
-    for (auto b = 0; b < cards_on_board; ++b)
-    {
-      board.emplace_back(gen_card());
-    }
-
-    Rank h;
-    if (cards_on_board == 5)
-    {
-      h = EvaluateCards(hole0, hole1, board[0], board[1], board[2], board[3],
-                        board[4]);
-    }
-    else if (cards_on_board == 4)
-    {
-      h = EvaluateCards(hole0, hole1, board[0], board[1], board[2], board[3]);
-    }
-    else if (cards_on_board == 3)
-    {
-      h = EvaluateCards(hole0, hole1, board[0], board[1], board[2]);
-    }
-    else
-    {
-      throw std::exception();
-    }
-    for (auto v = 0; v < other_players; ++v)
-    {
-      Rank vh;
-      if (cards_on_board == 5)
-      {
-        vh = EvaluateCards(villains[v * 2], villains[v * 2 + 1], board[0],
-                           board[1], board[2], board[3], board[4]);
-      }
-      else if (cards_on_board == 4)
-      {
-        vh = EvaluateCards(villains[v * 2], villains[v * 2 + 1], board[0],
-                           board[1], board[2], board[3]);
-      }
-      else if (cards_on_board == 3)
-      {
-        vh = EvaluateCards(villains[v * 2], villains[v * 2 + 1], board[0],
-                           board[1], board[2]);
-      }
-      if (vh.value() < h.value())
-      {
-        return false;
-      }
-    }
-
-    return true;
-  };
 
   size_t iters = ITERS;
   if (argc > 4)
@@ -179,36 +75,49 @@ int main(int argc, char **argv)
     iters = std::atoi(argv[4]);
   }
 
+  double target_pct = 0;
+  if (argc > 6)
+  {
+    target_pct = std::atof(argv[6]);
+  }
+
   int cards_on_board = 5;
   if (argc > 2)
   {
     cards_on_board = std::atoi(argv[2]);
   }
-
-  auto get_pct = [&](int h0, int h1, int num_players)
+  if (cards_on_board < 3 || cards_on_board > 5)
   {
-    float wins = 0;
-    for (size_t i = 0; i < iters; ++i)
-    {
-      wins += gen_rollout(h0, h1, num_players, cards_on_board);
-    }
-    return wins / iters;
-  };
+    std::cerr << "cards on the board must be 3, 4 or 5\n";
+    return 1;
+  }
 
   int num_players = 8;
   if (argc > 1)
   {
     num_players = std::atoi(argv[1]);
   }
+  if (num_players < 1 || num_players > 8)
+  {
+    std::cerr << "number of other players must be 1 to 8\n";
+    return 1;
+  }
+
+  ThreadPool pool;
+  EquityOptions options;
+  options.trials = iters;
+  options.seed = seed;
+  options.board_cards = cards_on_board;
+  options.target_std_error = target_pct / 100 / 1.96;
 
   int top_pct = 100;
   if (argc > 3)
   {
     top_pct = std::atoi(argv[3]);
   }
-  std::cout << "% winning for " << num_players + 1 << " players after "
+  std::cout << "% equity for " << num_players + 1 << " players after "
             << cards_on_board << " cards dealt (" << iters
-            << " simulations per hand)" << std::flush;
+            << " simulations per hand, seed " << seed << ")" << std::flush;
   if (top_pct < 100)
   {
     std::cout << ", highlighting top " << top_pct << "%"
@@ -236,6 +145,15 @@ int main(int argc, char **argv)
     return ss.str();
   };
 
+  const StartingHandGrid grid =
+      CalculateStartingHandGrid(num_players, options, &pool);
+  if (grid.trials < iters)
+  {
+    std::cout << ", stopped at +-" << target_pct << "% after "
+              << grid.trials << " simulations";
+  }
+  std::cout << "\n";
+
   std::cout << std::fixed;
   std::cout << std::setprecision(0);
   std::unordered_map<int, float> winning_pct;
@@ -251,13 +169,11 @@ int main(int argc, char **argv)
       }
       auto h0 = c0 * 4 + s0;
       auto h1 = c1 * 4 + s1;
-      auto pct = get_pct(h0, h1, num_players);
       auto idx = h0 * 52 + h1;
-      winning_pct[idx] = pct;
+      winning_pct[idx] =
+          static_cast<float>(grid.cells[12 - c0][12 - c1].equity);
     }
-    std::cout << "." << std::flush;
   }
-  std::cout << "\n";
 
   float total = 0;
   for (auto &p : winning_pct)
@@ -0,0 +1,128 @@
+#ifndef PHEVALUATOR_BATCH_H
+#define PHEVALUATOR_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Batch evaluation over caller-owned buffers, for callers that cross an FFI
+ * boundary (ctypes, cffi, Rust) and want one call per column of hands rather
+ * than one per hand. Nothing is copied or allocated.
+ *
+ * cards points at n hands of one byte per card id, hand i starting at
+ * cards + i * stride. A stride of 0 means the hands are packed, i.e. the
+ * stride is the number of cards per hand. A C-contiguous NumPy uint8 array
+ * of shape (n, 7) is stride 7; a wider record can be read in place by
+ * passing its size as the stride.
+ *
+ * out receives n ranks, 1 (best) to 7462 as for the single-hand functions.
+ * A hand with an id outside [0, 52) or a repeated card gets
+ * PHEVAL_INVALID_HAND instead of being evaluated.
+ *
+ * Each batch function is defined next to its evaluator, so it is available
+ * exactly when that evaluator is linked in. The PLO4 function lives in the
+ * PLO4 library and reads the 5 board cards, then the 4 hole cards.
+ */
+
+#define PHEVAL_INVALID_HAND (-1)
+
+// Function: evaluate_Ncards_batch, evaluate_plo4_batch
+// - Input: const uint8_t* cards, size_t n, size_t stride, int16_t* out
+// - Output: size_t, the number of hands that were invalid
+
+size_t evaluate_5cards_batch(const uint8_t* cards, size_t n, size_t stride,
+                             int16_t* out);
+size_t evaluate_6cards_batch(const uint8_t* cards, size_t n, size_t stride,
+                             int16_t* out);
+size_t evaluate_7cards_batch(const uint8_t* cards, size_t n, size_t stride,
+                             int16_t* out);
+size_t evaluate_8cards_batch(const uint8_t* cards, size_t n, size_t stride,
+                             int16_t* out);
+size_t evaluate_9cards_batch(const uint8_t* cards, size_t n, size_t stride,
+                             int16_t* out);
+size_t evaluate_plo4_batch(const uint8_t* cards, size_t n, size_t stride,
+                           int16_t* out);
+
+/*
+ * An engine names one of the batch functions. Engines are constant objects
+ * exported by the evaluator's library (e.g. pheval_engine_7cards), so the
+ * choice of variant is made by taking the address of one, and a variant
+ * whose library isn't linked in fails at link time rather than at run time.
+ * From ctypes: ctypes.c_void_p.in_dll(lib, "pheval_engine_7cards").
+ */
+
+typedef size_t (*pheval_batch_fn)(const uint8_t* cards, size_t n,
+                                  size_t stride, int16_t* out);
+
+typedef struct pheval_engine {
+  const char* name;  // "5cards" .. "9cards", "plo4"
+  int cards;         // cards per hand
+  pheval_batch_fn evaluate;
+} pheval_engine;
+
+extern const pheval_engine pheval_engine_5cards;
+extern const pheval_engine pheval_engine_6cards;
+extern const pheval_engine pheval_engine_7cards;
+extern const pheval_engine pheval_engine_8cards;
+extern const pheval_engine pheval_engine_9cards;
+extern const pheval_engine pheval_engine_plo4;
+
+/*
+ * A context is an opaque handle holding the engine and the per-caller state
+ * a service keeps between calls: the NUMA replica its calls read and
+ * running counts of hands and invalid hands. Contexts are independent; one
+ * context must not be used from two threads at the same time.
+ */
+
+typedef struct pheval_context pheval_context;
+
+// Function: pheval_context_create
+// - Input: const pheval_engine* engine
+// - Output: pheval_context*, NULL if engine is NULL or allocation fails
+
+pheval_context* pheval_context_create(const pheval_engine* engine);
+
+// Function: pheval_context_destroy
+// - Purpose: Frees the context; NULL is ignored
+
+void pheval_context_destroy(pheval_context* context);
+
+// Function: pheval_context_cards
+// - Output: int, the cards per hand of the context's engine
+
+int pheval_context_cards(const pheval_context* context);
+
+// Function: pheval_context_set_numa_replica
+// - Input: int replica, -1 for the compiled-in tables
+// - Output: int, the replica set, -1 if it is out of range
+// - Purpose: Makes every evaluate call on the context bind the calling
+//   thread to the replica for the duration of the call (see numa.h); the
+//   thread's own binding is restored afterwards. Before any replica exists
+//   the index is checked against the node count without creating copies,
+//   so a later pheval_numa_replicate call still decides their number.
+
+int pheval_context_set_numa_replica(pheval_context* context, int replica);
+
+// Function: pheval_context_evaluate
+// - Input: pheval_context* context, const uint8_t* cards, size_t n,
+//   size_t stride, int16_t* out, as for the batch functions
+// - Output: size_t, the number of invalid hands in this call
+
+size_t pheval_context_evaluate(pheval_context* context, const uint8_t* cards,
+                               size_t n, size_t stride, int16_t* out);
+
+// Function: pheval_context_hands, pheval_context_invalid_hands
+// - Output: uint64_t, hands evaluated and invalid hands seen so far
+
+uint64_t pheval_context_hands(const pheval_context* context);
+uint64_t pheval_context_invalid_hands(const pheval_context* context);
+
+#ifdef __cplusplus
+}  // closing brace for extern "C"
+#endif
+
+#endif  // PHEVALUATOR_BATCH_H
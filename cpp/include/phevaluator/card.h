@@ -2,26 +2,49 @@
 #define PHEVALUATOR_CARD_H
 #ifdef __cplusplus
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional> //for hash
+#include <stdexcept>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 
 namespace phevaluator {
     //use namespace here as a container to prevent name collisions and for readability
-const static std::unordered_map<char, int> rankMap = {
-    //using unorder_map here because we want the fastest possible average-case lookups and insertions. 
-    //order of elements are not important here as we defined the key value pairs here
-    {'2', 0}, {'3', 1}, {'4', 2}, {'5', 3},  {'6', 4},  {'7', 5},  {'8', 6},
-    {'9', 7}, {'T', 8}, {'J', 9}, {'Q', 10}, {'K', 11}, {'A', 12},
-};
-const static std::unordered_map<char, int> suitMap = {
-    // 'C' or 'c' (Clubs) -> 0
-    // 'D' or 'd' (Diamonds) -> 1
-    // 'H' or 'h' (Hearts) -> 2
-    // 'S' or 's' (Spades) -> 3
-    {'C', 0}, {'D', 1}, {'H', 2}, {'S', 3},
-    {'c', 0}, {'d', 1}, {'h', 2}, {'s', 3},
-};
+
+// Builds a 256-entry table from a character to its position in `chars`, and
+// -1 for every other character. Indexing by the byte replaces a hash lookup
+// and the tables are built by the compiler, not at start-up.
+constexpr std::array<signed char, 256> MakeCardCharTable(const char* chars) {
+  std::array<signed char, 256> table{};
+  for (int c = 0; c < 256; c++) table[c] = -1;
+  for (int i = 0; chars[i] != '\0'; i++) {
+    table[static_cast<unsigned char>(chars[i])] = static_cast<signed char>(i);
+  }
+  return table;
+}
+
+// '2' -> 0, '3' -> 1, ... 'A' -> 12
+inline constexpr std::array<signed char, 256> kRankIndex =
+    MakeCardCharTable("23456789TJQKA");
+
+// 'c'/'C' -> 0 (clubs), 'd'/'D' -> 1, 'h'/'H' -> 2, 's'/'S' -> 3
+inline constexpr std::array<signed char, 256> kSuitIndex = [] {
+  std::array<signed char, 256> table = MakeCardCharTable("cdhs");
+  const std::array<signed char, 256> upper = MakeCardCharTable("CDHS");
+  for (int c = 0; c < 256; c++) {
+    if (upper[c] >= 0) table[c] = upper[c];
+  }
+  return table;
+}();
+
+// Card id of a rank and a suit character, -1 if either is invalid.
+constexpr int CardIdOf(char rank, char suit) {
+  const int r = kRankIndex[static_cast<unsigned char>(rank)];
+  const int s = kSuitIndex[static_cast<unsigned char>(suit)];
+  return (r | s) < 0 ? -1 : r * 4 + s;
+}
+
 const static std::array<char, 13> rankReverseArray = {
     '2', '3', '4', '5', '6', '7', '8', '9', 'T', 'J', 'Q', 'K', 'A',
 };
@@ -29,29 +52,20 @@ const static std::array<char, 4> suitReverseArray = {'c', 'd', 'h', 's'};
 
 class Card {
  public:
-  Card() {} //default constructor
+  Card() = default; //default constructor, the deuce of clubs
 
   // Constructor that creates a Card from its integer id (0-51)
-  Card(int id) {
-    id_ = id;
-  }
+  constexpr Card(int id) : id_(id) {}
   //the id_(id) is the member variable of the class Card
 
-  Card(std::string name) { //this is the constructor that creates a Card from its string name
-    if (name.length() < 2) {
-      // TODO: throw an exception here (Done)
-      throw std::invalid_argument("Invalid Card Name");
-    }
+  // Constructors that create a Card from its name, like "As" for the ace of
+  // spades. Only the first two characters are read. The card id is
+  // rank_index * 4 + suit_index, so cards are ordered by rank, then suit.
+  Card(std::string_view name) : id_(ParseName(name)) {}
 
-    // This line converts a card's string name (like "As" for Ace of spades) into its unique integer id (0-51).
-    // - rankMap.at(name[0]) looks up the rank character (e.g., 'A' -> 12 for Ace) and gets its index (0-12).
-    // - suitMap.at(name[1]) looks up the suit character (e.g., 's' -> 3 for spades) and gets its index (0-3).
-    //  Multiplying the rank index by 4 allocates 4 consecutive ids for each rank (one for each suit). Adding the suit index (0-3) then selects the specific suit within that rank. This ensures every card (rank, suit) pair gets a unique id from 0 to 51.
-    //   id = rank_index * 4 + suit_index, so cards are ordered by rank, then suit.
-    id_ = rankMap.at(name[0]) * 4 + suitMap.at(name[1]);
-  }
+  Card(const std::string& name) : id_(ParseName(name)) {}
 
-  Card(const char* name) { *this = Card(std::string(name)); } //constructor that creates a Card from its string name
+  Card(const char* name) : id_(ParseName(name)) {}
 
   char describeRank(void) const { 
     int rank_index = id_ / 4;
@@ -77,16 +91,63 @@ class Card {
 
   //converts the Card object to an integer, which is the id_ of the card
   //expected input: Card object
-  operator int() const { return id_; }
+  constexpr operator int() const { return id_; }
 
   //converts the Card object to a string, which is the string representation of the card
   //expected input: Card object
   operator std::string() const { return describeCard(); }
 
  private:
-  int id_;
+  static int ParseName(std::string_view name) {
+    const int id = name.size() < 2 ? -1 : CardIdOf(name[0], name[1]);
+    if (id < 0) {
+      throw std::invalid_argument("Invalid Card Name");
+    }
+    return id;
+  }
+
+  static int ParseName(const char* name) {
+    // name[1] is only read when name[0] isn't the terminator
+    const int id = name[0] == '\0' ? -1 : CardIdOf(name[0], name[1]);
+    if (id < 0) {
+      throw std::invalid_argument("Invalid Card Name");
+    }
+    return id;
+  }
+
+  int id_ = 0;
 };
 
+/*
+ * Bulk parsing of hand strings like "AsKdQh" or "As Kd, Qh" into card ids,
+ * without exceptions or allocations. Cards are a rank and a suit character
+ * next to each other; spaces, tabs, newlines and commas between cards are
+ * skipped. Long runs of cards without separators are parsed 16 bytes at a
+ * time when the library is built with SSSE3.
+ */
+enum class ParseStatus : uint8_t {
+  kOk = 0,
+  kInvalidRank,   // a character that isn't a rank or a separator
+  kInvalidSuit,   // a rank followed by a character that isn't a suit
+  kMissingSuit,   // the text ends after a rank
+  kDuplicate,     // a card that was already parsed
+  kTooManyCards,  // more cards than the output can hold
+};
+
+struct ParseResult {
+  int count;          // cards parsed before the error, or all of them
+  size_t position;    // offset of the offending character, or text.size()
+  ParseStatus status;
+
+  explicit operator bool() const { return status == ParseStatus::kOk; }
+};
+
+// Writes at most `capacity` card ids to `cards`, in the order they appear.
+ParseResult ParseHand(std::string_view text, int* cards, size_t capacity);
+
+// Sets bit `id` of `mask` for every card; the mask is cleared first.
+ParseResult ParseHand(std::string_view text, uint64_t& mask);
+
 }  // namespace phevaluator: finish defining the Card class
 
 // This code specializes the std::hash template for the phevaluator::Card class,
@@ -1,21 +1,123 @@
 #pragma once
 #include <array>
+#include <cstdint>
 #include <vector>
 
-#ifdef __cplusplus
-extern "C" {
-#endif
+#include "hand.h"
 
 namespace card_sampler {
+
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2,
+// 3"): a keyed bijection of a 128-bit counter, so block i of a key can be
+// computed directly, without stepping through blocks 0 .. i-1.
+std::array<uint32_t, 4> Philox4x32(std::array<uint32_t, 4> counter,
+                                   std::array<uint32_t, 2> key);
+
+// xoshiro256++ (Blackman and Vigna): 256 bits of state, a period of 2^256 - 1
+// and a handful of adds, xors and rotates per 64-bit output.
+class Xoshiro256 {
+ public:
+  // Expands the seed into the state with splitmix64, so any seed works.
+  explicit Xoshiro256(uint64_t seed);
+
+  // Stream `stream` of `seed`: the state is two Philox blocks keyed by the
+  // seed at counters (0, stream) and (1, stream). The same pair always gives
+  // the same sequence, whichever thread asks for it and in which order.
+  static Xoshiro256 ForStream(uint64_t seed, uint64_t stream);
+
+  // Advances the state by 2^128 outputs, for splitting one sequence into
+  // non-overlapping runs of up to 2^128 draws.
+  void jump();
+
+  uint64_t operator()() {
+    const uint64_t result = rotl(s_[0] + s_[3], 23) + s_[0];
+    const uint64_t t = s_[1] << 17;
+    s_[2] ^= s_[0];
+    s_[3] ^= s_[1];
+    s_[1] ^= s_[2];
+    s_[0] ^= s_[3];
+    s_[2] ^= t;
+    s_[3] = rotl(s_[3], 45);
+    return result;
+  }
+
+  // Uniform in [0, range) without modulo bias (Lemire's multiply-shift
+  // reduction; the rejection loop runs with probability < range / 2^32).
+  uint32_t bounded(uint32_t range) {
+    uint64_t m = (operator()() >> 32) * range;
+    uint32_t low = static_cast<uint32_t>(m);
+    if (low < range) {
+      const uint32_t threshold = (0u - range) % range;
+      while (low < threshold) {
+        m = (operator()() >> 32) * range;
+        low = static_cast<uint32_t>(m);
+      }
+    }
+    return static_cast<uint32_t>(m >> 32);
+  }
+
+ private:
+  Xoshiro256() = default;
+
+  static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+  uint64_t s_[4];
+};
+
+/*
+ * Samples distinct cards from a 52-card deck with a partial Fisher-Yates
+ * shuffle. Each sampler owns its generator, so samplers can be used from
+ * different threads at the same time; a single sampler must not be shared
+ * between threads.
+ *
+ * Dead cards are given as a 64-bit mask with bit `id` set for card id; they
+ * are never drawn.
+ *
+ * For results that can be replayed, construct (or reseed) the sampler with a
+ * seed and a stream per unit of work, e.g. the index of the hand being
+ * simulated. A unit then draws the same cards on any thread and in any
+ * schedule, so totals are identical across thread counts as long as they
+ * are combined in unit order.
+ */
 class CardSampler {
-  std::array<int, 52> deck; //array of 52 integers, each representing a card
+  std::array<int, 52> deck; //the live cards, deck[0, live_count) are drawable
+  int live_count = 52;
+  uint64_t dead = 0; //the dead cards `deck` was built for
+  Xoshiro256 rng;
 
 public:
-  CardSampler(void); //constructor of the class; 
-  std::vector<int> sample(int size); 
+  CardSampler(void); //seeds from the clock and a per-process counter
+
+  // Draws from Xoshiro256::ForStream(seed, stream).
+  explicit CardSampler(uint64_t seed, uint64_t stream = 0);
+
+  // Restarts as if freshly constructed from seed and stream, including the
+  // deck order, without constructing a new sampler per unit of work.
+  void reseed(uint64_t seed, uint64_t stream);
+
+  std::vector<int> sample(int size);
+
+  // Writes `size` distinct card ids to out, no allocation.
+  void sample_into(int* out, int size) { sample_into(out, size, 0); }
+
+  // Same, never drawing a card in dead_cards. Throws std::invalid_argument if
+  // fewer than `size` cards are left.
+  void sample_into(int* out, int size, uint64_t dead_cards);
+
+  // Mask of `size` distinct cards outside dead_cards.
+  uint64_t sample_mask(int size, uint64_t dead_cards = 0);
+
+  // Fills hand with N distinct cards outside dead_cards.
+  template <int N>
+  void sample_into(phevaluator::Hand<N>& hand, uint64_t dead_cards = 0) {
+    int ids[N];
+    sample_into(ids, N, dead_cards);
+    hand = phevaluator::Hand<N>(ids);
+  }
+
+  Xoshiro256& generator() { return rng; }
+
+private:
+  void setDeadCards(uint64_t dead_cards);
 };
 }  // namespace card_sampler
-
-#ifdef __cplusplus
-}  // closing brace for extern "C"
-#endif
\ No newline at end of file
@@ -0,0 +1,145 @@
+#ifndef PHEVALUATOR_COMBINATIONS_H
+#define PHEVALUATOR_COMBINATIONS_H
+#ifdef __cplusplus
+#include <cstdint>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace phevaluator {
+
+/*
+ * The k-card subsets of the deck without the dead cards, for k from 1 to 9,
+ * numbered 0 .. size() - 1. A subset is a card mask (bit id set for card
+ * id).
+ *
+ * Subsets are numbered in colexicographic order of their positions in the
+ * live deck: the subset at positions p1 < p2 < .. < pk has index
+ * C(p1, 1) + C(p2, 2) + .. + C(pk, k), computed with the choose[53][10]
+ * table the evaluators use. In this order the next subset is the next
+ * larger mask with k bits (Gosper's hack), so a walk costs a few bit
+ * operations per subset, and any index can be turned back into its subset
+ * and walked from there.
+ *
+ * That makes exhaustive loops splittable and resumable: shard(i, n) is the
+ * i-th of n near-equal index ranges, and a job that records the index it
+ * reached can restart from it with forEach(index, end, ...).
+ */
+class Combinations {
+ public:
+  static const int kMaxCards = 9;
+
+  // Throws std::invalid_argument if k is outside [1, 9] or there are fewer
+  // than k live cards.
+  explicit Combinations(int k, uint64_t dead_cards = 0);
+
+  int k() const { return k_; }
+  int liveCards() const { return live_; }
+  uint64_t deadCards() const { return dead_; }
+
+  // C(liveCards(), k)
+  uint64_t size() const { return size_; }
+
+  // Index of a subset. Throws std::invalid_argument unless mask has k
+  // live cards and no dead ones.
+  uint64_t rank(uint64_t mask) const;
+
+  // Subset at an index below size(); throws std::out_of_range otherwise.
+  uint64_t unrank(uint64_t index) const;
+
+  // The subset after mask, or 0 after the last one.
+  uint64_t next(uint64_t mask) const {
+    const uint64_t position = gosper(compress(mask));
+    return position >> live_ ? 0 : expand(position);
+  }
+
+  struct Range {
+    uint64_t begin;
+    uint64_t end;
+  };
+
+  // Indices of shard i of `shards`, which together cover [0, size()) and
+  // differ in length by at most one.
+  Range shard(uint64_t i, uint64_t shards) const {
+    return Range{size_ * i / shards, size_ * (i + 1) / shards};
+  }
+
+  // Calls visit(mask) for the subsets with indices in [begin, end).
+  template <class Visit>
+  void forEach(uint64_t begin, uint64_t end, Visit&& visit) const {
+    if (begin >= end) return;
+    uint64_t position = compress(unrank(begin));
+    if (dead_ == 0) {
+      for (uint64_t i = begin; i < end; i++) {
+        visit(position);
+        position = gosper(position);
+      }
+    } else {
+      for (uint64_t i = begin; i < end; i++) {
+        visit(expand(position));
+        position = gosper(position);
+      }
+    }
+  }
+
+  template <class Visit>
+  void forEach(Visit&& visit) const {
+    forEach(0, size_, visit);
+  }
+
+  // Writes the card ids of mask in increasing order and returns how many.
+  static int Cards(uint64_t mask, int* cards) {
+    int n = 0;
+    for (; mask; mask &= mask - 1) cards[n++] = __builtin_ctzll(mask);
+    return n;
+  }
+
+ private:
+  // Next larger integer with the same number of bits
+  static uint64_t gosper(uint64_t x) {
+    const uint64_t low = x & (0 - x);
+    const uint64_t ripple = x + low;
+    return ripple | (((x ^ ripple) >> 2) >> __builtin_ctzll(x));
+  }
+
+  // Card mask to the mask of live deck positions, and back
+  uint64_t compress(uint64_t mask) const {
+    if (dead_ == 0) return mask;
+#if defined(__BMI2__)
+    return _pext_u64(mask, live_mask_);
+#else
+    uint64_t position = 0;
+    for (; mask; mask &= mask - 1) {
+      const int card = __builtin_ctzll(mask);
+      position |= uint64_t(1) << (card - dead_below_[card]);
+    }
+    return position;
+#endif
+  }
+
+  uint64_t expand(uint64_t position) const {
+    if (dead_ == 0) return position;
+#if defined(__BMI2__)
+    return _pdep_u64(position, live_mask_);
+#else
+    uint64_t mask = 0;
+    for (; position; position &= position - 1) {
+      mask |= uint64_t(1) << live_cards_[__builtin_ctzll(position)];
+    }
+    return mask;
+#endif
+  }
+
+  int k_;
+  int live_;
+  uint64_t dead_;
+  uint64_t live_mask_;
+  uint64_t size_;
+  uint8_t live_cards_[52];  // card id at each live position
+  uint8_t dead_below_[52];  // dead cards with a lower id
+};
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_COMBINATIONS_H
@@ -0,0 +1,200 @@
+#ifndef PHEVALUATOR_DEALER_H
+#define PHEVALUATOR_DEALER_H
+#ifdef __cplusplus
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "card_sampler.h"
+#include "hand.h"
+
+namespace card_sampler {
+
+const int kDealMaxPlayers = 10;
+const int kDealMaxHoleCards = 6;
+const int kDealMaxBoardCards = 5;
+
+// One deal, in fixed-size storage so it can live on the stack or in an array
+// without allocations. Only the first players() rows and hole_cards()
+// columns of `hole`, and the first board_cards() entries of `board`, are set.
+struct Deal {
+  uint8_t hole[kDealMaxPlayers][kDealMaxHoleCards];
+  uint8_t board[kDealMaxBoardCards];
+  uint64_t mask;  // every dealt card, without the dead cards
+
+  // Sets cards[] to the board, then the player's hole cards, and returns
+  // the number of cards written, for passing to an evaluator.
+  int cardsOf(int player, int board_cards, int hole_cards, int* cards) const {
+    int n = 0;
+    for (int i = 0; i < board_cards; i++) cards[n++] = board[i];
+    for (int i = 0; i < hole_cards; i++) cards[n++] = hole[player][i];
+    return n;
+  }
+
+  // The player's hole cards, for a deal with N hole cards per player
+  template <int N>
+  phevaluator::Hand<N> holeOf(int player) const {
+    int ids[N];
+    for (int i = 0; i < N; i++) ids[i] = hole[player][i];
+    return phevaluator::Hand<N>(ids);
+  }
+
+  phevaluator::Board boardOf(int board_cards) const {
+    int ids[kDealMaxBoardCards];
+    for (int i = 0; i < board_cards; i++) ids[i] = board[i];
+    return phevaluator::Board(ids, board_cards);
+  }
+};
+
+// A weighted list of starting hands with the same number of cards each.
+class HandRange {
+ public:
+  struct Combo {
+    std::array<uint8_t, kDealMaxHoleCards> cards;
+    uint64_t mask;
+    double weight;
+  };
+
+  explicit HandRange(int hole_cards);
+
+  // Adds a hand with a positive weight; throws std::invalid_argument for an
+  // invalid or repeated card, or a weight that isn't positive.
+  void add(const int* cards, double weight = 1.0);
+
+  int holeCards() const { return hole_cards_; }
+  const std::vector<Combo>& combos() const { return combos_; }
+
+ private:
+  int hole_cards_;
+  std::vector<Combo> combos_;
+};
+
+/*
+ * Deals the hole cards of up to kDealMaxPlayers players and a board in one
+ * call. A player either gets uniformly random cards or a hand drawn from a
+ * HandRange in proportion to its weights, through an alias table (one
+ * bounded draw and one compare per pick).
+ *
+ * Ranged players are dealt first, in player order. A pick that collides with
+ * the dead cards or an earlier player's hand is redrawn for that player
+ * only; the whole deal restarts only if a player can't find a hand after
+ * kMaxRedraws picks. This conditions each player on the hands dealt before
+ * it rather than rejecting whole deals, which is what makes multiway range
+ * deals cheap; with heavy overlaps between ranges the joint distribution
+ * leans slightly towards the earlier players' weights.
+ *
+ * Random players and the board are then drawn from the cards that are left.
+ */
+class Dealer {
+ public:
+  static const int kMaxRedraws = 64;
+  static const int kMaxRestarts = 1000;
+
+  // Throws std::invalid_argument if the cards don't fit in Deal or a deck.
+  Dealer(int players, int hole_cards, int board_cards);
+  Dealer(int players, int hole_cards, int board_cards, uint64_t seed,
+         uint64_t stream = 0);
+
+  // Draws the player's hand from range, which must have hole_cards() cards.
+  void setRange(int player, const HandRange& range);
+
+  // Deals the player uniformly random cards again.
+  void clearRange(int player);
+
+  void setDeadCards(uint64_t dead_cards) { dead_ = dead_cards; }
+
+  // See CardSampler::reseed
+  void reseed(uint64_t seed, uint64_t stream) { sampler_.reseed(seed, stream); }
+
+  // Fills deal. Throws std::runtime_error if the ranges and dead cards leave
+  // no possible deal after kMaxRestarts attempts.
+  void deal(Deal& deal);
+
+  int players() const { return players_; }
+  int holeCards() const { return hole_cards_; }
+  int boardCards() const { return board_cards_; }
+
+ private:
+  // A range prepared for sampling: Vose's alias method, with the keep
+  // probability scaled to 32 bits.
+  struct AliasTable {
+    std::vector<HandRange::Combo> combos;
+    std::vector<uint32_t> keep;
+    std::vector<uint32_t> alias;
+  };
+
+  static AliasTable BuildAliasTable(const HandRange& range);
+
+  void checkLayout() const;
+
+  bool tryDeal(Deal& deal);
+
+  int players_;
+  int hole_cards_;
+  int board_cards_;
+  uint64_t dead_ = 0;
+  CardSampler sampler_;
+  std::vector<AliasTable> ranges_;  // empty combos for a random player
+};
+
+/*
+ * Deals every player a hand from its own HandRange, with the exact joint
+ * distribution: a deal has probability proportional to the product of its
+ * hands' weights, over the deals whose hands don't share a card. This is
+ * the distribution of the Dealer's ranged players without its lean towards
+ * the earlier players, for callers whose ranges overlap heavily.
+ *
+ * Hands that use a dead card are dropped up front. Players 0 and 1 are
+ * drawn together from one alias table over their compatible pairs of
+ * hands, weighted by the product of the two weights, when there are at
+ * most kMaxPairs of those; so narrow ranges heads-up never redraw.
+ * Everyone else is drawn from their own alias table, and a deal with a
+ * shared card is redrawn whole, which keeps the joint distribution exact.
+ *
+ * The dealer is immutable once built and draws from the caller's generator,
+ * so one can be shared by any number of threads.
+ */
+class RangeDealer {
+ public:
+  static const size_t kMaxPairs = size_t(1) << 16;
+  static const int kMaxAttempts = 1 << 16;
+
+  // Throws std::invalid_argument for no players, more than kDealMaxPlayers
+  // or ranges with different numbers of hole cards, and std::runtime_error
+  // if no deal is possible.
+  explicit RangeDealer(const std::vector<HandRange>& ranges,
+                       uint64_t dead_cards = 0);
+
+  // Sets the hole cards of every player and deal.mask to the cards dealt.
+  // Throws std::runtime_error if kMaxAttempts deals in a row share a card.
+  void deal(Xoshiro256& rng, Deal& deal) const;
+
+  int players() const { return static_cast<int>(tables_.size()); }
+  int holeCards() const { return hole_cards_; }
+  // Whether players 0 and 1 come from one table of pairs
+  bool pairsJoined() const { return !pairs_.empty(); }
+
+ private:
+  struct Table {
+    std::vector<HandRange::Combo> combos;
+    std::vector<uint32_t> keep;
+    std::vector<uint32_t> alias;
+
+    uint32_t draw(Xoshiro256& rng) const {
+      const uint32_t i = rng.bounded(static_cast<uint32_t>(keep.size()));
+      return static_cast<uint32_t>(rng()) < keep[i] ? i : alias[i];
+    }
+  };
+
+  int hole_cards_;
+  std::vector<Table> tables_;
+  // With pairsJoined(), the hands of players 0 and 1 for each entry of
+  // pair_table_, which only uses keep and alias
+  std::vector<std::array<uint32_t, 2>> pairs_;
+  Table pair_table_;
+};
+
+}  // namespace card_sampler
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_DEALER_H
@@ -0,0 +1,228 @@
+#ifndef PHEVALUATOR_EQUITY_H
+#define PHEVALUATOR_EQUITY_H
+#ifdef __cplusplus
+#include <cstdint>
+#include <vector>
+
+#include "dealer.h"
+#include "hand.h"
+#include "parallel.h"
+#include "range.h"
+
+namespace phevaluator {
+
+/*
+ * Evaluates 7-card hands that share a 5-card board. The board is worked out
+ * once: its flush suit, if any, and partial sums of the rank hash, so each
+ * pair of hole cards costs a flush check and a few lookups at its own two
+ * ranks instead of a full 7-card evaluation.
+ *
+ * evaluate(a, b) is the same as evaluate_7cards with the board's cards and
+ * a and b. One evaluator can be reused for any number of boards; it reads
+ * the NUMA replica (see numa.h) of the thread that constructed it.
+ */
+class BoardEvaluator {
+ public:
+  BoardEvaluator();
+  explicit BoardEvaluator(const uint8_t board[5]) : BoardEvaluator() {
+    setBoard(board);
+  }
+
+  void setBoard(const uint8_t board[5]);
+
+  int evaluate(int a, int b) const;
+
+ private:
+  static int Term(int count, int rank, int k);
+
+  int flush_suit_ = -1;  // the suit with 3 or more board cards
+  int flush_count_ = 0;
+  int flush_binary_ = 0;  // ranks of the board's cards of that suit
+  unsigned char quinary_[13] = {};  // board cards of each rank
+  unsigned char below_[13] = {};    // board cards of lower ranks
+  int prefix7_[14] = {};
+  int prefix6_[14] = {};
+  int suffix5_[14] = {};
+  const short* noflush7_;
+};
+
+struct EquityPlayerResult {
+  double win = 0;     // share of runouts won outright
+  double tie = 0;     // share of runouts split with others
+  double equity = 0;  // average share of the pot, ties split evenly
+  double std_error = 0;
+};
+
+struct EquityResult {
+  uint64_t trials = 0;  // trials run, or runouts for an exact result
+  uint64_t evaluated = 0;  // runouts whose hands were evaluated
+  std::vector<EquityPlayerResult> players;
+};
+
+// How EquityCalculator::calculate picks the runouts of the board. Every
+// mode but kPlain numbers the runouts left after the known cards with
+// Combinations and picks indices within each chunk of trials:
+enum class EquitySampling {
+  kPlain,       // independent random runouts
+  kStratified,  // one from each of the chunk's equal slices of indices
+  kAntithetic,  // pairs at indices u and size - 1 - u, with the same hands
+  kQuasiRandom  // a van der Corput (one-dimensional Sobol) sequence,
+                // scrambled by a random digital shift per chunk
+};
+
+struct EquityOptions {
+  uint64_t trials = 100000;
+  uint64_t seed = 0;
+  // Runs with the same seed and stream deal the same cards
+  uint64_t stream = 0;
+  // Trials per unit of work, each dealt from its own random stream
+  uint64_t chunk_trials = 4096;
+  // Board cards at the showdown, 3 to 5; fewer than 5 compares the hands
+  // as they stand on the flop or turn
+  int board_cards = 5;
+  // Stops before `trials` once every player's std_error is at most this;
+  // 0 runs every trial. For a 95% confidence interval of +-w, use w / 1.96.
+  double target_std_error = 0;
+  // Runouts for calculate; CalculateStartingHandGrid always samples plainly.
+  // The other modes take std_error from the spread of the chunks' results,
+  // which are independent, or from the trials with a single chunk.
+  EquitySampling sampling = EquitySampling::kPlain;
+};
+
+/*
+ * Monte Carlo Hold'em equity for 2 to 10 players. Each player holds known
+ * cards, a hand drawn from a HandRange or random cards, and the board is
+ * completed from the cards that are left after the known board, the dead
+ * cards and the players' hands.
+ *
+ * The ranged players are dealt together by a card_sampler::RangeDealer, so
+ * card removal between their ranges is exact however much they overlap;
+ * heads-up, narrow ranges are drawn from a table of their compatible pairs
+ * and never redrawn. Random players are dealt around them.
+ *
+ * Trials run in chunks on a ThreadPool, or on the calling thread without
+ * one. Chunk i always draws from stream i of the seed, and pot shares are
+ * added up as whole numbers, so a result depends only on the options, not
+ * on the pool or its thread count. The trial loop doesn't allocate.
+ *
+ * With a target standard error the chunks run in rounds. Each worker adds
+ * to its own tally without locks; between rounds the tallies are summed,
+ * and the next round is sized from the error so far to just reach the
+ * target, at most doubling the trials run. The rounds depend only on the
+ * results, so an early stop is as repeatable as a full run.
+ */
+class EquityCalculator {
+ public:
+  static const int kMinPlayers = 2;
+  static const int kMaxPlayers = 10;
+
+  // Throws std::invalid_argument for fewer than 2 or more than 10 players.
+  explicit EquityCalculator(int players);
+
+  // Throw std::invalid_argument for a player out of range or a range that
+  // isn't of 2 card hands.
+  void setHand(int player, const Hand<2>& hand);
+  void setRange(int player, const card_sampler::HandRange& range);
+  void setRange(int player, const HoldemRange& range) {
+    setRange(player, range.toHandRange());
+  }
+  void setRandom(int player);
+
+  void setBoard(const Board& board) { board_ = board; }
+  void setDeadCards(uint64_t dead_cards) { dead_ = dead_cards; }
+
+  int players() const { return players_; }
+
+  // Throws std::invalid_argument if known cards overlap, the board has
+  // more than options.board_cards cards or the target is negative, and
+  // std::runtime_error if the ranges leave no possible deal.
+  EquityResult calculate(const EquityOptions& options,
+                         ThreadPool* pool = nullptr) const;
+
+  // Exact equity over every runout of the board, for players who all hold
+  // known cards; throws std::invalid_argument otherwise.
+  //
+  // Runouts that differ only by a permutation of suits which maps every
+  // hand, the board and the dead cards onto themselves (e.g. swapping
+  // clubs and diamonds for AcAd against KhKs) have the same outcome, so
+  // only the least runout of each such class is evaluated and counted
+  // once per member. Counts are whole numbers, so the result is exactly
+  // that of evaluating every runout.
+  EquityResult enumerate(ThreadPool* pool = nullptr) const;
+
+ private:
+  enum class Seat { kRandom, kKnown, kRange };
+
+  // Checks the known cards and returns them with the dead cards and board
+  uint64_t knownCards() const;
+
+  int players_;
+  std::vector<Seat> seats_;
+  std::vector<Hand<2>> hands_;
+  std::vector<card_sampler::HandRange> ranges_;
+  Board board_;
+  uint64_t dead_ = 0;
+};
+
+/*
+ * Equity of every starting hand class against random opponents, laid out
+ * like the usual 13 x 13 chart: cell [i][j] holds the hands of ranks 12 - i
+ * and 12 - j, suited above the diagonal (i < j), offsuit below it and pairs
+ * on it.
+ */
+struct StartingHandGrid {
+  static const int kSize = 13;
+
+  uint64_t trials = 0;
+  EquityPlayerResult cells[kSize][kSize];
+};
+
+// The grid for a hand against `opponents` random hands, 1 to 9, with
+// options as for EquityCalculator::calculate; a target standard error
+// applies to every cell.
+//
+// Every trial deals the opponents and the board once and plays them
+// against one hand of each of the 169 classes, drawn at random from the
+// class's hands that don't use a dealt card. The trial counts for the class
+// in proportion to how many such hands there are, which makes each cell an
+// unbiased estimate of the hand against opponents dealt around it. All
+// cells share the same deals, so their noise is correlated and differences
+// between cells settle far sooner than with 169 independent runs, at about
+// the cost of one. Throws std::invalid_argument like calculate.
+StartingHandGrid CalculateStartingHandGrid(int opponents,
+                                           const EquityOptions& options,
+                                           ThreadPool* pool = nullptr);
+
+/*
+ * Exact equity of one Hold'em range against another on a flop, turn or
+ * river, over every deal of the two hands and every runout of the board,
+ * each pair of hands that don't share a card counted in proportion to the
+ * product of their weights.
+ */
+struct RangeEquity {
+  uint64_t runouts = 0;  // boards from the cards not on the board or dead
+  EquityPlayerResult players[2];  // std_error is 0
+  // Each hand's equity against the other range, by HoldemRange index; 0 for
+  // a hand outside the range or one that no hand of the other range allows
+  std::vector<double> hands[2];
+};
+
+// Every runout is handled by a ShowdownTable (showdown.h) of the live hands
+// of the two ranges: each is evaluated once and sorted by rank, and a sweep
+// from the weakest up finds what every hand beats and ties in the other
+// range, less the hands that share one of its cards, so a runout costs
+// O(n) for n hands instead of a comparison of every pair. Runouts are split
+// into a fixed number of parts, so the result is the same on any pool.
+//
+// Throws std::invalid_argument for a board of fewer than 3 cards or one
+// that overlaps the dead cards, and std::runtime_error if no pair of hands
+// can be dealt.
+RangeEquity EnumerateRangeEquity(const HoldemRange& hero,
+                                 const HoldemRange& villain, const Board& board,
+                                 uint64_t dead_cards = 0,
+                                 ThreadPool* pool = nullptr);
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_EQUITY_H
@@ -0,0 +1,217 @@
+#ifndef PHEVALUATOR_EQUITY_JOB_H
+#define PHEVALUATOR_EQUITY_JOB_H
+#ifdef __cplusplus
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+#include "dealer.h"
+#include "hand.h"
+
+namespace phevaluator {
+
+// A running mean of per-trial equity shares in [0, 1], with its standard
+// error. Accumulators of disjoint trials can be merged.
+class EquityAccumulator {
+ public:
+  void add(double share) {
+    trials_++;
+    sum_ += share;
+    sum_squares_ += share * share;
+  }
+
+  void merge(const EquityAccumulator& other) {
+    trials_ += other.trials_;
+    sum_ += other.sum_;
+    sum_squares_ += other.sum_squares_;
+  }
+
+  uint64_t trials() const { return trials_; }
+
+  double mean() const { return trials_ ? sum_ / trials_ : 0.0; }
+
+  // Standard error of the mean, 0 before the second trial
+  double stdError() const {
+    if (trials_ < 2) return 0.0;
+    const double mean = sum_ / trials_;
+    const double variance =
+        (sum_squares_ - trials_ * mean * mean) / (trials_ - 1);
+    return variance > 0 ? std::sqrt(variance / trials_) : 0.0;
+  }
+
+ private:
+  uint64_t trials_ = 0;
+  double sum_ = 0;
+  double sum_squares_ = 0;
+};
+
+struct EquityEstimate {
+  uint64_t trials = 0;
+  double equity = 0;
+  double std_error = 0;
+};
+
+enum class JobStatus {
+  kRunning,
+  kComplete,   // ran max_trials trials
+  kDeadline,   // stopped at the deadline
+  kCancelled,  // stopped by cancel() or the job's CancelFlag
+};
+
+struct JobResult {
+  EquityEstimate estimate;
+  JobStatus status = JobStatus::kRunning;
+};
+
+// A shared stop request. Copies refer to the same flag, so one flag can be
+// given to every job serving a request and cancel them together.
+class CancelFlag {
+ public:
+  CancelFlag() : flag_(std::make_shared<std::atomic<bool>>(false)) {}
+
+  void cancel() { flag_->store(true, std::memory_order_relaxed); }
+  bool cancelled() const { return flag_->load(std::memory_order_relaxed); }
+
+ private:
+  std::shared_ptr<std::atomic<bool>> flag_;
+};
+
+struct JobOptions {
+  // Iteration limit; the job is complete after this many trials.
+  uint64_t max_trials = 1000000;
+
+  // Time limit; the job stops with the estimate so far once it passes.
+  std::chrono::steady_clock::time_point deadline =
+      std::chrono::steady_clock::time_point::max();
+
+  CancelFlag cancel;
+
+  // Trials between checks of the deadline and the cancel flag. Work runs in
+  // chunks of this many trials, so it bounds how late a job stops.
+  uint64_t chunk_trials = 1024;
+
+  // Called from the job's thread with the estimate so far, at most once per
+  // progress_interval and never concurrently with itself.
+  std::function<void(const EquityEstimate&)> on_progress;
+  std::chrono::steady_clock::duration progress_interval =
+      std::chrono::milliseconds(100);
+
+  uint64_t seed = 0;
+};
+
+// The work behind a job: runs trials first .. first + count - 1 and adds
+// one equity share per trial to acc. Monte Carlo work can ignore the trial
+// numbers; enumeration work uses them to pick its slice of the outcomes.
+using JobWork = std::function<void(uint64_t first, uint64_t count,
+                                   EquityAccumulator& acc)>;
+
+/*
+ * A job running on its own thread. The result is available as a future, by
+ * polling progress(), or, in C++20, by co_await-ing the job.
+ *
+ * Work is cancelled cooperatively: the job checks cancel(), its CancelFlag
+ * and the deadline between chunks and then completes normally with the
+ * estimate so far, so a cancelled or timed out job still has a usable
+ * result. An exception thrown by the work is delivered through the future.
+ *
+ * Destroying a job that is still running cancels it and waits for it.
+ */
+class EquityJob {
+ public:
+  EquityJob(JobWork work, JobOptions options);
+  ~EquityJob();
+
+  EquityJob(EquityJob&&) = default;
+  EquityJob& operator=(EquityJob&&) = delete;
+
+  // Stops this job only, unlike cancelling the CancelFlag it was given.
+  void cancel() { state_->stop.store(true, std::memory_order_relaxed); }
+
+  // The latest estimate, updated after every chunk
+  EquityEstimate progress() const;
+
+  bool done() const { return state_->done.load(std::memory_order_acquire); }
+
+  // Can be called any number of times, from any thread.
+  std::shared_future<JobResult> future() const { return state_->future; }
+
+  JobResult get() const { return state_->future.get(); }
+
+  // Runs callback once the job finishes, on the job's thread, or right away
+  // on the caller's if it already has.
+  void then(std::function<void()> callback);
+
+#if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)
+  auto operator co_await() const {
+    struct Awaiter {
+      State* state;
+      bool await_ready() const {
+        return state->done.load(std::memory_order_acquire);
+      }
+      bool await_suspend(std::coroutine_handle<> handle) const {
+        return AddContinuation(state, [handle] { handle.resume(); });
+      }
+      JobResult await_resume() const { return state->future.get(); }
+    };
+    return Awaiter{state_.get()};
+  }
+#endif
+
+ private:
+  struct State {
+    JobOptions options;
+    mutable std::mutex mutex;
+    EquityEstimate estimate;  // under mutex
+    std::vector<std::function<void()>> continuations;  // under mutex
+    std::atomic<bool> stop{false};
+    std::atomic<bool> done{false};
+    std::promise<JobResult> promise;
+    std::shared_future<JobResult> future;
+  };
+
+  // Queues callback, or returns false if the job has already finished.
+  static bool AddContinuation(State* state, std::function<void()> callback);
+
+  static void Run(State* state, const JobWork& work);
+
+  std::unique_ptr<State> state_;
+  std::thread thread_;
+};
+
+// What to estimate: the share of the pot the hero's hole cards win on
+// average against opponents with random hands, or hands from a range where
+// one is given, with the rest of the board dealt at random. A tie between
+// k best hands gives each 1 / k.
+struct EquityQuery {
+  Hand<2> hero;
+  Board board;  // 0 to 5 known cards
+  int opponents = 1;
+  // Ranges of the first ranges.size() opponents, up to opponents
+  std::vector<card_sampler::HandRange> ranges;
+};
+
+// Monte Carlo work for query, seeded with seed. Throws std::invalid_argument
+// for a query that doesn't fit a deal.
+JobWork MakeEquityWork(const EquityQuery& query, uint64_t seed);
+
+// Starts a Monte Carlo job for query, seeded with options.seed.
+inline EquityJob StartEquityJob(const EquityQuery& query,
+                                JobOptions options = {}) {
+  JobWork work = MakeEquityWork(query, options.seed);
+  return EquityJob(std::move(work), std::move(options));
+}
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_EQUITY_JOB_H
@@ -0,0 +1,175 @@
+#ifndef PHEVALUATOR_EVALUATE_H
+#define PHEVALUATOR_EVALUATE_H
+#ifdef __cplusplus
+#include <array>
+#include <cstddef>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#include "card.h"
+#include "hand.h"
+
+namespace phevaluator {
+
+/*
+ * Header-only versions of evaluate_5cards .. evaluate_9cards.
+ *
+ * Evaluate<N> reads the same tables as the C evaluators, compiled in here
+ * as constexpr arrays, so a call inlines into the caller's loop and can run
+ * at compile time, e.g. to fill a static lookup table:
+ *
+ *   constexpr std::array<int, 7> royal = {48, 44, 40, 36, 32, 0, 1};
+ *   static_assert(phevaluator::Evaluate<7>(royal) == 1);
+ *
+ * The result is the rank value, 1 (best) to 7462, the same as
+ * Rank::value() of the matching EvaluateCards overload.
+ *
+ * Including this header parses about 3MB of tables, so keep it to the
+ * translation units that evaluate. The arrays are inline variables and are
+ * only emitted once per binary, and only when used at run time.
+ */
+
+namespace detail {
+
+inline constexpr short kFlush[8192] = {
+#include "tables/flush.inc"
+};
+
+inline constexpr short kNoflush5[6175] = {
+#include "tables/noflush5.inc"
+};
+
+inline constexpr short kNoflush6[18395] = {
+#include "tables/noflush6.inc"
+};
+
+inline constexpr short kNoflush7[49205] = {
+#include "tables/noflush7.inc"
+};
+
+inline constexpr short kNoflush8[120055] = {
+#include "tables/noflush8.inc"
+};
+
+inline constexpr short kNoflush9[270270] = {
+#include "tables/noflush9.inc"
+};
+
+inline constexpr int kDp[5][14][10] = {
+#include "tables/dp.inc"
+};
+
+// The noflush table of each supported hand size; other sizes don't compile.
+template <int N>
+struct Noflush;
+
+template <>
+struct Noflush<5> {
+  static constexpr const short* table = kNoflush5;
+};
+template <>
+struct Noflush<6> {
+  static constexpr const short* table = kNoflush6;
+};
+template <>
+struct Noflush<7> {
+  static constexpr const short* table = kNoflush7;
+};
+template <>
+struct Noflush<8> {
+  static constexpr const short* table = kNoflush8;
+};
+template <>
+struct Noflush<9> {
+  static constexpr const short* table = kNoflush9;
+};
+
+// hash_quinary from math/hash/hash.c
+constexpr int HashQuinary(const unsigned char q[13], int k) {
+  int sum = 0;
+  for (int i = 0; i < 13; i++) {
+    sum += kDp[q[i]][12 - i][k];
+    k -= q[i];
+    if (k <= 0) break;
+  }
+  return sum;
+}
+
+template <int N, class Id>
+constexpr int EvaluateIds(const Id* cards) {
+  // Counting suits directly rather than through the suits table, which the
+  // C evaluators only use up to 8 cards.
+  int suit_count[4] = {};
+  for (int i = 0; i < N; i++) suit_count[static_cast<int>(cards[i]) & 0x3]++;
+
+  int suit = -1;
+  for (int s = 0; s < 4; s++) {
+    if (suit_count[s] >= 5) suit = s;
+  }
+
+  int value_flush = 10000;
+  if (suit >= 0) {
+    int suit_binary = 0;
+    for (int i = 0; i < N; i++) {
+      const int id = static_cast<int>(cards[i]);
+      if ((id & 0x3) == suit) suit_binary |= 1 << (id >> 2);
+    }
+    value_flush = kFlush[suit_binary];
+
+    // Up to 7 cards, a flush beats anything the other cards can make.
+    if (N <= 7) return value_flush;
+  }
+
+  unsigned char quinary[13] = {};
+  for (int i = 0; i < N; i++) quinary[static_cast<int>(cards[i]) >> 2]++;
+
+  const int value_noflush = Noflush<N>::table[HashQuinary(quinary, N)];
+  return value_flush < value_noflush ? value_flush : value_noflush;
+}
+
+}  // namespace detail
+
+// Evaluates the first N card ids (N from 5 to 9).
+template <int N>
+constexpr int Evaluate(const int* cards) {
+  return detail::EvaluateIds<N>(cards);
+}
+
+template <int N>
+constexpr int Evaluate(const Card* cards) {
+  return detail::EvaluateIds<N>(cards);
+}
+
+template <std::size_t N>
+constexpr int Evaluate(const std::array<int, N>& cards) {
+  return detail::EvaluateIds<static_cast<int>(N)>(cards.data());
+}
+
+template <std::size_t N>
+constexpr int Evaluate(const std::array<Card, N>& cards) {
+  return detail::EvaluateIds<static_cast<int>(N)>(cards.data());
+}
+
+template <int N>
+constexpr int Evaluate(const Hand<N>& hand) {
+  return detail::EvaluateIds<N>(hand.data());
+}
+
+#if __cplusplus >= 202002L
+// Evaluates the first N cards of the span, which must hold at least N.
+template <int N>
+constexpr int Evaluate(std::span<const int> cards) {
+  return detail::EvaluateIds<N>(cards.data());
+}
+
+template <int N>
+constexpr int Evaluate(std::span<const Card> cards) {
+  return detail::EvaluateIds<N>(cards.data());
+}
+#endif
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_EVALUATE_H
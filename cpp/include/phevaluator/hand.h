@@ -0,0 +1,230 @@
+#ifndef PHEVALUATOR_HAND_H
+#define PHEVALUATOR_HAND_H
+#ifdef __cplusplus
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "card.h"
+#include "phevaluator.h"
+#include "rank.h"
+
+namespace phevaluator {
+
+/*
+ * Hand<N> holds exactly N distinct cards, one byte each, together with their
+ * 64-bit mask (bit id set for card id). It is trivially copyable and 16
+ * bytes for N up to 8, so a batch is one contiguous array rather than a
+ * vector of vectors, and it can be memcpy'd, written to a file or shared
+ * across an FFI boundary as is.
+ *
+ * Board holds the community cards dealt so far, 0 to 5, the same way.
+ *
+ * The constructors throw std::invalid_argument for ids outside [0, 52), a
+ * repeated card or the wrong number of cards.
+ */
+template <int N>
+class Hand {
+  static_assert(N >= 1 && N <= 52, "A hand holds 1 to 52 cards");
+
+ public:
+  constexpr Hand() = default;
+
+  constexpr explicit Hand(const int* ids) {
+    for (int i = 0; i < N; i++) set(i, ids[i]);
+  }
+
+  constexpr explicit Hand(const std::array<int, N>& ids) : Hand(ids.data()) {}
+
+  constexpr Hand(std::initializer_list<Card> cards) {
+    if (cards.size() != N) {
+      throw std::invalid_argument("Wrong number of cards");
+    }
+    int i = 0;
+    for (const Card& card : cards) set(i++, static_cast<int>(card));
+  }
+
+  // Parses a string like "AsKd" through ParseHand.
+  static Hand Parse(std::string_view text) {
+    int ids[N];
+    const ParseResult result = ParseHand(text, ids, N);
+    if (!result || result.count != N) {
+      throw std::invalid_argument("Invalid hand");
+    }
+    return Hand(ids);
+  }
+
+  static constexpr int size() { return N; }
+
+  constexpr Card operator[](int i) const { return Card(cards_[i]); }
+
+  // Card ids in the order they were given
+  constexpr const uint8_t* begin() const { return cards_; }
+  constexpr const uint8_t* end() const { return cards_ + N; }
+  constexpr const uint8_t* data() const { return cards_; }
+
+  constexpr uint64_t mask() const { return mask_; }
+
+  constexpr bool contains(Card card) const {
+    return (mask_ >> static_cast<int>(card)) & 1;
+  }
+
+  constexpr bool overlaps(uint64_t mask) const { return (mask_ & mask) != 0; }
+
+  constexpr std::array<int, N> ids() const {
+    std::array<int, N> ids{};
+    for (int i = 0; i < N; i++) ids[i] = cards_[i];
+    return ids;
+  }
+
+  std::string describe() const {
+    std::string name;
+    for (int i = 0; i < N; i++) name += Card(cards_[i]).describeCard();
+    return name;
+  }
+
+  constexpr bool operator==(const Hand& other) const {
+    for (int i = 0; i < N; i++) {
+      if (cards_[i] != other.cards_[i]) return false;
+    }
+    return true;
+  }
+  constexpr bool operator!=(const Hand& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  constexpr void set(int i, int id) {
+    if (id < 0 || id >= 52 || ((mask_ >> id) & 1)) {
+      throw std::invalid_argument("Invalid or repeated card");
+    }
+    cards_[i] = static_cast<uint8_t>(id);
+    mask_ |= uint64_t(1) << id;
+  }
+
+  uint64_t mask_ = 0;
+  uint8_t cards_[N] = {};
+};
+
+class Board {
+ public:
+  static const int kMaxCards = 5;
+
+  constexpr Board() = default;
+
+  constexpr Board(const int* ids, int count) {
+    if (count < 0 || count > kMaxCards) {
+      throw std::invalid_argument("A board holds 0 to 5 cards");
+    }
+    for (int i = 0; i < count; i++) add(Card(ids[i]));
+  }
+
+  constexpr Board(std::initializer_list<Card> cards) {
+    if (cards.size() > kMaxCards) {
+      throw std::invalid_argument("A board holds 0 to 5 cards");
+    }
+    for (const Card& card : cards) add(card);
+  }
+
+  static Board Parse(std::string_view text) {
+    int ids[kMaxCards];
+    const ParseResult result = ParseHand(text, ids, kMaxCards);
+    if (!result) {
+      throw std::invalid_argument("Invalid board");
+    }
+    return Board(ids, result.count);
+  }
+
+  // Deals the next street's card.
+  constexpr void add(Card card) {
+    const int id = static_cast<int>(card);
+    if (size_ == kMaxCards || id < 0 || id >= 52 || ((mask_ >> id) & 1)) {
+      throw std::invalid_argument("Invalid or repeated card");
+    }
+    cards_[size_++] = static_cast<uint8_t>(id);
+    mask_ |= uint64_t(1) << id;
+  }
+
+  constexpr int size() const { return size_; }
+  constexpr Card operator[](int i) const { return Card(cards_[i]); }
+  constexpr const uint8_t* begin() const { return cards_; }
+  constexpr const uint8_t* end() const { return cards_ + size_; }
+  constexpr const uint8_t* data() const { return cards_; }
+  constexpr uint64_t mask() const { return mask_; }
+
+  constexpr bool contains(Card card) const {
+    return (mask_ >> static_cast<int>(card)) & 1;
+  }
+
+  std::string describe() const {
+    std::string name;
+    for (int i = 0; i < size_; i++) name += Card(cards_[i]).describeCard();
+    return name;
+  }
+
+ private:
+  uint64_t mask_ = 0;
+  uint8_t cards_[kMaxCards] = {};
+  uint8_t size_ = 0;
+};
+
+static_assert(std::is_trivially_copyable<Hand<7>>::value, "");
+static_assert(std::is_trivially_copyable<Board>::value, "");
+static_assert(sizeof(Hand<7>) == 16 && sizeof(Board) == 16, "");
+
+// Evaluates a 5 to 9 card hand with the matching evaluate_Ncards.
+template <int N>
+Rank EvaluateHand(const Hand<N>& hand) {
+  static_assert(N >= 5 && N <= 9, "EvaluateHand takes 5 to 9 cards");
+  const uint8_t* c = hand.data();
+  if constexpr (N == 5) {
+    return Rank(evaluate_5cards(c[0], c[1], c[2], c[3], c[4]));
+  } else if constexpr (N == 6) {
+    return Rank(evaluate_6cards(c[0], c[1], c[2], c[3], c[4], c[5]));
+  } else if constexpr (N == 7) {
+    return Rank(evaluate_7cards(c[0], c[1], c[2], c[3], c[4], c[5], c[6]));
+  } else if constexpr (N == 8) {
+    return Rank(
+        evaluate_8cards(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]));
+  } else {
+    return Rank(evaluate_9cards(c[0], c[1], c[2], c[3], c[4], c[5], c[6],
+                                c[7], c[8]));
+  }
+}
+
+// Hole cards plus a board of 3 to 5 cards, as one hand of 5 to 7 cards.
+// Throws std::invalid_argument for any other board.
+inline Rank EvaluateHand(const Hand<2>& hole, const Board& board) {
+  const uint8_t* b = board.data();
+  const int h0 = hole.data()[0], h1 = hole.data()[1];
+  switch (board.size()) {
+    case 3:
+      return Rank(evaluate_5cards(b[0], b[1], b[2], h0, h1));
+    case 4:
+      return Rank(evaluate_6cards(b[0], b[1], b[2], b[3], h0, h1));
+    case 5:
+      return Rank(evaluate_7cards(b[0], b[1], b[2], b[3], b[4], h0, h1));
+    default:
+      throw std::invalid_argument("The board needs 3 to 5 cards");
+  }
+}
+
+// PLO4 with a full board; needs the PLO4 library.
+inline Rank EvaluatePlo4Hand(const Board& board, const Hand<4>& hole) {
+  if (board.size() != 5) {
+    throw std::invalid_argument("PLO4 needs a 5 card board");
+  }
+  const uint8_t* b = board.data();
+  const uint8_t* h = hole.data();
+  return Rank(evaluate_plo4_cards(b[0], b[1], b[2], b[3], b[4], h[0], h[1],
+                                  h[2], h[3]));
+}
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_HAND_H
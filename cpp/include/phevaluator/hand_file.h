@@ -0,0 +1,221 @@
+#ifndef PHEVALUATOR_HAND_FILE_H
+#define PHEVALUATOR_HAND_FILE_H
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace phevaluator {
+
+/*
+ * Binary hand files, for passing hands between pipeline stages without
+ * printing and parsing card names.
+ *
+ * A file is a 24-byte header followed by fixed-size records. Every record
+ * holds the board cards followed by the hole cards of each player, and is
+ * stored as little-endian 64-bit words in one of two encodings:
+ *
+ * - kPacked6: the card ids, 6 bits each, 10 per word starting from the low
+ *   bits, in the order they were written.
+ * - kMask64: one 64-bit mask (bit id set for card id) for the board if it
+ *   has cards, then one mask per player. Cards come back in ascending id
+ *   order within the board and within each player.
+ *
+ * The variant says how a player's cards are evaluated: kCards is the best
+ * hand out of board and hole cards together (5 to 9 cards), kOmaha is PLO4
+ * and needs 5 board and 4 hole cards. A board of 0 cards simply stores
+ * hands, e.g. board 0, hole 7, one player for plain 7-card hands.
+ *
+ * A writer on a stream, e.g. a pipe, leaves the count as
+ * kHandFileUnknownCount and readers then read until the end of the input.
+ */
+
+enum class HandVariant : uint8_t { kCards = 0, kOmaha = 1 };
+enum class HandEncoding : uint8_t { kPacked6 = 0, kMask64 = 1 };
+
+const uint64_t kHandFileUnknownCount = ~uint64_t(0);
+const int kHandFileVersion = 1;
+
+struct HandFileHeader {
+  char magic[4];  // "PHHF"
+  uint8_t version;
+  HandVariant variant;
+  HandEncoding encoding;
+  uint8_t board_cards;
+  uint8_t hole_cards;
+  uint8_t players;
+  uint8_t reserved[6];
+  uint64_t count;
+
+  // Cards in a record: board_cards + hole_cards * players
+  int cards() const { return board_cards + hole_cards * players; }
+
+  // 64-bit words in a record
+  int words() const {
+    return encoding == HandEncoding::kPacked6
+               ? (cards() + 9) / 10
+               : (board_cards > 0 ? 1 : 0) + players;
+  }
+};
+static_assert(sizeof(HandFileHeader) == 24, "HandFileHeader must be packed");
+
+// Builds a header with a zero count, throws std::invalid_argument if the
+// layout can't be dealt from one deck or can't be evaluated as the variant.
+HandFileHeader MakeHandFileHeader(HandVariant variant, HandEncoding encoding,
+                                  int board_cards, int hole_cards,
+                                  int players = 1);
+
+// Packs the record `cards` (board, then each player's hole cards) into
+// header.words() words, throws std::invalid_argument for a card outside
+// [0, 52) or a card that appears twice.
+void EncodeHandRecord(const HandFileHeader& header, const int* cards,
+                      uint64_t* words);
+
+// Unpacks a record into header.cards() card ids, throws std::runtime_error
+// for a record that doesn't hold the header's cards: an id outside [0, 52),
+// a card that appears twice or, for kMask64, a word with the wrong count.
+void DecodeHandRecord(const HandFileHeader& header, const uint64_t* words,
+                      int* cards);
+
+class HandWriter {
+ public:
+  // Creates the file at path and writes the header, throws
+  // std::runtime_error if it can't.
+  HandWriter(const std::string& path, const HandFileHeader& header);
+
+  // Writes to an open stream, e.g. stdout, which stays open afterwards. The
+  // header keeps kHandFileUnknownCount. Throws std::runtime_error if the
+  // header can't be written.
+  HandWriter(std::FILE* stream, const HandFileHeader& header);
+
+  // Closes the file like close(), but ignores a failure.
+  ~HandWriter();
+
+  HandWriter(const HandWriter&) = delete;
+  HandWriter& operator=(const HandWriter&) = delete;
+
+  // Appends one record: the board, then the hole cards of each player.
+  void write(const int* cards);
+
+  // Flushes the buffered records and, for a file created from a path,
+  // stores the record count in the header. If any record failed to write,
+  // e.g. on a full disk, the count stays kHandFileUnknownCount and this
+  // throws std::runtime_error, as does a failure to write the count.
+  void close();
+
+  uint64_t count() const { return count_; }
+
+ private:
+  bool flush();
+  void writeHeader();
+  // close() without the exception; false if anything failed to write
+  bool finish();
+
+  std::FILE* file_;
+  bool owns_file_;
+  HandFileHeader header_;
+  std::vector<uint64_t> buffer_;
+  size_t used_ = 0;
+  uint64_t count_ = 0;
+  bool failed_ = false;  // a write failed, so count_ can't be trusted
+};
+
+// Reads a hand file front to back through a fixed buffer.
+class HandReader {
+ public:
+  // Opens the file at path, throws std::runtime_error if it can't or if
+  // the header isn't a hand file header this version understands.
+  explicit HandReader(const std::string& path);
+
+  // Reads from an open stream, e.g. stdin, which stays open afterwards.
+  explicit HandReader(std::FILE* stream);
+
+  ~HandReader();
+
+  HandReader(const HandReader&) = delete;
+  HandReader& operator=(const HandReader&) = delete;
+
+  const HandFileHeader& header() const { return header_; }
+
+  // Decodes the next record into header().cards() ids, returns false at
+  // the end of the file. Throws std::runtime_error for a corrupt record.
+  bool next(int* cards);
+
+ private:
+  void readHeader();
+
+  std::FILE* file_;
+  bool owns_file_;
+  HandFileHeader header_;
+  std::vector<uint64_t> buffer_;
+  size_t begin_ = 0;
+  size_t end_ = 0;
+  uint64_t remaining_ = 0;
+};
+
+// Maps a whole hand file into memory for random access. Records are decoded
+// straight from the mapping.
+class MappedHandFile {
+ public:
+  // Throws std::runtime_error if the file can't be mapped or isn't a hand
+  // file this version understands.
+  explicit MappedHandFile(const std::string& path);
+
+  ~MappedHandFile();
+
+  MappedHandFile(const MappedHandFile&) = delete;
+  MappedHandFile& operator=(const MappedHandFile&) = delete;
+
+  const HandFileHeader& header() const { return header_; }
+
+  // Records in the file; for kHandFileUnknownCount, as many as it holds.
+  uint64_t size() const { return count_; }
+
+  // Throws std::runtime_error for a corrupt record, as does forEach.
+  void decode(uint64_t index, int* cards) const {
+    DecodeHandRecord(header_, records_ + index * header_.words(), cards);
+  }
+
+  // Calls f(const int* cards) for every record, in order.
+  template <class F>
+  void forEach(F&& f) const {
+    int cards[52];
+    for (uint64_t i = 0; i < count_; i++) {
+      decode(i, cards);
+      f(static_cast<const int*>(cards));
+    }
+  }
+
+ private:
+  void unmap();
+
+  void* data_ = nullptr;
+  size_t bytes_ = 0;
+  HandFileHeader header_;
+  const uint64_t* records_ = nullptr;
+  uint64_t count_ = 0;
+};
+
+/*
+ * Evaluates every player of every record, writing size() * players ranks in
+ * record order. The kCards variant supports 5 to 9 cards per player here;
+ * PLO4 files go through EvaluatePlo4HandFile, which lives in the PLO4
+ * library. Both throw std::invalid_argument for the other variant.
+ */
+size_t EvaluateHandFile(const MappedHandFile& file, short* ranks);
+size_t EvaluatePlo4HandFile(const MappedHandFile& file, short* ranks);
+
+/*
+ * Streaming versions: evaluate up to max_records records from the reader
+ * and return the number of records read, 0 at the end of the input.
+ */
+size_t EvaluateHands(HandReader& reader, short* ranks, size_t max_records);
+size_t EvaluatePlo4Hands(HandReader& reader, short* ranks,
+                         size_t max_records);
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_HAND_FILE_H
@@ -0,0 +1,68 @@
+#ifndef PHEVALUATOR_HEATMAP_H
+#define PHEVALUATOR_HEATMAP_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Per-cache-line access counts of the lookup tables, only collected when the
+ * library is built with PHEVAL_HEATMAP defined (cmake -DPHEVAL_HEATMAP=ON).
+ * Without it the touch points compile to nothing, pheval_heatmap_enabled()
+ * returns 0 and pheval_heatmap_lines() returns 0 for every table. A table
+ * also reports 0 lines until some thread has read it.
+ *
+ * Line n of a table is the n-th 64-byte cache line the table overlaps, so
+ * line 0 may be partially filled when the table isn't 64-byte aligned.
+ * Every thread counts into its own arrays, allocated when the thread first
+ * reads a table (8 bytes per line, 3.5MB for noflush_plo4), and a snapshot
+ * sums all of them.
+ *
+ * tools/optimize_table_layout.cc turns a workload into a proposed table
+ * layout and reports how many lines the hot part of the workload needs.
+ */
+
+enum pheval_heatmap_table {
+  PHEVAL_HEATMAP_FLUSH = 0,
+  PHEVAL_HEATMAP_NOFLUSH5,
+  PHEVAL_HEATMAP_NOFLUSH7,
+  PHEVAL_HEATMAP_NOFLUSH8,
+  PHEVAL_HEATMAP_NOFLUSH9,
+  PHEVAL_HEATMAP_FLUSH_PLO4,
+  PHEVAL_HEATMAP_NOFLUSH_PLO4,
+  PHEVAL_HEATMAP_TABLE_COUNT,
+};
+
+#define PHEVAL_HEATMAP_LINE_SIZE 64
+
+// Function: pheval_heatmap_enabled
+// - Output: int, 1 if the library was built with PHEVAL_HEATMAP, 0 otherwise
+
+int pheval_heatmap_enabled(void);
+
+// Function: pheval_heatmap_lines
+// - Input: enum pheval_heatmap_table
+// - Output: size_t, the number of cache lines counted for the table
+
+size_t pheval_heatmap_lines(enum pheval_heatmap_table table);
+
+// Function: pheval_heatmap_snapshot
+// - Input: enum pheval_heatmap_table, unsigned long long* out
+// - Purpose: Writes the access count of every line of the table, summed over
+//   all threads, to out[0 .. pheval_heatmap_lines(table)).
+
+void pheval_heatmap_snapshot(enum pheval_heatmap_table table,
+                             unsigned long long* out);
+
+// Function: pheval_heatmap_reset
+// - Purpose: Sets the counts of all tables and threads back to zero.
+
+void pheval_heatmap_reset(void);
+
+#ifdef __cplusplus
+}  // closing brace for extern "C"
+#endif
+
+#endif  // PHEVALUATOR_HEATMAP_H
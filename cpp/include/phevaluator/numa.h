@@ -0,0 +1,98 @@
+#ifndef PHEVALUATOR_NUMA_H
+#define PHEVALUATOR_NUMA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Per-NUMA-node copies of the large lookup tables (noflush7, noflush8,
+ * noflush9, flush_plo4 and noflush_plo4), only used when the library is
+ * built with PHEVAL_NUMA defined (cmake -DPHEVAL_NUMA=ON).
+ *
+ * The evaluators read these tables through a thread-local pointer, which
+ * starts out pointing at the tables compiled into the library. A thread
+ * switches to the copy of a node by calling pheval_numa_bind_thread, and
+ * keeps using it until it binds again. Threads that never bind behave
+ * exactly as in a normal build.
+ *
+ * With libnuma (found by CMake) every copy is allocated on its node. Without
+ * it, or when the kernel has no NUMA support, there is a single copy: every
+ * replica is the compiled-in table and binding is a no-op apart from the
+ * bookkeeping. Copies live until the process exits.
+ */
+
+// Function: pheval_numa_enabled
+// - Output: int, 1 if the library was built with PHEVAL_NUMA, 0 otherwise
+
+int pheval_numa_enabled(void);
+
+// Function: pheval_numa_available
+// - Output: int, 1 if replicas are real per-node copies (PHEVAL_NUMA build,
+//   libnuma present and the kernel supports it), 0 for the single copy
+
+int pheval_numa_available(void);
+
+// Function: pheval_numa_replicate
+// - Input: int replicas
+// - Output: int, the number of replicas, 0 if PHEVAL_NUMA is off
+// - Purpose: Creates the table copies. With replicas <= 0 there is one per
+//   configured node; otherwise replica i is placed on node i modulo the
+//   node count, which lets a single-node machine exercise several copies.
+//   Only the first call creates anything, later calls return the count.
+
+int pheval_numa_replicate(int replicas);
+
+// Function: pheval_numa_replicas
+// - Output: int, the number of replicas created so far, 0 before the first
+//   pheval_numa_replicate call or if PHEVAL_NUMA is off
+// - Purpose: Reads the count without creating any copies.
+
+int pheval_numa_replicas(void);
+
+// Function: pheval_numa_nodes
+// - Output: int, the nodes pheval_numa_replicate(0) makes a replica for, 1
+//   without libnuma, 0 if PHEVAL_NUMA is off
+
+int pheval_numa_nodes(void);
+
+// Function: pheval_numa_bind_thread
+// - Input: int replica, a negative value picks the node the calling thread
+//   is running on
+// - Output: int, the replica bound, -1 if it is out of range
+// - Purpose: Points the calling thread's table pointers at a replica,
+//   calling pheval_numa_replicate(0) first if no replica exists yet.
+
+int pheval_numa_bind_thread(int replica);
+
+// Function: pheval_numa_unbind_thread
+// - Purpose: Points the calling thread back at the compiled-in tables.
+
+void pheval_numa_unbind_thread(void);
+
+// Function: pheval_numa_bound_replica
+// - Output: int, the replica the calling thread is bound to, -1 if it reads
+//   the compiled-in tables
+
+int pheval_numa_bound_replica(void);
+
+// Function: pheval_numa_pin_thread
+// - Input: int replica
+// - Output: int, the replica bound, -1 if it is out of range
+// - Purpose: Restricts the calling thread to the CPUs of the replica's node
+//   (when libnuma is available) and binds it to that replica.
+
+int pheval_numa_pin_thread(int replica);
+
+// Function: pheval_numa_local_table
+// - Input: const char* name, e.g. "noflush7"
+// - Output: const void*, the copy of the table the calling thread reads,
+//   NULL if the table isn't replicated or isn't linked in
+
+const void* pheval_numa_local_table(const char* name);
+
+#ifdef __cplusplus
+}  // closing brace for extern "C"
+#endif
+
+#endif  // PHEVALUATOR_NUMA_H
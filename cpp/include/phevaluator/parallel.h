@@ -0,0 +1,100 @@
+#ifndef PHEVALUATOR_PARALLEL_H
+#define PHEVALUATOR_PARALLEL_H
+#ifdef __cplusplus
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "batch.h"
+
+namespace phevaluator {
+
+/*
+ * A fixed set of worker threads, created once and reused by every call, so
+ * a short batch costs a wake-up rather than thread creation.
+ *
+ * parallelFor splits chunks 0 .. n-1 into one contiguous run per thread.
+ * Each thread works through its own run from the front; a thread that runs
+ * out steals the back half of another thread's remaining run, so uneven
+ * chunks (or a descheduled thread) don't leave the others idle. The calling
+ * thread takes part as worker 0, and a call with a single chunk never leaves
+ * it.
+ *
+ * With pin set, worker i is restricted to CPU i modulo the CPU count (on
+ * Linux), and, in a PHEVAL_NUMA build, bound to the table replica of its
+ * node (see numa.h).
+ *
+ * One parallelFor runs at a time; concurrent calls wait for each other.
+ */
+class ThreadPool {
+ public:
+  // threads <= 0 uses std::thread::hardware_concurrency(); the pool
+  // starts threads - 1 workers besides the caller.
+  explicit ThreadPool(int threads = 0, bool pin = false);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  int threads() const { return static_cast<int>(runs_.size()); }
+
+  // Calls body(chunk, worker) once for every chunk in [0, chunks), with
+  // worker in [0, threads()), and returns when all calls have. An exception
+  // from body is rethrown here once the other chunks finish.
+  void parallelFor(size_t chunks,
+                   const std::function<void(size_t chunk, int worker)>& body);
+
+ private:
+  // The chunks a worker hasn't started, on a cache line of its own
+  struct alignas(64) Run {
+    std::mutex mutex;
+    size_t begin = 0;
+    size_t end = 0;
+  };
+
+  void workerLoop(int worker);
+  void runChunks(int worker);
+  bool takeOwn(int worker, size_t& chunk);
+  bool steal(int worker, size_t& chunk);
+
+  std::vector<std::unique_ptr<Run>> runs_;
+  std::vector<std::thread> workers_;
+  bool pin_;
+
+  std::mutex call_mutex_;  // one parallelFor at a time
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  std::atomic<uint64_t> generation_{0};
+  const std::function<void(size_t, int)>* body_ = nullptr;  // under mutex_
+  bool finished_ = true;                                     // under mutex_
+  int active_ = 0;                                           // under mutex_
+  bool stop_ = false;                                        // under mutex_
+  std::atomic<size_t> remaining_{0};
+  std::exception_ptr error_;  // under mutex_
+};
+
+// Hands per chunk by default: about 150KB of 7-card input and output, so a
+// chunk streams through L2 without evicting the rank tables from it.
+const size_t kDefaultChunkHands = 16384;
+
+// Evaluates n hands with engine across the pool, with the same arguments
+// and result as the engine's batch function (see batch.h). Chunk
+// boundaries fall on 64-byte lines of out, so no two threads write to the
+// same line. chunk_hands = 0 uses kDefaultChunkHands.
+size_t ParallelEvaluate(ThreadPool& pool, const pheval_engine& engine,
+                        const uint8_t* cards, size_t n, size_t stride,
+                        int16_t* out, size_t chunk_hands = 0);
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_PARALLEL_H
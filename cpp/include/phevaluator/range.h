@@ -0,0 +1,124 @@
+#ifndef PHEVALUATOR_RANGE_H
+#define PHEVALUATOR_RANGE_H
+#ifdef __cplusplus
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "dealer.h"
+
+namespace phevaluator {
+
+/*
+ * A Hold'em range: a subset of the 1326 two-card hands, each with a
+ * positive weight.
+ *
+ * Hands are numbered in colexicographic order of their cards, hand (a, b)
+ * with a < b at b * (b - 1) / 2 + a, the order of Combinations(2), and the
+ * set is 1326 bits. Weights are only stored once one of them isn't 1.
+ * Dropping the hands that use a card is an and-not with that card's
+ * precomputed mask, 21 words per dead card.
+ *
+ * Parse reads the usual notation, items separated by commas or spaces:
+ *
+ *   AKs, AKo, AK     suited, offsuit, or both
+ *   TT               a pair
+ *   TT+, ATs+        pairs up to aces; kickers up to one below the top card
+ *   TT-77, A5s-A2s   spans of pairs or of kickers, either way round
+ *   AhKh             one hand
+ *   KQo:0.5          any of these with a weight
+ */
+class HoldemRange {
+ public:
+  static const int kHands = 1326;
+  static const int kWords = (kHands + 63) / 64;
+
+  // Cards of each hand, the lower card id first
+  static const std::array<std::array<uint8_t, 2>, kHands> kHandCards;
+
+  // Number of the hand of two different cards, in either order
+  static int Index(int a, int b) {
+    if (a > b) std::swap(a, b);
+    return b * (b - 1) / 2 + a;
+  }
+
+  // Throws std::invalid_argument naming the first item it can't read.
+  static HoldemRange Parse(std::string_view text);
+
+  // Every hand, with weight 1
+  static HoldemRange All();
+
+  // Adds a hand or sets its weight; throws std::invalid_argument for
+  // invalid or equal cards or a weight that isn't positive.
+  void add(int a, int b, double weight = 1.0);
+  void remove(int a, int b) { clear(Index(a, b)); }
+
+  bool contains(int index) const {
+    return (bits_[index >> 6] >> (index & 63)) & 1;
+  }
+
+  // 0 for a hand outside the range
+  double weight(int index) const {
+    if (!contains(index)) return 0;
+    return weights_.empty() ? 1.0 : weights_[index];
+  }
+
+  int size() const;
+  bool empty() const { return size() == 0; }
+  double totalWeight() const;
+
+  // Drops the hands that use any of the cards.
+  void removeCards(uint64_t dead_cards);
+  HoldemRange without(uint64_t dead_cards) const {
+    HoldemRange range = *this;
+    range.removeCards(dead_cards);
+    return range;
+  }
+
+  // A hand in both ranges keeps the larger weight in a union and the
+  // smaller in an intersection.
+  HoldemRange& operator|=(const HoldemRange& other);
+  HoldemRange& operator&=(const HoldemRange& other);
+  friend HoldemRange operator|(HoldemRange a, const HoldemRange& b) {
+    return a |= b;
+  }
+  friend HoldemRange operator&(HoldemRange a, const HoldemRange& b) {
+    return a &= b;
+  }
+
+  bool operator==(const HoldemRange& other) const;
+  bool operator!=(const HoldemRange& other) const { return !(*this == other); }
+
+  // Calls visit(index, a, b, weight) for every hand, in index order.
+  template <class Visit>
+  void forEach(Visit&& visit) const {
+    for (int w = 0; w < kWords; w++) {
+      for (uint64_t bits = bits_[w]; bits; bits &= bits - 1) {
+        const int index = w * 64 + __builtin_ctzll(bits);
+        const std::array<uint8_t, 2>& cards = kHandCards[index];
+        visit(index, cards[0], cards[1], weight(index));
+      }
+    }
+  }
+
+  // The hands as a HandRange for the Dealer and EquityCalculator
+  card_sampler::HandRange toHandRange() const;
+
+  // Bit i of word i / 64 is set for hand i
+  const uint64_t* words() const { return bits_; }
+
+ private:
+  void clear(int index) {
+    bits_[index >> 6] &= ~(uint64_t(1) << (index & 63));
+  }
+
+  uint64_t bits_[kWords] = {};
+  std::vector<double> weights_;  // empty while every weight is 1
+};
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_RANGE_H
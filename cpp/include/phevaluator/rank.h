@@ -69,6 +69,41 @@ const char* describe_sample_hand(int rank);
 
 bool is_flush(int rank);
 
+// Struct: rank_info
+// - Packed 8-byte metadata for one rank, so every describe call is a single
+//   load from rank_info_table plus pointer arithmetic.
+// - primary and kicker use the card rank index (deuce = 0, ..., ace = 12).
+//   primary is the rank of the defining group (the quads, the trips of a full
+//   house, the top pair, the highest card of a straight or high card hand).
+//   kicker is the rank of the next group or the highest kicker; straights and
+//   straight flushes have no kicker and repeat primary.
+// - The description lives at rank_description_pool + description_offset and
+//   is description_length characters long (NUL-terminated as well).
+
+struct rank_info {
+  unsigned char category;             // enum rank_category, 0 for rank 0
+  unsigned char flush;                // 1 for flushes and straight flushes
+  unsigned char primary;              // rank index of the defining group
+  unsigned char kicker;               // rank index of the next group/kicker
+  unsigned short description_offset;  // offset into rank_description_pool
+  unsigned char description_length;   // length without the NUL
+  unsigned char reserved;
+};
+
+// Generated by tools/gen_rank_info.cc from rank_description, indexed by rank
+// (0 to 7462). The sample hand of a rank is rank_sample_pool[rank], always 5
+// characters long except for rank 0.
+extern const struct rank_info rank_info_table[7463];
+extern const char rank_description_pool[];
+extern const char rank_sample_pool[7463][6];
+
+// Function: get_rank_info
+// - Input: int rank (from 1 to 7462)
+// - Output: const struct rank_info* (never NULL, not bounds checked)
+// - Purpose: Returns the packed metadata entry of the given rank.
+
+const struct rank_info* get_rank_info(int rank);
+
 #ifdef __cplusplus
 }  // closing brace for extern "C"
 
@@ -79,6 +114,7 @@ bool is_flush(int rank);
 
 #include <array>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "card.h"
@@ -135,24 +171,48 @@ bool operator!=(const Rank& other) const {
 }
 
 
+// Returns the packed metadata entry of this rank (see struct rank_info).
+const rank_info& info() const { return rank_info_table[value_]; }
+
 //function definition: 
 // Returns the hand category (e.g., flush, straight, etc.) for this rank.
 enum rank_category category() const {
-    return get_rank_category(value_);
+    return static_cast<enum rank_category>(info().category);
 }
 
-std::string describeCategory() const {
+// The *View accessors never allocate: the returned views point into static
+// tables and stay valid for the lifetime of the program.
+std::string_view describeCategoryView() const {
     return describe_rank_category(category());
 }
 
+std::string_view describeRankView() const {
+    const rank_info& entry = info();
+    return std::string_view(rank_description_pool + entry.description_offset,
+                            entry.description_length);
+}
+
+std::string_view describeSampleHandView() const {
+    return std::string_view(rank_sample_pool[value_], value_ == 0 ? 0 : 5);
+}
+
+// Rank index (deuce = 0, ..., ace = 12) of the defining group and the kicker.
+int primaryRank() const { return info().primary; }
+int kickerRank() const { return info().kicker; }
+
+// Allocating wrappers kept for existing callers.
+std::string describeCategory() const {
+    return std::string(describeCategoryView());
+}
+
 std::string describeRank() const { 
-    return describe_rank(value_); 
+    return std::string(describeRankView()); 
 }
 
 std::string describeSampleHand() const {
-    return describe_sample_hand(value_);
+    return std::string(describeSampleHandView());
 }
-bool isFlush() const { return is_flush(value_); }
+bool isFlush() const { return info().flush != 0; }
 
 
 Rank(int value) : value_(value) {} //constructor that creates a Rank object from an integer value
@@ -0,0 +1,78 @@
+#ifndef PHEVALUATOR_RANK_DISTRIBUTION_H
+#define PHEVALUATOR_RANK_DISTRIBUTION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Precomputed distribution of the 7462 ranks for each evaluator variant.
+ *
+ * The 5-card, 6-card and 7-card tables are exact: every C(52,5), C(52,6)
+ * and C(52,7) hand is evaluated once. The PLO4 table is estimated from
+ * RANK_DISTRIBUTION_PLO4_SAMPLES uniformly random boards with random hole
+ * cards, dealt from a fixed seed so that the generator reproduces it.
+ *
+ * All tables are generated by tools/gen_rank_distribution.cc.
+ */
+
+enum rank_variant {
+  RANK_VARIANT_5CARDS = 0,
+  RANK_VARIANT_6CARDS,
+  RANK_VARIANT_7CARDS,
+  RANK_VARIANT_PLO4,
+  RANK_VARIANT_COUNT,
+};
+
+#define RANK_DISTRIBUTION_PLO4_SAMPLES 16777216u
+
+// Number of hands of each variant that evaluate to a given rank (0 to 7462,
+// entry 0 is always 0).
+extern const unsigned int rank_frequency_table[RANK_VARIANT_COUNT][7463];
+
+// Total number of hands counted in each row of rank_frequency_table.
+extern const unsigned int rank_frequency_total[RANK_VARIANT_COUNT];
+
+// Share of the hands of each variant whose rank is the same or weaker than a
+// given rank, i.e. the cumulative distribution counted from rank 7462 up.
+// Rank 1 is always 1.0, entry 0 is always 0.0.
+extern const float rank_percentile_table[RANK_VARIANT_COUNT][7463];
+
+// Function: rank_frequency
+// - Input: enum rank_variant, int rank (from 1 to 7462)
+// - Output: unsigned int
+// - Purpose: Returns how many hands of the variant evaluate to the rank.
+
+unsigned int rank_frequency(enum rank_variant variant, int rank);
+
+// Function: rank_percentile
+// - Input: enum rank_variant, int rank (from 1 to 7462)
+// - Output: float in [0, 1]
+// - Purpose: Returns the share of the variant's hands that the rank beats or
+//   ties, suitable for hand-strength normalisation and bucketing.
+
+float rank_percentile(enum rank_variant variant, int rank);
+
+#ifdef __cplusplus
+}  // closing brace for extern "C"
+#endif
+
+#ifdef __cplusplus
+
+#include "rank.h"
+
+namespace phevaluator {
+
+inline float RankPercentile(enum rank_variant variant, const Rank& rank) {
+  return rank_percentile_table[variant][rank.value()];
+}
+
+inline unsigned int RankFrequency(enum rank_variant variant, const Rank& rank) {
+  return rank_frequency_table[variant][rank.value()];
+}
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+
+#endif  // PHEVALUATOR_RANK_DISTRIBUTION_H
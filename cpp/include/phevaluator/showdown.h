@@ -0,0 +1,86 @@
+#ifndef PHEVALUATOR_SHOWDOWN_H
+#define PHEVALUATOR_SHOWDOWN_H
+#ifdef __cplusplus
+#include <cstdint>
+
+#include "equity.h"
+#include "hand.h"
+#include "range.h"
+
+namespace phevaluator {
+
+/*
+ * The Hold'em hands that can be dealt on one river board, in order of
+ * strength, for showdowns between ranges.
+ *
+ * Setting a board evaluates each live hand once with a BoardEvaluator and
+ * radix-sorts the hands by rank, two passes over 7 and 6 bits of it, so
+ * they're listed weakest first with hands of equal rank side by side in tie
+ * groups. A showdown against a weighted range is then one sweep up the
+ * list: a hand beats the range's weight below its group and ties the weight
+ * in it, less the hands that share one of its cards, which running sums per
+ * card take out. Every hand's payoff against the range costs O(n) rather
+ * than a comparison of every pair of hands.
+ *
+ * Weights are arrays of HoldemRange::kHands doubles, by HoldemRange index;
+ * HoldemRange::weight gives them for a range. A table doesn't allocate and
+ * can be reused for any number of boards.
+ */
+class ShowdownTable {
+ public:
+  // An empty table
+  ShowdownTable();
+
+  // Throws std::invalid_argument unless the board has 5 cards.
+  explicit ShowdownTable(const Board& board,
+                         const HoldemRange& hands = HoldemRange::All());
+
+  // Lists the hands of `hands` that don't use a board card.
+  void setBoard(const uint8_t board[5],
+                const HoldemRange& hands = HoldemRange::All());
+
+  int size() const { return size_; }
+
+  // HoldemRange indices of the hands, weakest first, and their ranks
+  const uint16_t* hands() const { return hands_; }
+  int rankAt(int position) const { return ranks_[position]; }
+
+  // The position of a hand, or -1 if it isn't listed
+  int positionOf(int hand) const { return positions_[hand]; }
+
+  // Tie group g holds positions groupBegin(g) to groupBegin(g + 1) - 1
+  int groups() const { return groups_; }
+  int groupBegin(int group) const { return group_begins_[group]; }
+
+  // Listed hands that use the card
+  int blockers(int card) const { return blockers_[card]; }
+
+  // For every listed hand, the weight of the other range's hands without a
+  // card in common that it beats, ties and could face; 0 for the other
+  // hands. Weights of hands that aren't listed are ignored.
+  void showdown(const double* weights, double* beaten, double* tied,
+                double* faced) const;
+
+  // Beaten less lost weight of every listed hand, 0 for the others: its
+  // showdown value against the range with a win worth 1 and a loss -1.
+  void payoffs(const double* weights, double* payoff) const;
+
+ private:
+  // Calls visit(position, beaten, tied, faced) for every listed hand
+  template <class Visit>
+  void sweep(const double* weights, Visit&& visit) const;
+
+  BoardEvaluator evaluator_;
+  int size_ = 0;
+  int groups_ = 0;
+  uint16_t hands_[HoldemRange::kHands];
+  uint16_t ranks_[HoldemRange::kHands];
+  uint16_t group_begins_[HoldemRange::kHands + 1];
+  int16_t positions_[HoldemRange::kHands];
+  int blockers_[52] = {};
+};
+
+}  // namespace phevaluator
+
+#endif  // __cplusplus
+#endif  // PHEVALUATOR_SHOWDOWN_H
@@ -0,0 +1,78 @@
+#ifndef PHEVALUATOR_STATS_H
+#define PHEVALUATOR_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Hot-path counters of the evaluators, only collected when the library is
+ * built with PHEVAL_STATS defined (cmake -DPHEVAL_STATS=ON). Without it the
+ * counting macros compile to nothing, pheval_stats_enabled() returns 0 and a
+ * snapshot is all zeros.
+ *
+ * evaluate_6cards only counts calls and flush_hits, as it combines 6 lookups
+ * into the 5-card tables per call.
+ *
+ * Every thread counts into its own block, so evaluation stays contention
+ * free; a snapshot sums the blocks of all threads that have ever evaluated.
+ *
+ * When <sys/sdt.h> is available the instrumented build also carries USDT
+ * probes under the provider "pheval", e.g. with bpftrace:
+ *   bpftrace -e 'usdt:./unit_tests:pheval:noflush { @[arg0] = lhist(arg2, 0, 7463, 500); }'
+ *
+ *   flush(evaluator, rank)          a flush table decided the result
+ *   noflush(evaluator, hash, rank)  a noflush table lookup
+ *   quinary_depth(depth)            iterations done by hash_quinary
+ */
+
+enum pheval_stats_evaluator {
+  PHEVAL_STATS_5CARDS = 0,
+  PHEVAL_STATS_6CARDS,
+  PHEVAL_STATS_7CARDS,
+  PHEVAL_STATS_8CARDS,
+  PHEVAL_STATS_9CARDS,
+  PHEVAL_STATS_PLO4,
+  PHEVAL_STATS_EVALUATOR_COUNT,
+};
+
+// The noflush table of each evaluator is split into this many equal regions
+#define PHEVAL_STATS_REGIONS 16
+
+struct pheval_stats_counters {
+  unsigned long long calls;
+  unsigned long long flush_hits;    // flush table reads
+  unsigned long long noflush_only;  // results taken from a noflush table
+  unsigned long long region_hits[PHEVAL_STATS_REGIONS];
+};
+
+// Only unsigned long long members, the snapshot sums them as a flat array
+struct pheval_stats {
+  struct pheval_stats_counters evaluator[PHEVAL_STATS_EVALUATOR_COUNT];
+  unsigned long long quinary_calls;
+  // quinary_depth[n]: hash_quinary calls that stopped after n of the 13 ranks
+  unsigned long long quinary_depth[14];
+};
+
+// Function: pheval_stats_enabled
+// - Output: int, 1 if the library was built with PHEVAL_STATS, 0 otherwise
+
+int pheval_stats_enabled(void);
+
+// Function: pheval_stats_snapshot
+// - Input: struct pheval_stats* out
+// - Purpose: Sums the counters of all threads into out. Counters of threads
+//   that are evaluating at the same time may be a few increments behind.
+
+void pheval_stats_snapshot(struct pheval_stats* out);
+
+// Function: pheval_stats_reset
+// - Purpose: Sets the counters of all threads back to zero.
+
+void pheval_stats_reset(void);
+
+#ifdef __cplusplus
+}  // closing brace for extern "C"
+#endif
+
+#endif  // PHEVALUATOR_STATS_H
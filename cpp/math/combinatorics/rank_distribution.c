@@ -0,0 +1,8756 @@
+/* Generated by tools/gen_rank_distribution.cc, do not edit by hand. */
+
+#include <phevaluator/rank_distribution.h>
+
+const unsigned int rank_frequency_table[RANK_VARIANT_COUNT][7463] = {
+    /* 5 cards */
+    {
+        0, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+        1020, 1020, 1020, 1020, 1020, 1020, 1020,
+    },
+    /* 6 cards */
+    {
+        0, 188, 184, 184, 184, 184, 184, 184,
+        184, 184, 184, 182, 166, 150, 134, 118,
+        102, 86, 70, 54, 38, 22, 6, 182,
+        166, 150, 134, 118, 102, 86, 70, 54,
+        38, 22, 6, 182, 166, 150, 134, 118,
+        102, 86, 70, 54, 38, 22, 6, 182,
+        166, 150, 134, 118, 102, 86, 70, 54,
+        38, 22, 6, 182, 166, 150, 134, 118,
+        102, 86, 70, 54, 38, 22, 6, 182,
+        166, 150, 134, 118, 102, 86, 70, 54,
+        38, 22, 6, 182, 166, 150, 134, 118,
+        102, 86, 70, 54, 38, 22, 6, 182,
+        166, 150, 134, 118, 102, 86, 70, 54,
+        38, 22, 6, 182, 166, 150, 134, 118,
+        102, 86, 70, 54, 38, 22, 6, 182,
+        166, 150, 134, 118, 102, 86, 70, 54,
+        38, 22, 6, 182, 166, 150, 134, 118,
+        102, 86, 70, 54, 38, 22, 6, 182,
+        166, 150, 134, 118, 102, 86, 70, 54,
+        38, 22, 6, 182, 166, 150, 134, 118,
+        102, 86, 70, 54, 38, 22, 6, 1072,
+        1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072,
+        1072, 1072, 1072, 1056, 1072, 1072, 1072, 1072,
+        1072, 1072, 1072, 1072, 1072, 1072, 1072, 1056,
+        1056, 1072, 1072, 1072, 1072, 1072, 1072, 1072,
+        1072, 1072, 1072, 1056, 1056, 1056, 1072, 1072,
+        1072, 1072, 1072, 1072, 1072, 1072, 1072, 1056,
+        1056, 1056, 1056, 1072, 1072, 1072, 1072, 1072,
+        1072, 1072, 1072, 1056, 1056, 1056, 1056, 1056,
+        1072, 1072, 1072, 1072, 1072, 1072, 1072, 1056,
+        1056, 1056, 1056, 1056, 1056, 1072, 1072, 1072,
+        1072, 1072, 1072, 1056, 1056, 1056, 1056, 1056,
+        1056, 1056, 1072, 1072, 1072, 1072, 1072, 1056,
+        1056, 1056, 1056, 1056, 1056, 1056, 1056, 1072,
+        1072, 1072, 1072, 1056, 1056, 1056, 1056, 1056,
+        1056, 1056, 1056, 1056, 1072, 1072, 1072, 1056,
+        1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
+        1056, 1072, 1072, 1056, 1056, 1056, 1056, 1056,
+        1056, 1056, 1056, 1056, 1056, 1056, 1072, 1056,
+        1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
+        1056, 1056, 1056, 184, 180, 176, 172, 168,
+        164, 160, 156, 184, 180, 176, 172, 168,
+        164, 160, 156, 180, 176, 172, 168, 164,
+        160, 156, 176, 172, 168, 164, 160, 156,
+        172, 168, 164, 160, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 184,
+        180, 176, 172, 168, 164, 160, 156, 180,
+        176, 172, 168, 164, 160, 156, 176, 172,
+        168, 164, 160, 156, 172, 168, 164, 160,
+        156, 168, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 180, 176, 172, 168, 164,
+        160, 156, 176, 172, 168, 164, 160, 156,
+        172, 168, 164, 160, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 176,
+        172, 168, 164, 160, 156, 172, 168, 164,
+        160, 156, 168, 164, 160, 156, 164, 160,
+        156, 160, 156, 156, 172, 168, 164, 160,
+        156, 168, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 168, 164, 160, 156, 164,
+        160, 156, 160, 156, 156, 164, 160, 156,
+        160, 156, 156, 156, 156, 156, 156, 180,
+        180, 176, 172, 168, 164, 160, 156, 180,
+        176, 172, 168, 164, 160, 156, 176, 172,
+        168, 164, 160, 156, 172, 168, 164, 160,
+        156, 168, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 180, 176, 172, 168, 164,
+        160, 156, 176, 172, 168, 164, 160, 156,
+        172, 168, 164, 160, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 176,
+        172, 168, 164, 160, 156, 172, 168, 164,
+        160, 156, 168, 164, 160, 156, 164, 160,
+        156, 160, 156, 156, 172, 168, 164, 160,
+        156, 168, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 168, 164, 160, 156, 164,
+        160, 156, 160, 156, 156, 164, 160, 156,
+        160, 156, 156, 156, 156, 156, 156, 176,
+        176, 172, 168, 164, 160, 156, 176, 172,
+        168, 164, 160, 156, 172, 168, 164, 160,
+        156, 168, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 176, 172, 168, 164, 160,
+        156, 172, 168, 164, 160, 156, 168, 164,
+        160, 156, 164, 160, 156, 160, 156, 156,
+        172, 168, 164, 160, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 168,
+        164, 160, 156, 164, 160, 156, 160, 156,
+        156, 164, 160, 156, 160, 156, 156, 156,
+        156, 156, 156, 172, 172, 168, 164, 160,
+        156, 172, 168, 164, 160, 156, 168, 164,
+        160, 156, 164, 160, 156, 160, 156, 156,
+        172, 168, 164, 160, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 168,
+        164, 160, 156, 164, 160, 156, 160, 156,
+        156, 164, 160, 156, 160, 156, 156, 156,
+        156, 156, 156, 168, 168, 164, 160, 156,
+        168, 164, 160, 156, 164, 160, 156, 160,
+        156, 156, 168, 164, 160, 156, 164, 160,
+        156, 160, 156, 156, 164, 160, 156, 160,
+        156, 156, 156, 156, 156, 156, 164, 164,
+        160, 156, 164, 160, 156, 160, 156, 156,
+        164, 160, 156, 160, 156, 156, 156, 156,
+        156, 156, 160, 160, 156, 160, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156,
+        180, 176, 172, 168, 164, 160, 156, 180,
+        176, 172, 168, 164, 160, 156, 176, 172,
+        168, 164, 160, 156, 172, 168, 164, 160,
+        156, 168, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 180, 176, 172, 168, 164,
+        160, 156, 176, 172, 168, 164, 160, 156,
+        172, 168, 164, 160, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 176,
+        172, 168, 164, 160, 156, 172, 168, 164,
+        160, 156, 168, 164, 160, 156, 164, 160,
+        156, 160, 156, 156, 172, 168, 164, 160,
+        156, 168, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 168, 164, 160, 156, 164,
+        160, 156, 160, 156, 156, 164, 160, 156,
+        160, 156, 156, 160, 156, 156, 156, 176,
+        176, 172, 168, 164, 160, 156, 176, 172,
+        168, 164, 160, 156, 172, 168, 164, 160,
+        156, 168, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 176, 172, 168, 164, 160,
+        156, 172, 168, 164, 160, 156, 168, 164,
+        160, 156, 164, 160, 156, 160, 156, 156,
+        172, 168, 164, 160, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 168,
+        164, 160, 156, 164, 160, 156, 160, 156,
+        156, 164, 160, 156, 160, 156, 156, 160,
+        156, 156, 156, 172, 172, 168, 164, 160,
+        156, 172, 168, 164, 160, 156, 168, 164,
+        160, 156, 164, 160, 156, 160, 156, 156,
+        172, 168, 164, 160, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 168,
+        164, 160, 156, 164, 160, 156, 160, 156,
+        156, 164, 160, 156, 160, 156, 156, 160,
+        156, 156, 156, 168, 168, 164, 160, 156,
+        168, 164, 160, 156, 164, 160, 156, 160,
+        156, 156, 168, 164, 160, 156, 164, 160,
+        156, 160, 156, 156, 164, 160, 156, 160,
+        156, 156, 160, 156, 156, 156, 164, 164,
+        160, 156, 164, 160, 156, 160, 156, 156,
+        164, 160, 156, 160, 156, 156, 160, 156,
+        156, 156, 160, 160, 156, 160, 156, 156,
+        160, 156, 156, 156, 156, 156, 156, 156,
+        156, 176, 172, 168, 164, 160, 156, 176,
+        172, 168, 164, 160, 156, 172, 168, 164,
+        160, 156, 168, 164, 160, 156, 164, 160,
+        156, 160, 156, 156, 176, 172, 168, 164,
+        160, 156, 172, 168, 164, 160, 156, 168,
+        164, 160, 156, 164, 160, 156, 160, 156,
+        156, 172, 168, 164, 160, 156, 168, 164,
+        160, 156, 164, 160, 156, 160, 156, 156,
+        168, 164, 160, 156, 164, 160, 156, 160,
+        156, 156, 164, 160, 156, 160, 156, 156,
+        160, 156, 156, 156, 172, 172, 168, 164,
+        160, 156, 172, 168, 164, 160, 156, 168,
+        164, 160, 156, 164, 160, 156, 160, 156,
+        156, 172, 168, 164, 160, 156, 168, 164,
+        160, 156, 164, 160, 156, 160, 156, 156,
+        168, 164, 160, 156, 164, 160, 156, 160,
+        156, 156, 164, 160, 156, 160, 156, 156,
+        160, 156, 156, 156, 168, 168, 164, 160,
+        156, 168, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 168, 164, 160, 156, 164,
+        160, 156, 160, 156, 156, 164, 160, 156,
+        160, 156, 156, 160, 156, 156, 156, 164,
+        164, 160, 156, 164, 160, 156, 160, 156,
+        156, 164, 160, 156, 160, 156, 156, 160,
+        156, 156, 156, 160, 160, 156, 160, 156,
+        156, 160, 156, 156, 156, 156, 156, 156,
+        156, 156, 172, 168, 164, 160, 156, 172,
+        168, 164, 160, 156, 168, 164, 160, 156,
+        164, 160, 156, 160, 156, 156, 172, 168,
+        164, 160, 156, 168, 164, 160, 156, 164,
+        160, 156, 160, 156, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 164,
+        160, 156, 160, 156, 156, 160, 156, 156,
+        156, 168, 168, 164, 160, 156, 168, 164,
+        160, 156, 164, 160, 156, 160, 156, 156,
+        168, 164, 160, 156, 164, 160, 156, 160,
+        156, 156, 164, 160, 156, 160, 156, 156,
+        160, 156, 156, 156, 164, 164, 160, 156,
+        164, 160, 156, 160, 156, 156, 164, 160,
+        156, 160, 156, 156, 160, 156, 156, 156,
+        160, 160, 156, 160, 156, 156, 160, 156,
+        156, 156, 156, 156, 156, 156, 156, 168,
+        164, 160, 156, 168, 164, 160, 156, 164,
+        160, 156, 160, 156, 156, 168, 164, 160,
+        156, 164, 160, 156, 160, 156, 156, 164,
+        160, 156, 160, 156, 156, 160, 156, 156,
+        156, 164, 164, 160, 156, 164, 160, 156,
+        160, 156, 156, 164, 160, 156, 160, 156,
+        156, 160, 156, 156, 156, 160, 160, 156,
+        160, 156, 156, 160, 156, 156, 156, 156,
+        156, 156, 156, 156, 164, 160, 156, 164,
+        160, 156, 160, 156, 156, 164, 160, 156,
+        160, 156, 156, 160, 156, 156, 156, 160,
+        160, 156, 160, 156, 156, 160, 156, 156,
+        156, 156, 156, 156, 156, 156, 160, 156,
+        160, 156, 156, 160, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156,
+        39780, 35760, 35760, 35760, 35760, 35760, 35760, 35760,
+        35760, 35760, 2560, 2304, 2048, 1792, 1536, 1280,
+        1024, 768, 512, 256, 0, 2304, 2048, 1792,
+        1536, 1280, 1024, 768, 512, 256, 0, 2048,
+        1792, 1536, 1280, 1024, 768, 512, 256, 0,
+        1792, 1536, 1280, 1024, 768, 512, 256, 0,
+        1536, 1280, 1024, 768, 512, 256, 0, 1280,
+        1024, 768, 512, 256, 0, 1024, 768, 512,
+        256, 0, 768, 512, 256, 0, 512, 256,
+        0, 256, 0, 0, 2560, 2304, 2048, 1792,
+        1536, 1280, 1024, 768, 512, 256, 0, 2304,
+        2048, 1792, 1536, 1280, 1024, 768, 512, 256,
+        0, 2048, 1792, 1536, 1280, 1024, 768, 512,
+        256, 0, 1792, 1536, 1280, 1024, 768, 512,
+        256, 0, 1536, 1280, 1024, 768, 512, 256,
+        0, 1280, 1024, 768, 512, 256, 0, 1024,
+        768, 512, 256, 0, 768, 512, 256, 0,
+        512, 256, 0, 256, 0, 0, 2560, 2304,
+        2048, 1792, 1536, 1280, 1024, 768, 512, 256,
+        0, 2304, 2048, 1792, 1536, 1280, 1024, 768,
+        512, 256, 0, 2048, 1792, 1536, 1280, 1024,
+        768, 512, 256, 0, 1792, 1536, 1280, 1024,
+        768, 512, 256, 0, 1536, 1280, 1024, 768,
+        512, 256, 0, 1280, 1024, 768, 512, 256,
+        0, 1024, 768, 512, 256, 0, 768, 512,
+        256, 0, 512, 256, 0, 256, 0, 0,
+        2560, 2304, 2048, 1792, 1536, 1280, 1024, 768,
+        512, 256, 0, 2304, 2048, 1792, 1536, 1280,
+        1024, 768, 512, 256, 0, 2048, 1792, 1536,
+        1280, 1024, 768, 512, 256, 0, 1792, 1536,
+        1280, 1024, 768, 512, 256, 0, 1536, 1280,
+        1024, 768, 512, 256, 0, 1280, 1024, 768,
+        512, 256, 0, 1024, 768, 512, 256, 0,
+        768, 512, 256, 0, 512, 256, 0, 256,
+        0, 0, 2560, 2304, 2048, 1792, 1536, 1280,
+        1024, 768, 512, 256, 0, 2304, 2048, 1792,
+        1536, 1280, 1024, 768, 512, 256, 0, 2048,
+        1792, 1536, 1280, 1024, 768, 512, 256, 0,
+        1792, 1536, 1280, 1024, 768, 512, 256, 0,
+        1536, 1280, 1024, 768, 512, 256, 0, 1280,
+        1024, 768, 512, 256, 0, 1024, 768, 512,
+        256, 0, 768, 512, 256, 0, 512, 256,
+        0, 256, 0, 0, 2560, 2304, 2048, 1792,
+        1536, 1280, 1024, 768, 512, 256, 0, 2304,
+        2048, 1792, 1536, 1280, 1024, 768, 512, 256,
+        0, 2048, 1792, 1536, 1280, 1024, 768, 512,
+        256, 0, 1792, 1536, 1280, 1024, 768, 512,
+        256, 0, 1536, 1280, 1024, 768, 512, 256,
+        0, 1280, 1024, 768, 512, 256, 0, 1024,
+        768, 512, 256, 0, 768, 512, 256, 0,
+        512, 256, 0, 256, 0, 0, 2560, 2304,
+        2048, 1792, 1536, 1280, 1024, 768, 512, 256,
+        0, 2304, 2048, 1792, 1536, 1280, 1024, 768,
+        512, 256, 0, 2048, 1792, 1536, 1280, 1024,
+        768, 512, 256, 0, 1792, 1536, 1280, 1024,
+        768, 512, 256, 0, 1536, 1280, 1024, 768,
+        512, 256, 0, 1280, 1024, 768, 512, 256,
+        0, 1024, 768, 512, 256, 0, 768, 512,
+        256, 0, 512, 256, 0, 256, 0, 0,
+        2560, 2304, 2048, 1792, 1536, 1280, 1024, 768,
+        512, 256, 0, 2304, 2048, 1792, 1536, 1280,
+        1024, 768, 512, 256, 0, 2048, 1792, 1536,
+        1280, 1024, 768, 512, 256, 0, 1792, 1536,
+        1280, 1024, 768, 512, 256, 0, 1536, 1280,
+        1024, 768, 512, 256, 0, 1280, 1024, 768,
+        512, 256, 0, 1024, 768, 512, 256, 0,
+        768, 512, 256, 0, 512, 256, 0, 256,
+        0, 0, 2560, 2304, 2048, 1792, 1536, 1280,
+        1024, 768, 512, 256, 0, 2304, 2048, 1792,
+        1536, 1280, 1024, 768, 512, 256, 0, 2048,
+        1792, 1536, 1280, 1024, 768, 512, 256, 0,
+        1792, 1536, 1280, 1024, 768, 512, 256, 0,
+        1536, 1280, 1024, 768, 512, 256, 0, 1280,
+        1024, 768, 512, 256, 0, 1024, 768, 512,
+        256, 0, 768, 512, 256, 0, 512, 256,
+        0, 256, 0, 0, 2560, 2304, 2048, 1792,
+        1536, 1280, 1024, 768, 512, 256, 0, 2304,
+        2048, 1792, 1536, 1280, 1024, 768, 512, 256,
+        0, 2048, 1792, 1536, 1280, 1024, 768, 512,
+        256, 0, 1792, 1536, 1280, 1024, 768, 512,
+        256, 0, 1536, 1280, 1024, 768, 512, 256,
+        0, 1280, 1024, 768, 512, 256, 0, 1024,
+        768, 512, 256, 0, 768, 512, 256, 0,
+        512, 256, 0, 256, 0, 0, 2560, 2304,
+        2048, 1792, 1536, 1280, 1024, 768, 512, 256,
+        0, 2304, 2048, 1792, 1536, 1280, 1024, 768,
+        512, 256, 0, 2048, 1792, 1536, 1280, 1024,
+        768, 512, 256, 0, 1792, 1536, 1280, 1024,
+        768, 512, 256, 0, 1536, 1280, 1024, 768,
+        512, 256, 0, 1280, 1024, 768, 512, 256,
+        0, 1024, 768, 512, 256, 0, 768, 512,
+        256, 0, 512, 256, 0, 256, 0, 0,
+        2560, 2304, 2048, 1792, 1536, 1280, 1024, 768,
+        512, 256, 0, 2304, 2048, 1792, 1536, 1280,
+        1024, 768, 512, 256, 0, 2048, 1792, 1536,
+        1280, 1024, 768, 512, 256, 0, 1792, 1536,
+        1280, 1024, 768, 512, 256, 0, 1536, 1280,
+        1024, 768, 512, 256, 0, 1280, 1024, 768,
+        512, 256, 0, 1024, 768, 512, 256, 0,
+        768, 512, 256, 0, 512, 256, 0, 256,
+        0, 0, 2560, 2304, 2048, 1792, 1536, 1280,
+        1024, 768, 512, 256, 0, 2304, 2048, 1792,
+        1536, 1280, 1024, 768, 512, 256, 0, 2048,
+        1792, 1536, 1280, 1024, 768, 512, 256, 0,
+        1792, 1536, 1280, 1024, 768, 512, 256, 0,
+        1536, 1280, 1024, 768, 512, 256, 0, 1280,
+        1024, 768, 512, 256, 0, 1024, 768, 512,
+        256, 0, 768, 512, 256, 0, 512, 256,
+        0, 256, 0, 0, 5976, 5400, 4824, 4248,
+        3672, 3096, 2520, 1944, 1368, 792, 216, 5760,
+        5400, 4824, 4248, 3672, 3096, 2520, 1944, 1368,
+        792, 216, 5760, 5184, 4824, 4248, 3672, 3096,
+        2520, 1944, 1368, 792, 216, 5760, 5184, 4608,
+        4248, 3672, 3096, 2520, 1944, 1368, 792, 216,
+        5760, 5184, 4608, 4032, 3672, 3096, 2520, 1944,
+        1368, 792, 216, 5760, 5184, 4608, 4032, 3456,
+        3096, 2520, 1944, 1368, 792, 216, 5760, 5184,
+        4608, 4032, 3456, 2880, 2520, 1944, 1368, 792,
+        216, 5760, 5184, 4608, 4032, 3456, 2880, 2304,
+        1944, 1368, 792, 216, 5760, 5184, 4608, 4032,
+        3456, 2880, 2304, 1728, 1368, 792, 216, 5760,
+        5184, 4608, 4032, 3456, 2880, 2304, 1728, 1152,
+        792, 216, 5760, 5184, 4608, 4032, 3456, 2880,
+        2304, 1728, 1152, 576, 216, 5760, 5184, 4608,
+        4032, 3456, 2880, 2304, 1728, 1152, 576, 0,
+        5760, 5400, 4824, 4248, 3672, 3096, 2520, 1944,
+        1368, 792, 216, 5760, 5184, 4824, 4248, 3672,
+        3096, 2520, 1944, 1368, 792, 216, 5760, 5184,
+        4608, 4248, 3672, 3096, 2520, 1944, 1368, 792,
+        216, 5760, 5184, 4608, 4032, 3672, 3096, 2520,
+        1944, 1368, 792, 216, 5760, 5184, 4608, 4032,
+        3456, 3096, 2520, 1944, 1368, 792, 216, 5760,
+        5184, 4608, 4032, 3456, 2880, 2520, 1944, 1368,
+        792, 216, 5760, 5184, 4608, 4032, 3456, 2880,
+        2304, 1944, 1368, 792, 216, 5760, 5184, 4608,
+        4032, 3456, 2880, 2304, 1728, 1368, 792, 216,
+        5760, 5184, 4608, 4032, 3456, 2880, 2304, 1728,
+        1152, 792, 216, 5760, 5184, 4608, 4032, 3456,
+        2880, 2304, 1728, 1152, 576, 216, 5760, 5184,
+        4608, 4032, 3456, 2880, 2304, 1728, 1152, 576,
+        0, 5760, 5184, 4824, 4248, 3672, 3096, 2520,
+        1944, 1368, 792, 216, 5760, 5184, 4608, 4248,
+        3672, 3096, 2520, 1944, 1368, 792, 216, 5760,
+        5184, 4608, 4032, 3672, 3096, 2520, 1944, 1368,
+        792, 216, 5760, 5184, 4608, 4032, 3456, 3096,
+        2520, 1944, 1368, 792, 216, 5760, 5184, 4608,
+        4032, 3456, 2880, 2520, 1944, 1368, 792, 216,
+        5760, 5184, 4608, 4032, 3456, 2880, 2304, 1944,
+        1368, 792, 216, 5760, 5184, 4608, 4032, 3456,
+        2880, 2304, 1728, 1368, 792, 216, 5760, 5184,
+        4608, 4032, 3456, 2880, 2304, 1728, 1152, 792,
+        216, 5760, 5184, 4608, 4032, 3456, 2880, 2304,
+        1728, 1152, 576, 216, 5760, 5184, 4608, 4032,
+        3456, 2880, 2304, 1728, 1152, 576, 0, 5760,
+        5184, 4608, 4248, 3672, 3096, 2520, 1944, 1368,
+        792, 216, 5760, 5184, 4608, 4032, 3672, 3096,
+        2520, 1944, 1368, 792, 216, 5760, 5184, 4608,
+        4032, 3456, 3096, 2520, 1944, 1368, 792, 216,
+        5760, 5184, 4608, 4032, 3456, 2880, 2520, 1944,
+        1368, 792, 216, 5760, 5184, 4608, 4032, 3456,
+        2880, 2304, 1944, 1368, 792, 216, 5760, 5184,
+        4608, 4032, 3456, 2880, 2304, 1728, 1368, 792,
+        216, 5760, 5184, 4608, 4032, 3456, 2880, 2304,
+        1728, 1152, 792, 216, 5760, 5184, 4608, 4032,
+        3456, 2880, 2304, 1728, 1152, 576, 216, 5760,
+        5184, 4608, 4032, 3456, 2880, 2304, 1728, 1152,
+        576, 0, 5760, 5184, 4608, 4032, 3672, 3096,
+        2520, 1944, 1368, 792, 216, 5760, 5184, 4608,
+        4032, 3456, 3096, 2520, 1944, 1368, 792, 216,
+        5760, 5184, 4608, 4032, 3456, 2880, 2520, 1944,
+        1368, 792, 216, 5760, 5184, 4608, 4032, 3456,
+        2880, 2304, 1944, 1368, 792, 216, 5760, 5184,
+        4608, 4032, 3456, 2880, 2304, 1728, 1368, 792,
+        216, 5760, 5184, 4608, 4032, 3456, 2880, 2304,
+        1728, 1152, 792, 216, 5760, 5184, 4608, 4032,
+        3456, 2880, 2304, 1728, 1152, 576, 216, 5760,
+        5184, 4608, 4032, 3456, 2880, 2304, 1728, 1152,
+        576, 0, 5760, 5184, 4608, 4032, 3456, 3096,
+        2520, 1944, 1368, 792, 216, 5760, 5184, 4608,
+        4032, 3456, 2880, 2520, 1944, 1368, 792, 216,
+        5760, 5184, 4608, 4032, 3456, 2880, 2304, 1944,
+        1368, 792, 216, 5760, 5184, 4608, 4032, 3456,
+        2880, 2304, 1728, 1368, 792, 216, 5760, 5184,
+        4608, 4032, 3456, 2880, 2304, 1728, 1152, 792,
+        216, 5760, 5184, 4608, 4032, 3456, 2880, 2304,
+        1728, 1152, 576, 216, 5760, 5184, 4608, 4032,
+        3456, 2880, 2304, 1728, 1152, 576, 0, 5760,
+        5184, 4608, 4032, 3456, 2880, 2520, 1944, 1368,
+        792, 216, 5760, 5184, 4608, 4032, 3456, 2880,
+        2304, 1944, 1368, 792, 216, 5760, 5184, 4608,
+        4032, 3456, 2880, 2304, 1728, 1368, 792, 216,
+        5760, 5184, 4608, 4032, 3456, 2880, 2304, 1728,
+        1152, 792, 216, 5760, 5184, 4608, 4032, 3456,
+        2880, 2304, 1728, 1152, 576, 216, 5760, 5184,
+        4608, 4032, 3456, 2880, 2304, 1728, 1152, 576,
+        0, 5760, 5184, 4608, 4032, 3456, 2880, 2304,
+        1944, 1368, 792, 216, 5760, 5184, 4608, 4032,
+        3456, 2880, 2304, 1728, 1368, 792, 216, 5760,
+        5184, 4608, 4032, 3456, 2880, 2304, 1728, 1152,
+        792, 216, 5760, 5184, 4608, 4032, 3456, 2880,
+        2304, 1728, 1152, 576, 216, 5760, 5184, 4608,
+        4032, 3456, 2880, 2304, 1728, 1152, 576, 0,
+        5760, 5184, 4608, 4032, 3456, 2880, 2304, 1728,
+        1368, 792, 216, 5760, 5184, 4608, 4032, 3456,
+        2880, 2304, 1728, 1152, 792, 216, 5760, 5184,
+        4608, 4032, 3456, 2880, 2304, 1728, 1152, 576,
+        216, 5760, 5184, 4608, 4032, 3456, 2880, 2304,
+        1728, 1152, 576, 0, 5760, 5184, 4608, 4032,
+        3456, 2880, 2304, 1728, 1152, 792, 216, 5760,
+        5184, 4608, 4032, 3456, 2880, 2304, 1728, 1152,
+        576, 216, 5760, 5184, 4608, 4032, 3456, 2880,
+        2304, 1728, 1152, 576, 0, 5760, 5184, 4608,
+        4032, 3456, 2880, 2304, 1728, 1152, 576, 216,
+        5760, 5184, 4608, 4032, 3456, 2880, 2304, 1728,
+        1152, 576, 0, 5760, 5184, 4608, 4032, 3456,
+        2880, 2304, 1728, 1152, 576, 0, 12192, 12192,
+        10668, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        12192, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        7620, 6096, 4572, 3048, 1524, 0, 6096, 4572,
+        3048, 1524, 0, 4572, 3048, 1524, 0, 3048,
+        1524, 0, 1524, 0, 0, 12192, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 7620, 6096, 4572, 3048, 1524, 0,
+        6096, 4572, 3048, 1524, 0, 4572, 3048, 1524,
+        0, 3048, 1524, 0, 1524, 0, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 4572, 3048,
+        1524, 0, 3048, 1524, 0, 1524, 0, 0,
+        3048, 1524, 0, 1524, 0, 0, 0, 0,
+        0, 0, 12192, 12192, 10668, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 12192, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 7620, 6096, 4572, 3048,
+        1524, 0, 6096, 4572, 3048, 1524, 0, 4572,
+        3048, 1524, 0, 3048, 1524, 0, 1524, 0,
+        0, 10668, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 7620, 6096,
+        4572, 3048, 1524, 0, 6096, 4572, 3048, 1524,
+        0, 4572, 3048, 1524, 0, 3048, 1524, 0,
+        1524, 0, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 4572, 3048, 1524, 0, 3048, 1524,
+        0, 1524, 0, 0, 3048, 1524, 0, 1524,
+        0, 0, 1524, 0, 0, 0, 12192, 12192,
+        10668, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        12192, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        7620, 6096, 4572, 3048, 1524, 0, 6096, 4572,
+        3048, 1524, 0, 4572, 3048, 1524, 0, 3048,
+        1524, 0, 1524, 0, 0, 10668, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 9144, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 7620, 6096, 4572, 3048, 1524, 0,
+        6096, 4572, 3048, 1524, 0, 4572, 3048, 1524,
+        0, 3048, 1524, 0, 1524, 0, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 4572, 3048,
+        1524, 0, 3048, 1524, 0, 1524, 0, 0,
+        3048, 1524, 0, 1524, 0, 0, 1524, 0,
+        0, 0, 12192, 12192, 10668, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 12192, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 7620, 6096, 4572, 3048,
+        1524, 0, 6096, 4572, 3048, 1524, 0, 4572,
+        3048, 1524, 0, 3048, 1524, 0, 1524, 0,
+        0, 10668, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 9144, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 7620, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 7620, 6096,
+        4572, 3048, 1524, 0, 6096, 4572, 3048, 1524,
+        0, 4572, 3048, 1524, 0, 3048, 1524, 0,
+        1524, 0, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 4572, 3048, 1524, 0, 3048, 1524,
+        0, 1524, 0, 0, 3048, 1524, 0, 1524,
+        0, 0, 1524, 0, 0, 0, 12192, 12192,
+        10668, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        12192, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        7620, 6096, 4572, 3048, 1524, 0, 6096, 4572,
+        3048, 1524, 0, 4572, 3048, 1524, 0, 3048,
+        1524, 0, 1524, 0, 0, 10668, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 9144, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 7620, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 6096, 6096, 4572, 3048, 1524, 0,
+        6096, 4572, 3048, 1524, 0, 4572, 3048, 1524,
+        0, 3048, 1524, 0, 1524, 0, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 4572, 3048,
+        1524, 0, 3048, 1524, 0, 1524, 0, 0,
+        3048, 1524, 0, 1524, 0, 0, 1524, 0,
+        0, 0, 13716, 12192, 10668, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 12192, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 7620, 6096, 4572, 3048,
+        1524, 0, 6096, 4572, 3048, 1524, 0, 4572,
+        3048, 1524, 0, 3048, 1524, 0, 1524, 0,
+        0, 10668, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 9144, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 7620, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 6096, 6096,
+        4572, 3048, 1524, 0, 6096, 4572, 3048, 1524,
+        0, 4572, 3048, 1524, 0, 3048, 1524, 0,
+        1524, 0, 0, 4572, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 4572, 3048, 1524, 0, 3048, 1524,
+        0, 1524, 0, 0, 3048, 1524, 0, 1524,
+        0, 0, 1524, 0, 0, 0, 13716, 12192,
+        10668, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        12192, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        7620, 6096, 4572, 3048, 1524, 0, 6096, 4572,
+        3048, 1524, 0, 4572, 3048, 1524, 0, 3048,
+        1524, 0, 1524, 0, 0, 12192, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 9144, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 7620, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 6096, 6096, 4572, 3048, 1524, 0,
+        6096, 4572, 3048, 1524, 0, 4572, 3048, 1524,
+        0, 3048, 1524, 0, 1524, 0, 0, 4572,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 3048, 3048,
+        1524, 0, 3048, 1524, 0, 1524, 0, 0,
+        3048, 1524, 0, 1524, 0, 0, 1524, 0,
+        0, 0, 13716, 12192, 10668, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 12192, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 7620, 6096, 4572, 3048,
+        1524, 0, 6096, 4572, 3048, 1524, 0, 4572,
+        3048, 1524, 0, 3048, 1524, 0, 1524, 0,
+        0, 12192, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 7620, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 6096, 6096,
+        4572, 3048, 1524, 0, 6096, 4572, 3048, 1524,
+        0, 4572, 3048, 1524, 0, 3048, 1524, 0,
+        1524, 0, 0, 4572, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 3048, 3048, 1524, 0, 3048, 1524,
+        0, 1524, 0, 0, 1524, 1524, 0, 1524,
+        0, 0, 1524, 0, 0, 0, 13716, 12192,
+        10668, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        12192, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        7620, 6096, 4572, 3048, 1524, 0, 6096, 4572,
+        3048, 1524, 0, 4572, 3048, 1524, 0, 3048,
+        1524, 0, 1524, 0, 0, 12192, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 6096, 6096, 4572, 3048, 1524, 0,
+        6096, 4572, 3048, 1524, 0, 4572, 3048, 1524,
+        0, 3048, 1524, 0, 1524, 0, 0, 4572,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 3048, 3048,
+        1524, 0, 3048, 1524, 0, 1524, 0, 0,
+        1524, 1524, 0, 1524, 0, 0, 0, 0,
+        0, 0, 13716, 12192, 10668, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 12192, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 7620, 6096, 4572, 3048,
+        1524, 0, 6096, 4572, 3048, 1524, 0, 4572,
+        3048, 1524, 0, 3048, 1524, 0, 0, 0,
+        0, 12192, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 7620, 6096,
+        4572, 3048, 1524, 0, 6096, 4572, 3048, 1524,
+        0, 4572, 3048, 1524, 0, 3048, 1524, 0,
+        1524, 0, 0, 4572, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 3048, 3048, 1524, 0, 3048, 1524,
+        0, 1524, 0, 0, 1524, 1524, 0, 1524,
+        0, 0, 0, 0, 0, 0, 13716, 12192,
+        10668, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        12192, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        7620, 6096, 4572, 3048, 1524, 0, 6096, 4572,
+        3048, 1524, 0, 4572, 3048, 1524, 0, 3048,
+        1524, 0, 0, 0, 0, 12192, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 7620, 6096, 4572, 3048, 1524, 0,
+        6096, 4572, 3048, 1524, 0, 4572, 3048, 1524,
+        0, 3048, 1524, 0, 1524, 0, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 3048, 3048,
+        1524, 0, 3048, 1524, 0, 1524, 0, 0,
+        1524, 1524, 0, 1524, 0, 0, 0, 0,
+        0, 0, 13716, 12192, 10668, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 12192, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 10668, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 9144, 7620, 6096,
+        4572, 3048, 1524, 0, 7620, 6096, 4572, 3048,
+        1524, 0, 6096, 4572, 3048, 1524, 0, 4572,
+        3048, 1524, 0, 3048, 1524, 0, 0, 0,
+        0, 12192, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 7620, 6096,
+        4572, 3048, 1524, 0, 6096, 4572, 3048, 1524,
+        0, 4572, 3048, 1524, 0, 3048, 1524, 0,
+        1524, 0, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 4572, 3048, 1524, 0, 3048, 1524,
+        0, 1524, 0, 0, 1524, 1524, 0, 1524,
+        0, 0, 0, 0, 0, 0, 13716, 12192,
+        10668, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        12192, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 10668, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 9144, 7620, 6096, 4572, 3048, 1524, 0,
+        7620, 6096, 4572, 3048, 1524, 0, 6096, 4572,
+        3048, 1524, 0, 4572, 3048, 1524, 0, 3048,
+        1524, 0, 0, 0, 0, 12192, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 10668, 9144,
+        7620, 6096, 4572, 3048, 1524, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 10668, 9144, 7620, 6096, 4572, 3048,
+        1524, 0, 9144, 7620, 6096, 4572, 3048, 1524,
+        0, 7620, 6096, 4572, 3048, 1524, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 9144, 7620,
+        6096, 4572, 3048, 1524, 0, 7620, 6096, 4572,
+        3048, 1524, 0, 6096, 4572, 3048, 1524, 0,
+        4572, 3048, 1524, 0, 3048, 1524, 0, 1524,
+        0, 0, 7620, 6096, 4572, 3048, 1524, 0,
+        6096, 4572, 3048, 1524, 0, 4572, 3048, 1524,
+        0, 3048, 1524, 0, 1524, 0, 0, 6096,
+        4572, 3048, 1524, 0, 4572, 3048, 1524, 0,
+        3048, 1524, 0, 1524, 0, 0, 4572, 3048,
+        1524, 0, 3048, 1524, 0, 1524, 0, 0,
+        3048, 1524, 0, 1524, 0, 0, 0, 0,
+        0, 0, 28140, 24120, 20100, 16080, 12060, 8040,
+        4020, 0, 28140, 24120, 20100, 16080, 12060, 8040,
+        4020, 0, 24120, 20100, 16080, 12060, 8040, 4020,
+        0, 20100, 16080, 12060, 8040, 4020, 0, 16080,
+        12060, 8040, 4020, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 28140, 24120,
+        20100, 16080, 12060, 8040, 4020, 0, 24120, 20100,
+        16080, 12060, 8040, 4020, 0, 20100, 16080, 12060,
+        8040, 4020, 0, 16080, 12060, 8040, 4020, 0,
+        12060, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 24120, 20100, 16080, 12060, 8040, 4020,
+        0, 20100, 16080, 12060, 8040, 4020, 0, 16080,
+        12060, 8040, 4020, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 20100, 16080,
+        12060, 8040, 4020, 0, 16080, 12060, 8040, 4020,
+        0, 12060, 8040, 4020, 0, 8040, 4020, 0,
+        4020, 0, 0, 16080, 12060, 8040, 4020, 0,
+        12060, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 12060, 8040, 4020, 0, 8040, 4020,
+        0, 4020, 0, 0, 8040, 4020, 0, 4020,
+        0, 0, 0, 0, 0, 0, 24120, 24120,
+        20100, 16080, 12060, 8040, 4020, 0, 24120, 20100,
+        16080, 12060, 8040, 4020, 0, 20100, 16080, 12060,
+        8040, 4020, 0, 16080, 12060, 8040, 4020, 0,
+        12060, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 24120, 20100, 16080, 12060, 8040, 4020,
+        0, 20100, 16080, 12060, 8040, 4020, 0, 16080,
+        12060, 8040, 4020, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 20100, 16080,
+        12060, 8040, 4020, 0, 16080, 12060, 8040, 4020,
+        0, 12060, 8040, 4020, 0, 8040, 4020, 0,
+        4020, 0, 0, 16080, 12060, 8040, 4020, 0,
+        12060, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 12060, 8040, 4020, 0, 8040, 4020,
+        0, 4020, 0, 0, 8040, 4020, 0, 4020,
+        0, 0, 0, 0, 0, 0, 20100, 20100,
+        16080, 12060, 8040, 4020, 0, 20100, 16080, 12060,
+        8040, 4020, 0, 16080, 12060, 8040, 4020, 0,
+        12060, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 20100, 16080, 12060, 8040, 4020, 0,
+        16080, 12060, 8040, 4020, 0, 12060, 8040, 4020,
+        0, 8040, 4020, 0, 4020, 0, 0, 16080,
+        12060, 8040, 4020, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 12060, 8040,
+        4020, 0, 8040, 4020, 0, 4020, 0, 0,
+        8040, 4020, 0, 4020, 0, 0, 0, 0,
+        0, 0, 16080, 16080, 12060, 8040, 4020, 0,
+        16080, 12060, 8040, 4020, 0, 12060, 8040, 4020,
+        0, 8040, 4020, 0, 4020, 0, 0, 16080,
+        12060, 8040, 4020, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 12060, 8040,
+        4020, 0, 8040, 4020, 0, 4020, 0, 0,
+        8040, 4020, 0, 4020, 0, 0, 0, 0,
+        0, 0, 12060, 12060, 8040, 4020, 0, 12060,
+        8040, 4020, 0, 8040, 4020, 0, 4020, 0,
+        0, 12060, 8040, 4020, 0, 8040, 4020, 0,
+        4020, 0, 0, 8040, 4020, 0, 4020, 0,
+        0, 0, 0, 0, 0, 8040, 8040, 4020,
+        0, 8040, 4020, 0, 4020, 0, 0, 8040,
+        4020, 0, 4020, 0, 0, 0, 0, 0,
+        0, 4020, 4020, 0, 4020, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 24120,
+        20100, 16080, 12060, 8040, 4020, 0, 24120, 20100,
+        16080, 12060, 8040, 4020, 0, 20100, 16080, 12060,
+        8040, 4020, 0, 16080, 12060, 8040, 4020, 0,
+        12060, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 24120, 20100, 16080, 12060, 8040, 4020,
+        0, 20100, 16080, 12060, 8040, 4020, 0, 16080,
+        12060, 8040, 4020, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 20100, 16080,
+        12060, 8040, 4020, 0, 16080, 12060, 8040, 4020,
+        0, 12060, 8040, 4020, 0, 8040, 4020, 0,
+        4020, 0, 0, 16080, 12060, 8040, 4020, 0,
+        12060, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 12060, 8040, 4020, 0, 8040, 4020,
+        0, 4020, 0, 0, 8040, 4020, 0, 4020,
+        0, 0, 4020, 0, 0, 0, 20100, 20100,
+        16080, 12060, 8040, 4020, 0, 20100, 16080, 12060,
+        8040, 4020, 0, 16080, 12060, 8040, 4020, 0,
+        12060, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 20100, 16080, 12060, 8040, 4020, 0,
+        16080, 12060, 8040, 4020, 0, 12060, 8040, 4020,
+        0, 8040, 4020, 0, 4020, 0, 0, 16080,
+        12060, 8040, 4020, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 12060, 8040,
+        4020, 0, 8040, 4020, 0, 4020, 0, 0,
+        8040, 4020, 0, 4020, 0, 0, 4020, 0,
+        0, 0, 16080, 16080, 12060, 8040, 4020, 0,
+        16080, 12060, 8040, 4020, 0, 12060, 8040, 4020,
+        0, 8040, 4020, 0, 4020, 0, 0, 16080,
+        12060, 8040, 4020, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 12060, 8040,
+        4020, 0, 8040, 4020, 0, 4020, 0, 0,
+        8040, 4020, 0, 4020, 0, 0, 4020, 0,
+        0, 0, 12060, 12060, 8040, 4020, 0, 12060,
+        8040, 4020, 0, 8040, 4020, 0, 4020, 0,
+        0, 12060, 8040, 4020, 0, 8040, 4020, 0,
+        4020, 0, 0, 8040, 4020, 0, 4020, 0,
+        0, 4020, 0, 0, 0, 8040, 8040, 4020,
+        0, 8040, 4020, 0, 4020, 0, 0, 8040,
+        4020, 0, 4020, 0, 0, 4020, 0, 0,
+        0, 4020, 4020, 0, 4020, 0, 0, 4020,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        20100, 16080, 12060, 8040, 4020, 0, 20100, 16080,
+        12060, 8040, 4020, 0, 16080, 12060, 8040, 4020,
+        0, 12060, 8040, 4020, 0, 8040, 4020, 0,
+        4020, 0, 0, 20100, 16080, 12060, 8040, 4020,
+        0, 16080, 12060, 8040, 4020, 0, 12060, 8040,
+        4020, 0, 8040, 4020, 0, 4020, 0, 0,
+        16080, 12060, 8040, 4020, 0, 12060, 8040, 4020,
+        0, 8040, 4020, 0, 4020, 0, 0, 12060,
+        8040, 4020, 0, 8040, 4020, 0, 4020, 0,
+        0, 8040, 4020, 0, 4020, 0, 0, 4020,
+        0, 0, 0, 16080, 16080, 12060, 8040, 4020,
+        0, 16080, 12060, 8040, 4020, 0, 12060, 8040,
+        4020, 0, 8040, 4020, 0, 4020, 0, 0,
+        16080, 12060, 8040, 4020, 0, 12060, 8040, 4020,
+        0, 8040, 4020, 0, 4020, 0, 0, 12060,
+        8040, 4020, 0, 8040, 4020, 0, 4020, 0,
+        0, 8040, 4020, 0, 4020, 0, 0, 4020,
+        0, 0, 0, 12060, 12060, 8040, 4020, 0,
+        12060, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 12060, 8040, 4020, 0, 8040, 4020,
+        0, 4020, 0, 0, 8040, 4020, 0, 4020,
+        0, 0, 4020, 0, 0, 0, 8040, 8040,
+        4020, 0, 8040, 4020, 0, 4020, 0, 0,
+        8040, 4020, 0, 4020, 0, 0, 4020, 0,
+        0, 0, 4020, 4020, 0, 4020, 0, 0,
+        4020, 0, 0, 0, 0, 0, 0, 0,
+        0, 16080, 12060, 8040, 4020, 0, 16080, 12060,
+        8040, 4020, 0, 12060, 8040, 4020, 0, 8040,
+        4020, 0, 4020, 0, 0, 16080, 12060, 8040,
+        4020, 0, 12060, 8040, 4020, 0, 8040, 4020,
+        0, 4020, 0, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 8040, 4020,
+        0, 4020, 0, 0, 4020, 0, 0, 0,
+        12060, 12060, 8040, 4020, 0, 12060, 8040, 4020,
+        0, 8040, 4020, 0, 4020, 0, 0, 12060,
+        8040, 4020, 0, 8040, 4020, 0, 4020, 0,
+        0, 8040, 4020, 0, 4020, 0, 0, 4020,
+        0, 0, 0, 8040, 8040, 4020, 0, 8040,
+        4020, 0, 4020, 0, 0, 8040, 4020, 0,
+        4020, 0, 0, 4020, 0, 0, 0, 4020,
+        4020, 0, 4020, 0, 0, 4020, 0, 0,
+        0, 0, 0, 0, 0, 0, 12060, 8040,
+        4020, 0, 12060, 8040, 4020, 0, 8040, 4020,
+        0, 4020, 0, 0, 12060, 8040, 4020, 0,
+        8040, 4020, 0, 4020, 0, 0, 8040, 4020,
+        0, 4020, 0, 0, 4020, 0, 0, 0,
+        8040, 8040, 4020, 0, 8040, 4020, 0, 4020,
+        0, 0, 8040, 4020, 0, 4020, 0, 0,
+        4020, 0, 0, 0, 4020, 4020, 0, 4020,
+        0, 0, 4020, 0, 0, 0, 0, 0,
+        0, 0, 0, 8040, 4020, 0, 8040, 4020,
+        0, 4020, 0, 0, 8040, 4020, 0, 4020,
+        0, 0, 4020, 0, 0, 0, 4020, 4020,
+        0, 4020, 0, 0, 4020, 0, 0, 0,
+        0, 0, 0, 0, 0, 4020, 0, 4020,
+        0, 0, 4020, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0,
+    },
+    /* 7 cards */
+    {
+        0, 4324, 4140, 4140, 4140, 4140, 4140, 4140,
+        4140, 4140, 4140, 4052, 3364, 2740, 2180, 1684,
+        1252, 884, 580, 340, 164, 52, 4, 4052,
+        3364, 2740, 2180, 1684, 1252, 884, 580, 340,
+        164, 52, 4, 4052, 3364, 2740, 2180, 1684,
+        1252, 884, 580, 340, 164, 52, 4, 4052,
+        3364, 2740, 2180, 1684, 1252, 884, 580, 340,
+        164, 52, 4, 4052, 3364, 2740, 2180, 1684,
+        1252, 884, 580, 340, 164, 52, 4, 4052,
+        3364, 2740, 2180, 1684, 1252, 884, 580, 340,
+        164, 52, 4, 4052, 3364, 2740, 2180, 1684,
+        1252, 884, 580, 340, 164, 52, 4, 4052,
+        3364, 2740, 2180, 1684, 1252, 884, 580, 340,
+        164, 52, 4, 4052, 3364, 2740, 2180, 1684,
+        1252, 884, 580, 340, 164, 52, 4, 4052,
+        3364, 2740, 2180, 1684, 1252, 884, 580, 340,
+        164, 52, 4, 4052, 3364, 2740, 2180, 1684,
+        1252, 884, 580, 340, 164, 52, 4, 4052,
+        3364, 2740, 2180, 1684, 1252, 884, 580, 340,
+        164, 52, 4, 4052, 3364, 2740, 2180, 1684,
+        1252, 884, 580, 340, 164, 52, 4, 23408,
+        23264, 23120, 22976, 22832, 22688, 22544, 22400, 22256,
+        22112, 21968, 21824, 22704, 23264, 23120, 22976, 22832,
+        22688, 22544, 22400, 22256, 22112, 21968, 21824, 22704,
+        22560, 23120, 22976, 22832, 22688, 22544, 22400, 22256,
+        22112, 21968, 21824, 22704, 22560, 22416, 22976, 22832,
+        22688, 22544, 22400, 22256, 22112, 21968, 21824, 22704,
+        22560, 22416, 22272, 22832, 22688, 22544, 22400, 22256,
+        22112, 21968, 21824, 22704, 22560, 22416, 22272, 22128,
+        22688, 22544, 22400, 22256, 22112, 21968, 21824, 22704,
+        22560, 22416, 22272, 22128, 21984, 22544, 22400, 22256,
+        22112, 21968, 21824, 22704, 22560, 22416, 22272, 22128,
+        21984, 21840, 22400, 22256, 22112, 21968, 21824, 22704,
+        22560, 22416, 22272, 22128, 21984, 21840, 21696, 22256,
+        22112, 21968, 21824, 22704, 22560, 22416, 22272, 22128,
+        21984, 21840, 21696, 21552, 22112, 21968, 21824, 22704,
+        22560, 22416, 22272, 22128, 21984, 21840, 21696, 21552,
+        21408, 21968, 21824, 22704, 22560, 22416, 22272, 22128,
+        21984, 21840, 21696, 21552, 21408, 21264, 21824, 22704,
+        22560, 22416, 22272, 22128, 21984, 21840, 21696, 21552,
+        21408, 21264, 21120, 4140, 3960, 3784, 3612, 3444,
+        3280, 3120, 2964, 4140, 3960, 3784, 3612, 3444,
+        3280, 3120, 2964, 3960, 3784, 3612, 3444, 3280,
+        3120, 2964, 3784, 3612, 3444, 3280, 3120, 2964,
+        3612, 3444, 3280, 3120, 2964, 3444, 3280, 3120,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 4136,
+        3960, 3784, 3612, 3444, 3280, 3120, 2964, 3960,
+        3784, 3612, 3444, 3280, 3120, 2964, 3784, 3612,
+        3444, 3280, 3120, 2964, 3612, 3444, 3280, 3120,
+        2964, 3444, 3280, 3120, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 3956, 3784, 3612, 3444, 3280,
+        3120, 2964, 3784, 3612, 3444, 3280, 3120, 2964,
+        3612, 3444, 3280, 3120, 2964, 3444, 3280, 3120,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 3780,
+        3612, 3444, 3280, 3120, 2964, 3612, 3444, 3280,
+        3120, 2964, 3444, 3280, 3120, 2964, 3276, 3120,
+        2964, 3120, 2964, 2964, 3608, 3444, 3280, 3120,
+        2964, 3444, 3280, 3120, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 3440, 3280, 3120, 2964, 3276,
+        3120, 2964, 3120, 2964, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 2964, 2964, 2964, 2964, 3960,
+        3960, 3784, 3612, 3444, 3280, 3120, 2964, 3960,
+        3784, 3612, 3444, 3280, 3120, 2964, 3784, 3612,
+        3444, 3280, 3120, 2964, 3612, 3444, 3280, 3120,
+        2964, 3444, 3280, 3120, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 3956, 3784, 3612, 3444, 3280,
+        3120, 2964, 3784, 3612, 3444, 3280, 3120, 2964,
+        3612, 3444, 3280, 3120, 2964, 3444, 3280, 3120,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 3780,
+        3612, 3444, 3280, 3120, 2964, 3612, 3444, 3280,
+        3120, 2964, 3444, 3280, 3120, 2964, 3276, 3120,
+        2964, 3120, 2964, 2964, 3608, 3444, 3280, 3120,
+        2964, 3444, 3280, 3120, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 3440, 3280, 3120, 2964, 3276,
+        3120, 2964, 3120, 2964, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 2964, 2964, 2964, 2964, 3784,
+        3784, 3612, 3444, 3280, 3120, 2964, 3784, 3612,
+        3444, 3280, 3120, 2964, 3612, 3444, 3280, 3120,
+        2964, 3444, 3280, 3120, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 3780, 3612, 3444, 3280, 3120,
+        2964, 3612, 3444, 3280, 3120, 2964, 3444, 3280,
+        3120, 2964, 3276, 3120, 2964, 3120, 2964, 2964,
+        3608, 3444, 3280, 3120, 2964, 3444, 3280, 3120,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 3440,
+        3280, 3120, 2964, 3276, 3120, 2964, 3120, 2964,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 2964,
+        2964, 2964, 2964, 3612, 3612, 3444, 3280, 3120,
+        2964, 3612, 3444, 3280, 3120, 2964, 3444, 3280,
+        3120, 2964, 3276, 3120, 2964, 3120, 2964, 2964,
+        3608, 3444, 3280, 3120, 2964, 3444, 3280, 3120,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 3440,
+        3280, 3120, 2964, 3276, 3120, 2964, 3120, 2964,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 2964,
+        2964, 2964, 2964, 3444, 3444, 3280, 3120, 2964,
+        3444, 3280, 3120, 2964, 3276, 3120, 2964, 3120,
+        2964, 2964, 3440, 3280, 3120, 2964, 3276, 3120,
+        2964, 3120, 2964, 2964, 3276, 3120, 2964, 3120,
+        2964, 2964, 2964, 2964, 2964, 2964, 3280, 3280,
+        3120, 2964, 3276, 3120, 2964, 3120, 2964, 2964,
+        3276, 3120, 2964, 3120, 2964, 2964, 2964, 2964,
+        2964, 2964, 3120, 3120, 2964, 3120, 2964, 2964,
+        2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964,
+        3960, 3784, 3612, 3444, 3280, 3120, 2964, 3960,
+        3784, 3612, 3444, 3280, 3120, 2964, 3784, 3612,
+        3444, 3280, 3120, 2964, 3612, 3444, 3280, 3120,
+        2964, 3444, 3280, 3120, 2964, 3280, 3120, 2964,
+        3120, 2964, 2964, 3956, 3784, 3612, 3444, 3280,
+        3120, 2964, 3784, 3612, 3444, 3280, 3120, 2964,
+        3612, 3444, 3280, 3120, 2964, 3444, 3280, 3120,
+        2964, 3280, 3120, 2964, 3120, 2964, 2964, 3780,
+        3612, 3444, 3280, 3120, 2964, 3612, 3444, 3280,
+        3120, 2964, 3444, 3280, 3120, 2964, 3280, 3120,
+        2964, 3120, 2964, 2964, 3608, 3444, 3280, 3120,
+        2964, 3444, 3280, 3120, 2964, 3280, 3120, 2964,
+        3120, 2964, 2964, 3440, 3280, 3120, 2964, 3280,
+        3120, 2964, 3120, 2964, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 3120, 2964, 2964, 2964, 3784,
+        3784, 3612, 3444, 3280, 3120, 2964, 3784, 3612,
+        3444, 3280, 3120, 2964, 3612, 3444, 3280, 3120,
+        2964, 3444, 3280, 3120, 2964, 3280, 3120, 2964,
+        3120, 2964, 2964, 3780, 3612, 3444, 3280, 3120,
+        2964, 3612, 3444, 3280, 3120, 2964, 3444, 3280,
+        3120, 2964, 3280, 3120, 2964, 3120, 2964, 2964,
+        3608, 3444, 3280, 3120, 2964, 3444, 3280, 3120,
+        2964, 3280, 3120, 2964, 3120, 2964, 2964, 3440,
+        3280, 3120, 2964, 3280, 3120, 2964, 3120, 2964,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 3120,
+        2964, 2964, 2964, 3612, 3612, 3444, 3280, 3120,
+        2964, 3612, 3444, 3280, 3120, 2964, 3444, 3280,
+        3120, 2964, 3280, 3120, 2964, 3120, 2964, 2964,
+        3608, 3444, 3280, 3120, 2964, 3444, 3280, 3120,
+        2964, 3280, 3120, 2964, 3120, 2964, 2964, 3440,
+        3280, 3120, 2964, 3280, 3120, 2964, 3120, 2964,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 3120,
+        2964, 2964, 2964, 3444, 3444, 3280, 3120, 2964,
+        3444, 3280, 3120, 2964, 3280, 3120, 2964, 3120,
+        2964, 2964, 3440, 3280, 3120, 2964, 3280, 3120,
+        2964, 3120, 2964, 2964, 3276, 3120, 2964, 3120,
+        2964, 2964, 3120, 2964, 2964, 2964, 3280, 3280,
+        3120, 2964, 3280, 3120, 2964, 3120, 2964, 2964,
+        3276, 3120, 2964, 3120, 2964, 2964, 3120, 2964,
+        2964, 2964, 3120, 3120, 2964, 3120, 2964, 2964,
+        3120, 2964, 2964, 2964, 2964, 2964, 2964, 2964,
+        2964, 3784, 3612, 3444, 3280, 3120, 2964, 3784,
+        3612, 3444, 3280, 3120, 2964, 3612, 3444, 3280,
+        3120, 2964, 3444, 3280, 3120, 2964, 3280, 3120,
+        2964, 3120, 2964, 2964, 3780, 3612, 3444, 3280,
+        3120, 2964, 3612, 3444, 3280, 3120, 2964, 3444,
+        3280, 3120, 2964, 3280, 3120, 2964, 3120, 2964,
+        2964, 3608, 3444, 3280, 3120, 2964, 3444, 3280,
+        3120, 2964, 3280, 3120, 2964, 3120, 2964, 2964,
+        3440, 3280, 3120, 2964, 3280, 3120, 2964, 3120,
+        2964, 2964, 3276, 3120, 2964, 3120, 2964, 2964,
+        3120, 2964, 2964, 2964, 3612, 3612, 3444, 3280,
+        3120, 2964, 3612, 3444, 3280, 3120, 2964, 3444,
+        3280, 3120, 2964, 3280, 3120, 2964, 3120, 2964,
+        2964, 3608, 3444, 3280, 3120, 2964, 3444, 3280,
+        3120, 2964, 3280, 3120, 2964, 3120, 2964, 2964,
+        3440, 3280, 3120, 2964, 3280, 3120, 2964, 3120,
+        2964, 2964, 3276, 3120, 2964, 3120, 2964, 2964,
+        3120, 2964, 2964, 2964, 3444, 3444, 3280, 3120,
+        2964, 3444, 3280, 3120, 2964, 3280, 3120, 2964,
+        3120, 2964, 2964, 3440, 3280, 3120, 2964, 3280,
+        3120, 2964, 3120, 2964, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 3120, 2964, 2964, 2964, 3280,
+        3280, 3120, 2964, 3280, 3120, 2964, 3120, 2964,
+        2964, 3276, 3120, 2964, 3120, 2964, 2964, 3120,
+        2964, 2964, 2964, 3120, 3120, 2964, 3120, 2964,
+        2964, 3120, 2964, 2964, 2964, 2964, 2964, 2964,
+        2964, 2964, 3612, 3444, 3280, 3120, 2964, 3612,
+        3444, 3280, 3120, 2964, 3444, 3280, 3120, 2964,
+        3280, 3120, 2964, 3120, 2964, 2964, 3608, 3444,
+        3280, 3120, 2964, 3444, 3280, 3120, 2964, 3280,
+        3120, 2964, 3120, 2964, 2964, 3440, 3280, 3120,
+        2964, 3280, 3120, 2964, 3120, 2964, 2964, 3276,
+        3120, 2964, 3120, 2964, 2964, 3120, 2964, 2964,
+        2964, 3444, 3444, 3280, 3120, 2964, 3444, 3280,
+        3120, 2964, 3280, 3120, 2964, 3120, 2964, 2964,
+        3440, 3280, 3120, 2964, 3280, 3120, 2964, 3120,
+        2964, 2964, 3276, 3120, 2964, 3120, 2964, 2964,
+        3120, 2964, 2964, 2964, 3280, 3280, 3120, 2964,
+        3280, 3120, 2964, 3120, 2964, 2964, 3276, 3120,
+        2964, 3120, 2964, 2964, 3120, 2964, 2964, 2964,
+        3120, 3120, 2964, 3120, 2964, 2964, 3120, 2964,
+        2964, 2964, 2964, 2964, 2964, 2964, 2964, 3444,
+        3280, 3120, 2964, 3444, 3280, 3120, 2964, 3280,
+        3120, 2964, 3120, 2964, 2964, 3440, 3280, 3120,
+        2964, 3280, 3120, 2964, 3120, 2964, 2964, 3276,
+        3120, 2964, 3120, 2964, 2964, 3120, 2964, 2964,
+        2964, 3280, 3280, 3120, 2964, 3280, 3120, 2964,
+        3120, 2964, 2964, 3276, 3120, 2964, 3120, 2964,
+        2964, 3120, 2964, 2964, 2964, 3120, 3120, 2964,
+        3120, 2964, 2964, 3120, 2964, 2964, 2964, 2964,
+        2964, 2964, 2964, 2964, 3280, 3120, 2964, 3280,
+        3120, 2964, 3120, 2964, 2964, 3276, 3120, 2964,
+        3120, 2964, 2964, 3120, 2964, 2964, 2964, 3120,
+        3120, 2964, 3120, 2964, 2964, 3120, 2964, 2964,
+        2964, 2964, 2964, 2964, 2964, 2964, 3120, 2964,
+        3120, 2964, 2964, 3120, 2964, 2964, 2964, 2964,
+        2964, 2964, 2964, 2964, 2964, 2964, 2964, 2964,
+        747980, 603560, 603560, 603560, 603560, 603560, 603560, 603560,
+        603560, 603560, 44528, 36432, 28336, 21252, 15180, 10120,
+        6072, 3036, 1012, 0, 0, 36432, 28336, 21252,
+        15180, 10120, 6072, 3036, 1012, 0, 0, 28336,
+        21252, 15180, 10120, 6072, 3036, 1012, 0, 0,
+        21252, 15180, 10120, 6072, 3036, 1012, 0, 0,
+        15180, 10120, 6072, 3036, 1012, 0, 0, 10120,
+        6072, 3036, 1012, 0, 0, 6072, 3036, 1012,
+        0, 0, 3036, 1012, 0, 0, 0, 0,
+        0, 0, 0, 0, 44528, 36432, 28336, 21252,
+        15180, 10120, 6072, 3036, 1012, 0, 0, 35420,
+        28336, 21252, 15180, 10120, 6072, 3036, 1012, 0,
+        0, 28336, 21252, 15180, 10120, 6072, 3036, 1012,
+        0, 0, 21252, 15180, 10120, 6072, 3036, 1012,
+        0, 0, 15180, 10120, 6072, 3036, 1012, 0,
+        0, 10120, 6072, 3036, 1012, 0, 0, 6072,
+        3036, 1012, 0, 0, 3036, 1012, 0, 0,
+        1012, 0, 0, 0, 0, 0, 44528, 36432,
+        28336, 21252, 15180, 10120, 6072, 3036, 1012, 0,
+        0, 35420, 28336, 21252, 15180, 10120, 6072, 3036,
+        1012, 0, 0, 27324, 21252, 15180, 10120, 6072,
+        3036, 1012, 0, 0, 21252, 15180, 10120, 6072,
+        3036, 1012, 0, 0, 15180, 10120, 6072, 3036,
+        1012, 0, 0, 10120, 6072, 3036, 1012, 0,
+        0, 6072, 3036, 1012, 0, 0, 3036, 1012,
+        0, 0, 1012, 0, 0, 0, 0, 0,
+        44528, 36432, 28336, 21252, 15180, 10120, 6072, 3036,
+        1012, 0, 0, 35420, 28336, 21252, 15180, 10120,
+        6072, 3036, 1012, 0, 0, 27324, 21252, 15180,
+        10120, 6072, 3036, 1012, 0, 0, 20240, 15180,
+        10120, 6072, 3036, 1012, 0, 0, 15180, 10120,
+        6072, 3036, 1012, 0, 0, 10120, 6072, 3036,
+        1012, 0, 0, 6072, 3036, 1012, 0, 0,
+        3036, 1012, 0, 0, 1012, 0, 0, 0,
+        0, 0, 44528, 36432, 28336, 21252, 15180, 10120,
+        6072, 3036, 1012, 0, 0, 35420, 28336, 21252,
+        15180, 10120, 6072, 3036, 1012, 0, 0, 27324,
+        21252, 15180, 10120, 6072, 3036, 1012, 0, 0,
+        20240, 15180, 10120, 6072, 3036, 1012, 0, 0,
+        14168, 10120, 6072, 3036, 1012, 0, 0, 10120,
+        6072, 3036, 1012, 0, 0, 6072, 3036, 1012,
+        0, 0, 3036, 1012, 0, 0, 1012, 0,
+        0, 0, 0, 0, 45540, 36432, 28336, 21252,
+        15180, 10120, 6072, 3036, 1012, 0, 0, 35420,
+        28336, 21252, 15180, 10120, 6072, 3036, 1012, 0,
+        0, 27324, 21252, 15180, 10120, 6072, 3036, 1012,
+        0, 0, 20240, 15180, 10120, 6072, 3036, 1012,
+        0, 0, 14168, 10120, 6072, 3036, 1012, 0,
+        0, 9108, 6072, 3036, 1012, 0, 0, 6072,
+        3036, 1012, 0, 0, 3036, 1012, 0, 0,
+        1012, 0, 0, 0, 0, 0, 45540, 36432,
+        28336, 21252, 15180, 10120, 6072, 3036, 1012, 0,
+        0, 36432, 28336, 21252, 15180, 10120, 6072, 3036,
+        1012, 0, 0, 27324, 21252, 15180, 10120, 6072,
+        3036, 1012, 0, 0, 20240, 15180, 10120, 6072,
+        3036, 1012, 0, 0, 14168, 10120, 6072, 3036,
+        1012, 0, 0, 9108, 6072, 3036, 1012, 0,
+        0, 5060, 3036, 1012, 0, 0, 3036, 1012,
+        0, 0, 1012, 0, 0, 0, 0, 0,
+        45540, 36432, 28336, 21252, 15180, 10120, 6072, 3036,
+        1012, 0, 0, 36432, 28336, 21252, 15180, 10120,
+        6072, 3036, 1012, 0, 0, 28336, 21252, 15180,
+        10120, 6072, 3036, 1012, 0, 0, 20240, 15180,
+        10120, 6072, 3036, 1012, 0, 0, 14168, 10120,
+        6072, 3036, 1012, 0, 0, 9108, 6072, 3036,
+        1012, 0, 0, 5060, 3036, 1012, 0, 0,
+        2024, 1012, 0, 0, 1012, 0, 0, 0,
+        0, 0, 45540, 36432, 28336, 21252, 15180, 10120,
+        6072, 3036, 1012, 0, 0, 36432, 28336, 21252,
+        15180, 10120, 6072, 3036, 1012, 0, 0, 28336,
+        21252, 15180, 10120, 6072, 3036, 1012, 0, 0,
+        21252, 15180, 10120, 6072, 3036, 1012, 0, 0,
+        14168, 10120, 6072, 3036, 1012, 0, 0, 9108,
+        6072, 3036, 1012, 0, 0, 5060, 3036, 1012,
+        0, 0, 2024, 1012, 0, 0, 0, 0,
+        0, 0, 0, 0, 45540, 36432, 28336, 21252,
+        15180, 10120, 6072, 3036, 0, 0, 0, 36432,
+        28336, 21252, 15180, 10120, 6072, 3036, 1012, 0,
+        0, 28336, 21252, 15180, 10120, 6072, 3036, 1012,
+        0, 0, 21252, 15180, 10120, 6072, 3036, 1012,
+        0, 0, 15180, 10120, 6072, 3036, 1012, 0,
+        0, 9108, 6072, 3036, 1012, 0, 0, 5060,
+        3036, 1012, 0, 0, 2024, 1012, 0, 0,
+        0, 0, 0, 0, 0, 0, 45540, 36432,
+        28336, 21252, 15180, 10120, 6072, 3036, 0, 0,
+        0, 36432, 28336, 21252, 15180, 10120, 6072, 3036,
+        1012, 0, 0, 28336, 21252, 15180, 10120, 6072,
+        3036, 1012, 0, 0, 21252, 15180, 10120, 6072,
+        3036, 1012, 0, 0, 15180, 10120, 6072, 3036,
+        1012, 0, 0, 10120, 6072, 3036, 1012, 0,
+        0, 5060, 3036, 1012, 0, 0, 2024, 1012,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        45540, 36432, 28336, 21252, 15180, 10120, 6072, 3036,
+        0, 0, 0, 36432, 28336, 21252, 15180, 10120,
+        6072, 3036, 1012, 0, 0, 28336, 21252, 15180,
+        10120, 6072, 3036, 1012, 0, 0, 21252, 15180,
+        10120, 6072, 3036, 1012, 0, 0, 15180, 10120,
+        6072, 3036, 1012, 0, 0, 10120, 6072, 3036,
+        1012, 0, 0, 6072, 3036, 1012, 0, 0,
+        2024, 1012, 0, 0, 0, 0, 0, 0,
+        0, 0, 45540, 36432, 28336, 21252, 15180, 10120,
+        6072, 3036, 0, 0, 0, 36432, 28336, 21252,
+        15180, 10120, 6072, 3036, 1012, 0, 0, 28336,
+        21252, 15180, 10120, 6072, 3036, 1012, 0, 0,
+        21252, 15180, 10120, 6072, 3036, 1012, 0, 0,
+        15180, 10120, 6072, 3036, 1012, 0, 0, 10120,
+        6072, 3036, 1012, 0, 0, 6072, 3036, 1012,
+        0, 0, 3036, 1012, 0, 0, 0, 0,
+        0, 0, 0, 0, 117072, 97200, 77328, 59724,
+        44388, 31320, 20520, 11988, 5724, 1728, 0, 108432,
+        97200, 77328, 59724, 44388, 31320, 20520, 11988, 5724,
+        1728, 0, 107568, 89424, 77328, 59724, 44388, 31320,
+        20520, 11988, 5724, 1728, 0, 106704, 88560, 70416,
+        59724, 44388, 31320, 20520, 11988, 5724, 1728, 0,
+        108108, 87696, 69552, 53676, 44388, 31320, 20520, 11988,
+        5724, 1728, 0, 107244, 86832, 68688, 52812, 39204,
+        31320, 20520, 11988, 5724, 1728, 0, 106380, 85968,
+        67824, 51948, 38340, 27000, 20520, 11988, 5724, 1728,
+        0, 105516, 85104, 66960, 51084, 37476, 26136, 17064,
+        11988, 5724, 1728, 0, 104652, 84240, 66096, 50220,
+        36612, 25272, 16200, 9396, 3456, 1728, 0, 103788,
+        83376, 65232, 49356, 35748, 24408, 15336, 8532, 1728,
+        1728, 0, 102924, 82512, 64368, 48492, 34884, 23544,
+        14472, 7668, 864, 864, 0, 102060, 81648, 63504,
+        47628, 34020, 22680, 13608, 6804, 0, 0, 0,
+        108432, 94932, 77328, 59724, 44388, 31320, 20520, 11988,
+        5724, 1728, 0, 107568, 87156, 77328, 59724, 44388,
+        31320, 20520, 11988, 5724, 1728, 0, 106704, 86292,
+        70416, 59724, 44388, 31320, 20520, 11988, 5724, 1728,
+        0, 108108, 85428, 69552, 53676, 44388, 31320, 20520,
+        11988, 5724, 1728, 0, 107244, 86832, 68688, 52812,
+        39204, 31320, 20520, 11988, 5724, 1728, 0, 106380,
+        85968, 67824, 51948, 38340, 27000, 20520, 11988, 5724,
+        1728, 0, 105516, 85104, 66960, 51084, 37476, 26136,
+        17064, 11988, 5724, 1728, 0, 104652, 84240, 66096,
+        50220, 36612, 25272, 16200, 9396, 5724, 1728, 0,
+        103788, 83376, 65232, 49356, 35748, 24408, 15336, 8532,
+        3996, 1728, 0, 102924, 82512, 64368, 48492, 34884,
+        23544, 14472, 7668, 3132, 864, 0, 102060, 81648,
+        63504, 47628, 34020, 22680, 13608, 6804, 2268, 0,
+        0, 107568, 87156, 75060, 59724, 44388, 31320, 20520,
+        11988, 5724, 1728, 0, 106704, 86292, 68148, 59724,
+        44388, 31320, 20520, 11988, 5724, 1728, 0, 108108,
+        85428, 67284, 53676, 44388, 31320, 20520, 11988, 5724,
+        1728, 0, 107244, 86832, 66420, 52812, 39204, 31320,
+        20520, 11988, 5724, 1728, 0, 106380, 85968, 67824,
+        51948, 38340, 27000, 20520, 11988, 5724, 1728, 0,
+        105516, 85104, 66960, 51084, 37476, 26136, 17064, 11988,
+        5724, 1728, 0, 104652, 84240, 66096, 50220, 36612,
+        25272, 16200, 9396, 5724, 1728, 0, 103788, 83376,
+        65232, 49356, 35748, 24408, 15336, 8532, 3996, 1728,
+        0, 102924, 82512, 64368, 48492, 34884, 23544, 14472,
+        7668, 3132, 864, 0, 102060, 81648, 63504, 47628,
+        34020, 22680, 13608, 6804, 2268, 0, 0, 106704,
+        86292, 68148, 57456, 44388, 31320, 20520, 11988, 5724,
+        1728, 0, 108108, 85428, 67284, 51408, 44388, 31320,
+        20520, 11988, 5724, 1728, 0, 107244, 86832, 66420,
+        50544, 39204, 31320, 20520, 11988, 5724, 1728, 0,
+        106380, 85968, 67824, 49680, 38340, 27000, 20520, 11988,
+        5724, 1728, 0, 105516, 85104, 66960, 51084, 37476,
+        26136, 17064, 11988, 5724, 1728, 0, 104652, 84240,
+        66096, 50220, 36612, 25272, 16200, 9396, 5724, 1728,
+        0, 103788, 83376, 65232, 49356, 35748, 24408, 15336,
+        8532, 3996, 1728, 0, 102924, 82512, 64368, 48492,
+        34884, 23544, 14472, 7668, 3132, 864, 0, 102060,
+        81648, 63504, 47628, 34020, 22680, 13608, 6804, 2268,
+        0, 0, 108108, 85428, 67284, 51408, 42120, 31320,
+        20520, 11988, 5724, 1728, 0, 107244, 86832, 66420,
+        50544, 36936, 31320, 20520, 11988, 5724, 1728, 0,
+        106380, 85968, 67824, 49680, 36072, 27000, 20520, 11988,
+        5724, 1728, 0, 105516, 85104, 66960, 51084, 35208,
+        26136, 17064, 11988, 5724, 1728, 0, 104652, 84240,
+        66096, 50220, 36612, 25272, 16200, 9396, 5724, 1728,
+        0, 103788, 83376, 65232, 49356, 35748, 24408, 15336,
+        8532, 3996, 1728, 0, 102924, 82512, 64368, 48492,
+        34884, 23544, 14472, 7668, 3132, 864, 0, 102060,
+        81648, 63504, 47628, 34020, 22680, 13608, 6804, 2268,
+        0, 0, 107244, 86832, 66420, 50544, 36936, 29052,
+        20520, 11988, 5724, 1728, 0, 106380, 85968, 67824,
+        49680, 36072, 24732, 20520, 11988, 5724, 1728, 0,
+        105516, 85104, 66960, 51084, 35208, 23868, 17064, 11988,
+        5724, 1728, 0, 104652, 84240, 66096, 50220, 36612,
+        23004, 16200, 9396, 5724, 1728, 0, 103788, 83376,
+        65232, 49356, 35748, 24408, 15336, 8532, 3996, 1728,
+        0, 102924, 82512, 64368, 48492, 34884, 23544, 14472,
+        7668, 3132, 864, 0, 102060, 81648, 63504, 47628,
+        34020, 22680, 13608, 6804, 2268, 0, 0, 106380,
+        85968, 67824, 49680, 36072, 24732, 18252, 11988, 5724,
+        1728, 0, 105516, 85104, 66960, 51084, 35208, 23868,
+        14796, 11988, 5724, 1728, 0, 104652, 84240, 66096,
+        50220, 36612, 23004, 13932, 9396, 5724, 1728, 0,
+        103788, 83376, 65232, 49356, 35748, 24408, 13068, 8532,
+        3996, 1728, 0, 102924, 82512, 64368, 48492, 34884,
+        23544, 14472, 7668, 3132, 864, 0, 102060, 81648,
+        63504, 47628, 34020, 22680, 13608, 6804, 2268, 0,
+        0, 105516, 85104, 66960, 51084, 35208, 23868, 14796,
+        9720, 5724, 1728, 0, 104652, 84240, 66096, 50220,
+        36612, 23004, 13932, 7128, 5724, 1728, 0, 103788,
+        83376, 65232, 49356, 35748, 24408, 13068, 6264, 3996,
+        1728, 0, 102924, 82512, 64368, 48492, 34884, 23544,
+        14472, 5400, 3132, 864, 0, 102060, 81648, 63504,
+        47628, 34020, 22680, 13608, 6804, 2268, 0, 0,
+        104652, 84240, 66096, 50220, 36612, 23004, 13932, 7128,
+        3456, 1728, 0, 103788, 83376, 65232, 49356, 35748,
+        24408, 13068, 6264, 1728, 1728, 0, 102924, 82512,
+        64368, 48492, 34884, 23544, 14472, 5400, 864, 864,
+        0, 102060, 81648, 63504, 47628, 34020, 22680, 13608,
+        6804, 0, 0, 0, 101520, 83376, 65232, 49356,
+        35748, 24408, 13068, 6264, 1728, 1728, 0, 100656,
+        82512, 64368, 48492, 34884, 23544, 14472, 5400, 864,
+        864, 0, 99792, 81648, 63504, 47628, 34020, 22680,
+        13608, 6804, 0, 0, 0, 100656, 82512, 64368,
+        48492, 34884, 23544, 14472, 5400, 864, 864, 0,
+        99792, 81648, 63504, 47628, 34020, 22680, 13608, 6804,
+        0, 0, 0, 99792, 81648, 63504, 47628, 34020,
+        22680, 13608, 6804, 0, 0, 0, 166320, 166320,
+        124740, 89100, 59400, 35640, 17820, 5940, 0, 0,
+        166320, 124740, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 124740, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 89100, 59400, 35640, 17820, 5940, 0, 0,
+        59400, 35640, 17820, 5940, 0, 0, 35640, 17820,
+        5940, 0, 0, 17820, 5940, 0, 0, 0,
+        0, 0, 0, 0, 0, 160380, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 118800, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 53460, 35640, 17820, 5940, 0, 0,
+        35640, 17820, 5940, 0, 0, 17820, 5940, 0,
+        0, 0, 0, 0, 0, 0, 0, 29700,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 11880, 5940,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 166320, 166320, 124740, 89100, 59400, 35640,
+        17820, 5940, 0, 0, 166320, 124740, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 124740, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 89100, 59400, 35640,
+        17820, 5940, 0, 0, 59400, 35640, 17820, 5940,
+        0, 0, 35640, 17820, 5940, 0, 0, 17820,
+        5940, 0, 0, 0, 0, 0, 0, 0,
+        0, 124740, 124740, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 124740, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 118800, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 83160, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 53460, 35640,
+        17820, 5940, 0, 0, 35640, 17820, 5940, 0,
+        0, 17820, 5940, 0, 0, 5940, 0, 0,
+        0, 0, 0, 29700, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 11880, 5940, 0, 0, 5940, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 166320, 166320,
+        124740, 89100, 59400, 35640, 17820, 5940, 0, 0,
+        160380, 124740, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 124740, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 89100, 59400, 35640, 17820, 5940, 0, 0,
+        59400, 35640, 17820, 5940, 0, 0, 35640, 17820,
+        5940, 0, 0, 17820, 5940, 0, 0, 0,
+        0, 0, 0, 0, 0, 124740, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 89100, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 53460, 35640, 17820, 5940, 0, 0,
+        35640, 17820, 5940, 0, 0, 17820, 5940, 0,
+        0, 5940, 0, 0, 0, 0, 0, 29700,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 11880, 5940,
+        0, 0, 5940, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 166320, 166320, 124740, 89100, 59400, 35640,
+        17820, 5940, 0, 0, 160380, 124740, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 118800, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 89100, 59400, 35640,
+        17820, 5940, 0, 0, 59400, 35640, 17820, 5940,
+        0, 0, 35640, 17820, 5940, 0, 0, 17820,
+        5940, 0, 0, 0, 0, 0, 0, 0,
+        0, 124740, 124740, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 118800, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 89100, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 59400, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 53460, 35640,
+        17820, 5940, 0, 0, 35640, 17820, 5940, 0,
+        0, 17820, 5940, 0, 0, 5940, 0, 0,
+        0, 0, 0, 29700, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 11880, 5940, 0, 0, 5940, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 166320, 166320,
+        124740, 89100, 59400, 35640, 17820, 5940, 0, 0,
+        160380, 124740, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 118800, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 83160, 59400, 35640, 17820, 5940, 0, 0,
+        59400, 35640, 17820, 5940, 0, 0, 35640, 17820,
+        5940, 0, 0, 17820, 5940, 0, 0, 0,
+        0, 0, 0, 0, 0, 124740, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 118800, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 89100, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 83160, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 59400, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 35640, 35640, 17820, 5940, 0, 0,
+        35640, 17820, 5940, 0, 0, 17820, 5940, 0,
+        0, 5940, 0, 0, 0, 0, 0, 29700,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 11880, 5940,
+        0, 0, 5940, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 207900, 166320, 124740, 89100, 59400, 35640,
+        17820, 5940, 0, 0, 160380, 124740, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 118800, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 83160, 59400, 35640,
+        17820, 5940, 0, 0, 53460, 35640, 17820, 5940,
+        0, 0, 35640, 17820, 5940, 0, 0, 17820,
+        5940, 0, 0, 0, 0, 0, 0, 0,
+        0, 124740, 124740, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 118800, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 83160, 59400, 35640, 17820, 5940, 0,
+        0, 53460, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 89100, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 53460, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 59400, 59400, 35640, 17820, 5940, 0,
+        0, 53460, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 35640, 35640,
+        17820, 5940, 0, 0, 35640, 17820, 5940, 0,
+        0, 17820, 5940, 0, 0, 5940, 0, 0,
+        0, 0, 0, 17820, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 11880, 5940, 0, 0, 5940, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 207900, 166320,
+        124740, 89100, 59400, 35640, 17820, 5940, 0, 0,
+        160380, 124740, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 118800, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 83160, 59400, 35640, 17820, 5940, 0, 0,
+        53460, 35640, 17820, 5940, 0, 0, 29700, 17820,
+        5940, 0, 0, 17820, 5940, 0, 0, 0,
+        0, 0, 0, 0, 0, 160380, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 118800, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 53460, 35640, 17820,
+        5940, 0, 0, 29700, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 89100, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 83160, 59400, 35640, 17820, 5940, 0,
+        0, 53460, 35640, 17820, 5940, 0, 0, 29700,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 59400, 59400,
+        35640, 17820, 5940, 0, 0, 53460, 35640, 17820,
+        5940, 0, 0, 29700, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 35640, 35640, 17820, 5940, 0, 0,
+        29700, 17820, 5940, 0, 0, 17820, 5940, 0,
+        0, 5940, 0, 0, 0, 0, 0, 17820,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 5940, 5940,
+        0, 0, 5940, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 207900, 166320, 124740, 89100, 59400, 35640,
+        17820, 5940, 0, 0, 166320, 124740, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 118800, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 83160, 59400, 35640,
+        17820, 5940, 0, 0, 53460, 35640, 17820, 5940,
+        0, 0, 29700, 17820, 5940, 0, 0, 11880,
+        5940, 0, 0, 0, 0, 0, 0, 0,
+        0, 160380, 124740, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 118800, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 83160, 59400, 35640, 17820, 5940, 0,
+        0, 53460, 35640, 17820, 5940, 0, 0, 29700,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 118800, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 53460, 35640, 17820,
+        5940, 0, 0, 29700, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 59400, 59400, 35640, 17820, 5940, 0,
+        0, 53460, 35640, 17820, 5940, 0, 0, 29700,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        5940, 0, 0, 0, 0, 0, 35640, 35640,
+        17820, 5940, 0, 0, 29700, 17820, 5940, 0,
+        0, 11880, 5940, 0, 0, 5940, 0, 0,
+        0, 0, 0, 17820, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 5940, 0, 0, 0,
+        0, 0, 5940, 5940, 0, 0, 5940, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 207900, 166320,
+        124740, 89100, 59400, 35640, 17820, 5940, 0, 0,
+        166320, 124740, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 124740, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 83160, 59400, 35640, 17820, 5940, 0, 0,
+        53460, 35640, 17820, 5940, 0, 0, 29700, 17820,
+        5940, 0, 0, 11880, 5940, 0, 0, 0,
+        0, 0, 0, 0, 0, 160380, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 53460, 35640, 17820,
+        5940, 0, 0, 29700, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 118800, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 83160, 59400, 35640, 17820, 5940, 0,
+        0, 53460, 35640, 17820, 5940, 0, 0, 29700,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 53460, 35640, 17820,
+        5940, 0, 0, 29700, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 35640, 35640, 17820, 5940, 0, 0,
+        29700, 17820, 5940, 0, 0, 11880, 5940, 0,
+        0, 0, 0, 0, 0, 0, 0, 17820,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 5940, 5940,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 207900, 166320, 124740, 89100, 59400, 35640,
+        17820, 0, 0, 0, 166320, 124740, 89100, 59400,
+        35640, 17820, 0, 0, 0, 124740, 89100, 59400,
+        35640, 17820, 0, 0, 0, 89100, 59400, 35640,
+        17820, 0, 0, 0, 53460, 35640, 17820, 0,
+        0, 0, 29700, 17820, 0, 0, 0, 11880,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 160380, 124740, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 124740, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 53460, 35640, 17820, 5940, 0, 0, 29700,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 118800, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 53460, 35640, 17820,
+        5940, 0, 0, 29700, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 83160, 59400, 35640, 17820, 5940, 0,
+        0, 53460, 35640, 17820, 5940, 0, 0, 29700,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 53460, 35640,
+        17820, 5940, 0, 0, 29700, 17820, 5940, 0,
+        0, 11880, 5940, 0, 0, 0, 0, 0,
+        0, 0, 0, 17820, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 5940, 5940, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 207900, 166320,
+        124740, 89100, 59400, 35640, 17820, 0, 0, 0,
+        166320, 124740, 89100, 59400, 35640, 17820, 0, 0,
+        0, 124740, 89100, 59400, 35640, 17820, 0, 0,
+        0, 89100, 59400, 35640, 17820, 0, 0, 0,
+        59400, 35640, 17820, 0, 0, 0, 29700, 17820,
+        0, 0, 0, 11880, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 160380, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 29700, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 118800, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 29700,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 29700, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 53460, 35640, 17820, 5940, 0, 0,
+        29700, 17820, 5940, 0, 0, 11880, 5940, 0,
+        0, 0, 0, 0, 0, 0, 0, 29700,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 5940, 5940,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 207900, 166320, 124740, 89100, 59400, 35640,
+        17820, 0, 0, 0, 166320, 124740, 89100, 59400,
+        35640, 17820, 0, 0, 0, 124740, 89100, 59400,
+        35640, 17820, 0, 0, 0, 89100, 59400, 35640,
+        17820, 0, 0, 0, 59400, 35640, 17820, 0,
+        0, 0, 35640, 17820, 0, 0, 0, 11880,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 160380, 124740, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 124740, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 118800, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 83160, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 11880, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 53460, 35640,
+        17820, 5940, 0, 0, 35640, 17820, 5940, 0,
+        0, 11880, 5940, 0, 0, 0, 0, 0,
+        0, 0, 0, 29700, 17820, 5940, 0, 0,
+        11880, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 11880, 5940, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 207900, 166320,
+        124740, 89100, 59400, 35640, 17820, 0, 0, 0,
+        166320, 124740, 89100, 59400, 35640, 17820, 0, 0,
+        0, 124740, 89100, 59400, 35640, 17820, 0, 0,
+        0, 89100, 59400, 35640, 17820, 0, 0, 0,
+        59400, 35640, 17820, 0, 0, 0, 35640, 17820,
+        0, 0, 0, 17820, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 160380, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 124740, 89100,
+        59400, 35640, 17820, 5940, 0, 0, 89100, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 118800, 89100, 59400, 35640, 17820, 5940,
+        0, 0, 89100, 59400, 35640, 17820, 5940, 0,
+        0, 59400, 35640, 17820, 5940, 0, 0, 35640,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 83160, 59400,
+        35640, 17820, 5940, 0, 0, 59400, 35640, 17820,
+        5940, 0, 0, 35640, 17820, 5940, 0, 0,
+        17820, 5940, 0, 0, 0, 0, 0, 0,
+        0, 0, 53460, 35640, 17820, 5940, 0, 0,
+        35640, 17820, 5940, 0, 0, 17820, 5940, 0,
+        0, 0, 0, 0, 0, 0, 0, 29700,
+        17820, 5940, 0, 0, 17820, 5940, 0, 0,
+        0, 0, 0, 0, 0, 0, 11880, 5940,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 326340, 233100, 155400, 93240, 46620, 15540,
+        0, 0, 326340, 233100, 155400, 93240, 46620, 15540,
+        0, 0, 233100, 155400, 93240, 46620, 15540, 0,
+        0, 155400, 93240, 46620, 15540, 0, 0, 93240,
+        46620, 15540, 0, 0, 46620, 15540, 0, 0,
+        0, 0, 0, 0, 0, 0, 310800, 233100,
+        155400, 93240, 46620, 15540, 0, 0, 233100, 155400,
+        93240, 46620, 15540, 0, 0, 155400, 93240, 46620,
+        15540, 0, 0, 93240, 46620, 15540, 0, 0,
+        46620, 15540, 0, 0, 0, 0, 0, 0,
+        0, 0, 217560, 155400, 93240, 46620, 15540, 0,
+        0, 155400, 93240, 46620, 15540, 0, 0, 93240,
+        46620, 15540, 0, 0, 46620, 15540, 0, 0,
+        0, 0, 0, 0, 0, 0, 139860, 93240,
+        46620, 15540, 0, 0, 93240, 46620, 15540, 0,
+        0, 46620, 15540, 0, 0, 0, 0, 0,
+        0, 0, 0, 77700, 46620, 15540, 0, 0,
+        46620, 15540, 0, 0, 0, 0, 0, 0,
+        0, 0, 31080, 15540, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 233100, 233100,
+        155400, 93240, 46620, 15540, 0, 0, 233100, 155400,
+        93240, 46620, 15540, 0, 0, 155400, 93240, 46620,
+        15540, 0, 0, 93240, 46620, 15540, 0, 0,
+        46620, 15540, 0, 0, 0, 0, 0, 0,
+        0, 0, 217560, 155400, 93240, 46620, 15540, 0,
+        0, 155400, 93240, 46620, 15540, 0, 0, 93240,
+        46620, 15540, 0, 0, 46620, 15540, 0, 0,
+        0, 0, 0, 0, 0, 0, 139860, 93240,
+        46620, 15540, 0, 0, 93240, 46620, 15540, 0,
+        0, 46620, 15540, 0, 0, 0, 0, 0,
+        0, 0, 0, 77700, 46620, 15540, 0, 0,
+        46620, 15540, 0, 0, 0, 0, 0, 0,
+        0, 0, 31080, 15540, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 155400, 155400,
+        93240, 46620, 15540, 0, 0, 155400, 93240, 46620,
+        15540, 0, 0, 93240, 46620, 15540, 0, 0,
+        46620, 15540, 0, 0, 0, 0, 0, 0,
+        0, 0, 139860, 93240, 46620, 15540, 0, 0,
+        93240, 46620, 15540, 0, 0, 46620, 15540, 0,
+        0, 0, 0, 0, 0, 0, 0, 77700,
+        46620, 15540, 0, 0, 46620, 15540, 0, 0,
+        0, 0, 0, 0, 0, 0, 31080, 15540,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 93240, 93240, 46620, 15540, 0, 0,
+        93240, 46620, 15540, 0, 0, 46620, 15540, 0,
+        0, 0, 0, 0, 0, 0, 0, 77700,
+        46620, 15540, 0, 0, 46620, 15540, 0, 0,
+        0, 0, 0, 0, 0, 0, 31080, 15540,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 46620, 46620, 15540, 0, 0, 46620,
+        15540, 0, 0, 0, 0, 0, 0, 0,
+        0, 31080, 15540, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 15540, 15540, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 233100,
+        155400, 93240, 46620, 15540, 0, 0, 233100, 155400,
+        93240, 46620, 15540, 0, 0, 155400, 93240, 46620,
+        15540, 0, 0, 93240, 46620, 15540, 0, 0,
+        46620, 15540, 0, 0, 15540, 0, 0, 0,
+        0, 0, 217560, 155400, 93240, 46620, 15540, 0,
+        0, 155400, 93240, 46620, 15540, 0, 0, 93240,
+        46620, 15540, 0, 0, 46620, 15540, 0, 0,
+        15540, 0, 0, 0, 0, 0, 139860, 93240,
+        46620, 15540, 0, 0, 93240, 46620, 15540, 0,
+        0, 46620, 15540, 0, 0, 15540, 0, 0,
+        0, 0, 0, 77700, 46620, 15540, 0, 0,
+        46620, 15540, 0, 0, 15540, 0, 0, 0,
+        0, 0, 31080, 15540, 0, 0, 15540, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 155400, 155400,
+        93240, 46620, 15540, 0, 0, 155400, 93240, 46620,
+        15540, 0, 0, 93240, 46620, 15540, 0, 0,
+        46620, 15540, 0, 0, 15540, 0, 0, 0,
+        0, 0, 139860, 93240, 46620, 15540, 0, 0,
+        93240, 46620, 15540, 0, 0, 46620, 15540, 0,
+        0, 15540, 0, 0, 0, 0, 0, 77700,
+        46620, 15540, 0, 0, 46620, 15540, 0, 0,
+        15540, 0, 0, 0, 0, 0, 31080, 15540,
+        0, 0, 15540, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 93240, 93240, 46620, 15540, 0, 0,
+        93240, 46620, 15540, 0, 0, 46620, 15540, 0,
+        0, 15540, 0, 0, 0, 0, 0, 77700,
+        46620, 15540, 0, 0, 46620, 15540, 0, 0,
+        15540, 0, 0, 0, 0, 0, 31080, 15540,
+        0, 0, 15540, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 46620, 46620, 15540, 0, 0, 46620,
+        15540, 0, 0, 15540, 0, 0, 0, 0,
+        0, 31080, 15540, 0, 0, 15540, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 15540, 15540, 0,
+        0, 15540, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        155400, 93240, 46620, 15540, 0, 0, 155400, 93240,
+        46620, 15540, 0, 0, 93240, 46620, 15540, 0,
+        0, 46620, 15540, 0, 0, 15540, 0, 0,
+        0, 0, 0, 139860, 93240, 46620, 15540, 0,
+        0, 93240, 46620, 15540, 0, 0, 46620, 15540,
+        0, 0, 15540, 0, 0, 0, 0, 0,
+        77700, 46620, 15540, 0, 0, 46620, 15540, 0,
+        0, 15540, 0, 0, 0, 0, 0, 31080,
+        15540, 0, 0, 15540, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 93240, 93240, 46620, 15540, 0,
+        0, 93240, 46620, 15540, 0, 0, 46620, 15540,
+        0, 0, 15540, 0, 0, 0, 0, 0,
+        77700, 46620, 15540, 0, 0, 46620, 15540, 0,
+        0, 15540, 0, 0, 0, 0, 0, 31080,
+        15540, 0, 0, 15540, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 46620, 46620, 15540, 0, 0,
+        46620, 15540, 0, 0, 15540, 0, 0, 0,
+        0, 0, 31080, 15540, 0, 0, 15540, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 15540, 15540,
+        0, 0, 15540, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 93240, 46620, 15540, 0, 0, 93240, 46620,
+        15540, 0, 0, 46620, 15540, 0, 0, 15540,
+        0, 0, 0, 0, 0, 77700, 46620, 15540,
+        0, 0, 46620, 15540, 0, 0, 15540, 0,
+        0, 0, 0, 0, 31080, 15540, 0, 0,
+        15540, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        46620, 46620, 15540, 0, 0, 46620, 15540, 0,
+        0, 15540, 0, 0, 0, 0, 0, 31080,
+        15540, 0, 0, 15540, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 15540, 15540, 0, 0, 15540,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 46620, 15540,
+        0, 0, 46620, 15540, 0, 0, 15540, 0,
+        0, 0, 0, 0, 31080, 15540, 0, 0,
+        15540, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        15540, 15540, 0, 0, 15540, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 15540, 0, 0, 15540, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0,
+    },
+    /* PLO4 */
+    {
+        0, 1548, 1448, 1464, 1480, 1499, 1440, 1537,
+        1519, 1478, 1477, 1466, 1229, 1024, 810, 640,
+        481, 308, 204, 127, 62, 29, 1, 1441,
+        1266, 956, 803, 562, 468, 345, 215, 116,
+        63, 12, 3, 1444, 1189, 1016, 789, 593,
+        442, 338, 197, 112, 67, 20, 2, 1494,
+        1207, 979, 767, 629, 432, 311, 233, 125,
+        65, 18, 3, 1449, 1209, 953, 741, 589,
+        446, 344, 205, 117, 60, 14, 1, 1511,
+        1203, 971, 732, 645, 463, 304, 201, 133,
+        52, 16, 2, 1386, 1147, 1021, 788, 593,
+        434, 364, 216, 111, 59, 17, 4, 1414,
+        1188, 1007, 793, 596, 407, 315, 189, 129,
+        69, 24, 0, 1452, 1216, 1004, 765, 581,
+        464, 301, 204, 125, 54, 19, 3, 1393,
+        1182, 1046, 779, 632, 449, 293, 227, 112,
+        61, 17, 1, 1375, 1173, 982, 756, 623,
+        476, 302, 192, 97, 65, 15, 2, 1452,
+        1158, 968, 802, 593, 447, 308, 196, 117,
+        66, 20, 1, 1467, 1175, 956, 792, 553,
+        462, 304, 184, 116, 54, 21, 1, 7924,
+        7774, 7592, 7538, 7279, 7231, 7021, 7051, 6865,
+        6764, 6673, 6451, 6949, 7772, 7651, 7692, 7515,
+        7191, 7085, 6999, 6917, 6776, 6739, 6250, 7249,
+        6982, 7769, 7575, 7431, 7206, 7151, 6806, 6824,
+        6738, 6580, 6721, 7111, 6994, 6921, 7569, 7567,
+        7218, 7248, 7023, 7034, 6871, 6731, 6435, 7081,
+        6893, 7175, 6765, 7304, 7254, 7157, 7080, 6852,
+        6812, 6683, 6553, 7058, 7014, 6914, 6647, 6641,
+        7360, 7156, 7030, 6996, 6862, 6585, 6560, 7104,
+        6959, 6901, 6783, 6621, 6560, 7197, 7119, 6879,
+        6792, 6666, 6431, 7034, 6882, 6888, 6811, 6685,
+        6471, 6348, 7073, 6929, 6663, 6608, 6518, 7220,
+        6921, 6959, 6816, 6673, 6533, 6298, 6365, 6962,
+        6747, 6616, 6542, 7176, 7054, 6873, 6820, 6719,
+        6466, 6374, 6342, 6165, 6840, 6593, 6515, 7051,
+        6966, 6837, 6724, 6540, 6447, 6353, 6168, 6219,
+        5941, 6764, 6553, 7189, 7102, 6871, 6832, 6633,
+        6504, 6339, 6412, 5943, 6138, 6059, 6635, 7169,
+        6869, 6848, 6737, 6677, 6413, 6370, 6388, 6131,
+        6081, 5876, 5880, 1481, 1361, 1336, 1272, 1244,
+        1179, 1045, 1010, 1415, 1327, 1287, 1235, 1165,
+        1126, 1041, 1031, 1288, 1240, 1142, 1075, 1114,
+        1064, 998, 1242, 1162, 1095, 1033, 1042, 952,
+        1090, 1067, 1015, 941, 935, 990, 936, 1017,
+        897, 954, 960, 871, 885, 835, 751, 1413,
+        1304, 1234, 1232, 1158, 1167, 1037, 935, 1352,
+        1205, 1110, 1130, 1024, 1021, 957, 1175, 1153,
+        1087, 1065, 1001, 933, 1132, 1058, 990, 933,
+        942, 1047, 996, 917, 889, 948, 905, 857,
+        919, 861, 836, 1296, 1224, 1177, 1112, 1038,
+        1006, 881, 1187, 1135, 1046, 1061, 935, 909,
+        1147, 1034, 990, 985, 883, 1049, 971, 921,
+        897, 928, 920, 845, 901, 797, 833, 1164,
+        1164, 1026, 1030, 990, 923, 1039, 1038, 977,
+        945, 895, 1065, 936, 900, 845, 913, 926,
+        809, 872, 845, 781, 1031, 987, 986, 887,
+        900, 970, 907, 914, 873, 860, 828, 810,
+        848, 835, 803, 984, 930, 854, 834, 895,
+        830, 804, 825, 793, 764, 863, 858, 769,
+        805, 742, 749, 787, 723, 684, 713, 1344,
+        1252, 1280, 1136, 1131, 1044, 1024, 949, 1240,
+        1156, 1150, 1156, 1060, 957, 983, 1219, 1155,
+        1033, 1038, 1026, 930, 1121, 1064, 999, 991,
+        862, 1052, 1012, 948, 819, 912, 850, 824,
+        926, 837, 828, 1247, 1202, 1128, 1096, 1004,
+        981, 977, 1182, 1099, 1075, 1018, 940, 948,
+        1098, 1043, 991, 910, 887, 1031, 959, 902,
+        892, 906, 905, 833, 846, 804, 746, 1122,
+        1104, 1019, 946, 942, 922, 1079, 1044, 1007,
+        930, 878, 952, 940, 928, 834, 989, 912,
+        866, 830, 822, 813, 1049, 996, 943, 909,
+        889, 984, 960, 843, 834, 882, 837, 835,
+        802, 754, 785, 977, 900, 905, 793, 875,
+        891, 833, 840, 817, 756, 894, 871, 808,
+        798, 771, 720, 774, 724, 705, 719, 1123,
+        1150, 1111, 1192, 1076, 973, 932, 1142, 1115,
+        1061, 956, 988, 893, 1107, 1031, 939, 949,
+        886, 1035, 988, 887, 868, 930, 859, 819,
+        830, 827, 744, 1162, 1105, 1076, 1028, 946,
+        870, 1115, 1007, 999, 890, 856, 991, 891,
+        900, 856, 882, 871, 801, 828, 784, 768,
+        1046, 1036, 899, 930, 834, 954, 916, 879,
+        817, 867, 850, 828, 787, 757, 750, 975,
+        897, 835, 824, 886, 761, 785, 838, 797,
+        756, 857, 810, 784, 832, 750, 719, 735,
+        729, 747, 691, 1028, 1056, 1081, 957, 936,
+        888, 1060, 1032, 970, 888, 858, 981, 947,
+        903, 804, 895, 910, 822, 798, 799, 698,
+        1087, 1000, 931, 957, 877, 1008, 952, 908,
+        827, 918, 806, 801, 846, 840, 761, 995,
+        902, 866, 819, 903, 868, 839, 762, 776,
+        798, 890, 875, 733, 841, 772, 783, 718,
+        679, 682, 691, 993, 949, 946, 895, 862,
+        926, 935, 876, 870, 897, 856, 734, 815,
+        811, 738, 919, 903, 859, 809, 885, 815,
+        758, 803, 762, 756, 884, 805, 796, 797,
+        757, 673, 736, 689, 692, 758, 871, 836,
+        825, 812, 881, 808, 840, 823, 709, 767,
+        844, 852, 836, 786, 721, 723, 672, 708,
+        670, 690, 788, 737, 776, 788, 740, 714,
+        828, 732, 667, 738, 682, 680, 674, 703,
+        1258, 1234, 1173, 1083, 1104, 1036, 978, 1241,
+        1207, 1098, 1106, 1058, 1046, 939, 1214, 1102,
+        1113, 1088, 996, 911, 1131, 1068, 991, 946,
+        882, 1065, 977, 945, 856, 888, 865, 782,
+        896, 764, 797, 1217, 1214, 1131, 1122, 1061,
+        950, 986, 1186, 1133, 1016, 1046, 968, 907,
+        1128, 1029, 1050, 950, 934, 1031, 963, 926,
+        876, 905, 896, 826, 854, 800, 763, 1157,
+        1070, 1028, 998, 961, 900, 1078, 1033, 951,
+        893, 849, 975, 919, 893, 834, 966, 911,
+        787, 892, 802, 756, 1072, 1003, 912, 895,
+        857, 983, 917, 918, 828, 913, 830, 776,
+        809, 786, 732, 993, 907, 891, 858, 922,
+        891, 793, 818, 754, 725, 871, 872, 796,
+        830, 777, 752, 826, 739, 724, 741, 1208,
+        1173, 1148, 1081, 1019, 1003, 892, 1160, 1104,
+        1092, 1023, 1029, 892, 1129, 1014, 994, 875,
+        892, 960, 943, 875, 892, 934, 857, 817,
+        814, 839, 816, 1083, 1070, 1082, 996, 999,
+        869, 1052, 1028, 973, 903, 906, 1031, 996,
+        847, 927, 900, 891, 775, 906, 769, 807,
+        1047, 1019, 969, 895, 919, 952, 952, 857,
+        826, 908, 839, 844, 855, 823, 818, 1017,
+        953, 885, 826, 852, 834, 800, 839, 759,
+        761, 897, 805, 763, 814, 728, 740, 798,
+        755, 765, 700, 1160, 1052, 1064, 1013, 948,
+        909, 1034, 987, 984, 949, 866, 1018, 951,
+        863, 856, 904, 902, 836, 860, 809, 769,
+        1029, 1029, 976, 869, 967, 878, 870, 889,
+        829, 861, 827, 781, 781, 830, 759, 960,
+        985, 906, 758, 890, 873, 793, 867, 737,
+        797, 859, 849, 782, 803, 726, 712, 774,
+        746, 719, 752, 1021, 954, 1019, 849, 863,
+        883, 887, 846, 810, 844, 912, 796, 829,
+        773, 796, 925, 882, 893, 813, 871, 856,
+        834, 768, 700, 736, 848, 787, 800, 810,
+        762, 761, 778, 750, 678, 679, 925, 880,
+        848, 840, 832, 838, 751, 818, 766, 743,
+        843, 820, 739, 785, 781, 716, 759, 751,
+        716, 741, 758, 777, 785, 743, 746, 684,
+        735, 741, 709, 695, 690, 726, 680, 741,
+        675, 1197, 1159, 1069, 993, 965, 915, 1124,
+        1108, 1020, 1005, 991, 824, 1056, 1000, 949,
+        976, 901, 1032, 1023, 913, 829, 914, 878,
+        838, 852, 820, 771, 1092, 1085, 1035, 1058,
+        900, 910, 1072, 1011, 988, 925, 878, 1010,
+        922, 953, 811, 875, 894, 837, 823, 820,
+        801, 999, 1079, 1014, 934, 895, 947, 941,
+        904, 852, 856, 894, 852, 835, 808, 788,
+        993, 878, 876, 789, 862, 829, 799, 808,
+        796, 776, 852, 857, 780, 807, 766, 773,
+        748, 747, 697, 723, 1102, 1098, 1009, 957,
+        969, 847, 1123, 1013, 967, 937, 817, 929,
+        958, 897, 833, 906, 823, 780, 846, 835,
+        757, 1028, 1027, 872, 907, 888, 930, 892,
+        886, 820, 899, 859, 831, 797, 809, 750,
+        982, 907, 842, 872, 879, 817, 834, 839,
+        748, 751, 861, 792, 738, 829, 760, 736,
+        791, 735, 719, 704, 994, 986, 915, 863,
+        801, 905, 907, 888, 822, 860, 810, 818,
+        864, 817, 739, 956, 898, 877, 841, 845,
+        876, 783, 778, 741, 784, 874, 825, 768,
+        839, 781, 725, 807, 730, 714, 701, 898,
+        865, 793, 830, 845, 795, 814, 851, 742,
+        740, 855, 822, 784, 735, 729, 766, 808,
+        729, 731, 708, 812, 774, 759, 705, 742,
+        714, 783, 689, 699, 644, 737, 694, 705,
+        713, 689, 1057, 1071, 974, 936, 903, 1075,
+        1035, 1054, 968, 825, 977, 887, 877, 862,
+        902, 866, 809, 885, 746, 779, 1013, 1001,
+        949, 911, 844, 963, 905, 931, 825, 897,
+        855, 811, 848, 790, 759, 895, 874, 841,
+        797, 874, 833, 804, 836, 759, 700, 886,
+        808, 751, 815, 720, 741, 808, 705, 715,
+        697, 1060, 1009, 948, 877, 811, 964, 947,
+        871, 802, 912, 824, 797, 850, 745, 657,
+        959, 884, 814, 767, 858, 808, 838, 803,
+        775, 716, 839, 796, 792, 756, 769, 735,
+        750, 730, 688, 703, 904, 880, 818, 809,
+        877, 806, 789, 819, 767, 733, 845, 773,
+        763, 793, 746, 716, 796, 730, 731, 723,
+        836, 825, 747, 778, 760, 710, 793, 816,
+        705, 636, 738, 710, 676, 695, 742, 952,
+        927, 896, 843, 902, 998, 874, 810, 905,
+        813, 793, 785, 791, 700, 945, 961, 847,
+        847, 861, 865, 772, 788, 748, 744, 844,
+        806, 803, 769, 720, 703, 810, 713, 725,
+        649, 882, 862, 836, 810, 853, 832, 797,
+        773, 748, 721, 780, 815, 802, 816, 728,
+        704, 757, 707, 691, 672, 846, 787, 812,
+        809, 751, 711, 781, 782, 745, 660, 672,
+        704, 677, 691, 696, 869, 843, 803, 842,
+        855, 773, 788, 776, 703, 903, 795, 780,
+        731, 708, 752, 788, 734, 670, 716, 795,
+        810, 780, 805, 725, 752, 742, 748, 698,
+        722, 751, 671, 740, 688, 696, 821, 751,
+        777, 732, 710, 775, 730, 676, 643, 712,
+        703, 735, 736, 693, 679, 651, 681, 658,
+        243638, 187102, 182936, 183258, 182857, 182587, 183116, 182088,
+        182861, 182560, 11177, 9480, 7622, 5828, 4321, 3036,
+        1977, 976, 409, 118, 14, 8551, 6970, 5173,
+        3966, 2641, 1647, 853, 347, 114, 9, 5996,
+        4529, 3297, 2314, 1511, 709, 289, 76, 7,
+        3979, 2949, 1987, 1210, 584, 221, 45, 8,
+        2640, 1728, 1130, 542, 236, 36, 8, 1503,
+        988, 461, 186, 22, 1, 809, 375, 148,
+        5, 0, 360, 128, 3, 2, 71, 0,
+        0, 0, 0, 0, 11369, 9337, 7587, 6082,
+        4378, 2964, 1939, 1038, 476, 120, 8, 7864,
+        6453, 5358, 3924, 2679, 1650, 887, 382, 99,
+        3, 5831, 4540, 3455, 2363, 1446, 797, 360,
+        70, 5, 3945, 3092, 2081, 1268, 672, 294,
+        57, 5, 2605, 1754, 1081, 613, 256, 43,
+        1, 1581, 1024, 501, 185, 25, 3, 773,
+        451, 177, 14, 3, 377, 121, 7, 0,
+        127, 1, 1, 0, 0, 0, 11240, 9318,
+        7553, 5909, 4324, 2977, 1939, 1035, 426, 124,
+        12, 7971, 6540, 5241, 3822, 2628, 1664, 912,
+        411, 100, 5, 5257, 4389, 3383, 2355, 1438,
+        800, 338, 78, 5, 3986, 2882, 2055, 1220,
+        667, 273, 57, 5, 2515, 1828, 1108, 596,
+        228, 34, 10, 1489, 1015, 497, 193, 25,
+        3, 855, 439, 169, 5, 2, 399, 135,
+        10, 1, 156, 2, 0, 0, 0, 0,
+        11344, 9237, 7578, 5931, 4222, 3062, 1857, 992,
+        466, 117, 16, 7840, 6399, 5038, 3795, 2587,
+        1643, 904, 373, 92, 9, 5289, 4149, 3290,
+        2318, 1514, 805, 334, 71, 9, 3536, 2640,
+        2064, 1277, 697, 284, 49, 4, 2516, 1763,
+        1068, 607, 248, 36, 5, 1516, 971, 508,
+        190, 16, 4, 808, 453, 194, 16, 1,
+        392, 140, 8, 1, 141, 1, 1, 0,
+        0, 0, 11273, 9232, 7297, 5763, 4324, 3115,
+        1956, 1001, 453, 116, 19, 7696, 6172, 4937,
+        3852, 2608, 1630, 930, 390, 90, 2, 5284,
+        4310, 3284, 2243, 1504, 790, 341, 56, 10,
+        3426, 2728, 1987, 1249, 694, 258, 48, 2,
+        2228, 1705, 1087, 587, 228, 36, 12, 1533,
+        930, 533, 198, 24, 4, 837, 480, 164,
+        13, 2, 413, 133, 3, 0, 135, 4,
+        0, 0, 0, 0, 11808, 9478, 7435, 5759,
+        4014, 2914, 1911, 969, 450, 121, 11, 8015,
+        6236, 4856, 3567, 2619, 1674, 917, 424, 90,
+        5, 5342, 4222, 3259, 2273, 1433, 736, 344,
+        88, 5, 3461, 2541, 1988, 1273, 715, 279,
+        49, 3, 2086, 1628, 1017, 602, 234, 38,
+        4, 1336, 853, 469, 193, 25, 1, 835,
+        432, 166, 13, 1, 418, 131, 10, 1,
+        131, 5, 0, 0, 0, 0, 11979, 9429,
+        7433, 5576, 4016, 2915, 1876, 1055, 461, 126,
+        11, 8407, 6619, 5092, 3655, 2508, 1644, 909,
+        398, 94, 5, 5368, 4209, 3106, 2175, 1423,
+        778, 333, 71, 6, 3383, 2582, 1806, 1241,
+        735, 267, 47, 13, 2142, 1462, 1018, 608,
+        218, 34, 4, 1298, 868, 505, 190, 25,
+        2, 647, 417, 174, 12, 3, 395, 124,
+        6, 2, 98, 2, 2, 1, 0, 0,
+        11778, 9777, 7482, 5732, 4009, 2698, 1747, 1015,
+        484, 131, 8, 8428, 6479, 4948, 3564, 2449,
+        1527, 890, 422, 93, 11, 5863, 4325, 3176,
+        2127, 1348, 785, 333, 77, 5, 3460, 2585,
+        1736, 1166, 668, 284, 55, 7, 2065, 1519,
+        925, 581, 228, 40, 1, 1310, 792, 464,
+        193, 27, 6, 632, 424, 164, 23, 2,
+        300, 117, 4, 1, 121, 6, 0, 0,
+        0, 0, 11880, 9578, 7527, 5590, 4131, 2737,
+        1663, 906, 437, 127, 5, 8433, 6680, 4972,
+        3558, 2419, 1457, 812, 347, 92, 10, 5760,
+        4387, 3099, 2100, 1282, 667, 295, 87, 6,
+        3852, 2796, 1873, 1115, 577, 240, 46, 8,
+        2171, 1516, 966, 471, 182, 25, 1, 1318,
+        794, 410, 188, 22, 2, 670, 348, 133,
+        12, 6, 269, 131, 8, 0, 65, 1,
+        1, 0, 0, 0, 11833, 9536, 7352, 5644,
+        4065, 2586, 1591, 891, 301, 96, 13, 8316,
+        6644, 5090, 3586, 2390, 1451, 776, 343, 106,
+        9, 5867, 4507, 3124, 2050, 1253, 701, 269,
+        82, 10, 3954, 2657, 1769, 1155, 575, 219,
+        58, 10, 2516, 1571, 994, 487, 187, 35,
+        3, 1311, 784, 416, 144, 21, 2, 671,
+        345, 124, 10, 4, 268, 102, 3, 3,
+        70, 1, 0, 0, 0, 0, 11749, 9668,
+        7412, 5695, 4083, 2731, 1651, 938, 312, 103,
+        9, 8486, 6651, 5075, 3741, 2534, 1507, 759,
+        362, 91, 7, 5877, 4435, 3266, 2224, 1285,
+        650, 278, 73, 7, 3835, 2924, 1968, 1170,
+        545, 250, 54, 7, 2441, 1585, 984, 464,
+        201, 42, 6, 1480, 844, 433, 173, 22,
+        1, 686, 327, 116, 16, 2, 303, 103,
+        2, 2, 69, 0, 0, 0, 0, 0,
+        11733, 9698, 7564, 5837, 4130, 2825, 1780, 888,
+        303, 79, 18, 8434, 6739, 5035, 3696, 2511,
+        1543, 751, 341, 99, 5, 5951, 4455, 3256,
+        2223, 1327, 648, 279, 64, 7, 3812, 2921,
+        1914, 1119, 553, 222, 62, 3, 2434, 1820,
+        998, 487, 181, 36, 3, 1546, 899, 416,
+        146, 19, 2, 745, 332, 124, 13, 1,
+        311, 92, 3, 1, 57, 0, 0, 1,
+        1, 0, 11930, 9489, 7521, 5773, 4031, 2835,
+        1780, 956, 312, 80, 4, 8736, 6691, 4991,
+        3917, 2653, 1608, 852, 323, 101, 4, 5877,
+        4657, 3445, 2261, 1396, 707, 295, 80, 1,
+        3946, 2835, 1932, 1192, 621, 216, 57, 3,
+        2503, 1662, 1032, 522, 193, 40, 3, 1504,
+        905, 432, 143, 17, 3, 886, 377, 108,
+        12, 0, 355, 109, 7, 0, 81, 0,
+        0, 0, 0, 0, 30238, 25593, 20991, 16172,
+        12072, 8498, 5543, 3009, 1471, 455, 14, 25122,
+        25138, 20592, 16448, 11872, 8577, 5541, 2968, 1441,
+        451, 16, 24350, 20552, 20621, 16313, 12182, 8293,
+        5526, 2988, 1510, 463, 18, 23565, 19908, 16626,
+        15467, 11710, 8403, 5528, 3012, 1390, 447, 14,
+        24064, 20022, 16030, 12816, 11414, 8154, 5373, 2955,
+        1454, 468, 17, 23240, 19206, 15445, 12262, 9132,
+        7937, 5129, 3049, 1472, 435, 14, 22434, 18601,
+        14744, 11366, 8741, 6281, 4958, 2805, 1372, 445,
+        16, 21739, 17761, 14343, 10904, 8163, 5749, 3875,
+        2869, 1443, 454, 9, 20409, 16741, 13527, 10337,
+        7464, 5245, 3235, 2035, 878, 386, 16, 19614,
+        16082, 12651, 9716, 7026, 4815, 3033, 1687, 673,
+        353, 15, 18977, 15530, 12119, 9333, 6587, 4452,
+        2686, 1445, 479, 204, 25, 18243, 14915, 11539,
+        8705, 6173, 4174, 2460, 1204, 391, 119, 13,
+        24151, 23144, 19745, 16194, 12075, 8580, 5428, 3242,
+        1573, 494, 16, 23457, 19027, 19340, 15866, 11852,
+        8430, 5603, 3220, 1468, 438, 11, 22691, 18542,
+        15965, 15525, 11907, 8334, 5482, 3246, 1545, 446,
+        12, 23470, 18859, 15724, 12499, 11489, 8412, 5464,
+        3118, 1559, 430, 19, 22314, 18983, 15231, 12121,
+        9236, 7927, 5305, 3030, 1522, 447, 11, 21527,
+        18282, 14472, 11529, 8826, 6143, 5033, 3064, 1424,
+        488, 24, 20904, 17085, 13959, 11034, 8061, 5781,
+        3899, 2780, 1354, 460, 18, 19614, 16673, 13355,
+        10420, 7759, 5287, 3528, 2086, 1333, 457, 14,
+        18695, 15939, 12842, 10049, 7375, 5138, 3202, 1879,
+        897, 420, 13, 18006, 15588, 12258, 9467, 6914,
+        4709, 2930, 1557, 749, 239, 26, 17363, 14541,
+        11806, 8812, 6371, 4273, 2684, 1401, 504, 117,
+        10, 22945, 18354, 17897, 15080, 11953, 8470, 5534,
+        3059, 1495, 415, 15, 22099, 17600, 14294, 14814,
+        11573, 8416, 5334, 3228, 1491, 414, 15, 22728,
+        18130, 13944, 11832, 11453, 8236, 5557, 3222, 1564,
+        422, 14, 21680, 17992, 14249, 11597, 9173, 7848,
+        5370, 3129, 1456, 452, 21, 21517, 17271, 14652,
+        11450, 8600, 6251, 4925, 2976, 1473, 476, 14,
+        20628, 16628, 13912, 10840, 8085, 5732, 3900, 2781,
+        1338, 408, 13, 19448, 16044, 12972, 10334, 7767,
+        5250, 3461, 1971, 1311, 412, 18, 18654, 15143,
+        12509, 9705, 7279, 5118, 3169, 1787, 897, 461,
+        16, 17893, 14571, 12056, 9185, 6948, 4745, 2988,
+        1588, 676, 242, 20, 17078, 13964, 11539, 8646,
+        6358, 4246, 2551, 1251, 554, 103, 7, 21426,
+        17042, 13691, 13271, 11051, 8150, 5376, 3198, 1501,
+        413, 18, 21989, 17162, 13452, 10825, 10702, 8094,
+        5470, 3123, 1551, 473, 19, 21387, 17702, 13554,
+        10529, 8345, 7865, 5164, 3216, 1421, 457, 16,
+        20716, 17092, 13616, 10381, 7991, 6105, 4967, 3034,
+        1474, 442, 23, 20475, 16311, 13043, 10826, 8095,
+        5685, 3748, 2772, 1438, 438, 16, 19001, 15745,
+        12397, 10200, 7450, 5383, 3446, 2056, 1298, 409,
+        22, 18377, 14875, 11902, 9457, 7273, 5053, 3214,
+        1731, 917, 406, 22, 17448, 14197, 11282, 8884,
+        6657, 4713, 2905, 1520, 722, 228, 19, 16780,
+        13634, 10832, 8451, 6251, 4213, 2705, 1317, 487,
+        106, 8, 21588, 16928, 12831, 10119, 9531, 7695,
+        5448, 3257, 1554, 423, 13, 20797, 17217, 12999,
+        10051, 7634, 7304, 5133, 3134, 1473, 456, 15,
+        20304, 16595, 13243, 9795, 7375, 5785, 4987, 2995,
+        1472, 400, 14, 19805, 15901, 12835, 9947, 7222,
+        5313, 3873, 2704, 1338, 434, 17, 19079, 15452,
+        12313, 9422, 7621, 5348, 3490, 1971, 1318, 400,
+        23, 18060, 14801, 11474, 8926, 6937, 4951, 3220,
+        1763, 860, 418, 11, 17629, 14218, 11049, 8433,
+        6499, 4553, 2993, 1587, 681, 245, 13, 16837,
+        13544, 10406, 7949, 5933, 4224, 2579, 1329, 505,
+        104, 6, 20419, 16609, 12605, 9572, 7130, 6428,
+        4820, 3108, 1477, 478, 14, 20228, 15885, 12991,
+        9507, 6783, 4949, 4615, 2960, 1480, 445, 16,
+        19550, 15649, 12381, 9552, 6790, 4730, 3535, 2693,
+        1334, 409, 11, 18904, 15137, 11899, 9168, 6937,
+        4734, 3209, 2011, 1276, 423, 13, 18366, 14939,
+        11595, 8760, 6402, 4828, 3138, 1810, 874, 398,
+        12, 17631, 13925, 10979, 8285, 6047, 4447, 2721,
+        1499, 682, 237, 13, 16784, 13236, 10343, 7847,
+        5647, 4105, 2575, 1261, 477, 109, 5, 19554,
+        15793, 12476, 8943, 6326, 4597, 3989, 2772, 1456,
+        443, 21, 19214, 15391, 11982, 9162, 6496, 4407,
+        2971, 2489, 1363, 432, 17, 18112, 14814, 11661,
+        8882, 6429, 4357, 2781, 1875, 1280, 417, 11,
+        17696, 14514, 11181, 8425, 6162, 4396, 2798, 1586,
+        940, 405, 13, 17246, 14030, 10888, 8193, 5822,
+        4003, 2676, 1469, 657, 199, 12, 16666, 13458,
+        10335, 7557, 5307, 3790, 2474, 1325, 470, 115,
+        3, 18568, 15006, 11621, 8892, 6083, 4012, 2642,
+        1950, 1218, 428, 8, 17743, 14750, 11051, 8596,
+        6095, 3932, 2478, 1473, 1212, 380, 13, 17430,
+        14019, 11046, 8242, 5806, 4096, 2410, 1342, 802,
+        412, 17, 16946, 13794, 10614, 7889, 5704, 3745,
+        2463, 1253, 629, 234, 10, 16360, 13358, 10353,
+        7549, 5338, 3484, 2178, 1252, 476, 84, 9,
+        17424, 13952, 10812, 8203, 5792, 3795, 2134, 1266,
+        713, 357, 13, 16841, 13728, 10650, 7917, 5572,
+        3741, 2114, 1121, 475, 305, 15, 16599, 13314,
+        10220, 7779, 5263, 3394, 2095, 1098, 396, 205,
+        15, 16478, 12898, 9847, 7471, 5024, 3292, 1821,
+        977, 374, 94, 1, 15057, 13378, 10357, 7625,
+        5516, 3484, 1943, 970, 378, 271, 14, 14834,
+        12834, 9959, 7418, 5261, 3229, 1985, 949, 268,
+        134, 11, 14804, 12526, 9579, 7301, 5003, 3229,
+        1819, 737, 219, 86, 4, 14532, 12677, 9924,
+        7350, 5209, 3324, 1877, 882, 229, 98, 23,
+        14684, 12482, 9673, 7113, 4993, 3132, 1790, 809,
+        209, 31, 5, 14587, 12429, 9574, 6966, 4919,
+        3156, 1776, 775, 145, 0, 0, 22326, 20254,
+        19354, 13933, 9575, 5830, 2870, 1209, 224, 9,
+        18898, 16396, 12128, 7928, 4888, 2418, 971, 155,
+        11, 13454, 10054, 6637, 4158, 1956, 818, 125,
+        11, 8290, 5357, 3410, 1568, 582, 65, 6,
+        4732, 2827, 1270, 479, 31, 6, 2539, 1120,
+        410, 11, 3, 1018, 339, 1, 3, 349,
+        0, 0, 0, 0, 0, 17710, 14320, 10876,
+        7337, 4573, 2143, 932, 162, 6, 11994, 8896,
+        5939, 3621, 1773, 653, 95, 9, 7193, 4875,
+        2991, 1445, 540, 73, 8, 3968, 2583, 1060,
+        426, 40, 2, 2118, 934, 317, 26, 0,
+        831, 284, 2, 1, 271, 0, 0, 0,
+        0, 0, 10153, 7624, 5323, 3506, 1671, 682,
+        108, 9, 6308, 4205, 2680, 1277, 482, 68,
+        5, 3399, 2119, 982, 377, 34, 6, 1716,
+        739, 269, 17, 0, 678, 252, 1, 1,
+        234, 0, 0, 0, 0, 0, 5175, 3609,
+        2307, 1119, 446, 75, 5, 2869, 1811, 814,
+        344, 53, 1, 1510, 597, 236, 20, 5,
+        602, 190, 0, 3, 189, 0, 0, 0,
+        0, 0, 2449, 1452, 718, 302, 36, 5,
+        1300, 532, 195, 17, 2, 486, 154, 1,
+        1, 159, 0, 0, 0, 0, 0, 1081,
+        474, 232, 17, 2, 373, 164, 0, 1,
+        103, 0, 0, 0, 0, 0, 404, 122,
+        2, 1, 101, 0, 0, 0, 0, 0,
+        82, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 21049, 19065, 18499, 13552, 9225, 5536,
+        2833, 1181, 235, 18, 18211, 15367, 11308, 7706,
+        4685, 2355, 951, 175, 16, 12928, 9363, 6223,
+        3921, 1962, 726, 115, 9, 7732, 5159, 3137,
+        1610, 604, 79, 4, 4279, 2544, 1244, 482,
+        44, 7, 2268, 1067, 360, 20, 4, 984,
+        327, 7, 1, 371, 1, 1, 0, 0,
+        0, 12649, 11668, 10871, 7493, 4639, 2439, 963,
+        171, 12, 10986, 8824, 6238, 3928, 1994, 799,
+        136, 5, 7355, 5031, 3068, 1647, 635, 79,
+        8, 4227, 2446, 1330, 515, 47, 2, 2083,
+        1128, 400, 17, 4, 1009, 326, 3, 0,
+        323, 1, 0, 0, 0, 0, 10050, 7696,
+        5563, 3454, 1847, 721, 111, 11, 6357, 4360,
+        2720, 1550, 575, 87, 7, 3554, 2212, 1166,
+        457, 51, 3, 1811, 961, 337, 26, 0,
+        823, 279, 2, 1, 287, 0, 1, 0,
+        0, 0, 5406, 3807, 2295, 1321, 567, 71,
+        9, 3097, 1837, 1025, 382, 48, 7, 1502,
+        779, 322, 23, 2, 701, 265, 3, 0,
+        214, 0, 0, 0, 0, 0, 2557, 1522,
+        865, 329, 52, 6, 1273, 649, 261, 20,
+        3, 539, 220, 4, 1, 195, 1, 1,
+        0, 0, 0, 1166, 566, 222, 24, 4,
+        472, 169, 5, 2, 162, 0, 0, 0,
+        0, 0, 483, 137, 6, 2, 146, 1,
+        0, 0, 0, 0, 151, 3, 0, 0,
+        0, 0, 0, 0, 0, 0, 19772, 17903,
+        17234, 12839, 8731, 5366, 2742, 1125, 209, 16,
+        16134, 14111, 11024, 7742, 4673, 2376, 940, 164,
+        7, 12224, 9042, 6165, 3814, 1909, 811, 106,
+        8, 7626, 5180, 3072, 1609, 604, 71, 6,
+        4218, 2580, 1184, 444, 35, 5, 2158, 1063,
+        367, 25, 2, 969, 287, 3, 1, 354,
+        2, 0, 0, 0, 0, 11413, 10878, 10429,
+        7086, 4317, 2399, 906, 189, 9, 10203, 8209,
+        5886, 3571, 1906, 819, 137, 7, 6884, 4781,
+        2840, 1479, 598, 91, 4, 3851, 2288, 1203,
+        480, 62, 1, 1857, 1048, 327, 27, 4,
+        861, 309, 4, 0, 283, 0, 0, 0,
+        0, 0, 6795, 6171, 5644, 3452, 1879, 754,
+        118, 6, 5537, 4320, 2687, 1512, 543, 85,
+        4, 3665, 2201, 1175, 425, 51, 4, 1870,
+        938, 351, 23, 2, 822, 277, 2, 2,
+        274, 0, 1, 0, 0, 0, 5023, 3737,
+        2381, 1361, 535, 80, 6, 2996, 1960, 967,
+        431, 44, 5, 1520, 817, 300, 25, 3,
+        710, 283, 4, 1, 237, 1, 1, 0,
+        0, 0, 2579, 1535, 895, 356, 57, 5,
+        1249, 686, 257, 38, 5, 582, 198, 4,
+        1, 178, 0, 1, 0, 0, 0, 1056,
+        593, 212, 18, 1, 491, 159, 3, 1,
+        149, 0, 1, 0, 0, 0, 453, 192,
+        2, 1, 163, 0, 2, 0, 0, 0,
+        156, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 18644, 17297, 17076, 12611, 8687, 5238,
+        2788, 1130, 226, 13, 14990, 13340, 10324, 7140,
+        4486, 2198, 958, 189, 13, 10703, 8278, 6150,
+        3922, 1876, 771, 116, 6, 7313, 5107, 3076,
+        1583, 650, 74, 4, 4148, 2499, 1222, 505,
+        54, 3, 2210, 1062, 379, 23, 2, 935,
+        314, 3, 1, 357, 0, 0, 0, 0,
+        0, 10798, 10188, 9441, 6835, 4101, 2136, 906,
+        175, 17, 8661, 7607, 5533, 3589, 1940, 696,
+        125, 6, 6383, 4613, 2786, 1544, 591, 90,
+        6, 3678, 2303, 1150, 501, 46, 5, 1840,
+        968, 378, 26, 3, 833, 339, 2, 1,
+        299, 0, 0, 0, 0, 0, 6202, 5497,
+        5215, 3193, 1773, 719, 116, 13, 5029, 4119,
+        2470, 1430, 554, 76, 1, 3189, 2045, 1063,
+        416, 63, 5, 1575, 772, 293, 31, 2,
+        692, 259, 3, 3, 243, 0, 0, 0,
+        0, 0, 3341, 2824, 2356, 1359, 535, 83,
+        3, 2554, 1909, 986, 390, 49, 5, 1517,
+        833, 306, 19, 3, 695, 239, 2, 2,
+        218, 0, 2, 0, 0, 0, 2363, 1544,
+        864, 367, 47, 6, 1297, 677, 254, 26,
+        0, 571, 188, 7, 1, 202, 0, 0,
+        0, 0, 0, 1089, 555, 250, 29, 2,
+        463, 178, 4, 2, 145, 0, 0, 0,
+        0, 0, 429, 139, 2, 1, 145, 0,
+        1, 0, 0, 0, 147, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 18541, 16280,
+        16093, 12292, 8669, 5194, 2707, 1097, 242, 15,
+        13951, 12622, 9984, 7003, 4371, 2322, 914, 156,
+        11, 9808, 7711, 5803, 3570, 1796, 738, 112,
+        14, 6148, 4418, 3051, 1513, 598, 84, 7,
+        3880, 2538, 1115, 466, 42, 2, 2085, 1009,
+        357, 22, 3, 937, 311, 2, 0, 312,
+        2, 1, 0, 0, 0, 10043, 9603, 9348,
+        6736, 4092, 2183, 946, 175, 15, 8231, 7127,
+        5194, 3247, 1726, 705, 136, 9, 5400, 3998,
+        2694, 1495, 602, 91, 4, 3490, 2134, 1153,
+        449, 57, 8, 1729, 1006, 370, 27, 1,
+        835, 292, 5, 2, 242, 0, 1, 0,
+        0, 0, 5440, 5057, 4714, 3052, 1589, 653,
+        97, 6, 4265, 3443, 2451, 1294, 543, 88,
+        8, 2857, 1861, 1010, 392, 39, 8, 1575,
+        841, 307, 24, 4, 664, 246, 2, 3,
+        240, 1, 0, 0, 0, 0, 2919, 2596,
+        2168, 1256, 508, 73, 2, 2379, 1766, 888,
+        326, 45, 3, 1340, 683, 256, 16, 2,
+        614, 201, 3, 0, 173, 1, 1, 0,
+        0, 0, 1461, 1185, 905, 392, 44, 4,
+        990, 696, 255, 23, 5, 563, 213, 7,
+        0, 180, 2, 0, 0, 0, 0, 922,
+        599, 232, 28, 1, 436, 184, 9, 0,
+        151, 0, 1, 0, 0, 0, 470, 147,
+        4, 1, 146, 1, 1, 0, 0, 0,
+        146, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 24004, 19317, 14925, 11643, 8227, 5088,
+        2639, 1113, 211, 18, 14976, 11654, 9473, 6688,
+        4257, 2151, 955, 161, 12, 9077, 7232, 5391,
+        3458, 1810, 648, 124, 1, 5557, 4100, 2801,
+        1420, 492, 84, 13, 3240, 2124, 1177, 489,
+        39, 3, 1956, 947, 355, 28, 4, 917,
+        322, 8, 3, 337, 0, 1, 0, 0,
+        0, 10513, 8748, 8614, 6292, 3866, 2148, 952,
+        200, 14, 7282, 6469, 4981, 3221, 1711, 718,
+        112, 5, 4827, 3745, 2479, 1440, 566, 82,
+        10, 2740, 1908, 1130, 489, 47, 2, 1704,
+        975, 336, 25, 1, 822, 303, 4, 0,
+        272, 0, 2, 0, 0, 0, 5124, 4586,
+        4360, 2853, 1707, 672, 120, 7, 3732, 3359,
+        2140, 1222, 484, 83, 7, 2426, 1613, 997,
+        430, 54, 6, 1364, 791, 279, 35, 1,
+        658, 243, 7, 2, 204, 1, 1, 0,
+        0, 0, 2611, 2303, 2017, 1106, 462, 90,
+        4, 1860, 1378, 848, 336, 46, 4, 1101,
+        629, 252, 24, 3, 552, 246, 3, 1,
+        155, 0, 1, 0, 0, 0, 1279, 1015,
+        788, 369, 56, 6, 871, 614, 224, 19,
+        1, 459, 177, 3, 1, 161, 1, 0,
+        0, 0, 0, 600, 483, 224, 21, 2,
+        390, 169, 8, 0, 155, 1, 1, 0,
+        0, 0, 373, 148, 6, 0, 142, 1,
+        0, 0, 0, 0, 160, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 24691, 19082,
+        14782, 10574, 7617, 4988, 2635, 1158, 199, 8,
+        14723, 11284, 8677, 6285, 3964, 2164, 901, 167,
+        12, 8887, 6643, 5061, 3238, 1785, 681, 111,
+        6, 5192, 3848, 2669, 1361, 584, 81, 7,
+        2984, 1938, 1056, 426, 33, 4, 1557, 751,
+        323, 24, 4, 815, 289, 6, 0, 322,
+        0, 1, 0, 0, 0, 13588, 10582, 7845,
+        5938, 3759, 2010, 908, 138, 5, 8001, 5828,
+        4632, 2967, 1726, 734, 117, 14, 4535, 3404,
+        2344, 1317, 555, 83, 5, 2564, 1741, 1055,
+        454, 43, 4, 1213, 792, 324, 29, 3,
+        718, 271, 1, 0, 262, 1, 0, 0,
+        0, 0, 5256, 4245, 4184, 2643, 1552, 637,
+        129, 9, 3414, 2900, 2025, 1145, 509, 98,
+        3, 2176, 1383, 906, 378, 41, 6, 1055,
+        650, 265, 21, 5, 551, 225, 2, 2,
+        226, 0, 2, 0, 0, 0, 2304, 2027,
+        1688, 1094, 458, 72, 4, 1612, 1255, 781,
+        310, 40, 5, 883, 571, 236, 32, 1,
+        478, 162, 1, 1, 182, 1, 1, 0,
+        0, 0, 1089, 834, 766, 283, 51, 4,
+        689, 498, 210, 31, 1, 375, 158, 6,
+        0, 146, 0, 0, 0, 0, 0, 505,
+        412, 182, 23, 2, 338, 154, 2, 0,
+        123, 0, 1, 0, 0, 0, 268, 140,
+        4, 0, 109, 2, 0, 0, 0, 0,
+        112, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 23843, 19040, 14299, 10172, 7025, 4544,
+        2438, 1063, 227, 21, 15823, 11808, 8253, 5560,
+        3732, 2078, 840, 160, 11, 8820, 6395, 4510,
+        2987, 1568, 711, 110, 8, 5021, 3332, 2277,
+        1216, 510, 77, 5, 2669, 1756, 893, 368,
+        37, 6, 1469, 761, 329, 23, 3, 728,
+        273, 1, 3, 297, 1, 0, 0, 0,
+        0, 13765, 10402, 7603, 5278, 3371, 1988, 823,
+        171, 9, 7749, 5648, 3971, 2703, 1569, 660,
+        123, 5, 4242, 3054, 1935, 1242, 520, 84,
+        7, 2326, 1524, 932, 382, 67, 4, 1217,
+        765, 290, 19, 0, 552, 208, 6, 1,
+        206, 0, 0, 0, 0, 0, 6781, 4951,
+        3548, 2428, 1408, 592, 113, 10, 3558, 2570,
+        1712, 1038, 464, 88, 5, 1891, 1212, 863,
+        363, 42, 3, 916, 625, 283, 24, 4,
+        435, 163, 3, 2, 167, 0, 0, 0,
+        0, 0, 2329, 1720, 1524, 940, 426, 83,
+        3, 1366, 1083, 724, 303, 52, 6, 746,
+        497, 188, 22, 4, 350, 132, 5, 1,
+        140, 1, 1, 0, 0, 0, 953, 707,
+        594, 268, 53, 1, 582, 429, 200, 34,
+        4, 273, 135, 4, 2, 115, 0, 0,
+        0, 0, 0, 407, 327, 173, 28, 4,
+        212, 104, 8, 0, 107, 2, 1, 0,
+        0, 0, 182, 108, 5, 2, 112, 1,
+        0, 0, 0, 0, 58, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 23634, 18811,
+        14349, 10102, 6577, 4029, 2260, 956, 180, 15,
+        15770, 11639, 8307, 5545, 3343, 1878, 790, 159,
+        18, 9456, 6690, 4291, 2654, 1361, 611, 113,
+        15, 4991, 3384, 2075, 1122, 486, 82, 7,
+        2610, 1578, 776, 342, 46, 3, 1354, 691,
+        278, 17, 3, 611, 264, 2, 1, 211,
+        0, 0, 0, 0, 0, 13536, 9913, 7226,
+        4930, 3018, 1757, 692, 172, 18, 8070, 5820,
+        3875, 2429, 1352, 581, 114, 6, 4234, 2671,
+        1804, 1005, 416, 65, 7, 2007, 1291, 733,
+        317, 32, 4, 1017, 534, 257, 19, 3,
+        486, 214, 0, 1, 159, 0, 0, 0,
+        0, 0, 6952, 4798, 3379, 2069, 1162, 553,
+        113, 10, 3406, 2247, 1470, 809, 390, 78,
+        2, 1685, 1023, 614, 272, 43, 8, 830,
+        408, 188, 14, 2, 356, 161, 1, 2,
+        108, 0, 0, 0, 0, 0, 3005, 1967,
+        1306, 725, 342, 81, 1, 1288, 786, 458,
+        240, 50, 8, 613, 319, 163, 14, 2,
+        295, 139, 0, 1, 85, 0, 0, 0,
+        0, 0, 922, 553, 459, 217, 57, 3,
+        431, 303, 121, 21, 0, 212, 103, 3,
+        1, 64, 0, 0, 0, 0, 0, 343,
+        251, 113, 36, 2, 200, 106, 0, 0,
+        53, 0, 0, 0, 0, 0, 172, 108,
+        0, 0, 53, 0, 0, 0, 0, 0,
+        41, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 22437, 17950, 13627, 9632, 6023, 3401,
+        1742, 823, 141, 10, 14720, 11298, 7707, 4934,
+        2788, 1390, 581, 121, 8, 8844, 6083, 3709,
+        2295, 1016, 416, 72, 7, 5079, 2976, 1696,
+        827, 260, 52, 4, 2353, 1334, 654, 172,
+        41, 2, 1046, 600, 125, 11, 4, 563,
+        115, 0, 1, 122, 0, 0, 0, 0,
+        0, 13193, 10031, 7336, 4862, 2827, 1374, 726,
+        135, 19, 8012, 5534, 3751, 2281, 1068, 568,
+        120, 9, 4675, 2942, 1739, 793, 394, 72,
+        5, 2167, 1255, 604, 327, 42, 5, 1090,
+        475, 237, 17, 5, 467, 198, 0, 0,
+        144, 0, 0, 0, 0, 0, 6622, 4760,
+        3180, 2018, 1015, 498, 115, 7, 3753, 2372,
+        1485, 720, 322, 77, 8, 1646, 1048, 512,
+        283, 45, 6, 831, 355, 147, 21, 5,
+        361, 129, 0, 0, 105, 0, 0, 0,
+        0, 0, 3060, 1927, 1239, 631, 337, 82,
+        7, 1331, 750, 421, 217, 49, 4, 649,
+        270, 111, 21, 4, 246, 124, 0, 2,
+        73, 0, 0, 0, 0, 0, 1214, 687,
+        332, 185, 41, 2, 475, 219, 97, 13,
+        2, 179, 97, 1, 1, 43, 0, 0,
+        0, 0, 0, 526, 204, 98, 12, 1,
+        150, 70, 0, 0, 35, 0, 0, 0,
+        0, 0, 141, 75, 1, 1, 33, 0,
+        0, 0, 0, 0, 36, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 22230, 17575,
+        13475, 9712, 5828, 3330, 1647, 639, 163, 9,
+        14538, 11014, 7478, 4855, 2680, 1318, 473, 122,
+        13, 8729, 6238, 3900, 2116, 986, 341, 80,
+        3, 5036, 3204, 1653, 811, 240, 51, 6,
+        2541, 1395, 638, 188, 26, 5, 1289, 570,
+        118, 10, 0, 521, 114, 1, 1, 101,
+        0, 0, 0, 0, 0, 12899, 9802, 7233,
+        4816, 2797, 1390, 575, 164, 8, 7797, 5813,
+        3601, 2192, 973, 416, 96, 11, 4539, 2955,
+        1610, 747, 344, 70, 6, 2319, 1330, 614,
+        239, 44, 3, 1113, 475, 149, 20, 5,
+        442, 177, 1, 1, 132, 0, 0, 0,
+        0, 0, 6470, 4770, 3289, 1960, 898, 380,
+        119, 12, 3667, 2324, 1437, 720, 263, 84,
+        4, 1808, 1096, 501, 191, 34, 4, 873,
+        331, 109, 14, 3, 321, 114, 1, 2,
+        103, 0, 0, 0, 0, 0, 2914, 1836,
+        1128, 581, 200, 58, 8, 1444, 835, 386,
+        172, 36, 4, 670, 298, 116, 9, 2,
+        278, 90, 3, 1, 58, 0, 0, 0,
+        0, 0, 1176, 688, 285, 119, 40, 7,
+        502, 214, 85, 21, 6, 182, 70, 1,
+        1, 59, 0, 0, 0, 0, 0, 466,
+        195, 62, 23, 5, 169, 72, 1, 0,
+        39, 0, 0, 0, 0, 0, 175, 60,
+        1, 2, 32, 0, 0, 0, 0, 0,
+        33, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 22034, 17104, 13553, 9357, 6230, 3416,
+        1562, 560, 89, 20, 14355, 10827, 7685, 4948,
+        2668, 1255, 417, 58, 8, 8577, 6123, 3973,
+        2164, 996, 307, 27, 7, 4950, 3031, 1686,
+        836, 207, 20, 6, 2631, 1294, 634, 166,
+        13, 4, 1228, 595, 113, 3, 3, 620,
+        110, 0, 1, 106, 0, 0, 0, 0,
+        0, 12563, 9644, 7135, 4723, 2847, 1303, 474,
+        68, 12, 7719, 5457, 3825, 2207, 988, 332,
+        51, 10, 4421, 2958, 1701, 775, 276, 40,
+        5, 2412, 1296, 551, 195, 19, 6, 1113,
+        510, 172, 7, 4, 501, 163, 0, 0,
+        152, 0, 0, 0, 0, 0, 6433, 4442,
+        3282, 1910, 853, 347, 53, 10, 3575, 2261,
+        1439, 652, 229, 37, 2, 1873, 1075, 460,
+        185, 19, 3, 848, 346, 116, 5, 3,
+        392, 105, 0, 1, 99, 0, 0, 0,
+        0, 0, 2795, 1813, 1182, 551, 171, 37,
+        7, 1439, 777, 382, 135, 15, 3, 620,
+        299, 72, 3, 3, 292, 97, 0, 0,
+        87, 0, 0, 0, 0, 0, 1021, 592,
+        248, 103, 13, 2, 455, 181, 51, 8,
+        3, 203, 65, 0, 2, 50, 0, 0,
+        0, 0, 0, 432, 179, 69, 6, 1,
+        189, 51, 0, 1, 33, 0, 0, 0,
+        0, 0, 181, 50, 0, 2, 28, 0,
+        0, 0, 0, 0, 56, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21781, 17392,
+        13254, 9165, 5981, 3400, 1478, 452, 0, 0,
+        14024, 10449, 7547, 4895, 2700, 1221, 375, 0,
+        0, 8537, 5941, 3818, 2210, 949, 258, 0,
+        0, 4666, 3177, 1641, 735, 181, 0, 0,
+        2550, 1407, 615, 147, 0, 0, 1247, 579,
+        116, 0, 0, 559, 130, 0, 0, 125,
+        0, 0, 0, 0, 0, 12529, 9621, 7129,
+        4772, 2748, 1293, 425, 0, 0, 7602, 5540,
+        3694, 2223, 984, 321, 0, 0, 4292, 2868,
+        1660, 762, 236, 0, 0, 2196, 1276, 578,
+        180, 0, 0, 1171, 520, 154, 0, 0,
+        446, 146, 0, 0, 199, 0, 0, 0,
+        0, 0, 6078, 4471, 3223, 1871, 864, 287,
+        0, 0, 3430, 2351, 1366, 629, 195, 0,
+        0, 1719, 991, 450, 174, 0, 0, 874,
+        371, 112, 0, 0, 333, 112, 0, 0,
+        136, 0, 0, 0, 0, 0, 2794, 1773,
+        1092, 550, 166, 0, 0, 1302, 694, 362,
+        110, 0, 0, 618, 268, 72, 0, 0,
+        246, 89, 0, 0, 109, 0, 0, 0,
+        0, 0, 981, 527, 258, 90, 0, 0,
+        407, 184, 47, 0, 0, 173, 38, 0,
+        0, 76, 0, 0, 0, 0, 0, 351,
+        161, 35, 0, 0, 131, 40, 0, 0,
+        53, 0, 0, 0, 0, 0, 131, 29,
+        0, 0, 54, 0, 0, 0, 0, 0,
+        55, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 19790, 17650, 12021, 7013, 3147, 1050,
+        0, 0, 17134, 13722, 9109, 5424, 2543, 872,
+        0, 0, 10505, 6879, 4035, 1918, 695, 0,
+        0, 5557, 3091, 1442, 525, 0, 0, 2661,
+        1247, 388, 0, 0, 1174, 419, 0, 0,
+        499, 0, 0, 0, 0, 0, 14516, 11286,
+        7732, 4767, 2199, 708, 0, 0, 8316, 5461,
+        3291, 1665, 572, 0, 0, 4071, 2403, 1094,
+        391, 0, 0, 1966, 843, 291, 0, 0,
+        835, 291, 0, 0, 393, 0, 0, 0,
+        0, 0, 6430, 4191, 2659, 1366, 447, 0,
+        0, 2960, 1678, 839, 305, 0, 0, 1228,
+        597, 214, 0, 0, 584, 208, 0, 0,
+        273, 0, 0, 0, 0, 0, 2191, 1065,
+        576, 264, 0, 0, 785, 354, 135, 0,
+        0, 336, 139, 0, 0, 180, 0, 0,
+        0, 0, 0, 659, 245, 90, 0, 0,
+        266, 75, 0, 0, 116, 0, 0, 0,
+        0, 0, 241, 93, 0, 0, 107, 0,
+        0, 0, 0, 0, 122, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 11135, 8347,
+        7428, 4460, 2099, 739, 0, 0, 6768, 5101,
+        3074, 1508, 545, 0, 0, 3618, 2103, 1053,
+        374, 0, 0, 1733, 764, 254, 0, 0,
+        762, 257, 0, 0, 361, 0, 0, 0,
+        0, 0, 5456, 3686, 2394, 1289, 406, 0,
+        0, 2507, 1443, 728, 258, 0, 0, 1000,
+        450, 176, 0, 0, 486, 167, 0, 0,
+        246, 0, 0, 0, 0, 0, 1736, 811,
+        460, 273, 0, 0, 575, 244, 107, 0,
+        0, 243, 95, 0, 0, 147, 0, 0,
+        0, 0, 0, 416, 152, 54, 0, 0,
+        150, 42, 0, 0, 73, 0, 0, 0,
+        0, 0, 131, 54, 0, 0, 79, 0,
+        0, 0, 0, 0, 78, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 3966, 2442,
+        2178, 1202, 430, 0, 0, 1801, 1190, 639,
+        237, 0, 0, 813, 427, 146, 0, 0,
+        387, 148, 0, 0, 155, 0, 0, 0,
+        0, 0, 1198, 646, 408, 180, 0, 0,
+        320, 167, 81, 0, 0, 148, 73, 0,
+        0, 83, 0, 0, 0, 0, 0, 176,
+        64, 35, 0, 0, 60, 29, 0, 0,
+        42, 0, 0, 0, 0, 0, 69, 29,
+        0, 0, 36, 0, 0, 0, 0, 0,
+        51, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 786, 258, 387, 179, 0, 0,
+        65, 107, 56, 0, 0, 99, 67, 0,
+        0, 84, 0, 0, 0, 0, 0, 8,
+        24, 7, 0, 0, 12, 7, 0, 0,
+        11, 0, 0, 0, 0, 0, 0, 10,
+        0, 0, 17, 0, 0, 0, 0, 0,
+        16, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 8707,
+        7483, 4627, 2331, 840, 0, 0, 6941, 5468,
+        3197, 1667, 641, 0, 0, 3916, 2309, 1160,
+        463, 0, 0, 1718, 907, 301, 0, 0,
+        890, 309, 0, 0, 312, 0, 0, 0,
+        0, 0, 5850, 3967, 2584, 1459, 515, 0,
+        0, 2779, 1570, 889, 347, 0, 0, 1145,
+        624, 209, 0, 0, 623, 200, 0, 0,
+        198, 0, 0, 0, 0, 0, 1935, 974,
+        591, 290, 0, 0, 596, 326, 144, 0,
+        0, 382, 138, 0, 0, 140, 0, 0,
+        0, 0, 0, 461, 245, 71, 0, 0,
+        223, 87, 0, 0, 68, 0, 0, 0,
+        0, 0, 215, 79, 0, 0, 84, 0,
+        0, 0, 0, 0, 81, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4269, 2898,
+        2288, 1275, 417, 0, 0, 1979, 1365, 796,
+        295, 0, 0, 884, 499, 178, 0, 0,
+        539, 190, 0, 0, 174, 0, 0, 0,
+        0, 0, 1546, 780, 544, 214, 0, 0,
+        390, 246, 112, 0, 0, 243, 116, 0,
+        0, 133, 0, 0, 0, 0, 0, 278,
+        123, 41, 0, 0, 129, 42, 0, 0,
+        45, 0, 0, 0, 0, 0, 122, 40,
+        0, 0, 44, 0, 0, 0, 0, 0,
+        41, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1051, 348, 445, 220, 0, 0,
+        154, 158, 86, 0, 0, 157, 74, 0,
+        0, 68, 0, 0, 0, 0, 0, 86,
+        48, 21, 0, 0, 53, 25, 0, 0,
+        21, 0, 0, 0, 0, 0, 39, 17,
+        0, 0, 14, 0, 0, 0, 0, 0,
+        16, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 50, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        2764, 2286, 1343, 447, 0, 0, 2027, 1356,
+        806, 296, 0, 0, 819, 499, 183, 0,
+        0, 474, 176, 0, 0, 151, 0, 0,
+        0, 0, 0, 1555, 782, 505, 218, 0,
+        0, 426, 258, 107, 0, 0, 246, 93,
+        0, 0, 113, 0, 0, 0, 0, 0,
+        216, 133, 47, 0, 0, 138, 50, 0,
+        0, 38, 0, 0, 0, 0, 0, 113,
+        36, 0, 0, 43, 0, 0, 0, 0,
+        0, 42, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1017, 399, 469, 200, 0,
+        0, 164, 182, 78, 0, 0, 174, 88,
+        0, 0, 64, 0, 0, 0, 0, 0,
+        94, 51, 5, 0, 0, 55, 15, 0,
+        0, 19, 0, 0, 0, 0, 0, 46,
+        14, 0, 0, 14, 0, 0, 0, 0,
+        0, 22, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 44, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 369, 417, 198, 0, 0, 162, 156,
+        77, 0, 0, 166, 88, 0, 0, 83,
+        0, 0, 0, 0, 0, 79, 54, 13,
+        0, 0, 45, 19, 0, 0, 14, 0,
+        0, 0, 0, 0, 33, 14, 0, 0,
+        22, 0, 0, 0, 0, 0, 12, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        39, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+const unsigned int rank_frequency_total[RANK_VARIANT_COUNT] = {
+    2598960, /* 5 cards */
+    20358520, /* 6 cards */
+    133784560, /* 7 cards */
+    16777216, /* PLO4 */
+};
+
+const float rank_percentile_table[RANK_VARIANT_COUNT][7463] = {
+    /* 5 cards */
+    {
+        0, 1, 0.999998461, 0.999996922, 0.999995383, 0.999993844,
+        0.999992305, 0.999990766, 0.999989226, 0.999987687, 0.999986148, 0.999984609,
+        0.99998307, 0.999981531, 0.999979992, 0.999978453, 0.999976914, 0.999975375,
+        0.999973836, 0.999972297, 0.999970758, 0.999969218, 0.999967679, 0.99996614,
+        0.999964601, 0.999963062, 0.999961523, 0.999959984, 0.999958445, 0.999956906,
+        0.999955367, 0.999953828, 0.999952289, 0.99995075, 0.99994921, 0.999947671,
+        0.999946132, 0.999944593, 0.999943054, 0.999941515, 0.999939976, 0.999938437,
+        0.999936898, 0.999935359, 0.99993382, 0.999932281, 0.999930742, 0.999929202,
+        0.999927663, 0.999926124, 0.999924585, 0.999923046, 0.999921507, 0.999919968,
+        0.999918429, 0.99991689, 0.999915351, 0.999913812, 0.999912273, 0.999910734,
+        0.999909194, 0.999907655, 0.999906116, 0.999904577, 0.999903038, 0.999901499,
+        0.99989996, 0.999898421, 0.999896882, 0.999895343, 0.999893804, 0.999892265,
+        0.999890726, 0.999889186, 0.999887647, 0.999886108, 0.999884569, 0.99988303,
+        0.999881491, 0.999879952, 0.999878413, 0.999876874, 0.999875335, 0.999873796,
+        0.999872257, 0.999870718, 0.999869178, 0.999867639, 0.9998661, 0.999864561,
+        0.999863022, 0.999861483, 0.999859944, 0.999858405, 0.999856866, 0.999855327,
+        0.999853788, 0.999852249, 0.99985071, 0.99984917, 0.999847631, 0.999846092,
+        0.999844553, 0.999843014, 0.999841475, 0.999839936, 0.999838397, 0.999836858,
+        0.999835319, 0.99983378, 0.999832241, 0.999830702, 0.999829162, 0.999827623,
+        0.999826084, 0.999824545, 0.999823006, 0.999821467, 0.999819928, 0.999818389,
+        0.99981685, 0.999815311, 0.999813772, 0.999812233, 0.999810694, 0.999809154,
+        0.999807615, 0.999806076, 0.999804537, 0.999802998, 0.999801459, 0.99979992,
+        0.999798381, 0.999796842, 0.999795303, 0.999793764, 0.999792225, 0.999790686,
+        0.999789146, 0.999787607, 0.999786068, 0.999784529, 0.99978299, 0.999781451,
+        0.999779912, 0.999778373, 0.999776834, 0.999775295, 0.999773756, 0.999772217,
+        0.999770678, 0.999769138, 0.999767599, 0.99976606, 0.999764521, 0.999762982,
+        0.999761443, 0.999759904, 0.999758365, 0.999756826, 0.999755287, 0.999753748,
+        0.999752209, 0.999750669, 0.99974913, 0.999747591, 0.999746052, 0.999744513,
+        0.999735279, 0.999726044, 0.99971681, 0.999707575, 0.999698341, 0.999689106,
+        0.999679872, 0.999670637, 0.999661403, 0.999652169, 0.999642934, 0.9996337,
+        0.999624465, 0.999615231, 0.999605996, 0.999596762, 0.999587527, 0.999578293,
+        0.999569058, 0.999559824, 0.999550589, 0.999541355, 0.999532121, 0.999522886,
+        0.999513652, 0.999504417, 0.999495183, 0.999485948, 0.999476714, 0.999467479,
+        0.999458245, 0.99944901, 0.999439776, 0.999430541, 0.999421307, 0.999412073,
+        0.999402838, 0.999393604, 0.999384369, 0.999375135, 0.9993659, 0.999356666,
+        0.999347431, 0.999338197, 0.999328962, 0.999319728, 0.999310493, 0.999301259,
+        0.999292025, 0.99928279, 0.999273556, 0.999264321, 0.999255087, 0.999245852,
+        0.999236618, 0.999227383, 0.999218149, 0.999208914, 0.99919968, 0.999190445,
+        0.999181211, 0.999171976, 0.999162742, 0.999153508, 0.999144273, 0.999135039,
+        0.999125804, 0.99911657, 0.999107335, 0.999098101, 0.999088866, 0.999079632,
+        0.999070397, 0.999061163, 0.999051928, 0.999042694, 0.99903346, 0.999024225,
+        0.999014991, 0.999005756, 0.998996522, 0.998987287, 0.998978053, 0.998968818,
+        0.998959584, 0.998950349, 0.998941115, 0.99893188, 0.998922646, 0.998913412,
+        0.998904177, 0.998894943, 0.998885708, 0.998876474, 0.998867239, 0.998858005,
+        0.99884877, 0.998839536, 0.998830301, 0.998821067, 0.998811832, 0.998802598,
+        0.998793363, 0.998784129, 0.998774895, 0.99876566, 0.998756426, 0.998747191,
+        0.998737957, 0.998728722, 0.998719488, 0.998710253, 0.998701019, 0.998691784,
+        0.99868255, 0.998673315, 0.998664081, 0.998654847, 0.998645612, 0.998636378,
+        0.998627143, 0.998617909, 0.998608674, 0.99859944, 0.998590205, 0.998580971,
+        0.998571736, 0.998562502, 0.998553267, 0.998544033, 0.998534799, 0.998525564,
+        0.99851633, 0.998507095, 0.998497861, 0.998488626, 0.998479392, 0.998470157,
+        0.998460923, 0.998451688, 0.998442454, 0.998433219, 0.998423985, 0.998414751,
+        0.998405516, 0.998396282, 0.998387047, 0.998377813, 0.998368578, 0.998359344,
+        0.998350109, 0.998340875, 0.99833164, 0.998322406, 0.998313171, 0.998303937,
+        0.998302398, 0.998300859, 0.99829932, 0.998297781, 0.998296242, 0.998294702,
+        0.998293163, 0.998291624, 0.998290085, 0.998288546, 0.998287007, 0.998285468,
+        0.998283929, 0.99828239, 0.998280851, 0.998279312, 0.998277773, 0.998276234,
+        0.998274694, 0.998273155, 0.998271616, 0.998270077, 0.998268538, 0.998266999,
+        0.99826546, 0.998263921, 0.998262382, 0.998260843, 0.998259304, 0.998257765,
+        0.998256226, 0.998254686, 0.998253147, 0.998251608, 0.998250069, 0.99824853,
+        0.998246991, 0.998245452, 0.998243913, 0.998242374, 0.998240835, 0.998239296,
+        0.998237757, 0.998236218, 0.998234678, 0.998233139, 0.9982316, 0.998230061,
+        0.998228522, 0.998226983, 0.998225444, 0.998223905, 0.998222366, 0.998220827,
+        0.998219288, 0.998217749, 0.99821621, 0.99821467, 0.998213131, 0.998211592,
+        0.998210053, 0.998208514, 0.998206975, 0.998205436, 0.998203897, 0.998202358,
+        0.998200819, 0.99819928, 0.998197741, 0.998196202, 0.998194662, 0.998193123,
+        0.998191584, 0.998190045, 0.998188506, 0.998186967, 0.998185428, 0.998183889,
+        0.99818235, 0.998180811, 0.998179272, 0.998177733, 0.998176194, 0.998174654,
+        0.998173115, 0.998171576, 0.998170037, 0.998168498, 0.998166959, 0.99816542,
+        0.998163881, 0.998162342, 0.998160803, 0.998159264, 0.998157725, 0.998156186,
+        0.998154646, 0.998153107, 0.998151568, 0.998150029, 0.99814849, 0.998146951,
+        0.998145412, 0.998143873, 0.998142334, 0.998140795, 0.998139256, 0.998137717,
+        0.998136178, 0.998134638, 0.998133099, 0.99813156, 0.998130021, 0.998128482,
+        0.998126943, 0.998125404, 0.998123865, 0.998122326, 0.998120787, 0.998119248,
+        0.998117709, 0.99811617, 0.99811463, 0.998113091, 0.998111552, 0.998110013,
+        0.998108474, 0.998106935, 0.998105396, 0.998103857, 0.998102318, 0.998100779,
+        0.99809924, 0.998097701, 0.998096162, 0.998094622, 0.998093083, 0.998091544,
+        0.998090005, 0.998088466, 0.998086927, 0.998085388, 0.998083849, 0.99808231,
+        0.998080771, 0.998079232, 0.998077693, 0.998076154, 0.998074614, 0.998073075,
+        0.998071536, 0.998069997, 0.998068458, 0.998066919, 0.99806538, 0.998063841,
+        0.998062302, 0.998060763, 0.998059224, 0.998057685, 0.998056146, 0.998054606,
+        0.998053067, 0.998051528, 0.998049989, 0.99804845, 0.998046911, 0.998045372,
+        0.998043833, 0.998042294, 0.998040755, 0.998039216, 0.998037677, 0.998036138,
+        0.998034598, 0.998033059, 0.99803152, 0.998029981, 0.998028442, 0.998026903,
+        0.998025364, 0.998023825, 0.998022286, 0.998020747, 0.998019208, 0.998017669,
+        0.99801613, 0.99801459, 0.998013051, 0.998011512, 0.998009973, 0.998008434,
+        0.998006895, 0.998005356, 0.998003817, 0.998002278, 0.998000739, 0.9979992,
+        0.997997661, 0.997996122, 0.997994582, 0.997993043, 0.997991504, 0.997989965,
+        0.997988426, 0.997986887, 0.997985348, 0.997983809, 0.99798227, 0.997980731,
+        0.997979192, 0.997977653, 0.997976114, 0.997974574, 0.997973035, 0.997971496,
+        0.997969957, 0.997968418, 0.997966879, 0.99796534, 0.997963801, 0.997962262,
+        0.997960723, 0.997959184, 0.997957645, 0.997956106, 0.997954566, 0.997953027,
+        0.997951488, 0.997949949, 0.99794841, 0.997946871, 0.997945332, 0.997943793,
+        0.997942254, 0.997940715, 0.997939176, 0.997937637, 0.997936098, 0.997934558,
+        0.997933019, 0.99793148, 0.997929941, 0.997928402, 0.997926863, 0.997925324,
+        0.997923785, 0.997922246, 0.997920707, 0.997919168, 0.997917629, 0.99791609,
+        0.99791455, 0.997913011, 0.997911472, 0.997909933, 0.997908394, 0.997906855,
+        0.997905316, 0.997903777, 0.997902238, 0.997900699, 0.99789916, 0.997897621,
+        0.997896082, 0.997894542, 0.997893003, 0.997891464, 0.997889925, 0.997888386,
+        0.997886847, 0.997885308, 0.997883769, 0.99788223, 0.997880691, 0.997879152,
+        0.997877613, 0.997876074, 0.997874534, 0.997872995, 0.997871456, 0.997869917,
+        0.997868378, 0.997866839, 0.9978653, 0.997863761, 0.997862222, 0.997860683,
+        0.997859144, 0.997857605, 0.997856066, 0.997854526, 0.997852987, 0.997851448,
+        0.997849909, 0.99784837, 0.997846831, 0.997845292, 0.997843753, 0.997842214,
+        0.997840675, 0.997839136, 0.997837597, 0.997836057, 0.997834518, 0.997832979,
+        0.99783144, 0.997829901, 0.997828362, 0.997826823, 0.997825284, 0.997823745,
+        0.997822206, 0.997820667, 0.997819128, 0.997817589, 0.997816049, 0.99781451,
+        0.997812971, 0.997811432, 0.997809893, 0.997808354, 0.997806815, 0.997805276,
+        0.997803737, 0.997802198, 0.997800659, 0.99779912, 0.997797581, 0.997796041,
+        0.997794502, 0.997792963, 0.997791424, 0.997789885, 0.997788346, 0.997786807,
+        0.997785268, 0.997783729, 0.99778219, 0.997780651, 0.997779112, 0.997777573,
+        0.997776033, 0.997774494, 0.997772955, 0.997771416, 0.997769877, 0.997768338,
+        0.997766799, 0.99776526, 0.997763721, 0.997762182, 0.997760643, 0.997759104,
+        0.997757565, 0.997756025, 0.997754486, 0.997752947, 0.997751408, 0.997749869,
+        0.99774833, 0.997746791, 0.997745252, 0.997743713, 0.997742174, 0.997740635,
+        0.997739096, 0.997737557, 0.997736017, 0.997734478, 0.997732939, 0.9977314,
+        0.997729861, 0.997728322, 0.997726783, 0.997725244, 0.997723705, 0.997722166,
+        0.997720627, 0.997719088, 0.997717549, 0.997716009, 0.99771447, 0.997712931,
+        0.997711392, 0.997709853, 0.997708314, 0.997706775, 0.997705236, 0.997703697,
+        0.997702158, 0.997700619, 0.99769908, 0.997697541, 0.997696001, 0.997694462,
+        0.997692923, 0.997691384, 0.997689845, 0.997688306, 0.997686767, 0.997685228,
+        0.997683689, 0.99768215, 0.997680611, 0.997679072, 0.997677533, 0.997675993,
+        0.997674454, 0.997672915, 0.997671376, 0.997669837, 0.997668298, 0.997666759,
+        0.99766522, 0.997663681, 0.997662142, 0.997660603, 0.997659064, 0.997657525,
+        0.997655985, 0.997654446, 0.997652907, 0.997651368, 0.997649829, 0.99764829,
+        0.997646751, 0.997645212, 0.997643673, 0.997642134, 0.997640595, 0.997639056,
+        0.997637517, 0.997635977, 0.997634438, 0.997632899, 0.99763136, 0.997629821,
+        0.997628282, 0.997626743, 0.997625204, 0.997623665, 0.997622126, 0.997620587,
+        0.997619048, 0.997617509, 0.997615969, 0.99761443, 0.997612891, 0.997611352,
+        0.997609813, 0.997608274, 0.997606735, 0.997605196, 0.997603657, 0.997602118,
+        0.997600579, 0.99759904, 0.997597501, 0.997595961, 0.997594422, 0.997592883,
+        0.997591344, 0.997589805, 0.997588266, 0.997586727, 0.997585188, 0.997583649,
+        0.99758211, 0.997580571, 0.997579032, 0.997577493, 0.997575953, 0.997574414,
+        0.997572875, 0.997571336, 0.997569797, 0.997568258, 0.997566719, 0.99756518,
+        0.997563641, 0.997562102, 0.997560563, 0.997559024, 0.997557485, 0.997555945,
+        0.997554406, 0.997552867, 0.997551328, 0.997549789, 0.99754825, 0.997546711,
+        0.997545172, 0.997543633, 0.997542094, 0.997540555, 0.997539016, 0.997537477,
+        0.997535937, 0.997534398, 0.997532859, 0.99753132, 0.997529781, 0.997528242,
+        0.997526703, 0.997525164, 0.997523625, 0.997522086, 0.997520547, 0.997519008,
+        0.997517469, 0.997515929, 0.99751439, 0.997512851, 0.997511312, 0.997509773,
+        0.997508234, 0.997506695, 0.997505156, 0.997503617, 0.997502078, 0.997500539,
+        0.997499, 0.997497461, 0.997495921, 0.997494382, 0.997492843, 0.997491304,
+        0.997489765, 0.997488226, 0.997486687, 0.997485148, 0.997483609, 0.99748207,
+        0.997480531, 0.997478992, 0.997477453, 0.997475913, 0.997474374, 0.997472835,
+        0.997471296, 0.997469757, 0.997468218, 0.997466679, 0.99746514, 0.997463601,
+        0.997462062, 0.997460523, 0.997458984, 0.997457445, 0.997455905, 0.997454366,
+        0.997452827, 0.997451288, 0.997449749, 0.99744821, 0.997446671, 0.997445132,
+        0.997443593, 0.997442054, 0.997440515, 0.997438976, 0.997437437, 0.997435897,
+        0.997434358, 0.997432819, 0.99743128, 0.997429741, 0.997428202, 0.997426663,
+        0.997425124, 0.997423585, 0.997422046, 0.997420507, 0.997418968, 0.997417429,
+        0.997415889, 0.99741435, 0.997412811, 0.997411272, 0.997409733, 0.997408194,
+        0.997406655, 0.997405116, 0.997403577, 0.997402038, 0.997400499, 0.99739896,
+        0.997397421, 0.997395881, 0.997394342, 0.997392803, 0.997391264, 0.997389725,
+        0.997388186, 0.997386647, 0.997385108, 0.997383569, 0.99738203, 0.997380491,
+        0.997378952, 0.997377413, 0.997375873, 0.997374334, 0.997372795, 0.997371256,
+        0.997369717, 0.997368178, 0.997366639, 0.9973651, 0.997363561, 0.997362022,
+        0.997360483, 0.997358944, 0.997357405, 0.997355865, 0.997354326, 0.997352787,
+        0.997351248, 0.997349709, 0.99734817, 0.997346631, 0.997345092, 0.997343553,
+        0.997342014, 0.997340475, 0.997338936, 0.997337396, 0.997335857, 0.997334318,
+        0.997332779, 0.99733124, 0.997329701, 0.997328162, 0.997326623, 0.997325084,
+        0.997323545, 0.997322006, 0.997320467, 0.997318928, 0.997317388, 0.997315849,
+        0.99731431, 0.997312771, 0.997311232, 0.997309693, 0.997308154, 0.997306615,
+        0.997305076, 0.997303537, 0.997301998, 0.997300459, 0.99729892, 0.99729738,
+        0.997295841, 0.997294302, 0.997292763, 0.997291224, 0.997289685, 0.997288146,
+        0.997286607, 0.997285068, 0.997283529, 0.99728199, 0.997280451, 0.997278912,
+        0.997277372, 0.997275833, 0.997274294, 0.997272755, 0.997271216, 0.997269677,
+        0.997268138, 0.997266599, 0.99726506, 0.997263521, 0.997261982, 0.997260443,
+        0.997258904, 0.997257364, 0.997255825, 0.997254286, 0.997252747, 0.997251208,
+        0.997249669, 0.99724813, 0.997246591, 0.997245052, 0.997243513, 0.997241974,
+        0.997240435, 0.997238896, 0.997237356, 0.997235817, 0.997234278, 0.997232739,
+        0.9972312, 0.997229661, 0.997228122, 0.997226583, 0.997225044, 0.997223505,
+        0.997221966, 0.997220427, 0.997218888, 0.997217348, 0.997215809, 0.99721427,
+        0.997212731, 0.997211192, 0.997209653, 0.997208114, 0.997206575, 0.997205036,
+        0.997203497, 0.997201958, 0.997200419, 0.99719888, 0.99719734, 0.997195801,
+        0.997194262, 0.997192723, 0.997191184, 0.997189645, 0.997188106, 0.997186567,
+        0.997185028, 0.997183489, 0.99718195, 0.997180411, 0.997178872, 0.997177332,
+        0.997175793, 0.997174254, 0.997172715, 0.997171176, 0.997169637, 0.997168098,
+        0.997166559, 0.99716502, 0.997163481, 0.997161942, 0.997160403, 0.997158864,
+        0.997157324, 0.997155785, 0.997154246, 0.997152707, 0.997151168, 0.997149629,
+        0.99714809, 0.997146551, 0.997145012, 0.997143473, 0.997141934, 0.997140395,
+        0.997138856, 0.997137316, 0.997135777, 0.997134238, 0.997132699, 0.99713116,
+        0.997129621, 0.997128082, 0.997126543, 0.997125004, 0.997123465, 0.997121926,
+        0.997120387, 0.997118848, 0.997117308, 0.997115769, 0.99711423, 0.997112691,
+        0.997111152, 0.997109613, 0.997108074, 0.997106535, 0.997104996, 0.997103457,
+        0.997101918, 0.997100379, 0.99709884, 0.9970973, 0.997095761, 0.997094222,
+        0.997092683, 0.997091144, 0.997089605, 0.997088066, 0.997086527, 0.997084988,
+        0.997083449, 0.99708191, 0.997080371, 0.997078832, 0.997077292, 0.997075753,
+        0.997074214, 0.997072675, 0.997071136, 0.997069597, 0.997068058, 0.997066519,
+        0.99706498, 0.997063441, 0.997061902, 0.997060363, 0.997058824, 0.997057284,
+        0.997055745, 0.997054206, 0.997052667, 0.997051128, 0.997049589, 0.99704805,
+        0.997046511, 0.997044972, 0.997043433, 0.997041894, 0.997040355, 0.997038816,
+        0.997037276, 0.997035737, 0.997034198, 0.997032659, 0.99703112, 0.997029581,
+        0.997028042, 0.997026503, 0.997024964, 0.997023425, 0.997021886, 0.997020347,
+        0.997018808, 0.997017268, 0.997015729, 0.99701419, 0.997012651, 0.997011112,
+        0.997009573, 0.997008034, 0.997006495, 0.997004956, 0.997003417, 0.997001878,
+        0.997000339, 0.9969988, 0.99699726, 0.996995721, 0.996994182, 0.996992643,
+        0.996991104, 0.996989565, 0.996988026, 0.996986487, 0.996984948, 0.996983409,
+        0.99698187, 0.996980331, 0.996978792, 0.996977252, 0.996975713, 0.996974174,
+        0.996972635, 0.996971096, 0.996969557, 0.996968018, 0.996966479, 0.99696494,
+        0.996963401, 0.996961862, 0.996960323, 0.996958784, 0.996957244, 0.996955705,
+        0.996954166, 0.996952627, 0.996951088, 0.996949549, 0.99694801, 0.996946471,
+        0.996944932, 0.996943393, 0.996941854, 0.996940315, 0.996938776, 0.996937236,
+        0.996935697, 0.996934158, 0.996932619, 0.99693108, 0.996929541, 0.996928002,
+        0.996926463, 0.996924924, 0.996923385, 0.996921846, 0.996920307, 0.996918768,
+        0.996917228, 0.996915689, 0.99691415, 0.996912611, 0.996911072, 0.996909533,
+        0.996907994, 0.996906455, 0.996904916, 0.996903377, 0.996901838, 0.996900299,
+        0.99689876, 0.99689722, 0.996895681, 0.996894142, 0.996892603, 0.996891064,
+        0.996889525, 0.996887986, 0.996886447, 0.996884908, 0.996883369, 0.99688183,
+        0.996880291, 0.996878752, 0.996877212, 0.996875673, 0.996874134, 0.996872595,
+        0.996871056, 0.996869517, 0.996867978, 0.996866439, 0.9968649, 0.996863361,
+        0.996861822, 0.996860283, 0.996858743, 0.996857204, 0.996855665, 0.996854126,
+        0.996852587, 0.996851048, 0.996849509, 0.99684797, 0.996846431, 0.996844892,
+        0.996843353, 0.996841814, 0.996840275, 0.996838735, 0.996837196, 0.996835657,
+        0.996834118, 0.996832579, 0.99683104, 0.996829501, 0.996827962, 0.996826423,
+        0.996824884, 0.996823345, 0.996821806, 0.996820267, 0.996818727, 0.996817188,
+        0.996815649, 0.99681411, 0.996812571, 0.996811032, 0.996809493, 0.996807954,
+        0.996806415, 0.996804876, 0.996803337, 0.996801798, 0.996800259, 0.996798719,
+        0.99679718, 0.996795641, 0.996794102, 0.996792563, 0.996791024, 0.996789485,
+        0.996787946, 0.996786407, 0.996784868, 0.996783329, 0.99678179, 0.996780251,
+        0.996778711, 0.996777172, 0.996775633, 0.996774094, 0.996772555, 0.996771016,
+        0.996769477, 0.996767938, 0.996766399, 0.99676486, 0.996763321, 0.996761782,
+        0.996760243, 0.996758703, 0.996757164, 0.996755625, 0.996754086, 0.996752547,
+        0.996751008, 0.996749469, 0.99674793, 0.996746391, 0.996744852, 0.996743313,
+        0.996741774, 0.996740235, 0.996738695, 0.996737156, 0.996735617, 0.996734078,
+        0.996732539, 0.996731, 0.996729461, 0.996727922, 0.996726383, 0.996724844,
+        0.996723305, 0.996721766, 0.996720227, 0.996718687, 0.996717148, 0.996715609,
+        0.99671407, 0.996712531, 0.996710992, 0.996709453, 0.996707914, 0.996706375,
+        0.996704836, 0.996703297, 0.996701758, 0.996700219, 0.996698679, 0.99669714,
+        0.996695601, 0.996694062, 0.996692523, 0.996690984, 0.996689445, 0.996687906,
+        0.996686367, 0.996684828, 0.996683289, 0.99668175, 0.996680211, 0.996678671,
+        0.996677132, 0.996675593, 0.996674054, 0.996672515, 0.996670976, 0.996669437,
+        0.996667898, 0.996666359, 0.99666482, 0.996663281, 0.996661742, 0.996660203,
+        0.996658663, 0.996657124, 0.996655585, 0.996654046, 0.996652507, 0.996650968,
+        0.996649429, 0.99664789, 0.996646351, 0.996644812, 0.996643273, 0.996641734,
+        0.996640195, 0.996638655, 0.996637116, 0.996635577, 0.996634038, 0.996632499,
+        0.99663096, 0.996629421, 0.996627882, 0.996626343, 0.996624804, 0.996623265,
+        0.996621726, 0.996620187, 0.996618647, 0.996617108, 0.996615569, 0.99661403,
+        0.996612491, 0.996610952, 0.996609413, 0.996607874, 0.996606335, 0.996604796,
+        0.996603257, 0.996601718, 0.996600179, 0.996598639, 0.9965971, 0.996595561,
+        0.996594022, 0.996592483, 0.996590944, 0.996589405, 0.996587866, 0.996586327,
+        0.996584788, 0.996583249, 0.99658171, 0.996580171, 0.996578631, 0.996577092,
+        0.996575553, 0.996574014, 0.996572475, 0.996570936, 0.996569397, 0.996567858,
+        0.996566319, 0.99656478, 0.996563241, 0.996561702, 0.996560163, 0.996558623,
+        0.996557084, 0.996555545, 0.996554006, 0.996552467, 0.996550928, 0.996549389,
+        0.99654785, 0.996546311, 0.996544772, 0.996543233, 0.996541694, 0.996540155,
+        0.996538615, 0.996537076, 0.996535537, 0.996533998, 0.996532459, 0.99653092,
+        0.996529381, 0.996527842, 0.996526303, 0.996524764, 0.996523225, 0.996521686,
+        0.996520147, 0.996518607, 0.996517068, 0.996515529, 0.99651399, 0.996512451,
+        0.996510912, 0.996509373, 0.996507834, 0.996506295, 0.996504756, 0.996503217,
+        0.996501678, 0.996500139, 0.996498599, 0.99649706, 0.996495521, 0.996493982,
+        0.996492443, 0.996490904, 0.996489365, 0.996487826, 0.996486287, 0.996484748,
+        0.996483209, 0.99648167, 0.996480131, 0.996478591, 0.996477052, 0.996475513,
+        0.996473974, 0.996472435, 0.996470896, 0.996469357, 0.996467818, 0.996466279,
+        0.99646474, 0.996463201, 0.996461662, 0.996460123, 0.996458583, 0.996457044,
+        0.996455505, 0.996453966, 0.996452427, 0.996450888, 0.996449349, 0.99644781,
+        0.996446271, 0.996444732, 0.996443193, 0.996441654, 0.996440115, 0.996438575,
+        0.996437036, 0.996435497, 0.996433958, 0.996432419, 0.99643088, 0.996429341,
+        0.996427802, 0.996426263, 0.996424724, 0.996423185, 0.996421646, 0.996420107,
+        0.996418567, 0.996417028, 0.996415489, 0.99641395, 0.996412411, 0.996410872,
+        0.996409333, 0.996407794, 0.996406255, 0.996404716, 0.996403177, 0.996401638,
+        0.996400099, 0.996398559, 0.99639702, 0.996395481, 0.996393942, 0.996392403,
+        0.996390864, 0.996389325, 0.996387786, 0.996386247, 0.996384708, 0.996383169,
+        0.99638163, 0.99638009, 0.996378551, 0.996377012, 0.996375473, 0.996373934,
+        0.996372395, 0.996370856, 0.996369317, 0.996367778, 0.996366239, 0.9963647,
+        0.996363161, 0.996361622, 0.996360082, 0.996358543, 0.996357004, 0.996355465,
+        0.996353926, 0.996352387, 0.996350848, 0.996349309, 0.99634777, 0.996346231,
+        0.996344692, 0.996343153, 0.996341614, 0.996340074, 0.996338535, 0.995946071,
+        0.995553606, 0.995161141, 0.994768677, 0.994376212, 0.993983747, 0.993591283,
+        0.993198818, 0.992806353, 0.992413889, 0.992389263, 0.992364638, 0.992340013,
+        0.992315388, 0.992290762, 0.992266137, 0.992241512, 0.992216887, 0.992192262,
+        0.992167636, 0.992143011, 0.992118386, 0.992093761, 0.992069135, 0.99204451,
+        0.992019885, 0.99199526, 0.991970634, 0.991946009, 0.991921384, 0.991896759,
+        0.991872133, 0.991847508, 0.991822883, 0.991798258, 0.991773633, 0.991749007,
+        0.991724382, 0.991699757, 0.991675132, 0.991650506, 0.991625881, 0.991601256,
+        0.991576631, 0.991552005, 0.99152738, 0.991502755, 0.99147813, 0.991453504,
+        0.991428879, 0.991404254, 0.991379629, 0.991355004, 0.991330378, 0.991305753,
+        0.991281128, 0.991256503, 0.991231877, 0.991207252, 0.991182627, 0.991158002,
+        0.991133376, 0.991108751, 0.991084126, 0.991059501, 0.991034875, 0.99101025,
+        0.990985625, 0.990961, 0.990936375, 0.990911749, 0.990887124, 0.990862499,
+        0.990837874, 0.990813248, 0.990788623, 0.990763998, 0.990739373, 0.990714747,
+        0.990690122, 0.990665497, 0.990640872, 0.990616246, 0.990591621, 0.990566996,
+        0.990542371, 0.990517746, 0.99049312, 0.990468495, 0.99044387, 0.990419245,
+        0.990394619, 0.990369994, 0.990345369, 0.990320744, 0.990296118, 0.990271493,
+        0.990246868, 0.990222243, 0.990197618, 0.990172992, 0.990148367, 0.990123742,
+        0.990099117, 0.990074491, 0.990049866, 0.990025241, 0.990000616, 0.98997599,
+        0.989951365, 0.98992674, 0.989902115, 0.989877489, 0.989852864, 0.989828239,
+        0.989803614, 0.989778989, 0.989754363, 0.989729738, 0.989705113, 0.989680488,
+        0.989655862, 0.989631237, 0.989606612, 0.989581987, 0.989557361, 0.989532736,
+        0.989508111, 0.989483486, 0.98945886, 0.989434235, 0.98940961, 0.989384985,
+        0.98936036, 0.989335734, 0.989311109, 0.989286484, 0.989261859, 0.989237233,
+        0.989212608, 0.989187983, 0.989163358, 0.989138732, 0.989114107, 0.989089482,
+        0.989064857, 0.989040231, 0.989015606, 0.988990981, 0.988966356, 0.988941731,
+        0.988917105, 0.98889248, 0.988867855, 0.98884323, 0.988818604, 0.988793979,
+        0.988769354, 0.988744729, 0.988720103, 0.988695478, 0.988670853, 0.988646228,
+        0.988621602, 0.988596977, 0.988572352, 0.988547727, 0.988523102, 0.988498476,
+        0.988473851, 0.988449226, 0.988424601, 0.988399975, 0.98837535, 0.988350725,
+        0.9883261, 0.988301474, 0.988276849, 0.988252224, 0.988227599, 0.988202973,
+        0.988178348, 0.988153723, 0.988129098, 0.988104473, 0.988079847, 0.988055222,
+        0.988030597, 0.988005972, 0.987981346, 0.987956721, 0.987932096, 0.987907471,
+        0.987882845, 0.98785822, 0.987833595, 0.98780897, 0.987784345, 0.987759719,
+        0.987735094, 0.987710469, 0.987685844, 0.987661218, 0.987636593, 0.987611968,
+        0.987587343, 0.987562717, 0.987538092, 0.987513467, 0.987488842, 0.987464216,
+        0.987439591, 0.987414966, 0.987390341, 0.987365716, 0.98734109, 0.987316465,
+        0.98729184, 0.987267215, 0.987242589, 0.987217964, 0.987193339, 0.987168714,
+        0.987144088, 0.987119463, 0.987094838, 0.987070213, 0.987045587, 0.987020962,
+        0.986996337, 0.986971712, 0.986947087, 0.986922461, 0.986897836, 0.986873211,
+        0.986848586, 0.98682396, 0.986799335, 0.98677471, 0.986750085, 0.986725459,
+        0.986700834, 0.986676209, 0.986651584, 0.986626958, 0.986602333, 0.986577708,
+        0.986553083, 0.986528458, 0.986503832, 0.986479207, 0.986454582, 0.986429957,
+        0.986405331, 0.986380706, 0.986356081, 0.986331456, 0.98630683, 0.986282205,
+        0.98625758, 0.986232955, 0.986208329, 0.986183704, 0.986159079, 0.986134454,
+        0.986109829, 0.986085203, 0.986060578, 0.986035953, 0.986011328, 0.985986702,
+        0.985962077, 0.985937452, 0.985912827, 0.985888201, 0.985863576, 0.985838951,
+        0.985814326, 0.9857897, 0.985765075, 0.98574045, 0.985715825, 0.9856912,
+        0.985666574, 0.985641949, 0.985617324, 0.985592699, 0.985568073, 0.985543448,
+        0.985518823, 0.985494198, 0.985469572, 0.985444947, 0.985420322, 0.985395697,
+        0.985371072, 0.985346446, 0.985321821, 0.985297196, 0.985272571, 0.985247945,
+        0.98522332, 0.985198695, 0.98517407, 0.985149444, 0.985124819, 0.985100194,
+        0.985075569, 0.985050943, 0.985026318, 0.985001693, 0.984977068, 0.984952443,
+        0.984927817, 0.984903192, 0.984878567, 0.984853942, 0.984829316, 0.984804691,
+        0.984780066, 0.984755441, 0.984730815, 0.98470619, 0.984681565, 0.98465694,
+        0.984632314, 0.984607689, 0.984583064, 0.984558439, 0.984533814, 0.984509188,
+        0.984484563, 0.984459938, 0.984435313, 0.984410687, 0.984386062, 0.984361437,
+        0.984336812, 0.984312186, 0.984287561, 0.984262936, 0.984238311, 0.984213685,
+        0.98418906, 0.984164435, 0.98413981, 0.984115185, 0.984090559, 0.984065934,
+        0.984041309, 0.984016684, 0.983992058, 0.983967433, 0.983942808, 0.983918183,
+        0.983893557, 0.983868932, 0.983844307, 0.983819682, 0.983795056, 0.983770431,
+        0.983745806, 0.983721181, 0.983696556, 0.98367193, 0.983647305, 0.98362268,
+        0.983598055, 0.983573429, 0.983548804, 0.983524179, 0.983499554, 0.983474928,
+        0.983450303, 0.983425678, 0.983401053, 0.983376427, 0.983351802, 0.983327177,
+        0.983302552, 0.983277927, 0.983253301, 0.983228676, 0.983204051, 0.983179426,
+        0.9831548, 0.983130175, 0.98310555, 0.983080925, 0.983056299, 0.983031674,
+        0.983007049, 0.982982424, 0.982957799, 0.982933173, 0.982908548, 0.982883923,
+        0.982859298, 0.982834672, 0.982810047, 0.982785422, 0.982760797, 0.982736171,
+        0.982711546, 0.982686921, 0.982662296, 0.98263767, 0.982613045, 0.98258842,
+        0.982563795, 0.98253917, 0.982514544, 0.982489919, 0.982465294, 0.982440669,
+        0.982416043, 0.982391418, 0.982366793, 0.982342168, 0.982317542, 0.982292917,
+        0.982268292, 0.982243667, 0.982219041, 0.982194416, 0.982169791, 0.982145166,
+        0.982120541, 0.982095915, 0.98207129, 0.982046665, 0.98202204, 0.981997414,
+        0.981972789, 0.981948164, 0.981923539, 0.981898913, 0.981874288, 0.981849663,
+        0.981825038, 0.981800412, 0.981775787, 0.981751162, 0.981726537, 0.981701912,
+        0.981677286, 0.981652661, 0.981628036, 0.981603411, 0.981578785, 0.98155416,
+        0.981529535, 0.98150491, 0.981480284, 0.981455659, 0.981431034, 0.981406409,
+        0.981381783, 0.981357158, 0.981332533, 0.981307908, 0.981283283, 0.981258657,
+        0.981234032, 0.981209407, 0.981184782, 0.981160156, 0.981135531, 0.981110906,
+        0.981086281, 0.981061655, 0.98103703, 0.981012405, 0.98098778, 0.980963154,
+        0.980938529, 0.980913904, 0.980889279, 0.980864654, 0.980840028, 0.980815403,
+        0.980790778, 0.980766153, 0.980741527, 0.980716902, 0.980692277, 0.980667652,
+        0.980643026, 0.980618401, 0.980593776, 0.980569151, 0.980544526, 0.9805199,
+        0.980495275, 0.98047065, 0.980446025, 0.980421399, 0.980396774, 0.980372149,
+        0.980347524, 0.980322898, 0.980298273, 0.980273648, 0.980249023, 0.980224397,
+        0.980199772, 0.980175147, 0.980150522, 0.980125897, 0.980101271, 0.980076646,
+        0.980052021, 0.980027396, 0.98000277, 0.979978145, 0.97995352, 0.979928895,
+        0.979904269, 0.979879644, 0.979855019, 0.979830394, 0.979805768, 0.979781143,
+        0.979756518, 0.979731893, 0.979707268, 0.979682642, 0.979658017, 0.979633392,
+        0.979608767, 0.979584141, 0.979559516, 0.979534891, 0.979510266, 0.97948564,
+        0.979461015, 0.97943639, 0.979411765, 0.979387139, 0.979362514, 0.979337889,
+        0.979313264, 0.979288639, 0.979264013, 0.979239388, 0.979214763, 0.979190138,
+        0.979165512, 0.979140887, 0.979116262, 0.979091637, 0.979067011, 0.979042386,
+        0.979017761, 0.978993136, 0.97896851, 0.978943885, 0.97891926, 0.978894635,
+        0.97887001, 0.978845384, 0.978820759, 0.978796134, 0.978771509, 0.978746883,
+        0.978722258, 0.978697633, 0.978673008, 0.978648382, 0.978623757, 0.978599132,
+        0.978574507, 0.978549881, 0.978525256, 0.978500631, 0.978476006, 0.978451381,
+        0.978426755, 0.97840213, 0.978377505, 0.97835288, 0.978328254, 0.978303629,
+        0.978279004, 0.978254379, 0.978229753, 0.978205128, 0.978180503, 0.978155878,
+        0.978131253, 0.978106627, 0.978082002, 0.978057377, 0.978032752, 0.978008126,
+        0.977983501, 0.977958876, 0.977934251, 0.977909625, 0.977885, 0.977860375,
+        0.97783575, 0.977811124, 0.977786499, 0.977761874, 0.977737249, 0.977712624,
+        0.977687998, 0.977663373, 0.977638748, 0.977614123, 0.977589497, 0.977564872,
+        0.977540247, 0.977515622, 0.977490996, 0.977466371, 0.977441746, 0.977417121,
+        0.977392495, 0.97736787, 0.977343245, 0.97731862, 0.977293995, 0.977269369,
+        0.977244744, 0.977220119, 0.977195494, 0.977170868, 0.977146243, 0.977121618,
+        0.977096993, 0.977072367, 0.977047742, 0.977023117, 0.976998492, 0.976973866,
+        0.976949241, 0.976924616, 0.976899991, 0.976875366, 0.97685074, 0.976826115,
+        0.97680149, 0.976776865, 0.976752239, 0.976727614, 0.976702989, 0.976678364,
+        0.976653738, 0.976629113, 0.976604488, 0.976579863, 0.976555237, 0.976530612,
+        0.976505987, 0.976481362, 0.976456737, 0.976432111, 0.976407486, 0.976382861,
+        0.976358236, 0.97633361, 0.976308985, 0.97628436, 0.976259735, 0.976235109,
+        0.976210484, 0.976185859, 0.976161234, 0.976136608, 0.976111983, 0.976087358,
+        0.976062733, 0.976038108, 0.976013482, 0.975988857, 0.975964232, 0.975939607,
+        0.975914981, 0.975890356, 0.975865731, 0.975841106, 0.97581648, 0.975791855,
+        0.97576723, 0.975742605, 0.975717979, 0.975693354, 0.975668729, 0.975644104,
+        0.975619479, 0.975594853, 0.975570228, 0.975545603, 0.975520978, 0.975496352,
+        0.975471727, 0.975447102, 0.975422477, 0.975397851, 0.975373226, 0.975348601,
+        0.975323976, 0.975299351, 0.975274725, 0.9752501, 0.975225475, 0.97520085,
+        0.975176224, 0.975151599, 0.975126974, 0.975102349, 0.975077723, 0.975053098,
+        0.975028473, 0.975003848, 0.974979222, 0.974954597, 0.974929972, 0.974905347,
+        0.974880722, 0.974856096, 0.974831471, 0.974806846, 0.974782221, 0.974757595,
+        0.97473297, 0.974708345, 0.97468372, 0.974659094, 0.974634469, 0.974609844,
+        0.974585219, 0.974560593, 0.974535968, 0.974511343, 0.974486718, 0.974462093,
+        0.974437467, 0.974412842, 0.974388217, 0.974363592, 0.974338966, 0.974314341,
+        0.974289716, 0.974265091, 0.974240465, 0.97421584, 0.974191215, 0.97416659,
+        0.974141964, 0.974117339, 0.974092714, 0.974068089, 0.974043464, 0.974018838,
+        0.973994213, 0.973969588, 0.973944963, 0.973920337, 0.973895712, 0.973871087,
+        0.973846462, 0.973821836, 0.973797211, 0.973772586, 0.973747961, 0.973723335,
+        0.97369871, 0.973674085, 0.97364946, 0.973624835, 0.973600209, 0.973575584,
+        0.973550959, 0.973526334, 0.973501708, 0.973477083, 0.973452458, 0.973427833,
+        0.973403207, 0.973378582, 0.973353957, 0.973329332, 0.973304706, 0.973280081,
+        0.973255456, 0.973230831, 0.973206206, 0.97318158, 0.973156955, 0.97313233,
+        0.973107705, 0.973083079, 0.973058454, 0.973033829, 0.973009204, 0.972984578,
+        0.972959953, 0.972935328, 0.972910703, 0.972886078, 0.972861452, 0.972836827,
+        0.972812202, 0.972787577, 0.972762951, 0.972738326, 0.972713701, 0.972689076,
+        0.97266445, 0.972639825, 0.9726152, 0.972590575, 0.972565949, 0.972541324,
+        0.972516699, 0.972492074, 0.972467449, 0.972442823, 0.972418198, 0.972393573,
+        0.972368948, 0.972344322, 0.972319697, 0.972295072, 0.972270447, 0.972245821,
+        0.972221196, 0.972196571, 0.972171946, 0.97214732, 0.972122695, 0.97209807,
+        0.972073445, 0.97204882, 0.972024194, 0.971999569, 0.971974944, 0.971950319,
+        0.971925693, 0.971901068, 0.971876443, 0.971851818, 0.971827192, 0.971802567,
+        0.971777942, 0.971753317, 0.971728691, 0.971704066, 0.971679441, 0.971654816,
+        0.971630191, 0.971605565, 0.97158094, 0.971556315, 0.97153169, 0.971507064,
+        0.971482439, 0.971457814, 0.971433189, 0.971408563, 0.971383938, 0.971359313,
+        0.971334688, 0.971310062, 0.971285437, 0.97123003, 0.971174624, 0.971119217,
+        0.97106381, 0.971008403, 0.970952997, 0.97089759, 0.970842183, 0.970786776,
+        0.970731369, 0.970675963, 0.970620556, 0.970565149, 0.970509742, 0.970454336,
+        0.970398929, 0.970343522, 0.970288115, 0.970232708, 0.970177302, 0.970121895,
+        0.970066488, 0.970011081, 0.969955675, 0.969900268, 0.969844861, 0.969789454,
+        0.969734047, 0.969678641, 0.969623234, 0.969567827, 0.96951242, 0.969457014,
+        0.969401607, 0.9693462, 0.969290793, 0.969235386, 0.96917998, 0.969124573,
+        0.969069166, 0.969013759, 0.968958353, 0.968902946, 0.968847539, 0.968792132,
+        0.968736725, 0.968681319, 0.968625912, 0.968570505, 0.968515098, 0.968459692,
+        0.968404285, 0.968348878, 0.968293471, 0.968238064, 0.968182658, 0.968127251,
+        0.968071844, 0.968016437, 0.967961031, 0.967905624, 0.967850217, 0.96779481,
+        0.967739403, 0.967683997, 0.96762859, 0.967573183, 0.967517776, 0.96746237,
+        0.967406963, 0.967351556, 0.967296149, 0.967240742, 0.967185336, 0.967129929,
+        0.967074522, 0.967019115, 0.966963709, 0.966908302, 0.966852895, 0.966797488,
+        0.966742081, 0.966686675, 0.966631268, 0.966575861, 0.966520454, 0.966465048,
+        0.966409641, 0.966354234, 0.966298827, 0.96624342, 0.966188014, 0.966132607,
+        0.9660772, 0.966021793, 0.965966387, 0.96591098, 0.965855573, 0.965800166,
+        0.965744759, 0.965689353, 0.965633946, 0.965578539, 0.965523132, 0.965467726,
+        0.965412319, 0.965356912, 0.965301505, 0.965246098, 0.965190692, 0.965135285,
+        0.965079878, 0.965024471, 0.964969065, 0.964913658, 0.964858251, 0.964802844,
+        0.964747437, 0.964692031, 0.964636624, 0.964581217, 0.96452581, 0.964470404,
+        0.964414997, 0.96435959, 0.964304183, 0.964248776, 0.96419337, 0.964137963,
+        0.964082556, 0.964027149, 0.963971743, 0.963916336, 0.963860929, 0.963805522,
+        0.963750115, 0.963694709, 0.963639302, 0.963583895, 0.963528488, 0.963473082,
+        0.963417675, 0.963362268, 0.963306861, 0.963251454, 0.963196048, 0.963140641,
+        0.963085234, 0.963029827, 0.962974421, 0.962919014, 0.962863607, 0.9628082,
+        0.962752793, 0.962697387, 0.96264198, 0.962586573, 0.962531166, 0.96247576,
+        0.962420353, 0.962364946, 0.962309539, 0.962254132, 0.962198726, 0.962143319,
+        0.962087912, 0.962032505, 0.961977099, 0.961921692, 0.961866285, 0.961810878,
+        0.961755471, 0.961700065, 0.961644658, 0.961589251, 0.961533844, 0.961478438,
+        0.961423031, 0.961367624, 0.961312217, 0.96125681, 0.961201404, 0.961145997,
+        0.96109059, 0.961035183, 0.960979777, 0.96092437, 0.960868963, 0.960813556,
+        0.960758149, 0.960702743, 0.960647336, 0.960591929, 0.960536522, 0.960481116,
+        0.960425709, 0.960370302, 0.960314895, 0.960259488, 0.960204082, 0.960148675,
+        0.960093268, 0.960037861, 0.959982455, 0.959927048, 0.959871641, 0.959816234,
+        0.959760827, 0.959705421, 0.959650014, 0.959594607, 0.9595392, 0.959483794,
+        0.959428387, 0.95937298, 0.959317573, 0.959262166, 0.95920676, 0.959151353,
+        0.959095946, 0.959040539, 0.958985133, 0.958929726, 0.958874319, 0.958818912,
+        0.958763505, 0.958708099, 0.958652692, 0.958597285, 0.958541878, 0.958486472,
+        0.958431065, 0.958375658, 0.958320251, 0.958264844, 0.958209438, 0.958154031,
+        0.958098624, 0.958043217, 0.957987811, 0.957932404, 0.957876997, 0.95782159,
+        0.957766183, 0.957710777, 0.95765537, 0.957599963, 0.957544556, 0.95748915,
+        0.957433743, 0.957378336, 0.957322929, 0.957267522, 0.957212116, 0.957156709,
+        0.957101302, 0.957045895, 0.956990489, 0.956935082, 0.956879675, 0.956824268,
+        0.956768861, 0.956713455, 0.956658048, 0.956602641, 0.956547234, 0.956491828,
+        0.956436421, 0.956381014, 0.956325607, 0.9562702, 0.956214794, 0.956159387,
+        0.95610398, 0.956048573, 0.955993166, 0.95593776, 0.955882353, 0.955826946,
+        0.955771539, 0.955716133, 0.955660726, 0.955605319, 0.955549912, 0.955494505,
+        0.955439099, 0.955383692, 0.955328285, 0.955272878, 0.955217472, 0.955162065,
+        0.955106658, 0.955051251, 0.954995844, 0.954940438, 0.954885031, 0.954829624,
+        0.954774217, 0.954718811, 0.954663404, 0.954607997, 0.95455259, 0.954497183,
+        0.954441777, 0.95438637, 0.954330963, 0.954275556, 0.95422015, 0.954164743,
+        0.954109336, 0.954053929, 0.953998522, 0.953943116, 0.953887709, 0.953832302,
+        0.953776895, 0.953721489, 0.953666082, 0.953610675, 0.953555268, 0.953499861,
+        0.953444455, 0.953389048, 0.953333641, 0.953278234, 0.953222828, 0.953167421,
+        0.953112014, 0.953056607, 0.9530012, 0.952945794, 0.952890387, 0.95283498,
+        0.952779573, 0.952724167, 0.95266876, 0.952613353, 0.952557946, 0.952502539,
+        0.952447133, 0.952391726, 0.952336319, 0.952280912, 0.952225506, 0.952170099,
+        0.952114692, 0.952059285, 0.952003878, 0.951948472, 0.951893065, 0.951837658,
+        0.951782251, 0.951726845, 0.951671438, 0.951616031, 0.951560624, 0.951505217,
+        0.951449811, 0.951394404, 0.951338997, 0.95128359, 0.951228184, 0.951172777,
+        0.95111737, 0.951061963, 0.951006556, 0.95095115, 0.950895743, 0.950840336,
+        0.950784929, 0.950729523, 0.950674116, 0.950618709, 0.950563302, 0.950507895,
+        0.950452489, 0.950397082, 0.950341675, 0.950286268, 0.950230862, 0.950175455,
+        0.950120048, 0.950064641, 0.950009234, 0.949953828, 0.949898421, 0.949843014,
+        0.949787607, 0.949732201, 0.949676794, 0.949621387, 0.94956598, 0.949510573,
+        0.949455167, 0.94939976, 0.949344353, 0.949288946, 0.94923354, 0.949178133,
+        0.949122726, 0.949067319, 0.949011912, 0.948956506, 0.948901099, 0.948845692,
+        0.948790285, 0.948734879, 0.948679472, 0.948624065, 0.948568658, 0.948513251,
+        0.948457845, 0.948402438, 0.948347031, 0.948291624, 0.948236218, 0.948180811,
+        0.948125404, 0.948069997, 0.94801459, 0.947959184, 0.947903777, 0.94784837,
+        0.947792963, 0.947737557, 0.94768215, 0.947626743, 0.947571336, 0.947515929,
+        0.947460523, 0.947405116, 0.947349709, 0.947294302, 0.947238896, 0.947183489,
+        0.947128082, 0.947072675, 0.947017268, 0.946961862, 0.946906455, 0.946851048,
+        0.946795641, 0.946740235, 0.946684828, 0.946629421, 0.946574014, 0.946518607,
+        0.946463201, 0.946407794, 0.946352387, 0.94629698, 0.946241574, 0.946186167,
+        0.94613076, 0.946075353, 0.946019946, 0.94596454, 0.945909133, 0.945853726,
+        0.945798319, 0.945742913, 0.945687506, 0.945632099, 0.945576692, 0.945521285,
+        0.945465879, 0.945410472, 0.945355065, 0.945299658, 0.945244252, 0.945188845,
+        0.945133438, 0.945078031, 0.945022624, 0.944967218, 0.944911811, 0.944856404,
+        0.944800997, 0.944745591, 0.944690184, 0.944634777, 0.94457937, 0.944523963,
+        0.944468557, 0.94441315, 0.944357743, 0.944302336, 0.94424693, 0.944191523,
+        0.944136116, 0.944080709, 0.944025302, 0.943969896, 0.943914489, 0.943859082,
+        0.943803675, 0.943748269, 0.943692862, 0.943637455, 0.943582048, 0.943526641,
+        0.943471235, 0.943415828, 0.943360421, 0.943305014, 0.943249608, 0.943194201,
+        0.943138794, 0.943083387, 0.94302798, 0.942972574, 0.942917167, 0.94286176,
+        0.942806353, 0.942750947, 0.94269554, 0.942640133, 0.942584726, 0.942529319,
+        0.942473913, 0.942418506, 0.942363099, 0.942307692, 0.942252286, 0.942196879,
+        0.942141472, 0.942086065, 0.942030658, 0.941975252, 0.941919845, 0.941864438,
+        0.941809031, 0.941753625, 0.941698218, 0.941642811, 0.941587404, 0.941531997,
+        0.941476591, 0.941421184, 0.941365777, 0.94131037, 0.941254964, 0.941199557,
+        0.94114415, 0.941088743, 0.941033336, 0.94097793, 0.940922523, 0.940867116,
+        0.940811709, 0.940756303, 0.940700896, 0.940645489, 0.940590082, 0.940534675,
+        0.940479269, 0.940423862, 0.940368455, 0.940313048, 0.940257642, 0.940202235,
+        0.940146828, 0.940091421, 0.940036014, 0.939980608, 0.939925201, 0.939869794,
+        0.939814387, 0.939758981, 0.939703574, 0.939648167, 0.93959276, 0.939537353,
+        0.939481947, 0.93942654, 0.939371133, 0.939315726, 0.93926032, 0.939204913,
+        0.939149506, 0.939094099, 0.939038692, 0.938983286, 0.938927879, 0.938872472,
+        0.938817065, 0.938761659, 0.938706252, 0.938650845, 0.938595438, 0.938540031,
+        0.938484625, 0.938429218, 0.938373811, 0.938318404, 0.938262998, 0.938207591,
+        0.938152184, 0.938096777, 0.93804137, 0.937985964, 0.937930557, 0.93787515,
+        0.937819743, 0.937764337, 0.93770893, 0.937653523, 0.937598116, 0.937542709,
+        0.937487303, 0.937431896, 0.937376489, 0.937321082, 0.937265676, 0.937210269,
+        0.937154862, 0.937099455, 0.937044048, 0.936988642, 0.936933235, 0.936877828,
+        0.936822421, 0.936767014, 0.936711608, 0.936656201, 0.936600794, 0.936545387,
+        0.936489981, 0.936434574, 0.936379167, 0.93632376, 0.936268353, 0.936212947,
+        0.93615754, 0.936102133, 0.936046726, 0.93599132, 0.935935913, 0.935880506,
+        0.935825099, 0.935769692, 0.935714286, 0.935658879, 0.935603472, 0.935548065,
+        0.935492659, 0.935437252, 0.935381845, 0.935326438, 0.935271031, 0.935215625,
+        0.935160218, 0.935104811, 0.935049404, 0.934993998, 0.934938591, 0.934883184,
+        0.934827777, 0.93477237, 0.934716964, 0.934661557, 0.93460615, 0.934550743,
+        0.934495337, 0.93443993, 0.934384523, 0.934329116, 0.934273709, 0.934218303,
+        0.934162896, 0.934107489, 0.934052082, 0.933996676, 0.933941269, 0.933885862,
+        0.933830455, 0.933775048, 0.933719642, 0.933664235, 0.933608828, 0.933553421,
+        0.933498015, 0.933442608, 0.933387201, 0.933331794, 0.933276387, 0.933220981,
+        0.933165574, 0.933110167, 0.93305476, 0.932999354, 0.932943947, 0.93288854,
+        0.932833133, 0.932777726, 0.93272232, 0.932666913, 0.932611506, 0.932556099,
+        0.932500693, 0.932445286, 0.932389879, 0.932334472, 0.932279065, 0.932223659,
+        0.932168252, 0.932112845, 0.932057438, 0.932002032, 0.931946625, 0.931891218,
+        0.931835811, 0.931780404, 0.931724998, 0.931669591, 0.931614184, 0.931558777,
+        0.931503371, 0.931447964, 0.931392557, 0.93133715, 0.931281743, 0.931226337,
+        0.93117093, 0.931115523, 0.931060116, 0.93100471, 0.930949303, 0.930893896,
+        0.930838489, 0.930783082, 0.930727676, 0.930672269, 0.930616862, 0.930561455,
+        0.930506049, 0.930450642, 0.930395235, 0.930339828, 0.930284421, 0.930229015,
+        0.930173608, 0.930118201, 0.930062794, 0.930007388, 0.929951981, 0.929896574,
+        0.929841167, 0.92978576, 0.929730354, 0.929674947, 0.92961954, 0.929564133,
+        0.929508727, 0.92945332, 0.929397913, 0.929342506, 0.929287099, 0.929231693,
+        0.929176286, 0.929120879, 0.929065472, 0.929010066, 0.928954659, 0.928899252,
+        0.928843845, 0.928788438, 0.928733032, 0.928677625, 0.928622218, 0.928566811,
+        0.928511405, 0.928455998, 0.928400591, 0.928345184, 0.928289777, 0.928234371,
+        0.928178964, 0.928123557, 0.92806815, 0.928012744, 0.927957337, 0.92790193,
+        0.927846523, 0.927791116, 0.92773571, 0.927680303, 0.927624896, 0.927569489,
+        0.927514083, 0.927458676, 0.927403269, 0.927347862, 0.927292455, 0.927237049,
+        0.927181642, 0.927126235, 0.927070828, 0.927015422, 0.926960015, 0.926904608,
+        0.926849201, 0.926793794, 0.926738388, 0.926682981, 0.926627574, 0.926572167,
+        0.926516761, 0.926461354, 0.926405947, 0.92635054, 0.926295133, 0.926239727,
+        0.92618432, 0.926128913, 0.926073506, 0.9260181, 0.925962693, 0.925907286,
+        0.925851879, 0.925796472, 0.925741066, 0.925685659, 0.925630252, 0.925574845,
+        0.925519439, 0.925464032, 0.925408625, 0.925353218, 0.925297811, 0.925242405,
+        0.925186998, 0.925131591, 0.925076184, 0.925020778, 0.924965371, 0.924909964,
+        0.924854557, 0.92479915, 0.924743744, 0.924688337, 0.92463293, 0.924577523,
+        0.924522117, 0.92446671, 0.924411303, 0.924355896, 0.924300489, 0.924245083,
+        0.924189676, 0.924134269, 0.924078862, 0.924023456, 0.923968049, 0.923912642,
+        0.923857235, 0.923801828, 0.923746422, 0.92359867, 0.923450919, 0.923303167,
+        0.923155416, 0.923007665, 0.922859913, 0.922712162, 0.92256441, 0.922416659,
+        0.922268908, 0.922121156, 0.921973405, 0.921825653, 0.921677902, 0.921530151,
+        0.921382399, 0.921234648, 0.921086896, 0.920939145, 0.920791393, 0.920643642,
+        0.920495891, 0.920348139, 0.920200388, 0.920052636, 0.919904885, 0.919757134,
+        0.919609382, 0.919461631, 0.919313879, 0.919166128, 0.919018377, 0.918870625,
+        0.918722874, 0.918575122, 0.918427371, 0.91827962, 0.918131868, 0.917984117,
+        0.917836365, 0.917688614, 0.917540862, 0.917393111, 0.91724536, 0.917097608,
+        0.916949857, 0.916802105, 0.916654354, 0.916506603, 0.916358851, 0.9162111,
+        0.916063348, 0.915915597, 0.915767846, 0.915620094, 0.915472343, 0.915324591,
+        0.91517684, 0.915029089, 0.914881337, 0.914733586, 0.914585834, 0.914438083,
+        0.914290332, 0.91414258, 0.913994829, 0.913847077, 0.913699326, 0.913551574,
+        0.913403823, 0.913256072, 0.91310832, 0.912960569, 0.912812817, 0.912665066,
+        0.912517315, 0.912369563, 0.912221812, 0.91207406, 0.911926309, 0.911778558,
+        0.911630806, 0.911483055, 0.911335303, 0.911187552, 0.911039801, 0.910892049,
+        0.910744298, 0.910596546, 0.910448795, 0.910301043, 0.910153292, 0.910005541,
+        0.909857789, 0.909710038, 0.909562286, 0.909414535, 0.909266784, 0.909119032,
+        0.908971281, 0.908823529, 0.908675778, 0.908528027, 0.908380275, 0.908232524,
+        0.908084772, 0.907937021, 0.90778927, 0.907641518, 0.907493767, 0.907346015,
+        0.907198264, 0.907050513, 0.906902761, 0.90675501, 0.906607258, 0.906459507,
+        0.906311755, 0.906164004, 0.906016253, 0.905868501, 0.90572075, 0.905572998,
+        0.905425247, 0.905277496, 0.905129744, 0.904981993, 0.904834241, 0.90468649,
+        0.904538739, 0.904390987, 0.904243236, 0.904095484, 0.903947733, 0.903799982,
+        0.90365223, 0.903504479, 0.903356727, 0.903208976, 0.903061224, 0.902913473,
+        0.902765722, 0.90261797, 0.902470219, 0.902322467, 0.902174716, 0.902026965,
+        0.901879213, 0.901731462, 0.90158371, 0.901435959, 0.901288208, 0.901140456,
+        0.900992705, 0.900844953, 0.900697202, 0.900549451, 0.900401699, 0.900253948,
+        0.900106196, 0.899958445, 0.899810694, 0.899662942, 0.899515191, 0.899367439,
+        0.899219688, 0.899071936, 0.898924185, 0.898776434, 0.898628682, 0.898480931,
+        0.898333179, 0.898185428, 0.898037677, 0.897889925, 0.897742174, 0.897594422,
+        0.897446671, 0.89729892, 0.897151168, 0.897003417, 0.896855665, 0.896707914,
+        0.896560163, 0.896412411, 0.89626466, 0.896116908, 0.895969157, 0.895821405,
+        0.895673654, 0.895525903, 0.895378151, 0.8952304, 0.895082648, 0.894934897,
+        0.894787146, 0.894639394, 0.894491643, 0.894343891, 0.89419614, 0.894048389,
+        0.893900637, 0.893752886, 0.893605134, 0.893457383, 0.893309632, 0.89316188,
+        0.893014129, 0.892866377, 0.892718626, 0.892570875, 0.892423123, 0.892275372,
+        0.89212762, 0.891979869, 0.891832117, 0.891684366, 0.891536615, 0.891388863,
+        0.891241112, 0.89109336, 0.890945609, 0.890797858, 0.890650106, 0.890502355,
+        0.890354603, 0.890206852, 0.890059101, 0.889911349, 0.889763598, 0.889615846,
+        0.889468095, 0.889320344, 0.889172592, 0.889024841, 0.888877089, 0.888729338,
+        0.888581586, 0.888433835, 0.888286084, 0.888138332, 0.887990581, 0.887842829,
+        0.887695078, 0.887547327, 0.887399575, 0.887251824, 0.887104072, 0.886956321,
+        0.88680857, 0.886660818, 0.886513067, 0.886365315, 0.886217564, 0.886069813,
+        0.885922061, 0.88577431, 0.885626558, 0.885478807, 0.885331055, 0.885183304,
+        0.885035553, 0.884887801, 0.88474005, 0.884592298, 0.884444547, 0.884296796,
+        0.884149044, 0.884001293, 0.883853541, 0.88370579, 0.883558039, 0.883410287,
+        0.883262536, 0.883114784, 0.882967033, 0.882819282, 0.88267153, 0.882523779,
+        0.882376027, 0.882228276, 0.882080525, 0.881932773, 0.881785022, 0.88163727,
+        0.881489519, 0.881341767, 0.881194016, 0.881046265, 0.880898513, 0.880750762,
+        0.88060301, 0.880455259, 0.880307508, 0.880159756, 0.880012005, 0.879864253,
+        0.879716502, 0.879568751, 0.879420999, 0.879273248, 0.879125496, 0.878977745,
+        0.878829994, 0.878682242, 0.878534491, 0.878386739, 0.878238988, 0.878091236,
+        0.877943485, 0.877795734, 0.877647982, 0.877500231, 0.877352479, 0.877204728,
+        0.877056977, 0.876909225, 0.876761474, 0.876613722, 0.876465971, 0.87631822,
+        0.876170468, 0.876022717, 0.875874965, 0.875727214, 0.875579463, 0.875431711,
+        0.87528396, 0.875136208, 0.874988457, 0.874840706, 0.874692954, 0.874545203,
+        0.874397451, 0.8742497, 0.874101948, 0.873954197, 0.873806446, 0.873658694,
+        0.873510943, 0.873363191, 0.87321544, 0.873067689, 0.872919937, 0.872772186,
+        0.872624434, 0.872476683, 0.872328932, 0.87218118, 0.872033429, 0.871885677,
+        0.871737926, 0.871590175, 0.871442423, 0.871294672, 0.87114692, 0.870999169,
+        0.870851417, 0.870703666, 0.870555915, 0.870408163, 0.870260412, 0.87011266,
+        0.869964909, 0.869817158, 0.869669406, 0.869521655, 0.869373903, 0.869226152,
+        0.869078401, 0.868930649, 0.868782898, 0.868635146, 0.868487395, 0.868339644,
+        0.868191892, 0.868044141, 0.867896389, 0.867748638, 0.867600887, 0.867453135,
+        0.867305384, 0.867157632, 0.867009881, 0.866862129, 0.866714378, 0.866566627,
+        0.866418875, 0.866271124, 0.866123372, 0.865975621, 0.86582787, 0.865680118,
+        0.865532367, 0.865384615, 0.865236864, 0.865089113, 0.864941361, 0.86479361,
+        0.864645858, 0.864498107, 0.864350356, 0.864202604, 0.864054853, 0.863907101,
+        0.86375935, 0.863611598, 0.863463847, 0.863316096, 0.863168344, 0.863020593,
+        0.862872841, 0.86272509, 0.862577339, 0.862429587, 0.862281836, 0.862134084,
+        0.861986333, 0.861838582, 0.86169083, 0.861543079, 0.861395327, 0.861247576,
+        0.861099825, 0.860952073, 0.860804322, 0.86065657, 0.860508819, 0.860361068,
+        0.860213316, 0.860065565, 0.859917813, 0.859770062, 0.85962231, 0.859474559,
+        0.859326808, 0.859179056, 0.859031305, 0.858883553, 0.858735802, 0.858588051,
+        0.858440299, 0.858292548, 0.858144796, 0.857997045, 0.857849294, 0.857701542,
+        0.857553791, 0.857406039, 0.857258288, 0.857110537, 0.856962785, 0.856815034,
+        0.856667282, 0.856519531, 0.856371779, 0.856224028, 0.856076277, 0.855928525,
+        0.855780774, 0.855633022, 0.855485271, 0.85533752, 0.855189768, 0.855042017,
+        0.854894265, 0.854746514, 0.854598763, 0.854451011, 0.85430326, 0.854155508,
+        0.854007757, 0.853860006, 0.853712254, 0.853564503, 0.853416751, 0.853269,
+        0.853121248, 0.852973497, 0.852825746, 0.852677994, 0.852530243, 0.852382491,
+        0.85223474, 0.852086989, 0.851939237, 0.851791486, 0.851643734, 0.851495983,
+        0.851348232, 0.85120048, 0.851052729, 0.850904977, 0.850757226, 0.850609475,
+        0.850461723, 0.850313972, 0.85016622, 0.850018469, 0.849870718, 0.849722966,
+        0.849575215, 0.849427463, 0.849279712, 0.84913196, 0.848984209, 0.848836458,
+        0.848688706, 0.848540955, 0.848393203, 0.848245452, 0.848097701, 0.847949949,
+        0.847802198, 0.847654446, 0.847506695, 0.847358944, 0.847211192, 0.847063441,
+        0.846915689, 0.846767938, 0.846620187, 0.846472435, 0.846324684, 0.846176932,
+        0.846029181, 0.845881429, 0.845733678, 0.845585927, 0.845438175, 0.845290424,
+        0.845142672, 0.844994921, 0.84484717, 0.844699418, 0.844551667, 0.844403915,
+        0.844256164, 0.844108413, 0.843960661, 0.84381291, 0.843665158, 0.843517407,
+        0.843369656, 0.843221904, 0.843074153, 0.842926401, 0.84277865, 0.842630899,
+        0.842483147, 0.842335396, 0.842187644, 0.842039893, 0.841892141, 0.84174439,
+        0.841596639, 0.841448887, 0.841301136, 0.841153384, 0.841005633, 0.840857882,
+        0.84071013, 0.840562379, 0.840414627, 0.840266876, 0.840119125, 0.839971373,
+        0.839823622, 0.83967587, 0.839528119, 0.839380368, 0.839232616, 0.839084865,
+        0.838937113, 0.838789362, 0.83864161, 0.838493859, 0.838346108, 0.838198356,
+        0.838050605, 0.837902853, 0.837755102, 0.837607351, 0.837459599, 0.837311848,
+        0.837164096, 0.837016345, 0.836868594, 0.836720842, 0.836573091, 0.836425339,
+        0.836277588, 0.836129837, 0.835982085, 0.835834334, 0.835686582, 0.835538831,
+        0.83539108, 0.835243328, 0.835095577, 0.834947825, 0.834800074, 0.834652322,
+        0.834504571, 0.83435682, 0.834209068, 0.834061317, 0.833913565, 0.833765814,
+        0.833618063, 0.833470311, 0.83332256, 0.833174808, 0.833027057, 0.832879306,
+        0.832731554, 0.832583803, 0.832436051, 0.8322883, 0.832140549, 0.831992797,
+        0.831845046, 0.831697294, 0.831549543, 0.831401791, 0.83125404, 0.831106289,
+        0.830958537, 0.830810786, 0.830663034, 0.830515283, 0.830367532, 0.83021978,
+        0.830072029, 0.829924277, 0.829776526, 0.829628775, 0.829481023, 0.829333272,
+        0.82918552, 0.829037769, 0.828890018, 0.828742266, 0.828594515, 0.828446763,
+        0.828299012, 0.828151261, 0.828003509, 0.827855758, 0.827708006, 0.827560255,
+        0.827412503, 0.827264752, 0.827117001, 0.826969249, 0.826821498, 0.826673746,
+        0.826525995, 0.826378244, 0.826230492, 0.826082741, 0.825934989, 0.825787238,
+        0.825639487, 0.825491735, 0.825343984, 0.825196232, 0.825048481, 0.82490073,
+        0.824752978, 0.824605227, 0.824457475, 0.824309724, 0.824161972, 0.824014221,
+        0.82386647, 0.823718718, 0.823570967, 0.823423215, 0.823275464, 0.823127713,
+        0.822979961, 0.82283221, 0.822684458, 0.822536707, 0.822388956, 0.822241204,
+        0.822093453, 0.821945701, 0.82179795, 0.821650199, 0.821502447, 0.821354696,
+        0.821206944, 0.821059193, 0.820911441, 0.82076369, 0.820615939, 0.820468187,
+        0.820320436, 0.820172684, 0.820024933, 0.819877182, 0.81972943, 0.819581679,
+        0.819433927, 0.819286176, 0.819138425, 0.818990673, 0.818842922, 0.81869517,
+        0.818547419, 0.818399668, 0.818251916, 0.818104165, 0.817956413, 0.817808662,
+        0.817660911, 0.817513159, 0.817365408, 0.817217656, 0.817069905, 0.816922153,
+        0.816774402, 0.816626651, 0.816478899, 0.816331148, 0.816183396, 0.816035645,
+        0.815887894, 0.815740142, 0.815592391, 0.815444639, 0.815296888, 0.815149137,
+        0.815001385, 0.814853634, 0.814705882, 0.814558131, 0.81441038, 0.814262628,
+        0.814114877, 0.813967125, 0.813819374, 0.813671622, 0.813523871, 0.81337612,
+        0.813228368, 0.813080617, 0.812932865, 0.812785114, 0.812637363, 0.812489611,
+        0.81234186, 0.812194108, 0.812046357, 0.811898606, 0.811750854, 0.811603103,
+        0.811455351, 0.8113076, 0.811159849, 0.811012097, 0.810864346, 0.810716594,
+        0.810568843, 0.810421092, 0.81027334, 0.810125589, 0.809977837, 0.809830086,
+        0.809682334, 0.809534583, 0.809386832, 0.80923908, 0.809091329, 0.808943577,
+        0.808795826, 0.808648075, 0.808500323, 0.808352572, 0.80820482, 0.808057069,
+        0.807909318, 0.807761566, 0.807613815, 0.807466063, 0.807318312, 0.807170561,
+        0.807022809, 0.806875058, 0.806727306, 0.806579555, 0.806431803, 0.806284052,
+        0.806136301, 0.805988549, 0.805840798, 0.805693046, 0.805545295, 0.805397544,
+        0.805249792, 0.805102041, 0.804954289, 0.804806538, 0.804658787, 0.804511035,
+        0.804363284, 0.804215532, 0.804067781, 0.80392003, 0.803772278, 0.803624527,
+        0.803476775, 0.803329024, 0.803181273, 0.803033521, 0.80288577, 0.802738018,
+        0.802590267, 0.802442515, 0.802294764, 0.802147013, 0.801999261, 0.80185151,
+        0.801703758, 0.801556007, 0.801408256, 0.801260504, 0.801112753, 0.800965001,
+        0.80081725, 0.800669499, 0.800521747, 0.800373996, 0.800226244, 0.800078493,
+        0.799930742, 0.79978299, 0.799635239, 0.799487487, 0.799339736, 0.799191984,
+        0.799044233, 0.798896482, 0.79874873, 0.798600979, 0.798453227, 0.798305476,
+        0.798157725, 0.798009973, 0.797862222, 0.79771447, 0.797566719, 0.797418968,
+        0.797271216, 0.797123465, 0.796975713, 0.796827962, 0.796680211, 0.796532459,
+        0.796384708, 0.796236956, 0.796089205, 0.795941454, 0.795793702, 0.795645951,
+        0.795498199, 0.795350448, 0.795202696, 0.795054945, 0.794907194, 0.794759442,
+        0.794611691, 0.794463939, 0.794316188, 0.794168437, 0.794020685, 0.793872934,
+        0.793725182, 0.793577431, 0.79342968, 0.793281928, 0.793134177, 0.792986425,
+        0.792838674, 0.792690923, 0.792543171, 0.79239542, 0.792247668, 0.792099917,
+        0.791952165, 0.791804414, 0.791656663, 0.791508911, 0.79136116, 0.791213408,
+        0.791065657, 0.790917906, 0.790770154, 0.790622403, 0.790474651, 0.7903269,
+        0.790179149, 0.790031397, 0.789883646, 0.789735894, 0.789588143, 0.789440392,
+        0.78929264, 0.789144889, 0.788997137, 0.788849386, 0.788701634, 0.788553883,
+        0.788406132, 0.78825838, 0.788110629, 0.787962877, 0.787815126, 0.787667375,
+        0.787519623, 0.787371872, 0.78722412, 0.787076369, 0.786928618, 0.786780866,
+        0.786633115, 0.786485363, 0.786337612, 0.786189861, 0.786042109, 0.785894358,
+        0.785746606, 0.785598855, 0.785451104, 0.785303352, 0.785155601, 0.785007849,
+        0.784860098, 0.784712346, 0.784564595, 0.784416844, 0.784269092, 0.784121341,
+        0.783973589, 0.783825838, 0.783678087, 0.783530335, 0.783382584, 0.783234832,
+        0.783087081, 0.78293933, 0.782791578, 0.782643827, 0.782496075, 0.782348324,
+        0.782200573, 0.782052821, 0.78190507, 0.781757318, 0.781609567, 0.781461815,
+        0.781314064, 0.781166313, 0.781018561, 0.78087081, 0.780723058, 0.780575307,
+        0.780427556, 0.780279804, 0.780132053, 0.779984301, 0.77983655, 0.779688799,
+        0.779541047, 0.779393296, 0.779245544, 0.779097793, 0.778950042, 0.77880229,
+        0.778654539, 0.778506787, 0.778359036, 0.778211285, 0.778063533, 0.777915782,
+        0.77776803, 0.777620279, 0.777472527, 0.777324776, 0.777177025, 0.777029273,
+        0.776881522, 0.77673377, 0.776586019, 0.776438268, 0.776290516, 0.776142765,
+        0.775995013, 0.775847262, 0.775699511, 0.775551759, 0.775404008, 0.775256256,
+        0.775108505, 0.774960754, 0.774813002, 0.774665251, 0.774517499, 0.774369748,
+        0.774221996, 0.774074245, 0.773926494, 0.773778742, 0.773630991, 0.773483239,
+        0.773335488, 0.773187737, 0.773039985, 0.772892234, 0.772744482, 0.772596731,
+        0.77244898, 0.772301228, 0.772153477, 0.772005725, 0.771857974, 0.771710223,
+        0.771562471, 0.77141472, 0.771266968, 0.771119217, 0.770971466, 0.770823714,
+        0.770675963, 0.770528211, 0.77038046, 0.770232708, 0.770084957, 0.769937206,
+        0.769789454, 0.769641703, 0.769493951, 0.7693462, 0.769198449, 0.769050697,
+        0.768902946, 0.768755194, 0.768607443, 0.768459692, 0.76831194, 0.768164189,
+        0.768016437, 0.767868686, 0.767720935, 0.767573183, 0.767425432, 0.76727768,
+        0.767129929, 0.766982177, 0.766834426, 0.766686675, 0.766538923, 0.766391172,
+        0.76624342, 0.766095669, 0.765947918, 0.765800166, 0.765652415, 0.765504663,
+        0.765356912, 0.765209161, 0.765061409, 0.764913658, 0.764765906, 0.764618155,
+        0.764470404, 0.764322652, 0.764174901, 0.764027149, 0.763879398, 0.763731647,
+        0.763583895, 0.763436144, 0.763288392, 0.763140641, 0.762992889, 0.762845138,
+        0.762697387, 0.762549635, 0.762401884, 0.762254132, 0.762106381, 0.76195863,
+        0.761810878, 0.761663127, 0.761515375, 0.761367624, 0.761219873, 0.761072121,
+        0.76092437, 0.760776618, 0.760628867, 0.760481116, 0.760333364, 0.760185613,
+        0.760037861, 0.75989011, 0.759742358, 0.759594607, 0.759446856, 0.759299104,
+        0.759151353, 0.759003601, 0.75885585, 0.758708099, 0.758560347, 0.758412596,
+        0.758264844, 0.758117093, 0.757969342, 0.75782159, 0.757673839, 0.757526087,
+        0.757378336, 0.757230585, 0.757082833, 0.756935082, 0.75678733, 0.756639579,
+        0.756491828, 0.756344076, 0.756196325, 0.756048573, 0.755900822, 0.75575307,
+        0.755605319, 0.755457568, 0.755309816, 0.755162065, 0.755014313, 0.754866562,
+        0.754718811, 0.754571059, 0.754423308, 0.754275556, 0.754127805, 0.753980054,
+        0.753832302, 0.753684551, 0.753536799, 0.753389048, 0.753241297, 0.753093545,
+        0.752945794, 0.752798042, 0.752650291, 0.752502539, 0.752354788, 0.752207037,
+        0.752059285, 0.751911534, 0.751763782, 0.751616031, 0.75146828, 0.751320528,
+        0.751172777, 0.751025025, 0.750877274, 0.750729523, 0.750581771, 0.75043402,
+        0.750286268, 0.750138517, 0.749990766, 0.749843014, 0.749695263, 0.749547511,
+        0.74939976, 0.749252008, 0.749104257, 0.748956506, 0.748808754, 0.748661003,
+        0.748513251, 0.7483655, 0.748217749, 0.748069997, 0.747922246, 0.747774494,
+        0.747626743, 0.747478992, 0.74733124, 0.747183489, 0.747035737, 0.746887986,
+        0.746740235, 0.746592483, 0.746444732, 0.74629698, 0.746149229, 0.746001478,
+        0.745853726, 0.745705975, 0.745558223, 0.745410472, 0.74526272, 0.745114969,
+        0.744967218, 0.744819466, 0.744671715, 0.744523963, 0.744376212, 0.744228461,
+        0.744080709, 0.743932958, 0.743785206, 0.743637455, 0.743489704, 0.743341952,
+        0.743194201, 0.743046449, 0.742898698, 0.742750947, 0.742603195, 0.742455444,
+        0.742307692, 0.742159941, 0.742012189, 0.741864438, 0.741716687, 0.741568935,
+        0.741421184, 0.741273432, 0.741125681, 0.74097793, 0.740830178, 0.740682427,
+        0.740534675, 0.740386924, 0.740239173, 0.740091421, 0.73994367, 0.739795918,
+        0.739648167, 0.739500416, 0.739352664, 0.739204913, 0.739057161, 0.73890941,
+        0.738761659, 0.738613907, 0.738466156, 0.738318404, 0.738170653, 0.738022901,
+        0.73787515, 0.737727399, 0.737579647, 0.737431896, 0.737284144, 0.737136393,
+        0.736988642, 0.73684089, 0.736693139, 0.736545387, 0.736397636, 0.736249885,
+        0.736102133, 0.735954382, 0.73580663, 0.735658879, 0.735511128, 0.735363376,
+        0.735215625, 0.735067873, 0.734920122, 0.73477237, 0.734624619, 0.734476868,
+        0.734329116, 0.734181365, 0.734033613, 0.733885862, 0.733738111, 0.733590359,
+        0.733442608, 0.733294856, 0.733147105, 0.732999354, 0.732851602, 0.732703851,
+        0.732556099, 0.732408348, 0.732260597, 0.732112845, 0.731965094, 0.731817342,
+        0.731669591, 0.73152184, 0.731374088, 0.731226337, 0.731078585, 0.730930834,
+        0.730783082, 0.730635331, 0.73048758, 0.730339828, 0.730192077, 0.730044325,
+        0.729896574, 0.729748823, 0.729601071, 0.72945332, 0.729305568, 0.729157817,
+        0.729010066, 0.728862314, 0.728714563, 0.728566811, 0.72841906, 0.728271309,
+        0.728123557, 0.727975806, 0.727828054, 0.727680303, 0.727532551, 0.7273848,
+        0.727237049, 0.727089297, 0.726941546, 0.726793794, 0.726646043, 0.726498292,
+        0.72635054, 0.726202789, 0.726055037, 0.725907286, 0.725759535, 0.725611783,
+        0.725464032, 0.72531628, 0.725168529, 0.725020778, 0.724873026, 0.724725275,
+        0.724577523, 0.724429772, 0.724282021, 0.724134269, 0.723986518, 0.723838766,
+        0.723691015, 0.723543263, 0.723395512, 0.723247761, 0.723100009, 0.722952258,
+        0.722804506, 0.722656755, 0.722509004, 0.722361252, 0.722213501, 0.722065749,
+        0.721917998, 0.721770247, 0.721622495, 0.721474744, 0.721326992, 0.721179241,
+        0.72103149, 0.720883738, 0.720735987, 0.720588235, 0.720440484, 0.720292732,
+        0.720144981, 0.71999723, 0.719849478, 0.719701727, 0.719553975, 0.719406224,
+        0.719258473, 0.719110721, 0.71896297, 0.718815218, 0.718667467, 0.718519716,
+        0.718371964, 0.718224213, 0.718076461, 0.71792871, 0.717780959, 0.717633207,
+        0.717485456, 0.717337704, 0.717189953, 0.717042201, 0.71689445, 0.716746699,
+        0.716598947, 0.716451196, 0.716303444, 0.716155693, 0.716007942, 0.71586019,
+        0.715712439, 0.715564687, 0.715416936, 0.715269185, 0.715121433, 0.714973682,
+        0.71482593, 0.714678179, 0.714530428, 0.714382676, 0.714234925, 0.714087173,
+        0.713939422, 0.713791671, 0.713643919, 0.713496168, 0.713348416, 0.713200665,
+        0.713052913, 0.712905162, 0.712757411, 0.712609659, 0.712461908, 0.712314156,
+        0.712166405, 0.712018654, 0.711870902, 0.711723151, 0.711575399, 0.711427648,
+        0.711279897, 0.711132145, 0.710984394, 0.710836642, 0.710688891, 0.71054114,
+        0.710393388, 0.710245637, 0.710097885, 0.709950134, 0.709802382, 0.709654631,
+        0.70950688, 0.709359128, 0.709211377, 0.709063625, 0.708915874, 0.708768123,
+        0.708620371, 0.70847262, 0.708324868, 0.708177117, 0.708029366, 0.707881614,
+        0.707733863, 0.707586111, 0.70743836, 0.707290609, 0.707142857, 0.706995106,
+        0.706847354, 0.706699603, 0.706551852, 0.7064041, 0.706256349, 0.706108597,
+        0.705960846, 0.705813094, 0.705665343, 0.705517592, 0.70536984, 0.705222089,
+        0.705074337, 0.704926586, 0.704778835, 0.704631083, 0.704483332, 0.70433558,
+        0.704187829, 0.704040078, 0.703892326, 0.703744575, 0.703596823, 0.703449072,
+        0.703301321, 0.703153569, 0.703005818, 0.702858066, 0.702710315, 0.702562563,
+        0.702414812, 0.702267061, 0.702119309, 0.701971558, 0.701823806, 0.701676055,
+        0.701528304, 0.701380552, 0.701232801, 0.701085049, 0.700937298, 0.700789547,
+        0.700641795, 0.700494044, 0.700346292, 0.700198541, 0.70005079, 0.699903038,
+        0.699755287, 0.699607535, 0.699459784, 0.699312033, 0.699164281, 0.69901653,
+        0.698868778, 0.698721027, 0.698573275, 0.698425524, 0.698277773, 0.698130021,
+        0.69798227, 0.697834518, 0.697686767, 0.697539016, 0.697391264, 0.697243513,
+        0.697095761, 0.69694801, 0.696800259, 0.696652507, 0.696504756, 0.696357004,
+        0.696209253, 0.696061502, 0.69591375, 0.695765999, 0.695618247, 0.695470496,
+        0.695322744, 0.695174993, 0.695027242, 0.69487949, 0.694731739, 0.694583987,
+        0.694436236, 0.694288485, 0.694140733, 0.693992982, 0.69384523, 0.693697479,
+        0.693549728, 0.693401976, 0.693254225, 0.693106473, 0.692958722, 0.692810971,
+        0.692663219, 0.692515468, 0.692367716, 0.692219965, 0.692072214, 0.691924462,
+        0.691776711, 0.691628959, 0.691481208, 0.691333456, 0.691185705, 0.691037954,
+        0.690890202, 0.690742451, 0.690594699, 0.690446948, 0.690299197, 0.690151445,
+        0.690003694, 0.689855942, 0.689708191, 0.68956044, 0.689412688, 0.689264937,
+        0.689117185, 0.688969434, 0.688821683, 0.688673931, 0.68852618, 0.688378428,
+        0.688230677, 0.688082925, 0.687935174, 0.687787423, 0.687639671, 0.68749192,
+        0.687344168, 0.687196417, 0.687048666, 0.686900914, 0.686753163, 0.686605411,
+        0.68645766, 0.686309909, 0.686162157, 0.686014406, 0.685866654, 0.685718903,
+        0.685571152, 0.6854234, 0.685275649, 0.685127897, 0.684980146, 0.684832394,
+        0.684684643, 0.684536892, 0.68438914, 0.684241389, 0.684093637, 0.683945886,
+        0.683798135, 0.683650383, 0.683502632, 0.68335488, 0.683207129, 0.683059378,
+        0.682911626, 0.682763875, 0.682616123, 0.682468372, 0.682320621, 0.682172869,
+        0.682025118, 0.681877366, 0.681729615, 0.681581864, 0.681434112, 0.681286361,
+        0.681138609, 0.680990858, 0.680843106, 0.680695355, 0.680547604, 0.680399852,
+        0.680252101, 0.680104349, 0.679956598, 0.679808847, 0.679661095, 0.679513344,
+        0.679365592, 0.679217841, 0.67907009, 0.678922338, 0.678774587, 0.678626835,
+        0.678479084, 0.678331333, 0.678183581, 0.67803583, 0.677888078, 0.677740327,
+        0.677592575, 0.677444824, 0.677297073, 0.677149321, 0.67700157, 0.676853818,
+        0.676706067, 0.676558316, 0.676410564, 0.676262813, 0.676115061, 0.67596731,
+        0.675819559, 0.675671807, 0.675524056, 0.675376304, 0.675228553, 0.675080802,
+        0.67493305, 0.674785299, 0.674637547, 0.674489796, 0.674342045, 0.674194293,
+        0.674046542, 0.67389879, 0.673751039, 0.673603287, 0.673455536, 0.673307785,
+        0.673160033, 0.673012282, 0.67286453, 0.672716779, 0.672569028, 0.672421276,
+        0.672273525, 0.672125773, 0.671978022, 0.671830271, 0.671682519, 0.671534768,
+        0.671387016, 0.671239265, 0.671091514, 0.670943762, 0.670796011, 0.670648259,
+        0.670500508, 0.670352756, 0.670205005, 0.670057254, 0.669909502, 0.669761751,
+        0.669613999, 0.669466248, 0.669318497, 0.669170745, 0.669022994, 0.668875242,
+        0.668727491, 0.66857974, 0.668431988, 0.668284237, 0.668136485, 0.667988734,
+        0.667840983, 0.667693231, 0.66754548, 0.667397728, 0.667249977, 0.667102226,
+        0.666954474, 0.666806723, 0.666658971, 0.66651122, 0.666363468, 0.666215717,
+        0.666067966, 0.665920214, 0.665772463, 0.665624711, 0.66547696, 0.665329209,
+        0.665181457, 0.665033706, 0.664885954, 0.664738203, 0.664590452, 0.6644427,
+        0.664294949, 0.664147197, 0.663999446, 0.663851695, 0.663703943, 0.663556192,
+        0.66340844, 0.663260689, 0.663112937, 0.662965186, 0.662817435, 0.662669683,
+        0.662521932, 0.66237418, 0.662226429, 0.662078678, 0.661930926, 0.661783175,
+        0.661635423, 0.661487672, 0.661339921, 0.661192169, 0.661044418, 0.660896666,
+        0.660748915, 0.660601164, 0.660453412, 0.660305661, 0.660157909, 0.660010158,
+        0.659862407, 0.659714655, 0.659566904, 0.659419152, 0.659271401, 0.659123649,
+        0.658975898, 0.658828147, 0.658680395, 0.658532644, 0.658384892, 0.658237141,
+        0.65808939, 0.657941638, 0.657793887, 0.657646135, 0.657498384, 0.657350633,
+        0.657202881, 0.65705513, 0.656907378, 0.656759627, 0.656611876, 0.656464124,
+        0.656316373, 0.656168621, 0.65602087, 0.655873118, 0.655725367, 0.655577616,
+        0.655429864, 0.655282113, 0.655134361, 0.65498661, 0.654838859, 0.654691107,
+        0.654543356, 0.654395604, 0.654247853, 0.654100102, 0.65395235, 0.653804599,
+        0.653656847, 0.653509096, 0.653361345, 0.653213593, 0.653065842, 0.65291809,
+        0.652770339, 0.652622587, 0.652474836, 0.652327085, 0.652179333, 0.652031582,
+        0.65188383, 0.651736079, 0.651588328, 0.651440576, 0.651292825, 0.651145073,
+        0.650997322, 0.650849571, 0.650701819, 0.650554068, 0.650406316, 0.650258565,
+        0.650110814, 0.649963062, 0.649815311, 0.649667559, 0.649519808, 0.649372057,
+        0.649224305, 0.649076554, 0.648928802, 0.648781051, 0.648633299, 0.648485548,
+        0.648337797, 0.648190045, 0.648042294, 0.647894542, 0.647746791, 0.64759904,
+        0.647451288, 0.647303537, 0.647155785, 0.647008034, 0.646860283, 0.646712531,
+        0.64656478, 0.646417028, 0.646269277, 0.646121526, 0.645973774, 0.645826023,
+        0.645678271, 0.64553052, 0.645382768, 0.645235017, 0.645087266, 0.644939514,
+        0.644791763, 0.644644011, 0.64449626, 0.644348509, 0.644200757, 0.644053006,
+        0.643905254, 0.643757503, 0.643609752, 0.643462, 0.643314249, 0.643166497,
+        0.643018746, 0.642870995, 0.642723243, 0.642575492, 0.64242774, 0.642279989,
+        0.642132238, 0.641984486, 0.641836735, 0.641688983, 0.641541232, 0.64139348,
+        0.641245729, 0.641097978, 0.640950226, 0.640802475, 0.640654723, 0.640506972,
+        0.640359221, 0.640211469, 0.640063718, 0.639915966, 0.639768215, 0.639620464,
+        0.639472712, 0.639324961, 0.639177209, 0.639029458, 0.638881707, 0.638733955,
+        0.638586204, 0.638438452, 0.638290701, 0.638142949, 0.637995198, 0.637847447,
+        0.637699695, 0.637551944, 0.637404192, 0.637256441, 0.63710869, 0.636960938,
+        0.636813187, 0.636665435, 0.636517684, 0.636369933, 0.636222181, 0.63607443,
+        0.635926678, 0.635778927, 0.635631176, 0.635483424, 0.635335673, 0.635187921,
+        0.63504017, 0.634892419, 0.634744667, 0.634596916, 0.634449164, 0.634301413,
+        0.634153661, 0.63400591, 0.633858159, 0.633710407, 0.633562656, 0.633414904,
+        0.633267153, 0.633119402, 0.63297165, 0.632823899, 0.632676147, 0.632528396,
+        0.632380645, 0.632232893, 0.632085142, 0.63193739, 0.631789639, 0.631641888,
+        0.631494136, 0.631346385, 0.631198633, 0.631050882, 0.63090313, 0.630755379,
+        0.630607628, 0.630459876, 0.630312125, 0.630164373, 0.630016622, 0.629868871,
+        0.629721119, 0.629573368, 0.629425616, 0.629277865, 0.629130114, 0.628982362,
+        0.628834611, 0.628686859, 0.628539108, 0.628391357, 0.628243605, 0.628095854,
+        0.627948102, 0.627800351, 0.6276526, 0.627504848, 0.627357097, 0.627209345,
+        0.627061594, 0.626913842, 0.626766091, 0.62661834, 0.626470588, 0.626322837,
+        0.626175085, 0.626027334, 0.625879583, 0.625731831, 0.62558408, 0.625436328,
+        0.625288577, 0.625140826, 0.624993074, 0.624845323, 0.624697571, 0.62454982,
+        0.624402069, 0.624254317, 0.624106566, 0.623958814, 0.623811063, 0.623663311,
+        0.62351556, 0.623367809, 0.623220057, 0.623072306, 0.622924554, 0.622776803,
+        0.622629052, 0.6224813, 0.622333549, 0.622185797, 0.622038046, 0.621890295,
+        0.621742543, 0.621594792, 0.62144704, 0.621299289, 0.621151538, 0.621003786,
+        0.620856035, 0.620708283, 0.620560532, 0.62041278, 0.620265029, 0.620117278,
+        0.619969526, 0.619821775, 0.619674023, 0.619526272, 0.619378521, 0.619230769,
+        0.619083018, 0.618935266, 0.618787515, 0.618639764, 0.618492012, 0.618344261,
+        0.618196509, 0.618048758, 0.617901007, 0.617753255, 0.617605504, 0.617457752,
+        0.617310001, 0.61716225, 0.617014498, 0.616866747, 0.616718995, 0.616571244,
+        0.616423492, 0.616275741, 0.61612799, 0.615980238, 0.615832487, 0.615684735,
+        0.615536984, 0.615389233, 0.615241481, 0.61509373, 0.614945978, 0.614798227,
+        0.614650476, 0.614502724, 0.614354973, 0.614207221, 0.61405947, 0.613911719,
+        0.613763967, 0.613616216, 0.613468464, 0.613320713, 0.613172961, 0.61302521,
+        0.612877459, 0.612729707, 0.612581956, 0.612434204, 0.612286453, 0.612138702,
+        0.61199095, 0.611843199, 0.611695447, 0.611547696, 0.611399945, 0.611252193,
+        0.611104442, 0.61095669, 0.610808939, 0.610661188, 0.610513436, 0.610365685,
+        0.610217933, 0.610070182, 0.609922431, 0.609774679, 0.609626928, 0.609479176,
+        0.609331425, 0.609183673, 0.609035922, 0.608888171, 0.608740419, 0.608592668,
+        0.608444916, 0.608297165, 0.608149414, 0.608001662, 0.607853911, 0.607706159,
+        0.607558408, 0.607410657, 0.607262905, 0.607115154, 0.606967402, 0.606819651,
+        0.6066719, 0.606524148, 0.606376397, 0.606228645, 0.606080894, 0.605933142,
+        0.605785391, 0.60563764, 0.605489888, 0.605342137, 0.605194385, 0.605046634,
+        0.604898883, 0.604751131, 0.60460338, 0.604455628, 0.604307877, 0.604160126,
+        0.604012374, 0.603864623, 0.603716871, 0.60356912, 0.603421369, 0.603273617,
+        0.603125866, 0.602978114, 0.602830363, 0.602682612, 0.60253486, 0.602387109,
+        0.602239357, 0.602091606, 0.601943854, 0.601796103, 0.601648352, 0.6015006,
+        0.601352849, 0.601205097, 0.601057346, 0.600909595, 0.600761843, 0.600614092,
+        0.60046634, 0.600318589, 0.600170838, 0.600023086, 0.599875335, 0.599727583,
+        0.599579832, 0.599432081, 0.599284329, 0.599136578, 0.598988826, 0.598841075,
+        0.598693323, 0.598545572, 0.598397821, 0.598250069, 0.598102318, 0.597954566,
+        0.597806815, 0.597659064, 0.597511312, 0.597363561, 0.597215809, 0.597068058,
+        0.596920307, 0.596772555, 0.596624804, 0.596477052, 0.596329301, 0.59618155,
+        0.596033798, 0.595886047, 0.595738295, 0.595590544, 0.595442793, 0.595295041,
+        0.59514729, 0.594999538, 0.594851787, 0.594704035, 0.594556284, 0.594408533,
+        0.594260781, 0.59411303, 0.593965278, 0.593817527, 0.593669776, 0.593522024,
+        0.593374273, 0.593226521, 0.59307877, 0.592931019, 0.592783267, 0.592635516,
+        0.592487764, 0.592340013, 0.592192262, 0.59204451, 0.591896759, 0.591749007,
+        0.591601256, 0.591453504, 0.591305753, 0.591158002, 0.59101025, 0.590862499,
+        0.590714747, 0.590566996, 0.590419245, 0.590271493, 0.590123742, 0.58997599,
+        0.589828239, 0.589680488, 0.589532736, 0.589384985, 0.589237233, 0.589089482,
+        0.588941731, 0.588793979, 0.588646228, 0.588498476, 0.588350725, 0.588202973,
+        0.588055222, 0.587907471, 0.587759719, 0.587611968, 0.587464216, 0.587316465,
+        0.587168714, 0.587020962, 0.586873211, 0.586725459, 0.586577708, 0.586429957,
+        0.586282205, 0.586134454, 0.585986702, 0.585838951, 0.5856912, 0.585543448,
+        0.585395697, 0.585247945, 0.585100194, 0.584952443, 0.584804691, 0.58465694,
+        0.584509188, 0.584361437, 0.584213685, 0.584065934, 0.583918183, 0.583770431,
+        0.58362268, 0.583474928, 0.583327177, 0.583179426, 0.583031674, 0.582883923,
+        0.582736171, 0.58258842, 0.582440669, 0.582292917, 0.582145166, 0.581997414,
+        0.581849663, 0.581701912, 0.58155416, 0.581406409, 0.581258657, 0.581110906,
+        0.580963154, 0.580815403, 0.580667652, 0.5805199, 0.580372149, 0.580224397,
+        0.580076646, 0.579928895, 0.579781143, 0.579633392, 0.57948564, 0.579337889,
+        0.579190138, 0.579042386, 0.578894635, 0.578746883, 0.578599132, 0.578451381,
+        0.578303629, 0.578155878, 0.578008126, 0.577860375, 0.577712624, 0.577564872,
+        0.577417121, 0.577269369, 0.577121618, 0.576973866, 0.576826115, 0.576678364,
+        0.576530612, 0.576382861, 0.576235109, 0.576087358, 0.575939607, 0.575791855,
+        0.575644104, 0.575496352, 0.575348601, 0.57520085, 0.575053098, 0.574905347,
+        0.574757595, 0.574609844, 0.574462093, 0.574314341, 0.57416659, 0.574018838,
+        0.573871087, 0.573723335, 0.573575584, 0.573427833, 0.573280081, 0.57313233,
+        0.572984578, 0.572836827, 0.572689076, 0.572541324, 0.572393573, 0.572245821,
+        0.57209807, 0.571950319, 0.571802567, 0.571654816, 0.571507064, 0.571359313,
+        0.571211562, 0.57106381, 0.570916059, 0.570768307, 0.570620556, 0.570472805,
+        0.570325053, 0.570177302, 0.57002955, 0.569881799, 0.569734047, 0.569586296,
+        0.569438545, 0.569290793, 0.569143042, 0.56899529, 0.568847539, 0.568699788,
+        0.568552036, 0.568404285, 0.568256533, 0.568108782, 0.567961031, 0.567813279,
+        0.567665528, 0.567517776, 0.567370025, 0.567222274, 0.567074522, 0.566926771,
+        0.566779019, 0.566631268, 0.566483516, 0.566335765, 0.566188014, 0.566040262,
+        0.565892511, 0.565744759, 0.565597008, 0.565449257, 0.565301505, 0.565153754,
+        0.565006002, 0.564858251, 0.5647105, 0.564562748, 0.564414997, 0.564267245,
+        0.564119494, 0.563971743, 0.563823991, 0.56367624, 0.563528488, 0.563380737,
+        0.563232986, 0.563085234, 0.562937483, 0.562789731, 0.56264198, 0.562494228,
+        0.562346477, 0.562198726, 0.562050974, 0.561903223, 0.561755471, 0.56160772,
+        0.561459969, 0.561312217, 0.561164466, 0.561016714, 0.560868963, 0.560721212,
+        0.56057346, 0.560425709, 0.560277957, 0.560130206, 0.559982455, 0.559834703,
+        0.559686952, 0.5595392, 0.559391449, 0.559243697, 0.559095946, 0.558948195,
+        0.558800443, 0.558652692, 0.55850494, 0.558357189, 0.558209438, 0.558061686,
+        0.557913935, 0.557766183, 0.557618432, 0.557470681, 0.557322929, 0.557175178,
+        0.557027426, 0.556879675, 0.556731924, 0.556584172, 0.556436421, 0.556288669,
+        0.556140918, 0.555993166, 0.555845415, 0.555697664, 0.555549912, 0.555402161,
+        0.555254409, 0.555106658, 0.554958907, 0.554811155, 0.554663404, 0.554515652,
+        0.554367901, 0.55422015, 0.554072398, 0.553924647, 0.553776895, 0.553629144,
+        0.553481393, 0.553333641, 0.55318589, 0.553038138, 0.552890387, 0.552742636,
+        0.552594884, 0.552447133, 0.552299381, 0.55215163, 0.552003878, 0.551856127,
+        0.551708376, 0.551560624, 0.551412873, 0.551265121, 0.55111737, 0.550969619,
+        0.550821867, 0.550674116, 0.550526364, 0.550378613, 0.550230862, 0.55008311,
+        0.549935359, 0.549787607, 0.549639856, 0.549492105, 0.549344353, 0.549196602,
+        0.54904885, 0.548901099, 0.548753347, 0.548605596, 0.548457845, 0.548310093,
+        0.548162342, 0.54801459, 0.547866839, 0.547719088, 0.547571336, 0.547423585,
+        0.547275833, 0.547128082, 0.546980331, 0.546832579, 0.546684828, 0.546537076,
+        0.546389325, 0.546241574, 0.546093822, 0.545946071, 0.545798319, 0.545650568,
+        0.545502817, 0.545355065, 0.545207314, 0.545059562, 0.544911811, 0.544764059,
+        0.544616308, 0.544468557, 0.544320805, 0.544173054, 0.544025302, 0.543877551,
+        0.5437298, 0.543582048, 0.543434297, 0.543286545, 0.543138794, 0.542991043,
+        0.542843291, 0.54269554, 0.542547788, 0.542400037, 0.542252286, 0.542104534,
+        0.541956783, 0.541809031, 0.54166128, 0.541513528, 0.541365777, 0.541218026,
+        0.541070274, 0.540922523, 0.540774771, 0.54062702, 0.540479269, 0.540331517,
+        0.540183766, 0.540036014, 0.539888263, 0.539740512, 0.53959276, 0.539445009,
+        0.539297257, 0.539149506, 0.539001755, 0.538854003, 0.538706252, 0.5385585,
+        0.538410749, 0.538262998, 0.538115246, 0.537967495, 0.537819743, 0.537671992,
+        0.53752424, 0.537376489, 0.537228738, 0.537080986, 0.536933235, 0.536785483,
+        0.536637732, 0.536489981, 0.536342229, 0.536194478, 0.536046726, 0.535898975,
+        0.535751224, 0.535603472, 0.535455721, 0.535307969, 0.535160218, 0.535012467,
+        0.534864715, 0.534716964, 0.534569212, 0.534421461, 0.534273709, 0.534125958,
+        0.533978207, 0.533830455, 0.533682704, 0.533534952, 0.533387201, 0.53323945,
+        0.533091698, 0.532943947, 0.532796195, 0.532648444, 0.532500693, 0.532352941,
+        0.53220519, 0.532057438, 0.531909687, 0.531761936, 0.531614184, 0.531466433,
+        0.531318681, 0.53117093, 0.531023179, 0.530875427, 0.530727676, 0.530579924,
+        0.530432173, 0.530284421, 0.53013667, 0.529988919, 0.529841167, 0.529693416,
+        0.529545664, 0.529397913, 0.529250162, 0.52910241, 0.528954659, 0.528806907,
+        0.528659156, 0.528511405, 0.528363653, 0.528215902, 0.52806815, 0.527920399,
+        0.527772648, 0.527624896, 0.527477145, 0.527329393, 0.527181642, 0.52703389,
+        0.526886139, 0.526738388, 0.526590636, 0.526442885, 0.526295133, 0.526147382,
+        0.525999631, 0.525851879, 0.525704128, 0.525556376, 0.525408625, 0.525260874,
+        0.525113122, 0.524965371, 0.524817619, 0.524669868, 0.524522117, 0.524374365,
+        0.524226614, 0.524078862, 0.523931111, 0.523783359, 0.523635608, 0.523487857,
+        0.523340105, 0.523192354, 0.523044602, 0.522896851, 0.5227491, 0.522601348,
+        0.522453597, 0.522305845, 0.522158094, 0.522010343, 0.521862591, 0.52171484,
+        0.521567088, 0.521419337, 0.521271586, 0.521123834, 0.520976083, 0.520828331,
+        0.52068058, 0.520532829, 0.520385077, 0.520237326, 0.520089574, 0.519941823,
+        0.519794071, 0.51964632, 0.519498569, 0.519350817, 0.519203066, 0.519055314,
+        0.518907563, 0.518759812, 0.51861206, 0.518464309, 0.518316557, 0.518168806,
+        0.518021055, 0.517873303, 0.517725552, 0.5175778, 0.517430049, 0.517282298,
+        0.517134546, 0.516986795, 0.516839043, 0.516691292, 0.51654354, 0.516395789,
+        0.516248038, 0.516100286, 0.515952535, 0.515804783, 0.515657032, 0.515509281,
+        0.515361529, 0.515213778, 0.515066026, 0.514918275, 0.514770524, 0.514622772,
+        0.514475021, 0.514327269, 0.514179518, 0.514031767, 0.513884015, 0.513736264,
+        0.513588512, 0.513440761, 0.51329301, 0.513145258, 0.512997507, 0.512849755,
+        0.512702004, 0.512554252, 0.512406501, 0.51225875, 0.512110998, 0.511963247,
+        0.511815495, 0.511667744, 0.511519993, 0.511372241, 0.51122449, 0.511076738,
+        0.510928987, 0.510781236, 0.510633484, 0.510485733, 0.510337981, 0.51019023,
+        0.510042479, 0.509894727, 0.509746976, 0.509599224, 0.509451473, 0.509303721,
+        0.50915597, 0.509008219, 0.508860467, 0.508712716, 0.508564964, 0.508417213,
+        0.508269462, 0.50812171, 0.507973959, 0.507826207, 0.507678456, 0.507530705,
+        0.507382953, 0.507235202, 0.50708745, 0.506939699, 0.506791948, 0.506644196,
+        0.506496445, 0.506348693, 0.506200942, 0.506053191, 0.505905439, 0.505757688,
+        0.505609936, 0.505462185, 0.505314433, 0.505166682, 0.505018931, 0.504871179,
+        0.504723428, 0.504575676, 0.504427925, 0.504280174, 0.504132422, 0.503984671,
+        0.503836919, 0.503689168, 0.503541417, 0.503393665, 0.503245914, 0.503098162,
+        0.502950411, 0.50280266, 0.502654908, 0.502507157, 0.502359405, 0.502211654,
+        0.502063902, 0.501916151, 0.5017684, 0.501620648, 0.501472897, 0.501325145,
+        0.501177394, 0.500784929, 0.500392465, 0.5, 0.499607535, 0.499215071,
+        0.498822606, 0.498430141, 0.498037677, 0.497645212, 0.497252747, 0.496860283,
+        0.496467818, 0.496075353, 0.495682889, 0.495290424, 0.494897959, 0.494505495,
+        0.49411303, 0.493720565, 0.4933281, 0.492935636, 0.492543171, 0.492150706,
+        0.491758242, 0.491365777, 0.490973312, 0.490580848, 0.490188383, 0.489795918,
+        0.489403454, 0.489010989, 0.488618524, 0.48822606, 0.487833595, 0.48744113,
+        0.487048666, 0.486656201, 0.486263736, 0.485871272, 0.485478807, 0.485086342,
+        0.484693878, 0.484301413, 0.483908948, 0.483516484, 0.483124019, 0.482731554,
+        0.482339089, 0.481946625, 0.48155416, 0.481161695, 0.480769231, 0.480376766,
+        0.479984301, 0.479591837, 0.479199372, 0.478806907, 0.478414443, 0.478021978,
+        0.477629513, 0.477237049, 0.476844584, 0.476452119, 0.476059655, 0.47566719,
+        0.475274725, 0.474882261, 0.474489796, 0.474097331, 0.473704867, 0.473312402,
+        0.472919937, 0.472527473, 0.472135008, 0.471742543, 0.471350078, 0.470957614,
+        0.470565149, 0.470172684, 0.46978022, 0.469387755, 0.46899529, 0.468602826,
+        0.468210361, 0.467817896, 0.467425432, 0.467032967, 0.466640502, 0.466248038,
+        0.465855573, 0.465463108, 0.465070644, 0.464678179, 0.464285714, 0.46389325,
+        0.463500785, 0.46310832, 0.462715856, 0.462323391, 0.461930926, 0.461538462,
+        0.461145997, 0.460753532, 0.460361068, 0.459968603, 0.459576138, 0.459183673,
+        0.458791209, 0.458398744, 0.458006279, 0.457613815, 0.45722135, 0.456828885,
+        0.456436421, 0.456043956, 0.455651491, 0.455259027, 0.454866562, 0.454474097,
+        0.454081633, 0.453689168, 0.453296703, 0.452904239, 0.452511774, 0.452119309,
+        0.451726845, 0.45133438, 0.450941915, 0.450549451, 0.450156986, 0.449764521,
+        0.449372057, 0.448979592, 0.448587127, 0.448194662, 0.447802198, 0.447409733,
+        0.447017268, 0.446624804, 0.446232339, 0.445839874, 0.44544741, 0.445054945,
+        0.44466248, 0.444270016, 0.443877551, 0.443485086, 0.443092622, 0.442700157,
+        0.442307692, 0.441915228, 0.441522763, 0.441130298, 0.440737834, 0.440345369,
+        0.439952904, 0.43956044, 0.439167975, 0.43877551, 0.438383046, 0.437990581,
+        0.437598116, 0.437205651, 0.436813187, 0.436420722, 0.436028257, 0.435635793,
+        0.435243328, 0.434850863, 0.434458399, 0.434065934, 0.433673469, 0.433281005,
+        0.43288854, 0.432496075, 0.432103611, 0.431711146, 0.431318681, 0.430926217,
+        0.430533752, 0.430141287, 0.429748823, 0.429356358, 0.428963893, 0.428571429,
+        0.428178964, 0.427786499, 0.427394035, 0.42700157, 0.426609105, 0.426216641,
+        0.425824176, 0.425431711, 0.425039246, 0.424646782, 0.424254317, 0.423861852,
+        0.423469388, 0.423076923, 0.422684458, 0.422291994, 0.421899529, 0.421507064,
+        0.4211146, 0.420722135, 0.42032967, 0.419937206, 0.419544741, 0.419152276,
+        0.418759812, 0.418367347, 0.417974882, 0.417582418, 0.417189953, 0.416797488,
+        0.416405024, 0.416012559, 0.415620094, 0.41522763, 0.414835165, 0.4144427,
+        0.414050235, 0.413657771, 0.413265306, 0.412872841, 0.412480377, 0.412087912,
+        0.411695447, 0.411302983, 0.410910518, 0.410518053, 0.410125589, 0.409733124,
+        0.409340659, 0.408948195, 0.40855573, 0.408163265, 0.407770801, 0.407378336,
+        0.406985871, 0.406593407, 0.406200942, 0.405808477, 0.405416013, 0.405023548,
+        0.404631083, 0.404238619, 0.403846154, 0.403453689, 0.403061224, 0.40266876,
+        0.402276295, 0.40188383, 0.401491366, 0.401098901, 0.400706436, 0.400313972,
+        0.399921507, 0.399529042, 0.399136578, 0.398744113, 0.398351648, 0.397959184,
+        0.397566719, 0.397174254, 0.39678179, 0.396389325, 0.39599686, 0.395604396,
+        0.395211931, 0.394819466, 0.394427002, 0.394034537, 0.393642072, 0.393249608,
+        0.392857143, 0.392464678, 0.392072214, 0.391679749, 0.391287284, 0.390894819,
+        0.390502355, 0.39010989, 0.389717425, 0.389324961, 0.388932496, 0.388540031,
+        0.388147567, 0.387755102, 0.387362637, 0.386970173, 0.386577708, 0.386185243,
+        0.385792779, 0.385400314, 0.385007849, 0.384615385, 0.38422292, 0.383830455,
+        0.383437991, 0.383045526, 0.382653061, 0.382260597, 0.381868132, 0.381475667,
+        0.381083203, 0.380690738, 0.380298273, 0.379905808, 0.379513344, 0.379120879,
+        0.378728414, 0.37833595, 0.377943485, 0.37755102, 0.377158556, 0.376766091,
+        0.376373626, 0.375981162, 0.375588697, 0.375196232, 0.374803768, 0.374411303,
+        0.374018838, 0.373626374, 0.373233909, 0.372841444, 0.37244898, 0.372056515,
+        0.37166405, 0.371271586, 0.370879121, 0.370486656, 0.370094192, 0.369701727,
+        0.369309262, 0.368916797, 0.368524333, 0.368131868, 0.367739403, 0.367346939,
+        0.366954474, 0.366562009, 0.366169545, 0.36577708, 0.365384615, 0.364992151,
+        0.364599686, 0.364207221, 0.363814757, 0.363422292, 0.363029827, 0.362637363,
+        0.362244898, 0.361852433, 0.361459969, 0.361067504, 0.360675039, 0.360282575,
+        0.35989011, 0.359497645, 0.359105181, 0.358712716, 0.358320251, 0.357927786,
+        0.357535322, 0.357142857, 0.356750392, 0.356357928, 0.355965463, 0.355572998,
+        0.355180534, 0.354788069, 0.354395604, 0.35400314, 0.353610675, 0.35321821,
+        0.352825746, 0.352433281, 0.352040816, 0.351648352, 0.351255887, 0.350863422,
+        0.350470958, 0.350078493, 0.349686028, 0.349293564, 0.348901099, 0.348508634,
+        0.34811617, 0.347723705, 0.34733124, 0.346938776, 0.346546311, 0.346153846,
+        0.345761381, 0.345368917, 0.344976452, 0.344583987, 0.344191523, 0.343799058,
+        0.343406593, 0.343014129, 0.342621664, 0.342229199, 0.341836735, 0.34144427,
+        0.341051805, 0.340659341, 0.340266876, 0.339874411, 0.339481947, 0.339089482,
+        0.338697017, 0.338304553, 0.337912088, 0.337519623, 0.337127159, 0.336734694,
+        0.336342229, 0.335949765, 0.3355573, 0.335164835, 0.33477237, 0.334379906,
+        0.333987441, 0.333594976, 0.333202512, 0.332810047, 0.332417582, 0.332025118,
+        0.331632653, 0.331240188, 0.330847724, 0.330455259, 0.330062794, 0.32967033,
+        0.329277865, 0.3288854, 0.328492936, 0.328100471, 0.327708006, 0.327315542,
+        0.326923077, 0.326530612, 0.326138148, 0.325745683, 0.325353218, 0.324960754,
+        0.324568289, 0.324175824, 0.323783359, 0.323390895, 0.32299843, 0.322605965,
+        0.322213501, 0.321821036, 0.321428571, 0.321036107, 0.320643642, 0.320251177,
+        0.319858713, 0.319466248, 0.319073783, 0.318681319, 0.318288854, 0.317896389,
+        0.317503925, 0.31711146, 0.316718995, 0.316326531, 0.315934066, 0.315541601,
+        0.315149137, 0.314756672, 0.314364207, 0.313971743, 0.313579278, 0.313186813,
+        0.312794349, 0.312401884, 0.312009419, 0.311616954, 0.31122449, 0.310832025,
+        0.31043956, 0.310047096, 0.309654631, 0.309262166, 0.308869702, 0.308477237,
+        0.308084772, 0.307692308, 0.307299843, 0.306907378, 0.306514914, 0.306122449,
+        0.305729984, 0.30533752, 0.304945055, 0.30455259, 0.304160126, 0.303767661,
+        0.303375196, 0.302982732, 0.302590267, 0.302197802, 0.301805338, 0.301412873,
+        0.301020408, 0.300627943, 0.300235479, 0.299843014, 0.299450549, 0.299058085,
+        0.29866562, 0.298273155, 0.297880691, 0.297488226, 0.297095761, 0.296703297,
+        0.296310832, 0.295918367, 0.295525903, 0.295133438, 0.294740973, 0.294348509,
+        0.293956044, 0.293563579, 0.293171115, 0.29277865, 0.292386185, 0.291993721,
+        0.291601256, 0.291208791, 0.290816327, 0.290423862, 0.290031397, 0.289638932,
+        0.289246468, 0.288854003, 0.288461538, 0.288069074, 0.287676609, 0.287284144,
+        0.28689168, 0.286499215, 0.28610675, 0.285714286, 0.285321821, 0.284929356,
+        0.284536892, 0.284144427, 0.283751962, 0.283359498, 0.282967033, 0.282574568,
+        0.282182104, 0.281789639, 0.281397174, 0.28100471, 0.280612245, 0.28021978,
+        0.279827316, 0.279434851, 0.279042386, 0.278649922, 0.278257457, 0.277864992,
+        0.277472527, 0.277080063, 0.276687598, 0.276295133, 0.275902669, 0.275510204,
+        0.275117739, 0.274725275, 0.27433281, 0.273940345, 0.273547881, 0.273155416,
+        0.272762951, 0.272370487, 0.271978022, 0.271585557, 0.271193093, 0.270800628,
+        0.270408163, 0.270015699, 0.269623234, 0.269230769, 0.268838305, 0.26844584,
+        0.268053375, 0.267660911, 0.267268446, 0.266875981, 0.266483516, 0.266091052,
+        0.265698587, 0.265306122, 0.264913658, 0.264521193, 0.264128728, 0.263736264,
+        0.263343799, 0.262951334, 0.26255887, 0.262166405, 0.26177394, 0.261381476,
+        0.260989011, 0.260596546, 0.260204082, 0.259811617, 0.259419152, 0.259026688,
+        0.258634223, 0.258241758, 0.257849294, 0.257456829, 0.257064364, 0.2566719,
+        0.256279435, 0.25588697, 0.255494505, 0.255102041, 0.254709576, 0.254317111,
+        0.253924647, 0.253532182, 0.253139717, 0.252747253, 0.252354788, 0.251962323,
+        0.251569859, 0.251177394, 0.250784929, 0.250392465, 0.25, 0.249607535,
+        0.249215071, 0.248822606, 0.248430141, 0.248037677, 0.247645212, 0.247252747,
+        0.246860283, 0.246467818, 0.246075353, 0.245682889, 0.245290424, 0.244897959,
+        0.244505495, 0.24411303, 0.243720565, 0.2433281, 0.242935636, 0.242543171,
+        0.242150706, 0.241758242, 0.241365777, 0.240973312, 0.240580848, 0.240188383,
+        0.239795918, 0.239403454, 0.239010989, 0.238618524, 0.23822606, 0.237833595,
+        0.23744113, 0.237048666, 0.236656201, 0.236263736, 0.235871272, 0.235478807,
+        0.235086342, 0.234693878, 0.234301413, 0.233908948, 0.233516484, 0.233124019,
+        0.232731554, 0.232339089, 0.231946625, 0.23155416, 0.231161695, 0.230769231,
+        0.230376766, 0.229984301, 0.229591837, 0.229199372, 0.228806907, 0.228414443,
+        0.228021978, 0.227629513, 0.227237049, 0.226844584, 0.226452119, 0.226059655,
+        0.22566719, 0.225274725, 0.224882261, 0.224489796, 0.224097331, 0.223704867,
+        0.223312402, 0.222919937, 0.222527473, 0.222135008, 0.221742543, 0.221350078,
+        0.220957614, 0.220565149, 0.220172684, 0.21978022, 0.219387755, 0.21899529,
+        0.218602826, 0.218210361, 0.217817896, 0.217425432, 0.217032967, 0.216640502,
+        0.216248038, 0.215855573, 0.215463108, 0.215070644, 0.214678179, 0.214285714,
+        0.21389325, 0.213500785, 0.21310832, 0.212715856, 0.212323391, 0.211930926,
+        0.211538462, 0.211145997, 0.210753532, 0.210361068, 0.209968603, 0.209576138,
+        0.209183673, 0.208791209, 0.208398744, 0.208006279, 0.207613815, 0.20722135,
+        0.206828885, 0.206436421, 0.206043956, 0.205651491, 0.205259027, 0.204866562,
+        0.204474097, 0.204081633, 0.203689168, 0.203296703, 0.202904239, 0.202511774,
+        0.202119309, 0.201726845, 0.20133438, 0.200941915, 0.200549451, 0.200156986,
+        0.199764521, 0.199372057, 0.198979592, 0.198587127, 0.198194662, 0.197802198,
+        0.197409733, 0.197017268, 0.196624804, 0.196232339, 0.195839874, 0.19544741,
+        0.195054945, 0.19466248, 0.194270016, 0.193877551, 0.193485086, 0.193092622,
+        0.192700157, 0.192307692, 0.191915228, 0.191522763, 0.191130298, 0.190737834,
+        0.190345369, 0.189952904, 0.18956044, 0.189167975, 0.18877551, 0.188383046,
+        0.187990581, 0.187598116, 0.187205651, 0.186813187, 0.186420722, 0.186028257,
+        0.185635793, 0.185243328, 0.184850863, 0.184458399, 0.184065934, 0.183673469,
+        0.183281005, 0.18288854, 0.182496075, 0.182103611, 0.181711146, 0.181318681,
+        0.180926217, 0.180533752, 0.180141287, 0.179748823, 0.179356358, 0.178963893,
+        0.178571429, 0.178178964, 0.177786499, 0.177394035, 0.17700157, 0.176609105,
+        0.176216641, 0.175824176, 0.175431711, 0.175039246, 0.174646782, 0.174254317,
+        0.173861852, 0.173469388, 0.173076923, 0.172684458, 0.172291994, 0.171899529,
+        0.171507064, 0.1711146, 0.170722135, 0.17032967, 0.169937206, 0.169544741,
+        0.169152276, 0.168759812, 0.168367347, 0.167974882, 0.167582418, 0.167189953,
+        0.166797488, 0.166405024, 0.166012559, 0.165620094, 0.16522763, 0.164835165,
+        0.1644427, 0.164050235, 0.163657771, 0.163265306, 0.162872841, 0.162480377,
+        0.162087912, 0.161695447, 0.161302983, 0.160910518, 0.160518053, 0.160125589,
+        0.159733124, 0.159340659, 0.158948195, 0.15855573, 0.158163265, 0.157770801,
+        0.157378336, 0.156985871, 0.156593407, 0.156200942, 0.155808477, 0.155416013,
+        0.155023548, 0.154631083, 0.154238619, 0.153846154, 0.153453689, 0.153061224,
+        0.15266876, 0.152276295, 0.15188383, 0.151491366, 0.151098901, 0.150706436,
+        0.150313972, 0.149921507, 0.149529042, 0.149136578, 0.148744113, 0.148351648,
+        0.147959184, 0.147566719, 0.147174254, 0.14678179, 0.146389325, 0.14599686,
+        0.145604396, 0.145211931, 0.144819466, 0.144427002, 0.144034537, 0.143642072,
+        0.143249608, 0.142857143, 0.142464678, 0.142072214, 0.141679749, 0.141287284,
+        0.140894819, 0.140502355, 0.14010989, 0.139717425, 0.139324961, 0.138932496,
+        0.138540031, 0.138147567, 0.137755102, 0.137362637, 0.136970173, 0.136577708,
+        0.136185243, 0.135792779, 0.135400314, 0.135007849, 0.134615385, 0.13422292,
+        0.133830455, 0.133437991, 0.133045526, 0.132653061, 0.132260597, 0.131868132,
+        0.131475667, 0.131083203, 0.130690738, 0.130298273, 0.129905808, 0.129513344,
+        0.129120879, 0.128728414, 0.12833595, 0.127943485, 0.12755102, 0.127158556,
+        0.126766091, 0.126373626, 0.125981162, 0.125588697, 0.125196232, 0.124803768,
+        0.124411303, 0.124018838, 0.123626374, 0.123233909, 0.122841444, 0.12244898,
+        0.122056515, 0.12166405, 0.121271586, 0.120879121, 0.120486656, 0.120094192,
+        0.119701727, 0.119309262, 0.118916797, 0.118524333, 0.118131868, 0.117739403,
+        0.117346939, 0.116954474, 0.116562009, 0.116169545, 0.11577708, 0.115384615,
+        0.114992151, 0.114599686, 0.114207221, 0.113814757, 0.113422292, 0.113029827,
+        0.112637363, 0.112244898, 0.111852433, 0.111459969, 0.111067504, 0.110675039,
+        0.110282575, 0.10989011, 0.109497645, 0.109105181, 0.108712716, 0.108320251,
+        0.107927786, 0.107535322, 0.107142857, 0.106750392, 0.106357928, 0.105965463,
+        0.105572998, 0.105180534, 0.104788069, 0.104395604, 0.10400314, 0.103610675,
+        0.10321821, 0.102825746, 0.102433281, 0.102040816, 0.101648352, 0.101255887,
+        0.100863422, 0.100470958, 0.100078493, 0.0996860283, 0.0992935636, 0.0989010989,
+        0.0985086342, 0.0981161695, 0.0977237049, 0.0973312402, 0.0969387755, 0.0965463108,
+        0.0961538462, 0.0957613815, 0.0953689168, 0.0949764521, 0.0945839874, 0.0941915228,
+        0.0937990581, 0.0934065934, 0.0930141287, 0.0926216641, 0.0922291994, 0.0918367347,
+        0.09144427, 0.0910518053, 0.0906593407, 0.090266876, 0.0898744113, 0.0894819466,
+        0.0890894819, 0.0886970173, 0.0883045526, 0.0879120879, 0.0875196232, 0.0871271586,
+        0.0867346939, 0.0863422292, 0.0859497645, 0.0855572998, 0.0851648352, 0.0847723705,
+        0.0843799058, 0.0839874411, 0.0835949765, 0.0832025118, 0.0828100471, 0.0824175824,
+        0.0820251177, 0.0816326531, 0.0812401884, 0.0808477237, 0.080455259, 0.0800627943,
+        0.0796703297, 0.079277865, 0.0788854003, 0.0784929356, 0.078100471, 0.0777080063,
+        0.0773155416, 0.0769230769, 0.0765306122, 0.0761381476, 0.0757456829, 0.0753532182,
+        0.0749607535, 0.0745682889, 0.0741758242, 0.0737833595, 0.0733908948, 0.0729984301,
+        0.0726059655, 0.0722135008, 0.0718210361, 0.0714285714, 0.0710361068, 0.0706436421,
+        0.0702511774, 0.0698587127, 0.069466248, 0.0690737834, 0.0686813187, 0.068288854,
+        0.0678963893, 0.0675039246, 0.06711146, 0.0667189953, 0.0663265306, 0.0659340659,
+        0.0655416013, 0.0651491366, 0.0647566719, 0.0643642072, 0.0639717425, 0.0635792779,
+        0.0631868132, 0.0627943485, 0.0624018838, 0.0620094192, 0.0616169545, 0.0612244898,
+        0.0608320251, 0.0604395604, 0.0600470958, 0.0596546311, 0.0592621664, 0.0588697017,
+        0.058477237, 0.0580847724, 0.0576923077, 0.057299843, 0.0569073783, 0.0565149137,
+        0.056122449, 0.0557299843, 0.0553375196, 0.0549450549, 0.0545525903, 0.0541601256,
+        0.0537676609, 0.0533751962, 0.0529827316, 0.0525902669, 0.0521978022, 0.0518053375,
+        0.0514128728, 0.0510204082, 0.0506279435, 0.0502354788, 0.0498430141, 0.0494505495,
+        0.0490580848, 0.0486656201, 0.0482731554, 0.0478806907, 0.0474882261, 0.0470957614,
+        0.0467032967, 0.046310832, 0.0459183673, 0.0455259027, 0.045133438, 0.0447409733,
+        0.0443485086, 0.043956044, 0.0435635793, 0.0431711146, 0.0427786499, 0.0423861852,
+        0.0419937206, 0.0416012559, 0.0412087912, 0.0408163265, 0.0404238619, 0.0400313972,
+        0.0396389325, 0.0392464678, 0.0388540031, 0.0384615385, 0.0380690738, 0.0376766091,
+        0.0372841444, 0.0368916797, 0.0364992151, 0.0361067504, 0.0357142857, 0.035321821,
+        0.0349293564, 0.0345368917, 0.034144427, 0.0337519623, 0.0333594976, 0.032967033,
+        0.0325745683, 0.0321821036, 0.0317896389, 0.0313971743, 0.0310047096, 0.0306122449,
+        0.0302197802, 0.0298273155, 0.0294348509, 0.0290423862, 0.0286499215, 0.0282574568,
+        0.0278649922, 0.0274725275, 0.0270800628, 0.0266875981, 0.0262951334, 0.0259026688,
+        0.0255102041, 0.0251177394, 0.0247252747, 0.02433281, 0.0239403454, 0.0235478807,
+        0.023155416, 0.0227629513, 0.0223704867, 0.021978022, 0.0215855573, 0.0211930926,
+        0.0208006279, 0.0204081633, 0.0200156986, 0.0196232339, 0.0192307692, 0.0188383046,
+        0.0184458399, 0.0180533752, 0.0176609105, 0.0172684458, 0.0168759812, 0.0164835165,
+        0.0160910518, 0.0156985871, 0.0153061224, 0.0149136578, 0.0145211931, 0.0141287284,
+        0.0137362637, 0.0133437991, 0.0129513344, 0.0125588697, 0.012166405, 0.0117739403,
+        0.0113814757, 0.010989011, 0.0105965463, 0.0102040816, 0.00981161695, 0.00941915228,
+        0.0090266876, 0.00863422292, 0.00824175824, 0.00784929356, 0.00745682889, 0.00706436421,
+        0.00667189953, 0.00627943485, 0.00588697017, 0.00549450549, 0.00510204082, 0.00470957614,
+        0.00431711146, 0.00392464678, 0.0035321821, 0.00313971743, 0.00274725275, 0.00235478807,
+        0.00196232339, 0.00156985871, 0.00117739403, 0.000784929356, 0.000392464678,
+    },
+    /* 6 cards */
+    {
+        0, 1, 0.999990766, 0.999981728, 0.99997269, 0.999963652,
+        0.999954614, 0.999945576, 0.999936538, 0.9999275, 0.999918462, 0.999909424,
+        0.999900484, 0.99989233, 0.999884962, 0.99987838, 0.999872584, 0.999867574,
+        0.99986335, 0.999859911, 0.999857259, 0.999855392, 0.999854312, 0.999854017,
+        0.999845077, 0.999836923, 0.999829555, 0.999822973, 0.999817177, 0.999812167,
+        0.999807943, 0.999804504, 0.999801852, 0.999799985, 0.999798905, 0.99979861,
+        0.99978967, 0.999781517, 0.999774149, 0.999767567, 0.999761771, 0.99975676,
+        0.999752536, 0.999749098, 0.999746445, 0.999744579, 0.999743498, 0.999743203,
+        0.999734264, 0.99972611, 0.999718742, 0.99971216, 0.999706364, 0.999701354,
+        0.999697129, 0.999693691, 0.999691038, 0.999689172, 0.999688091, 0.999687797,
+        0.999678857, 0.999670703, 0.999663335, 0.999656753, 0.999650957, 0.999645947,
+        0.999641722, 0.999638284, 0.999635632, 0.999633765, 0.999632684, 0.99963239,
+        0.99962345, 0.999615296, 0.999607928, 0.999601346, 0.99959555, 0.99959054,
+        0.999586316, 0.999582877, 0.999580225, 0.999578358, 0.999577278, 0.999576983,
+        0.999568043, 0.999559889, 0.999552521, 0.999545939, 0.999540143, 0.999535133,
+        0.999530909, 0.999527471, 0.999524818, 0.999522952, 0.999521871, 0.999521576,
+        0.999512636, 0.999504483, 0.999497115, 0.999490533, 0.999484737, 0.999479726,
+        0.999475502, 0.999472064, 0.999469411, 0.999467545, 0.999466464, 0.999466169,
+        0.99945723, 0.999449076, 0.999441708, 0.999435126, 0.99942933, 0.99942432,
+        0.999420095, 0.999416657, 0.999414005, 0.999412138, 0.999411057, 0.999410763,
+        0.999401823, 0.999393669, 0.999386301, 0.999379719, 0.999373923, 0.999368913,
+        0.999364689, 0.99936125, 0.999358598, 0.999356731, 0.999355651, 0.999355356,
+        0.999346416, 0.999338262, 0.999330894, 0.999324312, 0.999318516, 0.999313506,
+        0.999309282, 0.999305843, 0.999303191, 0.999301324, 0.999300244, 0.999299949,
+        0.999291009, 0.999282856, 0.999275488, 0.999268906, 0.999263109, 0.999258099,
+        0.999253875, 0.999250437, 0.999247784, 0.999245918, 0.999244837, 0.999244542,
+        0.999235603, 0.999227449, 0.999220081, 0.999213499, 0.999207703, 0.999202693,
+        0.999198468, 0.99919503, 0.999192377, 0.999190511, 0.99918943, 0.999189136,
+        0.999136479, 0.999083823, 0.999031167, 0.998978511, 0.998925855, 0.998873199,
+        0.998820543, 0.998767887, 0.998715231, 0.998662575, 0.998609919, 0.998557263,
+        0.998505392, 0.998452736, 0.99840008, 0.998347424, 0.998294768, 0.998242112,
+        0.998189456, 0.9981368, 0.998084144, 0.998031488, 0.997978831, 0.997926175,
+        0.997874305, 0.997822435, 0.997769779, 0.997717123, 0.997664467, 0.997611811,
+        0.997559155, 0.997506499, 0.997453842, 0.997401186, 0.99734853, 0.997295874,
+        0.997244004, 0.997192134, 0.997140264, 0.997087608, 0.997034951, 0.996982295,
+        0.996929639, 0.996876983, 0.996824327, 0.996771671, 0.996719015, 0.996666359,
+        0.996614489, 0.996562619, 0.996510748, 0.996458878, 0.996406222, 0.996353566,
+        0.99630091, 0.996248254, 0.996195598, 0.996142942, 0.996090286, 0.996037629,
+        0.995985759, 0.995933889, 0.995882019, 0.995830149, 0.995778279, 0.995725622,
+        0.995672966, 0.99562031, 0.995567654, 0.995514998, 0.995462342, 0.995409686,
+        0.995357816, 0.995305946, 0.995254075, 0.995202205, 0.995150335, 0.995098465,
+        0.995045809, 0.994993153, 0.994940497, 0.994887841, 0.994835184, 0.994782528,
+        0.994730658, 0.994678788, 0.994626918, 0.994575048, 0.994523178, 0.994471307,
+        0.994419437, 0.994366781, 0.994314125, 0.994261469, 0.994208813, 0.994156157,
+        0.994104287, 0.994052416, 0.994000546, 0.993948676, 0.993896806, 0.993844936,
+        0.993793066, 0.993741195, 0.993688539, 0.993635883, 0.993583227, 0.993530571,
+        0.993478701, 0.993426831, 0.99337496, 0.99332309, 0.99327122, 0.99321935,
+        0.99316748, 0.99311561, 0.993063739, 0.993011083, 0.992958427, 0.992905771,
+        0.992853901, 0.992802031, 0.992750161, 0.99269829, 0.99264642, 0.99259455,
+        0.99254268, 0.99249081, 0.99243894, 0.992387069, 0.992334413, 0.992281757,
+        0.992229887, 0.992178017, 0.992126147, 0.992074277, 0.992022406, 0.991970536,
+        0.991918666, 0.991866796, 0.991814926, 0.991763055, 0.991711185, 0.991658529,
+        0.991606659, 0.991554789, 0.991502919, 0.991451049, 0.991399178, 0.991347308,
+        0.991295438, 0.991243568, 0.991191698, 0.991139827, 0.991087957, 0.991036087,
+        0.991027049, 0.991018208, 0.991009563, 0.991001114, 0.990992862, 0.990984806,
+        0.990976947, 0.990969285, 0.990960247, 0.990951405, 0.99094276, 0.990934312,
+        0.990926059, 0.990918004, 0.990910145, 0.990902482, 0.990893641, 0.990884996,
+        0.990876547, 0.990868295, 0.990860239, 0.99085238, 0.990844718, 0.990836073,
+        0.990827624, 0.990819372, 0.990811316, 0.990803457, 0.990795795, 0.990787346,
+        0.990779094, 0.990771038, 0.990763179, 0.990755517, 0.990747265, 0.990739209,
+        0.99073135, 0.990723687, 0.990715632, 0.990707772, 0.99070011, 0.990692251,
+        0.990684588, 0.990676925, 0.990667887, 0.990659046, 0.990650401, 0.990641952,
+        0.9906337, 0.990625645, 0.990617786, 0.990610123, 0.990601281, 0.990592636,
+        0.990584188, 0.990575936, 0.99056788, 0.990560021, 0.990552358, 0.990543713,
+        0.990535265, 0.990527013, 0.990518957, 0.990511098, 0.990503435, 0.990494987,
+        0.990486735, 0.990478679, 0.99047082, 0.990463157, 0.990454905, 0.99044685,
+        0.990438991, 0.990431328, 0.990423272, 0.990415413, 0.990407751, 0.990399892,
+        0.990392229, 0.990384566, 0.990375725, 0.99036708, 0.990358631, 0.990350379,
+        0.990342324, 0.990334464, 0.990326802, 0.990318157, 0.990309708, 0.990301456,
+        0.990293401, 0.990285541, 0.990277879, 0.99026943, 0.990261178, 0.990253123,
+        0.990245263, 0.990237601, 0.990229349, 0.990221293, 0.990213434, 0.990205771,
+        0.990197716, 0.990189857, 0.990182194, 0.990174335, 0.990166672, 0.99015901,
+        0.990150365, 0.990141916, 0.990133664, 0.990125608, 0.990117749, 0.990110087,
+        0.990101638, 0.990093386, 0.99008533, 0.990077471, 0.990069809, 0.990061557,
+        0.990053501, 0.990045642, 0.990037979, 0.990029924, 0.990022064, 0.990014402,
+        0.990006543, 0.98999888, 0.989991217, 0.989982769, 0.989974517, 0.989966461,
+        0.989958602, 0.989950939, 0.989942687, 0.989934632, 0.989926773, 0.98991911,
+        0.989911054, 0.989903195, 0.989895533, 0.989887674, 0.989880011, 0.989872348,
+        0.989864096, 0.989856041, 0.989848181, 0.989840519, 0.989832463, 0.989824604,
+        0.989816942, 0.989809082, 0.98980142, 0.989793757, 0.989785702, 0.989777842,
+        0.98977018, 0.989762321, 0.989754658, 0.989746995, 0.989739333, 0.98973167,
+        0.989724007, 0.989716345, 0.989707503, 0.989698662, 0.989690017, 0.989681568,
+        0.989673316, 0.989665261, 0.989657401, 0.989649739, 0.989640897, 0.989632252,
+        0.989623804, 0.989615552, 0.989607496, 0.989599637, 0.989591974, 0.989583329,
+        0.989574881, 0.989566629, 0.989558573, 0.989550714, 0.989543051, 0.989534603,
+        0.989526351, 0.989518295, 0.989510436, 0.989502773, 0.989494521, 0.989486466,
+        0.989478606, 0.989470944, 0.989462888, 0.989455029, 0.989447367, 0.989439507,
+        0.989431845, 0.989424182, 0.989415341, 0.989406696, 0.989398247, 0.989389995,
+        0.989381939, 0.98937408, 0.989366418, 0.989357773, 0.989349324, 0.989341072,
+        0.989333016, 0.989325157, 0.989317495, 0.989309046, 0.989300794, 0.989292738,
+        0.989284879, 0.989277217, 0.989268965, 0.989260909, 0.98925305, 0.989245387,
+        0.989237332, 0.989229472, 0.98922181, 0.989213951, 0.989206288, 0.989198625,
+        0.98918998, 0.989181532, 0.98917328, 0.989165224, 0.989157365, 0.989149702,
+        0.989141254, 0.989133002, 0.989124946, 0.989117087, 0.989109424, 0.989101172,
+        0.989093117, 0.989085258, 0.989077595, 0.989069539, 0.98906168, 0.989054018,
+        0.989046159, 0.989038496, 0.989030833, 0.989022385, 0.989014133, 0.989006077,
+        0.988998218, 0.988990555, 0.988982303, 0.988974248, 0.988966389, 0.988958726,
+        0.98895067, 0.988942811, 0.988935149, 0.988927289, 0.988919627, 0.988911964,
+        0.988903712, 0.988895656, 0.988887797, 0.988880135, 0.988872079, 0.98886422,
+        0.988856557, 0.988848698, 0.988841036, 0.988833373, 0.988825317, 0.988817458,
+        0.988809796, 0.988801936, 0.988794274, 0.988786611, 0.988778949, 0.988771286,
+        0.988763623, 0.988755961, 0.988747316, 0.988738671, 0.988730222, 0.98872197,
+        0.988713914, 0.988706055, 0.988698393, 0.988689748, 0.988681299, 0.988673047,
+        0.988664991, 0.988657132, 0.98864947, 0.988641021, 0.988632769, 0.988624713,
+        0.988616854, 0.988609192, 0.98860094, 0.988592884, 0.988585025, 0.988577362,
+        0.988569307, 0.988561447, 0.988553785, 0.988545926, 0.988538263, 0.9885306,
+        0.988521955, 0.988513507, 0.988505255, 0.988497199, 0.98848934, 0.988481677,
+        0.988473229, 0.988464977, 0.988456921, 0.988449062, 0.988441399, 0.988433147,
+        0.988425092, 0.988417233, 0.98840957, 0.988401514, 0.988393655, 0.988385993,
+        0.988378134, 0.988370471, 0.988362808, 0.98835436, 0.988346108, 0.988338052,
+        0.988330193, 0.98832253, 0.988314278, 0.988306223, 0.988298364, 0.988290701,
+        0.988282645, 0.988274786, 0.988267124, 0.988259264, 0.988251602, 0.988243939,
+        0.988235687, 0.988227631, 0.988219772, 0.98821211, 0.988204054, 0.988196195,
+        0.988188532, 0.988180673, 0.988173011, 0.988165348, 0.988157292, 0.988149433,
+        0.988141771, 0.988133912, 0.988126249, 0.988118586, 0.988110924, 0.988103261,
+        0.988095598, 0.988087936, 0.988079487, 0.988071039, 0.988062786, 0.988054731,
+        0.988046872, 0.988039209, 0.988030761, 0.988022509, 0.988014453, 0.988006594,
+        0.987998931, 0.987990679, 0.987982623, 0.987974764, 0.987967102, 0.987959046,
+        0.987951187, 0.987943524, 0.987935665, 0.987928003, 0.98792034, 0.987911891,
+        0.987903639, 0.987895584, 0.987887725, 0.987880062, 0.98787181, 0.987863754,
+        0.987855895, 0.987848233, 0.987840177, 0.987832318, 0.987824655, 0.987816796,
+        0.987809133, 0.987801471, 0.987793219, 0.987785163, 0.987777304, 0.987769641,
+        0.987761586, 0.987753727, 0.987746064, 0.987738205, 0.987730542, 0.98772288,
+        0.987714824, 0.987706965, 0.987699302, 0.987691443, 0.987683781, 0.987676118,
+        0.987668455, 0.987660793, 0.98765313, 0.987645467, 0.987637215, 0.987628963,
+        0.987620908, 0.987613048, 0.987605386, 0.987597134, 0.987589078, 0.987581219,
+        0.987573556, 0.987565501, 0.987557642, 0.987549979, 0.98754212, 0.987534457,
+        0.987526795, 0.987518543, 0.987510487, 0.987502628, 0.987494965, 0.98748691,
+        0.987479051, 0.987471388, 0.987463529, 0.987455866, 0.987448204, 0.987440148,
+        0.987432289, 0.987424626, 0.987416767, 0.987409104, 0.987401442, 0.987393779,
+        0.987386116, 0.987378454, 0.987370791, 0.987362736, 0.98735468, 0.987346821,
+        0.987339158, 0.987331103, 0.987323244, 0.987315581, 0.987307722, 0.987300059,
+        0.987292397, 0.987284341, 0.987276482, 0.987268819, 0.98726096, 0.987253297,
+        0.987245635, 0.987237972, 0.987230309, 0.987222647, 0.987214984, 0.987207125,
+        0.987199266, 0.987191603, 0.987183744, 0.987176082, 0.987168419, 0.987160756,
+        0.987153094, 0.987145431, 0.987137768, 0.987130106, 0.987122443, 0.98711478,
+        0.987107118, 0.987098276, 0.987089631, 0.987081183, 0.987072931, 0.987064875,
+        0.987057016, 0.987049353, 0.987040512, 0.987031867, 0.987023418, 0.987015166,
+        0.987007111, 0.986999251, 0.986991589, 0.986982944, 0.986974495, 0.986966243,
+        0.986958188, 0.986950328, 0.986942666, 0.986934217, 0.986925965, 0.98691791,
+        0.98691005, 0.986902388, 0.986894136, 0.98688608, 0.986878221, 0.986870558,
+        0.986862503, 0.986854644, 0.986846981, 0.986839122, 0.986831459, 0.986823797,
+        0.986814955, 0.98680631, 0.986797862, 0.986789609, 0.986781554, 0.986773695,
+        0.986766032, 0.986757387, 0.986748939, 0.986740686, 0.986732631, 0.986724772,
+        0.986717109, 0.986708661, 0.986700408, 0.986692353, 0.986684494, 0.986676831,
+        0.986668579, 0.986660523, 0.986652664, 0.986645002, 0.986636946, 0.986629087,
+        0.986621424, 0.986613565, 0.986605903, 0.98659824, 0.986589595, 0.986581146,
+        0.986572894, 0.986564839, 0.98655698, 0.986549317, 0.986540868, 0.986532616,
+        0.986524561, 0.986516702, 0.986509039, 0.986500787, 0.986492731, 0.986484872,
+        0.98647721, 0.986469154, 0.986461295, 0.986453632, 0.986445773, 0.98643811,
+        0.986430448, 0.986421999, 0.986413747, 0.986405692, 0.986397832, 0.98639017,
+        0.986381918, 0.986373862, 0.986366003, 0.98635834, 0.986350285, 0.986342426,
+        0.986334763, 0.986326904, 0.986319241, 0.986311579, 0.986303327, 0.986295271,
+        0.986287412, 0.986279749, 0.986271694, 0.986263835, 0.986256172, 0.986248313,
+        0.98624065, 0.986232987, 0.986224932, 0.986217073, 0.98620941, 0.986201551,
+        0.986193888, 0.986186226, 0.986178367, 0.986170704, 0.986163041, 0.986155379,
+        0.986146734, 0.986138089, 0.98612964, 0.986121388, 0.986113332, 0.986105473,
+        0.986097811, 0.986089166, 0.986080717, 0.986072465, 0.986064409, 0.98605655,
+        0.986048888, 0.986040439, 0.986032187, 0.986024131, 0.986016272, 0.98600861,
+        0.986000358, 0.985992302, 0.985984443, 0.98597678, 0.985968725, 0.985960866,
+        0.985953203, 0.985945344, 0.985937681, 0.985930018, 0.985921373, 0.985912925,
+        0.985904673, 0.985896617, 0.985888758, 0.985881095, 0.985872647, 0.985864395,
+        0.985856339, 0.98584848, 0.985840818, 0.985832565, 0.98582451, 0.985816651,
+        0.985808988, 0.985800932, 0.985793073, 0.985785411, 0.985777552, 0.985769889,
+        0.985762226, 0.985753778, 0.985745526, 0.98573747, 0.985729611, 0.985721948,
+        0.985713696, 0.985705641, 0.985697782, 0.985690119, 0.985682063, 0.985674204,
+        0.985666542, 0.985658682, 0.98565102, 0.985643357, 0.985635105, 0.98562705,
+        0.98561919, 0.985611528, 0.985603472, 0.985595613, 0.98558795, 0.985580091,
+        0.985572429, 0.985564766, 0.98555671, 0.985548851, 0.985541189, 0.98553333,
+        0.985525667, 0.985518004, 0.985510145, 0.985502482, 0.98549482, 0.985487157,
+        0.985478709, 0.98547026, 0.985462008, 0.985453952, 0.985446093, 0.985438431,
+        0.985429982, 0.98542173, 0.985413674, 0.985405815, 0.985398153, 0.985389901,
+        0.985381845, 0.985373986, 0.985366323, 0.985358268, 0.985350409, 0.985342746,
+        0.985334887, 0.985327224, 0.985319562, 0.985311113, 0.985302861, 0.985294805,
+        0.985286946, 0.985279284, 0.985271031, 0.985262976, 0.985255117, 0.985247454,
+        0.985239399, 0.985231539, 0.985223877, 0.985216018, 0.985208355, 0.985200692,
+        0.98519244, 0.985184385, 0.985176526, 0.985168863, 0.985160807, 0.985152948,
+        0.985145286, 0.985137426, 0.985129764, 0.985122101, 0.985114046, 0.985106187,
+        0.985098524, 0.985090665, 0.985083002, 0.985075339, 0.98506748, 0.985059818,
+        0.985052155, 0.985044492, 0.98503624, 0.985027988, 0.985019933, 0.985012074,
+        0.985004411, 0.984996159, 0.984988103, 0.984980244, 0.984972582, 0.984964526,
+        0.984956667, 0.984949004, 0.984941145, 0.984933482, 0.98492582, 0.984917568,
+        0.984909512, 0.984901653, 0.98489399, 0.984885935, 0.984878076, 0.984870413,
+        0.984862554, 0.984854891, 0.984847229, 0.984839173, 0.984831314, 0.984823651,
+        0.984815792, 0.984808129, 0.984800467, 0.984792608, 0.984784945, 0.984777282,
+        0.98476962, 0.984761564, 0.984753509, 0.984745649, 0.984737987, 0.984729931,
+        0.984722072, 0.984714409, 0.98470655, 0.984698888, 0.984691225, 0.98468317,
+        0.98467531, 0.984667648, 0.984659789, 0.984652126, 0.984644463, 0.984636604,
+        0.984628942, 0.984621279, 0.984613616, 0.984605757, 0.984597898, 0.984590235,
+        0.984582376, 0.984574714, 0.984567051, 0.984559192, 0.984551529, 0.984543867,
+        0.984536204, 0.984528541, 0.984520879, 0.984513216, 0.984505553, 0.984497891,
+        0.984489246, 0.984480797, 0.984472545, 0.98446449, 0.98445663, 0.984448968,
+        0.984440323, 0.984431874, 0.984423622, 0.984415567, 0.984407707, 0.984400045,
+        0.984391596, 0.984383344, 0.984375289, 0.984367429, 0.984359767, 0.984351515,
+        0.984343459, 0.9843356, 0.984327937, 0.984319882, 0.984312023, 0.98430436,
+        0.984296501, 0.984288838, 0.984281176, 0.984272531, 0.984264082, 0.98425583,
+        0.984247774, 0.984239915, 0.984232253, 0.984223804, 0.984215552, 0.984207496,
+        0.984199637, 0.984191975, 0.984183723, 0.984175667, 0.984167808, 0.984160145,
+        0.98415209, 0.984144231, 0.984136568, 0.984128709, 0.984121046, 0.984113383,
+        0.984104935, 0.984096683, 0.984088627, 0.984080768, 0.984073106, 0.984064853,
+        0.984056798, 0.984048939, 0.984041276, 0.98403322, 0.984025361, 0.984017699,
+        0.98400984, 0.984002177, 0.983994514, 0.983986262, 0.983978207, 0.983970348,
+        0.983962685, 0.983954629, 0.98394677, 0.983939108, 0.983931248, 0.983923586,
+        0.983915923, 0.983907868, 0.983900008, 0.983892346, 0.983884487, 0.983876824,
+        0.983869161, 0.983861302, 0.98385364, 0.983845977, 0.983838314, 0.983829866,
+        0.983821417, 0.983813165, 0.98380511, 0.98379725, 0.983789588, 0.983781139,
+        0.983772887, 0.983764832, 0.983756973, 0.98374931, 0.983741058, 0.983733002,
+        0.983725143, 0.98371748, 0.983709425, 0.983701566, 0.983693903, 0.983686044,
+        0.983678381, 0.983670719, 0.98366227, 0.983654018, 0.983645962, 0.983638103,
+        0.983630441, 0.983622189, 0.983614133, 0.983606274, 0.983598611, 0.983590556,
+        0.983582697, 0.983575034, 0.983567175, 0.983559512, 0.98355185, 0.983543597,
+        0.983535542, 0.983527683, 0.98352002, 0.983511965, 0.983504105, 0.983496443,
+        0.983488584, 0.983480921, 0.983473258, 0.983465203, 0.983457344, 0.983449681,
+        0.983441822, 0.983434159, 0.983426497, 0.983418638, 0.983410975, 0.983403312,
+        0.98339565, 0.983387398, 0.983379145, 0.98337109, 0.983363231, 0.983355568,
+        0.983347316, 0.98333926, 0.983331401, 0.983323739, 0.983315683, 0.983307824,
+        0.983300161, 0.983292302, 0.98328464, 0.983276977, 0.983268725, 0.983260669,
+        0.98325281, 0.983245147, 0.983237092, 0.983229233, 0.98322157, 0.983213711,
+        0.983206048, 0.983198386, 0.98319033, 0.983182471, 0.983174808, 0.983166949,
+        0.983159287, 0.983151624, 0.983143765, 0.983136102, 0.98312844, 0.983120777,
+        0.983112721, 0.983104666, 0.983096807, 0.983089144, 0.983081088, 0.983073229,
+        0.983065567, 0.983057708, 0.983050045, 0.983042382, 0.983034327, 0.983026468,
+        0.983018805, 0.983010946, 0.983003283, 0.982995621, 0.982987761, 0.982980099,
+        0.982972436, 0.982964773, 0.982956914, 0.982949055, 0.982941393, 0.982933533,
+        0.982925871, 0.982918208, 0.982910349, 0.982902686, 0.982895024, 0.982887361,
+        0.982879699, 0.982872036, 0.982864373, 0.982856711, 0.982849048, 0.982840599,
+        0.982832347, 0.982824292, 0.982816433, 0.98280877, 0.982800321, 0.982792069,
+        0.982784014, 0.982776155, 0.982768492, 0.98276024, 0.982752184, 0.982744325,
+        0.982736663, 0.982728607, 0.982720748, 0.982713085, 0.982705226, 0.982697563,
+        0.982689901, 0.982681452, 0.9826732, 0.982665145, 0.982657286, 0.982649623,
+        0.982641371, 0.982633315, 0.982625456, 0.982617793, 0.982609738, 0.982601879,
+        0.982594216, 0.982586357, 0.982578694, 0.982571032, 0.98256278, 0.982554724,
+        0.982546865, 0.982539202, 0.982531147, 0.982523288, 0.982515625, 0.982507766,
+        0.982500103, 0.982492441, 0.982484385, 0.982476526, 0.982468863, 0.982461004,
+        0.982453341, 0.982445679, 0.98243782, 0.982430157, 0.982422494, 0.982414832,
+        0.98240658, 0.982398328, 0.982390272, 0.982382413, 0.98237475, 0.982366498,
+        0.982358443, 0.982350583, 0.982342921, 0.982334865, 0.982327006, 0.982319343,
+        0.982311484, 0.982303822, 0.982296159, 0.982287907, 0.982279851, 0.982271992,
+        0.98226433, 0.982256274, 0.982248415, 0.982240752, 0.982232893, 0.982225231,
+        0.982217568, 0.982209512, 0.982201653, 0.982193991, 0.982186131, 0.982178469,
+        0.982170806, 0.982162947, 0.982155284, 0.982147622, 0.982139959, 0.982131903,
+        0.982123848, 0.982115989, 0.982108326, 0.982100271, 0.982092411, 0.982084749,
+        0.98207689, 0.982069227, 0.982061564, 0.982053509, 0.98204565, 0.982037987,
+        0.982030128, 0.982022465, 0.982014803, 0.982006944, 0.981999281, 0.981991618,
+        0.981983956, 0.981976096, 0.981968237, 0.981960575, 0.981952716, 0.981945053,
+        0.98193739, 0.981929531, 0.981921869, 0.981914206, 0.981906543, 0.981898881,
+        0.981891218, 0.981883555, 0.981875893, 0.98186823, 0.981859978, 0.981851922,
+        0.981844063, 0.981836401, 0.981828149, 0.981820093, 0.981812234, 0.981804571,
+        0.981796516, 0.981788657, 0.981780994, 0.981773135, 0.981765472, 0.98175781,
+        0.981749557, 0.981741502, 0.981733643, 0.98172598, 0.981717924, 0.981710065,
+        0.981702403, 0.981694544, 0.981686881, 0.981679218, 0.981671163, 0.981663304,
+        0.981655641, 0.981647782, 0.981640119, 0.981632457, 0.981624597, 0.981616935,
+        0.981609272, 0.98160161, 0.981593554, 0.981585498, 0.981577639, 0.981569977,
+        0.981561921, 0.981554062, 0.981546399, 0.98153854, 0.981530877, 0.981523215,
+        0.981515159, 0.9815073, 0.981499637, 0.981491778, 0.981484116, 0.981476453,
+        0.981468594, 0.981460931, 0.981453269, 0.981445606, 0.981437747, 0.981429888,
+        0.981422225, 0.981414366, 0.981406703, 0.981399041, 0.981391182, 0.981383519,
+        0.981375856, 0.981368194, 0.981360531, 0.981352868, 0.981345206, 0.981337543,
+        0.981329881, 0.981321825, 0.981313966, 0.981306303, 0.981298248, 0.981290388,
+        0.981282726, 0.981274867, 0.981267204, 0.981259541, 0.981251486, 0.981243627,
+        0.981235964, 0.981228105, 0.981220442, 0.98121278, 0.981204921, 0.981197258,
+        0.981189595, 0.981181933, 0.981174074, 0.981166214, 0.981158552, 0.981150693,
+        0.98114303, 0.981135367, 0.981127508, 0.981119846, 0.981112183, 0.98110452,
+        0.981096858, 0.981089195, 0.981081532, 0.98107387, 0.981066207, 0.981058348,
+        0.981050685, 0.981042826, 0.981035164, 0.981027501, 0.981019642, 0.981011979,
+        0.981004317, 0.980996654, 0.980988991, 0.980981329, 0.980973666, 0.980966003,
+        0.980958341, 0.980950678, 0.980943016, 0.980935353, 0.98092769, 0.978973717,
+        0.977217204, 0.975460692, 0.973704179, 0.971947666, 0.970191153, 0.968434641,
+        0.966678128, 0.964921615, 0.963165102, 0.963039356, 0.962926185, 0.962825589,
+        0.962737566, 0.962662119, 0.962599246, 0.962548948, 0.962511224, 0.962486075,
+        0.9624735, 0.9624735, 0.962360329, 0.962259732, 0.96217171, 0.962096262,
+        0.962033389, 0.961983091, 0.961945367, 0.961920218, 0.961907644, 0.961907644,
+        0.961807047, 0.961719025, 0.961643577, 0.961580704, 0.961530406, 0.961492682,
+        0.961467533, 0.961454958, 0.961454958, 0.961366936, 0.961291489, 0.961228616,
+        0.961178317, 0.961140594, 0.961115445, 0.96110287, 0.96110287, 0.961027422,
+        0.960964549, 0.960914251, 0.960876527, 0.960851378, 0.960838804, 0.960838804,
+        0.960775931, 0.960725632, 0.960687909, 0.960662759, 0.960650185, 0.960650185,
+        0.960599886, 0.960562163, 0.960537013, 0.960524439, 0.960524439, 0.960486715,
+        0.960461566, 0.960448991, 0.960448991, 0.960423842, 0.960411268, 0.960411268,
+        0.960398693, 0.960398693, 0.960398693, 0.960272947, 0.960159776, 0.960059179,
+        0.959971157, 0.95989571, 0.959832837, 0.959782538, 0.959744814, 0.959719665,
+        0.959707091, 0.959707091, 0.959593919, 0.959493323, 0.959405301, 0.959329853,
+        0.95926698, 0.959216682, 0.959178958, 0.959153809, 0.959141234, 0.959141234,
+        0.959040638, 0.958952615, 0.958877168, 0.958814295, 0.958763997, 0.958726273,
+        0.958701124, 0.958688549, 0.958688549, 0.958600527, 0.958525079, 0.958462206,
+        0.958411908, 0.958374184, 0.958349035, 0.958336461, 0.958336461, 0.958261013,
+        0.95819814, 0.958147842, 0.958110118, 0.958084969, 0.958072394, 0.958072394,
+        0.958009521, 0.957959223, 0.957921499, 0.95789635, 0.957883775, 0.957883775,
+        0.957833477, 0.957795753, 0.957770604, 0.95775803, 0.95775803, 0.957720306,
+        0.957695157, 0.957682582, 0.957682582, 0.957657433, 0.957644858, 0.957644858,
+        0.957632284, 0.957632284, 0.957632284, 0.957506538, 0.957393367, 0.95729277,
+        0.957204748, 0.9571293, 0.957066427, 0.957016129, 0.956978405, 0.956953256,
+        0.956940681, 0.956940681, 0.95682751, 0.956726913, 0.956638891, 0.956563444,
+        0.956500571, 0.956450272, 0.956412549, 0.956387399, 0.956374825, 0.956374825,
+        0.956274228, 0.956186206, 0.956110759, 0.956047886, 0.955997587, 0.955959863,
+        0.955934714, 0.95592214, 0.95592214, 0.955834118, 0.95575867, 0.955695797,
+        0.955645499, 0.955607775, 0.955582626, 0.955570051, 0.955570051, 0.955494604,
+        0.955431731, 0.955381432, 0.955343709, 0.95531856, 0.955305985, 0.955305985,
+        0.955243112, 0.955192814, 0.95515509, 0.955129941, 0.955117366, 0.955117366,
+        0.955067068, 0.955029344, 0.955004195, 0.95499162, 0.95499162, 0.954953896,
+        0.954928747, 0.954916173, 0.954916173, 0.954891024, 0.954878449, 0.954878449,
+        0.954865874, 0.954865874, 0.954865874, 0.954740128, 0.954626957, 0.95452636,
+        0.954438338, 0.954362891, 0.954300018, 0.95424972, 0.954211996, 0.954186847,
+        0.954174272, 0.954174272, 0.954061101, 0.953960504, 0.953872482, 0.953797034,
+        0.953734161, 0.953683863, 0.953646139, 0.95362099, 0.953608416, 0.953608416,
+        0.953507819, 0.953419797, 0.953344349, 0.953281476, 0.953231178, 0.953193454,
+        0.953168305, 0.95315573, 0.95315573, 0.953067708, 0.952992261, 0.952929388,
+        0.952879089, 0.952841366, 0.952816217, 0.952803642, 0.952803642, 0.952728194,
+        0.952665321, 0.952615023, 0.952577299, 0.95255215, 0.952539576, 0.952539576,
+        0.952476703, 0.952426404, 0.952388681, 0.952363531, 0.952350957, 0.952350957,
+        0.952300658, 0.952262935, 0.952237785, 0.952225211, 0.952225211, 0.952187487,
+        0.952162338, 0.952149763, 0.952149763, 0.952124614, 0.95211204, 0.95211204,
+        0.952099465, 0.952099465, 0.952099465, 0.951973719, 0.951860548, 0.951759951,
+        0.951671929, 0.951596481, 0.951533609, 0.95148331, 0.951445586, 0.951420437,
+        0.951407863, 0.951407863, 0.951294691, 0.951194095, 0.951106073, 0.951030625,
+        0.950967752, 0.950917454, 0.95087973, 0.950854581, 0.950842006, 0.950842006,
+        0.950741409, 0.950653387, 0.95057794, 0.950515067, 0.950464769, 0.950427045,
+        0.950401896, 0.950389321, 0.950389321, 0.950301299, 0.950225851, 0.950162978,
+        0.95011268, 0.950074956, 0.950049807, 0.950037233, 0.950037233, 0.949961785,
+        0.949898912, 0.949848614, 0.94981089, 0.949785741, 0.949773166, 0.949773166,
+        0.949710293, 0.949659995, 0.949622271, 0.949597122, 0.949584547, 0.949584547,
+        0.949534249, 0.949496525, 0.949471376, 0.949458802, 0.949458802, 0.949421078,
+        0.949395929, 0.949383354, 0.949383354, 0.949358205, 0.94934563, 0.94934563,
+        0.949333056, 0.949333056, 0.949333056, 0.94920731, 0.949094138, 0.948993542,
+        0.94890552, 0.948830072, 0.948767199, 0.948716901, 0.948679177, 0.948654028,
+        0.948641453, 0.948641453, 0.948528282, 0.948427685, 0.948339663, 0.948264216,
+        0.948201343, 0.948151044, 0.948113321, 0.948088171, 0.948075597, 0.948075597,
+        0.947975, 0.947886978, 0.947811531, 0.947748658, 0.947698359, 0.947660635,
+        0.947635486, 0.947622912, 0.947622912, 0.94753489, 0.947459442, 0.947396569,
+        0.947346271, 0.947308547, 0.947283398, 0.947270823, 0.947270823, 0.947195376,
+        0.947132503, 0.947082204, 0.947044481, 0.947019331, 0.947006757, 0.947006757,
+        0.946943884, 0.946893586, 0.946855862, 0.946830713, 0.946818138, 0.946818138,
+        0.94676784, 0.946730116, 0.946704967, 0.946692392, 0.946692392, 0.946654668,
+        0.946629519, 0.946616945, 0.946616945, 0.946591795, 0.946579221, 0.946579221,
+        0.946566646, 0.946566646, 0.946566646, 0.9464409, 0.946327729, 0.946227132,
+        0.94613911, 0.946063663, 0.94600079, 0.945950491, 0.945912768, 0.945887619,
+        0.945875044, 0.945875044, 0.945761873, 0.945661276, 0.945573254, 0.945497806,
+        0.945434933, 0.945384635, 0.945346911, 0.945321762, 0.945309188, 0.945309188,
+        0.945208591, 0.945120569, 0.945045121, 0.944982248, 0.94493195, 0.944894226,
+        0.944869077, 0.944856502, 0.944856502, 0.94476848, 0.944693033, 0.94463016,
+        0.944579861, 0.944542138, 0.944516988, 0.944504414, 0.944504414, 0.944428966,
+        0.944366093, 0.944315795, 0.944278071, 0.944252922, 0.944240348, 0.944240348,
+        0.944177475, 0.944127176, 0.944089452, 0.944064303, 0.944051729, 0.944051729,
+        0.94400143, 0.943963707, 0.943938557, 0.943925983, 0.943925983, 0.943888259,
+        0.94386311, 0.943850535, 0.943850535, 0.943825386, 0.943812812, 0.943812812,
+        0.943800237, 0.943800237, 0.943800237, 0.943674491, 0.94356132, 0.943460723,
+        0.943372701, 0.943297253, 0.94323438, 0.943184082, 0.943146358, 0.943121209,
+        0.943108635, 0.943108635, 0.942995463, 0.942894867, 0.942806845, 0.942731397,
+        0.942668524, 0.942618226, 0.942580502, 0.942555353, 0.942542778, 0.942542778,
+        0.942442181, 0.942354159, 0.942278712, 0.942215839, 0.942165541, 0.942127817,
+        0.942102668, 0.942090093, 0.942090093, 0.942002071, 0.941926623, 0.94186375,
+        0.941813452, 0.941775728, 0.941750579, 0.941738005, 0.941738005, 0.941662557,
+        0.941599684, 0.941549386, 0.941511662, 0.941486513, 0.941473938, 0.941473938,
+        0.941411065, 0.941360767, 0.941323043, 0.941297894, 0.941285319, 0.941285319,
+        0.941235021, 0.941197297, 0.941172148, 0.941159573, 0.941159573, 0.94112185,
+        0.941096701, 0.941084126, 0.941084126, 0.941058977, 0.941046402, 0.941046402,
+        0.941033828, 0.941033828, 0.941033828, 0.940908082, 0.94079491, 0.940694314,
+        0.940606292, 0.940530844, 0.940467971, 0.940417673, 0.940379949, 0.9403548,
+        0.940342225, 0.940342225, 0.940229054, 0.940128457, 0.940040435, 0.939964988,
+        0.939902115, 0.939851816, 0.939814093, 0.939788943, 0.939776369, 0.939776369,
+        0.939675772, 0.93958775, 0.939512302, 0.93944943, 0.939399131, 0.939361407,
+        0.939336258, 0.939323684, 0.939323684, 0.939235662, 0.939160214, 0.939097341,
+        0.939047043, 0.939009319, 0.93898417, 0.938971595, 0.938971595, 0.938896148,
+        0.938833275, 0.938782976, 0.938745253, 0.938720103, 0.938707529, 0.938707529,
+        0.938644656, 0.938594358, 0.938556634, 0.938531485, 0.93851891, 0.93851891,
+        0.938468612, 0.938430888, 0.938405739, 0.938393164, 0.938393164, 0.93835544,
+        0.938330291, 0.938317717, 0.938317717, 0.938292567, 0.938279993, 0.938279993,
+        0.938267418, 0.938267418, 0.938267418, 0.938141672, 0.938028501, 0.937927904,
+        0.937839882, 0.937764435, 0.937701562, 0.937651263, 0.93761354, 0.937588391,
+        0.937575816, 0.937575816, 0.937462645, 0.937362048, 0.937274026, 0.937198578,
+        0.937135705, 0.937085407, 0.937047683, 0.937022534, 0.937009959, 0.937009959,
+        0.936909363, 0.936821341, 0.936745893, 0.93668302, 0.936632722, 0.936594998,
+        0.936569849, 0.936557274, 0.936557274, 0.936469252, 0.936393805, 0.936330932,
+        0.936280633, 0.93624291, 0.93621776, 0.936205186, 0.936205186, 0.936129738,
+        0.936066865, 0.936016567, 0.935978843, 0.935953694, 0.935941119, 0.935941119,
+        0.935878247, 0.935827948, 0.935790224, 0.935765075, 0.935752501, 0.935752501,
+        0.935702202, 0.935664479, 0.935639329, 0.935626755, 0.935626755, 0.935589031,
+        0.935563882, 0.935551307, 0.935551307, 0.935526158, 0.935513584, 0.935513584,
+        0.935501009, 0.935501009, 0.935501009, 0.935375263, 0.935262092, 0.935161495,
+        0.935073473, 0.934998025, 0.934935152, 0.934884854, 0.93484713, 0.934821981,
+        0.934809407, 0.934809407, 0.934696235, 0.934595639, 0.934507616, 0.934432169,
+        0.934369296, 0.934318998, 0.934281274, 0.934256125, 0.93424355, 0.93424355,
+        0.934142953, 0.934054931, 0.933979484, 0.933916611, 0.933866312, 0.933828589,
+        0.93380344, 0.933790865, 0.933790865, 0.933702843, 0.933627395, 0.933564522,
+        0.933514224, 0.9334765, 0.933451351, 0.933438776, 0.933438776, 0.933363329,
+        0.933300456, 0.933250158, 0.933212434, 0.933187285, 0.93317471, 0.93317471,
+        0.933111837, 0.933061539, 0.933023815, 0.932998666, 0.932986091, 0.932986091,
+        0.932935793, 0.932898069, 0.93287292, 0.932860345, 0.932860345, 0.932822622,
+        0.932797473, 0.932784898, 0.932784898, 0.932759749, 0.932747174, 0.932747174,
+        0.9327346, 0.9327346, 0.9327346, 0.932608854, 0.932495682, 0.932395086,
+        0.932307064, 0.932231616, 0.932168743, 0.932118445, 0.932080721, 0.932055572,
+        0.932042997, 0.932042997, 0.931929826, 0.931829229, 0.931741207, 0.93166576,
+        0.931602887, 0.931552588, 0.931514865, 0.931489715, 0.931477141, 0.931477141,
+        0.931376544, 0.931288522, 0.931213074, 0.931150201, 0.931099903, 0.931062179,
+        0.93103703, 0.931024456, 0.931024456, 0.930936433, 0.930860986, 0.930798113,
+        0.930747815, 0.930710091, 0.930684942, 0.930672367, 0.930672367, 0.93059692,
+        0.930534047, 0.930483748, 0.930446025, 0.930420875, 0.930408301, 0.930408301,
+        0.930345428, 0.93029513, 0.930257406, 0.930232257, 0.930219682, 0.930219682,
+        0.930169384, 0.93013166, 0.930106511, 0.930093936, 0.930093936, 0.930056212,
+        0.930031063, 0.930018489, 0.930018489, 0.929993339, 0.929980765, 0.929980765,
+        0.92996819, 0.92996819, 0.92996819, 0.929842444, 0.929729273, 0.929628676,
+        0.929540654, 0.929465207, 0.929402334, 0.929352035, 0.929314312, 0.929289162,
+        0.929276588, 0.929276588, 0.929163417, 0.92906282, 0.928974798, 0.92889935,
+        0.928836477, 0.928786179, 0.928748455, 0.928723306, 0.928710731, 0.928710731,
+        0.928610135, 0.928522113, 0.928446665, 0.928383792, 0.928333494, 0.92829577,
+        0.928270621, 0.928258046, 0.928258046, 0.928170024, 0.928094577, 0.928031704,
+        0.927981405, 0.927943682, 0.927918532, 0.927905958, 0.927905958, 0.92783051,
+        0.927767637, 0.927717339, 0.927679615, 0.927654466, 0.927641891, 0.927641891,
+        0.927579019, 0.92752872, 0.927490996, 0.927465847, 0.927453273, 0.927453273,
+        0.927402974, 0.927365251, 0.927340101, 0.927327527, 0.927327527, 0.927289803,
+        0.927264654, 0.927252079, 0.927252079, 0.92722693, 0.927214355, 0.927214355,
+        0.927201781, 0.927201781, 0.927201781, 0.926908243, 0.926642998, 0.926406045,
+        0.926197386, 0.926017019, 0.925864945, 0.925741164, 0.925645676, 0.92557848,
+        0.925539578, 0.925528968, 0.925246039, 0.924980794, 0.924743842, 0.924535182,
+        0.924354816, 0.924202742, 0.924078961, 0.923983472, 0.923916277, 0.923877374,
+        0.923866764, 0.923583836, 0.923329201, 0.923092248, 0.922883589, 0.922703222,
+        0.922551148, 0.922427367, 0.922331879, 0.922264683, 0.922225781, 0.922215171,
+        0.921932243, 0.921677607, 0.921451265, 0.921242605, 0.921062238, 0.920910164,
+        0.920786383, 0.920690895, 0.9206237, 0.920584797, 0.920574187, 0.920291259,
+        0.920036623, 0.919810281, 0.919612231, 0.919431864, 0.91927979, 0.919156009,
+        0.919060521, 0.918993326, 0.918954423, 0.918943813, 0.918660885, 0.91840625,
+        0.918179907, 0.917981857, 0.9178121, 0.917660026, 0.917536245, 0.917440757,
+        0.917373562, 0.917334659, 0.917324049, 0.917041121, 0.916786485, 0.916560143,
+        0.916362093, 0.916192336, 0.916050872, 0.915927091, 0.915831603, 0.915764407,
+        0.915725505, 0.915714895, 0.915431967, 0.915177331, 0.914950989, 0.914752939,
+        0.914583182, 0.914441718, 0.914328546, 0.914233058, 0.914165863, 0.91412696,
+        0.91411635, 0.913833422, 0.913578787, 0.913352444, 0.913154394, 0.912984637,
+        0.912843173, 0.912730002, 0.912645124, 0.912577928, 0.912539025, 0.912528416,
+        0.912245487, 0.911990852, 0.911764509, 0.91156646, 0.911396703, 0.911255239,
+        0.911142067, 0.911057189, 0.911000603, 0.910961701, 0.910951091, 0.910668163,
+        0.910413527, 0.910187185, 0.909989135, 0.909819378, 0.909677914, 0.909564742,
+        0.909479864, 0.909423278, 0.909394985, 0.909384376, 0.909101447, 0.908846812,
+        0.908620469, 0.90842242, 0.908252663, 0.908111199, 0.907998027, 0.907913149,
+        0.907856563, 0.90782827, 0.90782827, 0.907545342, 0.907280097, 0.907043145,
+        0.906834485, 0.906654118, 0.906502044, 0.906378263, 0.906282775, 0.90621558,
+        0.906176677, 0.906166067, 0.905883139, 0.905628503, 0.905391551, 0.905182891,
+        0.905002525, 0.904850451, 0.90472667, 0.904631181, 0.904563986, 0.904525083,
+        0.904514474, 0.904231545, 0.90397691, 0.903750567, 0.903541908, 0.903361541,
+        0.903209467, 0.903085686, 0.902990198, 0.902923002, 0.9028841, 0.90287349,
+        0.902590562, 0.902335926, 0.902109584, 0.901911534, 0.901731167, 0.901579093,
+        0.901455312, 0.901359824, 0.901292628, 0.901253726, 0.901243116, 0.900960188,
+        0.900705552, 0.90047921, 0.90028116, 0.900111403, 0.899959329, 0.899835548,
+        0.89974006, 0.899672864, 0.899633962, 0.899623352, 0.899340424, 0.899085788,
+        0.898859446, 0.898661396, 0.898491639, 0.898350175, 0.898226394, 0.898130905,
+        0.89806371, 0.898024807, 0.898014197, 0.897731269, 0.897476634, 0.897250291,
+        0.897052242, 0.896882485, 0.89674102, 0.896627849, 0.896532361, 0.896465165,
+        0.896426263, 0.896415653, 0.896132725, 0.895878089, 0.895651747, 0.895453697,
+        0.89528394, 0.895142476, 0.895029305, 0.894944426, 0.894877231, 0.894838328,
+        0.894827718, 0.89454479, 0.894290155, 0.894063812, 0.893865762, 0.893696005,
+        0.893554541, 0.89344137, 0.893356492, 0.893299906, 0.893261003, 0.893250393,
+        0.892967465, 0.89271283, 0.892486487, 0.892288437, 0.892118681, 0.891977216,
+        0.891864045, 0.891779167, 0.891722581, 0.891694288, 0.891683678, 0.89140075,
+        0.891146115, 0.890919772, 0.890721722, 0.890551965, 0.890410501, 0.89029733,
+        0.890212452, 0.890155866, 0.890127573, 0.890127573, 0.889844645, 0.889590009,
+        0.889353057, 0.889144398, 0.888964031, 0.888811957, 0.888688176, 0.888592687,
+        0.888525492, 0.888486589, 0.88847598, 0.888193051, 0.887938416, 0.887712073,
+        0.887503414, 0.887323047, 0.887170973, 0.887047192, 0.886951704, 0.886884508,
+        0.886845606, 0.886834996, 0.886552068, 0.886297432, 0.88607109, 0.88587304,
+        0.885692673, 0.885540599, 0.885416818, 0.88532133, 0.885254134, 0.885215232,
+        0.885204622, 0.884921694, 0.884667058, 0.884440716, 0.884242666, 0.884072909,
+        0.883920835, 0.883797054, 0.883701566, 0.88363437, 0.883595468, 0.883584858,
+        0.88330193, 0.883047294, 0.882820952, 0.882622902, 0.882453145, 0.882311681,
+        0.8821879, 0.882092411, 0.882025216, 0.881986313, 0.881975704, 0.881692775,
+        0.88143814, 0.881211797, 0.881013748, 0.880843991, 0.880702527, 0.880589355,
+        0.880493867, 0.880426671, 0.880387769, 0.880377159, 0.880094231, 0.879839595,
+        0.879613253, 0.879415203, 0.879245446, 0.879103982, 0.878990811, 0.878905932,
+        0.878838737, 0.878799834, 0.878789224, 0.878506296, 0.878251661, 0.878025318,
+        0.877827268, 0.877657511, 0.877516047, 0.877402876, 0.877317998, 0.877261412,
+        0.877222509, 0.877211899, 0.876928971, 0.876674336, 0.876447993, 0.876249944,
+        0.876080187, 0.875938722, 0.875825551, 0.875740673, 0.875684087, 0.875655794,
+        0.875645184, 0.875362256, 0.875107621, 0.874881278, 0.874683228, 0.874513472,
+        0.874372007, 0.874258836, 0.874173958, 0.874117372, 0.874089079, 0.874089079,
+        0.873806151, 0.873551516, 0.873325173, 0.873116513, 0.872936147, 0.872784073,
+        0.872660292, 0.872564803, 0.872497608, 0.872458705, 0.872448095, 0.872165167,
+        0.871910532, 0.871684189, 0.871486139, 0.871305773, 0.871153699, 0.871029918,
+        0.870934429, 0.870867234, 0.870828331, 0.870817722, 0.870534793, 0.870280158,
+        0.870053815, 0.869855766, 0.869686009, 0.869533935, 0.869410154, 0.869314665,
+        0.86924747, 0.869208567, 0.869197957, 0.868915029, 0.868660394, 0.868434051,
+        0.868236001, 0.868066245, 0.86792478, 0.867800999, 0.867705511, 0.867638316,
+        0.867599413, 0.867588803, 0.867305875, 0.867051239, 0.866824897, 0.866626847,
+        0.86645709, 0.866315626, 0.866202455, 0.866106967, 0.866039771, 0.866000868,
+        0.865990259, 0.86570733, 0.865452695, 0.865226352, 0.865028303, 0.864858546,
+        0.864717082, 0.86460391, 0.864519032, 0.864451836, 0.864412934, 0.864402324,
+        0.864119396, 0.86386476, 0.863638418, 0.863440368, 0.863270611, 0.863129147,
+        0.863015976, 0.862931097, 0.862874512, 0.862835609, 0.862824999, 0.862542071,
+        0.862287435, 0.862061093, 0.861863043, 0.861693286, 0.861551822, 0.861438651,
+        0.861353772, 0.861297187, 0.861268894, 0.861258284, 0.860975356, 0.86072072,
+        0.860494378, 0.860296328, 0.860126571, 0.859985107, 0.859871936, 0.859787057,
+        0.859730472, 0.859702179, 0.859702179, 0.859419251, 0.859164615, 0.858938273,
+        0.858740223, 0.858559856, 0.858407782, 0.858284001, 0.858188513, 0.858121317,
+        0.858082415, 0.858071805, 0.857788877, 0.857534241, 0.857307899, 0.857109849,
+        0.856940092, 0.856788018, 0.856664237, 0.856568749, 0.856501553, 0.856462651,
+        0.856452041, 0.856169112, 0.855914477, 0.855688135, 0.855490085, 0.855320328,
+        0.855178864, 0.855055083, 0.854959594, 0.854892399, 0.854853496, 0.854842886,
+        0.854559958, 0.854305323, 0.85407898, 0.85388093, 0.853711174, 0.853569709,
+        0.853456538, 0.85336105, 0.853293854, 0.853254952, 0.853244342, 0.852961414,
+        0.852706778, 0.852480436, 0.852282386, 0.852112629, 0.851971165, 0.851857994,
+        0.851773115, 0.85170592, 0.851667017, 0.851656407, 0.851373479, 0.851118844,
+        0.850892501, 0.850694451, 0.850524694, 0.85038323, 0.850270059, 0.85018518,
+        0.850128595, 0.850089692, 0.850079082, 0.849796154, 0.849541519, 0.849315176,
+        0.849117126, 0.848947369, 0.848805905, 0.848692734, 0.848607856, 0.84855127,
+        0.848522977, 0.848512367, 0.848229439, 0.847974804, 0.847748461, 0.847550411,
+        0.847380654, 0.84723919, 0.847126019, 0.847041141, 0.846984555, 0.846956262,
+        0.846956262, 0.846673334, 0.846418698, 0.846192356, 0.845994306, 0.845824549,
+        0.845672475, 0.845548694, 0.845453206, 0.84538601, 0.845347108, 0.845336498,
+        0.84505357, 0.844798934, 0.844572592, 0.844374542, 0.844204785, 0.844063321,
+        0.84393954, 0.843844052, 0.843776856, 0.843737953, 0.843727344, 0.843444415,
+        0.84318978, 0.842963437, 0.842765388, 0.842595631, 0.842454167, 0.842340995,
+        0.842245507, 0.842178312, 0.842139409, 0.842128799, 0.841845871, 0.841591236,
+        0.841364893, 0.841166843, 0.840997086, 0.840855622, 0.840742451, 0.840657572,
+        0.840590377, 0.840551474, 0.840540864, 0.840257936, 0.840003301, 0.839776958,
+        0.839578908, 0.839409152, 0.839267687, 0.839154516, 0.839069638, 0.839013052,
+        0.838974149, 0.83896354, 0.838680611, 0.838425976, 0.838199633, 0.838001584,
+        0.837831827, 0.837690363, 0.837577191, 0.837492313, 0.837435727, 0.837407434,
+        0.837396825, 0.837113896, 0.836859261, 0.836632918, 0.836434869, 0.836265112,
+        0.836123647, 0.836010476, 0.835925598, 0.835869012, 0.835840719, 0.835840719,
+        0.835557791, 0.835303156, 0.835076813, 0.834878763, 0.834709006, 0.834567542,
+        0.834443761, 0.834348273, 0.834281077, 0.834242175, 0.834231565, 0.833948637,
+        0.833694001, 0.833467659, 0.833269609, 0.833099852, 0.832958388, 0.832845217,
+        0.832749728, 0.832682533, 0.83264363, 0.83263302, 0.832350092, 0.832095457,
+        0.831869114, 0.831671064, 0.831501308, 0.831359843, 0.831246672, 0.831161794,
+        0.831094598, 0.831055696, 0.831045086, 0.830762158, 0.830507522, 0.83028118,
+        0.83008313, 0.829913373, 0.829771909, 0.829658737, 0.829573859, 0.829517273,
+        0.829478371, 0.829467761, 0.829184833, 0.828930197, 0.828703855, 0.828505805,
+        0.828336048, 0.828194584, 0.828081413, 0.827996534, 0.827939948, 0.827911656,
+        0.827901046, 0.827618118, 0.827363482, 0.82713714, 0.82693909, 0.826769333,
+        0.826627869, 0.826514698, 0.826429819, 0.826373233, 0.826344941, 0.826344941,
+        0.826062012, 0.825807377, 0.825581034, 0.825382985, 0.825213228, 0.825071764,
+        0.824958592, 0.824863104, 0.824795909, 0.824757006, 0.824746396, 0.824463468,
+        0.824208832, 0.82398249, 0.82378444, 0.823614683, 0.823473219, 0.823360048,
+        0.823275169, 0.823207974, 0.823169071, 0.823158461, 0.822875533, 0.822620898,
+        0.822394555, 0.822196505, 0.822026749, 0.821885284, 0.821772113, 0.821687235,
+        0.821630649, 0.821591746, 0.821581137, 0.821298208, 0.821043573, 0.82081723,
+        0.820619181, 0.820449424, 0.82030796, 0.820194788, 0.82010991, 0.820053324,
+        0.820025031, 0.820014421, 0.819731493, 0.819476858, 0.819250515, 0.819052466,
+        0.818882709, 0.818741244, 0.818628073, 0.818543195, 0.818486609, 0.818458316,
+        0.818458316, 0.818175388, 0.817920753, 0.81769441, 0.81749636, 0.817326603,
+        0.817185139, 0.817071968, 0.816987089, 0.816919894, 0.816880991, 0.816870382,
+        0.816587453, 0.816332818, 0.816106475, 0.815908426, 0.815738669, 0.815597205,
+        0.815484033, 0.815399155, 0.815342569, 0.815303666, 0.815293057, 0.815010128,
+        0.814755493, 0.81452915, 0.814331101, 0.814161344, 0.81401988, 0.813906708,
+        0.81382183, 0.813765244, 0.813736951, 0.813726342, 0.813443413, 0.813188778,
+        0.812962435, 0.812764386, 0.812594629, 0.812453165, 0.812339993, 0.812255115,
+        0.812198529, 0.812170236, 0.812170236, 0.811887308, 0.811632673, 0.81140633,
+        0.81120828, 0.811038523, 0.810897059, 0.810783888, 0.81069901, 0.810642424,
+        0.810603521, 0.810592911, 0.810309983, 0.810055348, 0.809829005, 0.809630955,
+        0.809461199, 0.809319734, 0.809206563, 0.809121685, 0.809065099, 0.809036806,
+        0.809026196, 0.808743268, 0.808488633, 0.80826229, 0.80806424, 0.807894483,
+        0.807753019, 0.807639848, 0.80755497, 0.807498384, 0.807470091, 0.807470091,
+        0.807187163, 0.806932528, 0.806706185, 0.806508135, 0.806338378, 0.806196914,
+        0.806083743, 0.805998864, 0.805942279, 0.805913986, 0.805903376, 0.805620448,
+        0.805365812, 0.80513947, 0.80494142, 0.804771663, 0.804630199, 0.804517028,
+        0.804432149, 0.804375564, 0.804347271, 0.804347271, 0.804064343, 0.803809707,
+        0.803583365, 0.803385315, 0.803215558, 0.803074094, 0.802960923, 0.802876044,
+        0.802819458, 0.802791166, 0.802791166, 0.802192301, 0.801593436, 0.801069429,
+        0.800620281, 0.80024599, 0.799946558, 0.799721984, 0.799572268, 0.799497409,
+        0.799497409, 0.798898545, 0.798374538, 0.797925389, 0.797551099, 0.797251667,
+        0.797027092, 0.796877376, 0.796802518, 0.796802518, 0.796278511, 0.795829363,
+        0.795455072, 0.79515564, 0.794931066, 0.79478135, 0.794706491, 0.794706491,
+        0.794257343, 0.793883052, 0.79358362, 0.793359046, 0.79320933, 0.793134471,
+        0.793134471, 0.792760181, 0.792460749, 0.792236174, 0.792086458, 0.7920116,
+        0.7920116, 0.791712168, 0.791487593, 0.791337877, 0.791263019, 0.791263019,
+        0.791038445, 0.790888729, 0.790813871, 0.790813871, 0.790664154, 0.790589296,
+        0.790589296, 0.790514438, 0.790514438, 0.790514438, 0.789915573, 0.789391567,
+        0.788942418, 0.788568128, 0.788268695, 0.788044121, 0.787894405, 0.787819547,
+        0.787819547, 0.78729554, 0.786846392, 0.786472101, 0.786172669, 0.785948094,
+        0.785798378, 0.78572352, 0.78572352, 0.785274372, 0.784900081, 0.784600649,
+        0.784376074, 0.784226358, 0.7841515, 0.7841515, 0.78377721, 0.783477777,
+        0.783253203, 0.783103487, 0.783028629, 0.783028629, 0.782729196, 0.782504622,
+        0.782354906, 0.782280048, 0.782280048, 0.782055474, 0.781905757, 0.781830899,
+        0.781830899, 0.781681183, 0.781606325, 0.781606325, 0.781531467, 0.781531467,
+        0.781531467, 0.78100746, 0.780558312, 0.780184021, 0.779884589, 0.779660015,
+        0.779510298, 0.77943544, 0.77943544, 0.778986292, 0.778612001, 0.778312569,
+        0.778087995, 0.777938278, 0.77786342, 0.77786342, 0.77748913, 0.777189697,
+        0.776965123, 0.776815407, 0.776740549, 0.776740549, 0.776441117, 0.776216542,
+        0.776066826, 0.775991968, 0.775991968, 0.775767394, 0.775617678, 0.775542819,
+        0.775542819, 0.775393103, 0.775318245, 0.775318245, 0.775243387, 0.775243387,
+        0.775243387, 0.774794238, 0.774419948, 0.774120516, 0.773895941, 0.773746225,
+        0.773671367, 0.773671367, 0.773297077, 0.772997644, 0.77277307, 0.772623354,
+        0.772548496, 0.772548496, 0.772249063, 0.772024489, 0.771874773, 0.771799915,
+        0.771799915, 0.77157534, 0.771425624, 0.771350766, 0.771350766, 0.77120105,
+        0.771126192, 0.771126192, 0.771051334, 0.771051334, 0.771051334, 0.770677043,
+        0.770377611, 0.770153037, 0.77000332, 0.769928462, 0.769928462, 0.76962903,
+        0.769404456, 0.76925474, 0.769179881, 0.769179881, 0.768955307, 0.768805591,
+        0.768730733, 0.768730733, 0.768581017, 0.768506159, 0.768506159, 0.768431301,
+        0.768431301, 0.768431301, 0.768131868, 0.767907294, 0.767757578, 0.76768272,
+        0.76768272, 0.767458145, 0.767308429, 0.767233571, 0.767233571, 0.767083855,
+        0.767008997, 0.767008997, 0.766934139, 0.766934139, 0.766934139, 0.766709564,
+        0.766559848, 0.76648499, 0.76648499, 0.766335274, 0.766260416, 0.766260416,
+        0.766185558, 0.766185558, 0.766185558, 0.766035842, 0.765960983, 0.765960983,
+        0.765886125, 0.765886125, 0.765886125, 0.765886125, 0.765886125, 0.765886125,
+        0.765886125, 0.765287261, 0.764688396, 0.764164389, 0.763715241, 0.76334095,
+        0.763041518, 0.762816943, 0.762667227, 0.762592369, 0.762592369, 0.761993504,
+        0.761469498, 0.761020349, 0.760646059, 0.760346626, 0.760122052, 0.759972336,
+        0.759897478, 0.759897478, 0.759373471, 0.758924323, 0.758550032, 0.7582506,
+        0.758026025, 0.757876309, 0.757801451, 0.757801451, 0.757352303, 0.756978012,
+        0.75667858, 0.756454005, 0.756304289, 0.756229431, 0.756229431, 0.755855141,
+        0.755555708, 0.755331134, 0.755181418, 0.75510656, 0.75510656, 0.754807127,
+        0.754582553, 0.754432837, 0.754357979, 0.754357979, 0.754133405, 0.753983688,
+        0.75390883, 0.75390883, 0.753759114, 0.753684256, 0.753684256, 0.753609398,
+        0.753609398, 0.753609398, 0.753085391, 0.752561385, 0.752112236, 0.751737946,
+        0.751438513, 0.751213939, 0.751064223, 0.750989365, 0.750989365, 0.750465358,
+        0.750016209, 0.749641919, 0.749342487, 0.749117912, 0.748968196, 0.748893338,
+        0.748893338, 0.748444189, 0.748069899, 0.747770467, 0.747545892, 0.747396176,
+        0.747321318, 0.747321318, 0.746947028, 0.746647595, 0.746423021, 0.746273305,
+        0.746198447, 0.746198447, 0.745899014, 0.74567444, 0.745524724, 0.745449866,
+        0.745449866, 0.745225291, 0.745075575, 0.745000717, 0.745000717, 0.744851001,
+        0.744776143, 0.744776143, 0.744701285, 0.744701285, 0.744701285, 0.744177278,
+        0.74372813, 0.743353839, 0.743054407, 0.742829832, 0.742680116, 0.742605258,
+        0.742605258, 0.74215611, 0.741781819, 0.741482387, 0.741257812, 0.741108096,
+        0.741033238, 0.741033238, 0.740658948, 0.740359515, 0.740134941, 0.739985225,
+        0.739910367, 0.739910367, 0.739610934, 0.73938636, 0.739236644, 0.739161786,
+        0.739161786, 0.738937212, 0.738787495, 0.738712637, 0.738712637, 0.738562921,
+        0.738488063, 0.738488063, 0.738413205, 0.738413205, 0.738413205, 0.737964056,
+        0.737589766, 0.737290333, 0.737065759, 0.736916043, 0.736841185, 0.736841185,
+        0.736466894, 0.736167462, 0.735942888, 0.735793172, 0.735718314, 0.735718314,
+        0.735418881, 0.735194307, 0.735044591, 0.734969733, 0.734969733, 0.734745158,
+        0.734595442, 0.734520584, 0.734520584, 0.734370868, 0.73429601, 0.73429601,
+        0.734221152, 0.734221152, 0.734221152, 0.733846861, 0.733547429, 0.733322855,
+        0.733173138, 0.73309828, 0.73309828, 0.732798848, 0.732574274, 0.732424557,
+        0.732349699, 0.732349699, 0.732125125, 0.731975409, 0.731900551, 0.731900551,
+        0.731750835, 0.731675976, 0.731675976, 0.731601118, 0.731601118, 0.731601118,
+        0.731301686, 0.731077112, 0.730927396, 0.730852537, 0.730852537, 0.730627963,
+        0.730478247, 0.730403389, 0.730403389, 0.730253673, 0.730178815, 0.730178815,
+        0.730103956, 0.730103956, 0.730103956, 0.729879382, 0.729729666, 0.729654808,
+        0.729654808, 0.729505092, 0.729430234, 0.729430234, 0.729355376, 0.729355376,
+        0.729355376, 0.729205659, 0.729130801, 0.729130801, 0.729055943, 0.729055943,
+        0.729055943, 0.728981085, 0.728981085, 0.728981085, 0.728981085, 0.72838222,
+        0.727783356, 0.727259349, 0.7268102, 0.72643591, 0.726136478, 0.725911903,
+        0.725762187, 0.725687329, 0.725687329, 0.725088464, 0.724564458, 0.724115309,
+        0.723741019, 0.723441586, 0.723217012, 0.723067296, 0.722992438, 0.722992438,
+        0.722468431, 0.722019282, 0.721644992, 0.72134556, 0.721120985, 0.720971269,
+        0.720896411, 0.720896411, 0.720447262, 0.720072972, 0.71977354, 0.719548965,
+        0.719399249, 0.719324391, 0.719324391, 0.7189501, 0.718650668, 0.718426094,
+        0.718276378, 0.71820152, 0.71820152, 0.717902087, 0.717677513, 0.717527797,
+        0.717452939, 0.717452939, 0.717228364, 0.717078648, 0.71700379, 0.71700379,
+        0.716854074, 0.716779216, 0.716779216, 0.716704358, 0.716704358, 0.716704358,
+        0.716180351, 0.715656344, 0.715207196, 0.714832905, 0.714533473, 0.714308899,
+        0.714159182, 0.714084324, 0.714084324, 0.713560318, 0.713111169, 0.712736879,
+        0.712437446, 0.712212872, 0.712063156, 0.711988298, 0.711988298, 0.711539149,
+        0.711164859, 0.710865426, 0.710640852, 0.710491136, 0.710416278, 0.710416278,
+        0.710041987, 0.709742555, 0.709517981, 0.709368264, 0.709293406, 0.709293406,
+        0.708993974, 0.7087694, 0.708619684, 0.708544825, 0.708544825, 0.708320251,
+        0.708170535, 0.708095677, 0.708095677, 0.707945961, 0.707871103, 0.707871103,
+        0.707796245, 0.707796245, 0.707796245, 0.707347096, 0.706897947, 0.706523657,
+        0.706224225, 0.70599965, 0.705849934, 0.705775076, 0.705775076, 0.705325927,
+        0.704951637, 0.704652205, 0.70442763, 0.704277914, 0.704203056, 0.704203056,
+        0.703828766, 0.703529333, 0.703304759, 0.703155043, 0.703080185, 0.703080185,
+        0.702780752, 0.702556178, 0.702406462, 0.702331604, 0.702331604, 0.702107029,
+        0.701957313, 0.701882455, 0.701882455, 0.701732739, 0.701657881, 0.701657881,
+        0.701583023, 0.701583023, 0.701583023, 0.701133874, 0.700759584, 0.700460151,
+        0.700235577, 0.700085861, 0.700011003, 0.700011003, 0.699636712, 0.69933728,
+        0.699112706, 0.698962989, 0.698888131, 0.698888131, 0.698588699, 0.698364125,
+        0.698214409, 0.69813955, 0.69813955, 0.697914976, 0.69776526, 0.697690402,
+        0.697690402, 0.697540686, 0.697465828, 0.697465828, 0.697390969, 0.697390969,
+        0.697390969, 0.697016679, 0.696717247, 0.696492672, 0.696342956, 0.696268098,
+        0.696268098, 0.695968666, 0.695744091, 0.695594375, 0.695519517, 0.695519517,
+        0.695294943, 0.695145227, 0.695070369, 0.695070369, 0.694920652, 0.694845794,
+        0.694845794, 0.694770936, 0.694770936, 0.694770936, 0.694471504, 0.69424693,
+        0.694097213, 0.694022355, 0.694022355, 0.693797781, 0.693648065, 0.693573207,
+        0.693573207, 0.693423491, 0.693348632, 0.693348632, 0.693273774, 0.693273774,
+        0.693273774, 0.6930492, 0.692899484, 0.692824626, 0.692824626, 0.69267491,
+        0.692600051, 0.692600051, 0.692525193, 0.692525193, 0.692525193, 0.692375477,
+        0.692300619, 0.692300619, 0.692225761, 0.692225761, 0.692225761, 0.692150903,
+        0.692150903, 0.692150903, 0.692150903, 0.691552038, 0.690953173, 0.690429167,
+        0.689980018, 0.689605728, 0.689306295, 0.689081721, 0.688932005, 0.688857147,
+        0.688857147, 0.688258282, 0.687734275, 0.687285127, 0.686910836, 0.686611404,
+        0.68638683, 0.686237114, 0.686162255, 0.686162255, 0.685638249, 0.6851891,
+        0.68481481, 0.684515377, 0.684290803, 0.684141087, 0.684066229, 0.684066229,
+        0.68361708, 0.68324279, 0.682943357, 0.682718783, 0.682569067, 0.682494209,
+        0.682494209, 0.682119918, 0.681820486, 0.681595912, 0.681446195, 0.681371337,
+        0.681371337, 0.681071905, 0.680847331, 0.680697615, 0.680622756, 0.680622756,
+        0.680398182, 0.680248466, 0.680173608, 0.680173608, 0.680023892, 0.679949034,
+        0.679949034, 0.679874176, 0.679874176, 0.679874176, 0.679350169, 0.678826162,
+        0.678377014, 0.678002723, 0.677703291, 0.677478717, 0.677329, 0.677254142,
+        0.677254142, 0.676730136, 0.676280987, 0.675906697, 0.675607264, 0.67538269,
+        0.675232974, 0.675158116, 0.675158116, 0.674708967, 0.674334677, 0.674035244,
+        0.67381067, 0.673660954, 0.673586096, 0.673586096, 0.673211805, 0.672912373,
+        0.672687799, 0.672538082, 0.672463224, 0.672463224, 0.672163792, 0.671939218,
+        0.671789501, 0.671714643, 0.671714643, 0.671490069, 0.671340353, 0.671265495,
+        0.671265495, 0.671115779, 0.67104092, 0.67104092, 0.670966062, 0.670966062,
+        0.670966062, 0.670516914, 0.670067765, 0.669693475, 0.669394042, 0.669169468,
+        0.669019752, 0.668944894, 0.668944894, 0.668495745, 0.668121455, 0.667822022,
+        0.667597448, 0.667447732, 0.667372874, 0.667372874, 0.666998583, 0.666699151,
+        0.666474577, 0.666324861, 0.666250002, 0.666250002, 0.66595057, 0.665725996,
+        0.66557628, 0.665501422, 0.665501422, 0.665276847, 0.665127131, 0.665052273,
+        0.665052273, 0.664902557, 0.664827699, 0.664827699, 0.664752841, 0.664752841,
+        0.664752841, 0.66437855, 0.66400426, 0.663704827, 0.663480253, 0.663330537,
+        0.663255679, 0.663255679, 0.662881388, 0.662581956, 0.662357382, 0.662207665,
+        0.662132807, 0.662132807, 0.661833375, 0.661608801, 0.661459084, 0.661384226,
+        0.661384226, 0.661159652, 0.661009936, 0.660935078, 0.660935078, 0.660785362,
+        0.660710504, 0.660710504, 0.660635645, 0.660635645, 0.660635645, 0.660261355,
+        0.659961923, 0.659737348, 0.659587632, 0.659512774, 0.659512774, 0.659213342,
+        0.658988767, 0.658839051, 0.658764193, 0.658764193, 0.658539619, 0.658389903,
+        0.658315045, 0.658315045, 0.658165328, 0.65809047, 0.65809047, 0.658015612,
+        0.658015612, 0.658015612, 0.65771618, 0.657491605, 0.657341889, 0.657267031,
+        0.657267031, 0.657042457, 0.656892741, 0.656817883, 0.656817883, 0.656668166,
+        0.656593308, 0.656593308, 0.65651845, 0.65651845, 0.65651845, 0.656293876,
+        0.65614416, 0.656069302, 0.656069302, 0.655919586, 0.655844727, 0.655844727,
+        0.655769869, 0.655769869, 0.655769869, 0.655620153, 0.655545295, 0.655545295,
+        0.655470437, 0.655470437, 0.655470437, 0.655395579, 0.655395579, 0.655395579,
+        0.655395579, 0.654796714, 0.654197849, 0.653673843, 0.653224694, 0.652850404,
+        0.652550971, 0.652326397, 0.652176681, 0.652101823, 0.652101823, 0.651502958,
+        0.650978951, 0.650529803, 0.650155512, 0.64985608, 0.649631506, 0.649481789,
+        0.649406931, 0.649406931, 0.648882925, 0.648433776, 0.648059486, 0.647760053,
+        0.647535479, 0.647385763, 0.647310905, 0.647310905, 0.646861756, 0.646487466,
+        0.646188033, 0.645963459, 0.645813743, 0.645738885, 0.645738885, 0.645364594,
+        0.645065162, 0.644840588, 0.644690871, 0.644616013, 0.644616013, 0.644316581,
+        0.644092007, 0.643942291, 0.643867432, 0.643867432, 0.643642858, 0.643493142,
+        0.643418284, 0.643418284, 0.643268568, 0.64319371, 0.64319371, 0.643118851,
+        0.643118851, 0.643118851, 0.642594845, 0.642070838, 0.64162169, 0.641247399,
+        0.640947967, 0.640723392, 0.640573676, 0.640498818, 0.640498818, 0.639974812,
+        0.639525663, 0.639151372, 0.63885194, 0.638627366, 0.63847765, 0.638402792,
+        0.638402792, 0.637953643, 0.637579353, 0.63727992, 0.637055346, 0.63690563,
+        0.636830772, 0.636830772, 0.636456481, 0.636157049, 0.635932474, 0.635782758,
+        0.6357079, 0.6357079, 0.635408468, 0.635183894, 0.635034177, 0.634959319,
+        0.634959319, 0.634734745, 0.634585029, 0.634510171, 0.634510171, 0.634360454,
+        0.634285596, 0.634285596, 0.634210738, 0.634210738, 0.634210738, 0.63376159,
+        0.633312441, 0.632938151, 0.632638718, 0.632414144, 0.632264428, 0.63218957,
+        0.63218957, 0.631740421, 0.631366131, 0.631066698, 0.630842124, 0.630692408,
+        0.63061755, 0.63061755, 0.630243259, 0.629943827, 0.629719253, 0.629569536,
+        0.629494678, 0.629494678, 0.629195246, 0.628970672, 0.628820956, 0.628746097,
+        0.628746097, 0.628521523, 0.628371807, 0.628296949, 0.628296949, 0.628147233,
+        0.628072375, 0.628072375, 0.627997517, 0.627997517, 0.627997517, 0.627623226,
+        0.627248936, 0.626949503, 0.626724929, 0.626575213, 0.626500355, 0.626500355,
+        0.626126064, 0.625826632, 0.625602058, 0.625452341, 0.625377483, 0.625377483,
+        0.625078051, 0.624853477, 0.62470376, 0.624628902, 0.624628902, 0.624404328,
+        0.624254612, 0.624179754, 0.624179754, 0.624030038, 0.623955179, 0.623955179,
+        0.623880321, 0.623880321, 0.623880321, 0.623580889, 0.623281457, 0.623056882,
+        0.622907166, 0.622832308, 0.622832308, 0.622532876, 0.622308301, 0.622158585,
+        0.622083727, 0.622083727, 0.621859153, 0.621709437, 0.621634579, 0.621634579,
+        0.621484862, 0.621410004, 0.621410004, 0.621335146, 0.621335146, 0.621335146,
+        0.621035714, 0.62081114, 0.620661423, 0.620586565, 0.620586565, 0.620361991,
+        0.620212275, 0.620137417, 0.620137417, 0.6199877, 0.619912842, 0.619912842,
+        0.619837984, 0.619837984, 0.619837984, 0.61961341, 0.619463694, 0.619388836,
+        0.619388836, 0.61923912, 0.619164261, 0.619164261, 0.619089403, 0.619089403,
+        0.619089403, 0.618939687, 0.618864829, 0.618864829, 0.618789971, 0.618789971,
+        0.618789971, 0.618715113, 0.618715113, 0.618715113, 0.618715113, 0.61804139,
+        0.617442525, 0.616918519, 0.61646937, 0.61609508, 0.615795647, 0.615571073,
+        0.615421357, 0.615346499, 0.615346499, 0.614747634, 0.614223627, 0.613774479,
+        0.613400188, 0.613100756, 0.612876182, 0.612726465, 0.612651607, 0.612651607,
+        0.612127601, 0.611678452, 0.611304162, 0.611004729, 0.610780155, 0.610630439,
+        0.610555581, 0.610555581, 0.610106432, 0.609732142, 0.609432709, 0.609208135,
+        0.609058419, 0.608983561, 0.608983561, 0.60860927, 0.608309838, 0.608085264,
+        0.607935547, 0.607860689, 0.607860689, 0.607561257, 0.607336683, 0.607186966,
+        0.607112108, 0.607112108, 0.606887534, 0.606737818, 0.60666296, 0.60666296,
+        0.606513244, 0.606438386, 0.606438386, 0.606363527, 0.606363527, 0.606363527,
+        0.605839521, 0.605315514, 0.604866366, 0.604492075, 0.604192643, 0.603968068,
+        0.603818352, 0.603743494, 0.603743494, 0.603219487, 0.602770339, 0.602396048,
+        0.602096616, 0.601872042, 0.601722326, 0.601647467, 0.601647467, 0.601198319,
+        0.600824028, 0.600524596, 0.600300022, 0.600150306, 0.600075448, 0.600075448,
+        0.599701157, 0.599401725, 0.59917715, 0.599027434, 0.598952576, 0.598952576,
+        0.598653144, 0.598428569, 0.598278853, 0.598203995, 0.598203995, 0.597979421,
+        0.597829705, 0.597754847, 0.597754847, 0.59760513, 0.597530272, 0.597530272,
+        0.597455414, 0.597455414, 0.597455414, 0.597006266, 0.596557117, 0.596182827,
+        0.595883394, 0.59565882, 0.595509104, 0.595434246, 0.595434246, 0.594985097,
+        0.594610807, 0.594311374, 0.5940868, 0.593937084, 0.593862226, 0.593862226,
+        0.593487935, 0.593188503, 0.592963929, 0.592814212, 0.592739354, 0.592739354,
+        0.592439922, 0.592215348, 0.592065631, 0.591990773, 0.591990773, 0.591766199,
+        0.591616483, 0.591541625, 0.591541625, 0.591391909, 0.591317051, 0.591317051,
+        0.591242192, 0.591242192, 0.591242192, 0.590867902, 0.590493612, 0.590194179,
+        0.589969605, 0.589819889, 0.589745031, 0.589745031, 0.58937074, 0.589071308,
+        0.588846733, 0.588697017, 0.588622159, 0.588622159, 0.588322727, 0.588098153,
+        0.587948436, 0.587873578, 0.587873578, 0.587649004, 0.587499288, 0.58742443,
+        0.58742443, 0.587274713, 0.587199855, 0.587199855, 0.587124997, 0.587124997,
+        0.587124997, 0.586825565, 0.586526133, 0.586301558, 0.586151842, 0.586076984,
+        0.586076984, 0.585777552, 0.585552977, 0.585403261, 0.585328403, 0.585328403,
+        0.585103829, 0.584954113, 0.584879254, 0.584879254, 0.584729538, 0.58465468,
+        0.58465468, 0.584579822, 0.584579822, 0.584579822, 0.584355248, 0.584130674,
+        0.583980957, 0.583906099, 0.583906099, 0.583681525, 0.583531809, 0.583456951,
+        0.583456951, 0.583307235, 0.583232376, 0.583232376, 0.583157518, 0.583157518,
+        0.583157518, 0.582932944, 0.582783228, 0.58270837, 0.58270837, 0.582558654,
+        0.582483795, 0.582483795, 0.582408937, 0.582408937, 0.582408937, 0.582259221,
+        0.582184363, 0.582184363, 0.582109505, 0.582109505, 0.582109505, 0.582034647,
+        0.582034647, 0.582034647, 0.582034647, 0.581360924, 0.580762059, 0.580238053,
+        0.579788904, 0.579414614, 0.579115181, 0.578890607, 0.578740891, 0.578666033,
+        0.578666033, 0.578067168, 0.577543161, 0.577094013, 0.576719722, 0.57642029,
+        0.576195716, 0.576045999, 0.575971141, 0.575971141, 0.575447135, 0.574997986,
+        0.574623696, 0.574324263, 0.574099689, 0.573949973, 0.573875115, 0.573875115,
+        0.573425966, 0.573051676, 0.572752243, 0.572527669, 0.572377953, 0.572303095,
+        0.572303095, 0.571928804, 0.571629372, 0.571404798, 0.571255081, 0.571180223,
+        0.571180223, 0.570880791, 0.570656217, 0.5705065, 0.570431642, 0.570431642,
+        0.570207068, 0.570057352, 0.569982494, 0.569982494, 0.569832778, 0.56975792,
+        0.56975792, 0.569683061, 0.569683061, 0.569683061, 0.569084197, 0.56856019,
+        0.568111041, 0.567736751, 0.567437319, 0.567212744, 0.567063028, 0.56698817,
+        0.56698817, 0.566464163, 0.566015015, 0.565640724, 0.565341292, 0.565116718,
+        0.564967002, 0.564892143, 0.564892143, 0.564442995, 0.564068704, 0.563769272,
+        0.563544698, 0.563394982, 0.563320123, 0.563320123, 0.562945833, 0.562646401,
+        0.562421826, 0.56227211, 0.562197252, 0.562197252, 0.56189782, 0.561673245,
+        0.561523529, 0.561448671, 0.561448671, 0.561224097, 0.561074381, 0.560999523,
+        0.560999523, 0.560849806, 0.560774948, 0.560774948, 0.56070009, 0.56070009,
+        0.56070009, 0.560250942, 0.559801793, 0.559427503, 0.55912807, 0.558903496,
+        0.55875378, 0.558678922, 0.558678922, 0.558229773, 0.557855483, 0.55755605,
+        0.557331476, 0.55718176, 0.557106902, 0.557106902, 0.556732611, 0.556433179,
+        0.556208605, 0.556058888, 0.55598403, 0.55598403, 0.555684598, 0.555460024,
+        0.555310307, 0.555235449, 0.555235449, 0.555010875, 0.554861159, 0.554786301,
+        0.554786301, 0.554636585, 0.554561726, 0.554561726, 0.554486868, 0.554486868,
+        0.554486868, 0.554112578, 0.553738287, 0.553438855, 0.553214281, 0.553064565,
+        0.552989707, 0.552989707, 0.552615416, 0.552315984, 0.552091409, 0.551941693,
+        0.551866835, 0.551866835, 0.551567403, 0.551342828, 0.551193112, 0.551118254,
+        0.551118254, 0.55089368, 0.550743964, 0.550669106, 0.550669106, 0.550519389,
+        0.550444531, 0.550444531, 0.550369673, 0.550369673, 0.550369673, 0.550070241,
+        0.549770808, 0.549546234, 0.549396518, 0.54932166, 0.54932166, 0.549022228,
+        0.548797653, 0.548647937, 0.548573079, 0.548573079, 0.548348505, 0.548198789,
+        0.54812393, 0.54812393, 0.547974214, 0.547899356, 0.547899356, 0.547824498,
+        0.547824498, 0.547824498, 0.547599924, 0.547375349, 0.547225633, 0.547150775,
+        0.547150775, 0.546926201, 0.546776485, 0.546701627, 0.546701627, 0.54655191,
+        0.546477052, 0.546477052, 0.546402194, 0.546402194, 0.546402194, 0.546252478,
+        0.546102762, 0.546027904, 0.546027904, 0.545878188, 0.54580333, 0.54580333,
+        0.545728471, 0.545728471, 0.545728471, 0.545578755, 0.545503897, 0.545503897,
+        0.545429039, 0.545429039, 0.545429039, 0.545354181, 0.545354181, 0.545354181,
+        0.545354181, 0.544680458, 0.544081593, 0.543557587, 0.543108438, 0.542734148,
+        0.542434715, 0.542210141, 0.542060425, 0.541985567, 0.541985567, 0.541386702,
+        0.540862695, 0.540413547, 0.540039256, 0.539739824, 0.53951525, 0.539365533,
+        0.539290675, 0.539290675, 0.538766669, 0.53831752, 0.53794323, 0.537643797,
+        0.537419223, 0.537269507, 0.537194649, 0.537194649, 0.5367455, 0.53637121,
+        0.536071777, 0.535847203, 0.535697487, 0.535622629, 0.535622629, 0.535248338,
+        0.534948906, 0.534724332, 0.534574615, 0.534499757, 0.534499757, 0.534200325,
+        0.533975751, 0.533826035, 0.533751176, 0.533751176, 0.533526602, 0.533376886,
+        0.533302028, 0.533302028, 0.533152312, 0.533077454, 0.533077454, 0.533002595,
+        0.533002595, 0.533002595, 0.532403731, 0.531879724, 0.531430576, 0.531056285,
+        0.530756853, 0.530532278, 0.530382562, 0.530307704, 0.530307704, 0.529783697,
+        0.529334549, 0.528960258, 0.528660826, 0.528436252, 0.528286536, 0.528211677,
+        0.528211677, 0.527762529, 0.527388238, 0.527088806, 0.526864232, 0.526714516,
+        0.526639657, 0.526639657, 0.526265367, 0.525965935, 0.52574136, 0.525591644,
+        0.525516786, 0.525516786, 0.525217354, 0.524992779, 0.524843063, 0.524768205,
+        0.524768205, 0.524543631, 0.524393915, 0.524319057, 0.524319057, 0.52416934,
+        0.524094482, 0.524094482, 0.524019624, 0.524019624, 0.524019624, 0.523495618,
+        0.523046469, 0.522672179, 0.522372746, 0.522148172, 0.521998456, 0.521923598,
+        0.521923598, 0.521474449, 0.521100159, 0.520800726, 0.520576152, 0.520426436,
+        0.520351578, 0.520351578, 0.519977287, 0.519677855, 0.51945328, 0.519303564,
+        0.519228706, 0.519228706, 0.518929274, 0.5187047, 0.518554983, 0.518480125,
+        0.518480125, 0.518255551, 0.518105835, 0.518030977, 0.518030977, 0.517881261,
+        0.517806402, 0.517806402, 0.517731544, 0.517731544, 0.517731544, 0.517357254,
+        0.516982963, 0.516683531, 0.516458957, 0.516309241, 0.516234382, 0.516234382,
+        0.515860092, 0.51556066, 0.515336085, 0.515186369, 0.515111511, 0.515111511,
+        0.514812079, 0.514587504, 0.514437788, 0.51436293, 0.51436293, 0.514138356,
+        0.51398864, 0.513913782, 0.513913782, 0.513764065, 0.513689207, 0.513689207,
+        0.513614349, 0.513614349, 0.513614349, 0.513314917, 0.513015484, 0.51279091,
+        0.512641194, 0.512566336, 0.512566336, 0.512266903, 0.512042329, 0.511892613,
+        0.511817755, 0.511817755, 0.511593181, 0.511443464, 0.511368606, 0.511368606,
+        0.51121889, 0.511144032, 0.511144032, 0.511069174, 0.511069174, 0.511069174,
+        0.5108446, 0.510620025, 0.510470309, 0.510395451, 0.510395451, 0.510170877,
+        0.510021161, 0.509946303, 0.509946303, 0.509796586, 0.509721728, 0.509721728,
+        0.50964687, 0.50964687, 0.50964687, 0.509497154, 0.509347438, 0.50927258,
+        0.50927258, 0.509122864, 0.509048005, 0.509048005, 0.508973147, 0.508973147,
+        0.508973147, 0.508898289, 0.508823431, 0.508823431, 0.508748573, 0.508748573,
+        0.508748573, 0.508673715, 0.508673715, 0.508673715, 0.508673715, 0.507999992,
+        0.507401127, 0.506877121, 0.506427972, 0.506053682, 0.505754249, 0.505529675,
+        0.505379959, 0.505305101, 0.505305101, 0.504706236, 0.504182229, 0.503733081,
+        0.50335879, 0.503059358, 0.502834784, 0.502685067, 0.502610209, 0.502610209,
+        0.502086203, 0.501637054, 0.501262764, 0.500963331, 0.500738757, 0.500589041,
+        0.500514183, 0.500514183, 0.500065034, 0.499690744, 0.499391311, 0.499166737,
+        0.499017021, 0.498942163, 0.498942163, 0.498567872, 0.49826844, 0.498043866,
+        0.497894149, 0.497819291, 0.497819291, 0.497519859, 0.497295285, 0.497145569,
+        0.49707071, 0.49707071, 0.496846136, 0.49669642, 0.496621562, 0.496621562,
+        0.496471846, 0.496396988, 0.496396988, 0.49632213, 0.49632213, 0.49632213,
+        0.495723265, 0.495199258, 0.49475011, 0.494375819, 0.494076387, 0.493851812,
+        0.493702096, 0.493627238, 0.493627238, 0.493103231, 0.492654083, 0.492279792,
+        0.49198036, 0.491755786, 0.49160607, 0.491531212, 0.491531212, 0.491082063,
+        0.490707772, 0.49040834, 0.490183766, 0.49003405, 0.489959192, 0.489959192,
+        0.489584901, 0.489285469, 0.489060894, 0.488911178, 0.48883632, 0.48883632,
+        0.488536888, 0.488312313, 0.488162597, 0.488087739, 0.488087739, 0.487863165,
+        0.487713449, 0.487638591, 0.487638591, 0.487488874, 0.487414016, 0.487414016,
+        0.487339158, 0.487339158, 0.487339158, 0.486815152, 0.486366003, 0.485991713,
+        0.48569228, 0.485467706, 0.48531799, 0.485243132, 0.485243132, 0.484793983,
+        0.484419693, 0.48412026, 0.483895686, 0.48374597, 0.483671112, 0.483671112,
+        0.483296821, 0.482997389, 0.482772815, 0.482623098, 0.48254824, 0.48254824,
+        0.482248808, 0.482024234, 0.481874517, 0.481799659, 0.481799659, 0.481575085,
+        0.481425369, 0.481350511, 0.481350511, 0.481200795, 0.481125936, 0.481125936,
+        0.481051078, 0.481051078, 0.481051078, 0.48060193, 0.480227639, 0.479928207,
+        0.479703633, 0.479553916, 0.479479058, 0.479479058, 0.479104768, 0.478805336,
+        0.478580761, 0.478431045, 0.478356187, 0.478356187, 0.478056755, 0.47783218,
+        0.477682464, 0.477607606, 0.477607606, 0.477383032, 0.477233316, 0.477158457,
+        0.477158457, 0.477008741, 0.476933883, 0.476933883, 0.476859025, 0.476859025,
+        0.476859025, 0.476559593, 0.47626016, 0.476035586, 0.47588587, 0.475811012,
+        0.475811012, 0.475511579, 0.475287005, 0.475137289, 0.475062431, 0.475062431,
+        0.474837857, 0.47468814, 0.474613282, 0.474613282, 0.474463566, 0.474388708,
+        0.474388708, 0.47431385, 0.47431385, 0.47431385, 0.474089276, 0.473864701,
+        0.473714985, 0.473640127, 0.473640127, 0.473415553, 0.473265837, 0.473190979,
+        0.473190979, 0.473041262, 0.472966404, 0.472966404, 0.472891546, 0.472891546,
+        0.472891546, 0.47274183, 0.472592114, 0.472517256, 0.472517256, 0.472367539,
+        0.472292681, 0.472292681, 0.472217823, 0.472217823, 0.472217823, 0.472142965,
+        0.472068107, 0.472068107, 0.471993249, 0.471993249, 0.471993249, 0.471993249,
+        0.471993249, 0.471993249, 0.471993249, 0.471319526, 0.470720661, 0.470196655,
+        0.469747506, 0.469373216, 0.469073783, 0.468849209, 0.468699493, 0.468624635,
+        0.468624635, 0.46802577, 0.467501763, 0.467052615, 0.466678324, 0.466378892,
+        0.466154318, 0.466004602, 0.465929743, 0.465929743, 0.465405737, 0.464956588,
+        0.464582298, 0.464282865, 0.464058291, 0.463908575, 0.463833717, 0.463833717,
+        0.463384568, 0.463010278, 0.462710845, 0.462486271, 0.462336555, 0.462261697,
+        0.462261697, 0.461887406, 0.461587974, 0.4613634, 0.461213684, 0.461138825,
+        0.461138825, 0.460839393, 0.460614819, 0.460465103, 0.460390244, 0.460390244,
+        0.46016567, 0.460015954, 0.459941096, 0.459941096, 0.45979138, 0.459716522,
+        0.459716522, 0.459716522, 0.459716522, 0.459716522, 0.459117657, 0.45859365,
+        0.458144502, 0.457770211, 0.457470779, 0.457246205, 0.457096488, 0.45702163,
+        0.45702163, 0.456497624, 0.456048475, 0.455674185, 0.455374752, 0.455150178,
+        0.455000462, 0.454925604, 0.454925604, 0.454476455, 0.454102165, 0.453802732,
+        0.453578158, 0.453428442, 0.453353584, 0.453353584, 0.452979293, 0.452679861,
+        0.452455287, 0.45230557, 0.452230712, 0.452230712, 0.45193128, 0.451706706,
+        0.451556989, 0.451482131, 0.451482131, 0.451257557, 0.451107841, 0.451032983,
+        0.451032983, 0.450883267, 0.450808408, 0.450808408, 0.45073355, 0.45073355,
+        0.45073355, 0.450209544, 0.449760395, 0.449386105, 0.449086672, 0.448862098,
+        0.448712382, 0.448637524, 0.448637524, 0.448188375, 0.447814085, 0.447514652,
+        0.447290078, 0.447140362, 0.447065504, 0.447065504, 0.446691213, 0.446391781,
+        0.446167207, 0.44601749, 0.445942632, 0.445942632, 0.4456432, 0.445418626,
+        0.44526891, 0.445194051, 0.445194051, 0.444969477, 0.444819761, 0.444744903,
+        0.444744903, 0.444595187, 0.444520329, 0.444520329, 0.44444547, 0.44444547,
+        0.44444547, 0.443996322, 0.443622031, 0.443322599, 0.443098025, 0.442948309,
+        0.442873451, 0.442873451, 0.44249916, 0.442199728, 0.441975153, 0.441825437,
+        0.441750579, 0.441750579, 0.441451147, 0.441226572, 0.441076856, 0.441001998,
+        0.441001998, 0.440777424, 0.440627708, 0.44055285, 0.44055285, 0.440403133,
+        0.440328275, 0.440328275, 0.440253417, 0.440253417, 0.440253417, 0.439879127,
+        0.439579694, 0.43935512, 0.439205404, 0.439130546, 0.439130546, 0.438831113,
+        0.438606539, 0.438456823, 0.438381965, 0.438381965, 0.438157391, 0.438007674,
+        0.437932816, 0.437932816, 0.4377831, 0.437708242, 0.437708242, 0.437633384,
+        0.437633384, 0.437633384, 0.43740881, 0.437184235, 0.437034519, 0.436959661,
+        0.436959661, 0.436735087, 0.436585371, 0.436510513, 0.436510513, 0.436360796,
+        0.436285938, 0.436285938, 0.43621108, 0.43621108, 0.43621108, 0.436061364,
+        0.435911648, 0.43583679, 0.43583679, 0.435687074, 0.435612215, 0.435612215,
+        0.435537357, 0.435537357, 0.435537357, 0.435462499, 0.435387641, 0.435387641,
+        0.435312783, 0.435312783, 0.435312783, 0.435312783, 0.435312783, 0.435312783,
+        0.435312783, 0.43463906, 0.434040195, 0.433516189, 0.43306704, 0.43269275,
+        0.432393317, 0.432168743, 0.432019027, 0.431944169, 0.431944169, 0.431345304,
+        0.430821297, 0.430372149, 0.429997858, 0.429698426, 0.429473852, 0.429324136,
+        0.429249277, 0.429249277, 0.428725271, 0.428276122, 0.427901832, 0.427602399,
+        0.427377825, 0.427228109, 0.427153251, 0.427153251, 0.426704102, 0.426329812,
+        0.426030379, 0.425805805, 0.425656089, 0.425581231, 0.425581231, 0.42520694,
+        0.424907508, 0.424682934, 0.424533218, 0.424458359, 0.424458359, 0.424158927,
+        0.423934353, 0.423784637, 0.423709779, 0.423709779, 0.423485204, 0.423335488,
+        0.42326063, 0.42326063, 0.423110914, 0.423036056, 0.423036056, 0.423036056,
+        0.423036056, 0.423036056, 0.422437191, 0.421913184, 0.421464036, 0.421089745,
+        0.420790313, 0.420565739, 0.420416022, 0.420341164, 0.420341164, 0.419817158,
+        0.419368009, 0.418993719, 0.418694286, 0.418469712, 0.418319996, 0.418245138,
+        0.418245138, 0.417795989, 0.417421699, 0.417122266, 0.416897692, 0.416747976,
+        0.416673118, 0.416673118, 0.416298827, 0.415999395, 0.415774821, 0.415625104,
+        0.415550246, 0.415550246, 0.415250814, 0.41502624, 0.414876523, 0.414801665,
+        0.414801665, 0.414577091, 0.414427375, 0.414352517, 0.414352517, 0.414202801,
+        0.414127943, 0.414127943, 0.414053084, 0.414053084, 0.414053084, 0.413529078,
+        0.413079929, 0.412705639, 0.412406206, 0.412181632, 0.412031916, 0.411957058,
+        0.411957058, 0.411507909, 0.411133619, 0.410834186, 0.410609612, 0.410459896,
+        0.410385038, 0.410385038, 0.410010747, 0.409711315, 0.409486741, 0.409337024,
+        0.409262166, 0.409262166, 0.408962734, 0.40873816, 0.408588444, 0.408513585,
+        0.408513585, 0.408289011, 0.408139295, 0.408064437, 0.408064437, 0.407914721,
+        0.407839863, 0.407839863, 0.407765005, 0.407765005, 0.407765005, 0.407315856,
+        0.406941565, 0.406642133, 0.406417559, 0.406267843, 0.406192985, 0.406192985,
+        0.405818694, 0.405519262, 0.405294687, 0.405144971, 0.405070113, 0.405070113,
+        0.404770681, 0.404546106, 0.40439639, 0.404321532, 0.404321532, 0.404096958,
+        0.403947242, 0.403872384, 0.403872384, 0.403722667, 0.403647809, 0.403647809,
+        0.403572951, 0.403572951, 0.403572951, 0.403198661, 0.402899228, 0.402674654,
+        0.402524938, 0.40245008, 0.40245008, 0.402150647, 0.401926073, 0.401776357,
+        0.401701499, 0.401701499, 0.401476925, 0.401327208, 0.40125235, 0.40125235,
+        0.401102634, 0.401027776, 0.401027776, 0.400952918, 0.400952918, 0.400952918,
+        0.400653486, 0.400428911, 0.400279195, 0.400204337, 0.400204337, 0.399979763,
+        0.399830047, 0.399755188, 0.399755188, 0.399605472, 0.399530614, 0.399530614,
+        0.399455756, 0.399455756, 0.399455756, 0.39930604, 0.399156324, 0.399081466,
+        0.399081466, 0.398931749, 0.398856891, 0.398856891, 0.398782033, 0.398782033,
+        0.398782033, 0.398707175, 0.398632317, 0.398632317, 0.398557459, 0.398557459,
+        0.398557459, 0.398557459, 0.398557459, 0.398557459, 0.398557459, 0.397883736,
+        0.397284871, 0.396760865, 0.396311716, 0.395937426, 0.395637993, 0.395413419,
+        0.395263703, 0.395188845, 0.395188845, 0.39458998, 0.394065973, 0.393616825,
+        0.393242534, 0.392943102, 0.392718528, 0.392568811, 0.392493953, 0.392493953,
+        0.391969947, 0.391520798, 0.391146508, 0.390847075, 0.390622501, 0.390472785,
+        0.390397927, 0.390397927, 0.389948778, 0.389574488, 0.389275055, 0.389050481,
+        0.388900765, 0.388825907, 0.388825907, 0.388451616, 0.388152184, 0.38792761,
+        0.387777893, 0.387703035, 0.387703035, 0.387403603, 0.387179029, 0.387029313,
+        0.386954454, 0.386954454, 0.38672988, 0.386580164, 0.386505306, 0.386505306,
+        0.38635559, 0.386280732, 0.386280732, 0.386280732, 0.386280732, 0.386280732,
+        0.385681867, 0.38515786, 0.384708712, 0.384334421, 0.384034989, 0.383810415,
+        0.383660698, 0.38358584, 0.38358584, 0.383061834, 0.382612685, 0.382238395,
+        0.381938962, 0.381714388, 0.381564672, 0.381489814, 0.381489814, 0.381040665,
+        0.380666375, 0.380366942, 0.380142368, 0.379992652, 0.379917794, 0.379917794,
+        0.379543503, 0.379244071, 0.379019497, 0.37886978, 0.378794922, 0.378794922,
+        0.37849549, 0.378270916, 0.378121199, 0.378046341, 0.378046341, 0.377821767,
+        0.377672051, 0.377597193, 0.377597193, 0.377447477, 0.377372618, 0.377372618,
+        0.37729776, 0.37729776, 0.37729776, 0.376773754, 0.376324605, 0.375950315,
+        0.375650882, 0.375426308, 0.375276592, 0.375201734, 0.375201734, 0.374752585,
+        0.374378295, 0.374078862, 0.373854288, 0.373704572, 0.373629714, 0.373629714,
+        0.373255423, 0.372955991, 0.372731417, 0.3725817, 0.372506842, 0.372506842,
+        0.37220741, 0.371982836, 0.371833119, 0.371758261, 0.371758261, 0.371533687,
+        0.371383971, 0.371309113, 0.371309113, 0.371159397, 0.371084539, 0.371084539,
+        0.37100968, 0.37100968, 0.37100968, 0.370560532, 0.370186241, 0.369886809,
+        0.369662235, 0.369512519, 0.36943766, 0.36943766, 0.36906337, 0.368763938,
+        0.368539363, 0.368389647, 0.368314789, 0.368314789, 0.368015357, 0.367790782,
+        0.367641066, 0.367566208, 0.367566208, 0.367341634, 0.367191918, 0.36711706,
+        0.36711706, 0.366967343, 0.366892485, 0.366892485, 0.366817627, 0.366817627,
+        0.366817627, 0.366443337, 0.366143904, 0.36591933, 0.365769614, 0.365694756,
+        0.365694756, 0.365395323, 0.365170749, 0.365021033, 0.364946175, 0.364946175,
+        0.364721601, 0.364571884, 0.364497026, 0.364497026, 0.36434731, 0.364272452,
+        0.364272452, 0.364197594, 0.364197594, 0.364197594, 0.363898162, 0.363673587,
+        0.363523871, 0.363449013, 0.363449013, 0.363224439, 0.363074723, 0.362999864,
+        0.362999864, 0.362850148, 0.36277529, 0.36277529, 0.362700432, 0.362700432,
+        0.362700432, 0.362475858, 0.362326142, 0.362251283, 0.362251283, 0.362101567,
+        0.362026709, 0.362026709, 0.361951851, 0.361951851, 0.361951851, 0.361876993,
+        0.361802135, 0.361802135, 0.361727277, 0.361727277, 0.361727277, 0.361727277,
+        0.361727277, 0.361727277, 0.361727277, 0.361053554, 0.360454689, 0.359930683,
+        0.359481534, 0.359107244, 0.358807811, 0.358583237, 0.358433521, 0.358358663,
+        0.358358663, 0.357759798, 0.357235791, 0.356786643, 0.356412352, 0.35611292,
+        0.355888346, 0.355738629, 0.355663771, 0.355663771, 0.355139765, 0.354690616,
+        0.354316326, 0.354016893, 0.353792319, 0.353642603, 0.353567745, 0.353567745,
+        0.353118596, 0.352744306, 0.352444873, 0.352220299, 0.352070583, 0.351995725,
+        0.351995725, 0.351621434, 0.351322002, 0.351097428, 0.350947711, 0.350872853,
+        0.350872853, 0.350573421, 0.350348847, 0.35019913, 0.350124272, 0.350124272,
+        0.349899698, 0.349749982, 0.349675124, 0.349675124, 0.349525408, 0.349450549,
+        0.349450549, 0.349450549, 0.349450549, 0.349450549, 0.348851685, 0.348327678,
+        0.347878529, 0.347504239, 0.347204807, 0.346980232, 0.346830516, 0.346755658,
+        0.346755658, 0.346231651, 0.345782503, 0.345408212, 0.34510878, 0.344884206,
+        0.34473449, 0.344659631, 0.344659631, 0.344210483, 0.343836192, 0.34353676,
+        0.343312186, 0.34316247, 0.343087611, 0.343087611, 0.342713321, 0.342413889,
+        0.342189314, 0.342039598, 0.34196474, 0.34196474, 0.341665308, 0.341440733,
+        0.341291017, 0.341216159, 0.341216159, 0.340991585, 0.340841869, 0.340767011,
+        0.340767011, 0.340617294, 0.340542436, 0.340542436, 0.340467578, 0.340467578,
+        0.340467578, 0.339943572, 0.339494423, 0.339120133, 0.3388207, 0.338596126,
+        0.33844641, 0.338371552, 0.338371552, 0.337922403, 0.337548113, 0.33724868,
+        0.337024106, 0.33687439, 0.336799532, 0.336799532, 0.336425241, 0.336125809,
+        0.335901234, 0.335751518, 0.33567666, 0.33567666, 0.335377228, 0.335152654,
+        0.335002937, 0.334928079, 0.334928079, 0.334703505, 0.334553789, 0.334478931,
+        0.334478931, 0.334329215, 0.334254356, 0.334254356, 0.334179498, 0.334179498,
+        0.334179498, 0.33373035, 0.333356059, 0.333056627, 0.332832053, 0.332682336,
+        0.332607478, 0.332607478, 0.332233188, 0.331933755, 0.331709181, 0.331559465,
+        0.331484607, 0.331484607, 0.331185175, 0.3309606, 0.330810884, 0.330736026,
+        0.330736026, 0.330511452, 0.330361736, 0.330286877, 0.330286877, 0.330137161,
+        0.330062303, 0.330062303, 0.329987445, 0.329987445, 0.329987445, 0.329613155,
+        0.329313722, 0.329089148, 0.328939432, 0.328864574, 0.328864574, 0.328565141,
+        0.328340567, 0.328190851, 0.328115993, 0.328115993, 0.327891418, 0.327741702,
+        0.327666844, 0.327666844, 0.327517128, 0.32744227, 0.32744227, 0.327367412,
+        0.327367412, 0.327367412, 0.327067979, 0.326843405, 0.326693689, 0.326618831,
+        0.326618831, 0.326394257, 0.32624454, 0.326169682, 0.326169682, 0.326019966,
+        0.325945108, 0.325945108, 0.32587025, 0.32587025, 0.32587025, 0.325645676,
+        0.325495959, 0.325421101, 0.325421101, 0.325271385, 0.325196527, 0.325196527,
+        0.325121669, 0.325121669, 0.325121669, 0.324971953, 0.324897095, 0.324897095,
+        0.324822237, 0.324822237, 0.324822237, 0.324822237, 0.324822237, 0.324822237,
+        0.324822237, 0.323440014, 0.322255252, 0.321267951, 0.320478109, 0.319885728,
+        0.319490808, 0.319293347, 0.319293347, 0.317911125, 0.316726363, 0.315739062,
+        0.31494922, 0.314356839, 0.313961919, 0.313764458, 0.313764458, 0.312579696,
+        0.311592395, 0.310802553, 0.310210172, 0.309815252, 0.309617791, 0.309617791,
+        0.30863049, 0.307840649, 0.307248268, 0.306853347, 0.306655887, 0.306655887,
+        0.305866045, 0.305273664, 0.304878744, 0.304681283, 0.304681283, 0.304088902,
+        0.303693982, 0.303496521, 0.303496521, 0.303101601, 0.30290414, 0.30290414,
+        0.30270668, 0.30270668, 0.30270668, 0.301324458, 0.300139696, 0.299152394,
+        0.298362553, 0.297770172, 0.297375251, 0.297177791, 0.297177791, 0.295993029,
+        0.295005727, 0.294215886, 0.293623505, 0.293228584, 0.293031124, 0.293031124,
+        0.292043822, 0.291253981, 0.2906616, 0.29026668, 0.290069219, 0.290069219,
+        0.289279378, 0.288686997, 0.288292076, 0.288094616, 0.288094616, 0.287502235,
+        0.287107314, 0.286909854, 0.286909854, 0.286514933, 0.286317473, 0.286317473,
+        0.286120013, 0.286120013, 0.286120013, 0.284935251, 0.283947949, 0.283158108,
+        0.282565727, 0.282170806, 0.281973346, 0.281973346, 0.280986044, 0.280196203,
+        0.279603822, 0.279208901, 0.279011441, 0.279011441, 0.2782216, 0.277629219,
+        0.277234298, 0.277036838, 0.277036838, 0.276444457, 0.276049536, 0.275852076,
+        0.275852076, 0.275457155, 0.275259695, 0.275259695, 0.275062234, 0.275062234,
+        0.275062234, 0.274074933, 0.273285091, 0.27269271, 0.27229779, 0.272100329,
+        0.272100329, 0.271310488, 0.270718107, 0.270323187, 0.270125726, 0.270125726,
+        0.269533345, 0.269138425, 0.268940964, 0.268940964, 0.268546044, 0.268348583,
+        0.268348583, 0.268151123, 0.268151123, 0.268151123, 0.267361282, 0.266768901,
+        0.26637398, 0.26617652, 0.26617652, 0.265584139, 0.265189218, 0.264991758,
+        0.264991758, 0.264596837, 0.264399377, 0.264399377, 0.264201916, 0.264201916,
+        0.264201916, 0.263609535, 0.263214615, 0.263017154, 0.263017154, 0.262622234,
+        0.262424774, 0.262424774, 0.262227313, 0.262227313, 0.262227313, 0.261832393,
+        0.261634932, 0.261634932, 0.261437472, 0.261437472, 0.261437472, 0.261437472,
+        0.261437472, 0.261437472, 0.261437472, 0.26025271, 0.259067948, 0.258080646,
+        0.257290805, 0.256698424, 0.256303503, 0.256106043, 0.256106043, 0.254921281,
+        0.253933979, 0.253144138, 0.252551757, 0.252156837, 0.251959376, 0.251959376,
+        0.250972075, 0.250182233, 0.249589852, 0.249194932, 0.248997471, 0.248997471,
+        0.24820763, 0.247615249, 0.247220328, 0.247022868, 0.247022868, 0.246430487,
+        0.246035566, 0.245838106, 0.245838106, 0.245443185, 0.245245725, 0.245245725,
+        0.245048265, 0.245048265, 0.245048265, 0.243863503, 0.242876201, 0.24208636,
+        0.241493979, 0.241099058, 0.240901598, 0.240901598, 0.239914296, 0.239124455,
+        0.238532074, 0.238137153, 0.237939693, 0.237939693, 0.237149852, 0.236557471,
+        0.23616255, 0.23596509, 0.23596509, 0.235372709, 0.234977788, 0.234780328,
+        0.234780328, 0.234385407, 0.234187947, 0.234187947, 0.233990487, 0.233990487,
+        0.233990487, 0.233003185, 0.232213344, 0.231620963, 0.231226042, 0.231028582,
+        0.231028582, 0.23023874, 0.229646359, 0.229251439, 0.229053978, 0.229053978,
+        0.228461597, 0.228066677, 0.227869216, 0.227869216, 0.227474296, 0.227276835,
+        0.227276835, 0.227079375, 0.227079375, 0.227079375, 0.226289534, 0.225697153,
+        0.225302232, 0.225104772, 0.225104772, 0.224512391, 0.22411747, 0.22392001,
+        0.22392001, 0.223525089, 0.223327629, 0.223327629, 0.223130169, 0.223130169,
+        0.223130169, 0.222537788, 0.222142867, 0.221945407, 0.221945407, 0.221550486,
+        0.221353026, 0.221353026, 0.221155565, 0.221155565, 0.221155565, 0.220760645,
+        0.220563184, 0.220563184, 0.220365724, 0.220365724, 0.220365724, 0.220365724,
+        0.220365724, 0.220365724, 0.220365724, 0.219378422, 0.218391121, 0.217601279,
+        0.217008898, 0.216613978, 0.216416518, 0.216416518, 0.215429216, 0.214639375,
+        0.214046994, 0.213652073, 0.213454613, 0.213454613, 0.212664771, 0.21207239,
+        0.21167747, 0.211480009, 0.211480009, 0.210887628, 0.210492708, 0.210295247,
+        0.210295247, 0.209900327, 0.209702866, 0.209702866, 0.209505406, 0.209505406,
+        0.209505406, 0.208518104, 0.207728263, 0.207135882, 0.206740962, 0.206543501,
+        0.206543501, 0.20575366, 0.205161279, 0.204766358, 0.204568898, 0.204568898,
+        0.203976517, 0.203581596, 0.203384136, 0.203384136, 0.202989215, 0.202791755,
+        0.202791755, 0.202594295, 0.202594295, 0.202594295, 0.201804453, 0.201212072,
+        0.200817152, 0.200619691, 0.200619691, 0.20002731, 0.19963239, 0.199434929,
+        0.199434929, 0.199040009, 0.198842548, 0.198842548, 0.198645088, 0.198645088,
+        0.198645088, 0.198052707, 0.197657787, 0.197460326, 0.197460326, 0.197065406,
+        0.196867945, 0.196867945, 0.196670485, 0.196670485, 0.196670485, 0.196275564,
+        0.196078104, 0.196078104, 0.195880644, 0.195880644, 0.195880644, 0.195880644,
+        0.195880644, 0.195880644, 0.195880644, 0.195090802, 0.194300961, 0.19370858,
+        0.193313659, 0.193116199, 0.193116199, 0.192326358, 0.191733977, 0.191339056,
+        0.191141596, 0.191141596, 0.190549215, 0.190154294, 0.189956834, 0.189956834,
+        0.189561913, 0.189364453, 0.189364453, 0.189166992, 0.189166992, 0.189166992,
+        0.188377151, 0.18778477, 0.18738985, 0.187192389, 0.187192389, 0.186600008,
+        0.186205088, 0.186007627, 0.186007627, 0.185612707, 0.185415246, 0.185415246,
+        0.185217786, 0.185217786, 0.185217786, 0.184625405, 0.184230484, 0.184033024,
+        0.184033024, 0.183638103, 0.183440643, 0.183440643, 0.183243183, 0.183243183,
+        0.183243183, 0.182848262, 0.182650802, 0.182650802, 0.182453341, 0.182453341,
+        0.182453341, 0.182453341, 0.182453341, 0.182453341, 0.182453341, 0.18186096,
+        0.181268579, 0.180873659, 0.180676198, 0.180676198, 0.180083817, 0.179688897,
+        0.179491437, 0.179491437, 0.179096516, 0.178899056, 0.178899056, 0.178701595,
+        0.178701595, 0.178701595, 0.178109214, 0.177714294, 0.177516833, 0.177516833,
+        0.177121913, 0.176924452, 0.176924452, 0.176726992, 0.176726992, 0.176726992,
+        0.176332071, 0.176134611, 0.176134611, 0.175937151, 0.175937151, 0.175937151,
+        0.175937151, 0.175937151, 0.175937151, 0.175937151, 0.17554223, 0.175147309,
+        0.174949849, 0.174949849, 0.174554928, 0.174357468, 0.174357468, 0.174160008,
+        0.174160008, 0.174160008, 0.173765087, 0.173567627, 0.173567627, 0.173370166,
+        0.173370166, 0.173370166, 0.173370166, 0.173370166, 0.173370166, 0.173370166,
+        0.173172706, 0.172975246, 0.172975246, 0.172777785, 0.172777785, 0.172777785,
+        0.172777785, 0.172777785, 0.172777785, 0.172777785, 0.172777785, 0.172777785,
+        0.172777785, 0.172777785, 0.171593023, 0.170605722, 0.169815881, 0.1692235,
+        0.168828579, 0.168631119, 0.168631119, 0.167446357, 0.166459055, 0.165669214,
+        0.165076833, 0.164681912, 0.164484452, 0.164484452, 0.16349715, 0.162707309,
+        0.162114928, 0.161720007, 0.161522547, 0.161522547, 0.160732706, 0.160140325,
+        0.159745404, 0.159547944, 0.159547944, 0.158955563, 0.158560642, 0.158363182,
+        0.158363182, 0.157968261, 0.157770801, 0.157770801, 0.15757334, 0.15757334,
+        0.15757334, 0.156388578, 0.155401277, 0.154611435, 0.154019054, 0.153624134,
+        0.153426673, 0.153426673, 0.152439372, 0.151649531, 0.15105715, 0.150662229,
+        0.150464769, 0.150464769, 0.149674927, 0.149082546, 0.148687626, 0.148490165,
+        0.148490165, 0.147897784, 0.147502864, 0.147305403, 0.147305403, 0.146910483,
+        0.146713022, 0.146713022, 0.146515562, 0.146515562, 0.146515562, 0.14552826,
+        0.144738419, 0.144146038, 0.143751117, 0.143553657, 0.143553657, 0.142763816,
+        0.142171435, 0.141776514, 0.141579054, 0.141579054, 0.140986673, 0.140591752,
+        0.140394292, 0.140394292, 0.139999371, 0.139801911, 0.139801911, 0.139604451,
+        0.139604451, 0.139604451, 0.138814609, 0.138222228, 0.137827308, 0.137629847,
+        0.137629847, 0.137037466, 0.136642546, 0.136445085, 0.136445085, 0.136050165,
+        0.135852704, 0.135852704, 0.135655244, 0.135655244, 0.135655244, 0.135062863,
+        0.134667942, 0.134470482, 0.134470482, 0.134075561, 0.133878101, 0.133878101,
+        0.133680641, 0.133680641, 0.133680641, 0.13328572, 0.13308826, 0.13308826,
+        0.1328908, 0.1328908, 0.1328908, 0.132693339, 0.132693339, 0.132693339,
+        0.132693339, 0.131706038, 0.130718736, 0.129928895, 0.129336514, 0.128941593,
+        0.128744133, 0.128744133, 0.127756831, 0.12696699, 0.126374609, 0.125979688,
+        0.125782228, 0.125782228, 0.124992386, 0.124400006, 0.124005085, 0.123807625,
+        0.123807625, 0.123215244, 0.122820323, 0.122622863, 0.122622863, 0.122227942,
+        0.122030482, 0.122030482, 0.121833021, 0.121833021, 0.121833021, 0.12084572,
+        0.120055878, 0.119463497, 0.119068577, 0.118871116, 0.118871116, 0.118081275,
+        0.117488894, 0.117093973, 0.116896513, 0.116896513, 0.116304132, 0.115909211,
+        0.115711751, 0.115711751, 0.11531683, 0.11511937, 0.11511937, 0.11492191,
+        0.11492191, 0.11492191, 0.114132069, 0.113539688, 0.113144767, 0.112947307,
+        0.112947307, 0.112354926, 0.111960005, 0.111762545, 0.111762545, 0.111367624,
+        0.111170164, 0.111170164, 0.110972703, 0.110972703, 0.110972703, 0.110380322,
+        0.109985402, 0.109787941, 0.109787941, 0.109393021, 0.10919556, 0.10919556,
+        0.1089981, 0.1089981, 0.1089981, 0.108603179, 0.108405719, 0.108405719,
+        0.108208259, 0.108208259, 0.108208259, 0.108010798, 0.108010798, 0.108010798,
+        0.108010798, 0.107220957, 0.106431116, 0.105838735, 0.105443814, 0.105246354,
+        0.105246354, 0.104456513, 0.103864132, 0.103469211, 0.103271751, 0.103271751,
+        0.10267937, 0.102284449, 0.102086989, 0.102086989, 0.101692068, 0.101494608,
+        0.101494608, 0.101297147, 0.101297147, 0.101297147, 0.100507306, 0.0999149251,
+        0.0995200044, 0.0993225441, 0.0993225441, 0.0987301631, 0.0983352424, 0.0981377821,
+        0.0981377821, 0.0977428615, 0.0975454011, 0.0975454011, 0.0973479408, 0.0973479408,
+        0.0973479408, 0.0967555598, 0.0963606392, 0.0961631789, 0.0961631789, 0.0957682582,
+        0.0955707979, 0.0955707979, 0.0953733376, 0.0953733376, 0.0953733376, 0.0949784169,
+        0.0947809566, 0.0947809566, 0.0945834962, 0.0945834962, 0.0945834962, 0.0943860359,
+        0.0943860359, 0.0943860359, 0.0943860359, 0.0937936549, 0.093201274, 0.0928063533,
+        0.092608893, 0.092608893, 0.092016512, 0.0916215914, 0.091424131, 0.091424131,
+        0.0910292104, 0.09083175, 0.09083175, 0.0906342897, 0.0906342897, 0.0906342897,
+        0.0900419087, 0.0896469881, 0.0894495278, 0.0894495278, 0.0890546071, 0.0888571468,
+        0.0888571468, 0.0886596865, 0.0886596865, 0.0886596865, 0.0882647658, 0.0880673055,
+        0.0880673055, 0.0878698452, 0.0878698452, 0.0878698452, 0.0876723848, 0.0876723848,
+        0.0876723848, 0.0876723848, 0.0872774642, 0.0868825435, 0.0866850832, 0.0866850832,
+        0.0862901625, 0.0860927022, 0.0860927022, 0.0858952419, 0.0858952419, 0.0858952419,
+        0.0855003212, 0.0853028609, 0.0853028609, 0.0851054006, 0.0851054006, 0.0851054006,
+        0.0849079403, 0.0849079403, 0.0849079403, 0.0849079403, 0.0847104799, 0.0845130196,
+        0.0845130196, 0.0843155593, 0.0843155593, 0.0843155593, 0.084118099, 0.084118099,
+        0.084118099, 0.084118099, 0.084118099, 0.084118099, 0.084118099, 0.084118099,
+        0.084118099, 0.0831307973, 0.082340956, 0.081748575, 0.0813536544, 0.0811561941,
+        0.0811561941, 0.0801688924, 0.0793790511, 0.0787866702, 0.0783917495, 0.0781942892,
+        0.0781942892, 0.0774044479, 0.0768120669, 0.0764171462, 0.0762196859, 0.0762196859,
+        0.0756273049, 0.0752323843, 0.075034924, 0.075034924, 0.0746400033, 0.074442543,
+        0.074442543, 0.0742450826, 0.0742450826, 0.0742450826, 0.073257781, 0.0724679397,
+        0.0718755587, 0.0714806381, 0.0712831778, 0.0712831778, 0.0704933365, 0.0699009555,
+        0.0695060348, 0.0693085745, 0.0693085745, 0.0687161935, 0.0683212729, 0.0681238125,
+        0.0681238125, 0.0677288919, 0.0675314316, 0.0675314316, 0.0673339712, 0.0673339712,
+        0.0673339712, 0.0665441299, 0.0659517489, 0.0655568283, 0.065359368, 0.065359368,
+        0.064766987, 0.0643720663, 0.064174606, 0.064174606, 0.0637796854, 0.063582225,
+        0.063582225, 0.0633847647, 0.0633847647, 0.0633847647, 0.0627923837, 0.0623974631,
+        0.0622000028, 0.0622000028, 0.0618050821, 0.0616076218, 0.0616076218, 0.0614101614,
+        0.0614101614, 0.0614101614, 0.0610152408, 0.0608177805, 0.0608177805, 0.0606203201,
+        0.0606203201, 0.0606203201, 0.0604228598, 0.0604228598, 0.0604228598, 0.0604228598,
+        0.0596330185, 0.0588431772, 0.0582507962, 0.0578558756, 0.0576584152, 0.0576584152,
+        0.0568685739, 0.056276193, 0.0558812723, 0.055683812, 0.055683812, 0.055091431,
+        0.0546965104, 0.05449905, 0.05449905, 0.0541041294, 0.0539066691, 0.0539066691,
+        0.0537092087, 0.0537092087, 0.0537092087, 0.0529193674, 0.0523269864, 0.0519320658,
+        0.0517346055, 0.0517346055, 0.0511422245, 0.0507473038, 0.0505498435, 0.0505498435,
+        0.0501549229, 0.0499574625, 0.0499574625, 0.0497600022, 0.0497600022, 0.0497600022,
+        0.0491676212, 0.0487727006, 0.0485752402, 0.0485752402, 0.0481803196, 0.0479828593,
+        0.0479828593, 0.0477853989, 0.0477853989, 0.0477853989, 0.0473904783, 0.047193018,
+        0.047193018, 0.0469955576, 0.0469955576, 0.0469955576, 0.0467980973, 0.0467980973,
+        0.0467980973, 0.0467980973, 0.0462057163, 0.0456133354, 0.0452184147, 0.0450209544,
+        0.0450209544, 0.0444285734, 0.0440336527, 0.0438361924, 0.0438361924, 0.0434412718,
+        0.0432438114, 0.0432438114, 0.0430463511, 0.0430463511, 0.0430463511, 0.0424539701,
+        0.0420590495, 0.0418615892, 0.0418615892, 0.0414666685, 0.0412692082, 0.0412692082,
+        0.0410717478, 0.0410717478, 0.0410717478, 0.0406768272, 0.0404793669, 0.0404793669,
+        0.0402819065, 0.0402819065, 0.0402819065, 0.0400844462, 0.0400844462, 0.0400844462,
+        0.0400844462, 0.0396895256, 0.0392946049, 0.0390971446, 0.0390971446, 0.0387022239,
+        0.0385047636, 0.0385047636, 0.0383073033, 0.0383073033, 0.0383073033, 0.0379123826,
+        0.0377149223, 0.0377149223, 0.037517462, 0.037517462, 0.037517462, 0.0373200017,
+        0.0373200017, 0.0373200017, 0.0373200017, 0.0371225413, 0.036925081, 0.036925081,
+        0.0367276207, 0.0367276207, 0.0367276207, 0.0365301603, 0.0365301603, 0.0365301603,
+        0.0365301603, 0.0365301603, 0.0365301603, 0.0365301603, 0.0365301603, 0.0365301603,
+        0.035740319, 0.0351479381, 0.0347530174, 0.0345555571, 0.0345555571, 0.0337657158,
+        0.0331733348, 0.0327784141, 0.0325809538, 0.0325809538, 0.0319885728, 0.0315936522,
+        0.0313961919, 0.0313961919, 0.0310012712, 0.0308038109, 0.0308038109, 0.0306063506,
+        0.0306063506, 0.0306063506, 0.0298165093, 0.0292241283, 0.0288292076, 0.0286317473,
+        0.0286317473, 0.0280393663, 0.0276444457, 0.0274469853, 0.0274469853, 0.0270520647,
+        0.0268546044, 0.0268546044, 0.026657144, 0.026657144, 0.026657144, 0.0260647631,
+        0.0256698424, 0.0254723821, 0.0254723821, 0.0250774614, 0.0248800011, 0.0248800011,
+        0.0246825408, 0.0246825408, 0.0246825408, 0.0242876201, 0.0240901598, 0.0240901598,
+        0.0238926995, 0.0238926995, 0.0238926995, 0.0236952391, 0.0236952391, 0.0236952391,
+        0.0236952391, 0.0231028582, 0.0225104772, 0.0221155565, 0.0219180962, 0.0219180962,
+        0.0213257152, 0.0209307946, 0.0207333343, 0.0207333343, 0.0203384136, 0.0201409533,
+        0.0201409533, 0.0199434929, 0.0199434929, 0.0199434929, 0.019351112, 0.0189561913,
+        0.018758731, 0.018758731, 0.0183638103, 0.01816635, 0.01816635, 0.0179688897,
+        0.0179688897, 0.0179688897, 0.017573969, 0.0173765087, 0.0173765087, 0.0171790484,
+        0.0171790484, 0.0171790484, 0.0169815881, 0.0169815881, 0.0169815881, 0.0169815881,
+        0.0165866674, 0.0161917467, 0.0159942864, 0.0159942864, 0.0155993658, 0.0154019054,
+        0.0154019054, 0.0152044451, 0.0152044451, 0.0152044451, 0.0148095245, 0.0146120641,
+        0.0146120641, 0.0144146038, 0.0144146038, 0.0144146038, 0.0142171435, 0.0142171435,
+        0.0142171435, 0.0142171435, 0.0140196832, 0.0138222228, 0.0138222228, 0.0136247625,
+        0.0136247625, 0.0136247625, 0.0134273022, 0.0134273022, 0.0134273022, 0.0134273022,
+        0.0134273022, 0.0134273022, 0.0134273022, 0.0134273022, 0.0134273022, 0.0128349212,
+        0.0124400006, 0.0122425402, 0.0122425402, 0.0116501592, 0.0112552386, 0.0110577783,
+        0.0110577783, 0.0106628576, 0.0104653973, 0.0104653973, 0.010267937, 0.010267937,
+        0.010267937, 0.00967555598, 0.00928063533, 0.009083175, 0.009083175, 0.00868825435,
+        0.00849079403, 0.00849079403, 0.0082933337, 0.0082933337, 0.0082933337, 0.00789841305,
+        0.00770095272, 0.00770095272, 0.0075034924, 0.0075034924, 0.0075034924, 0.00730603207,
+        0.00730603207, 0.00730603207, 0.00730603207, 0.00691111142, 0.00651619076, 0.00631873044,
+        0.00631873044, 0.00592380979, 0.00572634946, 0.00572634946, 0.00552888913, 0.00552888913,
+        0.00552888913, 0.00513396848, 0.00493650815, 0.00493650815, 0.00473904783, 0.00473904783,
+        0.00473904783, 0.0045415875, 0.0045415875, 0.0045415875, 0.0045415875, 0.00434412718,
+        0.00414666685, 0.00414666685, 0.00394920652, 0.00394920652, 0.00394920652, 0.0037517462,
+        0.0037517462, 0.0037517462, 0.0037517462, 0.0037517462, 0.0037517462, 0.0037517462,
+        0.0037517462, 0.0037517462, 0.00335682555, 0.00315936522, 0.00315936522, 0.00276444457,
+        0.00256698424, 0.00256698424, 0.00236952391, 0.00236952391, 0.00236952391, 0.00197460326,
+        0.00177714294, 0.00177714294, 0.00157968261, 0.00157968261, 0.00157968261, 0.00138222228,
+        0.00138222228, 0.00138222228, 0.00138222228, 0.00118476196, 0.000987301631, 0.000987301631,
+        0.000789841305, 0.000789841305, 0.000789841305, 0.000592380979, 0.000592380979, 0.000592380979,
+        0.000592380979, 0.000592380979, 0.000592380979, 0.000592380979, 0.000592380979, 0.000592380979,
+        0.000394920652, 0.000394920652, 0.000197460326, 0.000197460326, 0.000197460326, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+    },
+    /* 7 cards */
+    {
+        0, 1, 0.999967679, 0.999936734, 0.999905789, 0.999874844,
+        0.999843898, 0.999812953, 0.999782008, 0.999751062, 0.999720117, 0.999689172,
+        0.999658884, 0.999633739, 0.999613259, 0.999596964, 0.999584377, 0.999575018,
+        0.999568411, 0.999564075, 0.999561534, 0.999560308, 0.999559919, 0.999559889,
+        0.999529602, 0.999504457, 0.999483976, 0.999467681, 0.999455094, 0.999445736,
+        0.999439128, 0.999434793, 0.999432251, 0.999431026, 0.999430637, 0.999430607,
+        0.999400319, 0.999375175, 0.999354694, 0.999338399, 0.999325812, 0.999316453,
+        0.999309846, 0.99930551, 0.999302969, 0.999301743, 0.999301354, 0.999301324,
+        0.999271037, 0.999245892, 0.999225411, 0.999209117, 0.999196529, 0.999187171,
+        0.999180563, 0.999176228, 0.999173686, 0.999172461, 0.999172072, 0.999172042,
+        0.999141754, 0.99911661, 0.999096129, 0.999079834, 0.999067247, 0.999057888,
+        0.999051281, 0.999046945, 0.999044404, 0.999043178, 0.999042789, 0.999042759,
+        0.999012472, 0.998987327, 0.998966846, 0.998950552, 0.998937964, 0.998928606,
+        0.998921998, 0.998917663, 0.998915121, 0.998913896, 0.998913507, 0.998913477,
+        0.99888319, 0.998858045, 0.998837564, 0.998821269, 0.998808682, 0.998799323,
+        0.998792716, 0.99878838, 0.998785839, 0.998784613, 0.998784224, 0.998784195,
+        0.998753907, 0.998728762, 0.998708281, 0.998691987, 0.998679399, 0.998670041,
+        0.998663433, 0.998659098, 0.998656556, 0.998655331, 0.998654942, 0.998654912,
+        0.998624625, 0.99859948, 0.998578999, 0.998562704, 0.998550117, 0.998540758,
+        0.998534151, 0.998529815, 0.998527274, 0.998526048, 0.998525659, 0.99852563,
+        0.998495342, 0.998470197, 0.998449716, 0.998433422, 0.998420834, 0.998411476,
+        0.998404868, 0.998400533, 0.998397992, 0.998396766, 0.998396377, 0.998396347,
+        0.99836606, 0.998340915, 0.998320434, 0.998304139, 0.998291552, 0.998282193,
+        0.998275586, 0.99827125, 0.998268709, 0.998267483, 0.998267094, 0.998267065,
+        0.998236777, 0.998211632, 0.998191152, 0.998174857, 0.998162269, 0.998152911,
+        0.998146303, 0.998141968, 0.998139427, 0.998138201, 0.998137812, 0.998137782,
+        0.998107495, 0.99808235, 0.998061869, 0.998045574, 0.998032987, 0.998023628,
+        0.998017021, 0.998012685, 0.998010144, 0.998008918, 0.99800853, 0.9980085,
+        0.997833532, 0.99765964, 0.997486825, 0.997315086, 0.997144424, 0.996974838,
+        0.996806328, 0.996638895, 0.996472538, 0.996307257, 0.996143053, 0.995979925,
+        0.995810219, 0.995636328, 0.995463512, 0.995291774, 0.995121111, 0.994951525,
+        0.994783015, 0.994615582, 0.994449225, 0.994283944, 0.99411974, 0.993956612,
+        0.993786906, 0.993618277, 0.993445462, 0.993273723, 0.993103061, 0.992933475,
+        0.992764965, 0.992597531, 0.992431174, 0.992265894, 0.992101689, 0.991938562,
+        0.991768856, 0.991600227, 0.991432674, 0.991260935, 0.991090272, 0.990920686,
+        0.990752176, 0.990584743, 0.990418386, 0.990253105, 0.990088901, 0.989925773,
+        0.989756068, 0.989587438, 0.989419885, 0.989253409, 0.989082746, 0.98891316,
+        0.98874465, 0.988577217, 0.98841086, 0.988245579, 0.988081375, 0.987918247,
+        0.987748541, 0.987579912, 0.987412359, 0.987245882, 0.987080482, 0.986910896,
+        0.986742386, 0.986574953, 0.986408596, 0.986243315, 0.986079111, 0.985915983,
+        0.985746277, 0.985577648, 0.985410095, 0.985243619, 0.985078218, 0.984913894,
+        0.984745385, 0.984577951, 0.984411594, 0.984246314, 0.984082109, 0.983918981,
+        0.983749276, 0.983580646, 0.983413093, 0.983246617, 0.983081217, 0.982916893,
+        0.982753645, 0.982586212, 0.982419855, 0.982254574, 0.98209037, 0.981927242,
+        0.981757536, 0.981588907, 0.981421354, 0.981254877, 0.981089477, 0.980925153,
+        0.980761906, 0.980599734, 0.980433377, 0.980268097, 0.980103892, 0.979940764,
+        0.979771059, 0.979602429, 0.979434876, 0.9792684, 0.979103, 0.978938676,
+        0.978775428, 0.978613257, 0.978452162, 0.978286882, 0.978122677, 0.977959549,
+        0.977789844, 0.977621214, 0.977453661, 0.977287185, 0.977121784, 0.976957461,
+        0.976794213, 0.976632042, 0.976470947, 0.976310929, 0.976146724, 0.975983596,
+        0.975813891, 0.975645261, 0.975477708, 0.975311232, 0.975145831, 0.974981508,
+        0.97481826, 0.974656089, 0.974494994, 0.974334976, 0.974176033, 0.974012906,
+        0.9738432, 0.973674571, 0.973507018, 0.973340541, 0.973175141, 0.973010817,
+        0.972847569, 0.972685398, 0.972524303, 0.972364285, 0.972205343, 0.972047477,
+        0.972016532, 0.971986932, 0.971958648, 0.971931649, 0.971905906, 0.971881389,
+        0.971858068, 0.971835913, 0.971804968, 0.971775368, 0.971747084, 0.971720085,
+        0.971694342, 0.971669825, 0.971646504, 0.971624349, 0.971594749, 0.971566465,
+        0.971539466, 0.971513723, 0.971489206, 0.971465885, 0.97144373, 0.971415446,
+        0.971388447, 0.971362704, 0.971338187, 0.971314866, 0.971292711, 0.971265713,
+        0.97123997, 0.971215453, 0.971192132, 0.971169977, 0.971144234, 0.971119717,
+        0.971096396, 0.971074241, 0.971049753, 0.971026432, 0.971004277, 0.970980956,
+        0.970958801, 0.970936646, 0.970905731, 0.970876131, 0.970847847, 0.970820848,
+        0.970795105, 0.970770588, 0.970747267, 0.970725112, 0.970695512, 0.970667228,
+        0.970640229, 0.970614486, 0.970589969, 0.970566648, 0.970544493, 0.970516209,
+        0.97048921, 0.970463468, 0.970438951, 0.970415629, 0.970393474, 0.970366476,
+        0.970340733, 0.970316216, 0.970292895, 0.97027074, 0.970244997, 0.97022048,
+        0.970197159, 0.970175004, 0.970150517, 0.970127196, 0.970105041, 0.970081719,
+        0.970059564, 0.970037409, 0.970007839, 0.969979555, 0.969952557, 0.969926814,
+        0.969902297, 0.969878976, 0.969856821, 0.969828536, 0.969801538, 0.969775795,
+        0.969751278, 0.969727957, 0.969705802, 0.969678803, 0.96965306, 0.969628543,
+        0.969605222, 0.969583067, 0.969557324, 0.969532807, 0.969509486, 0.969487331,
+        0.969462844, 0.969439523, 0.969417368, 0.969394047, 0.969371892, 0.969349737,
+        0.969321482, 0.969294484, 0.969268741, 0.969244224, 0.969220903, 0.969198748,
+        0.969171749, 0.969146006, 0.969121489, 0.969098168, 0.969076013, 0.96905027,
+        0.969025753, 0.969002432, 0.968980277, 0.96895579, 0.968932469, 0.968910314,
+        0.968886993, 0.968864838, 0.968842683, 0.968815714, 0.968789971, 0.968765454,
+        0.968742133, 0.968719978, 0.968694235, 0.968669718, 0.968646397, 0.968624242,
+        0.968599755, 0.968576434, 0.968554279, 0.968530958, 0.968508803, 0.968486647,
+        0.968460935, 0.968436417, 0.968413096, 0.968390941, 0.968366454, 0.968343133,
+        0.968320978, 0.968297657, 0.968275502, 0.968253347, 0.96822886, 0.968205539,
+        0.968183384, 0.968160063, 0.968137908, 0.968115753, 0.968093598, 0.968071443,
+        0.968049288, 0.968027133, 0.967997533, 0.967967933, 0.967939649, 0.96791265,
+        0.967886907, 0.96786239, 0.967839069, 0.967816914, 0.967787314, 0.96775903,
+        0.967732031, 0.967706288, 0.967681771, 0.96765845, 0.967636295, 0.967608011,
+        0.967581012, 0.967555269, 0.967530752, 0.967507431, 0.967485276, 0.967458278,
+        0.967432535, 0.967408018, 0.967384697, 0.967362542, 0.967336799, 0.967312282,
+        0.967288961, 0.967266806, 0.967242319, 0.967218997, 0.967196842, 0.967173521,
+        0.967151366, 0.967129211, 0.967099641, 0.967071357, 0.967044358, 0.967018616,
+        0.966994099, 0.966970777, 0.966948622, 0.966920338, 0.96689334, 0.966867597,
+        0.96684308, 0.966819759, 0.966797604, 0.966770605, 0.966744862, 0.966720345,
+        0.966697024, 0.966674869, 0.966649126, 0.966624609, 0.966601288, 0.966579133,
+        0.966554646, 0.966531325, 0.96650917, 0.966485849, 0.966463694, 0.966441539,
+        0.966413284, 0.966386286, 0.966360543, 0.966336026, 0.966312705, 0.96629055,
+        0.966263551, 0.966237808, 0.966213291, 0.96618997, 0.966167815, 0.966142072,
+        0.966117555, 0.966094234, 0.966072079, 0.966047592, 0.966024271, 0.966002116,
+        0.965978795, 0.96595664, 0.965934485, 0.965907516, 0.965881773, 0.965857256,
+        0.965833935, 0.96581178, 0.965786037, 0.96576152, 0.965738199, 0.965716044,
+        0.965691557, 0.965668236, 0.965646081, 0.965622759, 0.965600604, 0.965578449,
+        0.965552736, 0.965528219, 0.965504898, 0.965482743, 0.965458256, 0.965434935,
+        0.96541278, 0.965389459, 0.965367304, 0.965345149, 0.965320662, 0.965297341,
+        0.965275186, 0.965251865, 0.96522971, 0.965207555, 0.9651854, 0.965163245,
+        0.96514109, 0.965118935, 0.96509065, 0.965062366, 0.965035367, 0.965009624,
+        0.964985107, 0.964961786, 0.964939631, 0.964911347, 0.964884348, 0.964858606,
+        0.964834088, 0.964810767, 0.964788612, 0.964761614, 0.964735871, 0.964711354,
+        0.964688033, 0.964665878, 0.964640135, 0.964615618, 0.964592297, 0.964570142,
+        0.964545655, 0.964522334, 0.964500178, 0.964476857, 0.964454702, 0.964432547,
+        0.964404293, 0.964377294, 0.964351551, 0.964327034, 0.964303713, 0.964281558,
+        0.96425456, 0.964228817, 0.9642043, 0.964180979, 0.964158824, 0.964133081,
+        0.964108564, 0.964085243, 0.964063088, 0.964038601, 0.964015279, 0.963993124,
+        0.963969803, 0.963947648, 0.963925493, 0.963898525, 0.963872782, 0.963848265,
+        0.963824944, 0.963802789, 0.963777046, 0.963752529, 0.963729208, 0.963707053,
+        0.963682565, 0.963659244, 0.963637089, 0.963613768, 0.963591613, 0.963569458,
+        0.963543745, 0.963519228, 0.963495907, 0.963473752, 0.963449265, 0.963425944,
+        0.963403789, 0.963380468, 0.963358313, 0.963336158, 0.963311671, 0.96328835,
+        0.963266195, 0.963242873, 0.963220718, 0.963198563, 0.963176408, 0.963154253,
+        0.963132098, 0.963109943, 0.963082945, 0.963055946, 0.963030203, 0.963005686,
+        0.962982365, 0.96296021, 0.962933211, 0.962907469, 0.962882952, 0.96285963,
+        0.962837475, 0.962811733, 0.962787216, 0.962763894, 0.962741739, 0.962717252,
+        0.962693931, 0.962671776, 0.962648455, 0.9626263, 0.962604145, 0.962577176,
+        0.962551433, 0.962526916, 0.962503595, 0.96248144, 0.962455697, 0.96243118,
+        0.962407859, 0.962385704, 0.962361217, 0.962337896, 0.962315741, 0.96229242,
+        0.962270265, 0.96224811, 0.962222397, 0.96219788, 0.962174559, 0.962152404,
+        0.962127917, 0.962104596, 0.962082441, 0.96205912, 0.962036965, 0.962014809,
+        0.961990322, 0.961967001, 0.961944846, 0.961921525, 0.96189937, 0.961877215,
+        0.96185506, 0.961832905, 0.96181075, 0.961788595, 0.961762852, 0.961737109,
+        0.961712592, 0.961689271, 0.961667116, 0.961641373, 0.961616856, 0.961593535,
+        0.96157138, 0.961546893, 0.961523572, 0.961501417, 0.961478096, 0.961455941,
+        0.961433786, 0.961408073, 0.961383556, 0.961360235, 0.96133808, 0.961313593,
+        0.961290271, 0.961268116, 0.961244795, 0.96122264, 0.961200485, 0.961175998,
+        0.961152677, 0.961130522, 0.961107201, 0.961085046, 0.961062891, 0.961040736,
+        0.961018581, 0.960996426, 0.960974271, 0.960949754, 0.960925237, 0.960901916,
+        0.960879761, 0.960855274, 0.960831953, 0.960809797, 0.960786476, 0.960764321,
+        0.960742166, 0.960717679, 0.960694358, 0.960672203, 0.960648882, 0.960626727,
+        0.960604572, 0.960582417, 0.960560262, 0.960538107, 0.960515952, 0.960492631,
+        0.96046931, 0.960447155, 0.960423834, 0.960401679, 0.960379524, 0.960357369,
+        0.960335214, 0.960313059, 0.960290904, 0.960268749, 0.960246593, 0.960224438,
+        0.960202283, 0.960172684, 0.960144399, 0.960117401, 0.960091658, 0.960067141,
+        0.96004382, 0.960021665, 0.959992065, 0.959963781, 0.959936782, 0.959911039,
+        0.959886522, 0.959863201, 0.959841046, 0.959812762, 0.959785763, 0.95976002,
+        0.959735503, 0.959712182, 0.959690027, 0.959663028, 0.959637285, 0.959612768,
+        0.959589447, 0.959567292, 0.959541549, 0.959517032, 0.959493711, 0.959471556,
+        0.959447039, 0.959423718, 0.959401563, 0.959378242, 0.959356087, 0.959333932,
+        0.959304362, 0.959276078, 0.959249079, 0.959223336, 0.959198819, 0.959175498,
+        0.959153343, 0.959125059, 0.95909806, 0.959072317, 0.9590478, 0.959024479,
+        0.959002324, 0.958975326, 0.958949583, 0.958925066, 0.958901745, 0.95887959,
+        0.958853847, 0.95882933, 0.958806009, 0.958783854, 0.958759337, 0.958736016,
+        0.958713861, 0.958690539, 0.958668384, 0.958646229, 0.958617975, 0.958590976,
+        0.958565234, 0.958540717, 0.958517395, 0.95849524, 0.958468242, 0.958442499,
+        0.958417982, 0.958394661, 0.958372506, 0.958346763, 0.958322246, 0.958298925,
+        0.95827677, 0.958252253, 0.958228932, 0.958206777, 0.958183456, 0.958161301,
+        0.958139146, 0.958112177, 0.958086434, 0.958061917, 0.958038596, 0.958016441,
+        0.957990698, 0.957966181, 0.95794286, 0.957920705, 0.957896188, 0.957872867,
+        0.957850712, 0.957827391, 0.957805236, 0.95778308, 0.957757368, 0.95773285,
+        0.957709529, 0.957687374, 0.957662857, 0.957639536, 0.957617381, 0.95759406,
+        0.957571905, 0.95754975, 0.957525263, 0.957501942, 0.957479787, 0.957456466,
+        0.957434311, 0.957412156, 0.957388835, 0.95736668, 0.957344525, 0.95732237,
+        0.957294085, 0.957265801, 0.957238802, 0.95721306, 0.957188543, 0.957165221,
+        0.957143066, 0.957114782, 0.957087784, 0.957062041, 0.957037524, 0.957014203,
+        0.956992048, 0.956965049, 0.956939306, 0.956914789, 0.956891468, 0.956869313,
+        0.95684357, 0.956819053, 0.956795732, 0.956773577, 0.95674906, 0.956725739,
+        0.956703584, 0.956680263, 0.956658108, 0.956635953, 0.956607698, 0.9565807,
+        0.956554957, 0.95653044, 0.956507119, 0.956484964, 0.956457965, 0.956432222,
+        0.956407705, 0.956384384, 0.956362229, 0.956336486, 0.956311969, 0.956288648,
+        0.956266493, 0.956241976, 0.956218655, 0.9561965, 0.956173179, 0.956151024,
+        0.956128869, 0.9561019, 0.956076157, 0.95605164, 0.956028319, 0.956006164,
+        0.955980421, 0.955955904, 0.955932583, 0.955910428, 0.955885911, 0.95586259,
+        0.955840435, 0.955817114, 0.955794959, 0.955772804, 0.955747091, 0.955722574,
+        0.955699253, 0.955677098, 0.955652581, 0.955629259, 0.955607104, 0.955583783,
+        0.955561628, 0.955539473, 0.955514986, 0.955491665, 0.95546951, 0.955446189,
+        0.955424034, 0.955401879, 0.955378558, 0.955356403, 0.955334248, 0.955312093,
+        0.955285094, 0.955258096, 0.955232353, 0.955207836, 0.955184515, 0.95516236,
+        0.955135361, 0.955109618, 0.955085101, 0.95506178, 0.955039625, 0.955013882,
+        0.954989365, 0.954966044, 0.954943889, 0.954919372, 0.954896051, 0.954873896,
+        0.954850575, 0.95482842, 0.954806265, 0.954779296, 0.954753553, 0.954729036,
+        0.954705715, 0.95468356, 0.954657817, 0.9546333, 0.954609979, 0.954587824,
+        0.954563307, 0.954539986, 0.954517831, 0.95449451, 0.954472355, 0.9544502,
+        0.954424487, 0.95439997, 0.954376649, 0.954354494, 0.954329976, 0.954306655,
+        0.9542845, 0.954261179, 0.954239024, 0.954216869, 0.954192382, 0.954169061,
+        0.954146906, 0.954123585, 0.95410143, 0.954079275, 0.954055954, 0.954033799,
+        0.954011644, 0.953989489, 0.953963746, 0.953938003, 0.953913486, 0.953890165,
+        0.95386801, 0.953842267, 0.95381775, 0.953794429, 0.953772274, 0.953747757,
+        0.953724436, 0.953702281, 0.95367896, 0.953656805, 0.95363465, 0.953608937,
+        0.95358442, 0.953561099, 0.953538944, 0.953514426, 0.953491105, 0.95346895,
+        0.953445629, 0.953423474, 0.953401319, 0.953376832, 0.953353511, 0.953331356,
+        0.953308035, 0.95328588, 0.953263725, 0.953240404, 0.953218249, 0.953196094,
+        0.953173939, 0.953149422, 0.953124905, 0.953101584, 0.953079429, 0.953054912,
+        0.95303159, 0.953009435, 0.952986114, 0.952963959, 0.952941804, 0.952917317,
+        0.952893996, 0.952871841, 0.95284852, 0.952826365, 0.95280421, 0.952780889,
+        0.952758734, 0.952736579, 0.952714424, 0.952691103, 0.952667782, 0.952645627,
+        0.952622306, 0.952600151, 0.952577996, 0.952554674, 0.952532519, 0.952510364,
+        0.952488209, 0.952466054, 0.952443899, 0.952421744, 0.952399589, 0.952377434,
+        0.95234915, 0.952322151, 0.952296408, 0.952271891, 0.95224857, 0.952226415,
+        0.952198131, 0.952171132, 0.95214539, 0.952120873, 0.952097551, 0.952075396,
+        0.952048398, 0.952022655, 0.951998138, 0.951974817, 0.951952662, 0.951926919,
+        0.951902402, 0.951879081, 0.951856926, 0.951832409, 0.951809088, 0.951786933,
+        0.951763612, 0.951741457, 0.951719302, 0.951691047, 0.951664049, 0.951638306,
+        0.951613789, 0.951590468, 0.951568313, 0.951541314, 0.951515571, 0.951491054,
+        0.951467733, 0.951445578, 0.951419835, 0.951395318, 0.951371997, 0.951349842,
+        0.951325325, 0.951302004, 0.951279849, 0.951256528, 0.951234373, 0.951212218,
+        0.951185249, 0.951159506, 0.951134989, 0.951111668, 0.951089513, 0.95106377,
+        0.951039253, 0.951015932, 0.950993777, 0.95096926, 0.950945939, 0.950923784,
+        0.950900463, 0.950878308, 0.950856153, 0.95083044, 0.950805923, 0.950782602,
+        0.950760446, 0.950735929, 0.950712608, 0.950690453, 0.950667132, 0.950644977,
+        0.950622822, 0.950598335, 0.950575014, 0.950552859, 0.950529538, 0.950507383,
+        0.950485228, 0.950461907, 0.950439752, 0.950417597, 0.950395442, 0.950368443,
+        0.950341444, 0.950315702, 0.950291185, 0.950267863, 0.950245708, 0.95021871,
+        0.950192967, 0.95016845, 0.950145129, 0.950122974, 0.950097231, 0.950072714,
+        0.950049393, 0.950027238, 0.950002721, 0.9499794, 0.949957245, 0.949933924,
+        0.949911769, 0.949889614, 0.949862645, 0.949836902, 0.949812385, 0.949789064,
+        0.949766909, 0.949741166, 0.949716649, 0.949693328, 0.949671173, 0.949646656,
+        0.949623335, 0.94960118, 0.949577859, 0.949555704, 0.949533549, 0.949507836,
+        0.949483319, 0.949459997, 0.949437842, 0.949413325, 0.949390004, 0.949367849,
+        0.949344528, 0.949322373, 0.949300218, 0.949275731, 0.94925241, 0.949230255,
+        0.949206934, 0.949184779, 0.949162624, 0.949139303, 0.949117148, 0.949094993,
+        0.949072838, 0.949047095, 0.949021352, 0.948996835, 0.948973514, 0.948951359,
+        0.948925616, 0.948901099, 0.948877778, 0.948855623, 0.948831106, 0.948807785,
+        0.94878563, 0.948762309, 0.948740154, 0.948717999, 0.948692286, 0.948667769,
+        0.948644447, 0.948622292, 0.948597775, 0.948574454, 0.948552299, 0.948528978,
+        0.948506823, 0.948484668, 0.948460181, 0.94843686, 0.948414705, 0.948391384,
+        0.948369229, 0.948347074, 0.948323753, 0.948301598, 0.948279443, 0.948257288,
+        0.948232771, 0.948208254, 0.948184933, 0.948162778, 0.94813826, 0.948114939,
+        0.948092784, 0.948069463, 0.948047308, 0.948025153, 0.948000666, 0.947977345,
+        0.94795519, 0.947931869, 0.947909714, 0.947887559, 0.947864238, 0.947842083,
+        0.947819928, 0.947797773, 0.947774452, 0.947751131, 0.947728976, 0.947705655,
+        0.9476835, 0.947661344, 0.947638023, 0.947615868, 0.947593713, 0.947571558,
+        0.947549403, 0.947527248, 0.947505093, 0.947482938, 0.947460783, 0.947433785,
+        0.947408042, 0.947383525, 0.947360204, 0.947338049, 0.94731105, 0.947285307,
+        0.94726079, 0.947237469, 0.947215314, 0.947189571, 0.947165054, 0.947141733,
+        0.947119578, 0.947095061, 0.94707174, 0.947049585, 0.947026264, 0.947004109,
+        0.946981954, 0.946954985, 0.946929242, 0.946904725, 0.946881404, 0.946859249,
+        0.946833506, 0.946808989, 0.946785668, 0.946763513, 0.946738996, 0.946715675,
+        0.94669352, 0.946670199, 0.946648044, 0.946625889, 0.946600176, 0.946575659,
+        0.946552338, 0.946530183, 0.946505666, 0.946482344, 0.946460189, 0.946436868,
+        0.946414713, 0.946392558, 0.946368071, 0.94634475, 0.946322595, 0.946299274,
+        0.946277119, 0.946254964, 0.946231643, 0.946209488, 0.946187333, 0.946165178,
+        0.946139435, 0.946113692, 0.946089175, 0.946065854, 0.946043699, 0.946017956,
+        0.945993439, 0.945970118, 0.945947963, 0.945923446, 0.945900125, 0.94587797,
+        0.945854649, 0.945832494, 0.945810339, 0.945784626, 0.945760109, 0.945736788,
+        0.945714633, 0.945690116, 0.945666794, 0.945644639, 0.945621318, 0.945599163,
+        0.945577008, 0.945552521, 0.9455292, 0.945507045, 0.945483724, 0.945461569,
+        0.945439414, 0.945416093, 0.945393938, 0.945371783, 0.945349628, 0.945325111,
+        0.945300594, 0.945277273, 0.945255118, 0.945230601, 0.94520728, 0.945185125,
+        0.945161803, 0.945139648, 0.945117493, 0.945093006, 0.945069685, 0.94504753,
+        0.945024209, 0.945002054, 0.944979899, 0.944956578, 0.944934423, 0.944912268,
+        0.944890113, 0.944866792, 0.944843471, 0.944821316, 0.944797995, 0.94477584,
+        0.944753685, 0.944730364, 0.944708208, 0.944686053, 0.944663898, 0.944641743,
+        0.944619588, 0.944597433, 0.944575278, 0.944553123, 0.94452738, 0.944502863,
+        0.944479542, 0.944457387, 0.944431644, 0.944407127, 0.944383806, 0.944361651,
+        0.944337134, 0.944313813, 0.944291658, 0.944268337, 0.944246182, 0.944224027,
+        0.944198314, 0.944173797, 0.944150476, 0.944128321, 0.944103804, 0.944080483,
+        0.944058328, 0.944035007, 0.944012852, 0.943990697, 0.94396621, 0.943942888,
+        0.943920733, 0.943897412, 0.943875257, 0.943853102, 0.943829781, 0.943807626,
+        0.943785471, 0.943763316, 0.943738799, 0.943714282, 0.943690961, 0.943668806,
+        0.943644289, 0.943620968, 0.943598813, 0.943575492, 0.943553337, 0.943531182,
+        0.943506695, 0.943483374, 0.943461219, 0.943437897, 0.943415742, 0.943393587,
+        0.943370266, 0.943348111, 0.943325956, 0.943303801, 0.94328048, 0.943257159,
+        0.943235004, 0.943211683, 0.943189528, 0.943167373, 0.943144052, 0.943121897,
+        0.943099742, 0.943077587, 0.943055432, 0.943033277, 0.943011122, 0.942988967,
+        0.942966812, 0.942942295, 0.942918974, 0.942896819, 0.942872302, 0.94284898,
+        0.942826825, 0.942803504, 0.942781349, 0.942759194, 0.942734707, 0.942711386,
+        0.942689231, 0.94266591, 0.942643755, 0.9426216, 0.942598279, 0.942576124,
+        0.942553969, 0.942531814, 0.942508493, 0.942485172, 0.942463017, 0.942439696,
+        0.942417541, 0.942395386, 0.942372064, 0.942349909, 0.942327754, 0.942305599,
+        0.942283444, 0.942261289, 0.942239134, 0.942216979, 0.942194824, 0.942171503,
+        0.942149348, 0.942126027, 0.942103872, 0.942081717, 0.942058396, 0.942036241,
+        0.942014086, 0.941991931, 0.941969776, 0.941947621, 0.941925466, 0.941903311,
+        0.941881156, 0.941859001, 0.941836846, 0.941814691, 0.941792536, 0.936201607,
+        0.931690174, 0.927178742, 0.922667309, 0.918155877, 0.913644444, 0.909133012,
+        0.90462158, 0.900110147, 0.895598715, 0.895265881, 0.894993563, 0.89478176,
+        0.894622907, 0.894509441, 0.894433797, 0.894388411, 0.894365718, 0.894358153,
+        0.894358153, 0.894358153, 0.894085835, 0.893874032, 0.893715179, 0.893601713,
+        0.893526069, 0.893480683, 0.893457989, 0.893450425, 0.893450425, 0.893450425,
+        0.893238622, 0.893079769, 0.892966303, 0.892890659, 0.892845273, 0.89282258,
+        0.892815015, 0.892815015, 0.892815015, 0.892656163, 0.892542697, 0.892467053,
+        0.892421667, 0.892398973, 0.892391409, 0.892391409, 0.892391409, 0.892277943,
+        0.892202299, 0.892156913, 0.892134219, 0.892126655, 0.892126655, 0.892126655,
+        0.892051011, 0.892005625, 0.891982931, 0.891975367, 0.891975367, 0.891975367,
+        0.891929981, 0.891907287, 0.891899723, 0.891899723, 0.891899723, 0.89187703,
+        0.891869465, 0.891869465, 0.891869465, 0.891869465, 0.891869465, 0.891869465,
+        0.891869465, 0.891869465, 0.891869465, 0.891536632, 0.891264313, 0.89105251,
+        0.890893658, 0.890780192, 0.890704548, 0.890659161, 0.890636468, 0.890628904,
+        0.890628904, 0.890628904, 0.89036415, 0.890152346, 0.889993494, 0.889880028,
+        0.889804384, 0.889758998, 0.889736304, 0.88972874, 0.88972874, 0.88972874,
+        0.889516937, 0.889358084, 0.889244618, 0.889168974, 0.889123588, 0.889100895,
+        0.88909333, 0.88909333, 0.88909333, 0.888934478, 0.888821012, 0.888745368,
+        0.888699982, 0.888677288, 0.888669724, 0.888669724, 0.888669724, 0.888556258,
+        0.888480614, 0.888435228, 0.888412534, 0.88840497, 0.88840497, 0.88840497,
+        0.888329326, 0.888283939, 0.888261246, 0.888253682, 0.888253682, 0.888253682,
+        0.888208295, 0.888185602, 0.888178038, 0.888178038, 0.888178038, 0.888155345,
+        0.88814778, 0.88814778, 0.88814778, 0.888140216, 0.888140216, 0.888140216,
+        0.888140216, 0.888140216, 0.888140216, 0.887807382, 0.887535064, 0.887323261,
+        0.887164408, 0.887050942, 0.886975298, 0.886929912, 0.886907219, 0.886899654,
+        0.886899654, 0.886899654, 0.8866349, 0.886423097, 0.886264245, 0.886150779,
+        0.886075135, 0.886029748, 0.886007055, 0.885999491, 0.885999491, 0.885999491,
+        0.885795252, 0.885636399, 0.885522933, 0.885447289, 0.885401903, 0.88537921,
+        0.885371645, 0.885371645, 0.885371645, 0.885212793, 0.885099327, 0.885023683,
+        0.884978296, 0.884955603, 0.884948039, 0.884948039, 0.884948039, 0.884834573,
+        0.884758929, 0.884713542, 0.884690849, 0.884683285, 0.884683285, 0.884683285,
+        0.884607641, 0.884562254, 0.884539561, 0.884531997, 0.884531997, 0.884531997,
+        0.88448661, 0.884463917, 0.884456353, 0.884456353, 0.884456353, 0.88443366,
+        0.884426095, 0.884426095, 0.884426095, 0.884418531, 0.884418531, 0.884418531,
+        0.884418531, 0.884418531, 0.884418531, 0.884085697, 0.883813379, 0.883601576,
+        0.883442723, 0.883329257, 0.883253613, 0.883208227, 0.883185534, 0.883177969,
+        0.883177969, 0.883177969, 0.882913215, 0.882701412, 0.882542559, 0.882429093,
+        0.882353449, 0.882308063, 0.88228537, 0.882277805, 0.882277805, 0.882277805,
+        0.882073567, 0.881914714, 0.881801248, 0.881725604, 0.881680218, 0.881657525,
+        0.88164996, 0.88164996, 0.88164996, 0.881498672, 0.881385206, 0.881309562,
+        0.881264176, 0.881241483, 0.881233918, 0.881233918, 0.881233918, 0.881120452,
+        0.881044808, 0.880999422, 0.880976729, 0.880969164, 0.880969164, 0.880969164,
+        0.88089352, 0.880848134, 0.880825441, 0.880817876, 0.880817876, 0.880817876,
+        0.88077249, 0.880749797, 0.880742232, 0.880742232, 0.880742232, 0.880719539,
+        0.880711975, 0.880711975, 0.880711975, 0.88070441, 0.88070441, 0.88070441,
+        0.88070441, 0.88070441, 0.88070441, 0.880371577, 0.880099258, 0.879887455,
+        0.879728602, 0.879615136, 0.879539492, 0.879494106, 0.879471413, 0.879463848,
+        0.879463848, 0.879463848, 0.879199094, 0.878987291, 0.878828439, 0.878714973,
+        0.878639329, 0.878593942, 0.878571249, 0.878563685, 0.878563685, 0.878563685,
+        0.878359446, 0.878200594, 0.878087128, 0.878011484, 0.877966097, 0.877943404,
+        0.87793584, 0.87793584, 0.87793584, 0.877784552, 0.877671086, 0.877595442,
+        0.877550055, 0.877527362, 0.877519798, 0.877519798, 0.877519798, 0.877413896,
+        0.877338252, 0.877292865, 0.877270172, 0.877262608, 0.877262608, 0.877262608,
+        0.877186964, 0.877141577, 0.877118884, 0.87711132, 0.87711132, 0.87711132,
+        0.877065933, 0.87704324, 0.877035676, 0.877035676, 0.877035676, 0.877012983,
+        0.877005418, 0.877005418, 0.877005418, 0.876997854, 0.876997854, 0.876997854,
+        0.876997854, 0.876997854, 0.876997854, 0.876657456, 0.876385137, 0.876173334,
+        0.876014482, 0.875901016, 0.875825372, 0.875779985, 0.875757292, 0.875749728,
+        0.875749728, 0.875749728, 0.875484974, 0.875273171, 0.875114318, 0.875000852,
+        0.874925208, 0.874879822, 0.874857129, 0.874849564, 0.874849564, 0.874849564,
+        0.874645325, 0.874486473, 0.874373007, 0.874297363, 0.874251976, 0.874229283,
+        0.874221719, 0.874221719, 0.874221719, 0.874070431, 0.873956965, 0.873881321,
+        0.873835934, 0.873813241, 0.873805677, 0.873805677, 0.873805677, 0.873699775,
+        0.873624131, 0.873578745, 0.873556052, 0.873548487, 0.873548487, 0.873548487,
+        0.873480408, 0.873435021, 0.873412328, 0.873404764, 0.873404764, 0.873404764,
+        0.873359377, 0.873336684, 0.87332912, 0.87332912, 0.87332912, 0.873306426,
+        0.873298862, 0.873298862, 0.873298862, 0.873291298, 0.873291298, 0.873291298,
+        0.873291298, 0.873291298, 0.873291298, 0.8729509, 0.872678581, 0.872466778,
+        0.872307926, 0.87219446, 0.872118816, 0.872073429, 0.872050736, 0.872043171,
+        0.872043171, 0.872043171, 0.871770853, 0.87155905, 0.871400197, 0.871286731,
+        0.871211087, 0.871165701, 0.871143008, 0.871135443, 0.871135443, 0.871135443,
+        0.870931205, 0.870772352, 0.870658886, 0.870583242, 0.870537856, 0.870515163,
+        0.870507598, 0.870507598, 0.870507598, 0.87035631, 0.870242844, 0.8701672,
+        0.870121814, 0.870099121, 0.870091556, 0.870091556, 0.870091556, 0.869985655,
+        0.869910011, 0.869864624, 0.869841931, 0.869834367, 0.869834367, 0.869834367,
+        0.869766287, 0.869720901, 0.869698207, 0.869690643, 0.869690643, 0.869690643,
+        0.869652821, 0.869630128, 0.869622563, 0.869622563, 0.869622563, 0.86959987,
+        0.869592306, 0.869592306, 0.869592306, 0.869584741, 0.869584741, 0.869584741,
+        0.869584741, 0.869584741, 0.869584741, 0.869244343, 0.868972025, 0.868760222,
+        0.868601369, 0.868487903, 0.868412259, 0.868366873, 0.86834418, 0.868336615,
+        0.868336615, 0.868336615, 0.868064297, 0.867852494, 0.867693641, 0.867580175,
+        0.867504531, 0.867459145, 0.867436452, 0.867428887, 0.867428887, 0.867428887,
+        0.867217084, 0.867058232, 0.866944766, 0.866869122, 0.866823735, 0.866801042,
+        0.866793478, 0.866793478, 0.866793478, 0.86664219, 0.866528723, 0.866453079,
+        0.866407693, 0.866385, 0.866377435, 0.866377435, 0.866377435, 0.866271534,
+        0.86619589, 0.866150503, 0.86612781, 0.866120246, 0.866120246, 0.866120246,
+        0.866052166, 0.86600678, 0.865984087, 0.865976522, 0.865976522, 0.865976522,
+        0.8659387, 0.865916007, 0.865908443, 0.865908443, 0.865908443, 0.865893314,
+        0.865885749, 0.865885749, 0.865885749, 0.865878185, 0.865878185, 0.865878185,
+        0.865878185, 0.865878185, 0.865878185, 0.865537787, 0.865265469, 0.865053665,
+        0.864894813, 0.864781347, 0.864705703, 0.864660317, 0.864637623, 0.864630059,
+        0.864630059, 0.864630059, 0.864357741, 0.864145937, 0.863987085, 0.863873619,
+        0.863797975, 0.863752588, 0.863729895, 0.863722331, 0.863722331, 0.863722331,
+        0.863510528, 0.863351675, 0.863238209, 0.863162565, 0.863117179, 0.863094486,
+        0.863086921, 0.863086921, 0.863086921, 0.862928069, 0.862814603, 0.862738959,
+        0.862693572, 0.862670879, 0.862663315, 0.862663315, 0.862663315, 0.862557413,
+        0.862481769, 0.862436383, 0.86241369, 0.862406125, 0.862406125, 0.862406125,
+        0.862338046, 0.862292659, 0.862269966, 0.862262402, 0.862262402, 0.862262402,
+        0.86222458, 0.862201886, 0.862194322, 0.862194322, 0.862194322, 0.862179193,
+        0.862171629, 0.862171629, 0.862171629, 0.862171629, 0.862171629, 0.862171629,
+        0.862171629, 0.862171629, 0.862171629, 0.861831231, 0.861558912, 0.861347109,
+        0.861188257, 0.861074791, 0.860999147, 0.86095376, 0.860931067, 0.860931067,
+        0.860931067, 0.860931067, 0.860658749, 0.860446945, 0.860288093, 0.860174627,
+        0.860098983, 0.860053597, 0.860030903, 0.860023339, 0.860023339, 0.860023339,
+        0.859811536, 0.859652683, 0.859539217, 0.859463573, 0.859418187, 0.859395494,
+        0.859387929, 0.859387929, 0.859387929, 0.859229077, 0.859115611, 0.859039967,
+        0.858994581, 0.858971887, 0.858964323, 0.858964323, 0.858964323, 0.858850857,
+        0.858775213, 0.858729827, 0.858707133, 0.858699569, 0.858699569, 0.858699569,
+        0.858631489, 0.858586103, 0.85856341, 0.858555845, 0.858555845, 0.858555845,
+        0.858518023, 0.85849533, 0.858487766, 0.858487766, 0.858487766, 0.858472637,
+        0.858465073, 0.858465073, 0.858465073, 0.858465073, 0.858465073, 0.858465073,
+        0.858465073, 0.858465073, 0.858465073, 0.858124674, 0.857852356, 0.857640553,
+        0.8574817, 0.857368234, 0.85729259, 0.857247204, 0.857224511, 0.857224511,
+        0.857224511, 0.857224511, 0.856952192, 0.856740389, 0.856581537, 0.856468071,
+        0.856392427, 0.85634704, 0.856324347, 0.856316783, 0.856316783, 0.856316783,
+        0.85610498, 0.855946127, 0.855832661, 0.855757017, 0.855711631, 0.855688937,
+        0.855681373, 0.855681373, 0.855681373, 0.855522521, 0.855409055, 0.855333411,
+        0.855288024, 0.855265331, 0.855257767, 0.855257767, 0.855257767, 0.855144301,
+        0.855068657, 0.85502327, 0.855000577, 0.854993013, 0.854993013, 0.854993013,
+        0.854917369, 0.854871982, 0.854849289, 0.854841725, 0.854841725, 0.854841725,
+        0.854803903, 0.854781209, 0.854773645, 0.854773645, 0.854773645, 0.854758516,
+        0.854750952, 0.854750952, 0.854750952, 0.854750952, 0.854750952, 0.854750952,
+        0.854750952, 0.854750952, 0.854750952, 0.854410554, 0.854138235, 0.853926432,
+        0.85376758, 0.853654114, 0.85357847, 0.853533083, 0.85351039, 0.85351039,
+        0.85351039, 0.85351039, 0.853238072, 0.853026269, 0.852867416, 0.85275395,
+        0.852678306, 0.85263292, 0.852610226, 0.852602662, 0.852602662, 0.852602662,
+        0.852390859, 0.852232006, 0.85211854, 0.852042896, 0.85199751, 0.851974817,
+        0.851967252, 0.851967252, 0.851967252, 0.8518084, 0.851694934, 0.85161929,
+        0.851573904, 0.85155121, 0.851543646, 0.851543646, 0.851543646, 0.85143018,
+        0.851354536, 0.85130915, 0.851286456, 0.851278892, 0.851278892, 0.851278892,
+        0.851203248, 0.851157862, 0.851135168, 0.851127604, 0.851127604, 0.851127604,
+        0.851082218, 0.851059524, 0.85105196, 0.85105196, 0.85105196, 0.851036831,
+        0.851029267, 0.851029267, 0.851029267, 0.851029267, 0.851029267, 0.851029267,
+        0.851029267, 0.851029267, 0.851029267, 0.850688869, 0.85041655, 0.850204747,
+        0.850045895, 0.849932429, 0.849856785, 0.849811398, 0.849788705, 0.849788705,
+        0.849788705, 0.849788705, 0.849516387, 0.849304583, 0.849145731, 0.849032265,
+        0.848956621, 0.848911235, 0.848888541, 0.848880977, 0.848880977, 0.848880977,
+        0.848669174, 0.848510321, 0.848396855, 0.848321211, 0.848275825, 0.848253132,
+        0.848245567, 0.848245567, 0.848245567, 0.848086715, 0.847973249, 0.847897605,
+        0.847852219, 0.847829525, 0.847821961, 0.847821961, 0.847821961, 0.847708495,
+        0.847632851, 0.847587465, 0.847564771, 0.847557207, 0.847557207, 0.847557207,
+        0.847481563, 0.847436176, 0.847413483, 0.847405919, 0.847405919, 0.847405919,
+        0.847360532, 0.847337839, 0.847330275, 0.847330275, 0.847330275, 0.847307582,
+        0.847300017, 0.847300017, 0.847300017, 0.847300017, 0.847300017, 0.847300017,
+        0.847300017, 0.847300017, 0.847300017, 0.846424939, 0.845698397, 0.845120394,
+        0.844673974, 0.844342187, 0.844108079, 0.843954699, 0.843865092, 0.843822307,
+        0.84380939, 0.84380939, 0.842998893, 0.842272352, 0.841694348, 0.841247929,
+        0.840916142, 0.840682034, 0.840528653, 0.840439046, 0.840396261, 0.840383345,
+        0.840383345, 0.839579306, 0.838910888, 0.838332884, 0.837886465, 0.837554677,
+        0.83732057, 0.837167189, 0.837077582, 0.837034797, 0.837021881, 0.837021881,
+        0.8362243, 0.83556234, 0.835036001, 0.834589582, 0.834257795, 0.834023687,
+        0.833870306, 0.833780699, 0.833737914, 0.833724998, 0.833724998, 0.832916923,
+        0.832261421, 0.83174154, 0.831340328, 0.831008541, 0.830774433, 0.830621052,
+        0.830531445, 0.83048866, 0.830475744, 0.830475744, 0.829674127, 0.829025083,
+        0.828511661, 0.828116907, 0.827823868, 0.827589761, 0.82743638, 0.827346773,
+        0.827303988, 0.827291072, 0.827291072, 0.826495913, 0.825853327, 0.825346363,
+        0.824958067, 0.824671487, 0.82446967, 0.824316289, 0.824226682, 0.824183897,
+        0.824170981, 0.824170981, 0.82338228, 0.822746152, 0.822245646, 0.821863808,
+        0.821583686, 0.821388328, 0.821260779, 0.821171173, 0.821128387, 0.821115471,
+        0.821115471, 0.820333228, 0.819703559, 0.819209511, 0.818834132, 0.818560468,
+        0.818371567, 0.818250477, 0.818180244, 0.818154412, 0.818141496, 0.818141496,
+        0.817365711, 0.8167425, 0.81625491, 0.815885989, 0.815618783, 0.81543634,
+        0.815321708, 0.815257934, 0.815245018, 0.815232102, 0.815232102, 0.814462775,
+        0.813846022, 0.813364891, 0.813002427, 0.81274168, 0.812565695, 0.812457521,
+        0.812400205, 0.812393747, 0.812387289, 0.812387289, 0.811624421, 0.811014126,
+        0.810539452, 0.810183447, 0.809929158, 0.809759631, 0.809657916, 0.809607058,
+        0.809607058, 0.809607058, 0.809607058, 0.808796561, 0.808086972, 0.807508968,
+        0.807062549, 0.806730762, 0.806496654, 0.806343273, 0.806253666, 0.806210881,
+        0.806197965, 0.806197965, 0.805393926, 0.804742461, 0.804164457, 0.803718037,
+        0.80338625, 0.803152143, 0.802998762, 0.802909155, 0.80286637, 0.802853453,
+        0.802853453, 0.802055873, 0.801410865, 0.800884527, 0.800438107, 0.80010632,
+        0.799872212, 0.799718832, 0.799629225, 0.79958644, 0.799573523, 0.799573523,
+        0.798765448, 0.798126899, 0.797607018, 0.797205806, 0.796874019, 0.796639911,
+        0.79648653, 0.796396924, 0.796354138, 0.796341222, 0.796341222, 0.795539605,
+        0.794890561, 0.794377139, 0.793982385, 0.793689347, 0.793455239, 0.793301858,
+        0.793212251, 0.793169466, 0.79315655, 0.79315655, 0.792361391, 0.791718805,
+        0.791211841, 0.790823545, 0.790536965, 0.790335148, 0.790181767, 0.79009216,
+        0.790049375, 0.790036459, 0.790036459, 0.789247758, 0.788611631, 0.788111124,
+        0.787729287, 0.787449165, 0.787253806, 0.787126257, 0.787036651, 0.786993865,
+        0.786980949, 0.786980949, 0.786198706, 0.785569037, 0.785074989, 0.78469961,
+        0.784425946, 0.784237045, 0.784115955, 0.784045722, 0.784002937, 0.783990021,
+        0.783990021, 0.783214236, 0.782591025, 0.782103436, 0.781734514, 0.781467308,
+        0.781284866, 0.781170234, 0.78110646, 0.781076591, 0.781063674, 0.781063674,
+        0.780294348, 0.779677595, 0.779196463, 0.778834, 0.778573252, 0.778397268,
+        0.778289094, 0.778231778, 0.778208367, 0.778201909, 0.778201909, 0.777439041,
+        0.776828746, 0.776354073, 0.775998067, 0.775743778, 0.775574252, 0.775472536,
+        0.775421678, 0.775404725, 0.775404725, 0.775404725, 0.774600686, 0.773949221,
+        0.77338817, 0.772941751, 0.772609963, 0.772375856, 0.772222475, 0.772132868,
+        0.772090083, 0.772077166, 0.772077166, 0.771279586, 0.770634578, 0.770125192,
+        0.769678773, 0.769346986, 0.769112878, 0.768959497, 0.768869891, 0.768827105,
+        0.768814189, 0.768814189, 0.768006114, 0.767367565, 0.766864637, 0.766463424,
+        0.766131637, 0.76589753, 0.765744149, 0.765654542, 0.765611757, 0.76559884,
+        0.76559884, 0.764797223, 0.76414818, 0.76365171, 0.763256956, 0.762963918,
+        0.76272981, 0.762576429, 0.762486822, 0.762444037, 0.762431121, 0.762431121,
+        0.761635962, 0.760993376, 0.760486412, 0.760098116, 0.759811536, 0.759609719,
+        0.759456338, 0.759366731, 0.759323946, 0.75931103, 0.75931103, 0.758522329,
+        0.757886202, 0.757385695, 0.757003858, 0.756723736, 0.756528377, 0.756400828,
+        0.756311222, 0.756268436, 0.75625552, 0.75625552, 0.755473277, 0.754843608,
+        0.75434956, 0.753974181, 0.753700517, 0.753511616, 0.753390526, 0.753320293,
+        0.753277508, 0.753264592, 0.753264592, 0.752488807, 0.751865596, 0.751378007,
+        0.751009085, 0.750741879, 0.750559437, 0.750444805, 0.750381031, 0.750351162,
+        0.750338245, 0.750338245, 0.749568919, 0.748952166, 0.748471034, 0.748108571,
+        0.747847823, 0.747671839, 0.747563665, 0.747506349, 0.747482938, 0.74747648,
+        0.74747648, 0.746713612, 0.746103317, 0.745628644, 0.745272638, 0.745018349,
+        0.744848823, 0.744747107, 0.744696249, 0.744679296, 0.744679296, 0.744679296,
+        0.743881715, 0.743236708, 0.742727322, 0.742297856, 0.741966068, 0.741731961,
+        0.74157858, 0.741488973, 0.741446188, 0.741433272, 0.741433272, 0.740625196,
+        0.739986647, 0.739483719, 0.73909946, 0.738767672, 0.738533565, 0.738380184,
+        0.738290577, 0.738247792, 0.738234876, 0.738234876, 0.737433258, 0.736784215,
+        0.736287745, 0.735909944, 0.735616905, 0.735382798, 0.735229417, 0.73513981,
+        0.735097025, 0.735084108, 0.735084108, 0.734288949, 0.733646364, 0.7331394,
+        0.732768056, 0.732481476, 0.732279659, 0.732126278, 0.732036671, 0.731993886,
+        0.73198097, 0.73198097, 0.731192269, 0.730556142, 0.730055636, 0.729673798,
+        0.729393676, 0.729198317, 0.729070769, 0.728981162, 0.728938377, 0.72892546,
+        0.72892546, 0.728143218, 0.727513549, 0.727019501, 0.726644121, 0.726370457,
+        0.726181556, 0.726060466, 0.725990234, 0.725947449, 0.725934532, 0.725934532,
+        0.725158748, 0.724535537, 0.724047947, 0.723679025, 0.72341182, 0.723229377,
+        0.723114745, 0.723050971, 0.723021102, 0.723008186, 0.723008186, 0.722238859,
+        0.721622106, 0.721140975, 0.720778511, 0.720517764, 0.720341779, 0.720233605,
+        0.720176289, 0.720152879, 0.72014642, 0.72014642, 0.719383552, 0.718773258,
+        0.718298584, 0.717942579, 0.717688289, 0.717518763, 0.717417047, 0.717366189,
+        0.717349237, 0.717349237, 0.717349237, 0.716541161, 0.715902612, 0.715399684,
+        0.715015425, 0.71470059, 0.714466483, 0.714313102, 0.714223495, 0.71418071,
+        0.714167793, 0.714167793, 0.713366176, 0.712717133, 0.712220663, 0.711842861,
+        0.711566776, 0.711332668, 0.711179287, 0.71108968, 0.711046895, 0.711033979,
+        0.711033979, 0.71023882, 0.709596234, 0.70908927, 0.708717927, 0.708448299,
+        0.708246482, 0.708093101, 0.708003495, 0.707960709, 0.707947793, 0.707947793,
+        0.707159092, 0.706522965, 0.706022459, 0.705640621, 0.705377452, 0.705182093,
+        0.705054544, 0.704964938, 0.704922152, 0.704909236, 0.704909236, 0.704126993,
+        0.703497324, 0.703003276, 0.702627897, 0.702354233, 0.702165332, 0.702044242,
+        0.70197401, 0.701931224, 0.701918308, 0.701918308, 0.701142523, 0.700519313,
+        0.700031723, 0.699662801, 0.699395595, 0.699213153, 0.699098521, 0.699034747,
+        0.699004878, 0.698991961, 0.698991961, 0.698222635, 0.697605882, 0.69712475,
+        0.696762287, 0.696501539, 0.696325555, 0.696217381, 0.696160065, 0.696136654,
+        0.696130196, 0.696130196, 0.695367328, 0.694757033, 0.69428236, 0.693926354,
+        0.693672065, 0.693502539, 0.693400823, 0.693349965, 0.693333012, 0.693333012,
+        0.693333012, 0.692531395, 0.691882352, 0.691385882, 0.69100808, 0.690731995,
+        0.69051484, 0.690361459, 0.690271852, 0.690229067, 0.690216151, 0.690216151,
+        0.689420991, 0.688778406, 0.688271442, 0.687900098, 0.687630471, 0.687445607,
+        0.687292226, 0.687202619, 0.687159834, 0.687146917, 0.687146917, 0.686358217,
+        0.685722089, 0.685221583, 0.684839745, 0.684576576, 0.68439817, 0.684270621,
+        0.684181015, 0.684138229, 0.684125313, 0.684125313, 0.68334307, 0.682713401,
+        0.682219353, 0.681843974, 0.68157031, 0.681398362, 0.681277271, 0.681207039,
+        0.681164254, 0.681151338, 0.681151338, 0.680375553, 0.679752342, 0.679264752,
+        0.678895831, 0.678628625, 0.678446182, 0.67833155, 0.678267776, 0.678237907,
+        0.678224991, 0.678224991, 0.677455665, 0.676838912, 0.67635778, 0.675995317,
+        0.675734569, 0.675558585, 0.675450411, 0.675393095, 0.675369684, 0.675363226,
+        0.675363226, 0.674600357, 0.673990063, 0.673515389, 0.673159384, 0.672905095,
+        0.672735568, 0.672633853, 0.672582995, 0.672566042, 0.672566042, 0.672566042,
+        0.671770883, 0.671128298, 0.670621333, 0.67024999, 0.669980362, 0.669795498,
+        0.66965907, 0.669569463, 0.669526678, 0.669513762, 0.669513762, 0.668725061,
+        0.668088933, 0.667588427, 0.667206589, 0.66694342, 0.666765014, 0.666654418,
+        0.666564811, 0.666522026, 0.66650911, 0.66650911, 0.665726867, 0.665097198,
+        0.66460315, 0.66422777, 0.663954107, 0.663782158, 0.663678021, 0.663607789,
+        0.663565003, 0.663552087, 0.663552087, 0.662776302, 0.662153092, 0.661665502,
+        0.66129658, 0.661029374, 0.660846932, 0.660749252, 0.660685478, 0.660655609,
+        0.660642693, 0.660642693, 0.659873367, 0.659256614, 0.658775482, 0.658413019,
+        0.658152271, 0.657976287, 0.657868113, 0.657810797, 0.657787386, 0.657780928,
+        0.657780928, 0.657018059, 0.656407765, 0.655933091, 0.655577086, 0.655322797,
+        0.65515327, 0.655051555, 0.655000697, 0.654983744, 0.654983744, 0.654983744,
+        0.654195043, 0.653558916, 0.65305841, 0.652676572, 0.652413403, 0.652234996,
+        0.652124401, 0.652051746, 0.652008961, 0.651996045, 0.651996045, 0.651213802,
+        0.650584133, 0.650090085, 0.649714705, 0.649441042, 0.649269094, 0.649164956,
+        0.649111676, 0.649068891, 0.649055975, 0.649055975, 0.64828019, 0.647656979,
+        0.647169389, 0.646800468, 0.646533262, 0.64635082, 0.64625314, 0.646206319,
+        0.64617645, 0.646163533, 0.646163533, 0.645394207, 0.644777454, 0.644296322,
+        0.643933859, 0.643673111, 0.643497127, 0.643388953, 0.64334859, 0.643325179,
+        0.643318721, 0.643318721, 0.642555852, 0.641945558, 0.641470884, 0.641114879,
+        0.64086059, 0.640691063, 0.640589348, 0.64053849, 0.640521537, 0.640521537,
+        0.640521537, 0.639739294, 0.639109625, 0.638615577, 0.638240198, 0.637966534,
+        0.637794586, 0.637690448, 0.637637168, 0.637611336, 0.637598419, 0.637598419,
+        0.636822635, 0.636199424, 0.635711834, 0.635342913, 0.635075707, 0.634893264,
+        0.634795585, 0.634748763, 0.634735847, 0.634722931, 0.634722931, 0.633953604,
+        0.633336851, 0.63285572, 0.632493256, 0.632232509, 0.632056524, 0.63194835,
+        0.631907987, 0.631901529, 0.631895071, 0.631895071, 0.631132202, 0.630521908,
+        0.630047234, 0.629691229, 0.62943694, 0.629267413, 0.629165697, 0.62911484,
+        0.62911484, 0.62911484, 0.62911484, 0.628356008, 0.627732797, 0.627245207,
+        0.626876285, 0.62660908, 0.626426637, 0.626328958, 0.626282136, 0.62626922,
+        0.626256303, 0.626256303, 0.62550393, 0.624887177, 0.624406045, 0.624043582,
+        0.623782834, 0.62360685, 0.623498676, 0.623458312, 0.623451854, 0.623445396,
+        0.623445396, 0.62269948, 0.622089186, 0.621614512, 0.621258507, 0.621004218,
+        0.620834691, 0.620732975, 0.620682118, 0.620682118, 0.620682118, 0.620682118,
+        0.619929744, 0.619312991, 0.618831859, 0.618469396, 0.618208648, 0.618032664,
+        0.61792449, 0.617884127, 0.617877668, 0.61787121, 0.61787121, 0.617125295,
+        0.616515, 0.616040326, 0.615684321, 0.615430032, 0.615260505, 0.61515879,
+        0.615107932, 0.615107932, 0.615107932, 0.615107932, 0.614362016, 0.613751721,
+        0.613277048, 0.612921043, 0.612666753, 0.612497227, 0.612395511, 0.612344653,
+        0.612344653, 0.612344653, 0.612344653, 0.61110146, 0.609858268, 0.608925873,
+        0.608259877, 0.60781588, 0.607549481, 0.607416282, 0.607371882, 0.607371882,
+        0.607371882, 0.606128689, 0.605196295, 0.604530299, 0.604086301, 0.603819903,
+        0.603686703, 0.603642304, 0.603642304, 0.603642304, 0.602709909, 0.602043913,
+        0.601599916, 0.601333517, 0.601200318, 0.601155918, 0.601155918, 0.601155918,
+        0.600489922, 0.600045925, 0.599779526, 0.599646327, 0.599601927, 0.599601927,
+        0.599601927, 0.59915793, 0.598891531, 0.598758332, 0.598713932, 0.598713932,
+        0.598713932, 0.598447534, 0.598314335, 0.598269935, 0.598269935, 0.598269935,
+        0.598136736, 0.598092336, 0.598092336, 0.598092336, 0.598092336, 0.598092336,
+        0.598092336, 0.598092336, 0.598092336, 0.598092336, 0.596893543, 0.595961148,
+        0.595295152, 0.594851155, 0.594584756, 0.594451557, 0.594407157, 0.594407157,
+        0.594407157, 0.593474763, 0.592808767, 0.592364769, 0.592098371, 0.591965171,
+        0.591920772, 0.591920772, 0.591920772, 0.591254776, 0.590810778, 0.59054438,
+        0.59041118, 0.590366781, 0.590366781, 0.590366781, 0.589922783, 0.589656385,
+        0.589523186, 0.589478786, 0.589478786, 0.589478786, 0.589212387, 0.589079188,
+        0.589034788, 0.589034788, 0.589034788, 0.588901589, 0.588857189, 0.588857189,
+        0.588857189, 0.588857189, 0.588857189, 0.588857189, 0.588857189, 0.588857189,
+        0.588857189, 0.587969195, 0.587303199, 0.586859201, 0.586592803, 0.586459603,
+        0.586415204, 0.586415204, 0.586415204, 0.585749208, 0.58530521, 0.585038812,
+        0.584905612, 0.584861213, 0.584861213, 0.584861213, 0.584417215, 0.584150817,
+        0.584017618, 0.583973218, 0.583973218, 0.583973218, 0.583706819, 0.58357362,
+        0.58352922, 0.58352922, 0.58352922, 0.583396021, 0.583351621, 0.583351621,
+        0.583351621, 0.583351621, 0.583351621, 0.583351621, 0.583351621, 0.583351621,
+        0.583351621, 0.582730025, 0.582286028, 0.582019629, 0.58188643, 0.58184203,
+        0.58184203, 0.58184203, 0.581398033, 0.581131634, 0.580998435, 0.580954035,
+        0.580954035, 0.580954035, 0.580687637, 0.580554438, 0.580510038, 0.580510038,
+        0.580510038, 0.580376839, 0.580332439, 0.580332439, 0.580332439, 0.580332439,
+        0.580332439, 0.580332439, 0.580332439, 0.580332439, 0.580332439, 0.579932841,
+        0.579666443, 0.579533244, 0.579488844, 0.579488844, 0.579488844, 0.579222445,
+        0.579089246, 0.579044846, 0.579044846, 0.579044846, 0.578911647, 0.578867247,
+        0.578867247, 0.578867247, 0.578867247, 0.578867247, 0.578867247, 0.578867247,
+        0.578867247, 0.578867247, 0.578645249, 0.57851205, 0.57846765, 0.57846765,
+        0.57846765, 0.578334451, 0.578290051, 0.578290051, 0.578290051, 0.578290051,
+        0.578290051, 0.578290051, 0.578290051, 0.578290051, 0.578290051, 0.578201251,
+        0.578156852, 0.578156852, 0.578156852, 0.578156852, 0.578156852, 0.578156852,
+        0.578156852, 0.578156852, 0.578156852, 0.578156852, 0.578156852, 0.578156852,
+        0.578156852, 0.578156852, 0.578156852, 0.578156852, 0.578156852, 0.578156852,
+        0.578156852, 0.576913659, 0.575670466, 0.574738071, 0.574072075, 0.573628078,
+        0.573361679, 0.57322848, 0.57318408, 0.57318408, 0.57318408, 0.571940888,
+        0.571008493, 0.570342497, 0.569898499, 0.569632101, 0.569498902, 0.569454502,
+        0.569454502, 0.569454502, 0.568522107, 0.567856111, 0.567412114, 0.567145715,
+        0.567012516, 0.566968117, 0.566968117, 0.566968117, 0.56630212, 0.565858123,
+        0.565591724, 0.565458525, 0.565414126, 0.565414126, 0.565414126, 0.564970128,
+        0.56470373, 0.56457053, 0.564526131, 0.564526131, 0.564526131, 0.564259732,
+        0.564126533, 0.564082133, 0.564082133, 0.564082133, 0.563948934, 0.563904534,
+        0.563904534, 0.563904534, 0.563904534, 0.563904534, 0.563904534, 0.563904534,
+        0.563904534, 0.563904534, 0.56297214, 0.562039745, 0.561373749, 0.560929752,
+        0.560663353, 0.560530154, 0.560485754, 0.560485754, 0.560485754, 0.55955336,
+        0.558887363, 0.558443366, 0.558176968, 0.558043768, 0.557999369, 0.557999369,
+        0.557999369, 0.557333372, 0.556889375, 0.556622977, 0.556489777, 0.556445378,
+        0.556445378, 0.556445378, 0.55600138, 0.555734982, 0.555601782, 0.555557383,
+        0.555557383, 0.555557383, 0.555290984, 0.555157785, 0.555113385, 0.555113385,
+        0.555113385, 0.554980186, 0.554935786, 0.554935786, 0.554935786, 0.554891387,
+        0.554891387, 0.554891387, 0.554891387, 0.554891387, 0.554891387, 0.554003392,
+        0.553337396, 0.552893398, 0.552627, 0.5524938, 0.552449401, 0.552449401,
+        0.552449401, 0.551783405, 0.551339407, 0.551073009, 0.550939809, 0.55089541,
+        0.55089541, 0.55089541, 0.550451412, 0.550185014, 0.550051815, 0.550007415,
+        0.550007415, 0.550007415, 0.549741016, 0.549607817, 0.549563417, 0.549563417,
+        0.549563417, 0.549430218, 0.549385819, 0.549385819, 0.549385819, 0.549341419,
+        0.549341419, 0.549341419, 0.549341419, 0.549341419, 0.549341419, 0.548719822,
+        0.548275825, 0.548009426, 0.547876227, 0.547831828, 0.547831828, 0.547831828,
+        0.54738783, 0.547121432, 0.546988232, 0.546943833, 0.546943833, 0.546943833,
+        0.546677434, 0.546544235, 0.546499835, 0.546499835, 0.546499835, 0.546366636,
+        0.546322236, 0.546322236, 0.546322236, 0.546277837, 0.546277837, 0.546277837,
+        0.546277837, 0.546277837, 0.546277837, 0.545878239, 0.54561184, 0.545478641,
+        0.545434241, 0.545434241, 0.545434241, 0.545167843, 0.545034644, 0.544990244,
+        0.544990244, 0.544990244, 0.544857045, 0.544812645, 0.544812645, 0.544812645,
+        0.544768245, 0.544768245, 0.544768245, 0.544768245, 0.544768245, 0.544768245,
+        0.544546247, 0.544413047, 0.544368648, 0.544368648, 0.544368648, 0.544235448,
+        0.544191049, 0.544191049, 0.544191049, 0.544146649, 0.544146649, 0.544146649,
+        0.544146649, 0.544146649, 0.544146649, 0.544057849, 0.54401345, 0.54401345,
+        0.54401345, 0.54396905, 0.54396905, 0.54396905, 0.54396905, 0.54396905,
+        0.54396905, 0.54396905, 0.54396905, 0.54396905, 0.54396905, 0.54396905,
+        0.54396905, 0.54396905, 0.54396905, 0.54396905, 0.54396905, 0.542725857,
+        0.541482664, 0.54055027, 0.539884274, 0.539440276, 0.539173878, 0.539040679,
+        0.538996279, 0.538996279, 0.538996279, 0.537797486, 0.536865091, 0.536199095,
+        0.535755098, 0.535488699, 0.5353555, 0.5353111, 0.5353111, 0.5353111,
+        0.534378706, 0.533712709, 0.533268712, 0.533002314, 0.532869114, 0.532824715,
+        0.532824715, 0.532824715, 0.532158718, 0.531714721, 0.531448323, 0.531315123,
+        0.531270724, 0.531270724, 0.531270724, 0.530826726, 0.530560328, 0.530427129,
+        0.530382729, 0.530382729, 0.530382729, 0.53011633, 0.529983131, 0.529938731,
+        0.529938731, 0.529938731, 0.529805532, 0.529761132, 0.529761132, 0.529761132,
+        0.529761132, 0.529761132, 0.529761132, 0.529761132, 0.529761132, 0.529761132,
+        0.528828738, 0.527896343, 0.527230347, 0.52678635, 0.526519951, 0.526386752,
+        0.526342352, 0.526342352, 0.526342352, 0.525409958, 0.524743961, 0.524299964,
+        0.524033566, 0.523900366, 0.523855967, 0.523855967, 0.523855967, 0.523189971,
+        0.522745973, 0.522479575, 0.522346375, 0.522301976, 0.522301976, 0.522301976,
+        0.521857978, 0.52159158, 0.521458381, 0.521413981, 0.521413981, 0.521413981,
+        0.521147582, 0.521014383, 0.520969983, 0.520969983, 0.520969983, 0.520836784,
+        0.520792384, 0.520792384, 0.520792384, 0.520747985, 0.520747985, 0.520747985,
+        0.520747985, 0.520747985, 0.520747985, 0.520081989, 0.519415992, 0.518971995,
+        0.518705597, 0.518572397, 0.518527998, 0.518527998, 0.518527998, 0.517862001,
+        0.517418004, 0.517151606, 0.517018406, 0.516974007, 0.516974007, 0.516974007,
+        0.516530009, 0.516263611, 0.516130411, 0.516086012, 0.516086012, 0.516086012,
+        0.515819613, 0.515686414, 0.515642014, 0.515642014, 0.515642014, 0.515508815,
+        0.515464415, 0.515464415, 0.515464415, 0.515420016, 0.515420016, 0.515420016,
+        0.515420016, 0.515420016, 0.515420016, 0.514798419, 0.514354422, 0.514088023,
+        0.513954824, 0.513910424, 0.513910424, 0.513910424, 0.513466427, 0.513200028,
+        0.513066829, 0.513022429, 0.513022429, 0.513022429, 0.512756031, 0.512622832,
+        0.512578432, 0.512578432, 0.512578432, 0.512445233, 0.512400833, 0.512400833,
+        0.512400833, 0.512356433, 0.512356433, 0.512356433, 0.512356433, 0.512356433,
+        0.512356433, 0.511956836, 0.511690437, 0.511557238, 0.511512838, 0.511512838,
+        0.511512838, 0.51124644, 0.511113241, 0.511068841, 0.511068841, 0.511068841,
+        0.510935642, 0.510891242, 0.510891242, 0.510891242, 0.510846842, 0.510846842,
+        0.510846842, 0.510846842, 0.510846842, 0.510846842, 0.510624843, 0.510491644,
+        0.510447244, 0.510447244, 0.510447244, 0.510314045, 0.510269645, 0.510269645,
+        0.510269645, 0.510225246, 0.510225246, 0.510225246, 0.510225246, 0.510225246,
+        0.510225246, 0.510136446, 0.510092046, 0.510092046, 0.510092046, 0.510047647,
+        0.510047647, 0.510047647, 0.510047647, 0.510047647, 0.510047647, 0.510047647,
+        0.510047647, 0.510047647, 0.510047647, 0.510047647, 0.510047647, 0.510047647,
+        0.510047647, 0.510047647, 0.510047647, 0.508804454, 0.507561261, 0.506628867,
+        0.50596287, 0.505518873, 0.505252475, 0.505119275, 0.505074876, 0.505074876,
+        0.505074876, 0.503876083, 0.502943688, 0.502277692, 0.501833694, 0.501567296,
+        0.501434097, 0.501389697, 0.501389697, 0.501389697, 0.500501702, 0.499835706,
+        0.499391709, 0.49912531, 0.498992111, 0.498947711, 0.498947711, 0.498947711,
+        0.498281715, 0.497837718, 0.497571319, 0.49743812, 0.49739372, 0.49739372,
+        0.49739372, 0.496949723, 0.496683324, 0.496550125, 0.496505725, 0.496505725,
+        0.496505725, 0.496239327, 0.496106128, 0.496061728, 0.496061728, 0.496061728,
+        0.495928529, 0.495884129, 0.495884129, 0.495884129, 0.495884129, 0.495884129,
+        0.495884129, 0.495884129, 0.495884129, 0.495884129, 0.494951734, 0.49401934,
+        0.493353344, 0.492909346, 0.492642948, 0.492509749, 0.492465349, 0.492465349,
+        0.492465349, 0.491577354, 0.490911358, 0.49046736, 0.490200962, 0.490067763,
+        0.490023363, 0.490023363, 0.490023363, 0.489357367, 0.488913369, 0.488646971,
+        0.488513772, 0.488469372, 0.488469372, 0.488469372, 0.488025375, 0.487758976,
+        0.487625777, 0.487581377, 0.487581377, 0.487581377, 0.487314979, 0.487181779,
+        0.48713738, 0.48713738, 0.48713738, 0.48700418, 0.486959781, 0.486959781,
+        0.486959781, 0.486915381, 0.486915381, 0.486915381, 0.486915381, 0.486915381,
+        0.486915381, 0.486249385, 0.485583389, 0.485139391, 0.484872993, 0.484739794,
+        0.484695394, 0.484695394, 0.484695394, 0.484029398, 0.4835854, 0.483319002,
+        0.483185803, 0.483141403, 0.483141403, 0.483141403, 0.482697405, 0.482431007,
+        0.482297808, 0.482253408, 0.482253408, 0.482253408, 0.48198701, 0.48185381,
+        0.481809411, 0.481809411, 0.481809411, 0.481676211, 0.481631812, 0.481631812,
+        0.481631812, 0.481587412, 0.481587412, 0.481587412, 0.481587412, 0.481587412,
+        0.481587412, 0.481143414, 0.480699417, 0.480433019, 0.480299819, 0.48025542,
+        0.48025542, 0.48025542, 0.479811422, 0.479545024, 0.479411825, 0.479367425,
+        0.479367425, 0.479367425, 0.479101026, 0.478967827, 0.478923427, 0.478923427,
+        0.478923427, 0.478790228, 0.478745828, 0.478745828, 0.478745828, 0.478701429,
+        0.478701429, 0.478701429, 0.478701429, 0.478701429, 0.478701429, 0.478301831,
+        0.478035432, 0.477902233, 0.477857834, 0.477857834, 0.477857834, 0.477591435,
+        0.477458236, 0.477413836, 0.477413836, 0.477413836, 0.477280637, 0.477236237,
+        0.477236237, 0.477236237, 0.477191837, 0.477191837, 0.477191837, 0.477191837,
+        0.477191837, 0.477191837, 0.476969839, 0.476836639, 0.47679224, 0.47679224,
+        0.47679224, 0.47665904, 0.476614641, 0.476614641, 0.476614641, 0.476570241,
+        0.476570241, 0.476570241, 0.476570241, 0.476570241, 0.476570241, 0.476481442,
+        0.476437042, 0.476437042, 0.476437042, 0.476392642, 0.476392642, 0.476392642,
+        0.476392642, 0.476392642, 0.476392642, 0.476392642, 0.476392642, 0.476392642,
+        0.476392642, 0.476392642, 0.476392642, 0.476392642, 0.476392642, 0.476392642,
+        0.476392642, 0.475149449, 0.473906256, 0.472973862, 0.472307866, 0.471863868,
+        0.47159747, 0.471464271, 0.471419871, 0.471419871, 0.471419871, 0.470221078,
+        0.469288683, 0.468622687, 0.46817869, 0.467912291, 0.467779092, 0.467734692,
+        0.467734692, 0.467734692, 0.466846697, 0.466180701, 0.465736704, 0.465470305,
+        0.465337106, 0.465292706, 0.465292706, 0.465292706, 0.46467111, 0.464227113,
+        0.463960714, 0.463827515, 0.463783115, 0.463783115, 0.463783115, 0.463339118,
+        0.463072719, 0.46293952, 0.46289512, 0.46289512, 0.46289512, 0.462628722,
+        0.462495523, 0.462451123, 0.462451123, 0.462451123, 0.462317924, 0.462273524,
+        0.462273524, 0.462273524, 0.462273524, 0.462273524, 0.462273524, 0.462273524,
+        0.462273524, 0.462273524, 0.461341129, 0.460408735, 0.459742739, 0.459298741,
+        0.459032343, 0.458899144, 0.458854744, 0.458854744, 0.458854744, 0.457966749,
+        0.457300753, 0.456856755, 0.456590357, 0.456457158, 0.456412758, 0.456412758,
+        0.456412758, 0.455791162, 0.455347164, 0.455080766, 0.454947566, 0.454903167,
+        0.454903167, 0.454903167, 0.454459169, 0.454192771, 0.454059572, 0.454015172,
+        0.454015172, 0.454015172, 0.453748773, 0.453615574, 0.453571174, 0.453571174,
+        0.453571174, 0.453437975, 0.453393575, 0.453393575, 0.453393575, 0.453349176,
+        0.453349176, 0.453349176, 0.453349176, 0.453349176, 0.453349176, 0.45268318,
+        0.452017183, 0.451573186, 0.451306788, 0.451173588, 0.451129189, 0.451129189,
+        0.451129189, 0.450507592, 0.450063595, 0.449797196, 0.449663997, 0.449619597,
+        0.449619597, 0.449619597, 0.4491756, 0.448909201, 0.448776002, 0.448731603,
+        0.448731603, 0.448731603, 0.448465204, 0.448332005, 0.448287605, 0.448287605,
+        0.448287605, 0.448154406, 0.448110006, 0.448110006, 0.448110006, 0.448065606,
+        0.448065606, 0.448065606, 0.448065606, 0.448065606, 0.448065606, 0.447621609,
+        0.447177612, 0.446911213, 0.446778014, 0.446733614, 0.446733614, 0.446733614,
+        0.446289617, 0.446023218, 0.445890019, 0.445845619, 0.445845619, 0.445845619,
+        0.445579221, 0.445446022, 0.445401622, 0.445401622, 0.445401622, 0.445268423,
+        0.445224023, 0.445224023, 0.445224023, 0.445179623, 0.445179623, 0.445179623,
+        0.445179623, 0.445179623, 0.445179623, 0.444913225, 0.444646826, 0.444513627,
+        0.444469227, 0.444469227, 0.444469227, 0.444202829, 0.44406963, 0.44402523,
+        0.44402523, 0.44402523, 0.443892031, 0.443847631, 0.443847631, 0.443847631,
+        0.443803231, 0.443803231, 0.443803231, 0.443803231, 0.443803231, 0.443803231,
+        0.443581232, 0.443448033, 0.443403633, 0.443403633, 0.443403633, 0.443270434,
+        0.443226034, 0.443226034, 0.443226034, 0.443181635, 0.443181635, 0.443181635,
+        0.443181635, 0.443181635, 0.443181635, 0.443092835, 0.443048435, 0.443048435,
+        0.443048435, 0.443004036, 0.443004036, 0.443004036, 0.443004036, 0.443004036,
+        0.443004036, 0.443004036, 0.443004036, 0.443004036, 0.443004036, 0.443004036,
+        0.443004036, 0.443004036, 0.443004036, 0.443004036, 0.443004036, 0.441450045,
+        0.440206852, 0.439274457, 0.438608461, 0.438164464, 0.437898065, 0.437764866,
+        0.437720466, 0.437720466, 0.437720466, 0.436521673, 0.435589279, 0.434923283,
+        0.434479285, 0.434212887, 0.434079688, 0.434035288, 0.434035288, 0.434035288,
+        0.433147293, 0.432481297, 0.432037299, 0.431770901, 0.431637702, 0.431593302,
+        0.431593302, 0.431593302, 0.430971706, 0.430527708, 0.43026131, 0.43012811,
+        0.430083711, 0.430083711, 0.430083711, 0.429684113, 0.429417715, 0.429284515,
+        0.429240116, 0.429240116, 0.429240116, 0.428973717, 0.428840518, 0.428796118,
+        0.428796118, 0.428796118, 0.428662919, 0.428618519, 0.428618519, 0.428618519,
+        0.428618519, 0.428618519, 0.428618519, 0.428618519, 0.428618519, 0.428618519,
+        0.427686125, 0.42675373, 0.426087734, 0.425643736, 0.425377338, 0.425244139,
+        0.425199739, 0.425199739, 0.425199739, 0.424311744, 0.423645748, 0.423201751,
+        0.422935352, 0.422802153, 0.422757753, 0.422757753, 0.422757753, 0.422136157,
+        0.421692159, 0.421425761, 0.421292562, 0.421248162, 0.421248162, 0.421248162,
+        0.420848564, 0.420582166, 0.420448967, 0.420404567, 0.420404567, 0.420404567,
+        0.420138168, 0.420004969, 0.419960569, 0.419960569, 0.419960569, 0.41982737,
+        0.41978297, 0.41978297, 0.41978297, 0.419738571, 0.419738571, 0.419738571,
+        0.419738571, 0.419738571, 0.419738571, 0.419072575, 0.418406578, 0.417962581,
+        0.417696183, 0.417562983, 0.417518584, 0.417518584, 0.417518584, 0.416896987,
+        0.41645299, 0.416186591, 0.416053392, 0.416008992, 0.416008992, 0.416008992,
+        0.415609395, 0.415342996, 0.415209797, 0.415165397, 0.415165397, 0.415165397,
+        0.414898999, 0.4147658, 0.4147214, 0.4147214, 0.4147214, 0.414588201,
+        0.414543801, 0.414543801, 0.414543801, 0.414499401, 0.414499401, 0.414499401,
+        0.414499401, 0.414499401, 0.414499401, 0.414055404, 0.413611406, 0.413345008,
+        0.413211809, 0.413167409, 0.413167409, 0.413167409, 0.412767811, 0.412501413,
+        0.412368213, 0.412323814, 0.412323814, 0.412323814, 0.412057415, 0.411924216,
+        0.411879816, 0.411879816, 0.411879816, 0.411746617, 0.411702217, 0.411702217,
+        0.411702217, 0.411657818, 0.411657818, 0.411657818, 0.411657818, 0.411657818,
+        0.411657818, 0.411391419, 0.411125021, 0.410991821, 0.410947422, 0.410947422,
+        0.410947422, 0.410681023, 0.410547824, 0.410503424, 0.410503424, 0.410503424,
+        0.410370225, 0.410325825, 0.410325825, 0.410325825, 0.410281426, 0.410281426,
+        0.410281426, 0.410281426, 0.410281426, 0.410281426, 0.410148226, 0.410015027,
+        0.409970627, 0.409970627, 0.409970627, 0.409837428, 0.409793028, 0.409793028,
+        0.409793028, 0.409748629, 0.409748629, 0.409748629, 0.409748629, 0.409748629,
+        0.409748629, 0.409659829, 0.409615429, 0.409615429, 0.409615429, 0.40957103,
+        0.40957103, 0.40957103, 0.40957103, 0.40957103, 0.40957103, 0.40957103,
+        0.40957103, 0.40957103, 0.40957103, 0.40957103, 0.40957103, 0.40957103,
+        0.40957103, 0.40957103, 0.40957103, 0.408017039, 0.406773846, 0.405841451,
+        0.405175455, 0.404731458, 0.404465059, 0.40433186, 0.40428746, 0.40428746,
+        0.40428746, 0.403088667, 0.402156273, 0.401490277, 0.401046279, 0.400779881,
+        0.400646682, 0.400602282, 0.400602282, 0.400602282, 0.399714287, 0.399048291,
+        0.398604293, 0.398337895, 0.398204696, 0.398160296, 0.398160296, 0.398160296,
+        0.3975387, 0.397094702, 0.396828304, 0.396695104, 0.396650705, 0.396650705,
+        0.396650705, 0.396251107, 0.395984709, 0.395851509, 0.39580711, 0.39580711,
+        0.39580711, 0.395585111, 0.395451912, 0.395407512, 0.395407512, 0.395407512,
+        0.395274313, 0.395229913, 0.395229913, 0.395229913, 0.395229913, 0.395229913,
+        0.395229913, 0.395229913, 0.395229913, 0.395229913, 0.39403112, 0.393098725,
+        0.392432729, 0.391988732, 0.391722333, 0.391589134, 0.391544734, 0.391544734,
+        0.391544734, 0.390656739, 0.389990743, 0.389546746, 0.389280347, 0.389147148,
+        0.389102748, 0.389102748, 0.389102748, 0.388481152, 0.388037155, 0.387770756,
+        0.387637557, 0.387593157, 0.387593157, 0.387593157, 0.38719356, 0.386927161,
+        0.386793962, 0.386749562, 0.386749562, 0.386749562, 0.386527563, 0.386394364,
+        0.386349964, 0.386349964, 0.386349964, 0.386216765, 0.386172365, 0.386172365,
+        0.386172365, 0.386127966, 0.386127966, 0.386127966, 0.386127966, 0.386127966,
+        0.386127966, 0.38546197, 0.384795973, 0.384351976, 0.384085578, 0.383952378,
+        0.383907979, 0.383907979, 0.383907979, 0.383286382, 0.382842385, 0.382575986,
+        0.382442787, 0.382398387, 0.382398387, 0.382398387, 0.38199879, 0.381732391,
+        0.381599192, 0.381554792, 0.381554792, 0.381554792, 0.381332794, 0.381199594,
+        0.381155195, 0.381155195, 0.381155195, 0.381021995, 0.380977596, 0.380977596,
+        0.380977596, 0.380933196, 0.380933196, 0.380933196, 0.380933196, 0.380933196,
+        0.380933196, 0.380489198, 0.380045201, 0.379778803, 0.379645603, 0.379601204,
+        0.379601204, 0.379601204, 0.379201606, 0.378935207, 0.378802008, 0.378757609,
+        0.378757609, 0.378757609, 0.37853561, 0.378402411, 0.378358011, 0.378358011,
+        0.378358011, 0.378224812, 0.378180412, 0.378180412, 0.378180412, 0.378136012,
+        0.378136012, 0.378136012, 0.378136012, 0.378136012, 0.378136012, 0.377869614,
+        0.377603215, 0.377470016, 0.377425616, 0.377425616, 0.377425616, 0.377203618,
+        0.377070418, 0.377026019, 0.377026019, 0.377026019, 0.376892819, 0.37684842,
+        0.37684842, 0.37684842, 0.37680402, 0.37680402, 0.37680402, 0.37680402,
+        0.37680402, 0.37680402, 0.376670821, 0.376537621, 0.376493222, 0.376493222,
+        0.376493222, 0.376360022, 0.376315623, 0.376315623, 0.376315623, 0.376271223,
+        0.376271223, 0.376271223, 0.376271223, 0.376271223, 0.376271223, 0.376226823,
+        0.376182423, 0.376182423, 0.376182423, 0.376138024, 0.376138024, 0.376138024,
+        0.376138024, 0.376138024, 0.376138024, 0.376138024, 0.376138024, 0.376138024,
+        0.376138024, 0.376138024, 0.376138024, 0.376138024, 0.376138024, 0.376138024,
+        0.376138024, 0.374584033, 0.37334084, 0.372408445, 0.371742449, 0.371298452,
+        0.371032053, 0.370898854, 0.370854454, 0.370854454, 0.370854454, 0.369611262,
+        0.368678867, 0.368012871, 0.367568873, 0.367302475, 0.367169276, 0.367124876,
+        0.367124876, 0.367124876, 0.366236881, 0.365570885, 0.365126888, 0.364860489,
+        0.36472729, 0.36468289, 0.36468289, 0.36468289, 0.364061294, 0.363617296,
+        0.363350898, 0.363217699, 0.363173299, 0.363173299, 0.363173299, 0.362773701,
+        0.362507303, 0.362374104, 0.362329704, 0.362329704, 0.362329704, 0.362107705,
+        0.361974506, 0.361930106, 0.361930106, 0.361930106, 0.361841307, 0.361796907,
+        0.361796907, 0.361796907, 0.361796907, 0.361796907, 0.361796907, 0.361796907,
+        0.361796907, 0.361796907, 0.360598114, 0.359665719, 0.358999723, 0.358555726,
+        0.358289327, 0.358156128, 0.358111728, 0.358111728, 0.358111728, 0.357223733,
+        0.356557737, 0.35611374, 0.355847341, 0.355714142, 0.355669742, 0.355669742,
+        0.355669742, 0.355048146, 0.354604149, 0.35433775, 0.354204551, 0.354160151,
+        0.354160151, 0.354160151, 0.353760554, 0.353494155, 0.353360956, 0.353316556,
+        0.353316556, 0.353316556, 0.353094557, 0.352961358, 0.352916958, 0.352916958,
+        0.352916958, 0.352828159, 0.352783759, 0.352783759, 0.352783759, 0.352739359,
+        0.352739359, 0.352739359, 0.352739359, 0.352739359, 0.352739359, 0.351851365,
+        0.351185368, 0.350741371, 0.350474973, 0.350341773, 0.350297374, 0.350297374,
+        0.350297374, 0.349675777, 0.34923178, 0.348965381, 0.348832182, 0.348787782,
+        0.348787782, 0.348787782, 0.348388185, 0.348121786, 0.347988587, 0.347944187,
+        0.347944187, 0.347944187, 0.347722189, 0.347588989, 0.34754459, 0.34754459,
+        0.34754459, 0.34745579, 0.34741139, 0.34741139, 0.34741139, 0.347366991,
+        0.347366991, 0.347366991, 0.347366991, 0.347366991, 0.347366991, 0.346922993,
+        0.346478996, 0.346212597, 0.346079398, 0.346034998, 0.346034998, 0.346034998,
+        0.345635401, 0.345369002, 0.345235803, 0.345191403, 0.345191403, 0.345191403,
+        0.344969405, 0.344836205, 0.344791806, 0.344791806, 0.344791806, 0.344703006,
+        0.344658606, 0.344658606, 0.344658606, 0.344614207, 0.344614207, 0.344614207,
+        0.344614207, 0.344614207, 0.344614207, 0.344347808, 0.34408141, 0.34394821,
+        0.343903811, 0.343903811, 0.343903811, 0.343681812, 0.343548613, 0.343504213,
+        0.343504213, 0.343504213, 0.343415414, 0.343371014, 0.343371014, 0.343371014,
+        0.343326614, 0.343326614, 0.343326614, 0.343326614, 0.343326614, 0.343326614,
+        0.343193415, 0.343060216, 0.343015816, 0.343015816, 0.343015816, 0.342927016,
+        0.342882617, 0.342882617, 0.342882617, 0.342838217, 0.342838217, 0.342838217,
+        0.342838217, 0.342838217, 0.342838217, 0.342793817, 0.342749417, 0.342749417,
+        0.342749417, 0.342705018, 0.342705018, 0.342705018, 0.342705018, 0.342705018,
+        0.342705018, 0.342705018, 0.342705018, 0.342705018, 0.342705018, 0.342705018,
+        0.342705018, 0.342705018, 0.342705018, 0.342705018, 0.342705018, 0.341151027,
+        0.339907834, 0.338975439, 0.338309443, 0.337865446, 0.337599047, 0.337465848,
+        0.337421448, 0.337421448, 0.337421448, 0.336178256, 0.335245861, 0.334579865,
+        0.334135867, 0.333869469, 0.33373627, 0.33369187, 0.33369187, 0.33369187,
+        0.332759475, 0.332093479, 0.331649482, 0.331383083, 0.331249884, 0.331205484,
+        0.331205484, 0.331205484, 0.330583888, 0.330139891, 0.329873492, 0.329740293,
+        0.329695893, 0.329695893, 0.329695893, 0.329296295, 0.329029897, 0.328896698,
+        0.328852298, 0.328852298, 0.328852298, 0.328630299, 0.3284971, 0.3284527,
+        0.3284527, 0.3284527, 0.328363901, 0.328319501, 0.328319501, 0.328319501,
+        0.328319501, 0.328319501, 0.328319501, 0.328319501, 0.328319501, 0.328319501,
+        0.327120708, 0.326188314, 0.325522317, 0.32507832, 0.324811921, 0.324678722,
+        0.324634323, 0.324634323, 0.324634323, 0.323701928, 0.323035932, 0.322591934,
+        0.322325536, 0.322192337, 0.322147937, 0.322147937, 0.322147937, 0.321526341,
+        0.321082343, 0.320815945, 0.320682745, 0.320638346, 0.320638346, 0.320638346,
+        0.320238748, 0.31997235, 0.31983915, 0.319794751, 0.319794751, 0.319794751,
+        0.319572752, 0.319439553, 0.319395153, 0.319395153, 0.319395153, 0.319306353,
+        0.319261954, 0.319261954, 0.319261954, 0.319261954, 0.319261954, 0.319261954,
+        0.319261954, 0.319261954, 0.319261954, 0.318373959, 0.317707963, 0.317263965,
+        0.316997567, 0.316864368, 0.316819968, 0.316819968, 0.316819968, 0.316198371,
+        0.315754374, 0.315487976, 0.315354776, 0.315310377, 0.315310377, 0.315310377,
+        0.314910779, 0.31464438, 0.314511181, 0.314466782, 0.314466782, 0.314466782,
+        0.314244783, 0.314111584, 0.314067184, 0.314067184, 0.314067184, 0.313978384,
+        0.313933985, 0.313933985, 0.313933985, 0.313933985, 0.313933985, 0.313933985,
+        0.313933985, 0.313933985, 0.313933985, 0.313312388, 0.312868391, 0.312601992,
+        0.312468793, 0.312424393, 0.312424393, 0.312424393, 0.312024796, 0.311758397,
+        0.311625198, 0.311580798, 0.311580798, 0.311580798, 0.3113588, 0.3112256,
+        0.311181201, 0.311181201, 0.311181201, 0.311092401, 0.311048001, 0.311048001,
+        0.311048001, 0.311048001, 0.311048001, 0.311048001, 0.311048001, 0.311048001,
+        0.311048001, 0.310781603, 0.310515204, 0.310382005, 0.310337605, 0.310337605,
+        0.310337605, 0.310115607, 0.309982408, 0.309938008, 0.309938008, 0.309938008,
+        0.309849208, 0.309804809, 0.309804809, 0.309804809, 0.309804809, 0.309804809,
+        0.309804809, 0.309804809, 0.309804809, 0.309804809, 0.309671609, 0.30953841,
+        0.30949401, 0.30949401, 0.30949401, 0.309405211, 0.309360811, 0.309360811,
+        0.309360811, 0.309360811, 0.309360811, 0.309360811, 0.309360811, 0.309360811,
+        0.309360811, 0.309316411, 0.309272012, 0.309272012, 0.309272012, 0.309272012,
+        0.309272012, 0.309272012, 0.309272012, 0.309272012, 0.309272012, 0.309272012,
+        0.309272012, 0.309272012, 0.309272012, 0.309272012, 0.309272012, 0.309272012,
+        0.309272012, 0.309272012, 0.309272012, 0.307718021, 0.306474828, 0.305542433,
+        0.304876437, 0.30443244, 0.304166041, 0.304032842, 0.304032842, 0.304032842,
+        0.304032842, 0.302789649, 0.301857255, 0.301191259, 0.300747261, 0.300480863,
+        0.300347663, 0.300347663, 0.300347663, 0.300347663, 0.299415269, 0.298749273,
+        0.298305275, 0.298038877, 0.297905678, 0.297905678, 0.297905678, 0.297905678,
+        0.297239681, 0.296795684, 0.296529286, 0.296396086, 0.296396086, 0.296396086,
+        0.296396086, 0.295996489, 0.29573009, 0.295596891, 0.295596891, 0.295596891,
+        0.295596891, 0.295374892, 0.295241693, 0.295241693, 0.295241693, 0.295241693,
+        0.295152894, 0.295152894, 0.295152894, 0.295152894, 0.295152894, 0.295152894,
+        0.295152894, 0.295152894, 0.295152894, 0.295152894, 0.293954101, 0.293021706,
+        0.29235571, 0.291911712, 0.291645314, 0.291512115, 0.291467715, 0.291467715,
+        0.291467715, 0.29053532, 0.289869324, 0.289425327, 0.289158928, 0.289025729,
+        0.288981329, 0.288981329, 0.288981329, 0.288315333, 0.287871336, 0.287604937,
+        0.287471738, 0.287427338, 0.287427338, 0.287427338, 0.287027741, 0.286761342,
+        0.286628143, 0.286583743, 0.286583743, 0.286583743, 0.286361745, 0.286228545,
+        0.286184146, 0.286184146, 0.286184146, 0.286095346, 0.286050946, 0.286050946,
+        0.286050946, 0.286050946, 0.286050946, 0.286050946, 0.286050946, 0.286050946,
+        0.286050946, 0.285162952, 0.284496955, 0.284052958, 0.28378656, 0.28365336,
+        0.283608961, 0.283608961, 0.283608961, 0.282942964, 0.282498967, 0.282232569,
+        0.282099369, 0.28205497, 0.28205497, 0.28205497, 0.281655372, 0.281388973,
+        0.281255774, 0.281211374, 0.281211374, 0.281211374, 0.280989376, 0.280856177,
+        0.280811777, 0.280811777, 0.280811777, 0.280722977, 0.280678578, 0.280678578,
+        0.280678578, 0.280678578, 0.280678578, 0.280678578, 0.280678578, 0.280678578,
+        0.280678578, 0.280056981, 0.279612984, 0.279346585, 0.279213386, 0.279168986,
+        0.279168986, 0.279168986, 0.278769389, 0.27850299, 0.278369791, 0.278325391,
+        0.278325391, 0.278325391, 0.278103392, 0.277970193, 0.277925794, 0.277925794,
+        0.277925794, 0.277836994, 0.277792594, 0.277792594, 0.277792594, 0.277792594,
+        0.277792594, 0.277792594, 0.277792594, 0.277792594, 0.277792594, 0.277392997,
+        0.277126598, 0.276993399, 0.276948999, 0.276948999, 0.276948999, 0.276727,
+        0.276593801, 0.276549402, 0.276549402, 0.276549402, 0.276460602, 0.276416202,
+        0.276416202, 0.276416202, 0.276416202, 0.276416202, 0.276416202, 0.276416202,
+        0.276416202, 0.276416202, 0.276283003, 0.276149804, 0.276105404, 0.276105404,
+        0.276105404, 0.276016605, 0.275972205, 0.275972205, 0.275972205, 0.275972205,
+        0.275972205, 0.275972205, 0.275972205, 0.275972205, 0.275972205, 0.275927805,
+        0.275883405, 0.275883405, 0.275883405, 0.275883405, 0.275883405, 0.275883405,
+        0.275883405, 0.275883405, 0.275883405, 0.275883405, 0.275883405, 0.275883405,
+        0.275883405, 0.275883405, 0.275883405, 0.275883405, 0.275883405, 0.275883405,
+        0.275883405, 0.274329414, 0.273086222, 0.272153827, 0.271487831, 0.271043833,
+        0.270777435, 0.270644236, 0.270644236, 0.270644236, 0.270644236, 0.269401043,
+        0.268468648, 0.267802652, 0.267358655, 0.267092256, 0.266959057, 0.266959057,
+        0.266959057, 0.266959057, 0.266026663, 0.265360666, 0.264916669, 0.264650271,
+        0.264517071, 0.264517071, 0.264517071, 0.264517071, 0.263851075, 0.263407078,
+        0.263140679, 0.26300748, 0.26300748, 0.26300748, 0.26300748, 0.262563483,
+        0.262297084, 0.262163885, 0.262163885, 0.262163885, 0.262163885, 0.261941886,
+        0.261808687, 0.261808687, 0.261808687, 0.261808687, 0.261719888, 0.261719888,
+        0.261719888, 0.261719888, 0.261719888, 0.261719888, 0.261719888, 0.261719888,
+        0.261719888, 0.261719888, 0.260521095, 0.2595887, 0.258922704, 0.258478706,
+        0.258212308, 0.258079109, 0.258034709, 0.258034709, 0.258034709, 0.257102314,
+        0.256436318, 0.255992321, 0.255725922, 0.255592723, 0.255548323, 0.255548323,
+        0.255548323, 0.254882327, 0.25443833, 0.254171931, 0.254038732, 0.253994332,
+        0.253994332, 0.253994332, 0.253550335, 0.253283937, 0.253150737, 0.253106338,
+        0.253106338, 0.253106338, 0.252884339, 0.25275114, 0.25270674, 0.25270674,
+        0.25270674, 0.25261794, 0.252573541, 0.252573541, 0.252573541, 0.252573541,
+        0.252573541, 0.252573541, 0.252573541, 0.252573541, 0.252573541, 0.251685546,
+        0.25101955, 0.250575552, 0.250309154, 0.250175955, 0.250131555, 0.250131555,
+        0.250131555, 0.249465559, 0.249021561, 0.248755163, 0.248621964, 0.248577564,
+        0.248577564, 0.248577564, 0.248133566, 0.247867168, 0.247733969, 0.247689569,
+        0.247689569, 0.247689569, 0.24746757, 0.247334371, 0.247289971, 0.247289971,
+        0.247289971, 0.247201172, 0.247156772, 0.247156772, 0.247156772, 0.247156772,
+        0.247156772, 0.247156772, 0.247156772, 0.247156772, 0.247156772, 0.246535176,
+        0.246091178, 0.24582478, 0.245691581, 0.245647181, 0.245647181, 0.245647181,
+        0.245203183, 0.244936785, 0.244803586, 0.244759186, 0.244759186, 0.244759186,
+        0.244537187, 0.244403988, 0.244359588, 0.244359588, 0.244359588, 0.244270789,
+        0.244226389, 0.244226389, 0.244226389, 0.244226389, 0.244226389, 0.244226389,
+        0.244226389, 0.244226389, 0.244226389, 0.243826791, 0.243560393, 0.243427194,
+        0.243382794, 0.243382794, 0.243382794, 0.243160795, 0.243027596, 0.242983196,
+        0.242983196, 0.242983196, 0.242894397, 0.242849997, 0.242849997, 0.242849997,
+        0.242849997, 0.242849997, 0.242849997, 0.242849997, 0.242849997, 0.242849997,
+        0.242627998, 0.242494799, 0.242450399, 0.242450399, 0.242450399, 0.2423616,
+        0.2423172, 0.2423172, 0.2423172, 0.2423172, 0.2423172, 0.2423172,
+        0.2423172, 0.2423172, 0.2423172, 0.2422728, 0.242228401, 0.242228401,
+        0.242228401, 0.242228401, 0.242228401, 0.242228401, 0.242228401, 0.242228401,
+        0.242228401, 0.242228401, 0.242228401, 0.242228401, 0.242228401, 0.242228401,
+        0.242228401, 0.242228401, 0.242228401, 0.242228401, 0.242228401, 0.24067441,
+        0.239431217, 0.238498822, 0.237832826, 0.237388829, 0.23712243, 0.236989231,
+        0.236989231, 0.236989231, 0.236989231, 0.235746038, 0.234813644, 0.234147648,
+        0.23370365, 0.233437252, 0.233304052, 0.233304052, 0.233304052, 0.233304052,
+        0.232371658, 0.231705662, 0.231261664, 0.230995266, 0.230862067, 0.230862067,
+        0.230862067, 0.230862067, 0.23019607, 0.229752073, 0.229485675, 0.229352475,
+        0.229352475, 0.229352475, 0.229352475, 0.228908478, 0.228642079, 0.22850888,
+        0.22850888, 0.22850888, 0.22850888, 0.228242482, 0.228109283, 0.228109283,
+        0.228109283, 0.228109283, 0.228020483, 0.228020483, 0.228020483, 0.228020483,
+        0.228020483, 0.228020483, 0.228020483, 0.228020483, 0.228020483, 0.228020483,
+        0.22682169, 0.225889295, 0.225223299, 0.224779302, 0.224512903, 0.224379704,
+        0.224335304, 0.224335304, 0.224335304, 0.22340291, 0.222736914, 0.222292916,
+        0.222026518, 0.221893319, 0.221848919, 0.221848919, 0.221848919, 0.221182923,
+        0.220738925, 0.220472527, 0.220339328, 0.220294928, 0.220294928, 0.220294928,
+        0.21985093, 0.219584532, 0.219451333, 0.219406933, 0.219406933, 0.219406933,
+        0.219140535, 0.219007335, 0.218962936, 0.218962936, 0.218962936, 0.218874136,
+        0.218829736, 0.218829736, 0.218829736, 0.218829736, 0.218829736, 0.218829736,
+        0.218829736, 0.218829736, 0.218829736, 0.217941742, 0.217275745, 0.216831748,
+        0.21656535, 0.21643215, 0.216387751, 0.216387751, 0.216387751, 0.215721754,
+        0.215277757, 0.215011359, 0.214878159, 0.21483376, 0.21483376, 0.21483376,
+        0.214389762, 0.214123364, 0.213990164, 0.213945765, 0.213945765, 0.213945765,
+        0.213679366, 0.213546167, 0.213501767, 0.213501767, 0.213501767, 0.213412968,
+        0.213368568, 0.213368568, 0.213368568, 0.213368568, 0.213368568, 0.213368568,
+        0.213368568, 0.213368568, 0.213368568, 0.212746972, 0.212302974, 0.212036576,
+        0.211903377, 0.211858977, 0.211858977, 0.211858977, 0.211414979, 0.211148581,
+        0.211015382, 0.210970982, 0.210970982, 0.210970982, 0.210704584, 0.210571384,
+        0.210526985, 0.210526985, 0.210526985, 0.210438185, 0.210393785, 0.210393785,
+        0.210393785, 0.210393785, 0.210393785, 0.210393785, 0.210393785, 0.210393785,
+        0.210393785, 0.209994188, 0.209727789, 0.20959459, 0.20955019, 0.20955019,
+        0.20955019, 0.209283792, 0.209150593, 0.209106193, 0.209106193, 0.209106193,
+        0.209017393, 0.208972994, 0.208972994, 0.208972994, 0.208972994, 0.208972994,
+        0.208972994, 0.208972994, 0.208972994, 0.208972994, 0.208750995, 0.208617796,
+        0.208573396, 0.208573396, 0.208573396, 0.208484596, 0.208440197, 0.208440197,
+        0.208440197, 0.208440197, 0.208440197, 0.208440197, 0.208440197, 0.208440197,
+        0.208440197, 0.208351397, 0.208306997, 0.208306997, 0.208306997, 0.208306997,
+        0.208306997, 0.208306997, 0.208306997, 0.208306997, 0.208306997, 0.208306997,
+        0.208306997, 0.208306997, 0.208306997, 0.208306997, 0.208306997, 0.208306997,
+        0.208306997, 0.208306997, 0.208306997, 0.206753006, 0.205509814, 0.204577419,
+        0.203911423, 0.203467426, 0.203201027, 0.203067828, 0.203067828, 0.203067828,
+        0.203067828, 0.201824635, 0.20089224, 0.200226244, 0.199782247, 0.199515848,
+        0.199382649, 0.199382649, 0.199382649, 0.199382649, 0.198450255, 0.197784259,
+        0.197340261, 0.197073863, 0.196940663, 0.196940663, 0.196940663, 0.196940663,
+        0.196274667, 0.19583067, 0.195564271, 0.195431072, 0.195431072, 0.195431072,
+        0.195431072, 0.194987075, 0.194720676, 0.194587477, 0.194587477, 0.194587477,
+        0.194587477, 0.194321079, 0.194187879, 0.194187879, 0.194187879, 0.194187879,
+        0.19405468, 0.19405468, 0.19405468, 0.19405468, 0.19405468, 0.19405468,
+        0.19405468, 0.19405468, 0.19405468, 0.19405468, 0.192855887, 0.191923493,
+        0.191257496, 0.190813499, 0.190547101, 0.190413901, 0.190369502, 0.190369502,
+        0.190369502, 0.189437107, 0.188771111, 0.188327113, 0.188060715, 0.187927516,
+        0.187883116, 0.187883116, 0.187883116, 0.18721712, 0.186773122, 0.186506724,
+        0.186373525, 0.186329125, 0.186329125, 0.186329125, 0.185885128, 0.185618729,
+        0.18548553, 0.18544113, 0.18544113, 0.18544113, 0.185174732, 0.185041532,
+        0.184997133, 0.184997133, 0.184997133, 0.184863933, 0.184819534, 0.184819534,
+        0.184819534, 0.184819534, 0.184819534, 0.184819534, 0.184819534, 0.184819534,
+        0.184819534, 0.183931539, 0.183265543, 0.182821545, 0.182555147, 0.182421948,
+        0.182377548, 0.182377548, 0.182377548, 0.181711552, 0.181267554, 0.181001156,
+        0.180867957, 0.180823557, 0.180823557, 0.180823557, 0.180379559, 0.180113161,
+        0.179979962, 0.179935562, 0.179935562, 0.179935562, 0.179669164, 0.179535964,
+        0.179491565, 0.179491565, 0.179491565, 0.179358365, 0.179313966, 0.179313966,
+        0.179313966, 0.179313966, 0.179313966, 0.179313966, 0.179313966, 0.179313966,
+        0.179313966, 0.178692369, 0.178248372, 0.177981973, 0.177848774, 0.177804374,
+        0.177804374, 0.177804374, 0.177360377, 0.177093979, 0.176960779, 0.17691638,
+        0.17691638, 0.17691638, 0.176649981, 0.176516782, 0.176472382, 0.176472382,
+        0.176472382, 0.176339183, 0.176294783, 0.176294783, 0.176294783, 0.176294783,
+        0.176294783, 0.176294783, 0.176294783, 0.176294783, 0.176294783, 0.175895186,
+        0.175628787, 0.175495588, 0.175451188, 0.175451188, 0.175451188, 0.17518479,
+        0.17505159, 0.175007191, 0.175007191, 0.175007191, 0.174873991, 0.174829592,
+        0.174829592, 0.174829592, 0.174829592, 0.174829592, 0.174829592, 0.174829592,
+        0.174829592, 0.174829592, 0.174607593, 0.174474394, 0.174429994, 0.174429994,
+        0.174429994, 0.174296795, 0.174252395, 0.174252395, 0.174252395, 0.174252395,
+        0.174252395, 0.174252395, 0.174252395, 0.174252395, 0.174252395, 0.174163596,
+        0.174119196, 0.174119196, 0.174119196, 0.174119196, 0.174119196, 0.174119196,
+        0.174119196, 0.174119196, 0.174119196, 0.174119196, 0.174119196, 0.174119196,
+        0.174119196, 0.174119196, 0.174119196, 0.174119196, 0.174119196, 0.174119196,
+        0.174119196, 0.171679901, 0.169937547, 0.168775978, 0.168079037, 0.167730566,
+        0.167614409, 0.167614409, 0.167614409, 0.165175114, 0.163432761, 0.162271192,
+        0.16157425, 0.16122578, 0.161109623, 0.161109623, 0.161109623, 0.159367269,
+        0.1582057, 0.157508759, 0.157160288, 0.157044131, 0.157044131, 0.157044131,
+        0.155882562, 0.155185621, 0.15483715, 0.154720993, 0.154720993, 0.154720993,
+        0.154024052, 0.153675581, 0.153559424, 0.153559424, 0.153559424, 0.153210953,
+        0.153094797, 0.153094797, 0.153094797, 0.153094797, 0.153094797, 0.153094797,
+        0.153094797, 0.153094797, 0.153094797, 0.150771659, 0.149029305, 0.147867736,
+        0.147170795, 0.146822324, 0.146706167, 0.146706167, 0.146706167, 0.144963813,
+        0.143802244, 0.143105303, 0.142756832, 0.142640675, 0.142640675, 0.142640675,
+        0.141479106, 0.140782165, 0.140433694, 0.140317537, 0.140317537, 0.140317537,
+        0.139620596, 0.139272125, 0.139155968, 0.139155968, 0.139155968, 0.138807498,
+        0.138691341, 0.138691341, 0.138691341, 0.138691341, 0.138691341, 0.138691341,
+        0.138691341, 0.138691341, 0.138691341, 0.137065144, 0.135903575, 0.135206634,
+        0.134858163, 0.134742006, 0.134742006, 0.134742006, 0.133580437, 0.132883496,
+        0.132535025, 0.132418868, 0.132418868, 0.132418868, 0.131721927, 0.131373456,
+        0.131257299, 0.131257299, 0.131257299, 0.130908828, 0.130792671, 0.130792671,
+        0.130792671, 0.130792671, 0.130792671, 0.130792671, 0.130792671, 0.130792671,
+        0.130792671, 0.129747259, 0.129050318, 0.128701847, 0.12858569, 0.12858569,
+        0.12858569, 0.127888749, 0.127540278, 0.127424121, 0.127424121, 0.127424121,
+        0.127075651, 0.126959494, 0.126959494, 0.126959494, 0.126959494, 0.126959494,
+        0.126959494, 0.126959494, 0.126959494, 0.126959494, 0.126378709, 0.126030238,
+        0.125914082, 0.125914082, 0.125914082, 0.125565611, 0.125449454, 0.125449454,
+        0.125449454, 0.125449454, 0.125449454, 0.125449454, 0.125449454, 0.125449454,
+        0.125449454, 0.12521714, 0.125100983, 0.125100983, 0.125100983, 0.125100983,
+        0.125100983, 0.125100983, 0.125100983, 0.125100983, 0.125100983, 0.125100983,
+        0.125100983, 0.125100983, 0.125100983, 0.125100983, 0.125100983, 0.125100983,
+        0.125100983, 0.125100983, 0.125100983, 0.12335863, 0.121616276, 0.120454707,
+        0.119757766, 0.119409295, 0.119293138, 0.119293138, 0.119293138, 0.117550785,
+        0.116389216, 0.115692274, 0.115343804, 0.115227647, 0.115227647, 0.115227647,
+        0.114066078, 0.113369136, 0.113020665, 0.112904509, 0.112904509, 0.112904509,
+        0.112207567, 0.111859096, 0.11174294, 0.11174294, 0.11174294, 0.111394469,
+        0.111278312, 0.111278312, 0.111278312, 0.111278312, 0.111278312, 0.111278312,
+        0.111278312, 0.111278312, 0.111278312, 0.109652115, 0.108490546, 0.107793605,
+        0.107445134, 0.107328977, 0.107328977, 0.107328977, 0.106167408, 0.105470467,
+        0.105121996, 0.105005839, 0.105005839, 0.105005839, 0.104308898, 0.103960427,
+        0.10384427, 0.10384427, 0.10384427, 0.1034958, 0.103379643, 0.103379643,
+        0.103379643, 0.103379643, 0.103379643, 0.103379643, 0.103379643, 0.103379643,
+        0.103379643, 0.10233423, 0.101637289, 0.101288818, 0.101172661, 0.101172661,
+        0.101172661, 0.10047572, 0.100127249, 0.100011092, 0.100011092, 0.100011092,
+        0.0996626218, 0.0995464649, 0.0995464649, 0.0995464649, 0.0995464649, 0.0995464649,
+        0.0995464649, 0.0995464649, 0.0995464649, 0.0995464649, 0.0989656803, 0.0986172096,
+        0.0985010527, 0.0985010527, 0.0985010527, 0.098152582, 0.0980364251, 0.0980364251,
+        0.0980364251, 0.0980364251, 0.0980364251, 0.0980364251, 0.0980364251, 0.0980364251,
+        0.0980364251, 0.0978041113, 0.0976879544, 0.0976879544, 0.0976879544, 0.0976879544,
+        0.0976879544, 0.0976879544, 0.0976879544, 0.0976879544, 0.0976879544, 0.0976879544,
+        0.0976879544, 0.0976879544, 0.0976879544, 0.0976879544, 0.0976879544, 0.0976879544,
+        0.0976879544, 0.0976879544, 0.0976879544, 0.0965263854, 0.0953648164, 0.094667875,
+        0.0943194043, 0.0942032474, 0.0942032474, 0.0942032474, 0.0930416784, 0.0923447369,
+        0.0919962662, 0.0918801093, 0.0918801093, 0.0918801093, 0.0911831679, 0.0908346972,
+        0.0907185403, 0.0907185403, 0.0907185403, 0.0903700696, 0.0902539127, 0.0902539127,
+        0.0902539127, 0.0902539127, 0.0902539127, 0.0902539127, 0.0902539127, 0.0902539127,
+        0.0902539127, 0.0892085006, 0.0885115592, 0.0881630885, 0.0880469316, 0.0880469316,
+        0.0880469316, 0.0873499902, 0.0870015195, 0.0868853626, 0.0868853626, 0.0868853626,
+        0.0865368919, 0.0864207349, 0.0864207349, 0.0864207349, 0.0864207349, 0.0864207349,
+        0.0864207349, 0.0864207349, 0.0864207349, 0.0864207349, 0.0858399504, 0.0854914797,
+        0.0853753228, 0.0853753228, 0.0853753228, 0.0850268521, 0.0849106952, 0.0849106952,
+        0.0849106952, 0.0849106952, 0.0849106952, 0.0849106952, 0.0849106952, 0.0849106952,
+        0.0849106952, 0.0846783814, 0.0845622245, 0.0845622245, 0.0845622245, 0.0845622245,
+        0.0845622245, 0.0845622245, 0.0845622245, 0.0845622245, 0.0845622245, 0.0845622245,
+        0.0845622245, 0.0845622245, 0.0845622245, 0.0845622245, 0.0845622245, 0.0845622245,
+        0.0845622245, 0.0845622245, 0.0845622245, 0.0838652831, 0.0831683417, 0.082819871,
+        0.0827037141, 0.0827037141, 0.0827037141, 0.0820067727, 0.081658302, 0.0815421451,
+        0.0815421451, 0.0815421451, 0.0811936744, 0.0810775175, 0.0810775175, 0.0810775175,
+        0.0810775175, 0.0810775175, 0.0810775175, 0.0810775175, 0.0810775175, 0.0810775175,
+        0.080496733, 0.0801482623, 0.0800321053, 0.0800321053, 0.0800321053, 0.0796836346,
+        0.0795674777, 0.0795674777, 0.0795674777, 0.0795674777, 0.0795674777, 0.0795674777,
+        0.0795674777, 0.0795674777, 0.0795674777, 0.0793351639, 0.079219007, 0.079219007,
+        0.079219007, 0.079219007, 0.079219007, 0.079219007, 0.079219007, 0.079219007,
+        0.079219007, 0.079219007, 0.079219007, 0.079219007, 0.079219007, 0.079219007,
+        0.079219007, 0.079219007, 0.079219007, 0.079219007, 0.079219007, 0.0788705363,
+        0.0785220656, 0.0784059087, 0.0784059087, 0.0784059087, 0.078057438, 0.0779412811,
+        0.0779412811, 0.0779412811, 0.0779412811, 0.0779412811, 0.0779412811, 0.0779412811,
+        0.0779412811, 0.0779412811, 0.0777089673, 0.0775928104, 0.0775928104, 0.0775928104,
+        0.0775928104, 0.0775928104, 0.0775928104, 0.0775928104, 0.0775928104, 0.0775928104,
+        0.0775928104, 0.0775928104, 0.0775928104, 0.0775928104, 0.0775928104, 0.0775928104,
+        0.0775928104, 0.0775928104, 0.0775928104, 0.0775928104, 0.0774766535, 0.0773604966,
+        0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966,
+        0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966,
+        0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966,
+        0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966,
+        0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966, 0.0773604966,
+        0.0773604966, 0.0773604966, 0.0756181431, 0.0744565741, 0.0737596327, 0.0734111619,
+        0.073295005, 0.073295005, 0.073295005, 0.0715526515, 0.0703910825, 0.0696941411,
+        0.0693456704, 0.0692295135, 0.0692295135, 0.0692295135, 0.0680679445, 0.0673710031,
+        0.0670225323, 0.0669063754, 0.0669063754, 0.0669063754, 0.066209434, 0.0658609633,
+        0.0657448064, 0.0657448064, 0.0657448064, 0.0653963357, 0.0652801788, 0.0652801788,
+        0.0652801788, 0.0651640219, 0.0651640219, 0.0651640219, 0.0651640219, 0.0651640219,
+        0.0651640219, 0.0635378253, 0.0623762563, 0.0616793149, 0.0613308442, 0.0612146873,
+        0.0612146873, 0.0612146873, 0.0600531182, 0.0593561768, 0.0590077061, 0.0588915492,
+        0.0588915492, 0.0588915492, 0.0581946078, 0.0578461371, 0.0577299802, 0.0577299802,
+        0.0577299802, 0.0573815095, 0.0572653526, 0.0572653526, 0.0572653526, 0.0571491957,
+        0.0571491957, 0.0571491957, 0.0571491957, 0.0571491957, 0.0571491957, 0.0561037836,
+        0.0554068422, 0.0550583715, 0.0549422146, 0.0549422146, 0.0549422146, 0.0542452731,
+        0.0538968024, 0.0537806455, 0.0537806455, 0.0537806455, 0.0534321748, 0.0533160179,
+        0.0533160179, 0.0533160179, 0.053199861, 0.053199861, 0.053199861, 0.053199861,
+        0.053199861, 0.053199861, 0.0526190765, 0.0522706058, 0.0521544489, 0.0521544489,
+        0.0521544489, 0.0518059782, 0.0516898213, 0.0516898213, 0.0516898213, 0.0515736644,
+        0.0515736644, 0.0515736644, 0.0515736644, 0.0515736644, 0.0515736644, 0.0513413506,
+        0.0512251937, 0.0512251937, 0.0512251937, 0.0511090368, 0.0511090368, 0.0511090368,
+        0.0511090368, 0.0511090368, 0.0511090368, 0.0511090368, 0.0511090368, 0.0511090368,
+        0.0511090368, 0.0511090368, 0.0511090368, 0.0511090368, 0.0511090368, 0.0511090368,
+        0.0511090368, 0.0499474678, 0.0487858988, 0.0480889574, 0.0477404866, 0.0476243297,
+        0.0476243297, 0.0476243297, 0.0464627607, 0.0457658193, 0.0454173486, 0.0453011917,
+        0.0453011917, 0.0453011917, 0.0446042503, 0.0442557796, 0.0441396227, 0.0441396227,
+        0.0441396227, 0.043791152, 0.0436749951, 0.0436749951, 0.0436749951, 0.0435588382,
+        0.0435588382, 0.0435588382, 0.0435588382, 0.0435588382, 0.0435588382, 0.0425134261,
+        0.0418164847, 0.0414680139, 0.041351857, 0.041351857, 0.041351857, 0.0406549156,
+        0.0403064449, 0.040190288, 0.040190288, 0.040190288, 0.0398418173, 0.0397256604,
+        0.0397256604, 0.0397256604, 0.0396095035, 0.0396095035, 0.0396095035, 0.0396095035,
+        0.0396095035, 0.0396095035, 0.039028719, 0.0386802483, 0.0385640914, 0.0385640914,
+        0.0385640914, 0.0382156207, 0.0380994638, 0.0380994638, 0.0380994638, 0.0379833069,
+        0.0379833069, 0.0379833069, 0.0379833069, 0.0379833069, 0.0379833069, 0.0377509931,
+        0.0376348362, 0.0376348362, 0.0376348362, 0.0375186793, 0.0375186793, 0.0375186793,
+        0.0375186793, 0.0375186793, 0.0375186793, 0.0375186793, 0.0375186793, 0.0375186793,
+        0.0375186793, 0.0375186793, 0.0375186793, 0.0375186793, 0.0375186793, 0.0375186793,
+        0.0375186793, 0.0368217379, 0.0361247965, 0.0357763258, 0.0356601689, 0.0356601689,
+        0.0356601689, 0.0349632274, 0.0346147567, 0.0344985998, 0.0344985998, 0.0344985998,
+        0.0341501291, 0.0340339722, 0.0340339722, 0.0340339722, 0.0339178153, 0.0339178153,
+        0.0339178153, 0.0339178153, 0.0339178153, 0.0339178153, 0.0333370308, 0.0329885601,
+        0.0328724032, 0.0328724032, 0.0328724032, 0.0325239325, 0.0324077756, 0.0324077756,
+        0.0324077756, 0.0322916187, 0.0322916187, 0.0322916187, 0.0322916187, 0.0322916187,
+        0.0322916187, 0.0320593049, 0.031943148, 0.031943148, 0.031943148, 0.0318269911,
+        0.0318269911, 0.0318269911, 0.0318269911, 0.0318269911, 0.0318269911, 0.0318269911,
+        0.0318269911, 0.0318269911, 0.0318269911, 0.0318269911, 0.0318269911, 0.0318269911,
+        0.0318269911, 0.0318269911, 0.0318269911, 0.0314785204, 0.0311300497, 0.0310138928,
+        0.0310138928, 0.0310138928, 0.0306654221, 0.0305492652, 0.0305492652, 0.0305492652,
+        0.0304331083, 0.0304331083, 0.0304331083, 0.0304331083, 0.0304331083, 0.0304331083,
+        0.0302007945, 0.0300846376, 0.0300846376, 0.0300846376, 0.0299684807, 0.0299684807,
+        0.0299684807, 0.0299684807, 0.0299684807, 0.0299684807, 0.0299684807, 0.0299684807,
+        0.0299684807, 0.0299684807, 0.0299684807, 0.0299684807, 0.0299684807, 0.0299684807,
+        0.0299684807, 0.0299684807, 0.0298523238, 0.0297361669, 0.0297361669, 0.0297361669,
+        0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001,
+        0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001,
+        0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001,
+        0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001,
+        0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001, 0.02962001,
+        0.02962001, 0.0284584409, 0.0277614995, 0.0274130288, 0.0272968719, 0.0272968719,
+        0.0272968719, 0.0261353029, 0.0254383615, 0.0250898908, 0.0249737339, 0.0249737339,
+        0.0249737339, 0.0242767925, 0.0239283218, 0.0238121649, 0.0238121649, 0.0238121649,
+        0.0234636942, 0.0233475373, 0.0233475373, 0.0233475373, 0.0232313804, 0.0232313804,
+        0.0232313804, 0.0232313804, 0.0232313804, 0.0232313804, 0.0221859682, 0.0214890268,
+        0.0211405561, 0.0210243992, 0.0210243992, 0.0210243992, 0.0203274578, 0.0199789871,
+        0.0198628302, 0.0198628302, 0.0198628302, 0.0195143595, 0.0193982026, 0.0193982026,
+        0.0193982026, 0.0192820457, 0.0192820457, 0.0192820457, 0.0192820457, 0.0192820457,
+        0.0192820457, 0.0187012612, 0.0183527905, 0.0182366336, 0.0182366336, 0.0182366336,
+        0.0178881629, 0.017772006, 0.017772006, 0.017772006, 0.0176558491, 0.0176558491,
+        0.0176558491, 0.0176558491, 0.0176558491, 0.0176558491, 0.0174235353, 0.0173073784,
+        0.0173073784, 0.0173073784, 0.0171912215, 0.0171912215, 0.0171912215, 0.0171912215,
+        0.0171912215, 0.0171912215, 0.0171912215, 0.0171912215, 0.0171912215, 0.0171912215,
+        0.0171912215, 0.0171912215, 0.0171912215, 0.0171912215, 0.0171912215, 0.0171912215,
+        0.0164942801, 0.0157973386, 0.0154488679, 0.015332711, 0.015332711, 0.015332711,
+        0.0146357696, 0.0142872989, 0.014171142, 0.014171142, 0.014171142, 0.0138226713,
+        0.0137065144, 0.0137065144, 0.0137065144, 0.0135903575, 0.0135903575, 0.0135903575,
+        0.0135903575, 0.0135903575, 0.0135903575, 0.013009573, 0.0126611023, 0.0125449454,
+        0.0125449454, 0.0125449454, 0.0121964747, 0.0120803178, 0.0120803178, 0.0120803178,
+        0.0119641609, 0.0119641609, 0.0119641609, 0.0119641609, 0.0119641609, 0.0119641609,
+        0.0117318471, 0.0116156902, 0.0116156902, 0.0116156902, 0.0114995333, 0.0114995333,
+        0.0114995333, 0.0114995333, 0.0114995333, 0.0114995333, 0.0114995333, 0.0114995333,
+        0.0114995333, 0.0114995333, 0.0114995333, 0.0114995333, 0.0114995333, 0.0114995333,
+        0.0114995333, 0.0114995333, 0.0111510626, 0.0108025919, 0.010686435, 0.010686435,
+        0.010686435, 0.0103379643, 0.0102218074, 0.0102218074, 0.0102218074, 0.0101056505,
+        0.0101056505, 0.0101056505, 0.0101056505, 0.0101056505, 0.0101056505, 0.00987333665,
+        0.00975717975, 0.00975717975, 0.00975717975, 0.00964102285, 0.00964102285, 0.00964102285,
+        0.00964102285, 0.00964102285, 0.00964102285, 0.00964102285, 0.00964102285, 0.00964102285,
+        0.00964102285, 0.00964102285, 0.00964102285, 0.00964102285, 0.00964102285, 0.00964102285,
+        0.00964102285, 0.00952486595, 0.00940870905, 0.00940870905, 0.00940870905, 0.00929255215,
+        0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215,
+        0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215,
+        0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215,
+        0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215,
+        0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215, 0.00929255215,
+        0.00859561073, 0.00824714003, 0.00813098313, 0.00813098313, 0.00813098313, 0.00743404172,
+        0.00708557101, 0.00696941411, 0.00696941411, 0.00696941411, 0.0066209434, 0.0065047865,
+        0.0065047865, 0.0065047865, 0.0063886296, 0.0063886296, 0.0063886296, 0.0063886296,
+        0.0063886296, 0.0063886296, 0.00580784509, 0.00545937439, 0.00534321748, 0.00534321748,
+        0.00534321748, 0.00499474678, 0.00487858988, 0.00487858988, 0.00487858988, 0.00476243297,
+        0.00476243297, 0.00476243297, 0.00476243297, 0.00476243297, 0.00476243297, 0.00453011917,
+        0.00441396227, 0.00441396227, 0.00441396227, 0.00429780537, 0.00429780537, 0.00429780537,
+        0.00429780537, 0.00429780537, 0.00429780537, 0.00429780537, 0.00429780537, 0.00429780537,
+        0.00429780537, 0.00429780537, 0.00429780537, 0.00429780537, 0.00429780537, 0.00429780537,
+        0.00429780537, 0.00394933466, 0.00360086396, 0.00348470705, 0.00348470705, 0.00348470705,
+        0.00313623635, 0.00302007945, 0.00302007945, 0.00302007945, 0.00290392255, 0.00290392255,
+        0.00290392255, 0.00290392255, 0.00290392255, 0.00290392255, 0.00267160874, 0.00255545184,
+        0.00255545184, 0.00255545184, 0.00243929494, 0.00243929494, 0.00243929494, 0.00243929494,
+        0.00243929494, 0.00243929494, 0.00243929494, 0.00243929494, 0.00243929494, 0.00243929494,
+        0.00243929494, 0.00243929494, 0.00243929494, 0.00243929494, 0.00243929494, 0.00243929494,
+        0.00232313804, 0.00220698113, 0.00220698113, 0.00220698113, 0.00209082423, 0.00209082423,
+        0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423,
+        0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423,
+        0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423,
+        0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423,
+        0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00209082423, 0.00174235353,
+        0.00162619663, 0.00162619663, 0.00162619663, 0.00127772592, 0.00116156902, 0.00116156902,
+        0.00116156902, 0.00104541212, 0.00104541212, 0.00104541212, 0.00104541212, 0.00104541212,
+        0.00104541212, 0.000813098313, 0.000696941411, 0.000696941411, 0.000696941411, 0.000580784509,
+        0.000580784509, 0.000580784509, 0.000580784509, 0.000580784509, 0.000580784509, 0.000580784509,
+        0.000580784509, 0.000580784509, 0.000580784509, 0.000580784509, 0.000580784509, 0.000580784509,
+        0.000580784509, 0.000580784509, 0.000580784509, 0.000464627607, 0.000348470705, 0.000348470705,
+        0.000348470705, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804,
+        0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804,
+        0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804,
+        0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804,
+        0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804, 0.000232313804,
+        0.000232313804, 0.000232313804, 0.000116156902, 0.000116156902, 0.000116156902, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+    },
+    /* PLO4 */
+    {
+        0, 1, 0.999907732, 0.999821424, 0.999734163, 0.999645948,
+        0.999556601, 0.99947077, 0.999379158, 0.999288619, 0.999200523, 0.999112487,
+        0.999025106, 0.998951852, 0.998890817, 0.998842537, 0.99880439, 0.998775721,
+        0.998757362, 0.998745203, 0.998737633, 0.998733938, 0.998732209, 0.99873215,
+        0.998646259, 0.9985708, 0.998513818, 0.998465955, 0.998432457, 0.998404562,
+        0.998383999, 0.998371184, 0.99836427, 0.998360515, 0.998359799, 0.998359621,
+        0.998273551, 0.998202682, 0.998142123, 0.998095095, 0.99805975, 0.998033404,
+        0.998013258, 0.998001516, 0.99799484, 0.997990847, 0.997989655, 0.997989535,
+        0.997900486, 0.997828543, 0.99777019, 0.997724473, 0.997686982, 0.997661233,
+        0.997642696, 0.997628808, 0.997621357, 0.997617483, 0.99761641, 0.997616231,
+        0.997529864, 0.997457802, 0.997400999, 0.997356832, 0.997321725, 0.997295141,
+        0.997274637, 0.997262418, 0.997255445, 0.997251868, 0.997251034, 0.997250974,
+        0.997160912, 0.997089207, 0.997031331, 0.9969877, 0.996949255, 0.996921659,
+        0.996903539, 0.996891558, 0.996883631, 0.996880531, 0.996879578, 0.996879458,
+        0.996796846, 0.99672848, 0.996667624, 0.996620655, 0.99658531, 0.996559441,
+        0.996537745, 0.99652487, 0.996518254, 0.996514738, 0.996513724, 0.996513486,
+        0.996429205, 0.996358395, 0.996298373, 0.996251106, 0.996215582, 0.996191323,
+        0.996172547, 0.996161282, 0.996153593, 0.99614948, 0.99614805, 0.99614805,
+        0.996061504, 0.995989025, 0.995929182, 0.995883584, 0.995848954, 0.995821297,
+        0.995803356, 0.995791197, 0.995783746, 0.995780528, 0.995779395, 0.995779216,
+        0.995696187, 0.995625734, 0.995563388, 0.995516956, 0.995479286, 0.995452523,
+        0.995435059, 0.995421529, 0.995414853, 0.995411217, 0.995410204, 0.995410144,
+        0.995328188, 0.995258272, 0.99519974, 0.995154679, 0.995117545, 0.995089173,
+        0.995071173, 0.995059729, 0.995053947, 0.995050073, 0.995049179, 0.995049059,
+        0.994962513, 0.994893491, 0.994835794, 0.994787991, 0.994752645, 0.994726002,
+        0.994707644, 0.994695961, 0.994688988, 0.994685054, 0.994683862, 0.994683802,
+        0.994596362, 0.994526327, 0.994469345, 0.994422138, 0.994389176, 0.994361639,
+        0.994343519, 0.994332552, 0.994325638, 0.994322419, 0.994321167, 0.994321108,
+        0.993848801, 0.993385434, 0.992932916, 0.992483616, 0.992049754, 0.991618752,
+        0.991200268, 0.990779996, 0.99037081, 0.989967644, 0.989569902, 0.989185393,
+        0.9887712, 0.988307953, 0.987851918, 0.987393439, 0.98694551, 0.986516893,
+        0.986094594, 0.985677421, 0.985265136, 0.984861255, 0.984459579, 0.98408705,
+        0.983654976, 0.983238816, 0.982775748, 0.982324243, 0.98188132, 0.981451809,
+        0.981025577, 0.980619907, 0.980213165, 0.979811549, 0.979419351, 0.979018748,
+        0.978594899, 0.978178024, 0.977765501, 0.977314353, 0.976863325, 0.976433098,
+        0.976001084, 0.97558248, 0.975163221, 0.974753678, 0.974352479, 0.973968923,
+        0.973546863, 0.973136008, 0.972708344, 0.972305119, 0.971869767, 0.971437395,
+        0.971010804, 0.970588803, 0.970180392, 0.969774365, 0.969376028, 0.968985438,
+        0.968564749, 0.968146682, 0.967734575, 0.967338383, 0.966942549, 0.966503859,
+        0.966077328, 0.965658307, 0.965241313, 0.964832306, 0.964439809, 0.964048803,
+        0.963625371, 0.963210583, 0.962799251, 0.962394953, 0.96200031, 0.961609304,
+        0.961180329, 0.960756004, 0.960345984, 0.959941149, 0.959543824, 0.959160507,
+        0.958741248, 0.958331048, 0.957920492, 0.957514524, 0.957116067, 0.956730366,
+        0.956351995, 0.955930412, 0.955517411, 0.955120265, 0.954726398, 0.954337895,
+        0.953907549, 0.953495026, 0.953080237, 0.952673972, 0.95227623, 0.951886833,
+        0.951511443, 0.951132059, 0.950717092, 0.950314939, 0.949920595, 0.949530661,
+        0.949102938, 0.948682487, 0.948272824, 0.947866321, 0.947465837, 0.947080433,
+        0.946700513, 0.946322501, 0.945955038, 0.945547342, 0.945154369, 0.944766045,
+        0.944345772, 0.943930566, 0.943523049, 0.943122268, 0.942732453, 0.942348182,
+        0.941969514, 0.941601872, 0.941231191, 0.94087708, 0.940473914, 0.940083325,
+        0.939654827, 0.939231515, 0.938821971, 0.938414752, 0.938019395, 0.937631726,
+        0.937253892, 0.936871707, 0.936517477, 0.936151624, 0.935790479, 0.935395002,
+        0.934967697, 0.934558272, 0.9341501, 0.933748543, 0.933350563, 0.932968318,
+        0.932588637, 0.932207882, 0.931842446, 0.93147999, 0.931129754, 0.930779278,
+        0.930691004, 0.930609882, 0.93053025, 0.930454433, 0.930380285, 0.930310011,
+        0.930247724, 0.930187523, 0.930103183, 0.930024087, 0.929947376, 0.929873765,
+        0.929804325, 0.92973721, 0.929675162, 0.929613709, 0.929536939, 0.929463029,
+        0.92939496, 0.929330885, 0.929264486, 0.929201066, 0.929141581, 0.929067552,
+        0.928998291, 0.928933024, 0.928871453, 0.928809345, 0.928752601, 0.928687632,
+        0.928624034, 0.928563535, 0.928507447, 0.928451717, 0.928392708, 0.928336918,
+        0.9282763, 0.928222835, 0.928165972, 0.928108752, 0.928056836, 0.928004086,
+        0.927954316, 0.927909553, 0.927825332, 0.927747607, 0.927674055, 0.927600622,
+        0.9275316, 0.927462041, 0.927400231, 0.927344501, 0.927263916, 0.927192092,
+        0.927125931, 0.927058578, 0.926997542, 0.926936686, 0.926879644, 0.926809609,
+        0.926740885, 0.926676095, 0.926612616, 0.926552951, 0.92649734, 0.926429868,
+        0.926366806, 0.926307797, 0.926252186, 0.926196039, 0.926133633, 0.926074266,
+        0.926019609, 0.92596662, 0.925910115, 0.925856173, 0.925805092, 0.925750315,
+        0.925698996, 0.925649166, 0.925571918, 0.925498962, 0.925428808, 0.925362527,
+        0.925300658, 0.925240695, 0.925188184, 0.925117433, 0.925049782, 0.924987435,
+        0.924924195, 0.924868464, 0.924814284, 0.924745917, 0.924684286, 0.924625278,
+        0.924566567, 0.924513936, 0.924451411, 0.924393535, 0.924338639, 0.924285173,
+        0.92422986, 0.924175024, 0.924124658, 0.924070954, 0.924023449, 0.923973799,
+        0.923904419, 0.923835039, 0.923773885, 0.923712492, 0.923653483, 0.923598468,
+        0.923536539, 0.923474669, 0.923416436, 0.923360109, 0.923306763, 0.923243284,
+        0.923187494, 0.92313385, 0.923083484, 0.923029065, 0.922973871, 0.922925651,
+        0.922873676, 0.92282331, 0.922776759, 0.922715306, 0.922656476, 0.922597706,
+        0.922544837, 0.922491193, 0.922433376, 0.922379315, 0.922324836, 0.922272801,
+        0.922221541, 0.922172189, 0.922123909, 0.922073364, 0.922023594, 0.921975732,
+        0.921917081, 0.921861649, 0.921810746, 0.921761036, 0.92170769, 0.921658218,
+        0.921610296, 0.921561122, 0.921513855, 0.921468318, 0.921416879, 0.921365738,
+        0.921319902, 0.92127192, 0.921227694, 0.92118305, 0.921136141, 0.921093047,
+        0.921052277, 0.921009779, 0.92092967, 0.920855045, 0.920778751, 0.92071104,
+        0.920643628, 0.9205814, 0.920520365, 0.9204638, 0.920389891, 0.920320988,
+        0.920252442, 0.920183539, 0.920120358, 0.920063317, 0.920004725, 0.919932067,
+        0.919863224, 0.919801652, 0.919739783, 0.919678628, 0.919623196, 0.919556379,
+        0.91949296, 0.919433415, 0.919374347, 0.919322968, 0.919260263, 0.919199944,
+        0.919143438, 0.919094622, 0.919040263, 0.918989599, 0.918940485, 0.918885291,
+        0.918835402, 0.918786049, 0.918711722, 0.918640077, 0.918572843, 0.918507516,
+        0.918447673, 0.918389201, 0.918330967, 0.918260515, 0.918195009, 0.918130934,
+        0.918070257, 0.918014228, 0.917957723, 0.917892277, 0.91783011, 0.917771041,
+        0.917716801, 0.917663932, 0.917602479, 0.917545319, 0.917491555, 0.917438388,
+        0.917384386, 0.917330444, 0.917280793, 0.917230368, 0.917182446, 0.91713798,
+        0.917071104, 0.917005301, 0.916944563, 0.916888177, 0.91683203, 0.916777074,
+        0.916712761, 0.916650534, 0.916590512, 0.916535079, 0.916482747, 0.916426003,
+        0.916369975, 0.916314662, 0.916264951, 0.916206002, 0.916151643, 0.916100025,
+        0.916050553, 0.916001558, 0.9159531, 0.915890574, 0.915831208, 0.915775001,
+        0.91572082, 0.915667832, 0.915609181, 0.91555196, 0.915501714, 0.915452003,
+        0.915399432, 0.915349543, 0.915299773, 0.91525197, 0.915207028, 0.915160239,
+        0.915102005, 0.915048361, 0.914994419, 0.914947152, 0.914894998, 0.91484189,
+        0.91479224, 0.914742172, 0.914693475, 0.914648414, 0.914595127, 0.914543211,
+        0.914495051, 0.914447486, 0.914401531, 0.914358616, 0.914312482, 0.914269328,
+        0.914227307, 0.914184451, 0.914117515, 0.91404897, 0.913982749, 0.9139117,
+        0.913847566, 0.91378957, 0.913734019, 0.91366595, 0.913599491, 0.913536251,
+        0.913479269, 0.913420379, 0.913367152, 0.91330117, 0.913239717, 0.913183749,
+        0.913127184, 0.913074374, 0.913012683, 0.912953794, 0.912900925, 0.912849188,
+        0.912793756, 0.912742555, 0.912693739, 0.912644267, 0.912594974, 0.912550628,
+        0.912481368, 0.912415504, 0.91235137, 0.912290096, 0.91223371, 0.912181854,
+        0.912115395, 0.912055373, 0.911995828, 0.91194278, 0.911891758, 0.91183269,
+        0.911779583, 0.911725938, 0.911674917, 0.911622345, 0.91157043, 0.911522686,
+        0.911473334, 0.911426604, 0.911380827, 0.911318481, 0.911256731, 0.911203146,
+        0.911147714, 0.911098003, 0.911041141, 0.910986543, 0.91093415, 0.910885453,
+        0.910833776, 0.910783112, 0.910733759, 0.910686851, 0.91064173, 0.910597026,
+        0.910538912, 0.910485446, 0.910435677, 0.910386562, 0.910333753, 0.910288393,
+        0.910241604, 0.910191655, 0.91014415, 0.910099089, 0.910048008, 0.909999728,
+        0.909952998, 0.909903407, 0.909858704, 0.909815848, 0.909772038, 0.909728587,
+        0.909684062, 0.909642875, 0.909581602, 0.909518659, 0.909454226, 0.909397185,
+        0.909341395, 0.909288466, 0.909225285, 0.909163773, 0.909105957, 0.909053028,
+        0.909001887, 0.908943415, 0.908886969, 0.908833146, 0.908785224, 0.908731878,
+        0.908677638, 0.908628643, 0.908581078, 0.908533454, 0.90849185, 0.90842706,
+        0.908367455, 0.908311963, 0.908254921, 0.908202648, 0.908142567, 0.908085823,
+        0.908031702, 0.907982409, 0.907927692, 0.907879651, 0.907831907, 0.907781482,
+        0.907731414, 0.907686055, 0.907626748, 0.907572985, 0.907521367, 0.907472551,
+        0.907418728, 0.907366991, 0.907316983, 0.907271564, 0.907225311, 0.907177746,
+        0.907124698, 0.907072544, 0.907028854, 0.906978726, 0.906932712, 0.906886041,
+        0.906843245, 0.906802773, 0.906762123, 0.906720936, 0.906661749, 0.906605184,
+        0.906548798, 0.906495452, 0.906444073, 0.906388879, 0.906333148, 0.906280935,
+        0.906229079, 0.906175613, 0.906124592, 0.906080842, 0.906032264, 0.905983925,
+        0.905939937, 0.90588516, 0.905831337, 0.905780137, 0.905731916, 0.905679166,
+        0.905630589, 0.905585408, 0.905537546, 0.905492127, 0.905447066, 0.905394375,
+        0.905346394, 0.905298948, 0.905251443, 0.905206323, 0.905166209, 0.90512234,
+        0.905081272, 0.905040026, 0.904994845, 0.90494293, 0.9048931, 0.904843926,
+        0.904795527, 0.904743016, 0.904694855, 0.904644787, 0.904595733, 0.904553473,
+        0.904507756, 0.90445745, 0.904406667, 0.904356837, 0.904309988, 0.904267013,
+        0.904223919, 0.904183865, 0.904141665, 0.904101729, 0.904060602, 0.904013634,
+        0.903969705, 0.903923452, 0.903876483, 0.903832376, 0.903789818, 0.903740466,
+        0.903696835, 0.903657079, 0.903613091, 0.90357244, 0.903531909, 0.903491735,
+        0.903449833, 0.903374851, 0.903301299, 0.903231382, 0.903166831, 0.903101027,
+        0.903039277, 0.902980983, 0.902907014, 0.902835071, 0.902769625, 0.902703702,
+        0.902640641, 0.902578294, 0.902522326, 0.902449965, 0.902384281, 0.902317941,
+        0.902253091, 0.902193725, 0.902139425, 0.902072012, 0.902008355, 0.901949286,
+        0.9018929, 0.901840329, 0.90177685, 0.901718616, 0.90166229, 0.901611269,
+        0.90155834, 0.901506782, 0.901460171, 0.901406765, 0.901361227, 0.901313722,
+        0.901241183, 0.901168823, 0.90110141, 0.901034534, 0.900971293, 0.900914669,
+        0.900855899, 0.900785208, 0.900717676, 0.900657117, 0.900594771, 0.900537074,
+        0.900483012, 0.900415778, 0.900354445, 0.90029186, 0.900235236, 0.900179565,
+        0.900118113, 0.900060713, 0.900005519, 0.899953306, 0.899899364, 0.899845958,
+        0.899796724, 0.899745822, 0.899698138, 0.89965266, 0.899583697, 0.89951992,
+        0.899458647, 0.899399161, 0.899341881, 0.899288237, 0.899223983, 0.899162412,
+        0.899105728, 0.899052501, 0.899001896, 0.898943782, 0.898889005, 0.898835778,
+        0.898786068, 0.89872849, 0.89867419, 0.898627281, 0.898574114, 0.898526311,
+        0.89848125, 0.898417354, 0.89835757, 0.898303211, 0.898249865, 0.898198783,
+        0.898140192, 0.898085535, 0.898030818, 0.897981465, 0.897927046, 0.897877574,
+        0.897831321, 0.897783101, 0.897736251, 0.897692621, 0.897633433, 0.897579372,
+        0.897526264, 0.897475123, 0.897420168, 0.89736706, 0.897319794, 0.897271037,
+        0.897226095, 0.897182882, 0.897130966, 0.897078991, 0.897031546, 0.896982074,
+        0.896935761, 0.896890938, 0.896841705, 0.896797657, 0.896754503, 0.896710336,
+        0.896638334, 0.896568418, 0.896499991, 0.896435559, 0.896374822, 0.896315038,
+        0.896261871, 0.896192729, 0.896126926, 0.896061838, 0.896000862, 0.895939529,
+        0.895886362, 0.895819068, 0.895758629, 0.895699382, 0.895647228, 0.89559406,
+        0.89553684, 0.895480633, 0.895428479, 0.895375311, 0.895319641, 0.895268559,
+        0.895219862, 0.895171344, 0.895121336, 0.895072699, 0.895008147, 0.89494437,
+        0.894879878, 0.894820511, 0.894760966, 0.89470917, 0.894646466, 0.894585192,
+        0.894527197, 0.894473374, 0.894419372, 0.89435792, 0.894298553, 0.894248068,
+        0.894192815, 0.894139171, 0.894086063, 0.894039869, 0.893985868, 0.893940032,
+        0.893891931, 0.893829525, 0.893768787, 0.89371103, 0.893657684, 0.893602908,
+        0.893546164, 0.89348942, 0.893438339, 0.893389106, 0.893334985, 0.893284976,
+        0.89323467, 0.893183708, 0.893134654, 0.893085897, 0.893025279, 0.892968476,
+        0.892915726, 0.892866492, 0.892815709, 0.892765999, 0.892718315, 0.892668307,
+        0.892623067, 0.892577708, 0.892524242, 0.892476261, 0.892430782, 0.892382264,
+        0.892338872, 0.892294765, 0.8922472, 0.892202199, 0.892156601, 0.892114878,
+        0.892045736, 0.891983032, 0.891919613, 0.891859233, 0.891802728, 0.891748548,
+        0.891686916, 0.891628087, 0.891569436, 0.891512871, 0.891461253, 0.891400576,
+        0.891343892, 0.891292453, 0.891241431, 0.891187549, 0.891133785, 0.891083956,
+        0.891032696, 0.890984476, 0.89093864, 0.890877306, 0.890815973, 0.890757799,
+        0.890706003, 0.890648365, 0.890596032, 0.890544176, 0.890491188, 0.890441775,
+        0.890390456, 0.890341163, 0.890294611, 0.89024806, 0.890198588, 0.890153348,
+        0.890096128, 0.890037417, 0.889983416, 0.889938235, 0.889885187, 0.889833152,
+        0.889785886, 0.889734209, 0.88969028, 0.889642775, 0.889591575, 0.88954097,
+        0.889494359, 0.889446497, 0.889403224, 0.889360785, 0.889314651, 0.889270186,
+        0.889227331, 0.889182508, 0.889121652, 0.889064789, 0.889004052, 0.888953447,
+        0.888902009, 0.888849378, 0.888796508, 0.888746083, 0.888697803, 0.888647497,
+        0.888593137, 0.888545692, 0.88849628, 0.888450205, 0.88840276, 0.888347626,
+        0.888295054, 0.888241827, 0.888193369, 0.888141453, 0.888090432, 0.888040721,
+        0.887994945, 0.887953222, 0.887909353, 0.887858808, 0.887811899, 0.887764215,
+        0.887715936, 0.887670517, 0.887625158, 0.887578785, 0.887534082, 0.88749367,
+        0.887453198, 0.887398064, 0.887345612, 0.887295067, 0.887244999, 0.887195408,
+        0.88714546, 0.887100697, 0.88705194, 0.887006283, 0.886961997, 0.88691175,
+        0.886862874, 0.886818826, 0.886772037, 0.886725485, 0.886682808, 0.886637568,
+        0.886592805, 0.886550128, 0.886505961, 0.886460781, 0.886414468, 0.886367679,
+        0.886323392, 0.886278927, 0.886238158, 0.886194348, 0.886150181, 0.886107922,
+        0.886066496, 0.886025369, 0.885982096, 0.885941565, 0.885897398, 0.885857165,
+        0.885785818, 0.885716736, 0.885653019, 0.885593832, 0.885536313, 0.885481775,
+        0.885414779, 0.885348737, 0.885287941, 0.885228038, 0.88516897, 0.885119855,
+        0.885056913, 0.884997308, 0.884940743, 0.884882569, 0.884828866, 0.884767354,
+        0.884706378, 0.884651959, 0.884602547, 0.884548068, 0.884495735, 0.884445786,
+        0.884395003, 0.884346128, 0.884300172, 0.884235084, 0.884170413, 0.884108722,
+        0.88404566, 0.883992016, 0.883937776, 0.88387388, 0.88381362, 0.88375473,
+        0.883699596, 0.883647263, 0.883587062, 0.883532107, 0.883475304, 0.883426964,
+        0.88337481, 0.883321524, 0.883271635, 0.88322258, 0.883173704, 0.883125961,
+        0.883066416, 0.883002102, 0.882941663, 0.882885993, 0.882832646, 0.882776201,
+        0.882720113, 0.88266623, 0.882615447, 0.882564425, 0.882511139, 0.882460356,
+        0.882410586, 0.882362425, 0.882315457, 0.882256269, 0.882203937, 0.882151723,
+        0.882104695, 0.882053316, 0.882003903, 0.881956279, 0.881908119, 0.881860673,
+        0.88181442, 0.881763637, 0.881712556, 0.881666064, 0.881617963, 0.881572306,
+        0.881526232, 0.881481647, 0.881437123, 0.881395578, 0.881352484, 0.8812868,
+        0.881221354, 0.881161213, 0.881104171, 0.881046414, 0.880995929, 0.880928993,
+        0.880868614, 0.880810976, 0.880755126, 0.880706429, 0.880651057, 0.880593956,
+        0.88054049, 0.880490839, 0.880436838, 0.880387783, 0.880341291, 0.880290866,
+        0.880241096, 0.880195975, 0.880134702, 0.880073488, 0.880021513, 0.879967451,
+        0.879914522, 0.87985909, 0.879805923, 0.879753113, 0.879704237, 0.879650652,
+        0.879599452, 0.879549921, 0.879502416, 0.879454195, 0.879409492, 0.87935096,
+        0.879296899, 0.879246712, 0.879194736, 0.879142344, 0.879093647, 0.879043937,
+        0.878993928, 0.878949344, 0.878904581, 0.878853261, 0.878806055, 0.878762066,
+        0.878712654, 0.878667355, 0.878623486, 0.878576338, 0.878532529, 0.878489673,
+        0.878447711, 0.878388464, 0.878329694, 0.878275156, 0.878223717, 0.878175974,
+        0.878122032, 0.87806797, 0.878015041, 0.877966046, 0.877914786, 0.877866507,
+        0.87781775, 0.877766252, 0.877717555, 0.877673507, 0.877616525, 0.877563,
+        0.877510726, 0.877460599, 0.877410233, 0.877358019, 0.877311349, 0.877264977,
+        0.877220809, 0.877174079, 0.877121985, 0.877072811, 0.877027035, 0.876977026,
+        0.876930475, 0.876887262, 0.876839161, 0.87679565, 0.876753092, 0.876711309,
+        0.876657784, 0.876606226, 0.876558959, 0.876509488, 0.876459122, 0.876411736,
+        0.876363218, 0.876312494, 0.876268268, 0.87622416, 0.876173198, 0.876124203,
+        0.876077473, 0.876033664, 0.875990212, 0.875944555, 0.875896394, 0.875852942,
+        0.875809371, 0.875767171, 0.875718772, 0.875672638, 0.875627398, 0.875585377,
+        0.875541151, 0.875498593, 0.875451922, 0.875410855, 0.875369191, 0.875330806,
+        0.875286877, 0.875245512, 0.87520349, 0.875160992, 0.875119925, 0.875056922,
+        0.874993086, 0.874935031, 0.874879241, 0.874825418, 0.874761343, 0.874699652,
+        0.874636829, 0.874579132, 0.874529958, 0.874471724, 0.874418855, 0.874366581,
+        0.874315202, 0.874261439, 0.874209821, 0.874161601, 0.874108851, 0.874064386,
+        0.874017954, 0.873957574, 0.87389791, 0.873841345, 0.873787045, 0.873736739,
+        0.87367934, 0.873625398, 0.873569906, 0.873520732, 0.873467267, 0.873416305,
+        0.873367965, 0.87331742, 0.873270333, 0.873225093, 0.873171747, 0.873119652,
+        0.873069525, 0.87302202, 0.872969925, 0.872920275, 0.872872353, 0.872822523,
+        0.872777283, 0.87273556, 0.87268275, 0.87263459, 0.872589827, 0.872541249,
+        0.872498333, 0.872454166, 0.872406006, 0.872363985, 0.872321367, 0.872279823,
+        0.872216642, 0.872156501, 0.872099996, 0.872047722, 0.871999383, 0.871941924,
+        0.871885478, 0.871833563, 0.87178576, 0.8717314, 0.871682286, 0.871634781,
+        0.871584117, 0.871539712, 0.871500552, 0.871443391, 0.8713907, 0.871342182,
+        0.871296465, 0.871245325, 0.871197164, 0.871147215, 0.871099353, 0.871053159,
+        0.871010482, 0.870960474, 0.870913029, 0.870865822, 0.870820761, 0.870774925,
+        0.870731115, 0.870686412, 0.8706429, 0.870601892, 0.87055999, 0.870506108,
+        0.870453656, 0.870404899, 0.870356679, 0.870304406, 0.870256364, 0.870209336,
+        0.87016052, 0.870114803, 0.870071113, 0.870020747, 0.869974673, 0.869929194,
+        0.869881928, 0.869837463, 0.869794786, 0.869747341, 0.869703829, 0.869660258,
+        0.869617164, 0.869567335, 0.869518161, 0.869473636, 0.869427264, 0.869381964,
+        0.869339645, 0.869292378, 0.869243741, 0.86920172, 0.869163811, 0.869119823,
+        0.869077504, 0.869037211, 0.868995786, 0.868951559, 0.868894815, 0.868839562,
+        0.868786156, 0.868735909, 0.868682146, 0.868622661, 0.868570566, 0.868522286,
+        0.868468344, 0.868419886, 0.868372619, 0.86832583, 0.868278682, 0.868236959,
+        0.868180633, 0.868123353, 0.868072867, 0.868022382, 0.867971063, 0.867919505,
+        0.86787349, 0.867826521, 0.867781937, 0.867737591, 0.867687285, 0.867639244,
+        0.867591381, 0.867545545, 0.86750263, 0.867460728, 0.867412448, 0.86736995,
+        0.867326736, 0.867288053, 0.867235482, 0.867184103, 0.867134273, 0.867085993,
+        0.867035151, 0.866985559, 0.866938055, 0.86689198, 0.866847396, 0.866804421,
+        0.866757929, 0.866709352, 0.866661549, 0.866612911, 0.866569519, 0.866527557,
+        0.866482437, 0.866440296, 0.866399109, 0.866359055, 0.86630863, 0.866261721,
+        0.866213322, 0.866165102, 0.866120338, 0.86607796, 0.866031408, 0.865984797,
+        0.865940392, 0.865901053, 0.865860999, 0.865819037, 0.865778685, 0.865737498,
+        0.865696013, 0.865644217, 0.86559397, 0.865546107, 0.86549592, 0.865444958,
+        0.865398884, 0.865351915, 0.865305662, 0.86526376, 0.865209937, 0.865162551,
+        0.86511606, 0.865072489, 0.865030289, 0.864985466, 0.864938498, 0.864894748,
+        0.864854813, 0.864812136, 0.86476475, 0.86471647, 0.864669979, 0.864621997,
+        0.864578784, 0.864533961, 0.864489734, 0.86444515, 0.864403546, 0.864360511,
+        0.864315748, 0.864275753, 0.864231646, 0.864190638, 0.864149153, 0.864100218,
+        0.864055455, 0.864009142, 0.863965511, 0.863923192, 0.863876998, 0.863833487,
+        0.863793194, 0.863754869, 0.86371243, 0.863670528, 0.863626719, 0.86358285,
+        0.863541543, 0.863501072, 0.863462269, 0.863421679, 0.863382459, 0.848860502,
+        0.837708354, 0.826804519, 0.815881491, 0.804982364, 0.794099331, 0.783184767,
+        0.772331476, 0.761432111, 0.750550687, 0.749884486, 0.749319434, 0.748865128,
+        0.748517752, 0.7482602, 0.74807924, 0.747961402, 0.747903228, 0.74787885,
+        0.747871816, 0.747870982, 0.747361302, 0.746945858, 0.746637523, 0.746401131,
+        0.746243715, 0.746145546, 0.746094704, 0.746074021, 0.746067226, 0.746066689,
+        0.7457093, 0.745439351, 0.745242834, 0.745104909, 0.745014846, 0.744972587,
+        0.744955361, 0.744950831, 0.744950414, 0.744713247, 0.744537473, 0.744419038,
+        0.744346917, 0.744312108, 0.744298935, 0.744296253, 0.744295776, 0.74413842,
+        0.744035423, 0.74396807, 0.743935764, 0.743921697, 0.743919551, 0.743919075,
+        0.743829489, 0.743770599, 0.743743122, 0.743732035, 0.743730724, 0.743730664,
+        0.743682444, 0.743660092, 0.743651271, 0.743650973, 0.743650973, 0.743629515,
+        0.743621886, 0.743621707, 0.743621588, 0.743617356, 0.743617356, 0.743617356,
+        0.743617356, 0.743617356, 0.743617356, 0.742939711, 0.742383182, 0.741930962,
+        0.741568446, 0.741307497, 0.741130829, 0.741015255, 0.740953386, 0.740925014,
+        0.740917861, 0.740917385, 0.740448654, 0.740064025, 0.739744663, 0.739510775,
+        0.739351094, 0.739252746, 0.739199877, 0.739177108, 0.739171207, 0.739171028,
+        0.738823473, 0.738552868, 0.738346934, 0.738206089, 0.7381199, 0.738072395,
+        0.738050938, 0.738046765, 0.738046467, 0.737811327, 0.737627029, 0.737502992,
+        0.737427413, 0.737387359, 0.737369835, 0.737366438, 0.73736614, 0.73721087,
+        0.737106323, 0.737041891, 0.737005353, 0.736990094, 0.736987531, 0.736987472,
+        0.736893237, 0.736832201, 0.73680234, 0.736791313, 0.736789823, 0.736789644,
+        0.736743569, 0.736716688, 0.736706138, 0.736705303, 0.736705124, 0.736682653,
+        0.736675441, 0.736675024, 0.736675024, 0.736667454, 0.736667395, 0.736667335,
+        0.736667335, 0.736667335, 0.736667335, 0.735997379, 0.735441983, 0.734991789,
+        0.734639585, 0.734381855, 0.734204412, 0.734088838, 0.734027147, 0.734001756,
+        0.733994365, 0.733993649, 0.733518541, 0.733128726, 0.732816339, 0.73258853,
+        0.732431889, 0.732332706, 0.732278347, 0.73225385, 0.732247889, 0.732247591,
+        0.731934249, 0.731672645, 0.731471002, 0.731330633, 0.731244922, 0.731197238,
+        0.731177092, 0.731172442, 0.731172144, 0.73093456, 0.73076278, 0.730640292,
+        0.730567575, 0.730527818, 0.730511546, 0.730508149, 0.730507851, 0.730357945,
+        0.730248988, 0.730182946, 0.730147421, 0.730133832, 0.730131805, 0.730131209,
+        0.730042458, 0.729981959, 0.729952335, 0.729940832, 0.729939342, 0.729939163,
+        0.729888201, 0.729862034, 0.729851961, 0.729851663, 0.729851544, 0.729827762,
+        0.729819715, 0.729819119, 0.729819059, 0.729809761, 0.729809642, 0.729809642,
+        0.729809642, 0.729809642, 0.729809642, 0.729133487, 0.728582919, 0.728131235,
+        0.727777719, 0.727526069, 0.727343559, 0.727232873, 0.727173746, 0.72714597,
+        0.727138996, 0.727138042, 0.726670742, 0.726289332, 0.725989044, 0.725762844,
+        0.725608647, 0.725510716, 0.725456834, 0.725434601, 0.725429118, 0.725428581,
+        0.725113332, 0.724866033, 0.724669933, 0.72453177, 0.724441528, 0.724393547,
+        0.724373639, 0.724369407, 0.72436887, 0.724158108, 0.724000752, 0.723877728,
+        0.723801613, 0.723760068, 0.723743141, 0.72374022, 0.723739982, 0.723590016,
+        0.723484933, 0.723421276, 0.723385096, 0.723370314, 0.723368168, 0.72336787,
+        0.723277509, 0.723219633, 0.723189354, 0.723178029, 0.723177075, 0.723176837,
+        0.723128676, 0.723101676, 0.723090112, 0.723089159, 0.723089099, 0.723065734,
+        0.723057389, 0.723056912, 0.723056853, 0.723048449, 0.723048389, 0.723048329,
+        0.723048329, 0.723048329, 0.723048329, 0.722376406, 0.721826136, 0.721391201,
+        0.721047699, 0.720789969, 0.7206043, 0.720487714, 0.72042805, 0.720401049,
+        0.720394135, 0.720393002, 0.719934285, 0.719566405, 0.719272137, 0.71904254,
+        0.718887091, 0.718789935, 0.718734503, 0.718711257, 0.718705893, 0.718705773,
+        0.718390822, 0.718133926, 0.717938185, 0.717804492, 0.717714846, 0.717667758,
+        0.717647433, 0.717644095, 0.717643499, 0.717439294, 0.717276692, 0.717158258,
+        0.717083812, 0.717042446, 0.717027068, 0.717024207, 0.717024088, 0.716891289,
+        0.716789663, 0.716724873, 0.716689885, 0.716676295, 0.716674149, 0.716673434,
+        0.71658206, 0.716526628, 0.716494858, 0.716483057, 0.716481626, 0.716481388,
+        0.716431499, 0.716402888, 0.716393113, 0.716392338, 0.716392219, 0.716367602,
+        0.716359675, 0.716359496, 0.716359496, 0.716351449, 0.716351211, 0.716351211,
+        0.716351211, 0.716351211, 0.716351211, 0.715647399, 0.715082467, 0.714639306,
+        0.714296043, 0.71405679, 0.713883102, 0.713769197, 0.713711441, 0.713684618,
+        0.713677406, 0.713676751, 0.713199019, 0.712827325, 0.712537885, 0.712325275,
+        0.71216917, 0.712069392, 0.712014735, 0.711989462, 0.711984098, 0.7119838,
+        0.711665392, 0.711413741, 0.71121949, 0.711084008, 0.710998595, 0.710954726,
+        0.710934222, 0.710928977, 0.710928679, 0.710722387, 0.710570931, 0.710452437,
+        0.710376561, 0.710333943, 0.710317314, 0.710314393, 0.710314214, 0.710189879,
+        0.710092843, 0.710032225, 0.709996343, 0.709982395, 0.70998013, 0.709979892,
+        0.70990026, 0.709849417, 0.709821463, 0.709809959, 0.709808469, 0.709808409,
+        0.709758639, 0.70973289, 0.709722996, 0.709722221, 0.709722161, 0.709697247,
+        0.709689438, 0.709688842, 0.709688783, 0.709680974, 0.709680676, 0.709680676,
+        0.709680676, 0.709680676, 0.709680676, 0.708966672, 0.70840466, 0.707961619,
+        0.707629263, 0.707389891, 0.707216144, 0.707104325, 0.707041442, 0.707013965,
+        0.707006454, 0.707005799, 0.706504703, 0.706110179, 0.705806673, 0.705588818,
+        0.705439329, 0.705341339, 0.705287158, 0.705263436, 0.705257833, 0.705257535,
+        0.704937577, 0.704686701, 0.704501569, 0.704371929, 0.704287112, 0.704240739,
+        0.704220891, 0.704216659, 0.704216301, 0.704014659, 0.70386076, 0.703753114,
+        0.703679144, 0.703635335, 0.703619421, 0.703616619, 0.703615844, 0.703488171,
+        0.703401029, 0.703340352, 0.703304112, 0.703291118, 0.703289092, 0.703288853,
+        0.703211486, 0.70315975, 0.703129649, 0.703118324, 0.703116834, 0.703116715,
+        0.703078151, 0.703053296, 0.703042924, 0.703042209, 0.70304203, 0.703018486,
+        0.703011096, 0.703010738, 0.703010619, 0.703004777, 0.703004658, 0.703004539,
+        0.703004479, 0.703004479, 0.703004479, 0.702302456, 0.701719701, 0.701273739,
+        0.700932086, 0.70069313, 0.700532317, 0.700428188, 0.700367689, 0.70033884,
+        0.700331032, 0.700330555, 0.699828207, 0.699442029, 0.699147105, 0.698934674,
+        0.698788702, 0.698697686, 0.698644638, 0.698619485, 0.698613942, 0.698613286,
+        0.698263824, 0.698006034, 0.69781673, 0.69768995, 0.697609603, 0.697562814,
+        0.697542965, 0.697538376, 0.697538078, 0.697331846, 0.697177768, 0.697074294,
+        0.697004795, 0.696964979, 0.696948051, 0.696944773, 0.696944356, 0.696821272,
+        0.696730733, 0.696675599, 0.696640968, 0.696627378, 0.696624994, 0.696624935,
+        0.696546853, 0.696499646, 0.696471989, 0.696460485, 0.696458876, 0.696458519,
+        0.696420848, 0.696395576, 0.696385801, 0.69638443, 0.696384311, 0.696366429,
+        0.696359456, 0.696359217, 0.696359158, 0.696351945, 0.696351588, 0.696351588,
+        0.696351588, 0.696351588, 0.696351588, 0.695643485, 0.695072591, 0.694623947,
+        0.694290757, 0.69404453, 0.693881392, 0.69378227, 0.693728268, 0.693702221,
+        0.693694651, 0.693694353, 0.693191707, 0.692793548, 0.692497194, 0.69228512,
+        0.692140937, 0.692054093, 0.692005694, 0.691985011, 0.691979527, 0.691978931,
+        0.691635609, 0.691374123, 0.691189408, 0.691064239, 0.690987825, 0.690948069,
+        0.690930486, 0.6909253, 0.690924942, 0.690695345, 0.690528691, 0.690417051,
+        0.690350592, 0.6903162, 0.690301895, 0.690299153, 0.690298676, 0.690169275,
+        0.690078914, 0.690021336, 0.689993262, 0.689982414, 0.689980924, 0.689980865,
+        0.689902306, 0.68985498, 0.689830542, 0.689819336, 0.689818025, 0.689817905,
+        0.68977797, 0.689757228, 0.6897493, 0.689748585, 0.689748228, 0.689732194,
+        0.689724386, 0.689723909, 0.689723909, 0.689720035, 0.689719975, 0.689719915,
+        0.689719915, 0.689719915, 0.689719915, 0.689014614, 0.688446224, 0.68800801,
+        0.687671602, 0.687429309, 0.687275171, 0.68718034, 0.687127233, 0.687109292,
+        0.68710357, 0.687102795, 0.686607122, 0.686211109, 0.685907722, 0.685693979,
+        0.685551524, 0.685465038, 0.685418785, 0.68539834, 0.685392022, 0.685391486,
+        0.685041785, 0.684773147, 0.684586942, 0.684464753, 0.684390068, 0.684348285,
+        0.684332252, 0.684327364, 0.684326768, 0.684091091, 0.683932722, 0.683827281,
+        0.683758438, 0.683724165, 0.683711112, 0.683707654, 0.683707058, 0.683557093,
+        0.683463454, 0.683404207, 0.68337518, 0.683364034, 0.683361948, 0.683361769,
+        0.683283627, 0.683236897, 0.683212101, 0.683203518, 0.683202267, 0.683202147,
+        0.683162153, 0.683141589, 0.683134198, 0.683133602, 0.683133364, 0.68311739,
+        0.68311131, 0.683111131, 0.683110952, 0.68310678, 0.68310672, 0.68310672,
+        0.68310672, 0.68310672, 0.68310672, 0.682406425, 0.681830168, 0.681388378,
+        0.68104893, 0.680805564, 0.680642784, 0.680544376, 0.680488467, 0.680469871,
+        0.680463731, 0.680463195, 0.67995739, 0.679560959, 0.679258466, 0.679035485,
+        0.678884447, 0.678794622, 0.678749382, 0.678727806, 0.678722382, 0.678721964,
+        0.678371668, 0.678107321, 0.677912652, 0.677780092, 0.6777035, 0.677664757,
+        0.677648187, 0.677643836, 0.677643418, 0.677414834, 0.677240551, 0.677123249,
+        0.677053511, 0.677021027, 0.677006125, 0.677002907, 0.67700249, 0.676856995,
+        0.676762521, 0.67670387, 0.676676214, 0.676664233, 0.67666173, 0.676661372,
+        0.676573157, 0.676522851, 0.676497042, 0.676486731, 0.676485419, 0.67648536,
+        0.676444471, 0.67642498, 0.676418066, 0.676417112, 0.676416993, 0.676398933,
+        0.676392794, 0.676392674, 0.676392555, 0.676388443, 0.676388443, 0.676388443,
+        0.676388443, 0.676388443, 0.676388443, 0.675689101, 0.675111055, 0.674660206,
+        0.674312294, 0.674066126, 0.673897743, 0.673791647, 0.673738718, 0.673720658,
+        0.673715949, 0.673714876, 0.673212171, 0.672810495, 0.672510386, 0.672290087,
+        0.672140419, 0.67204845, 0.672003686, 0.671983361, 0.67197746, 0.671977162,
+        0.671622455, 0.671356916, 0.671162844, 0.671030343, 0.670951247, 0.670912623,
+        0.670895994, 0.670892179, 0.670891762, 0.670664549, 0.670490444, 0.67037636,
+        0.670309663, 0.670276701, 0.670263469, 0.670259774, 0.670259595, 0.670114517,
+        0.670006037, 0.669946551, 0.669917524, 0.669906735, 0.66990459, 0.669904411,
+        0.669812262, 0.669758677, 0.669733882, 0.66972518, 0.669724047, 0.669723928,
+        0.669679523, 0.669659734, 0.669652343, 0.669651568, 0.669651508, 0.669632971,
+        0.669627488, 0.669627309, 0.669627249, 0.669623852, 0.669623852, 0.669623852,
+        0.669623792, 0.669623733, 0.669623733, 0.668912649, 0.668347061, 0.667898774,
+        0.667554677, 0.66731441, 0.667145431, 0.667039335, 0.666982353, 0.666963756,
+        0.666958988, 0.666958749, 0.666438043, 0.666039228, 0.665741742, 0.66550827,
+        0.665350139, 0.665254295, 0.665203512, 0.665184259, 0.665178239, 0.665178001,
+        0.664827704, 0.664550126, 0.664344788, 0.664210021, 0.664126813, 0.664084673,
+        0.66406709, 0.664062321, 0.664062262, 0.663827062, 0.663658082, 0.663542926,
+        0.663471878, 0.663434863, 0.663421988, 0.663418591, 0.663418412, 0.663269222,
+        0.663170159, 0.663108647, 0.663077533, 0.66306603, 0.663063645, 0.663063467,
+        0.662973821, 0.662919879, 0.66289413, 0.662885606, 0.662884593, 0.662884414,
+        0.662831604, 0.662809134, 0.662802696, 0.662801981, 0.662801981, 0.662780821,
+        0.662774324, 0.662773907, 0.662773907, 0.662769079, 0.662769079, 0.662769079,
+        0.662769079, 0.662769079, 0.662769079, 0.660966754, 0.659441292, 0.658190131,
+        0.657226205, 0.656506658, 0.656000137, 0.655669749, 0.655490398, 0.65540272,
+        0.6553756, 0.655374765, 0.653877378, 0.652379036, 0.651151657, 0.65017128,
+        0.649463654, 0.648952425, 0.648622155, 0.648445249, 0.648359358, 0.648332477,
+        0.648331523, 0.64688015, 0.645655155, 0.644426048, 0.643453717, 0.642727613,
+        0.642233312, 0.641903937, 0.641725838, 0.641635835, 0.641608238, 0.641607165,
+        0.640202582, 0.639015973, 0.638024986, 0.637103081, 0.63640511, 0.635904253,
+        0.635574758, 0.635395229, 0.635312378, 0.635285735, 0.635284901, 0.633850574,
+        0.63265717, 0.631701708, 0.630937815, 0.630257487, 0.629771471, 0.629451215,
+        0.629275084, 0.629188418, 0.629160523, 0.62915951, 0.627774298, 0.626629531,
+        0.625708938, 0.624978065, 0.624433756, 0.623960674, 0.623654962, 0.623473227,
+        0.623385489, 0.623359561, 0.623358727, 0.622021556, 0.62091285, 0.620034039,
+        0.619356573, 0.618835568, 0.618461192, 0.618165672, 0.617998481, 0.617916703,
+        0.617890179, 0.617889225, 0.61659348, 0.615534842, 0.614679933, 0.614030004,
+        0.613543451, 0.613200784, 0.612969816, 0.61279881, 0.612712801, 0.61268574,
+        0.612685204, 0.611468732, 0.610470891, 0.609664619, 0.609048486, 0.608603597,
+        0.60829097, 0.608098149, 0.607976854, 0.607924521, 0.607901514, 0.60790056,
+        0.606731474, 0.605772913, 0.605018854, 0.604439735, 0.604020953, 0.603733957,
+        0.603553176, 0.603452623, 0.603412509, 0.603391469, 0.603390574, 0.602259457,
+        0.601333797, 0.600611448, 0.600055158, 0.599662542, 0.599397182, 0.599237084,
+        0.599150956, 0.599122405, 0.599110246, 0.599108756, 0.598021388, 0.597132385,
+        0.596444607, 0.595925748, 0.595557809, 0.595309019, 0.595162392, 0.595090628,
+        0.595067322, 0.595060229, 0.595059454, 0.593619943, 0.592240453, 0.591063559,
+        0.590098321, 0.589378595, 0.588867188, 0.588543653, 0.588350415, 0.588256657,
+        0.588227212, 0.588226259, 0.586828113, 0.585694015, 0.584541261, 0.583595574,
+        0.58288914, 0.582386672, 0.582052708, 0.581860781, 0.581773281, 0.581747174,
+        0.581746519, 0.58039403, 0.57928884, 0.578337252, 0.57741189, 0.576702178,
+        0.576205432, 0.57587868, 0.575685203, 0.575593114, 0.57556653, 0.575565815,
+        0.574166894, 0.57304281, 0.572105587, 0.571360588, 0.57067579, 0.570174396,
+        0.569848716, 0.569662869, 0.569569945, 0.569544315, 0.569543183, 0.568213165,
+        0.56708169, 0.566173851, 0.565451384, 0.564900875, 0.564428389, 0.564112186,
+        0.563931584, 0.563840866, 0.563814223, 0.563813567, 0.562530458, 0.561440766,
+        0.560578167, 0.559890985, 0.559364915, 0.558998764, 0.558698773, 0.558516145,
+        0.558431268, 0.558402181, 0.55840075, 0.557154775, 0.556136429, 0.555304408,
+        0.55464673, 0.554166257, 0.553821683, 0.553589284, 0.553423584, 0.553342879,
+        0.553315461, 0.553314388, 0.552145302, 0.551151514, 0.550355494, 0.549734414,
+        0.549271941, 0.548956811, 0.548746526, 0.548622191, 0.548542738, 0.548515499,
+        0.548514664, 0.547400355, 0.546450317, 0.545684874, 0.545085907, 0.544646323,
+        0.544340074, 0.54414922, 0.544037223, 0.543983757, 0.543958724, 0.543957949,
+        0.542884707, 0.54195559, 0.541224957, 0.540660679, 0.540248573, 0.539967895,
+        0.539793253, 0.539700449, 0.539655805, 0.539641559, 0.539640009, 0.538605094,
+        0.537738383, 0.53703469, 0.536509454, 0.536129713, 0.535875022, 0.535715044,
+        0.535631537, 0.535601497, 0.535594523, 0.535593927, 0.534226298, 0.533132315,
+        0.53206557, 0.531166732, 0.530454278, 0.529949427, 0.529619575, 0.529437244,
+        0.529348135, 0.529323399, 0.529322505, 0.528005302, 0.52695626, 0.526104271,
+        0.525221288, 0.524531484, 0.524029851, 0.52371192, 0.523519516, 0.523430645,
+        0.523405969, 0.523405075, 0.522050381, 0.520969748, 0.520138621, 0.519433379,
+        0.518750727, 0.518259823, 0.5179286, 0.517736554, 0.517643332, 0.517618179,
+        0.517617345, 0.516325116, 0.515252709, 0.514403403, 0.513712168, 0.513165414,
+        0.512697637, 0.51237756, 0.512191057, 0.512104273, 0.512077332, 0.51207608,
+        0.510793567, 0.509764135, 0.508890808, 0.508208334, 0.507695735, 0.507323146,
+        0.507029593, 0.50685221, 0.506764412, 0.50673604, 0.506735206, 0.505505681,
+        0.504514575, 0.503685355, 0.503039241, 0.502557337, 0.502215683, 0.501983225,
+        0.501817465, 0.501737714, 0.501713395, 0.50171262, 0.500553429, 0.499597132,
+        0.498823941, 0.498207986, 0.497745037, 0.497432113, 0.497225821, 0.49710834,
+        0.497030199, 0.497005641, 0.497004569, 0.495892704, 0.49499011, 0.494244516,
+        0.493666053, 0.493232191, 0.492927134, 0.492738247, 0.492631733, 0.492578268,
+        0.49255079, 0.492549837, 0.491483331, 0.490614831, 0.489896238, 0.489348769,
+        0.488934636, 0.488651812, 0.488473713, 0.488379061, 0.488338768, 0.488324344,
+        0.488323152, 0.487305224, 0.486472905, 0.485785127, 0.485269785, 0.484890819,
+        0.484637737, 0.484485686, 0.48441112, 0.484378099, 0.48437196, 0.484371543,
+        0.483094454, 0.482078671, 0.481262624, 0.480471611, 0.47981292, 0.479327142,
+        0.479006708, 0.478816092, 0.478726625, 0.478702009, 0.478700936, 0.477390289,
+        0.476367354, 0.475565553, 0.474920332, 0.474282444, 0.473800004, 0.473473966,
+        0.473287821, 0.473195374, 0.473167181, 0.473166049, 0.471891284, 0.470836163,
+        0.470028281, 0.469400704, 0.468903303, 0.468434513, 0.468126714, 0.467935026,
+        0.467850327, 0.467823088, 0.467822134, 0.466587365, 0.465568602, 0.464757025,
+        0.464138269, 0.463661969, 0.463298082, 0.463002026, 0.462821186, 0.462733328,
+        0.462706983, 0.462705612, 0.461485207, 0.460512996, 0.459735572, 0.459090292,
+        0.458607793, 0.45826894, 0.458045542, 0.457880318, 0.457794607, 0.4577685,
+        0.457767546, 0.456634998, 0.455696523, 0.454957604, 0.454349637, 0.453905582,
+        0.453584731, 0.453379333, 0.453256786, 0.453179419, 0.453155041, 0.453153729,
+        0.452058375, 0.451171756, 0.450462341, 0.44989866, 0.449465156, 0.449163973,
+        0.448972404, 0.448869228, 0.448814571, 0.448790371, 0.44878906, 0.447749078,
+        0.446902871, 0.446230412, 0.445700884, 0.445304096, 0.445023179, 0.444850028,
+        0.444759429, 0.444716394, 0.444702804, 0.444701672, 0.443701506, 0.442888856,
+        0.442243218, 0.4417395, 0.441366911, 0.441115797, 0.440954566, 0.440876067,
+        0.440847039, 0.440840721, 0.440840244, 0.439553499, 0.438544512, 0.437779725,
+        0.437176585, 0.436608493, 0.436149836, 0.435825109, 0.435630977, 0.435538352,
+        0.435513139, 0.435512364, 0.434272766, 0.433246553, 0.432471752, 0.431872666,
+        0.431417644, 0.430982292, 0.430676341, 0.43048954, 0.430401742, 0.430374563,
+        0.430373669, 0.429163456, 0.428174317, 0.427384973, 0.426801145, 0.426361561,
+        0.426016748, 0.4257195, 0.425540984, 0.425453246, 0.425429404, 0.425428569,
+        0.424248099, 0.423300326, 0.4225353, 0.421942413, 0.421511948, 0.421195269,
+        0.42096442, 0.420803249, 0.420723498, 0.420697629, 0.420696616, 0.419559419,
+        0.418638408, 0.417904496, 0.417342901, 0.416888654, 0.416569889, 0.416361868,
+        0.416244388, 0.416165829, 0.416141987, 0.416140616, 0.415064156, 0.414181948,
+        0.413498044, 0.412966013, 0.412552536, 0.412257433, 0.412065506, 0.411960423,
+        0.411909163, 0.411884248, 0.411883593, 0.410832822, 0.409985363, 0.409326792,
+        0.408824146, 0.408436775, 0.408165395, 0.407986999, 0.407892406, 0.407851815,
+        0.407837212, 0.407836437, 0.406832874, 0.406025589, 0.405405343, 0.404931545,
+        0.404577911, 0.404326141, 0.404172421, 0.404093206, 0.404063106, 0.404056907,
+        0.404056549, 0.402839482, 0.401849508, 0.401098192, 0.400527656, 0.400102675,
+        0.399719536, 0.399432242, 0.399246991, 0.399158955, 0.399130464, 0.399129629,
+        0.397923946, 0.396977127, 0.396202803, 0.395636141, 0.395231843, 0.39493686,
+        0.394661784, 0.394485354, 0.39439714, 0.394370615, 0.394369662, 0.393204391,
+        0.392271638, 0.391533673, 0.390964329, 0.390559614, 0.390277684, 0.390066981,
+        0.389906466, 0.389826953, 0.389802575, 0.389801919, 0.388675153, 0.387772918,
+        0.387063682, 0.386517227, 0.386103749, 0.385821581, 0.38563031, 0.385510445,
+        0.385434389, 0.385409176, 0.385408401, 0.384313703, 0.383423269, 0.382732153,
+        0.382210016, 0.381828427, 0.381540656, 0.381353617, 0.381245732, 0.381193638,
+        0.381169915, 0.3811692, 0.38011831, 0.379288316, 0.378633916, 0.378140092,
+        0.377779663, 0.377514601, 0.377352417, 0.377263069, 0.377222419, 0.377208292,
+        0.377207518, 0.376207113, 0.375418186, 0.374801695, 0.374333978, 0.37399739,
+        0.373752713, 0.373599231, 0.37352407, 0.373495638, 0.373489141, 0.373488843,
+        0.372323334, 0.371381998, 0.370638371, 0.370105326, 0.369728267, 0.369454265,
+        0.369216502, 0.369051278, 0.368964493, 0.368938088, 0.368936837, 0.367791593,
+        0.366874218, 0.366160035, 0.365613937, 0.365226746, 0.364964068, 0.364786983,
+        0.364638627, 0.364557385, 0.364531636, 0.364530623, 0.363451064, 0.36256808,
+        0.361873031, 0.361343622, 0.360960424, 0.360700727, 0.360534966, 0.360423207,
+        0.360346913, 0.360322058, 0.360321403, 0.359266639, 0.358401537, 0.357735097,
+        0.357232928, 0.356865644, 0.356603622, 0.356436849, 0.356342316, 0.356286287,
+        0.356262147, 0.356261373, 0.355233431, 0.354397178, 0.353748202, 0.353259861,
+        0.352912843, 0.352674246, 0.352514744, 0.352427185, 0.352388024, 0.352376163,
+        0.352375448, 0.351382077, 0.350579917, 0.349963903, 0.349513471, 0.349197149,
+        0.348971248, 0.348823786, 0.34874481, 0.348716795, 0.348709941, 0.348709762,
+        0.347603023, 0.346708596, 0.34601593, 0.345485926, 0.345123351, 0.344884217,
+        0.344726741, 0.344610512, 0.344537914, 0.344512403, 0.344511926, 0.343454361,
+        0.342575192, 0.341916502, 0.34140414, 0.34104085, 0.340806484, 0.340658784,
+        0.340570986, 0.340498745, 0.340476096, 0.340475321, 0.339436412, 0.338600814,
+        0.337942421, 0.33745116, 0.337105095, 0.336860955, 0.336717308, 0.336637318,
+        0.336589515, 0.336564958, 0.336563945, 0.335553885, 0.334731698, 0.334099054,
+        0.333628833, 0.333288848, 0.333065629, 0.332918823, 0.332844138, 0.332806647,
+        0.332792699, 0.332792103, 0.331816971, 0.331020772, 0.330403686, 0.32995373,
+        0.329635561, 0.329427898, 0.329298079, 0.329223454, 0.329195082, 0.329190075,
+        0.329189539, 0.328150988, 0.327319384, 0.326674938, 0.326186001, 0.325840771,
+        0.325614572, 0.325487375, 0.325411916, 0.325369418, 0.325348139, 0.325347364,
+        0.324343562, 0.32352531, 0.32289052, 0.32241863, 0.322086513, 0.321863532,
+        0.321737528, 0.321670711, 0.321642399, 0.321624219, 0.321623325, 0.320633948,
+        0.319840372, 0.319231212, 0.318767548, 0.318453848, 0.31825155, 0.318126678,
+        0.318061233, 0.318037629, 0.31802541, 0.318024516, 0.317042351, 0.31627357,
+        0.315686643, 0.315241337, 0.314941883, 0.314745665, 0.314637125, 0.314578891,
+        0.314556599, 0.314550996, 0.314550936, 0.313653469, 0.312856078, 0.312238753,
+        0.311784267, 0.311455488, 0.311247826, 0.311132014, 0.311074197, 0.311051667,
+        0.311035514, 0.311034679, 0.310150504, 0.309385538, 0.308791935, 0.308349788,
+        0.308036208, 0.307843745, 0.30772543, 0.307668865, 0.307652891, 0.307644904,
+        0.307644248, 0.306761861, 0.306015253, 0.3054443, 0.305009127, 0.304710925,
+        0.304518461, 0.30441004, 0.304366112, 0.304353058, 0.304347932, 0.304347694,
+        0.303481519, 0.302725911, 0.302134395, 0.301696301, 0.30138582, 0.301187694,
+        0.301075816, 0.301023245, 0.301009595, 0.301003754, 0.301002383, 0.300127149,
+        0.299383163, 0.298806608, 0.29838264, 0.298085034, 0.297898352, 0.29779166,
+        0.29774344, 0.297730982, 0.297729135, 0.297728837, 0.296859384, 0.296118557,
+        0.295547903, 0.295132697, 0.294839501, 0.294651389, 0.294545531, 0.294499338,
+        0.294490695, 0.294490695, 0.294490695, 0.293159962, 0.291952729, 0.290799141,
+        0.289968669, 0.289397955, 0.28905046, 0.288879395, 0.288807333, 0.288793981,
+        0.288793445, 0.287667036, 0.286689758, 0.285966873, 0.285494328, 0.28520298,
+        0.285058856, 0.28500098, 0.284991741, 0.284991086, 0.284189165, 0.2835899,
+        0.283194304, 0.282946467, 0.282829881, 0.282781124, 0.282773674, 0.282773018,
+        0.282278895, 0.281959593, 0.281756341, 0.281662881, 0.281628191, 0.281624317,
+        0.28162396, 0.28134191, 0.281173408, 0.28109771, 0.28106916, 0.281067312,
+        0.281066954, 0.280915618, 0.280848861, 0.280824423, 0.280823767, 0.280823588,
+        0.280762911, 0.280742705, 0.280742645, 0.280742466, 0.280721664, 0.280721664,
+        0.280721664, 0.280721664, 0.280721664, 0.280721664, 0.279666066, 0.278812528,
+        0.278164268, 0.277726948, 0.277454376, 0.277326643, 0.277271092, 0.277261436,
+        0.277261078, 0.27654618, 0.276015937, 0.275661945, 0.275446117, 0.275340438,
+        0.275301516, 0.275295854, 0.275295317, 0.274866581, 0.274576008, 0.274397731,
+        0.274311602, 0.274279416, 0.274275064, 0.274274588, 0.274038076, 0.273884118,
+        0.273820937, 0.273795545, 0.273793161, 0.273793042, 0.273666799, 0.273611128,
+        0.273592234, 0.273590684, 0.273590684, 0.273541152, 0.273524225, 0.273524106,
+        0.273524046, 0.273507893, 0.273507893, 0.273507893, 0.273507893, 0.273507893,
+        0.273507893, 0.272902727, 0.272448301, 0.272131026, 0.271922052, 0.271822453,
+        0.271781802, 0.271775365, 0.271774828, 0.271398842, 0.271148205, 0.270988464,
+        0.270912349, 0.27088362, 0.270879567, 0.270879269, 0.270676672, 0.27055037,
+        0.270491838, 0.270469368, 0.270467341, 0.270466983, 0.270364702, 0.270320654,
+        0.27030462, 0.270303607, 0.270303607, 0.270263195, 0.270248175, 0.270248115,
+        0.270248055, 0.270234108, 0.270234108, 0.270234108, 0.270234108, 0.270234108,
+        0.270234108, 0.269925654, 0.269710541, 0.269573033, 0.269506335, 0.269479752,
+        0.269475281, 0.269474983, 0.269303977, 0.269196033, 0.269147515, 0.269127011,
+        0.269123852, 0.269123793, 0.26903379, 0.268998206, 0.268984139, 0.268982947,
+        0.268982649, 0.268946767, 0.268935442, 0.268935442, 0.268935263, 0.268923998,
+        0.268923998, 0.268923998, 0.268923998, 0.268923998, 0.268923998, 0.268778026,
+        0.26869148, 0.268648684, 0.268630683, 0.268628538, 0.26862824, 0.268550754,
+        0.268519044, 0.268507421, 0.268506408, 0.268506289, 0.268477321, 0.268468142,
+        0.268468082, 0.268468022, 0.268458545, 0.268458545, 0.268458545, 0.268458545,
+        0.268458545, 0.268458545, 0.268394113, 0.26836586, 0.268352032, 0.268351018,
+        0.268350899, 0.268328667, 0.268318892, 0.268318892, 0.268318832, 0.268312693,
+        0.268312693, 0.268312693, 0.268312693, 0.268312693, 0.268312693, 0.268288612,
+        0.268281341, 0.268281221, 0.268281162, 0.268275142, 0.268275142, 0.268275142,
+        0.268275142, 0.268275142, 0.268275142, 0.268270254, 0.268270254, 0.268270254,
+        0.268270254, 0.268270254, 0.268270254, 0.268270254, 0.268270254, 0.268270254,
+        0.268270254, 0.267015636, 0.265879273, 0.264776647, 0.263968885, 0.263419032,
+        0.263089061, 0.262920201, 0.262849808, 0.262835801, 0.262834728, 0.261749268,
+        0.260833323, 0.260159314, 0.2597, 0.259420753, 0.259280384, 0.2592237,
+        0.259213269, 0.259212315, 0.258441746, 0.257883668, 0.257512748, 0.257279038,
+        0.257162094, 0.257118821, 0.257111967, 0.25711143, 0.256650567, 0.256343067,
+        0.256156087, 0.256060123, 0.256024122, 0.256019413, 0.256019175, 0.255764127,
+        0.255612493, 0.255538344, 0.255509615, 0.255506992, 0.255506575, 0.255371392,
+        0.255307794, 0.255286336, 0.255285144, 0.255284905, 0.255226254, 0.255206764,
+        0.255206347, 0.255206287, 0.255184174, 0.255184114, 0.255184054, 0.255184054,
+        0.255184054, 0.255184054, 0.254430115, 0.253734648, 0.253086686, 0.252640069,
+        0.252363563, 0.252218187, 0.252160788, 0.252150595, 0.25214988, 0.251495063,
+        0.250969112, 0.250597298, 0.250363171, 0.250244319, 0.250196695, 0.250188589,
+        0.250188291, 0.249749899, 0.249450028, 0.249267161, 0.249168992, 0.249131143,
+        0.249126434, 0.249125957, 0.248874009, 0.248728216, 0.248648942, 0.248618245,
+        0.248615444, 0.248615324, 0.248491168, 0.248423934, 0.248400092, 0.248399079,
+        0.24839884, 0.248338699, 0.248319268, 0.248319089, 0.248319089, 0.248299837,
+        0.248299778, 0.248299778, 0.248299778, 0.248299778, 0.248299778, 0.247700751,
+        0.247242033, 0.246910453, 0.246704578, 0.246594489, 0.246551514, 0.246544898,
+        0.246544242, 0.246165335, 0.245905459, 0.245743334, 0.245650947, 0.245616674,
+        0.245611489, 0.245611072, 0.245399237, 0.245267391, 0.245197892, 0.245170653,
+        0.245167613, 0.245167434, 0.24505949, 0.24500221, 0.244982123, 0.244980574,
+        0.244980574, 0.244931519, 0.244914889, 0.24491477, 0.244914711, 0.244897604,
+        0.244897604, 0.244897544, 0.244897544, 0.244897544, 0.244897544, 0.244575322,
+        0.244348407, 0.244211614, 0.244132876, 0.244099081, 0.244094849, 0.244094312,
+        0.243909717, 0.243800223, 0.243739128, 0.243716359, 0.243713498, 0.243713081,
+        0.243623555, 0.243577123, 0.24355793, 0.243556559, 0.24355644, 0.243514657,
+        0.243498862, 0.243498683, 0.243498683, 0.243485928, 0.243485928, 0.243485928,
+        0.243485928, 0.243485928, 0.243485928, 0.243333519, 0.2432428, 0.243191242,
+        0.243171632, 0.243168533, 0.243168175, 0.243092299, 0.243053615, 0.243038058,
+        0.243036866, 0.243036687, 0.24300456, 0.242991447, 0.242991209, 0.242991149,
+        0.242979527, 0.242979467, 0.242979407, 0.242979407, 0.242979407, 0.242979407,
+        0.242909908, 0.242876172, 0.24286294, 0.242861509, 0.242861271, 0.242833138,
+        0.242823064, 0.242822766, 0.242822647, 0.242812991, 0.242812991, 0.242812991,
+        0.242812991, 0.242812991, 0.242812991, 0.242784202, 0.242776036, 0.242775679,
+        0.242775559, 0.242766857, 0.242766798, 0.242766798, 0.242766798, 0.242766798,
+        0.242766798, 0.242757797, 0.242757618, 0.242757618, 0.242757618, 0.242757618,
+        0.242757618, 0.242757618, 0.242757618, 0.242757618, 0.242757618, 0.241579115,
+        0.240512013, 0.239484787, 0.238719523, 0.238199115, 0.237879276, 0.23771584,
+        0.237648785, 0.237636328, 0.237635374, 0.236673713, 0.235832632, 0.23517555,
+        0.234714091, 0.234435558, 0.234293938, 0.234237909, 0.234228134, 0.234227717,
+        0.23349911, 0.232960165, 0.232592702, 0.23236537, 0.232251585, 0.232203245,
+        0.232196927, 0.23219645, 0.231741905, 0.231433153, 0.231250048, 0.231154144,
+        0.231118143, 0.231113911, 0.231113553, 0.230862141, 0.230708361, 0.230637789,
+        0.230611324, 0.230609238, 0.23060894, 0.230480313, 0.230416954, 0.230395079,
+        0.230393589, 0.230393469, 0.230335712, 0.230318606, 0.230318427, 0.230318367,
+        0.230297267, 0.230297148, 0.230297148, 0.230297148, 0.230297148, 0.230297148,
+        0.22961688, 0.228968501, 0.228346884, 0.227924526, 0.227667212, 0.227524221,
+        0.227470219, 0.227458954, 0.227458417, 0.226850271, 0.226360977, 0.226010144,
+        0.225797296, 0.225683689, 0.225634873, 0.225626707, 0.22562629, 0.225215971,
+        0.224931002, 0.224761724, 0.224673569, 0.224637926, 0.224632502, 0.224632263,
+        0.224402726, 0.22426635, 0.224194646, 0.224166036, 0.22416234, 0.224162281,
+        0.224051595, 0.223989129, 0.223969638, 0.223968029, 0.223967791, 0.223916471,
+        0.223898053, 0.223897815, 0.223897815, 0.223880947, 0.223880947, 0.223880947,
+        0.223880947, 0.223880947, 0.223880947, 0.223475933, 0.223108113, 0.222771704,
+        0.222565949, 0.222453952, 0.22240901, 0.222401977, 0.222401619, 0.222071588,
+        0.221814096, 0.221653938, 0.221563816, 0.221531451, 0.221526384, 0.221526146,
+        0.221307695, 0.221176505, 0.22110647, 0.221081138, 0.221078098, 0.221077859,
+        0.220966399, 0.22091049, 0.220889568, 0.220888197, 0.220888078, 0.220839083,
+        0.220822573, 0.220822453, 0.220822334, 0.220806003, 0.220806003, 0.220805943,
+        0.220805943, 0.220805943, 0.220805943, 0.220506549, 0.220283806, 0.220141888,
+        0.220060766, 0.220028877, 0.220024109, 0.220023751, 0.219845176, 0.219728351,
+        0.219670713, 0.219645023, 0.219642401, 0.219642103, 0.219551504, 0.219502807,
+        0.219484925, 0.219483435, 0.219483256, 0.219440937, 0.219424069, 0.219423831,
+        0.219423771, 0.219409645, 0.219409585, 0.219409525, 0.219409525, 0.219409525,
+        0.219409525, 0.219255805, 0.219164312, 0.219110966, 0.219089746, 0.219086349,
+        0.219086051, 0.219011605, 0.218970716, 0.218955398, 0.218953133, 0.218952835,
+        0.218918145, 0.218906343, 0.218906105, 0.218906045, 0.218895435, 0.218895435,
+        0.218895376, 0.218895376, 0.218895376, 0.218895376, 0.218832433, 0.218797088,
+        0.218784451, 0.218783379, 0.218783319, 0.218754053, 0.218744576, 0.218744397,
+        0.218744338, 0.218735456, 0.218735456, 0.218735397, 0.218735397, 0.218735397,
+        0.218735397, 0.218708396, 0.218696952, 0.218696833, 0.218696773, 0.218687057,
+        0.218687057, 0.218686938, 0.218686938, 0.218686938, 0.218686938, 0.21867764,
+        0.21867758, 0.21867758, 0.21867758, 0.21867758, 0.21867758, 0.21867758,
+        0.21867758, 0.21867758, 0.21867758, 0.217566311, 0.21653533, 0.215517521,
+        0.214765847, 0.214248061, 0.213935852, 0.213769674, 0.213702321, 0.21368885,
+        0.213688076, 0.212794602, 0.211999476, 0.211384118, 0.21095854, 0.210691154,
+        0.210560143, 0.210503042, 0.210491776, 0.210491002, 0.209853053, 0.209359646,
+        0.208993077, 0.208759308, 0.20864749, 0.208601534, 0.20859462, 0.208594263,
+        0.208158374, 0.207853973, 0.207670629, 0.207576275, 0.207537532, 0.207533121,
+        0.207532883, 0.207285643, 0.207136691, 0.207063854, 0.207033753, 0.207030535,
+        0.207030356, 0.20689863, 0.20683533, 0.206812739, 0.206811368, 0.206811249,
+        0.206755519, 0.206736803, 0.206736624, 0.206736565, 0.206715286, 0.206715286,
+        0.206715286, 0.206715286, 0.206715286, 0.206715286, 0.206071675, 0.205464423,
+        0.204901695, 0.204494298, 0.204249859, 0.204122543, 0.204068542, 0.204058111,
+        0.204057097, 0.203540862, 0.203087449, 0.202757657, 0.202543736, 0.202428102,
+        0.202386618, 0.202379167, 0.202378809, 0.201998353, 0.201723397, 0.201557338,
+        0.201465309, 0.201430082, 0.201424718, 0.20142436, 0.201205134, 0.201067865,
+        0.20099932, 0.200969458, 0.200966716, 0.200966418, 0.200856745, 0.200799048,
+        0.200776517, 0.200774968, 0.200774789, 0.200725138, 0.200704932, 0.200704813,
+        0.200704753, 0.200686932, 0.200686932, 0.200686932, 0.200686932, 0.200686932,
+        0.200686932, 0.200317264, 0.199989617, 0.199678779, 0.199488461, 0.199382782,
+        0.199339926, 0.199333012, 0.199332237, 0.199032485, 0.198786974, 0.19863975,
+        0.198554516, 0.198521495, 0.198516965, 0.198516905, 0.198326826, 0.198204935,
+        0.198141575, 0.198116779, 0.198113024, 0.198112726, 0.198018849, 0.197972834,
+        0.19795537, 0.197953522, 0.197953403, 0.197912157, 0.197896719, 0.19789654,
+        0.197896361, 0.197881877, 0.197881877, 0.197881877, 0.197881877, 0.197881877,
+        0.197881877, 0.197682738, 0.197514415, 0.197373986, 0.197292984, 0.197261095,
+        0.197256148, 0.197255969, 0.197103739, 0.196989954, 0.196931183, 0.196907938,
+        0.196905017, 0.196904719, 0.196814299, 0.196764648, 0.196746409, 0.196745276,
+        0.196745098, 0.196703672, 0.196689427, 0.196689308, 0.196689188, 0.196676195,
+        0.196676195, 0.196676075, 0.196676075, 0.196676075, 0.196676075, 0.19653523,
+        0.1964432, 0.196391702, 0.196369827, 0.196367025, 0.196366668, 0.196289361,
+        0.196249008, 0.196233869, 0.196232319, 0.196232319, 0.196198285, 0.196187079,
+        0.196186662, 0.196186602, 0.196174562, 0.196174562, 0.196174562, 0.196174562,
+        0.196174562, 0.196174562, 0.196109653, 0.196076572, 0.196061671, 0.196059942,
+        0.196059823, 0.196032226, 0.196021616, 0.196021378, 0.196021259, 0.196012616,
+        0.196012616, 0.196012616, 0.196012616, 0.196012616, 0.196012616, 0.195987046,
+        0.195978761, 0.195978642, 0.195978582, 0.195969939, 0.195969939, 0.19596988,
+        0.19596988, 0.19596988, 0.19596988, 0.195961118, 0.195961118, 0.195961118,
+        0.195961118, 0.195961118, 0.195961118, 0.195961118, 0.195961118, 0.195961118,
+        0.195961118, 0.194855988, 0.193885624, 0.192926407, 0.192193747, 0.191677034,
+        0.191367447, 0.191206098, 0.191140711, 0.191126287, 0.191125393, 0.190293849,
+        0.189541519, 0.188946426, 0.188529015, 0.188268483, 0.188130081, 0.188075602,
+        0.188066304, 0.188065648, 0.187481046, 0.187021434, 0.186675549, 0.18646276,
+        0.18635571, 0.186311722, 0.186305046, 0.186304212, 0.185937762, 0.185674429,
+        0.185492575, 0.185402393, 0.18536675, 0.185361743, 0.185361326, 0.18513006,
+        0.184978783, 0.184912324, 0.184884548, 0.184882045, 0.184881926, 0.18475765,
+        0.184697509, 0.18467623, 0.184674919, 0.18467474, 0.18461889, 0.184600353,
+        0.184600234, 0.184600234, 0.184581637, 0.184581518, 0.184581459, 0.184581459,
+        0.184581459, 0.184581459, 0.183982849, 0.183410466, 0.182853281, 0.182451785,
+        0.182207882, 0.182077765, 0.182021379, 0.182010949, 0.182010055, 0.181519449,
+        0.181094646, 0.18078506, 0.180591524, 0.180488646, 0.180446625, 0.180438519,
+        0.180437982, 0.180116117, 0.179877818, 0.179717243, 0.179628134, 0.179592252,
+        0.179586828, 0.179586589, 0.179378569, 0.179251373, 0.179182649, 0.179155886,
+        0.179152489, 0.179152012, 0.179048955, 0.178988993, 0.178966939, 0.17896533,
+        0.178965271, 0.178915501, 0.178898096, 0.178897798, 0.178897679, 0.178883255,
+        0.178883255, 0.178883195, 0.178883195, 0.178883195, 0.178883195, 0.178558946,
+        0.178257525, 0.177976549, 0.177794635, 0.177699924, 0.177661002, 0.17765522,
+        0.177654862, 0.177400649, 0.17719543, 0.177049339, 0.17697221, 0.176939845,
+        0.1769346, 0.176934123, 0.176763833, 0.176652908, 0.176592708, 0.176569343,
+        0.176567018, 0.176566541, 0.176472664, 0.176422536, 0.176404238, 0.176402807,
+        0.176402569, 0.176362991, 0.176348329, 0.176348209, 0.176348031, 0.176333725,
+        0.176333666, 0.176333666, 0.176333666, 0.176333666, 0.176333666, 0.17615968,
+        0.176004946, 0.175875723, 0.17580086, 0.175770581, 0.17576623, 0.17576611,
+        0.175624311, 0.175519049, 0.17546612, 0.175446689, 0.175444007, 0.175443828,
+        0.175363958, 0.175323248, 0.175307989, 0.175307035, 0.175306916, 0.175270319,
+        0.175258338, 0.17525816, 0.17525816, 0.175247848, 0.175247788, 0.175247729,
+        0.175247729, 0.175247729, 0.175247729, 0.175160646, 0.175090015, 0.175036073,
+        0.175012708, 0.175010085, 0.175009847, 0.174950838, 0.174909353, 0.174894154,
+        0.174892783, 0.174892485, 0.174858928, 0.174846232, 0.174845815, 0.174845815,
+        0.174835086, 0.174834967, 0.174834967, 0.174834967, 0.174834967, 0.174834967,
+        0.174780011, 0.174744308, 0.17473048, 0.174728811, 0.174728751, 0.174702764,
+        0.174691796, 0.17469126, 0.17469126, 0.17468226, 0.17468226, 0.1746822,
+        0.1746822, 0.1746822, 0.1746822, 0.174654186, 0.174645424, 0.174645185,
+        0.174645126, 0.174636424, 0.174636364, 0.174636304, 0.174636304, 0.174636304,
+        0.174636304, 0.174627602, 0.174627602, 0.174627542, 0.174627542, 0.174627542,
+        0.174627542, 0.174627542, 0.174627542, 0.174627542, 0.174627542, 0.173196793,
+        0.17204541, 0.17115581, 0.170461833, 0.169971466, 0.169668198, 0.169510901,
+        0.169444561, 0.169431984, 0.169430912, 0.168538272, 0.16784364, 0.167279005,
+        0.166880369, 0.166626632, 0.166498423, 0.1664415, 0.166431904, 0.166431189,
+        0.165890157, 0.165459096, 0.165137768, 0.164931655, 0.164823771, 0.164785147,
+        0.164777756, 0.164777696, 0.164446473, 0.164202094, 0.164035141, 0.163950503,
+        0.163921177, 0.163916171, 0.163915396, 0.163722277, 0.163595676, 0.163525522,
+        0.163496375, 0.163494051, 0.163493872, 0.163377285, 0.163320839, 0.16329968,
+        0.163298011, 0.163297772, 0.163243115, 0.163223922, 0.163223445, 0.163223267,
+        0.16320318, 0.16320318, 0.16320312, 0.16320312, 0.16320312, 0.16320312,
+        0.162576497, 0.162055075, 0.161541641, 0.161166608, 0.160936177, 0.160808146,
+        0.160751402, 0.160739481, 0.160738647, 0.160304606, 0.159919024, 0.159622133,
+        0.159430146, 0.159328163, 0.159285367, 0.159278691, 0.159278393, 0.158990681,
+        0.158767462, 0.158619702, 0.158533871, 0.158500135, 0.158495247, 0.158494651,
+        0.158331335, 0.158217609, 0.158150256, 0.158121109, 0.158118308, 0.158118188,
+        0.158016622, 0.157958508, 0.15793848, 0.15793699, 0.157936931, 0.157887936,
+        0.157869875, 0.157869637, 0.157869637, 0.157853425, 0.157853425, 0.157853305,
+        0.157853305, 0.157853305, 0.157853305, 0.157547891, 0.157274544, 0.157014668,
+        0.156844616, 0.156742871, 0.156702816, 0.156695664, 0.156695247, 0.156472802,
+        0.15627259, 0.156145036, 0.156072199, 0.156043351, 0.156038404, 0.156037986,
+        0.155893385, 0.155797243, 0.155737817, 0.155712187, 0.155708969, 0.155708611,
+        0.15562731, 0.155580163, 0.155563533, 0.155561447, 0.155561388, 0.155522168,
+        0.155507684, 0.155507267, 0.155507147, 0.155494988, 0.155494928, 0.155494869,
+        0.155494869, 0.155494869, 0.155494869, 0.155339241, 0.155201972, 0.155081749,
+        0.155015826, 0.154988289, 0.154982924, 0.154982686, 0.154871821, 0.154789686,
+        0.154739141, 0.154719114, 0.154716372, 0.154716134, 0.154650509, 0.154613018,
+        0.154597998, 0.154596567, 0.154596388, 0.154563487, 0.154548824, 0.154548645,
+        0.154548585, 0.154539347, 0.154539347, 0.154539287, 0.154539287, 0.154539287,
+        0.154539287, 0.154463053, 0.154402554, 0.154355586, 0.154333591, 0.154330254,
+        0.154329896, 0.15427798, 0.154241383, 0.154228032, 0.154226899, 0.15422684,
+        0.154199481, 0.154188931, 0.154188752, 0.154188693, 0.154179096, 0.154179037,
+        0.154179037, 0.154179037, 0.154179037, 0.154179037, 0.154143274, 0.154114485,
+        0.154101133, 0.154099882, 0.154099762, 0.154076517, 0.154066443, 0.154065967,
+        0.154065967, 0.154056728, 0.154056668, 0.154056609, 0.154056609, 0.154056609,
+        0.154056609, 0.154034376, 0.154025555, 0.154025197, 0.154025197, 0.154016733,
+        0.154016674, 0.154016674, 0.154016674, 0.154016674, 0.154016674, 0.154007137,
+        0.154007137, 0.154007137, 0.154007137, 0.154007137, 0.154007137, 0.154007137,
+        0.154007137, 0.154007137, 0.154007137, 0.152535439, 0.151398063, 0.150516987,
+        0.149886727, 0.149432719, 0.149135411, 0.148978353, 0.14890933, 0.148897469,
+        0.148896992, 0.148019433, 0.147346854, 0.146829665, 0.14645505, 0.146218777,
+        0.146089792, 0.146036088, 0.146026134, 0.146025419, 0.145495713, 0.145099759,
+        0.1447981, 0.1446051, 0.144498706, 0.144458115, 0.144451499, 0.144451141,
+        0.144141674, 0.143912315, 0.143753231, 0.143672109, 0.1436373, 0.143632472,
+        0.143632054, 0.143454194, 0.14333868, 0.143275738, 0.143250346, 0.143248379,
+        0.143248141, 0.143155336, 0.143110573, 0.143091321, 0.14308989, 0.143089652,
+        0.143041074, 0.143023849, 0.143023491, 0.143023491, 0.143004298, 0.143004298,
+        0.143004239, 0.143004239, 0.143004239, 0.143004239, 0.142194331, 0.141563594,
+        0.141095996, 0.140742064, 0.14051801, 0.140398204, 0.140344083, 0.140335858,
+        0.14033556, 0.139858663, 0.139511287, 0.139235198, 0.139058352, 0.138955474,
+        0.138911724, 0.13890475, 0.138903916, 0.138633609, 0.138430715, 0.138291001,
+        0.138212502, 0.138179421, 0.138174474, 0.138174176, 0.13802135, 0.137917578,
+        0.137854695, 0.137827635, 0.137825072, 0.137824833, 0.137752533, 0.137705326,
+        0.137686014, 0.137684286, 0.137684107, 0.137641311, 0.137625158, 0.137625098,
+        0.137625098, 0.137609482, 0.137609422, 0.137609422, 0.137609422, 0.137609422,
+        0.137609422, 0.13729614, 0.137043118, 0.136793733, 0.136636198, 0.136543691,
+        0.136505723, 0.136498034, 0.136497498, 0.136294007, 0.136121154, 0.136000454,
+        0.135932207, 0.135901868, 0.135896027, 0.135895848, 0.135766149, 0.135683715,
+        0.135629714, 0.135607183, 0.135604739, 0.135604382, 0.135541499, 0.135502756,
+        0.13548696, 0.135485709, 0.135485411, 0.135452569, 0.135439157, 0.135439038,
+        0.135438919, 0.135425448, 0.135425448, 0.135425329, 0.135425329, 0.135425329,
+        0.135425329, 0.135288, 0.135167181, 0.135066569, 0.135001361, 0.134974062,
+        0.134969771, 0.134969532, 0.13487345, 0.134798646, 0.134752095, 0.134733617,
+        0.134731233, 0.134730935, 0.134678304, 0.13464427, 0.134630203, 0.134628296,
+        0.134628236, 0.134599745, 0.134590089, 0.13459003, 0.13458997, 0.134579122,
+        0.134579062, 0.134579003, 0.134579003, 0.134579003, 0.134579003, 0.134514093,
+        0.134464383, 0.134418726, 0.134401858, 0.134398818, 0.13439858, 0.134357512,
+        0.134327829, 0.134315312, 0.134313464, 0.134313405, 0.134291053, 0.134281635,
+        0.134281278, 0.134281278, 0.134272575, 0.134272575, 0.134272575, 0.134272575,
+        0.134272575, 0.134272575, 0.134242475, 0.134217918, 0.13420707, 0.134205699,
+        0.13420558, 0.134185433, 0.134176254, 0.134176135, 0.134176135, 0.134168804,
+        0.134168804, 0.134168744, 0.134168744, 0.134168744, 0.134168744, 0.13415277,
+        0.134144425, 0.134144187, 0.134144187, 0.13413769, 0.134137571, 0.134137571,
+        0.134137571, 0.134137571, 0.134137571, 0.134130895, 0.134130895, 0.134130836,
+        0.134130836, 0.134130836, 0.134130836, 0.134130836, 0.134130836, 0.134130836,
+        0.134130836, 0.132709682, 0.13157481, 0.130722523, 0.130116224, 0.129697502,
+        0.129426658, 0.129281342, 0.129217982, 0.129204452, 0.1292032, 0.128260076,
+        0.127556264, 0.127064347, 0.126732945, 0.126510501, 0.126386642, 0.126336575,
+        0.126327038, 0.126326382, 0.125800669, 0.125419497, 0.125150681, 0.124972641,
+        0.124879181, 0.124836802, 0.124830246, 0.124829769, 0.124530494, 0.124331892,
+        0.124196172, 0.124123693, 0.124093294, 0.124088705, 0.124088407, 0.123929322,
+        0.123824656, 0.123771429, 0.123749495, 0.123747289, 0.123746932, 0.123659372,
+        0.123614013, 0.123594403, 0.123593032, 0.123592854, 0.123549461, 0.123533189,
+        0.12353313, 0.123532951, 0.123515248, 0.123515189, 0.123515189, 0.123515189,
+        0.123515189, 0.123515189, 0.122694731, 0.122074723, 0.121621549, 0.121306956,
+        0.121106029, 0.120987535, 0.12093848, 0.120928288, 0.120927751, 0.120465875,
+        0.120129228, 0.119892538, 0.119731426, 0.119637907, 0.119598567, 0.119591236,
+        0.119590938, 0.119338095, 0.119156063, 0.119040728, 0.118966699, 0.118935704,
+        0.118930697, 0.11893028, 0.11879164, 0.118700802, 0.118645251, 0.118622482,
+        0.118618488, 0.11861825, 0.118545711, 0.118500113, 0.118482828, 0.118481696,
+        0.118481696, 0.118448794, 0.118436396, 0.118436038, 0.118435979, 0.1184237,
+        0.1184237, 0.1184237, 0.1184237, 0.1184237, 0.1184237, 0.118019521,
+        0.117724419, 0.117512941, 0.117368221, 0.117284298, 0.117249012, 0.117242277,
+        0.117241681, 0.117029607, 0.116876423, 0.11677438, 0.116712511, 0.116684854,
+        0.116679609, 0.116679311, 0.116566598, 0.116494358, 0.116442919, 0.116421282,
+        0.116418779, 0.1164186, 0.116364002, 0.116326749, 0.116309881, 0.116308451,
+        0.116308212, 0.116282284, 0.116272569, 0.11627239, 0.116272271, 0.116262317,
+        0.116262317, 0.116262317, 0.116262317, 0.116262317, 0.116262317, 0.116123497,
+        0.116020977, 0.11593014, 0.115874112, 0.11584872, 0.115843773, 0.115843594,
+        0.115762174, 0.115697622, 0.115654469, 0.115636408, 0.115633309, 0.115632951,
+        0.115588486, 0.115558863, 0.115547657, 0.115546346, 0.115546107, 0.115525246,
+        0.115517378, 0.11551708, 0.11551702, 0.115508676, 0.115508616, 0.115508556,
+        0.115508556, 0.115508556, 0.115508556, 0.115451753, 0.115409613, 0.115374207,
+        0.115358233, 0.115355074, 0.115355015, 0.115320325, 0.115294755, 0.115282834,
+        0.115280807, 0.115280569, 0.115264297, 0.11525625, 0.115256011, 0.115255892,
+        0.115249038, 0.115249038, 0.115249038, 0.115249038, 0.115249038, 0.115249038,
+        0.115224779, 0.115205288, 0.115194976, 0.115193307, 0.115193069, 0.115180433,
+        0.115174234, 0.115173757, 0.115173757, 0.115167379, 0.11516726, 0.115167201,
+        0.115167201, 0.115167201, 0.115167201, 0.115156353, 0.115149915, 0.115149617,
+        0.115149498, 0.115142822, 0.115142763, 0.115142763, 0.115142763, 0.115142763,
+        0.115142763, 0.115139306, 0.115139306, 0.115139306, 0.115139306, 0.115139306,
+        0.115139306, 0.115139306, 0.115139306, 0.115139306, 0.115139306, 0.113730609,
+        0.112609386, 0.111754119, 0.111151993, 0.110759974, 0.110519826, 0.11038512,
+        0.110328138, 0.110317409, 0.110316515, 0.10937655, 0.108682811, 0.108187675,
+        0.107857168, 0.107657909, 0.107545972, 0.107498884, 0.107489407, 0.107488334,
+        0.106924713, 0.106525958, 0.106270194, 0.106112003, 0.106030881, 0.105994463,
+        0.105987728, 0.105986834, 0.105689347, 0.105487645, 0.105363965, 0.105297089,
+        0.105268121, 0.105263233, 0.105262816, 0.105107248, 0.105013192, 0.104966938,
+        0.104946554, 0.104943812, 0.104943633, 0.104862928, 0.104821742, 0.104805171,
+        0.104804158, 0.104803979, 0.104767561, 0.104751825, 0.104751706, 0.104751647,
+        0.10473907, 0.10473907, 0.10473907, 0.10473907, 0.10473907, 0.10473907,
+        0.103932261, 0.103341401, 0.102910697, 0.102616847, 0.10243696, 0.102332234,
+        0.102290988, 0.102280736, 0.102279663, 0.101798654, 0.101451755, 0.101220787,
+        0.101076007, 0.100995421, 0.100960791, 0.100953996, 0.100953639, 0.100701272,
+        0.100542068, 0.100434542, 0.100374639, 0.100349844, 0.100345969, 0.100345552,
+        0.100225925, 0.100148976, 0.100105286, 0.100086391, 0.100084484, 0.100084245,
+        0.100023627, 0.0999917984, 0.09997648, 0.0999753475, 0.0999751687, 0.0999462008,
+        0.0999334455, 0.0999334455, 0.0999333858, 0.0999239087, 0.0999239087, 0.0999239087,
+        0.0999239087, 0.0999239087, 0.0999239087, 0.0995095372, 0.0992235541, 0.09902215,
+        0.098898828, 0.0988295674, 0.0987966061, 0.0987898707, 0.0987892747, 0.0985862613,
+        0.0984523296, 0.0983647108, 0.0983164907, 0.0982932448, 0.0982885957, 0.0982884765,
+        0.0981880426, 0.0981270671, 0.0980904698, 0.0980742574, 0.0980716944, 0.0980712175,
+        0.0980217457, 0.097997427, 0.0979862213, 0.0979853868, 0.0979852676, 0.0979640484,
+        0.097954452, 0.0979543924, 0.0979542732, 0.0979478359, 0.0979478359, 0.0979478359,
+        0.0979478359, 0.0979478359, 0.0979478359, 0.097768724, 0.0976514816, 0.097573638,
+        0.0975304246, 0.0975100398, 0.0975052118, 0.0975051522, 0.0974283814, 0.0973815322,
+        0.0973542333, 0.0973399282, 0.0973369479, 0.0973364711, 0.0972999334, 0.0972809196,
+        0.097271204, 0.0972703695, 0.0972702503, 0.097252667, 0.0972443819, 0.0972443819,
+        0.0972443223, 0.0972392559, 0.0972392559, 0.0972392559, 0.0972392559, 0.0972392559,
+        0.0972392559, 0.0971843004, 0.0971513391, 0.0971239805, 0.0971110463, 0.0971076488,
+        0.09710747, 0.0970817804, 0.0970637202, 0.0970565081, 0.0970552564, 0.0970552564,
+        0.0970426202, 0.0970364809, 0.0970363021, 0.0970362425, 0.0970324278, 0.0970324278,
+        0.0970324278, 0.0970324278, 0.0970324278, 0.0970324278, 0.0970119834, 0.0969970226,
+        0.0969902873, 0.0969881415, 0.0969880223, 0.0969761014, 0.0969697833, 0.0969697833,
+        0.0969697833, 0.0969666243, 0.0969666243, 0.0969666243, 0.0969666243, 0.0969666243,
+        0.0969666243, 0.0969563723, 0.096949935, 0.096949935, 0.096949935, 0.0969467759,
+        0.0969467759, 0.0969467759, 0.0969467759, 0.0969467759, 0.0969467759, 0.0969443321,
+        0.0969443321, 0.0969443321, 0.0969443321, 0.0969443321, 0.0969443321, 0.0969443321,
+        0.0969443321, 0.0969443321, 0.0969443321, 0.0956069827, 0.0945370793, 0.0937248468,
+        0.0931507349, 0.0927917361, 0.0925890207, 0.0924851894, 0.0924361348, 0.0924277306,
+        0.0924271345, 0.0915497541, 0.0908763409, 0.0904169679, 0.0901228786, 0.0899567008,
+        0.0898738503, 0.08983922, 0.0898320079, 0.089831531, 0.0893043876, 0.0889418125,
+        0.0887207389, 0.0885839462, 0.0885233879, 0.0884985924, 0.0884943008, 0.0884938836,
+        0.0881911516, 0.0880137682, 0.0879126787, 0.0878633857, 0.0878478885, 0.087844789,
+        0.0878445506, 0.0877043009, 0.0876247883, 0.0875858068, 0.0875755548, 0.0875731111,
+        0.0875729918, 0.0875106454, 0.0874748826, 0.087467432, 0.0874667764, 0.087466538,
+        0.0874329805, 0.087426126, 0.087426126, 0.0874260664, 0.0874187946, 0.0874187946,
+        0.0874187946, 0.0874187946, 0.0874187946, 0.0874187946, 0.0866324306, 0.0860345364,
+        0.0855972767, 0.0853074789, 0.0851389766, 0.0850570798, 0.0850138068, 0.0850057602,
+        0.0850046277, 0.0845270753, 0.0841972232, 0.0839736462, 0.083837688, 0.0837740302,
+        0.0837401748, 0.0837330222, 0.0837324858, 0.0834538341, 0.0832784772, 0.0831748247,
+        0.0831275582, 0.083104074, 0.0830997825, 0.0830994844, 0.0829703212, 0.0828955173,
+        0.0828595161, 0.0828400254, 0.082837522, 0.082837224, 0.0827722549, 0.0827439427,
+        0.0827298164, 0.0827288032, 0.0827285051, 0.0827006698, 0.082688868, 0.082688868,
+        0.082688868, 0.082680285, 0.082680285, 0.082680285, 0.082680285, 0.082680285,
+        0.082680285, 0.082285583, 0.0820018649, 0.0818123221, 0.08169204, 0.0816315413,
+        0.0816018581, 0.0815950036, 0.0815945864, 0.0813708901, 0.0812295079, 0.081140995,
+        0.0810980797, 0.081078887, 0.0810742974, 0.0810738206, 0.0809757113, 0.0809132457,
+        0.0808827281, 0.08086586, 0.0808631778, 0.0808628201, 0.0808132887, 0.080792129,
+        0.0807833672, 0.0807821155, 0.0807818174, 0.0807603002, 0.0807526112, 0.0807526112,
+        0.0807526112, 0.0807463527, 0.0807463527, 0.0807463527, 0.0807463527, 0.0807463527,
+        0.0807463527, 0.0805639625, 0.0804491043, 0.0803752542, 0.0803376436, 0.0803175569,
+        0.0803126693, 0.080312252, 0.0802329183, 0.0801882148, 0.0801631212, 0.080150187,
+        0.0801472664, 0.080147028, 0.0801083446, 0.0800922513, 0.0800856352, 0.0800843835,
+        0.0800841451, 0.0800694823, 0.0800620914, 0.0800620914, 0.0800619721, 0.080057621,
+        0.080057621, 0.080057621, 0.080057621, 0.080057621, 0.080057621, 0.079985261,
+        0.0799443126, 0.0799245238, 0.079913497, 0.0799110532, 0.079910934, 0.0798826218,
+        0.0798695683, 0.0798637867, 0.0798630118, 0.0798628926, 0.0798522234, 0.0798464417,
+        0.0798463821, 0.0798463225, 0.0798437595, 0.0798437595, 0.0798437595, 0.0798437595,
+        0.0798437595, 0.0798437595, 0.0798124075, 0.0798002481, 0.0797944069, 0.0797936916,
+        0.079793632, 0.0797846913, 0.079780519, 0.079780519, 0.079780519, 0.0797784328,
+        0.0797784328, 0.0797784328, 0.0797784328, 0.0797784328, 0.0797784328, 0.0797700286,
+        0.0797655582, 0.0797654986, 0.079765439, 0.0797634721, 0.0797634721, 0.0797634721,
+        0.0797634721, 0.0797634721, 0.0797634721, 0.0797613263, 0.0797613263, 0.0797613263,
+        0.0797613263, 0.0797613263, 0.0797613263, 0.0797613263, 0.0797613263, 0.0797613263,
+        0.0797613263, 0.0784363151, 0.0773887634, 0.0765855908, 0.0760067105, 0.0756593347,
+        0.0754608512, 0.0753626823, 0.075324595, 0.0753148794, 0.075314343, 0.0744478106,
+        0.0737913251, 0.0733456016, 0.073056221, 0.0728964806, 0.0728179216, 0.0727897286,
+        0.0727824569, 0.072781682, 0.0722613931, 0.0718895793, 0.0716571212, 0.0715309978,
+        0.0714722276, 0.0714519024, 0.071447134, 0.0714469552, 0.0711467862, 0.0709558129,
+        0.0708572865, 0.0708089471, 0.070794642, 0.0707916021, 0.0707912445, 0.0706397891,
+        0.0705566406, 0.0705186129, 0.0705074072, 0.0705058575, 0.0705055594, 0.0704287291,
+        0.0703947544, 0.0703877211, 0.070387125, 0.070387125, 0.070356071, 0.0703492761,
+        0.0703492165, 0.0703491569, 0.0703431368, 0.0703431368, 0.0703431368, 0.0703431368,
+        0.0703431368, 0.0703431368, 0.0695742965, 0.0689900517, 0.0685589314, 0.0682718754,
+        0.0681051612, 0.0680223107, 0.0679880381, 0.0679782629, 0.0679777861, 0.0675130486,
+        0.0671665668, 0.0669519305, 0.0668212771, 0.0667632818, 0.0667384863, 0.0667327642,
+        0.0667321086, 0.0664615631, 0.0662854314, 0.0661894679, 0.0661449432, 0.0661244392,
+        0.0661202669, 0.0661199093, 0.0659816861, 0.0659024119, 0.0658658147, 0.0658515692,
+        0.0658489466, 0.0658487678, 0.0657824278, 0.0657541156, 0.0657452345, 0.0657440424,
+        0.0657437444, 0.0657173991, 0.0657068491, 0.0657067895, 0.0657067299, 0.0656988621,
+        0.0656988621, 0.0656988621, 0.0656988621, 0.0656988621, 0.0656988621, 0.06531322,
+        0.0650289059, 0.0648328662, 0.0647160411, 0.0646625161, 0.0646398664, 0.0646327734,
+        0.0646320581, 0.0644134879, 0.0642749667, 0.0641893148, 0.0641463995, 0.0641307235,
+        0.0641257167, 0.0641254783, 0.0640177131, 0.0639523864, 0.0639225245, 0.06391114,
+        0.0639091134, 0.063908875, 0.0638568401, 0.063837111, 0.0638306141, 0.0638297796,
+        0.0638296008, 0.0638104677, 0.0638036728, 0.0638036132, 0.063803494, 0.0637973547,
+        0.0637973547, 0.0637973547, 0.0637973547, 0.0637973547, 0.0637973547, 0.0636236668,
+        0.0635142326, 0.0634469986, 0.0634123683, 0.0634004474, 0.0633969903, 0.0633965135,
+        0.0633104444, 0.0632606745, 0.0632376671, 0.0632274151, 0.0632252693, 0.0632250309,
+        0.0631850958, 0.0631673336, 0.0631604195, 0.063159883, 0.0631597638, 0.0631431937,
+        0.0631378293, 0.0631376505, 0.0631375909, 0.0631341338, 0.0631341338, 0.0631341338,
+        0.0631341338, 0.0631341338, 0.0631341338, 0.0630640388, 0.0630230308, 0.0630060434,
+        0.0629989505, 0.0629965663, 0.0629961491, 0.0629662275, 0.0629534721, 0.0629484057,
+        0.062947154, 0.0629467964, 0.0629359484, 0.062931776, 0.0629317164, 0.0629316568,
+        0.0629281402, 0.0629281402, 0.0629281402, 0.0629281402, 0.0629281402, 0.0629281402,
+        0.0629003644, 0.0628887415, 0.062885046, 0.0628836751, 0.0628833771, 0.0628733039,
+        0.0628690124, 0.0628689528, 0.0628689528, 0.0628666282, 0.0628666282, 0.0628666282,
+        0.0628666282, 0.0628666282, 0.0628666282, 0.0628561974, 0.0628526211, 0.0628525615,
+        0.0628524423, 0.0628505349, 0.0628505349, 0.0628505349, 0.0628505349, 0.0628505349,
+        0.0628505349, 0.062848568, 0.062848568, 0.062848568, 0.062848568, 0.062848568,
+        0.062848568, 0.062848568, 0.062848568, 0.062848568, 0.062848568, 0.0615352392,
+        0.0605157614, 0.0597079396, 0.059150219, 0.058778882, 0.0585752726, 0.0584821701,
+        0.0584487915, 0.0584434867, 0.0584422946, 0.0575866699, 0.0569413304, 0.0564832687,
+        0.056188345, 0.0560293198, 0.0559545159, 0.0559296608, 0.0559262037, 0.0559257269,
+        0.0554144979, 0.0550495386, 0.0548127294, 0.0546837449, 0.0546243787, 0.0546060801,
+        0.0546044707, 0.0546040535, 0.0543090105, 0.0541283488, 0.0540278554, 0.0539780259,
+        0.0539656878, 0.0539644957, 0.053964138, 0.0538073182, 0.0537301898, 0.0536924005,
+        0.0536825061, 0.0536817312, 0.0536814928, 0.0536082983, 0.0535728335, 0.0535660982,
+        0.0535659194, 0.0535657406, 0.0535287857, 0.0535222292, 0.0535222292, 0.0535221696,
+        0.0535158515, 0.0535158515, 0.0535158515, 0.0535158515, 0.0535158515, 0.0535158515,
+        0.0527670383, 0.0521922112, 0.051766932, 0.0514854193, 0.0513157248, 0.05123806,
+        0.0512098074, 0.0512057543, 0.051205039, 0.0507449508, 0.0504196882, 0.0501917005,
+        0.050060153, 0.0500012636, 0.0499814749, 0.049978435, 0.049977839, 0.0497143269,
+        0.0495380163, 0.0494366288, 0.0493904352, 0.0493739843, 0.0493716002, 0.0493713021,
+        0.0492275357, 0.0491502881, 0.0491174459, 0.049105823, 0.0491046906, 0.0491043329,
+        0.049037993, 0.0490075946, 0.0489973426, 0.0489969254, 0.0489966869, 0.048966825,
+        0.0489571095, 0.0489571095, 0.0489571095, 0.0489480495, 0.0489480495, 0.0489480495,
+        0.0489480495, 0.0489480495, 0.0489480495, 0.0485646129, 0.048299849, 0.0481042266,
+        0.0479903817, 0.047939539, 0.0479188561, 0.0479156971, 0.0479151011, 0.0477020144,
+        0.0475672483, 0.0474814773, 0.047442615, 0.0474289656, 0.0474267602, 0.047426641,
+        0.0473150015, 0.0472509265, 0.0472235084, 0.0472124815, 0.047211349, 0.0472111702,
+        0.0471606255, 0.0471400023, 0.0471330881, 0.0471327901, 0.0471326113, 0.0471092463,
+        0.0471029878, 0.0471029878, 0.0471029282, 0.0470970273, 0.0470970273, 0.0470970273,
+        0.0470970273, 0.0470970273, 0.0470970273, 0.0469304323, 0.0468223691, 0.0467519164,
+        0.0467190742, 0.0467088819, 0.0467066765, 0.0467062593, 0.0466204882, 0.0465741754,
+        0.0465514064, 0.0465433598, 0.0465424657, 0.0465422869, 0.046505332, 0.0464875102,
+        0.0464832187, 0.0464830399, 0.046482861, 0.0464654565, 0.0464596748, 0.0464596748,
+        0.0464596748, 0.0464544892, 0.0464544892, 0.0464544892, 0.0464544892, 0.0464544892,
+        0.0464544892, 0.0463936329, 0.0463583469, 0.046343565, 0.0463374257, 0.0463366508,
+        0.0463365316, 0.0463094115, 0.0462986231, 0.0462955832, 0.0462951064, 0.0462949276,
+        0.0462828279, 0.0462789536, 0.0462789536, 0.0462788343, 0.0462758541, 0.0462758541,
+        0.0462758541, 0.0462758541, 0.0462758541, 0.0462758541, 0.0462501049, 0.0462394357,
+        0.046235323, 0.0462349653, 0.0462349057, 0.0462236404, 0.0462206006, 0.0462206006,
+        0.046220541, 0.046218574, 0.046218574, 0.046218574, 0.046218574, 0.046218574,
+        0.046218574, 0.0462077856, 0.0462048054, 0.0462048054, 0.0462046862, 0.0462030172,
+        0.0462030172, 0.0462030172, 0.0462030172, 0.0462030172, 0.0462030172, 0.0461996794,
+        0.0461996794, 0.0461996794, 0.0461996794, 0.0461996794, 0.0461996794, 0.0461996794,
+        0.0461996794, 0.0461996794, 0.0461996794, 0.0449014306, 0.0438647866, 0.0430747867,
+        0.0425285101, 0.0421720147, 0.0419693589, 0.0418812633, 0.041854322, 0.041854322,
+        0.041854322, 0.0410184264, 0.0403956175, 0.0399457812, 0.0396540165, 0.039493084,
+        0.0394203067, 0.0393979549, 0.0393979549, 0.0393979549, 0.0388891101, 0.0385349989,
+        0.0383074284, 0.0381757021, 0.0381191373, 0.0381037593, 0.0381037593, 0.0381037593,
+        0.037825644, 0.0376362801, 0.0375384688, 0.0374946594, 0.037483871, 0.037483871,
+        0.037483871, 0.0373318791, 0.0372480154, 0.0372113585, 0.0372025967, 0.0372025967,
+        0.0372025967, 0.0371282697, 0.0370937586, 0.0370868444, 0.0370868444, 0.0370868444,
+        0.0370535254, 0.0370457768, 0.0370457768, 0.0370457768, 0.0370383263, 0.0370383263,
+        0.0370383263, 0.0370383263, 0.0370383263, 0.0370383263, 0.0362915397, 0.0357180834,
+        0.0352931619, 0.0350087285, 0.0348449349, 0.0347678661, 0.0347425342, 0.0347425342,
+        0.0347425342, 0.0342894197, 0.0339592099, 0.0337390304, 0.0336065292, 0.0335478783,
+        0.0335287452, 0.0335287452, 0.0335287452, 0.033272922, 0.0331019759, 0.0330030322,
+        0.0329576135, 0.0329435468, 0.0329435468, 0.0329435468, 0.032812655, 0.0327365994,
+        0.032702148, 0.0326914191, 0.0326914191, 0.0326914191, 0.0326216221, 0.0325906277,
+        0.0325814486, 0.0325814486, 0.0325814486, 0.0325548649, 0.0325461626, 0.0325461626,
+        0.0325461626, 0.0325343013, 0.0325343013, 0.0325343013, 0.0325343013, 0.0325343013,
+        0.0325343013, 0.0321720243, 0.0319055319, 0.0317134261, 0.0316019058, 0.0315504074,
+        0.0315333009, 0.0315333009, 0.0315333009, 0.0313288569, 0.0311887264, 0.0311073065,
+        0.0310698152, 0.0310581923, 0.0310581923, 0.0310581923, 0.0309557319, 0.0308966637,
+        0.0308698416, 0.0308594704, 0.0308594704, 0.0308594704, 0.0308073759, 0.0307852626,
+        0.0307785869, 0.0307785869, 0.0307785869, 0.0307587385, 0.0307520628, 0.0307520628,
+        0.0307520628, 0.0307439566, 0.0307439566, 0.0307439566, 0.0307439566, 0.0307439566,
+        0.0307439566, 0.0305774212, 0.0304717422, 0.0304066539, 0.0303738713, 0.030363977,
+        0.030363977, 0.030363977, 0.0302863717, 0.0302450061, 0.0302234292, 0.0302168727,
+        0.0302168727, 0.0302168727, 0.030180037, 0.030164063, 0.0301597714, 0.0301597714,
+        0.0301597714, 0.0301451087, 0.0301398039, 0.0301398039, 0.0301398039, 0.030133307,
+        0.030133307, 0.030133307, 0.030133307, 0.030133307, 0.030133307, 0.0300748348,
+        0.0300434232, 0.0300280452, 0.0300226808, 0.0300226808, 0.0300226808, 0.0299984217,
+        0.0299874544, 0.029984653, 0.029984653, 0.029984653, 0.0299743414, 0.0299720764,
+        0.0299720764, 0.0299720764, 0.0299675465, 0.0299675465, 0.0299675465, 0.0299675465,
+        0.0299675465, 0.0299675465, 0.0299466252, 0.0299370289, 0.0299349427, 0.0299349427,
+        0.0299349427, 0.0299271345, 0.0299247503, 0.0299247503, 0.0299247503, 0.0299215913,
+        0.0299215913, 0.0299215913, 0.0299215913, 0.0299215913, 0.0299215913, 0.0299137831,
+        0.0299120545, 0.0299120545, 0.0299120545, 0.0299088359, 0.0299088359, 0.0299088359,
+        0.0299088359, 0.0299088359, 0.0299088359, 0.0299055576, 0.0299055576, 0.0299055576,
+        0.0299055576, 0.0299055576, 0.0299055576, 0.0299055576, 0.0299055576, 0.0299055576,
+        0.0299055576, 0.0287259817, 0.0276739597, 0.0269574523, 0.0265394449, 0.0263518691,
+        0.0262892842, 0.0262892842, 0.0262892842, 0.0252680182, 0.0244501233, 0.0239071846,
+        0.023583889, 0.0234323144, 0.0233803391, 0.0233803391, 0.0233803391, 0.0227541924,
+        0.022344172, 0.0221036673, 0.0219893456, 0.0219479203, 0.0219479203, 0.0219479203,
+        0.0216166973, 0.0214324594, 0.0213465095, 0.021315217, 0.021315217, 0.021315217,
+        0.0211566091, 0.0210822821, 0.0210591555, 0.0210591555, 0.0210591555, 0.0209891796,
+        0.0209642053, 0.0209642053, 0.0209642053, 0.0209344625, 0.0209344625, 0.0209344625,
+        0.0209344625, 0.0209344625, 0.0209344625, 0.0200692415, 0.0193965435, 0.0189356804,
+        0.018651545, 0.0185204744, 0.0184782743, 0.0184782743, 0.0184782743, 0.0179826021,
+        0.0176571012, 0.0174609423, 0.0173617005, 0.0173276067, 0.0173276067, 0.0173276067,
+        0.0170849562, 0.0169417262, 0.0168765187, 0.0168532133, 0.0168532133, 0.0168532133,
+        0.0167360306, 0.0166857839, 0.0166684389, 0.0166684389, 0.0166684389, 0.016618669,
+        0.0166013241, 0.0166013241, 0.0166013241, 0.0165778995, 0.0165778995, 0.0165778995,
+        0.0165778995, 0.0165778995, 0.0165778995, 0.0161946416, 0.0159448385, 0.0157863498,
+        0.0157049298, 0.0156782866, 0.0156782866, 0.0156782866, 0.0155018568, 0.0154018402,
+        0.0153518319, 0.0153336525, 0.0153336525, 0.0153336525, 0.015260458, 0.015224874,
+        0.0152121186, 0.0152121186, 0.0152121186, 0.0151773095, 0.0151649117, 0.0151649117,
+        0.0151649117, 0.0151486397, 0.0151486397, 0.0151486397, 0.0151486397, 0.0151486397,
+        0.0151486397, 0.0150180459, 0.014954567, 0.0149202347, 0.0149044991, 0.0149044991,
+        0.0149044991, 0.0148577094, 0.0148366094, 0.0148285627, 0.0148285627, 0.0148285627,
+        0.0148085356, 0.0148002505, 0.0148002505, 0.0148002505, 0.0147895217, 0.0147895217,
+        0.0147895217, 0.0147895217, 0.0147895217, 0.0147895217, 0.0147502422, 0.0147356391,
+        0.0147302747, 0.0147302747, 0.0147302747, 0.0147144198, 0.0147099495, 0.0147099495,
+        0.0147099495, 0.0147030354, 0.0147030354, 0.0147030354, 0.0147030354, 0.0147030354,
+        0.0147030354, 0.0146886706, 0.0146831274, 0.0146831274, 0.0146831274, 0.0146767497,
+        0.0146767497, 0.0146767497, 0.0146767497, 0.0146767497, 0.0146767497, 0.0146694779,
+        0.0146694779, 0.0146694779, 0.0146694779, 0.0146694779, 0.0146694779, 0.0146694779,
+        0.0146694779, 0.0146694779, 0.0146694779, 0.0140057802, 0.0135082603, 0.0130655169,
+        0.0127996802, 0.0126745701, 0.0126305223, 0.0126305223, 0.0126305223, 0.012227118,
+        0.0119230747, 0.01173985, 0.0116499662, 0.0116174817, 0.0116174817, 0.0116174817,
+        0.0114018321, 0.0112764835, 0.0112137198, 0.0111914277, 0.0111914277, 0.0111914277,
+        0.0110881329, 0.0110425949, 0.0110274553, 0.0110274553, 0.0110274553, 0.0109820366,
+        0.0109667182, 0.0109667182, 0.0109667182, 0.0109452009, 0.0109452009, 0.0109452009,
+        0.0109452009, 0.0109452009, 0.0109452009, 0.010619998, 0.0104002953, 0.0102576017,
+        0.0101807714, 0.0101565719, 0.0101565719, 0.0101565719, 0.010007143, 0.00992113352,
+        0.00987774134, 0.00986236334, 0.00986236334, 0.00986236334, 0.00980275869, 0.0097759366,
+        0.00976544619, 0.00976544619, 0.00976544619, 0.00973647833, 0.00972652435, 0.00972652435,
+        0.00972652435, 0.00971186161, 0.00971186161, 0.00971186161, 0.00971186161, 0.00971186161,
+        0.00971186161, 0.00960838795, 0.00956004858, 0.00953263044, 0.00951635838, 0.00951635838,
+        0.00951635838, 0.0094820857, 0.00946754217, 0.00946116447, 0.00946116447, 0.00946116447,
+        0.00944668055, 0.0094410181, 0.0094410181, 0.0094410181, 0.00943225622, 0.00943225622,
+        0.00943225622, 0.00943225622, 0.00943225622, 0.00943225622, 0.00940746069, 0.00939840078,
+        0.00939518213, 0.00939518213, 0.00939518213, 0.00938624144, 0.00938373804, 0.00938373804,
+        0.00938373804, 0.0093793869, 0.0093793869, 0.0093793869, 0.0093793869, 0.0093793869,
+        0.0093793869, 0.00937157869, 0.00936836004, 0.00936836004, 0.00936836004, 0.00936365128,
+        0.00936365128, 0.00936365128, 0.00936365128, 0.00936365128, 0.00936365128, 0.00935900211,
+        0.00935900211, 0.00935900211, 0.00935900211, 0.00935900211, 0.00935900211, 0.00935900211,
+        0.00935900211, 0.00935900211, 0.00935900211, 0.00912261009, 0.00897705555, 0.00884723663,
+        0.00877559185, 0.00874996185, 0.00874996185, 0.00874996185, 0.00864261389, 0.00857168436,
+        0.00853359699, 0.00851947069, 0.00851947069, 0.00851947069, 0.00847101212, 0.00844556093,
+        0.00843685865, 0.00843685865, 0.00843685865, 0.00841379166, 0.00840497017, 0.00840497017,
+        0.00840497017, 0.00839573145, 0.00839573145, 0.00839573145, 0.00839573145, 0.00839573145,
+        0.00839573145, 0.00832432508, 0.00828582048, 0.00826150179, 0.00825077295, 0.00825077295,
+        0.00825077295, 0.00823169947, 0.00822174549, 0.00821691751, 0.00821691751, 0.00821691751,
+        0.00820809603, 0.00820374489, 0.00820374489, 0.00820374489, 0.0081987977, 0.0081987977,
+        0.0081987977, 0.0081987977, 0.0081987977, 0.0081987977, 0.00818830729, 0.00818449259,
+        0.00818240643, 0.00818240643, 0.00818240643, 0.00817883015, 0.00817710161, 0.00817710161,
+        0.00817710161, 0.00817459822, 0.00817459822, 0.00817459822, 0.00817459822, 0.00817459822,
+        0.00817459822, 0.0081704855, 0.00816875696, 0.00816875696, 0.00816875696, 0.00816661119,
+        0.00816661119, 0.00816661119, 0.00816661119, 0.00816661119, 0.00816661119, 0.00816357136,
+        0.00816357136, 0.00816357136, 0.00816357136, 0.00816357136, 0.00816357136, 0.00816357136,
+        0.00816357136, 0.00816357136, 0.00816357136, 0.00811672211, 0.00810134411, 0.00807827711,
+        0.00806760788, 0.00806760788, 0.00806760788, 0.00806373358, 0.00805735588, 0.00805401802,
+        0.00805401802, 0.00805401802, 0.00804811716, 0.00804412365, 0.00804412365, 0.00804412365,
+        0.00803911686, 0.00803911686, 0.00803911686, 0.00803911686, 0.00803911686, 0.00803911686,
+        0.00803864002, 0.00803720951, 0.00803679228, 0.00803679228, 0.00803679228, 0.00803607702,
+        0.00803565979, 0.00803565979, 0.00803565979, 0.00803500414, 0.00803500414, 0.00803500414,
+        0.00803500414, 0.00803500414, 0.00803500414, 0.00803500414, 0.00803440809, 0.00803440809,
+        0.00803440809, 0.00803339481, 0.00803339481, 0.00803339481, 0.00803339481, 0.00803339481,
+        0.00803339481, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114, 0.00803244114,
+        0.00803244114, 0.00803244114, 0.0075134635, 0.00706744194, 0.00679165125, 0.00665271282,
+        0.00660264492, 0.00660264492, 0.00660264492, 0.00618892908, 0.00586301088, 0.00567245483,
+        0.00557309389, 0.00553488731, 0.00553488731, 0.00553488731, 0.00530147552, 0.0051638484,
+        0.00509470701, 0.00506711006, 0.00506711006, 0.00506711006, 0.00496470928, 0.00491064787,
+        0.00489270687, 0.00489270687, 0.00489270687, 0.00483965874, 0.0048212409, 0.0048212409,
+        0.0048212409, 0.00480264425, 0.00480264425, 0.00480264425, 0.00480264425, 0.00480264425,
+        0.00480264425, 0.00445395708, 0.00421750546, 0.00406348705, 0.00397652388, 0.00394582748,
+        0.00394582748, 0.00394582748, 0.00378018618, 0.00368660688, 0.00363361835, 0.00361293554,
+        0.00361293554, 0.00361293554, 0.00354468822, 0.00350749493, 0.00349503756, 0.00349503756,
+        0.00349503756, 0.00345790386, 0.00344598293, 0.00344598293, 0.00344598293, 0.00343418121,
+        0.00343418121, 0.00343418121, 0.00343418121, 0.00343418121, 0.00343418121, 0.00331884623,
+        0.0032607913, 0.00322556496, 0.00320827961, 0.00320827961, 0.00320827961, 0.00317275524,
+        0.00315332413, 0.00314474106, 0.00314474106, 0.00314474106, 0.00312197208, 0.00311374664,
+        0.00311374664, 0.00311374664, 0.00310540199, 0.00310540199, 0.00310540199, 0.00310540199,
+        0.00310540199, 0.00310540199, 0.00307792425, 0.00306332111, 0.00305908918, 0.00305908918,
+        0.00305908918, 0.00304579735, 0.00304061174, 0.00304061174, 0.00304061174, 0.00303655863,
+        0.00303655863, 0.00303655863, 0.00303655863, 0.00303655863, 0.00303655863, 0.00302374363,
+        0.00301903486, 0.00301903486, 0.00301903486, 0.00301402807, 0.00301402807, 0.00301402807,
+        0.00301402807, 0.00301402807, 0.00301402807, 0.0030092001, 0.0030092001, 0.0030092001,
+        0.0030092001, 0.0030092001, 0.0030092001, 0.0030092001, 0.0030092001, 0.0030092001,
+        0.0030092001, 0.00275474787, 0.00258201361, 0.00244563818, 0.00236964226, 0.00234478712,
+        0.00234478712, 0.00234478712, 0.00222682953, 0.00214546919, 0.00209802389, 0.00208044052,
+        0.00208044052, 0.00208044052, 0.00202775002, 0.0019980073, 0.00198739767, 0.00198739767,
+        0.00198739767, 0.00195527077, 0.00194394588, 0.00194394588, 0.00194394588, 0.00193357468,
+        0.00193357468, 0.00193357468, 0.00193357468, 0.00193357468, 0.00193357468, 0.0018414259,
+        0.00179493427, 0.00176250935, 0.00174975395, 0.00174975395, 0.00174975395, 0.00172650814,
+        0.0017118454, 0.00170516968, 0.00170516968, 0.00170516968, 0.00169068575, 0.00168377161,
+        0.00168377161, 0.00168377161, 0.00167584419, 0.00167584419, 0.00167584419, 0.00167584419,
+        0.00167584419, 0.00167584419, 0.0016592741, 0.00165194273, 0.00164949894, 0.00164949894,
+        0.00164949894, 0.00164180994, 0.00163930655, 0.00163930655, 0.00163930655, 0.00163662434,
+        0.00163662434, 0.00163662434, 0.00163662434, 0.00163662434, 0.00163662434, 0.00162935257,
+        0.00162696838, 0.00162696838, 0.00162696838, 0.00162434578, 0.00162434578, 0.00162434578,
+        0.00162434578, 0.00162434578, 0.00162434578, 0.00162190199, 0.00162190199, 0.00162190199,
+        0.00162190199, 0.00162190199, 0.00162190199, 0.00162190199, 0.00162190199, 0.00162190199,
+        0.00162190199, 0.00155925751, 0.00153851509, 0.00151199102, 0.001498878, 0.001498878,
+        0.001498878, 0.00148969889, 0.00148028135, 0.00147515535, 0.00147515535, 0.00147515535,
+        0.00146579742, 0.00146138668, 0.00146138668, 0.00146138668, 0.00145733356, 0.00145733356,
+        0.00145733356, 0.00145733356, 0.00145733356, 0.00145733356, 0.00145220757, 0.00144934654,
+        0.00144809484, 0.00144809484, 0.00144809484, 0.0014449358, 0.00144344568, 0.00144344568,
+        0.00144344568, 0.00144219398, 0.00144219398, 0.00144219398, 0.00144219398, 0.00144219398,
+        0.00144219398, 0.0014398694, 0.00143885612, 0.00143885612, 0.00143885612, 0.00143802166,
+        0.00143802166, 0.00143802166, 0.00143802166, 0.00143802166, 0.00143802166, 0.00143706799,
+        0.00143706799, 0.00143706799, 0.00143706799, 0.00143706799, 0.00143706799, 0.00143706799,
+        0.00143706799, 0.00143706799, 0.00143706799, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775, 0.00143408775,
+        0.00143408775, 0.00126934052, 0.0011330843, 0.00105303526, 0.00102639198, 0.00102639198,
+        0.00102639198, 0.000905573368, 0.00082474947, 0.000776708126, 0.000759065151, 0.000759065151,
+        0.000759065151, 0.000710248947, 0.000680506229, 0.000669598579, 0.000669598579, 0.000669598579,
+        0.000641345978, 0.00063085556, 0.00063085556, 0.00063085556, 0.000621855259, 0.000621855259,
+        0.000621855259, 0.000621855259, 0.000621855259, 0.000621855259, 0.000529170036, 0.000482559204,
+        0.000452458858, 0.000439465046, 0.000439465046, 0.000439465046, 0.000414073467, 0.000398695469,
+        0.000392317772, 0.000392317772, 0.000392317772, 0.000377655029, 0.000372111797, 0.000372111797,
+        0.000372111797, 0.000365376472, 0.000365376472, 0.000365376472, 0.000365376472, 0.000365376472,
+        0.000365376472, 0.000352501869, 0.000344574451, 0.000341773033, 0.000341773033, 0.000341773033,
+        0.000333547592, 0.00033056736, 0.00033056736, 0.00033056736, 0.000328302383, 0.000328302383,
+        0.000328302383, 0.000328302383, 0.000328302383, 0.000328302383, 0.000321567059, 0.000319421291,
+        0.000319421291, 0.000319421291, 0.000316858292, 0.000316858292, 0.000316858292, 0.000316858292,
+        0.000316858292, 0.000316858292, 0.000314354897, 0.000314354897, 0.000314354897, 0.000314354897,
+        0.000314354897, 0.000314354897, 0.000314354897, 0.000314354897, 0.000314354897, 0.000314354897,
+        0.000253736973, 0.00022995472, 0.000202000141, 0.000190079212, 0.000190079212, 0.000190079212,
+        0.00018030405, 0.000169456005, 0.000164806843, 0.000164806843, 0.000164806843, 0.000154435635,
+        0.000149190426, 0.000149190426, 0.000149190426, 0.000145375729, 0.000145375729, 0.000145375729,
+        0.000145375729, 0.000145375729, 0.000145375729, 0.000139772892, 0.000136733055, 0.000136435032,
+        0.000136435032, 0.000136435032, 0.000133156776, 0.000132262707, 0.000132262707, 0.000132262707,
+        0.000131130219, 0.000131130219, 0.000131130219, 0.000131130219, 0.000131130219, 0.000131130219,
+        0.000128388405, 0.00012755394, 0.00012755394, 0.00012755394, 0.000126719475, 0.000126719475,
+        0.000126719475, 0.000126719475, 0.000126719475, 0.000126719475, 0.000125408173, 0.000125408173,
+        0.000125408173, 0.000125408173, 0.000125408173, 0.000125408173, 0.000125408173, 0.000125408173,
+        0.000125408173, 0.000125408173, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568, 0.000122785568,
+        0.000100791454, 7.59363174e-05, 6.41345978e-05, 6.41345978e-05, 6.41345978e-05, 5.44786453e-05,
+        4.51803207e-05, 4.05907631e-05, 4.05907631e-05, 4.05907631e-05, 3.06963921e-05, 2.54511833e-05,
+        2.54511833e-05, 2.54511833e-05, 2.05039978e-05, 2.05039978e-05, 2.05039978e-05, 2.05039978e-05,
+        2.05039978e-05, 2.05039978e-05, 1.57952309e-05, 1.257658e-05, 1.18017197e-05, 1.18017197e-05,
+        1.18017197e-05, 9.11951065e-06, 7.9870224e-06, 7.9870224e-06, 7.9870224e-06, 7.15255737e-06,
+        7.15255737e-06, 7.15255737e-06, 7.15255737e-06, 7.15255737e-06, 7.15255737e-06, 5.1856041e-06,
+        4.35113907e-06, 4.35113907e-06, 4.35113907e-06, 3.03983688e-06, 3.03983688e-06, 3.03983688e-06,
+        3.03983688e-06, 3.03983688e-06, 3.03983688e-06, 2.32458115e-06, 2.32458115e-06, 2.32458115e-06,
+        2.32458115e-06, 2.32458115e-06, 2.32458115e-06, 2.32458115e-06, 2.32458115e-06, 2.32458115e-06,
+        2.32458115e-06, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+    },
+};
+
+unsigned int rank_frequency(enum rank_variant variant, int rank) {
+  return rank_frequency_table[variant][rank];
+}
+
+float rank_percentile(enum rank_variant variant, int rank) {
+  return rank_percentile_table[variant][rank];
+}
@@ -0,0 +1,15249 @@
+/* Generated by tools/gen_rank_info.cc, do not edit by hand. */
+
+#include <phevaluator/rank.h>
+
+const char rank_description_pool[5879] =
+    "\0"
+    "Royal Flush\0"
+    "King-High Straight Flush\0"
+    "Queen-High Straight Flush\0"
+    "Jack-High Straight Flush\0"
+    "Ten-High Straight Flush\0"
+    "Nine-High Straight Flush\0"
+    "Eight-High Straight Flush\0"
+    "Seven-High Straight Flush\0"
+    "Six-High Straight Flush\0"
+    "Five-High Straight Flush\0"
+    "Four Aces\0"
+    "Four Kings\0"
+    "Four Queens\0"
+    "Four Jacks\0"
+    "Four Tens\0"
+    "Four Nines\0"
+    "Four Eights\0"
+    "Four Sevens\0"
+    "Four Sixes\0"
+    "Four Fives\0"
+    "Four Fours\0"
+    "Four Treys\0"
+    "Four Deuces\0"
+    "Aces Full over Kings\0"
+    "Aces Full over Queens\0"
+    "Aces Full over Jacks\0"
+    "Aces Full over Tens\0"
+    "Aces Full over Nines\0"
+    "Aces Full over Eights\0"
+    "Aces Full over Sevens\0"
+    "Aces Full over Sixes\0"
+    "Aces Full over Fives\0"
+    "Aces Full over Fours\0"
+    "Aces Full over Treys\0"
+    "Aces Full over Deuces\0"
+    "Kings Full over Aces\0"
+    "Kings Full over Queens\0"
+    "Kings Full over Jacks\0"
+    "Kings Full over Tens\0"
+    "Kings Full over Nines\0"
+    "Kings Full over Eights\0"
+    "Kings Full over Sevens\0"
+    "Kings Full over Sixes\0"
+    "Kings Full over Fives\0"
+    "Kings Full over Fours\0"
+    "Kings Full over Treys\0"
+    "Kings Full over Deuces\0"
+    "Queens Full over Aces\0"
+    "Queens Full over Kings\0"
+    "Queens Full over Jacks\0"
+    "Queens Full over Tens\0"
+    "Queens Full over Nines\0"
+    "Queens Full over Eights\0"
+    "Queens Full over Sevens\0"
+    "Queens Full over Sixes\0"
+    "Queens Full over Fives\0"
+    "Queens Full over Fours\0"
+    "Queens Full over Treys\0"
+    "Queens Full over Deuces\0"
+    "Jacks Full over Aces\0"
+    "Jacks Full over Kings\0"
+    "Jacks Full over Queens\0"
+    "Jacks Full over Tens\0"
+    "Jacks Full over Nines\0"
+    "Jacks Full over Eights\0"
+    "Jacks Full over Sevens\0"
+    "Jacks Full over Sixes\0"
+    "Jacks Full over Fives\0"
+    "Jacks Full over Fours\0"
+    "Jacks Full over Treys\0"
+    "Jacks Full over Deuces\0"
+    "Tens Full over Aces\0"
+    "Tens Full over Kings\0"
+    "Tens Full over Queens\0"
+    "Tens Full over Jacks\0"
+    "Tens Full over Nines\0"
+    "Tens Full over Eights\0"
+    "Tens Full over Sevens\0"
+    "Tens Full over Sixes\0"
+    "Tens Full over Fives\0"
+    "Tens Full over Fours\0"
+    "Tens Full over Treys\0"
+    "Tens Full over Deuces\0"
+    "Nines Full over Aces\0"
+    "Nines Full over Kings\0"
+    "Nines Full over Queens\0"
+    "Nines Full over Jacks\0"
+    "Nines Full over Tens\0"
+    "Nines Full over Eights\0"
+    "Nines Full over Sevens\0"
+    "Nines Full over Sixes\0"
+    "Nines Full over Fives\0"
+    "Nines Full over Fours\0"
+    "Nines Full over Treys\0"
+    "Nines Full over Deuces\0"
+    "Eights Full over Aces\0"
+    "Eights Full over Kings\0"
+    "Eights Full over Queens\0"
+    "Eights Full over Jacks\0"
+    "Eights Full over Tens\0"
+    "Eights Full over Nines\0"
+    "Eights Full over Sevens\0"
+    "Eights Full over Sixes\0"
+    "Eights Full over Fives\0"
+    "Eights Full over Fours\0"
+    "Eights Full over Treys\0"
+    "Eights Full over Deuces\0"
+    "Sevens Full over Aces\0"
+    "Sevens Full over Kings\0"
+    "Sevens Full over Queens\0"
+    "Sevens Full over Jacks\0"
+    "Sevens Full over Tens\0"
+    "Sevens Full over Nines\0"
+    "Sevens Full over Eights\0"
+    "Sevens Full over Sixes\0"
+    "Sevens Full over Fives\0"
+    "Sevens Full over Fours\0"
+    "Sevens Full over Treys\0"
+    "Sevens Full over Deuces\0"
+    "Sixes Full over Aces\0"
+    "Sixes Full over Kings\0"
+    "Sixes Full over Queens\0"
+    "Sixes Full over Jacks\0"
+    "Sixes Full over Tens\0"
+    "Sixes Full over Nines\0"
+    "Sixes Full over Eights\0"
+    "Sixes Full over Sevens\0"
+    "Sixes Full over Fives\0"
+    "Sixes Full over Fours\0"
+    "Sixes Full over Treys\0"
+    "Sixes Full over Deuces\0"
+    "Fives Full over Aces\0"
+    "Fives Full over Kings\0"
+    "Fives Full over Queens\0"
+    "Fives Full over Jacks\0"
+    "Fives Full over Tens\0"
+    "Fives Full over Nines\0"
+    "Fives Full over Eights\0"
+    "Fives Full over Sevens\0"
+    "Fives Full over Sixes\0"
+    "Fives Full over Fours\0"
+    "Fives Full over Treys\0"
+    "Fives Full over Deuces\0"
+    "Fours Full over Aces\0"
+    "Fours Full over Kings\0"
+    "Fours Full over Queens\0"
+    "Fours Full over Jacks\0"
+    "Fours Full over Tens\0"
+    "Fours Full over Nines\0"
+    "Fours Full over Eights\0"
+    "Fours Full over Sevens\0"
+    "Fours Full over Sixes\0"
+    "Fours Full over Fives\0"
+    "Fours Full over Treys\0"
+    "Fours Full over Deuces\0"
+    "Treys Full over Aces\0"
+    "Treys Full over Kings\0"
+    "Treys Full over Queens\0"
+    "Treys Full over Jacks\0"
+    "Treys Full over Tens\0"
+    "Treys Full over Nines\0"
+    "Treys Full over Eights\0"
+    "Treys Full over Sevens\0"
+    "Treys Full over Sixes\0"
+    "Treys Full over Fives\0"
+    "Treys Full over Fours\0"
+    "Treys Full over Deuces\0"
+    "Deuces Full over Aces\0"
+    "Deuces Full over Kings\0"
+    "Deuces Full over Queens\0"
+    "Deuces Full over Jacks\0"
+    "Deuces Full over Tens\0"
+    "Deuces Full over Nines\0"
+    "Deuces Full over Eights\0"
+    "Deuces Full over Sevens\0"
+    "Deuces Full over Sixes\0"
+    "Deuces Full over Fives\0"
+    "Deuces Full over Fours\0"
+    "Deuces Full over Treys\0"
+    "Ace-High Flush\0"
+    "King-High Flush\0"
+    "Queen-High Flush\0"
+    "Jack-High Flush\0"
+    "Ten-High Flush\0"
+    "Nine-High Flush\0"
+    "Eight-High Flush\0"
+    "Seven-High Flush\0"
+    "Ace-High Straight\0"
+    "King-High Straight\0"
+    "Queen-High Straight\0"
+    "Jack-High Straight\0"
+    "Ten-High Straight\0"
+    "Nine-High Straight\0"
+    "Eight-High Straight\0"
+    "Seven-High Straight\0"
+    "Six-High Straight\0"
+    "Five-High Straight\0"
+    "Three Aces\0"
+    "Three Kings\0"
+    "Three Queens\0"
+    "Three Jacks\0"
+    "Three Tens\0"
+    "Three Nines\0"
+    "Three Eights\0"
+    "Three Sevens\0"
+    "Three Sixes\0"
+    "Three Fives\0"
+    "Three Fours\0"
+    "Three Treys\0"
+    "Three Deuces\0"
+    "Aces and Kings\0"
+    "Aces and Queens\0"
+    "Aces and Jacks\0"
+    "Aces and Tens\0"
+    "Aces and Nines\0"
+    "Aces and Eights\0"
+    "Aces and Sevens\0"
+    "Aces and Sixes\0"
+    "Aces and Fives\0"
+    "Aces and Fours\0"
+    "Aces and Treys\0"
+    "Aces and Deuces\0"
+    "Kings and Queens\0"
+    "Kings and Jacks\0"
+    "Kings and Tens\0"
+    "Kings and Nines\0"
+    "Kings and Eights\0"
+    "Kings and Sevens\0"
+    "Kings and Sixes\0"
+    "Kings and Fives\0"
+    "Kings and Fours\0"
+    "Kings and Treys\0"
+    "Kings and Deuces\0"
+    "Queens and Jacks\0"
+    "Queens and Tens\0"
+    "Queens and Nines\0"
+    "Queens and Eights\0"
+    "Queens and Sevens\0"
+    "Queens and Sixes\0"
+    "Queens and Fives\0"
+    "Queens and Fours\0"
+    "Queens and Treys\0"
+    "Queens and Deuces\0"
+    "Jacks and Tens\0"
+    "Jacks and Nines\0"
+    "Jacks and Eights\0"
+    "Jacks and Sevens\0"
+    "Jacks and Sixes\0"
+    "Jacks and Fives\0"
+    "Jacks and Fours\0"
+    "Jacks and Treys\0"
+    "Jacks and Deuces\0"
+    "Tens and Nines\0"
+    "Tens and Eights\0"
+    "Tens and Sevens\0"
+    "Tens and Sixes\0"
+    "Tens and Fives\0"
+    "Tens and Fours\0"
+    "Tens and Treys\0"
+    "Tens and Deuces\0"
+    "Nines and Eights\0"
+    "Nines and Sevens\0"
+    "Nines and Sixes\0"
+    "Nines and Fives\0"
+    "Nines and Fours\0"
+    "Nines and Treys\0"
+    "Nines and Deuces\0"
+    "Eights and Sevens\0"
+    "Eights and Sixes\0"
+    "Eights and Fives\0"
+    "Eights and Fours\0"
+    "Eights and Treys\0"
+    "Eights and Deuces\0"
+    "Sevens and Sixes\0"
+    "Sevens and Fives\0"
+    "Sevens and Fours\0"
+    "Sevens and Treys\0"
+    "Sevens and Deuces\0"
+    "Sixes and Fives\0"
+    "Sixes and Fours\0"
+    "Sixes and Treys\0"
+    "Sixes and Deuces\0"
+    "Fives and Fours\0"
+    "Fives and Treys\0"
+    "Fives and Deuces\0"
+    "Fours and Treys\0"
+    "Fours and Deuces\0"
+    "Treys and Deuces\0"
+    "Pair of Aces\0"
+    "Pair of Kings\0"
+    "Pair of Queens\0"
+    "Pair of Jacks\0"
+    "Pair of Tens\0"
+    "Pair of Nines\0"
+    "Pair of Eights\0"
+    "Pair of Sevens\0"
+    "Pair of Sixes\0"
+    "Pair of Fives\0"
+    "Pair of Fours\0"
+    "Pair of Treys\0"
+    "Pair of Deuces\0"
+    "Ace-High\0"
+    "King-High\0"
+    "Queen-High\0"
+    "Jack-High\0"
+    "Ten-High\0"
+    "Nine-High\0"
+    "Eight-High\0"
+    "Seven-High\0"
+    ;
+
+const char rank_sample_pool[7463][6] = {
+    "",
+    "AKQJT",
+    "KQJT9",
+    "QJT98",
+    "JT987",
+    "T9876",
+    "98765",
+    "87654",
+    "76543",
+    "65432",
+    "5432A",
+    "AAAAK",
+    "AAAAQ",
+    "AAAAJ",
+    "AAAAT",
+    "AAAA9",
+    "AAAA8",
+    "AAAA7",
+    "AAAA6",
+    "AAAA5",
+    "AAAA4",
+    "AAAA3",
+    "AAAA2",
+    "KKKKA",
+    "KKKKQ",
+    "KKKKJ",
+    "KKKKT",
+    "KKKK9",
+    "KKKK8",
+    "KKKK7",
+    "KKKK6",
+    "KKKK5",
+    "KKKK4",
+    "KKKK3",
+    "KKKK2",
+    "QQQQA",
+    "QQQQK",
+    "QQQQJ",
+    "QQQQT",
+    "QQQQ9",
+    "QQQQ8",
+    "QQQQ7",
+    "QQQQ6",
+    "QQQQ5",
+    "QQQQ4",
+    "QQQQ3",
+    "QQQQ2",
+    "JJJJA",
+    "JJJJK",
+    "JJJJQ",
+    "JJJJT",
+    "JJJJ9",
+    "JJJJ8",
+    "JJJJ7",
+    "JJJJ6",
+    "JJJJ5",
+    "JJJJ4",
+    "JJJJ3",
+    "JJJJ2",
+    "TTTTA",
+    "TTTTK",
+    "TTTTQ",
+    "TTTTJ",
+    "TTTT9",
+    "TTTT8",
+    "TTTT7",
+    "TTTT6",
+    "TTTT5",
+    "TTTT4",
+    "TTTT3",
+    "TTTT2",
+    "9999A",
+    "9999K",
+    "9999Q",
+    "9999J",
+    "9999T",
+    "99998",
+    "99997",
+    "99996",
+    "99995",
+    "99994",
+    "99993",
+    "99992",
+    "8888A",
+    "8888K",
+    "8888Q",
+    "8888J",
+    "8888T",
+    "88889",
+    "88887",
+    "88886",
+    "88885",
+    "88884",
+    "88883",
+    "88882",
+    "7777A",
+    "7777K",
+    "7777Q",
+    "7777J",
+    "7777T",
+    "77779",
+    "77778",
+    "77776",
+    "77775",
+    "77774",
+    "77773",
+    "77772",
+    "6666A",
+    "6666K",
+    "6666Q",
+    "6666J",
+    "6666T",
+    "66669",
+    "66668",
+    "66667",
+    "66665",
+    "66664",
+    "66663",
+    "66662",
+    "5555A",
+    "5555K",
+    "5555Q",
+    "5555J",
+    "5555T",
+    "55559",
+    "55558",
+    "55557",
+    "55556",
+    "55554",
+    "55553",
+    "55552",
+    "4444A",
+    "4444K",
+    "4444Q",
+    "4444J",
+    "4444T",
+    "44449",
+    "44448",
+    "44447",
+    "44446",
+    "44445",
+    "44443",
+    "44442",
+    "3333A",
+    "3333K",
+    "3333Q",
+    "3333J",
+    "3333T",
+    "33339",
+    "33338",
+    "33337",
+    "33336",
+    "33335",
+    "33334",
+    "33332",
+    "2222A",
+    "2222K",
+    "2222Q",
+    "2222J",
+    "2222T",
+    "22229",
+    "22228",
+    "22227",
+    "22226",
+    "22225",
+    "22224",
+    "22223",
+    "AAAKK",
+    "AAAQQ",
+    "AAAJJ",
+    "AAATT",
+    "AAA99",
+    "AAA88",
+    "AAA77",
+    "AAA66",
+    "AAA55",
+    "AAA44",
+    "AAA33",
+    "AAA22",
+    "KKKAA",
+    "KKKQQ",
+    "KKKJJ",
+    "KKKTT",
+    "KKK99",
+    "KKK88",
+    "KKK77",
+    "KKK66",
+    "KKK55",
+    "KKK44",
+    "KKK33",
+    "KKK22",
+    "QQQAA",
+    "QQQKK",
+    "QQQJJ",
+    "QQQTT",
+    "QQQ99",
+    "QQQ88",
+    "QQQ77",
+    "QQQ66",
+    "QQQ55",
+    "QQQ44",
+    "QQQ33",
+    "QQQ22",
+    "JJJAA",
+    "JJJKK",
+    "JJJQQ",
+    "JJJTT",
+    "JJJ99",
+    "JJJ88",
+    "JJJ77",
+    "JJJ66",
+    "JJJ55",
+    "JJJ44",
+    "JJJ33",
+    "JJJ22",
+    "TTTAA",
+    "TTTKK",
+    "TTTQQ",
+    "TTTJJ",
+    "TTT99",
+    "TTT88",
+    "TTT77",
+    "TTT66",
+    "TTT55",
+    "TTT44",
+    "TTT33",
+    "TTT22",
+    "999AA",
+    "999KK",
+    "999QQ",
+    "999JJ",
+    "999TT",
+    "99988",
+    "99977",
+    "99966",
+    "99955",
+    "99944",
+    "99933",
+    "99922",
+    "888AA",
+    "888KK",
+    "888QQ",
+    "888JJ",
+    "888TT",
+    "88899",
+    "88877",
+    "88866",
+    "88855",
+    "88844",
+    "88833",
+    "88822",
+    "777AA",
+    "777KK",
+    "777QQ",
+    "777JJ",
+    "777TT",
+    "77799",
+    "77788",
+    "77766",
+    "77755",
+    "77744",
+    "77733",
+    "77722",
+    "666AA",
+    "666KK",
+    "666QQ",
+    "666JJ",
+    "666TT",
+    "66699",
+    "66688",
+    "66677",
+    "66655",
+    "66644",
+    "66633",
+    "66622",
+    "555AA",
+    "555KK",
+    "555QQ",
+    "555JJ",
+    "555TT",
+    "55599",
+    "55588",
+    "55577",
+    "55566",
+    "55544",
+    "55533",
+    "55522",
+    "444AA",
+    "444KK",
+    "444QQ",
+    "444JJ",
+    "444TT",
+    "44499",
+    "44488",
+    "44477",
+    "44466",
+    "44455",
+    "44433",
+    "44422",
+    "333AA",
+    "333KK",
+    "333QQ",
+    "333JJ",
+    "333TT",
+    "33399",
+    "33388",
+    "33377",
+    "33366",
+    "33355",
+    "33344",
+    "33322",
+    "222AA",
+    "222KK",
+    "222QQ",
+    "222JJ",
+    "222TT",
+    "22299",
+    "22288",
+    "22277",
+    "22266",
+    "22255",
+    "22244",
+    "22233",
+    "AKQJ9",
+    "AKQJ8",
+    "AKQJ7",
+    "AKQJ6",
+    "AKQJ5",
+    "AKQJ4",
+    "AKQJ3",
+    "AKQJ2",
+    "AKQT9",
+    "AKQT8",
+    "AKQT7",
+    "AKQT6",
+    "AKQT5",
+    "AKQT4",
+    "AKQT3",
+    "AKQT2",
+    "AKQ98",
+    "AKQ97",
+    "AKQ96",
+    "AKQ95",
+    "AKQ94",
+    "AKQ93",
+    "AKQ92",
+    "AKQ87",
+    "AKQ86",
+    "AKQ85",
+    "AKQ84",
+    "AKQ83",
+    "AKQ82",
+    "AKQ76",
+    "AKQ75",
+    "AKQ74",
+    "AKQ73",
+    "AKQ72",
+    "AKQ65",
+    "AKQ64",
+    "AKQ63",
+    "AKQ62",
+    "AKQ54",
+    "AKQ53",
+    "AKQ52",
+    "AKQ43",
+    "AKQ42",
+    "AKQ32",
+    "AKJT9",
+    "AKJT8",
+    "AKJT7",
+    "AKJT6",
+    "AKJT5",
+    "AKJT4",
+    "AKJT3",
+    "AKJT2",
+    "AKJ98",
+    "AKJ97",
+    "AKJ96",
+    "AKJ95",
+    "AKJ94",
+    "AKJ93",
+    "AKJ92",
+    "AKJ87",
+    "AKJ86",
+    "AKJ85",
+    "AKJ84",
+    "AKJ83",
+    "AKJ82",
+    "AKJ76",
+    "AKJ75",
+    "AKJ74",
+    "AKJ73",
+    "AKJ72",
+    "AKJ65",
+    "AKJ64",
+    "AKJ63",
+    "AKJ62",
+    "AKJ54",
+    "AKJ53",
+    "AKJ52",
+    "AKJ43",
+    "AKJ42",
+    "AKJ32",
+    "AKT98",
+    "AKT97",
+    "AKT96",
+    "AKT95",
+    "AKT94",
+    "AKT93",
+    "AKT92",
+    "AKT87",
+    "AKT86",
+    "AKT85",
+    "AKT84",
+    "AKT83",
+    "AKT82",
+    "AKT76",
+    "AKT75",
+    "AKT74",
+    "AKT73",
+    "AKT72",
+    "AKT65",
+    "AKT64",
+    "AKT63",
+    "AKT62",
+    "AKT54",
+    "AKT53",
+    "AKT52",
+    "AKT43",
+    "AKT42",
+    "AKT32",
+    "AK987",
+    "AK986",
+    "AK985",
+    "AK984",
+    "AK983",
+    "AK982",
+    "AK976",
+    "AK975",
+    "AK974",
+    "AK973",
+    "AK972",
+    "AK965",
+    "AK964",
+    "AK963",
+    "AK962",
+    "AK954",
+    "AK953",
+    "AK952",
+    "AK943",
+    "AK942",
+    "AK932",
+    "AK876",
+    "AK875",
+    "AK874",
+    "AK873",
+    "AK872",
+    "AK865",
+    "AK864",
+    "AK863",
+    "AK862",
+    "AK854",
+    "AK853",
+    "AK852",
+    "AK843",
+    "AK842",
+    "AK832",
+    "AK765",
+    "AK764",
+    "AK763",
+    "AK762",
+    "AK754",
+    "AK753",
+    "AK752",
+    "AK743",
+    "AK742",
+    "AK732",
+    "AK654",
+    "AK653",
+    "AK652",
+    "AK643",
+    "AK642",
+    "AK632",
+    "AK543",
+    "AK542",
+    "AK532",
+    "AK432",
+    "AQJT9",
+    "AQJT8",
+    "AQJT7",
+    "AQJT6",
+    "AQJT5",
+    "AQJT4",
+    "AQJT3",
+    "AQJT2",
+    "AQJ98",
+    "AQJ97",
+    "AQJ96",
+    "AQJ95",
+    "AQJ94",
+    "AQJ93",
+    "AQJ92",
+    "AQJ87",
+    "AQJ86",
+    "AQJ85",
+    "AQJ84",
+    "AQJ83",
+    "AQJ82",
+    "AQJ76",
+    "AQJ75",
+    "AQJ74",
+    "AQJ73",
+    "AQJ72",
+    "AQJ65",
+    "AQJ64",
+    "AQJ63",
+    "AQJ62",
+    "AQJ54",
+    "AQJ53",
+    "AQJ52",
+    "AQJ43",
+    "AQJ42",
+    "AQJ32",
+    "AQT98",
+    "AQT97",
+    "AQT96",
+    "AQT95",
+    "AQT94",
+    "AQT93",
+    "AQT92",
+    "AQT87",
+    "AQT86",
+    "AQT85",
+    "AQT84",
+    "AQT83",
+    "AQT82",
+    "AQT76",
+    "AQT75",
+    "AQT74",
+    "AQT73",
+    "AQT72",
+    "AQT65",
+    "AQT64",
+    "AQT63",
+    "AQT62",
+    "AQT54",
+    "AQT53",
+    "AQT52",
+    "AQT43",
+    "AQT42",
+    "AQT32",
+    "AQ987",
+    "AQ986",
+    "AQ985",
+    "AQ984",
+    "AQ983",
+    "AQ982",
+    "AQ976",
+    "AQ975",
+    "AQ974",
+    "AQ973",
+    "AQ972",
+    "AQ965",
+    "AQ964",
+    "AQ963",
+    "AQ962",
+    "AQ954",
+    "AQ953",
+    "AQ952",
+    "AQ943",
+    "AQ942",
+    "AQ932",
+    "AQ876",
+    "AQ875",
+    "AQ874",
+    "AQ873",
+    "AQ872",
+    "AQ865",
+    "AQ864",
+    "AQ863",
+    "AQ862",
+    "AQ854",
+    "AQ853",
+    "AQ852",
+    "AQ843",
+    "AQ842",
+    "AQ832",
+    "AQ765",
+    "AQ764",
+    "AQ763",
+    "AQ762",
+    "AQ754",
+    "AQ753",
+    "AQ752",
+    "AQ743",
+    "AQ742",
+    "AQ732",
+    "AQ654",
+    "AQ653",
+    "AQ652",
+    "AQ643",
+    "AQ642",
+    "AQ632",
+    "AQ543",
+    "AQ542",
+    "AQ532",
+    "AQ432",
+    "AJT98",
+    "AJT97",
+    "AJT96",
+    "AJT95",
+    "AJT94",
+    "AJT93",
+    "AJT92",
+    "AJT87",
+    "AJT86",
+    "AJT85",
+    "AJT84",
+    "AJT83",
+    "AJT82",
+    "AJT76",
+    "AJT75",
+    "AJT74",
+    "AJT73",
+    "AJT72",
+    "AJT65",
+    "AJT64",
+    "AJT63",
+    "AJT62",
+    "AJT54",
+    "AJT53",
+    "AJT52",
+    "AJT43",
+    "AJT42",
+    "AJT32",
+    "AJ987",
+    "AJ986",
+    "AJ985",
+    "AJ984",
+    "AJ983",
+    "AJ982",
+    "AJ976",
+    "AJ975",
+    "AJ974",
+    "AJ973",
+    "AJ972",
+    "AJ965",
+    "AJ964",
+    "AJ963",
+    "AJ962",
+    "AJ954",
+    "AJ953",
+    "AJ952",
+    "AJ943",
+    "AJ942",
+    "AJ932",
+    "AJ876",
+    "AJ875",
+    "AJ874",
+    "AJ873",
+    "AJ872",
+    "AJ865",
+    "AJ864",
+    "AJ863",
+    "AJ862",
+    "AJ854",
+    "AJ853",
+    "AJ852",
+    "AJ843",
+    "AJ842",
+    "AJ832",
+    "AJ765",
+    "AJ764",
+    "AJ763",
+    "AJ762",
+    "AJ754",
+    "AJ753",
+    "AJ752",
+    "AJ743",
+    "AJ742",
+    "AJ732",
+    "AJ654",
+    "AJ653",
+    "AJ652",
+    "AJ643",
+    "AJ642",
+    "AJ632",
+    "AJ543",
+    "AJ542",
+    "AJ532",
+    "AJ432",
+    "AT987",
+    "AT986",
+    "AT985",
+    "AT984",
+    "AT983",
+    "AT982",
+    "AT976",
+    "AT975",
+    "AT974",
+    "AT973",
+    "AT972",
+    "AT965",
+    "AT964",
+    "AT963",
+    "AT962",
+    "AT954",
+    "AT953",
+    "AT952",
+    "AT943",
+    "AT942",
+    "AT932",
+    "AT876",
+    "AT875",
+    "AT874",
+    "AT873",
+    "AT872",
+    "AT865",
+    "AT864",
+    "AT863",
+    "AT862",
+    "AT854",
+    "AT853",
+    "AT852",
+    "AT843",
+    "AT842",
+    "AT832",
+    "AT765",
+    "AT764",
+    "AT763",
+    "AT762",
+    "AT754",
+    "AT753",
+    "AT752",
+    "AT743",
+    "AT742",
+    "AT732",
+    "AT654",
+    "AT653",
+    "AT652",
+    "AT643",
+    "AT642",
+    "AT632",
+    "AT543",
+    "AT542",
+    "AT532",
+    "AT432",
+    "A9876",
+    "A9875",
+    "A9874",
+    "A9873",
+    "A9872",
+    "A9865",
+    "A9864",
+    "A9863",
+    "A9862",
+    "A9854",
+    "A9853",
+    "A9852",
+    "A9843",
+    "A9842",
+    "A9832",
+    "A9765",
+    "A9764",
+    "A9763",
+    "A9762",
+    "A9754",
+    "A9753",
+    "A9752",
+    "A9743",
+    "A9742",
+    "A9732",
+    "A9654",
+    "A9653",
+    "A9652",
+    "A9643",
+    "A9642",
+    "A9632",
+    "A9543",
+    "A9542",
+    "A9532",
+    "A9432",
+    "A8765",
+    "A8764",
+    "A8763",
+    "A8762",
+    "A8754",
+    "A8753",
+    "A8752",
+    "A8743",
+    "A8742",
+    "A8732",
+    "A8654",
+    "A8653",
+    "A8652",
+    "A8643",
+    "A8642",
+    "A8632",
+    "A8543",
+    "A8542",
+    "A8532",
+    "A8432",
+    "A7654",
+    "A7653",
+    "A7652",
+    "A7643",
+    "A7642",
+    "A7632",
+    "A7543",
+    "A7542",
+    "A7532",
+    "A7432",
+    "A6543",
+    "A6542",
+    "A6532",
+    "A6432",
+    "KQJT8",
+    "KQJT7",
+    "KQJT6",
+    "KQJT5",
+    "KQJT4",
+    "KQJT3",
+    "KQJT2",
+    "KQJ98",
+    "KQJ97",
+    "KQJ96",
+    "KQJ95",
+    "KQJ94",
+    "KQJ93",
+    "KQJ92",
+    "KQJ87",
+    "KQJ86",
+    "KQJ85",
+    "KQJ84",
+    "KQJ83",
+    "KQJ82",
+    "KQJ76",
+    "KQJ75",
+    "KQJ74",
+    "KQJ73",
+    "KQJ72",
+    "KQJ65",
+    "KQJ64",
+    "KQJ63",
+    "KQJ62",
+    "KQJ54",
+    "KQJ53",
+    "KQJ52",
+    "KQJ43",
+    "KQJ42",
+    "KQJ32",
+    "KQT98",
+    "KQT97",
+    "KQT96",
+    "KQT95",
+    "KQT94",
+    "KQT93",
+    "KQT92",
+    "KQT87",
+    "KQT86",
+    "KQT85",
+    "KQT84",
+    "KQT83",
+    "KQT82",
+    "KQT76",
+    "KQT75",
+    "KQT74",
+    "KQT73",
+    "KQT72",
+    "KQT65",
+    "KQT64",
+    "KQT63",
+    "KQT62",
+    "KQT54",
+    "KQT53",
+    "KQT52",
+    "KQT43",
+    "KQT42",
+    "KQT32",
+    "KQ987",
+    "KQ986",
+    "KQ985",
+    "KQ984",
+    "KQ983",
+    "KQ982",
+    "KQ976",
+    "KQ975",
+    "KQ974",
+    "KQ973",
+    "KQ972",
+    "KQ965",
+    "KQ964",
+    "KQ963",
+    "KQ962",
+    "KQ954",
+    "KQ953",
+    "KQ952",
+    "KQ943",
+    "KQ942",
+    "KQ932",
+    "KQ876",
+    "KQ875",
+    "KQ874",
+    "KQ873",
+    "KQ872",
+    "KQ865",
+    "KQ864",
+    "KQ863",
+    "KQ862",
+    "KQ854",
+    "KQ853",
+    "KQ852",
+    "KQ843",
+    "KQ842",
+    "KQ832",
+    "KQ765",
+    "KQ764",
+    "KQ763",
+    "KQ762",
+    "KQ754",
+    "KQ753",
+    "KQ752",
+    "KQ743",
+    "KQ742",
+    "KQ732",
+    "KQ654",
+    "KQ653",
+    "KQ652",
+    "KQ643",
+    "KQ642",
+    "KQ632",
+    "KQ543",
+    "KQ542",
+    "KQ532",
+    "KQ432",
+    "KJT98",
+    "KJT97",
+    "KJT96",
+    "KJT95",
+    "KJT94",
+    "KJT93",
+    "KJT92",
+    "KJT87",
+    "KJT86",
+    "KJT85",
+    "KJT84",
+    "KJT83",
+    "KJT82",
+    "KJT76",
+    "KJT75",
+    "KJT74",
+    "KJT73",
+    "KJT72",
+    "KJT65",
+    "KJT64",
+    "KJT63",
+    "KJT62",
+    "KJT54",
+    "KJT53",
+    "KJT52",
+    "KJT43",
+    "KJT42",
+    "KJT32",
+    "KJ987",
+    "KJ986",
+    "KJ985",
+    "KJ984",
+    "KJ983",
+    "KJ982",
+    "KJ976",
+    "KJ975",
+    "KJ974",
+    "KJ973",
+    "KJ972",
+    "KJ965",
+    "KJ964",
+    "KJ963",
+    "KJ962",
+    "KJ954",
+    "KJ953",
+    "KJ952",
+    "KJ943",
+    "KJ942",
+    "KJ932",
+    "KJ876",
+    "KJ875",
+    "KJ874",
+    "KJ873",
+    "KJ872",
+    "KJ865",
+    "KJ864",
+    "KJ863",
+    "KJ862",
+    "KJ854",
+    "KJ853",
+    "KJ852",
+    "KJ843",
+    "KJ842",
+    "KJ832",
+    "KJ765",
+    "KJ764",
+    "KJ763",
+    "KJ762",
+    "KJ754",
+    "KJ753",
+    "KJ752",
+    "KJ743",
+    "KJ742",
+    "KJ732",
+    "KJ654",
+    "KJ653",
+    "KJ652",
+    "KJ643",
+    "KJ642",
+    "KJ632",
+    "KJ543",
+    "KJ542",
+    "KJ532",
+    "KJ432",
+    "KT987",
+    "KT986",
+    "KT985",
+    "KT984",
+    "KT983",
+    "KT982",
+    "KT976",
+    "KT975",
+    "KT974",
+    "KT973",
+    "KT972",
+    "KT965",
+    "KT964",
+    "KT963",
+    "KT962",
+    "KT954",
+    "KT953",
+    "KT952",
+    "KT943",
+    "KT942",
+    "KT932",
+    "KT876",
+    "KT875",
+    "KT874",
+    "KT873",
+    "KT872",
+    "KT865",
+    "KT864",
+    "KT863",
+    "KT862",
+    "KT854",
+    "KT853",
+    "KT852",
+    "KT843",
+    "KT842",
+    "KT832",
+    "KT765",
+    "KT764",
+    "KT763",
+    "KT762",
+    "KT754",
+    "KT753",
+    "KT752",
+    "KT743",
+    "KT742",
+    "KT732",
+    "KT654",
+    "KT653",
+    "KT652",
+    "KT643",
+    "KT642",
+    "KT632",
+    "KT543",
+    "KT542",
+    "KT532",
+    "KT432",
+    "K9876",
+    "K9875",
+    "K9874",
+    "K9873",
+    "K9872",
+    "K9865",
+    "K9864",
+    "K9863",
+    "K9862",
+    "K9854",
+    "K9853",
+    "K9852",
+    "K9843",
+    "K9842",
+    "K9832",
+    "K9765",
+    "K9764",
+    "K9763",
+    "K9762",
+    "K9754",
+    "K9753",
+    "K9752",
+    "K9743",
+    "K9742",
+    "K9732",
+    "K9654",
+    "K9653",
+    "K9652",
+    "K9643",
+    "K9642",
+    "K9632",
+    "K9543",
+    "K9542",
+    "K9532",
+    "K9432",
+    "K8765",
+    "K8764",
+    "K8763",
+    "K8762",
+    "K8754",
+    "K8753",
+    "K8752",
+    "K8743",
+    "K8742",
+    "K8732",
+    "K8654",
+    "K8653",
+    "K8652",
+    "K8643",
+    "K8642",
+    "K8632",
+    "K8543",
+    "K8542",
+    "K8532",
+    "K8432",
+    "K7654",
+    "K7653",
+    "K7652",
+    "K7643",
+    "K7642",
+    "K7632",
+    "K7543",
+    "K7542",
+    "K7532",
+    "K7432",
+    "K6543",
+    "K6542",
+    "K6532",
+    "K6432",
+    "K5432",
+    "QJT97",
+    "QJT96",
+    "QJT95",
+    "QJT94",
+    "QJT93",
+    "QJT92",
+    "QJT87",
+    "QJT86",
+    "QJT85",
+    "QJT84",
+    "QJT83",
+    "QJT82",
+    "QJT76",
+    "QJT75",
+    "QJT74",
+    "QJT73",
+    "QJT72",
+    "QJT65",
+    "QJT64",
+    "QJT63",
+    "QJT62",
+    "QJT54",
+    "QJT53",
+    "QJT52",
+    "QJT43",
+    "QJT42",
+    "QJT32",
+    "QJ987",
+    "QJ986",
+    "QJ985",
+    "QJ984",
+    "QJ983",
+    "QJ982",
+    "QJ976",
+    "QJ975",
+    "QJ974",
+    "QJ973",
+    "QJ972",
+    "QJ965",
+    "QJ964",
+    "QJ963",
+    "QJ962",
+    "QJ954",
+    "QJ953",
+    "QJ952",
+    "QJ943",
+    "QJ942",
+    "QJ932",
+    "QJ876",
+    "QJ875",
+    "QJ874",
+    "QJ873",
+    "QJ872",
+    "QJ865",
+    "QJ864",
+    "QJ863",
+    "QJ862",
+    "QJ854",
+    "QJ853",
+    "QJ852",
+    "QJ843",
+    "QJ842",
+    "QJ832",
+    "QJ765",
+    "QJ764",
+    "QJ763",
+    "QJ762",
+    "QJ754",
+    "QJ753",
+    "QJ752",
+    "QJ743",
+    "QJ742",
+    "QJ732",
+    "QJ654",
+    "QJ653",
+    "QJ652",
+    "QJ643",
+    "QJ642",
+    "QJ632",
+    "QJ543",
+    "QJ542",
+    "QJ532",
+    "QJ432",
+    "QT987",
+    "QT986",
+    "QT985",
+    "QT984",
+    "QT983",
+    "QT982",
+    "QT976",
+    "QT975",
+    "QT974",
+    "QT973",
+    "QT972",
+    "QT965",
+    "QT964",
+    "QT963",
+    "QT962",
+    "QT954",
+    "QT953",
+    "QT952",
+    "QT943",
+    "QT942",
+    "QT932",
+    "QT876",
+    "QT875",
+    "QT874",
+    "QT873",
+    "QT872",
+    "QT865",
+    "QT864",
+    "QT863",
+    "QT862",
+    "QT854",
+    "QT853",
+    "QT852",
+    "QT843",
+    "QT842",
+    "QT832",
+    "QT765",
+    "QT764",
+    "QT763",
+    "QT762",
+    "QT754",
+    "QT753",
+    "QT752",
+    "QT743",
+    "QT742",
+    "QT732",
+    "QT654",
+    "QT653",
+    "QT652",
+    "QT643",
+    "QT642",
+    "QT632",
+    "QT543",
+    "QT542",
+    "QT532",
+    "QT432",
+    "Q9876",
+    "Q9875",
+    "Q9874",
+    "Q9873",
+    "Q9872",
+    "Q9865",
+    "Q9864",
+    "Q9863",
+    "Q9862",
+    "Q9854",
+    "Q9853",
+    "Q9852",
+    "Q9843",
+    "Q9842",
+    "Q9832",
+    "Q9765",
+    "Q9764",
+    "Q9763",
+    "Q9762",
+    "Q9754",
+    "Q9753",
+    "Q9752",
+    "Q9743",
+    "Q9742",
+    "Q9732",
+    "Q9654",
+    "Q9653",
+    "Q9652",
+    "Q9643",
+    "Q9642",
+    "Q9632",
+    "Q9543",
+    "Q9542",
+    "Q9532",
+    "Q9432",
+    "Q8765",
+    "Q8764",
+    "Q8763",
+    "Q8762",
+    "Q8754",
+    "Q8753",
+    "Q8752",
+    "Q8743",
+    "Q8742",
+    "Q8732",
+    "Q8654",
+    "Q8653",
+    "Q8652",
+    "Q8643",
+    "Q8642",
+    "Q8632",
+    "Q8543",
+    "Q8542",
+    "Q8532",
+    "Q8432",
+    "Q7654",
+    "Q7653",
+    "Q7652",
+    "Q7643",
+    "Q7642",
+    "Q7632",
+    "Q7543",
+    "Q7542",
+    "Q7532",
+    "Q7432",
+    "Q6543",
+    "Q6542",
+    "Q6532",
+    "Q6432",
+    "Q5432",
+    "JT986",
+    "JT985",
+    "JT984",
+    "JT983",
+    "JT982",
+    "JT976",
+    "JT975",
+    "JT974",
+    "JT973",
+    "JT972",
+    "JT965",
+    "JT964",
+    "JT963",
+    "JT962",
+    "JT954",
+    "JT953",
+    "JT952",
+    "JT943",
+    "JT942",
+    "JT932",
+    "JT876",
+    "JT875",
+    "JT874",
+    "JT873",
+    "JT872",
+    "JT865",
+    "JT864",
+    "JT863",
+    "JT862",
+    "JT854",
+    "JT853",
+    "JT852",
+    "JT843",
+    "JT842",
+    "JT832",
+    "JT765",
+    "JT764",
+    "JT763",
+    "JT762",
+    "JT754",
+    "JT753",
+    "JT752",
+    "JT743",
+    "JT742",
+    "JT732",
+    "JT654",
+    "JT653",
+    "JT652",
+    "JT643",
+    "JT642",
+    "JT632",
+    "JT543",
+    "JT542",
+    "JT532",
+    "JT432",
+    "J9876",
+    "J9875",
+    "J9874",
+    "J9873",
+    "J9872",
+    "J9865",
+    "J9864",
+    "J9863",
+    "J9862",
+    "J9854",
+    "J9853",
+    "J9852",
+    "J9843",
+    "J9842",
+    "J9832",
+    "J9765",
+    "J9764",
+    "J9763",
+    "J9762",
+    "J9754",
+    "J9753",
+    "J9752",
+    "J9743",
+    "J9742",
+    "J9732",
+    "J9654",
+    "J9653",
+    "J9652",
+    "J9643",
+    "J9642",
+    "J9632",
+    "J9543",
+    "J9542",
+    "J9532",
+    "J9432",
+    "J8765",
+    "J8764",
+    "J8763",
+    "J8762",
+    "J8754",
+    "J8753",
+    "J8752",
+    "J8743",
+    "J8742",
+    "J8732",
+    "J8654",
+    "J8653",
+    "J8652",
+    "J8643",
+    "J8642",
+    "J8632",
+    "J8543",
+    "J8542",
+    "J8532",
+    "J8432",
+    "J7654",
+    "J7653",
+    "J7652",
+    "J7643",
+    "J7642",
+    "J7632",
+    "J7543",
+    "J7542",
+    "J7532",
+    "J7432",
+    "J6543",
+    "J6542",
+    "J6532",
+    "J6432",
+    "J5432",
+    "T9875",
+    "T9874",
+    "T9873",
+    "T9872",
+    "T9865",
+    "T9864",
+    "T9863",
+    "T9862",
+    "T9854",
+    "T9853",
+    "T9852",
+    "T9843",
+    "T9842",
+    "T9832",
+    "T9765",
+    "T9764",
+    "T9763",
+    "T9762",
+    "T9754",
+    "T9753",
+    "T9752",
+    "T9743",
+    "T9742",
+    "T9732",
+    "T9654",
+    "T9653",
+    "T9652",
+    "T9643",
+    "T9642",
+    "T9632",
+    "T9543",
+    "T9542",
+    "T9532",
+    "T9432",
+    "T8765",
+    "T8764",
+    "T8763",
+    "T8762",
+    "T8754",
+    "T8753",
+    "T8752",
+    "T8743",
+    "T8742",
+    "T8732",
+    "T8654",
+    "T8653",
+    "T8652",
+    "T8643",
+    "T8642",
+    "T8632",
+    "T8543",
+    "T8542",
+    "T8532",
+    "T8432",
+    "T7654",
+    "T7653",
+    "T7652",
+    "T7643",
+    "T7642",
+    "T7632",
+    "T7543",
+    "T7542",
+    "T7532",
+    "T7432",
+    "T6543",
+    "T6542",
+    "T6532",
+    "T6432",
+    "T5432",
+    "98764",
+    "98763",
+    "98762",
+    "98754",
+    "98753",
+    "98752",
+    "98743",
+    "98742",
+    "98732",
+    "98654",
+    "98653",
+    "98652",
+    "98643",
+    "98642",
+    "98632",
+    "98543",
+    "98542",
+    "98532",
+    "98432",
+    "97654",
+    "97653",
+    "97652",
+    "97643",
+    "97642",
+    "97632",
+    "97543",
+    "97542",
+    "97532",
+    "97432",
+    "96543",
+    "96542",
+    "96532",
+    "96432",
+    "95432",
+    "87653",
+    "87652",
+    "87643",
+    "87642",
+    "87632",
+    "87543",
+    "87542",
+    "87532",
+    "87432",
+    "86543",
+    "86542",
+    "86532",
+    "86432",
+    "85432",
+    "76542",
+    "76532",
+    "76432",
+    "75432",
+    "AKQJT",
+    "KQJT9",
+    "QJT98",
+    "JT987",
+    "T9876",
+    "98765",
+    "87654",
+    "76543",
+    "65432",
+    "5432A",
+    "AAAKQ",
+    "AAAKJ",
+    "AAAKT",
+    "AAAK9",
+    "AAAK8",
+    "AAAK7",
+    "AAAK6",
+    "AAAK5",
+    "AAAK4",
+    "AAAK3",
+    "AAAK2",
+    "AAAQJ",
+    "AAAQT",
+    "AAAQ9",
+    "AAAQ8",
+    "AAAQ7",
+    "AAAQ6",
+    "AAAQ5",
+    "AAAQ4",
+    "AAAQ3",
+    "AAAQ2",
+    "AAAJT",
+    "AAAJ9",
+    "AAAJ8",
+    "AAAJ7",
+    "AAAJ6",
+    "AAAJ5",
+    "AAAJ4",
+    "AAAJ3",
+    "AAAJ2",
+    "AAAT9",
+    "AAAT8",
+    "AAAT7",
+    "AAAT6",
+    "AAAT5",
+    "AAAT4",
+    "AAAT3",
+    "AAAT2",
+    "AAA98",
+    "AAA97",
+    "AAA96",
+    "AAA95",
+    "AAA94",
+    "AAA93",
+    "AAA92",
+    "AAA87",
+    "AAA86",
+    "AAA85",
+    "AAA84",
+    "AAA83",
+    "AAA82",
+    "AAA76",
+    "AAA75",
+    "AAA74",
+    "AAA73",
+    "AAA72",
+    "AAA65",
+    "AAA64",
+    "AAA63",
+    "AAA62",
+    "AAA54",
+    "AAA53",
+    "AAA52",
+    "AAA43",
+    "AAA42",
+    "AAA32",
+    "KKKAQ",
+    "KKKAJ",
+    "KKKAT",
+    "KKKA9",
+    "KKKA8",
+    "KKKA7",
+    "KKKA6",
+    "KKKA5",
+    "KKKA4",
+    "KKKA3",
+    "KKKA2",
+    "KKKQJ",
+    "KKKQT",
+    "KKKQ9",
+    "KKKQ8",
+    "KKKQ7",
+    "KKKQ6",
+    "KKKQ5",
+    "KKKQ4",
+    "KKKQ3",
+    "KKKQ2",
+    "KKKJT",
+    "KKKJ9",
+    "KKKJ8",
+    "KKKJ7",
+    "KKKJ6",
+    "KKKJ5",
+    "KKKJ4",
+    "KKKJ3",
+    "KKKJ2",
+    "KKKT9",
+    "KKKT8",
+    "KKKT7",
+    "KKKT6",
+    "KKKT5",
+    "KKKT4",
+    "KKKT3",
+    "KKKT2",
+    "KKK98",
+    "KKK97",
+    "KKK96",
+    "KKK95",
+    "KKK94",
+    "KKK93",
+    "KKK92",
+    "KKK87",
+    "KKK86",
+    "KKK85",
+    "KKK84",
+    "KKK83",
+    "KKK82",
+    "KKK76",
+    "KKK75",
+    "KKK74",
+    "KKK73",
+    "KKK72",
+    "KKK65",
+    "KKK64",
+    "KKK63",
+    "KKK62",
+    "KKK54",
+    "KKK53",
+    "KKK52",
+    "KKK43",
+    "KKK42",
+    "KKK32",
+    "QQQAK",
+    "QQQAJ",
+    "QQQAT",
+    "QQQA9",
+    "QQQA8",
+    "QQQA7",
+    "QQQA6",
+    "QQQA5",
+    "QQQA4",
+    "QQQA3",
+    "QQQA2",
+    "QQQKJ",
+    "QQQKT",
+    "QQQK9",
+    "QQQK8",
+    "QQQK7",
+    "QQQK6",
+    "QQQK5",
+    "QQQK4",
+    "QQQK3",
+    "QQQK2",
+    "QQQJT",
+    "QQQJ9",
+    "QQQJ8",
+    "QQQJ7",
+    "QQQJ6",
+    "QQQJ5",
+    "QQQJ4",
+    "QQQJ3",
+    "QQQJ2",
+    "QQQT9",
+    "QQQT8",
+    "QQQT7",
+    "QQQT6",
+    "QQQT5",
+    "QQQT4",
+    "QQQT3",
+    "QQQT2",
+    "QQQ98",
+    "QQQ97",
+    "QQQ96",
+    "QQQ95",
+    "QQQ94",
+    "QQQ93",
+    "QQQ92",
+    "QQQ87",
+    "QQQ86",
+    "QQQ85",
+    "QQQ84",
+    "QQQ83",
+    "QQQ82",
+    "QQQ76",
+    "QQQ75",
+    "QQQ74",
+    "QQQ73",
+    "QQQ72",
+    "QQQ65",
+    "QQQ64",
+    "QQQ63",
+    "QQQ62",
+    "QQQ54",
+    "QQQ53",
+    "QQQ52",
+    "QQQ43",
+    "QQQ42",
+    "QQQ32",
+    "JJJAK",
+    "JJJAQ",
+    "JJJAT",
+    "JJJA9",
+    "JJJA8",
+    "JJJA7",
+    "JJJA6",
+    "JJJA5",
+    "JJJA4",
+    "JJJA3",
+    "JJJA2",
+    "JJJKQ",
+    "JJJKT",
+    "JJJK9",
+    "JJJK8",
+    "JJJK7",
+    "JJJK6",
+    "JJJK5",
+    "JJJK4",
+    "JJJK3",
+    "JJJK2",
+    "JJJQT",
+    "JJJQ9",
+    "JJJQ8",
+    "JJJQ7",
+    "JJJQ6",
+    "JJJQ5",
+    "JJJQ4",
+    "JJJQ3",
+    "JJJQ2",
+    "JJJT9",
+    "JJJT8",
+    "JJJT7",
+    "JJJT6",
+    "JJJT5",
+    "JJJT4",
+    "JJJT3",
+    "JJJT2",
+    "JJJ98",
+    "JJJ97",
+    "JJJ96",
+    "JJJ95",
+    "JJJ94",
+    "JJJ93",
+    "JJJ92",
+    "JJJ87",
+    "JJJ86",
+    "JJJ85",
+    "JJJ84",
+    "JJJ83",
+    "JJJ82",
+    "JJJ76",
+    "JJJ75",
+    "JJJ74",
+    "JJJ73",
+    "JJJ72",
+    "JJJ65",
+    "JJJ64",
+    "JJJ63",
+    "JJJ62",
+    "JJJ54",
+    "JJJ53",
+    "JJJ52",
+    "JJJ43",
+    "JJJ42",
+    "JJJ32",
+    "TTTAK",
+    "TTTAQ",
+    "TTTAJ",
+    "TTTA9",
+    "TTTA8",
+    "TTTA7",
+    "TTTA6",
+    "TTTA5",
+    "TTTA4",
+    "TTTA3",
+    "TTTA2",
+    "TTTKQ",
+    "TTTKJ",
+    "TTTK9",
+    "TTTK8",
+    "TTTK7",
+    "TTTK6",
+    "TTTK5",
+    "TTTK4",
+    "TTTK3",
+    "TTTK2",
+    "TTTQJ",
+    "TTTQ9",
+    "TTTQ8",
+    "TTTQ7",
+    "TTTQ6",
+    "TTTQ5",
+    "TTTQ4",
+    "TTTQ3",
+    "TTTQ2",
+    "TTTJ9",
+    "TTTJ8",
+    "TTTJ7",
+    "TTTJ6",
+    "TTTJ5",
+    "TTTJ4",
+    "TTTJ3",
+    "TTTJ2",
+    "TTT98",
+    "TTT97",
+    "TTT96",
+    "TTT95",
+    "TTT94",
+    "TTT93",
+    "TTT92",
+    "TTT87",
+    "TTT86",
+    "TTT85",
+    "TTT84",
+    "TTT83",
+    "TTT82",
+    "TTT76",
+    "TTT75",
+    "TTT74",
+    "TTT73",
+    "TTT72",
+    "TTT65",
+    "TTT64",
+    "TTT63",
+    "TTT62",
+    "TTT54",
+    "TTT53",
+    "TTT52",
+    "TTT43",
+    "TTT42",
+    "TTT32",
+    "999AK",
+    "999AQ",
+    "999AJ",
+    "999AT",
+    "999A8",
+    "999A7",
+    "999A6",
+    "999A5",
+    "999A4",
+    "999A3",
+    "999A2",
+    "999KQ",
+    "999KJ",
+    "999KT",
+    "999K8",
+    "999K7",
+    "999K6",
+    "999K5",
+    "999K4",
+    "999K3",
+    "999K2",
+    "999QJ",
+    "999QT",
+    "999Q8",
+    "999Q7",
+    "999Q6",
+    "999Q5",
+    "999Q4",
+    "999Q3",
+    "999Q2",
+    "999JT",
+    "999J8",
+    "999J7",
+    "999J6",
+    "999J5",
+    "999J4",
+    "999J3",
+    "999J2",
+    "999T8",
+    "999T7",
+    "999T6",
+    "999T5",
+    "999T4",
+    "999T3",
+    "999T2",
+    "99987",
+    "99986",
+    "99985",
+    "99984",
+    "99983",
+    "99982",
+    "99976",
+    "99975",
+    "99974",
+    "99973",
+    "99972",
+    "99965",
+    "99964",
+    "99963",
+    "99962",
+    "99954",
+    "99953",
+    "99952",
+    "99943",
+    "99942",
+    "99932",
+    "888AK",
+    "888AQ",
+    "888AJ",
+    "888AT",
+    "888A9",
+    "888A7",
+    "888A6",
+    "888A5",
+    "888A4",
+    "888A3",
+    "888A2",
+    "888KQ",
+    "888KJ",
+    "888KT",
+    "888K9",
+    "888K7",
+    "888K6",
+    "888K5",
+    "888K4",
+    "888K3",
+    "888K2",
+    "888QJ",
+    "888QT",
+    "888Q9",
+    "888Q7",
+    "888Q6",
+    "888Q5",
+    "888Q4",
+    "888Q3",
+    "888Q2",
+    "888JT",
+    "888J9",
+    "888J7",
+    "888J6",
+    "888J5",
+    "888J4",
+    "888J3",
+    "888J2",
+    "888T9",
+    "888T7",
+    "888T6",
+    "888T5",
+    "888T4",
+    "888T3",
+    "888T2",
+    "88897",
+    "88896",
+    "88895",
+    "88894",
+    "88893",
+    "88892",
+    "88876",
+    "88875",
+    "88874",
+    "88873",
+    "88872",
+    "88865",
+    "88864",
+    "88863",
+    "88862",
+    "88854",
+    "88853",
+    "88852",
+    "88843",
+    "88842",
+    "88832",
+    "777AK",
+    "777AQ",
+    "777AJ",
+    "777AT",
+    "777A9",
+    "777A8",
+    "777A6",
+    "777A5",
+    "777A4",
+    "777A3",
+    "777A2",
+    "777KQ",
+    "777KJ",
+    "777KT",
+    "777K9",
+    "777K8",
+    "777K6",
+    "777K5",
+    "777K4",
+    "777K3",
+    "777K2",
+    "777QJ",
+    "777QT",
+    "777Q9",
+    "777Q8",
+    "777Q6",
+    "777Q5",
+    "777Q4",
+    "777Q3",
+    "777Q2",
+    "777JT",
+    "777J9",
+    "777J8",
+    "777J6",
+    "777J5",
+    "777J4",
+    "777J3",
+    "777J2",
+    "777T9",
+    "777T8",
+    "777T6",
+    "777T5",
+    "777T4",
+    "777T3",
+    "777T2",
+    "77798",
+    "77796",
+    "77795",
+    "77794",
+    "77793",
+    "77792",
+    "77786",
+    "77785",
+    "77784",
+    "77783",
+    "77782",
+    "77765",
+    "77764",
+    "77763",
+    "77762",
+    "77754",
+    "77753",
+    "77752",
+    "77743",
+    "77742",
+    "77732",
+    "666AK",
+    "666AQ",
+    "666AJ",
+    "666AT",
+    "666A9",
+    "666A8",
+    "666A7",
+    "666A5",
+    "666A4",
+    "666A3",
+    "666A2",
+    "666KQ",
+    "666KJ",
+    "666KT",
+    "666K9",
+    "666K8",
+    "666K7",
+    "666K5",
+    "666K4",
+    "666K3",
+    "666K2",
+    "666QJ",
+    "666QT",
+    "666Q9",
+    "666Q8",
+    "666Q7",
+    "666Q5",
+    "666Q4",
+    "666Q3",
+    "666Q2",
+    "666JT",
+    "666J9",
+    "666J8",
+    "666J7",
+    "666J5",
+    "666J4",
+    "666J3",
+    "666J2",
+    "666T9",
+    "666T8",
+    "666T7",
+    "666T5",
+    "666T4",
+    "666T3",
+    "666T2",
+    "66698",
+    "66697",
+    "66695",
+    "66694",
+    "66693",
+    "66692",
+    "66687",
+    "66685",
+    "66684",
+    "66683",
+    "66682",
+    "66675",
+    "66674",
+    "66673",
+    "66672",
+    "66654",
+    "66653",
+    "66652",
+    "66643",
+    "66642",
+    "66632",
+    "555AK",
+    "555AQ",
+    "555AJ",
+    "555AT",
+    "555A9",
+    "555A8",
+    "555A7",
+    "555A6",
+    "555A4",
+    "555A3",
+    "555A2",
+    "555KQ",
+    "555KJ",
+    "555KT",
+    "555K9",
+    "555K8",
+    "555K7",
+    "555K6",
+    "555K4",
+    "555K3",
+    "555K2",
+    "555QJ",
+    "555QT",
+    "555Q9",
+    "555Q8",
+    "555Q7",
+    "555Q6",
+    "555Q4",
+    "555Q3",
+    "555Q2",
+    "555JT",
+    "555J9",
+    "555J8",
+    "555J7",
+    "555J6",
+    "555J4",
+    "555J3",
+    "555J2",
+    "555T9",
+    "555T8",
+    "555T7",
+    "555T6",
+    "555T4",
+    "555T3",
+    "555T2",
+    "55598",
+    "55597",
+    "55596",
+    "55594",
+    "55593",
+    "55592",
+    "55587",
+    "55586",
+    "55584",
+    "55583",
+    "55582",
+    "55576",
+    "55574",
+    "55573",
+    "55572",
+    "55564",
+    "55563",
+    "55562",
+    "55543",
+    "55542",
+    "55532",
+    "444AK",
+    "444AQ",
+    "444AJ",
+    "444AT",
+    "444A9",
+    "444A8",
+    "444A7",
+    "444A6",
+    "444A5",
+    "444A3",
+    "444A2",
+    "444KQ",
+    "444KJ",
+    "444KT",
+    "444K9",
+    "444K8",
+    "444K7",
+    "444K6",
+    "444K5",
+    "444K3",
+    "444K2",
+    "444QJ",
+    "444QT",
+    "444Q9",
+    "444Q8",
+    "444Q7",
+    "444Q6",
+    "444Q5",
+    "444Q3",
+    "444Q2",
+    "444JT",
+    "444J9",
+    "444J8",
+    "444J7",
+    "444J6",
+    "444J5",
+    "444J3",
+    "444J2",
+    "444T9",
+    "444T8",
+    "444T7",
+    "444T6",
+    "444T5",
+    "444T3",
+    "444T2",
+    "44498",
+    "44497",
+    "44496",
+    "44495",
+    "44493",
+    "44492",
+    "44487",
+    "44486",
+    "44485",
+    "44483",
+    "44482",
+    "44476",
+    "44475",
+    "44473",
+    "44472",
+    "44465",
+    "44463",
+    "44462",
+    "44453",
+    "44452",
+    "44432",
+    "333AK",
+    "333AQ",
+    "333AJ",
+    "333AT",
+    "333A9",
+    "333A8",
+    "333A7",
+    "333A6",
+    "333A5",
+    "333A4",
+    "333A2",
+    "333KQ",
+    "333KJ",
+    "333KT",
+    "333K9",
+    "333K8",
+    "333K7",
+    "333K6",
+    "333K5",
+    "333K4",
+    "333K2",
+    "333QJ",
+    "333QT",
+    "333Q9",
+    "333Q8",
+    "333Q7",
+    "333Q6",
+    "333Q5",
+    "333Q4",
+    "333Q2",
+    "333JT",
+    "333J9",
+    "333J8",
+    "333J7",
+    "333J6",
+    "333J5",
+    "333J4",
+    "333J2",
+    "333T9",
+    "333T8",
+    "333T7",
+    "333T6",
+    "333T5",
+    "333T4",
+    "333T2",
+    "33398",
+    "33397",
+    "33396",
+    "33395",
+    "33394",
+    "33392",
+    "33387",
+    "33386",
+    "33385",
+    "33384",
+    "33382",
+    "33376",
+    "33375",
+    "33374",
+    "33372",
+    "33365",
+    "33364",
+    "33362",
+    "33354",
+    "33352",
+    "33342",
+    "222AK",
+    "222AQ",
+    "222AJ",
+    "222AT",
+    "222A9",
+    "222A8",
+    "222A7",
+    "222A6",
+    "222A5",
+    "222A4",
+    "222A3",
+    "222KQ",
+    "222KJ",
+    "222KT",
+    "222K9",
+    "222K8",
+    "222K7",
+    "222K6",
+    "222K5",
+    "222K4",
+    "222K3",
+    "222QJ",
+    "222QT",
+    "222Q9",
+    "222Q8",
+    "222Q7",
+    "222Q6",
+    "222Q5",
+    "222Q4",
+    "222Q3",
+    "222JT",
+    "222J9",
+    "222J8",
+    "222J7",
+    "222J6",
+    "222J5",
+    "222J4",
+    "222J3",
+    "222T9",
+    "222T8",
+    "222T7",
+    "222T6",
+    "222T5",
+    "222T4",
+    "222T3",
+    "22298",
+    "22297",
+    "22296",
+    "22295",
+    "22294",
+    "22293",
+    "22287",
+    "22286",
+    "22285",
+    "22284",
+    "22283",
+    "22276",
+    "22275",
+    "22274",
+    "22273",
+    "22265",
+    "22264",
+    "22263",
+    "22254",
+    "22253",
+    "22243",
+    "AAKKQ",
+    "AAKKJ",
+    "AAKKT",
+    "AAKK9",
+    "AAKK8",
+    "AAKK7",
+    "AAKK6",
+    "AAKK5",
+    "AAKK4",
+    "AAKK3",
+    "AAKK2",
+    "AAQQK",
+    "AAQQJ",
+    "AAQQT",
+    "AAQQ9",
+    "AAQQ8",
+    "AAQQ7",
+    "AAQQ6",
+    "AAQQ5",
+    "AAQQ4",
+    "AAQQ3",
+    "AAQQ2",
+    "AAJJK",
+    "AAJJQ",
+    "AAJJT",
+    "AAJJ9",
+    "AAJJ8",
+    "AAJJ7",
+    "AAJJ6",
+    "AAJJ5",
+    "AAJJ4",
+    "AAJJ3",
+    "AAJJ2",
+    "AATTK",
+    "AATTQ",
+    "AATTJ",
+    "AATT9",
+    "AATT8",
+    "AATT7",
+    "AATT6",
+    "AATT5",
+    "AATT4",
+    "AATT3",
+    "AATT2",
+    "AA99K",
+    "AA99Q",
+    "AA99J",
+    "AA99T",
+    "AA998",
+    "AA997",
+    "AA996",
+    "AA995",
+    "AA994",
+    "AA993",
+    "AA992",
+    "AA88K",
+    "AA88Q",
+    "AA88J",
+    "AA88T",
+    "AA889",
+    "AA887",
+    "AA886",
+    "AA885",
+    "AA884",
+    "AA883",
+    "AA882",
+    "AA77K",
+    "AA77Q",
+    "AA77J",
+    "AA77T",
+    "AA779",
+    "AA778",
+    "AA776",
+    "AA775",
+    "AA774",
+    "AA773",
+    "AA772",
+    "AA66K",
+    "AA66Q",
+    "AA66J",
+    "AA66T",
+    "AA669",
+    "AA668",
+    "AA667",
+    "AA665",
+    "AA664",
+    "AA663",
+    "AA662",
+    "AA55K",
+    "AA55Q",
+    "AA55J",
+    "AA55T",
+    "AA559",
+    "AA558",
+    "AA557",
+    "AA556",
+    "AA554",
+    "AA553",
+    "AA552",
+    "AA44K",
+    "AA44Q",
+    "AA44J",
+    "AA44T",
+    "AA449",
+    "AA448",
+    "AA447",
+    "AA446",
+    "AA445",
+    "AA443",
+    "AA442",
+    "AA33K",
+    "AA33Q",
+    "AA33J",
+    "AA33T",
+    "AA339",
+    "AA338",
+    "AA337",
+    "AA336",
+    "AA335",
+    "AA334",
+    "AA332",
+    "AA22K",
+    "AA22Q",
+    "AA22J",
+    "AA22T",
+    "AA229",
+    "AA228",
+    "AA227",
+    "AA226",
+    "AA225",
+    "AA224",
+    "AA223",
+    "KKQQA",
+    "KKQQJ",
+    "KKQQT",
+    "KKQQ9",
+    "KKQQ8",
+    "KKQQ7",
+    "KKQQ6",
+    "KKQQ5",
+    "KKQQ4",
+    "KKQQ3",
+    "KKQQ2",
+    "KKJJA",
+    "KKJJQ",
+    "KKJJT",
+    "KKJJ9",
+    "KKJJ8",
+    "KKJJ7",
+    "KKJJ6",
+    "KKJJ5",
+    "KKJJ4",
+    "KKJJ3",
+    "KKJJ2",
+    "KKTTA",
+    "KKTTQ",
+    "KKTTJ",
+    "KKTT9",
+    "KKTT8",
+    "KKTT7",
+    "KKTT6",
+    "KKTT5",
+    "KKTT4",
+    "KKTT3",
+    "KKTT2",
+    "KK99A",
+    "KK99Q",
+    "KK99J",
+    "KK99T",
+    "KK998",
+    "KK997",
+    "KK996",
+    "KK995",
+    "KK994",
+    "KK993",
+    "KK992",
+    "KK88A",
+    "KK88Q",
+    "KK88J",
+    "KK88T",
+    "KK889",
+    "KK887",
+    "KK886",
+    "KK885",
+    "KK884",
+    "KK883",
+    "KK882",
+    "KK77A",
+    "KK77Q",
+    "KK77J",
+    "KK77T",
+    "KK779",
+    "KK778",
+    "KK776",
+    "KK775",
+    "KK774",
+    "KK773",
+    "KK772",
+    "KK66A",
+    "KK66Q",
+    "KK66J",
+    "KK66T",
+    "KK669",
+    "KK668",
+    "KK667",
+    "KK665",
+    "KK664",
+    "KK663",
+    "KK662",
+    "KK55A",
+    "KK55Q",
+    "KK55J",
+    "KK55T",
+    "KK559",
+    "KK558",
+    "KK557",
+    "KK556",
+    "KK554",
+    "KK553",
+    "KK552",
+    "KK44A",
+    "KK44Q",
+    "KK44J",
+    "KK44T",
+    "KK449",
+    "KK448",
+    "KK447",
+    "KK446",
+    "KK445",
+    "KK443",
+    "KK442",
+    "KK33A",
+    "KK33Q",
+    "KK33J",
+    "KK33T",
+    "KK339",
+    "KK338",
+    "KK337",
+    "KK336",
+    "KK335",
+    "KK334",
+    "KK332",
+    "KK22A",
+    "KK22Q",
+    "KK22J",
+    "KK22T",
+    "KK229",
+    "KK228",
+    "KK227",
+    "KK226",
+    "KK225",
+    "KK224",
+    "KK223",
+    "QQJJA",
+    "QQJJK",
+    "QQJJT",
+    "QQJJ9",
+    "QQJJ8",
+    "QQJJ7",
+    "QQJJ6",
+    "QQJJ5",
+    "QQJJ4",
+    "QQJJ3",
+    "QQJJ2",
+    "QQTTA",
+    "QQTTK",
+    "QQTTJ",
+    "QQTT9",
+    "QQTT8",
+    "QQTT7",
+    "QQTT6",
+    "QQTT5",
+    "QQTT4",
+    "QQTT3",
+    "QQTT2",
+    "QQ99A",
+    "QQ99K",
+    "QQ99J",
+    "QQ99T",
+    "QQ998",
+    "QQ997",
+    "QQ996",
+    "QQ995",
+    "QQ994",
+    "QQ993",
+    "QQ992",
+    "QQ88A",
+    "QQ88K",
+    "QQ88J",
+    "QQ88T",
+    "QQ889",
+    "QQ887",
+    "QQ886",
+    "QQ885",
+    "QQ884",
+    "QQ883",
+    "QQ882",
+    "QQ77A",
+    "QQ77K",
+    "QQ77J",
+    "QQ77T",
+    "QQ779",
+    "QQ778",
+    "QQ776",
+    "QQ775",
+    "QQ774",
+    "QQ773",
+    "QQ772",
+    "QQ66A",
+    "QQ66K",
+    "QQ66J",
+    "QQ66T",
+    "QQ669",
+    "QQ668",
+    "QQ667",
+    "QQ665",
+    "QQ664",
+    "QQ663",
+    "QQ662",
+    "QQ55A",
+    "QQ55K",
+    "QQ55J",
+    "QQ55T",
+    "QQ559",
+    "QQ558",
+    "QQ557",
+    "QQ556",
+    "QQ554",
+    "QQ553",
+    "QQ552",
+    "QQ44A",
+    "QQ44K",
+    "QQ44J",
+    "QQ44T",
+    "QQ449",
+    "QQ448",
+    "QQ447",
+    "QQ446",
+    "QQ445",
+    "QQ443",
+    "QQ442",
+    "QQ33A",
+    "QQ33K",
+    "QQ33J",
+    "QQ33T",
+    "QQ339",
+    "QQ338",
+    "QQ337",
+    "QQ336",
+    "QQ335",
+    "QQ334",
+    "QQ332",
+    "QQ22A",
+    "QQ22K",
+    "QQ22J",
+    "QQ22T",
+    "QQ229",
+    "QQ228",
+    "QQ227",
+    "QQ226",
+    "QQ225",
+    "QQ224",
+    "QQ223",
+    "JJTTA",
+    "JJTTK",
+    "JJTTQ",
+    "JJTT9",
+    "JJTT8",
+    "JJTT7",
+    "JJTT6",
+    "JJTT5",
+    "JJTT4",
+    "JJTT3",
+    "JJTT2",
+    "JJ99A",
+    "JJ99K",
+    "JJ99Q",
+    "JJ99T",
+    "JJ998",
+    "JJ997",
+    "JJ996",
+    "JJ995",
+    "JJ994",
+    "JJ993",
+    "JJ992",
+    "JJ88A",
+    "JJ88K",
+    "JJ88Q",
+    "JJ88T",
+    "JJ889",
+    "JJ887",
+    "JJ886",
+    "JJ885",
+    "JJ884",
+    "JJ883",
+    "JJ882",
+    "JJ77A",
+    "JJ77K",
+    "JJ77Q",
+    "JJ77T",
+    "JJ779",
+    "JJ778",
+    "JJ776",
+    "JJ775",
+    "JJ774",
+    "JJ773",
+    "JJ772",
+    "JJ66A",
+    "JJ66K",
+    "JJ66Q",
+    "JJ66T",
+    "JJ669",
+    "JJ668",
+    "JJ667",
+    "JJ665",
+    "JJ664",
+    "JJ663",
+    "JJ662",
+    "JJ55A",
+    "JJ55K",
+    "JJ55Q",
+    "JJ55T",
+    "JJ559",
+    "JJ558",
+    "JJ557",
+    "JJ556",
+    "JJ554",
+    "JJ553",
+    "JJ552",
+    "JJ44A",
+    "JJ44K",
+    "JJ44Q",
+    "JJ44T",
+    "JJ449",
+    "JJ448",
+    "JJ447",
+    "JJ446",
+    "JJ445",
+    "JJ443",
+    "JJ442",
+    "JJ33A",
+    "JJ33K",
+    "JJ33Q",
+    "JJ33T",
+    "JJ339",
+    "JJ338",
+    "JJ337",
+    "JJ336",
+    "JJ335",
+    "JJ334",
+    "JJ332",
+    "JJ22A",
+    "JJ22K",
+    "JJ22Q",
+    "JJ22T",
+    "JJ229",
+    "JJ228",
+    "JJ227",
+    "JJ226",
+    "JJ225",
+    "JJ224",
+    "JJ223",
+    "TT99A",
+    "TT99K",
+    "TT99Q",
+    "TT99J",
+    "TT998",
+    "TT997",
+    "TT996",
+    "TT995",
+    "TT994",
+    "TT993",
+    "TT992",
+    "TT88A",
+    "TT88K",
+    "TT88Q",
+    "TT88J",
+    "TT889",
+    "TT887",
+    "TT886",
+    "TT885",
+    "TT884",
+    "TT883",
+    "TT882",
+    "TT77A",
+    "TT77K",
+    "TT77Q",
+    "TT77J",
+    "TT779",
+    "TT778",
+    "TT776",
+    "TT775",
+    "TT774",
+    "TT773",
+    "TT772",
+    "TT66A",
+    "TT66K",
+    "TT66Q",
+    "TT66J",
+    "TT669",
+    "TT668",
+    "TT667",
+    "TT665",
+    "TT664",
+    "TT663",
+    "TT662",
+    "TT55A",
+    "TT55K",
+    "TT55Q",
+    "TT55J",
+    "TT559",
+    "TT558",
+    "TT557",
+    "TT556",
+    "TT554",
+    "TT553",
+    "TT552",
+    "TT44A",
+    "TT44K",
+    "TT44Q",
+    "TT44J",
+    "TT449",
+    "TT448",
+    "TT447",
+    "TT446",
+    "TT445",
+    "TT443",
+    "TT442",
+    "TT33A",
+    "TT33K",
+    "TT33Q",
+    "TT33J",
+    "TT339",
+    "TT338",
+    "TT337",
+    "TT336",
+    "TT335",
+    "TT334",
+    "TT332",
+    "TT22A",
+    "TT22K",
+    "TT22Q",
+    "TT22J",
+    "TT229",
+    "TT228",
+    "TT227",
+    "TT226",
+    "TT225",
+    "TT224",
+    "TT223",
+    "9988A",
+    "9988K",
+    "9988Q",
+    "9988J",
+    "9988T",
+    "99887",
+    "99886",
+    "99885",
+    "99884",
+    "99883",
+    "99882",
+    "9977A",
+    "9977K",
+    "9977Q",
+    "9977J",
+    "9977T",
+    "99778",
+    "99776",
+    "99775",
+    "99774",
+    "99773",
+    "99772",
+    "9966A",
+    "9966K",
+    "9966Q",
+    "9966J",
+    "9966T",
+    "99668",
+    "99667",
+    "99665",
+    "99664",
+    "99663",
+    "99662",
+    "9955A",
+    "9955K",
+    "9955Q",
+    "9955J",
+    "9955T",
+    "99558",
+    "99557",
+    "99556",
+    "99554",
+    "99553",
+    "99552",
+    "9944A",
+    "9944K",
+    "9944Q",
+    "9944J",
+    "9944T",
+    "99448",
+    "99447",
+    "99446",
+    "99445",
+    "99443",
+    "99442",
+    "9933A",
+    "9933K",
+    "9933Q",
+    "9933J",
+    "9933T",
+    "99338",
+    "99337",
+    "99336",
+    "99335",
+    "99334",
+    "99332",
+    "9922A",
+    "9922K",
+    "9922Q",
+    "9922J",
+    "9922T",
+    "99228",
+    "99227",
+    "99226",
+    "99225",
+    "99224",
+    "99223",
+    "8877A",
+    "8877K",
+    "8877Q",
+    "8877J",
+    "8877T",
+    "88779",
+    "88776",
+    "88775",
+    "88774",
+    "88773",
+    "88772",
+    "8866A",
+    "8866K",
+    "8866Q",
+    "8866J",
+    "8866T",
+    "88669",
+    "88667",
+    "88665",
+    "88664",
+    "88663",
+    "88662",
+    "8855A",
+    "8855K",
+    "8855Q",
+    "8855J",
+    "8855T",
+    "88559",
+    "88557",
+    "88556",
+    "88554",
+    "88553",
+    "88552",
+    "8844A",
+    "8844K",
+    "8844Q",
+    "8844J",
+    "8844T",
+    "88449",
+    "88447",
+    "88446",
+    "88445",
+    "88443",
+    "88442",
+    "8833A",
+    "8833K",
+    "8833Q",
+    "8833J",
+    "8833T",
+    "88339",
+    "88337",
+    "88336",
+    "88335",
+    "88334",
+    "88332",
+    "8822A",
+    "8822K",
+    "8822Q",
+    "8822J",
+    "8822T",
+    "88229",
+    "88227",
+    "88226",
+    "88225",
+    "88224",
+    "88223",
+    "7766A",
+    "7766K",
+    "7766Q",
+    "7766J",
+    "7766T",
+    "77669",
+    "77668",
+    "77665",
+    "77664",
+    "77663",
+    "77662",
+    "7755A",
+    "7755K",
+    "7755Q",
+    "7755J",
+    "7755T",
+    "77559",
+    "77558",
+    "77556",
+    "77554",
+    "77553",
+    "77552",
+    "7744A",
+    "7744K",
+    "7744Q",
+    "7744J",
+    "7744T",
+    "77449",
+    "77448",
+    "77446",
+    "77445",
+    "77443",
+    "77442",
+    "7733A",
+    "7733K",
+    "7733Q",
+    "7733J",
+    "7733T",
+    "77339",
+    "77338",
+    "77336",
+    "77335",
+    "77334",
+    "77332",
+    "7722A",
+    "7722K",
+    "7722Q",
+    "7722J",
+    "7722T",
+    "77229",
+    "77228",
+    "77226",
+    "77225",
+    "77224",
+    "77223",
+    "6655A",
+    "6655K",
+    "6655Q",
+    "6655J",
+    "6655T",
+    "66559",
+    "66558",
+    "66557",
+    "66554",
+    "66553",
+    "66552",
+    "6644A",
+    "6644K",
+    "6644Q",
+    "6644J",
+    "6644T",
+    "66449",
+    "66448",
+    "66447",
+    "66445",
+    "66443",
+    "66442",
+    "6633A",
+    "6633K",
+    "6633Q",
+    "6633J",
+    "6633T",
+    "66339",
+    "66338",
+    "66337",
+    "66335",
+    "66334",
+    "66332",
+    "6622A",
+    "6622K",
+    "6622Q",
+    "6622J",
+    "6622T",
+    "66229",
+    "66228",
+    "66227",
+    "66225",
+    "66224",
+    "66223",
+    "5544A",
+    "5544K",
+    "5544Q",
+    "5544J",
+    "5544T",
+    "55449",
+    "55448",
+    "55447",
+    "55446",
+    "55443",
+    "55442",
+    "5533A",
+    "5533K",
+    "5533Q",
+    "5533J",
+    "5533T",
+    "55339",
+    "55338",
+    "55337",
+    "55336",
+    "55334",
+    "55332",
+    "5522A",
+    "5522K",
+    "5522Q",
+    "5522J",
+    "5522T",
+    "55229",
+    "55228",
+    "55227",
+    "55226",
+    "55224",
+    "55223",
+    "4433A",
+    "4433K",
+    "4433Q",
+    "4433J",
+    "4433T",
+    "44339",
+    "44338",
+    "44337",
+    "44336",
+    "44335",
+    "44332",
+    "4422A",
+    "4422K",
+    "4422Q",
+    "4422J",
+    "4422T",
+    "44229",
+    "44228",
+    "44227",
+    "44226",
+    "44225",
+    "44223",
+    "3322A",
+    "3322K",
+    "3322Q",
+    "3322J",
+    "3322T",
+    "33229",
+    "33228",
+    "33227",
+    "33226",
+    "33225",
+    "33224",
+    "AAKQJ",
+    "AAKQT",
+    "AAKQ9",
+    "AAKQ8",
+    "AAKQ7",
+    "AAKQ6",
+    "AAKQ5",
+    "AAKQ4",
+    "AAKQ3",
+    "AAKQ2",
+    "AAKJT",
+    "AAKJ9",
+    "AAKJ8",
+    "AAKJ7",
+    "AAKJ6",
+    "AAKJ5",
+    "AAKJ4",
+    "AAKJ3",
+    "AAKJ2",
+    "AAKT9",
+    "AAKT8",
+    "AAKT7",
+    "AAKT6",
+    "AAKT5",
+    "AAKT4",
+    "AAKT3",
+    "AAKT2",
+    "AAK98",
+    "AAK97",
+    "AAK96",
+    "AAK95",
+    "AAK94",
+    "AAK93",
+    "AAK92",
+    "AAK87",
+    "AAK86",
+    "AAK85",
+    "AAK84",
+    "AAK83",
+    "AAK82",
+    "AAK76",
+    "AAK75",
+    "AAK74",
+    "AAK73",
+    "AAK72",
+    "AAK65",
+    "AAK64",
+    "AAK63",
+    "AAK62",
+    "AAK54",
+    "AAK53",
+    "AAK52",
+    "AAK43",
+    "AAK42",
+    "AAK32",
+    "AAQJT",
+    "AAQJ9",
+    "AAQJ8",
+    "AAQJ7",
+    "AAQJ6",
+    "AAQJ5",
+    "AAQJ4",
+    "AAQJ3",
+    "AAQJ2",
+    "AAQT9",
+    "AAQT8",
+    "AAQT7",
+    "AAQT6",
+    "AAQT5",
+    "AAQT4",
+    "AAQT3",
+    "AAQT2",
+    "AAQ98",
+    "AAQ97",
+    "AAQ96",
+    "AAQ95",
+    "AAQ94",
+    "AAQ93",
+    "AAQ92",
+    "AAQ87",
+    "AAQ86",
+    "AAQ85",
+    "AAQ84",
+    "AAQ83",
+    "AAQ82",
+    "AAQ76",
+    "AAQ75",
+    "AAQ74",
+    "AAQ73",
+    "AAQ72",
+    "AAQ65",
+    "AAQ64",
+    "AAQ63",
+    "AAQ62",
+    "AAQ54",
+    "AAQ53",
+    "AAQ52",
+    "AAQ43",
+    "AAQ42",
+    "AAQ32",
+    "AAJT9",
+    "AAJT8",
+    "AAJT7",
+    "AAJT6",
+    "AAJT5",
+    "AAJT4",
+    "AAJT3",
+    "AAJT2",
+    "AAJ98",
+    "AAJ97",
+    "AAJ96",
+    "AAJ95",
+    "AAJ94",
+    "AAJ93",
+    "AAJ92",
+    "AAJ87",
+    "AAJ86",
+    "AAJ85",
+    "AAJ84",
+    "AAJ83",
+    "AAJ82",
+    "AAJ76",
+    "AAJ75",
+    "AAJ74",
+    "AAJ73",
+    "AAJ72",
+    "AAJ65",
+    "AAJ64",
+    "AAJ63",
+    "AAJ62",
+    "AAJ54",
+    "AAJ53",
+    "AAJ52",
+    "AAJ43",
+    "AAJ42",
+    "AAJ32",
+    "AAT98",
+    "AAT97",
+    "AAT96",
+    "AAT95",
+    "AAT94",
+    "AAT93",
+    "AAT92",
+    "AAT87",
+    "AAT86",
+    "AAT85",
+    "AAT84",
+    "AAT83",
+    "AAT82",
+    "AAT76",
+    "AAT75",
+    "AAT74",
+    "AAT73",
+    "AAT72",
+    "AAT65",
+    "AAT64",
+    "AAT63",
+    "AAT62",
+    "AAT54",
+    "AAT53",
+    "AAT52",
+    "AAT43",
+    "AAT42",
+    "AAT32",
+    "AA987",
+    "AA986",
+    "AA985",
+    "AA984",
+    "AA983",
+    "AA982",
+    "AA976",
+    "AA975",
+    "AA974",
+    "AA973",
+    "AA972",
+    "AA965",
+    "AA964",
+    "AA963",
+    "AA962",
+    "AA954",
+    "AA953",
+    "AA952",
+    "AA943",
+    "AA942",
+    "AA932",
+    "AA876",
+    "AA875",
+    "AA874",
+    "AA873",
+    "AA872",
+    "AA865",
+    "AA864",
+    "AA863",
+    "AA862",
+    "AA854",
+    "AA853",
+    "AA852",
+    "AA843",
+    "AA842",
+    "AA832",
+    "AA765",
+    "AA764",
+    "AA763",
+    "AA762",
+    "AA754",
+    "AA753",
+    "AA752",
+    "AA743",
+    "AA742",
+    "AA732",
+    "AA654",
+    "AA653",
+    "AA652",
+    "AA643",
+    "AA642",
+    "AA632",
+    "AA543",
+    "AA542",
+    "AA532",
+    "AA432",
+    "KKAQJ",
+    "KKAQT",
+    "KKAQ9",
+    "KKAQ8",
+    "KKAQ7",
+    "KKAQ6",
+    "KKAQ5",
+    "KKAQ4",
+    "KKAQ3",
+    "KKAQ2",
+    "KKAJT",
+    "KKAJ9",
+    "KKAJ8",
+    "KKAJ7",
+    "KKAJ6",
+    "KKAJ5",
+    "KKAJ4",
+    "KKAJ3",
+    "KKAJ2",
+    "KKAT9",
+    "KKAT8",
+    "KKAT7",
+    "KKAT6",
+    "KKAT5",
+    "KKAT4",
+    "KKAT3",
+    "KKAT2",
+    "KKA98",
+    "KKA97",
+    "KKA96",
+    "KKA95",
+    "KKA94",
+    "KKA93",
+    "KKA92",
+    "KKA87",
+    "KKA86",
+    "KKA85",
+    "KKA84",
+    "KKA83",
+    "KKA82",
+    "KKA76",
+    "KKA75",
+    "KKA74",
+    "KKA73",
+    "KKA72",
+    "KKA65",
+    "KKA64",
+    "KKA63",
+    "KKA62",
+    "KKA54",
+    "KKA53",
+    "KKA52",
+    "KKA43",
+    "KKA42",
+    "KKA32",
+    "KKQJT",
+    "KKQJ9",
+    "KKQJ8",
+    "KKQJ7",
+    "KKQJ6",
+    "KKQJ5",
+    "KKQJ4",
+    "KKQJ3",
+    "KKQJ2",
+    "KKQT9",
+    "KKQT8",
+    "KKQT7",
+    "KKQT6",
+    "KKQT5",
+    "KKQT4",
+    "KKQT3",
+    "KKQT2",
+    "KKQ98",
+    "KKQ97",
+    "KKQ96",
+    "KKQ95",
+    "KKQ94",
+    "KKQ93",
+    "KKQ92",
+    "KKQ87",
+    "KKQ86",
+    "KKQ85",
+    "KKQ84",
+    "KKQ83",
+    "KKQ82",
+    "KKQ76",
+    "KKQ75",
+    "KKQ74",
+    "KKQ73",
+    "KKQ72",
+    "KKQ65",
+    "KKQ64",
+    "KKQ63",
+    "KKQ62",
+    "KKQ54",
+    "KKQ53",
+    "KKQ52",
+    "KKQ43",
+    "KKQ42",
+    "KKQ32",
+    "KKJT9",
+    "KKJT8",
+    "KKJT7",
+    "KKJT6",
+    "KKJT5",
+    "KKJT4",
+    "KKJT3",
+    "KKJT2",
+    "KKJ98",
+    "KKJ97",
+    "KKJ96",
+    "KKJ95",
+    "KKJ94",
+    "KKJ93",
+    "KKJ92",
+    "KKJ87",
+    "KKJ86",
+    "KKJ85",
+    "KKJ84",
+    "KKJ83",
+    "KKJ82",
+    "KKJ76",
+    "KKJ75",
+    "KKJ74",
+    "KKJ73",
+    "KKJ72",
+    "KKJ65",
+    "KKJ64",
+    "KKJ63",
+    "KKJ62",
+    "KKJ54",
+    "KKJ53",
+    "KKJ52",
+    "KKJ43",
+    "KKJ42",
+    "KKJ32",
+    "KKT98",
+    "KKT97",
+    "KKT96",
+    "KKT95",
+    "KKT94",
+    "KKT93",
+    "KKT92",
+    "KKT87",
+    "KKT86",
+    "KKT85",
+    "KKT84",
+    "KKT83",
+    "KKT82",
+    "KKT76",
+    "KKT75",
+    "KKT74",
+    "KKT73",
+    "KKT72",
+    "KKT65",
+    "KKT64",
+    "KKT63",
+    "KKT62",
+    "KKT54",
+    "KKT53",
+    "KKT52",
+    "KKT43",
+    "KKT42",
+    "KKT32",
+    "KK987",
+    "KK986",
+    "KK985",
+    "KK984",
+    "KK983",
+    "KK982",
+    "KK976",
+    "KK975",
+    "KK974",
+    "KK973",
+    "KK972",
+    "KK965",
+    "KK964",
+    "KK963",
+    "KK962",
+    "KK954",
+    "KK953",
+    "KK952",
+    "KK943",
+    "KK942",
+    "KK932",
+    "KK876",
+    "KK875",
+    "KK874",
+    "KK873",
+    "KK872",
+    "KK865",
+    "KK864",
+    "KK863",
+    "KK862",
+    "KK854",
+    "KK853",
+    "KK852",
+    "KK843",
+    "KK842",
+    "KK832",
+    "KK765",
+    "KK764",
+    "KK763",
+    "KK762",
+    "KK754",
+    "KK753",
+    "KK752",
+    "KK743",
+    "KK742",
+    "KK732",
+    "KK654",
+    "KK653",
+    "KK652",
+    "KK643",
+    "KK642",
+    "KK632",
+    "KK543",
+    "KK542",
+    "KK532",
+    "KK432",
+    "QQAKJ",
+    "QQAKT",
+    "QQAK9",
+    "QQAK8",
+    "QQAK7",
+    "QQAK6",
+    "QQAK5",
+    "QQAK4",
+    "QQAK3",
+    "QQAK2",
+    "QQAJT",
+    "QQAJ9",
+    "QQAJ8",
+    "QQAJ7",
+    "QQAJ6",
+    "QQAJ5",
+    "QQAJ4",
+    "QQAJ3",
+    "QQAJ2",
+    "QQAT9",
+    "QQAT8",
+    "QQAT7",
+    "QQAT6",
+    "QQAT5",
+    "QQAT4",
+    "QQAT3",
+    "QQAT2",
+    "QQA98",
+    "QQA97",
+    "QQA96",
+    "QQA95",
+    "QQA94",
+    "QQA93",
+    "QQA92",
+    "QQA87",
+    "QQA86",
+    "QQA85",
+    "QQA84",
+    "QQA83",
+    "QQA82",
+    "QQA76",
+    "QQA75",
+    "QQA74",
+    "QQA73",
+    "QQA72",
+    "QQA65",
+    "QQA64",
+    "QQA63",
+    "QQA62",
+    "QQA54",
+    "QQA53",
+    "QQA52",
+    "QQA43",
+    "QQA42",
+    "QQA32",
+    "QQKJT",
+    "QQKJ9",
+    "QQKJ8",
+    "QQKJ7",
+    "QQKJ6",
+    "QQKJ5",
+    "QQKJ4",
+    "QQKJ3",
+    "QQKJ2",
+    "QQKT9",
+    "QQKT8",
+    "QQKT7",
+    "QQKT6",
+    "QQKT5",
+    "QQKT4",
+    "QQKT3",
+    "QQKT2",
+    "QQK98",
+    "QQK97",
+    "QQK96",
+    "QQK95",
+    "QQK94",
+    "QQK93",
+    "QQK92",
+    "QQK87",
+    "QQK86",
+    "QQK85",
+    "QQK84",
+    "QQK83",
+    "QQK82",
+    "QQK76",
+    "QQK75",
+    "QQK74",
+    "QQK73",
+    "QQK72",
+    "QQK65",
+    "QQK64",
+    "QQK63",
+    "QQK62",
+    "QQK54",
+    "QQK53",
+    "QQK52",
+    "QQK43",
+    "QQK42",
+    "QQK32",
+    "QQJT9",
+    "QQJT8",
+    "QQJT7",
+    "QQJT6",
+    "QQJT5",
+    "QQJT4",
+    "QQJT3",
+    "QQJT2",
+    "QQJ98",
+    "QQJ97",
+    "QQJ96",
+    "QQJ95",
+    "QQJ94",
+    "QQJ93",
+    "QQJ92",
+    "QQJ87",
+    "QQJ86",
+    "QQJ85",
+    "QQJ84",
+    "QQJ83",
+    "QQJ82",
+    "QQJ76",
+    "QQJ75",
+    "QQJ74",
+    "QQJ73",
+    "QQJ72",
+    "QQJ65",
+    "QQJ64",
+    "QQJ63",
+    "QQJ62",
+    "QQJ54",
+    "QQJ53",
+    "QQJ52",
+    "QQJ43",
+    "QQJ42",
+    "QQJ32",
+    "QQT98",
+    "QQT97",
+    "QQT96",
+    "QQT95",
+    "QQT94",
+    "QQT93",
+    "QQT92",
+    "QQT87",
+    "QQT86",
+    "QQT85",
+    "QQT84",
+    "QQT83",
+    "QQT82",
+    "QQT76",
+    "QQT75",
+    "QQT74",
+    "QQT73",
+    "QQT72",
+    "QQT65",
+    "QQT64",
+    "QQT63",
+    "QQT62",
+    "QQT54",
+    "QQT53",
+    "QQT52",
+    "QQT43",
+    "QQT42",
+    "QQT32",
+    "QQ987",
+    "QQ986",
+    "QQ985",
+    "QQ984",
+    "QQ983",
+    "QQ982",
+    "QQ976",
+    "QQ975",
+    "QQ974",
+    "QQ973",
+    "QQ972",
+    "QQ965",
+    "QQ964",
+    "QQ963",
+    "QQ962",
+    "QQ954",
+    "QQ953",
+    "QQ952",
+    "QQ943",
+    "QQ942",
+    "QQ932",
+    "QQ876",
+    "QQ875",
+    "QQ874",
+    "QQ873",
+    "QQ872",
+    "QQ865",
+    "QQ864",
+    "QQ863",
+    "QQ862",
+    "QQ854",
+    "QQ853",
+    "QQ852",
+    "QQ843",
+    "QQ842",
+    "QQ832",
+    "QQ765",
+    "QQ764",
+    "QQ763",
+    "QQ762",
+    "QQ754",
+    "QQ753",
+    "QQ752",
+    "QQ743",
+    "QQ742",
+    "QQ732",
+    "QQ654",
+    "QQ653",
+    "QQ652",
+    "QQ643",
+    "QQ642",
+    "QQ632",
+    "QQ543",
+    "QQ542",
+    "QQ532",
+    "QQ432",
+    "JJAKQ",
+    "JJAKT",
+    "JJAK9",
+    "JJAK8",
+    "JJAK7",
+    "JJAK6",
+    "JJAK5",
+    "JJAK4",
+    "JJAK3",
+    "JJAK2",
+    "JJAQT",
+    "JJAQ9",
+    "JJAQ8",
+    "JJAQ7",
+    "JJAQ6",
+    "JJAQ5",
+    "JJAQ4",
+    "JJAQ3",
+    "JJAQ2",
+    "JJAT9",
+    "JJAT8",
+    "JJAT7",
+    "JJAT6",
+    "JJAT5",
+    "JJAT4",
+    "JJAT3",
+    "JJAT2",
+    "JJA98",
+    "JJA97",
+    "JJA96",
+    "JJA95",
+    "JJA94",
+    "JJA93",
+    "JJA92",
+    "JJA87",
+    "JJA86",
+    "JJA85",
+    "JJA84",
+    "JJA83",
+    "JJA82",
+    "JJA76",
+    "JJA75",
+    "JJA74",
+    "JJA73",
+    "JJA72",
+    "JJA65",
+    "JJA64",
+    "JJA63",
+    "JJA62",
+    "JJA54",
+    "JJA53",
+    "JJA52",
+    "JJA43",
+    "JJA42",
+    "JJA32",
+    "JJKQT",
+    "JJKQ9",
+    "JJKQ8",
+    "JJKQ7",
+    "JJKQ6",
+    "JJKQ5",
+    "JJKQ4",
+    "JJKQ3",
+    "JJKQ2",
+    "JJKT9",
+    "JJKT8",
+    "JJKT7",
+    "JJKT6",
+    "JJKT5",
+    "JJKT4",
+    "JJKT3",
+    "JJKT2",
+    "JJK98",
+    "JJK97",
+    "JJK96",
+    "JJK95",
+    "JJK94",
+    "JJK93",
+    "JJK92",
+    "JJK87",
+    "JJK86",
+    "JJK85",
+    "JJK84",
+    "JJK83",
+    "JJK82",
+    "JJK76",
+    "JJK75",
+    "JJK74",
+    "JJK73",
+    "JJK72",
+    "JJK65",
+    "JJK64",
+    "JJK63",
+    "JJK62",
+    "JJK54",
+    "JJK53",
+    "JJK52",
+    "JJK43",
+    "JJK42",
+    "JJK32",
+    "JJQT9",
+    "JJQT8",
+    "JJQT7",
+    "JJQT6",
+    "JJQT5",
+    "JJQT4",
+    "JJQT3",
+    "JJQT2",
+    "JJQ98",
+    "JJQ97",
+    "JJQ96",
+    "JJQ95",
+    "JJQ94",
+    "JJQ93",
+    "JJQ92",
+    "JJQ87",
+    "JJQ86",
+    "JJQ85",
+    "JJQ84",
+    "JJQ83",
+    "JJQ82",
+    "JJQ76",
+    "JJQ75",
+    "JJQ74",
+    "JJQ73",
+    "JJQ72",
+    "JJQ65",
+    "JJQ64",
+    "JJQ63",
+    "JJQ62",
+    "JJQ54",
+    "JJQ53",
+    "JJQ52",
+    "JJQ43",
+    "JJQ42",
+    "JJQ32",
+    "JJT98",
+    "JJT97",
+    "JJT96",
+    "JJT95",
+    "JJT94",
+    "JJT93",
+    "JJT92",
+    "JJT87",
+    "JJT86",
+    "JJT85",
+    "JJT84",
+    "JJT83",
+    "JJT82",
+    "JJT76",
+    "JJT75",
+    "JJT74",
+    "JJT73",
+    "JJT72",
+    "JJT65",
+    "JJT64",
+    "JJT63",
+    "JJT62",
+    "JJT54",
+    "JJT53",
+    "JJT52",
+    "JJT43",
+    "JJT42",
+    "JJT32",
+    "JJ987",
+    "JJ986",
+    "JJ985",
+    "JJ984",
+    "JJ983",
+    "JJ982",
+    "JJ976",
+    "JJ975",
+    "JJ974",
+    "JJ973",
+    "JJ972",
+    "JJ965",
+    "JJ964",
+    "JJ963",
+    "JJ962",
+    "JJ954",
+    "JJ953",
+    "JJ952",
+    "JJ943",
+    "JJ942",
+    "JJ932",
+    "JJ876",
+    "JJ875",
+    "JJ874",
+    "JJ873",
+    "JJ872",
+    "JJ865",
+    "JJ864",
+    "JJ863",
+    "JJ862",
+    "JJ854",
+    "JJ853",
+    "JJ852",
+    "JJ843",
+    "JJ842",
+    "JJ832",
+    "JJ765",
+    "JJ764",
+    "JJ763",
+    "JJ762",
+    "JJ754",
+    "JJ753",
+    "JJ752",
+    "JJ743",
+    "JJ742",
+    "JJ732",
+    "JJ654",
+    "JJ653",
+    "JJ652",
+    "JJ643",
+    "JJ642",
+    "JJ632",
+    "JJ543",
+    "JJ542",
+    "JJ532",
+    "JJ432",
+    "TTAKQ",
+    "TTAKJ",
+    "TTAK9",
+    "TTAK8",
+    "TTAK7",
+    "TTAK6",
+    "TTAK5",
+    "TTAK4",
+    "TTAK3",
+    "TTAK2",
+    "TTAQJ",
+    "TTAQ9",
+    "TTAQ8",
+    "TTAQ7",
+    "TTAQ6",
+    "TTAQ5",
+    "TTAQ4",
+    "TTAQ3",
+    "TTAQ2",
+    "TTAJ9",
+    "TTAJ8",
+    "TTAJ7",
+    "TTAJ6",
+    "TTAJ5",
+    "TTAJ4",
+    "TTAJ3",
+    "TTAJ2",
+    "TTA98",
+    "TTA97",
+    "TTA96",
+    "TTA95",
+    "TTA94",
+    "TTA93",
+    "TTA92",
+    "TTA87",
+    "TTA86",
+    "TTA85",
+    "TTA84",
+    "TTA83",
+    "TTA82",
+    "TTA76",
+    "TTA75",
+    "TTA74",
+    "TTA73",
+    "TTA72",
+    "TTA65",
+    "TTA64",
+    "TTA63",
+    "TTA62",
+    "TTA54",
+    "TTA53",
+    "TTA52",
+    "TTA43",
+    "TTA42",
+    "TTA32",
+    "TTKQJ",
+    "TTKQ9",
+    "TTKQ8",
+    "TTKQ7",
+    "TTKQ6",
+    "TTKQ5",
+    "TTKQ4",
+    "TTKQ3",
+    "TTKQ2",
+    "TTKJ9",
+    "TTKJ8",
+    "TTKJ7",
+    "TTKJ6",
+    "TTKJ5",
+    "TTKJ4",
+    "TTKJ3",
+    "TTKJ2",
+    "TTK98",
+    "TTK97",
+    "TTK96",
+    "TTK95",
+    "TTK94",
+    "TTK93",
+    "TTK92",
+    "TTK87",
+    "TTK86",
+    "TTK85",
+    "TTK84",
+    "TTK83",
+    "TTK82",
+    "TTK76",
+    "TTK75",
+    "TTK74",
+    "TTK73",
+    "TTK72",
+    "TTK65",
+    "TTK64",
+    "TTK63",
+    "TTK62",
+    "TTK54",
+    "TTK53",
+    "TTK52",
+    "TTK43",
+    "TTK42",
+    "TTK32",
+    "TTQJ9",
+    "TTQJ8",
+    "TTQJ7",
+    "TTQJ6",
+    "TTQJ5",
+    "TTQJ4",
+    "TTQJ3",
+    "TTQJ2",
+    "TTQ98",
+    "TTQ97",
+    "TTQ96",
+    "TTQ95",
+    "TTQ94",
+    "TTQ93",
+    "TTQ92",
+    "TTQ87",
+    "TTQ86",
+    "TTQ85",
+    "TTQ84",
+    "TTQ83",
+    "TTQ82",
+    "TTQ76",
+    "TTQ75",
+    "TTQ74",
+    "TTQ73",
+    "TTQ72",
+    "TTQ65",
+    "TTQ64",
+    "TTQ63",
+    "TTQ62",
+    "TTQ54",
+    "TTQ53",
+    "TTQ52",
+    "TTQ43",
+    "TTQ42",
+    "TTQ32",
+    "TTJ98",
+    "TTJ97",
+    "TTJ96",
+    "TTJ95",
+    "TTJ94",
+    "TTJ93",
+    "TTJ92",
+    "TTJ87",
+    "TTJ86",
+    "TTJ85",
+    "TTJ84",
+    "TTJ83",
+    "TTJ82",
+    "TTJ76",
+    "TTJ75",
+    "TTJ74",
+    "TTJ73",
+    "TTJ72",
+    "TTJ65",
+    "TTJ64",
+    "TTJ63",
+    "TTJ62",
+    "TTJ54",
+    "TTJ53",
+    "TTJ52",
+    "TTJ43",
+    "TTJ42",
+    "TTJ32",
+    "TT987",
+    "TT986",
+    "TT985",
+    "TT984",
+    "TT983",
+    "TT982",
+    "TT976",
+    "TT975",
+    "TT974",
+    "TT973",
+    "TT972",
+    "TT965",
+    "TT964",
+    "TT963",
+    "TT962",
+    "TT954",
+    "TT953",
+    "TT952",
+    "TT943",
+    "TT942",
+    "TT932",
+    "TT876",
+    "TT875",
+    "TT874",
+    "TT873",
+    "TT872",
+    "TT865",
+    "TT864",
+    "TT863",
+    "TT862",
+    "TT854",
+    "TT853",
+    "TT852",
+    "TT843",
+    "TT842",
+    "TT832",
+    "TT765",
+    "TT764",
+    "TT763",
+    "TT762",
+    "TT754",
+    "TT753",
+    "TT752",
+    "TT743",
+    "TT742",
+    "TT732",
+    "TT654",
+    "TT653",
+    "TT652",
+    "TT643",
+    "TT642",
+    "TT632",
+    "TT543",
+    "TT542",
+    "TT532",
+    "TT432",
+    "99AKQ",
+    "99AKJ",
+    "99AKT",
+    "99AK8",
+    "99AK7",
+    "99AK6",
+    "99AK5",
+    "99AK4",
+    "99AK3",
+    "99AK2",
+    "99AQJ",
+    "99AQT",
+    "99AQ8",
+    "99AQ7",
+    "99AQ6",
+    "99AQ5",
+    "99AQ4",
+    "99AQ3",
+    "99AQ2",
+    "99AJT",
+    "99AJ8",
+    "99AJ7",
+    "99AJ6",
+    "99AJ5",
+    "99AJ4",
+    "99AJ3",
+    "99AJ2",
+    "99AT8",
+    "99AT7",
+    "99AT6",
+    "99AT5",
+    "99AT4",
+    "99AT3",
+    "99AT2",
+    "99A87",
+    "99A86",
+    "99A85",
+    "99A84",
+    "99A83",
+    "99A82",
+    "99A76",
+    "99A75",
+    "99A74",
+    "99A73",
+    "99A72",
+    "99A65",
+    "99A64",
+    "99A63",
+    "99A62",
+    "99A54",
+    "99A53",
+    "99A52",
+    "99A43",
+    "99A42",
+    "99A32",
+    "99KQJ",
+    "99KQT",
+    "99KQ8",
+    "99KQ7",
+    "99KQ6",
+    "99KQ5",
+    "99KQ4",
+    "99KQ3",
+    "99KQ2",
+    "99KJT",
+    "99KJ8",
+    "99KJ7",
+    "99KJ6",
+    "99KJ5",
+    "99KJ4",
+    "99KJ3",
+    "99KJ2",
+    "99KT8",
+    "99KT7",
+    "99KT6",
+    "99KT5",
+    "99KT4",
+    "99KT3",
+    "99KT2",
+    "99K87",
+    "99K86",
+    "99K85",
+    "99K84",
+    "99K83",
+    "99K82",
+    "99K76",
+    "99K75",
+    "99K74",
+    "99K73",
+    "99K72",
+    "99K65",
+    "99K64",
+    "99K63",
+    "99K62",
+    "99K54",
+    "99K53",
+    "99K52",
+    "99K43",
+    "99K42",
+    "99K32",
+    "99QJT",
+    "99QJ8",
+    "99QJ7",
+    "99QJ6",
+    "99QJ5",
+    "99QJ4",
+    "99QJ3",
+    "99QJ2",
+    "99QT8",
+    "99QT7",
+    "99QT6",
+    "99QT5",
+    "99QT4",
+    "99QT3",
+    "99QT2",
+    "99Q87",
+    "99Q86",
+    "99Q85",
+    "99Q84",
+    "99Q83",
+    "99Q82",
+    "99Q76",
+    "99Q75",
+    "99Q74",
+    "99Q73",
+    "99Q72",
+    "99Q65",
+    "99Q64",
+    "99Q63",
+    "99Q62",
+    "99Q54",
+    "99Q53",
+    "99Q52",
+    "99Q43",
+    "99Q42",
+    "99Q32",
+    "99JT8",
+    "99JT7",
+    "99JT6",
+    "99JT5",
+    "99JT4",
+    "99JT3",
+    "99JT2",
+    "99J87",
+    "99J86",
+    "99J85",
+    "99J84",
+    "99J83",
+    "99J82",
+    "99J76",
+    "99J75",
+    "99J74",
+    "99J73",
+    "99J72",
+    "99J65",
+    "99J64",
+    "99J63",
+    "99J62",
+    "99J54",
+    "99J53",
+    "99J52",
+    "99J43",
+    "99J42",
+    "99J32",
+    "99T87",
+    "99T86",
+    "99T85",
+    "99T84",
+    "99T83",
+    "99T82",
+    "99T76",
+    "99T75",
+    "99T74",
+    "99T73",
+    "99T72",
+    "99T65",
+    "99T64",
+    "99T63",
+    "99T62",
+    "99T54",
+    "99T53",
+    "99T52",
+    "99T43",
+    "99T42",
+    "99T32",
+    "99876",
+    "99875",
+    "99874",
+    "99873",
+    "99872",
+    "99865",
+    "99864",
+    "99863",
+    "99862",
+    "99854",
+    "99853",
+    "99852",
+    "99843",
+    "99842",
+    "99832",
+    "99765",
+    "99764",
+    "99763",
+    "99762",
+    "99754",
+    "99753",
+    "99752",
+    "99743",
+    "99742",
+    "99732",
+    "99654",
+    "99653",
+    "99652",
+    "99643",
+    "99642",
+    "99632",
+    "99543",
+    "99542",
+    "99532",
+    "99432",
+    "88AKQ",
+    "88AKJ",
+    "88AKT",
+    "88AK9",
+    "88AK7",
+    "88AK6",
+    "88AK5",
+    "88AK4",
+    "88AK3",
+    "88AK2",
+    "88AQJ",
+    "88AQT",
+    "88AQ9",
+    "88AQ7",
+    "88AQ6",
+    "88AQ5",
+    "88AQ4",
+    "88AQ3",
+    "88AQ2",
+    "88AJT",
+    "88AJ9",
+    "88AJ7",
+    "88AJ6",
+    "88AJ5",
+    "88AJ4",
+    "88AJ3",
+    "88AJ2",
+    "88AT9",
+    "88AT7",
+    "88AT6",
+    "88AT5",
+    "88AT4",
+    "88AT3",
+    "88AT2",
+    "88A97",
+    "88A96",
+    "88A95",
+    "88A94",
+    "88A93",
+    "88A92",
+    "88A76",
+    "88A75",
+    "88A74",
+    "88A73",
+    "88A72",
+    "88A65",
+    "88A64",
+    "88A63",
+    "88A62",
+    "88A54",
+    "88A53",
+    "88A52",
+    "88A43",
+    "88A42",
+    "88A32",
+    "88KQJ",
+    "88KQT",
+    "88KQ9",
+    "88KQ7",
+    "88KQ6",
+    "88KQ5",
+    "88KQ4",
+    "88KQ3",
+    "88KQ2",
+    "88KJT",
+    "88KJ9",
+    "88KJ7",
+    "88KJ6",
+    "88KJ5",
+    "88KJ4",
+    "88KJ3",
+    "88KJ2",
+    "88KT9",
+    "88KT7",
+    "88KT6",
+    "88KT5",
+    "88KT4",
+    "88KT3",
+    "88KT2",
+    "88K97",
+    "88K96",
+    "88K95",
+    "88K94",
+    "88K93",
+    "88K92",
+    "88K76",
+    "88K75",
+    "88K74",
+    "88K73",
+    "88K72",
+    "88K65",
+    "88K64",
+    "88K63",
+    "88K62",
+    "88K54",
+    "88K53",
+    "88K52",
+    "88K43",
+    "88K42",
+    "88K32",
+    "88QJT",
+    "88QJ9",
+    "88QJ7",
+    "88QJ6",
+    "88QJ5",
+    "88QJ4",
+    "88QJ3",
+    "88QJ2",
+    "88QT9",
+    "88QT7",
+    "88QT6",
+    "88QT5",
+    "88QT4",
+    "88QT3",
+    "88QT2",
+    "88Q97",
+    "88Q96",
+    "88Q95",
+    "88Q94",
+    "88Q93",
+    "88Q92",
+    "88Q76",
+    "88Q75",
+    "88Q74",
+    "88Q73",
+    "88Q72",
+    "88Q65",
+    "88Q64",
+    "88Q63",
+    "88Q62",
+    "88Q54",
+    "88Q53",
+    "88Q52",
+    "88Q43",
+    "88Q42",
+    "88Q32",
+    "88JT9",
+    "88JT7",
+    "88JT6",
+    "88JT5",
+    "88JT4",
+    "88JT3",
+    "88JT2",
+    "88J97",
+    "88J96",
+    "88J95",
+    "88J94",
+    "88J93",
+    "88J92",
+    "88J76",
+    "88J75",
+    "88J74",
+    "88J73",
+    "88J72",
+    "88J65",
+    "88J64",
+    "88J63",
+    "88J62",
+    "88J54",
+    "88J53",
+    "88J52",
+    "88J43",
+    "88J42",
+    "88J32",
+    "88T97",
+    "88T96",
+    "88T95",
+    "88T94",
+    "88T93",
+    "88T92",
+    "88T76",
+    "88T75",
+    "88T74",
+    "88T73",
+    "88T72",
+    "88T65",
+    "88T64",
+    "88T63",
+    "88T62",
+    "88T54",
+    "88T53",
+    "88T52",
+    "88T43",
+    "88T42",
+    "88T32",
+    "88976",
+    "88975",
+    "88974",
+    "88973",
+    "88972",
+    "88965",
+    "88964",
+    "88963",
+    "88962",
+    "88954",
+    "88953",
+    "88952",
+    "88943",
+    "88942",
+    "88932",
+    "88765",
+    "88764",
+    "88763",
+    "88762",
+    "88754",
+    "88753",
+    "88752",
+    "88743",
+    "88742",
+    "88732",
+    "88654",
+    "88653",
+    "88652",
+    "88643",
+    "88642",
+    "88632",
+    "88543",
+    "88542",
+    "88532",
+    "88432",
+    "77AKQ",
+    "77AKJ",
+    "77AKT",
+    "77AK9",
+    "77AK8",
+    "77AK6",
+    "77AK5",
+    "77AK4",
+    "77AK3",
+    "77AK2",
+    "77AQJ",
+    "77AQT",
+    "77AQ9",
+    "77AQ8",
+    "77AQ6",
+    "77AQ5",
+    "77AQ4",
+    "77AQ3",
+    "77AQ2",
+    "77AJT",
+    "77AJ9",
+    "77AJ8",
+    "77AJ6",
+    "77AJ5",
+    "77AJ4",
+    "77AJ3",
+    "77AJ2",
+    "77AT9",
+    "77AT8",
+    "77AT6",
+    "77AT5",
+    "77AT4",
+    "77AT3",
+    "77AT2",
+    "77A98",
+    "77A96",
+    "77A95",
+    "77A94",
+    "77A93",
+    "77A92",
+    "77A86",
+    "77A85",
+    "77A84",
+    "77A83",
+    "77A82",
+    "77A65",
+    "77A64",
+    "77A63",
+    "77A62",
+    "77A54",
+    "77A53",
+    "77A52",
+    "77A43",
+    "77A42",
+    "77A32",
+    "77KQJ",
+    "77KQT",
+    "77KQ9",
+    "77KQ8",
+    "77KQ6",
+    "77KQ5",
+    "77KQ4",
+    "77KQ3",
+    "77KQ2",
+    "77KJT",
+    "77KJ9",
+    "77KJ8",
+    "77KJ6",
+    "77KJ5",
+    "77KJ4",
+    "77KJ3",
+    "77KJ2",
+    "77KT9",
+    "77KT8",
+    "77KT6",
+    "77KT5",
+    "77KT4",
+    "77KT3",
+    "77KT2",
+    "77K98",
+    "77K96",
+    "77K95",
+    "77K94",
+    "77K93",
+    "77K92",
+    "77K86",
+    "77K85",
+    "77K84",
+    "77K83",
+    "77K82",
+    "77K65",
+    "77K64",
+    "77K63",
+    "77K62",
+    "77K54",
+    "77K53",
+    "77K52",
+    "77K43",
+    "77K42",
+    "77K32",
+    "77QJT",
+    "77QJ9",
+    "77QJ8",
+    "77QJ6",
+    "77QJ5",
+    "77QJ4",
+    "77QJ3",
+    "77QJ2",
+    "77QT9",
+    "77QT8",
+    "77QT6",
+    "77QT5",
+    "77QT4",
+    "77QT3",
+    "77QT2",
+    "77Q98",
+    "77Q96",
+    "77Q95",
+    "77Q94",
+    "77Q93",
+    "77Q92",
+    "77Q86",
+    "77Q85",
+    "77Q84",
+    "77Q83",
+    "77Q82",
+    "77Q65",
+    "77Q64",
+    "77Q63",
+    "77Q62",
+    "77Q54",
+    "77Q53",
+    "77Q52",
+    "77Q43",
+    "77Q42",
+    "77Q32",
+    "77JT9",
+    "77JT8",
+    "77JT6",
+    "77JT5",
+    "77JT4",
+    "77JT3",
+    "77JT2",
+    "77J98",
+    "77J96",
+    "77J95",
+    "77J94",
+    "77J93",
+    "77J92",
+    "77J86",
+    "77J85",
+    "77J84",
+    "77J83",
+    "77J82",
+    "77J65",
+    "77J64",
+    "77J63",
+    "77J62",
+    "77J54",
+    "77J53",
+    "77J52",
+    "77J43",
+    "77J42",
+    "77J32",
+    "77T98",
+    "77T96",
+    "77T95",
+    "77T94",
+    "77T93",
+    "77T92",
+    "77T86",
+    "77T85",
+    "77T84",
+    "77T83",
+    "77T82",
+    "77T65",
+    "77T64",
+    "77T63",
+    "77T62",
+    "77T54",
+    "77T53",
+    "77T52",
+    "77T43",
+    "77T42",
+    "77T32",
+    "77986",
+    "77985",
+    "77984",
+    "77983",
+    "77982",
+    "77965",
+    "77964",
+    "77963",
+    "77962",
+    "77954",
+    "77953",
+    "77952",
+    "77943",
+    "77942",
+    "77932",
+    "77865",
+    "77864",
+    "77863",
+    "77862",
+    "77854",
+    "77853",
+    "77852",
+    "77843",
+    "77842",
+    "77832",
+    "77654",
+    "77653",
+    "77652",
+    "77643",
+    "77642",
+    "77632",
+    "77543",
+    "77542",
+    "77532",
+    "77432",
+    "66AKQ",
+    "66AKJ",
+    "66AKT",
+    "66AK9",
+    "66AK8",
+    "66AK7",
+    "66AK5",
+    "66AK4",
+    "66AK3",
+    "66AK2",
+    "66AQJ",
+    "66AQT",
+    "66AQ9",
+    "66AQ8",
+    "66AQ7",
+    "66AQ5",
+    "66AQ4",
+    "66AQ3",
+    "66AQ2",
+    "66AJT",
+    "66AJ9",
+    "66AJ8",
+    "66AJ7",
+    "66AJ5",
+    "66AJ4",
+    "66AJ3",
+    "66AJ2",
+    "66AT9",
+    "66AT8",
+    "66AT7",
+    "66AT5",
+    "66AT4",
+    "66AT3",
+    "66AT2",
+    "66A98",
+    "66A97",
+    "66A95",
+    "66A94",
+    "66A93",
+    "66A92",
+    "66A87",
+    "66A85",
+    "66A84",
+    "66A83",
+    "66A82",
+    "66A75",
+    "66A74",
+    "66A73",
+    "66A72",
+    "66A54",
+    "66A53",
+    "66A52",
+    "66A43",
+    "66A42",
+    "66A32",
+    "66KQJ",
+    "66KQT",
+    "66KQ9",
+    "66KQ8",
+    "66KQ7",
+    "66KQ5",
+    "66KQ4",
+    "66KQ3",
+    "66KQ2",
+    "66KJT",
+    "66KJ9",
+    "66KJ8",
+    "66KJ7",
+    "66KJ5",
+    "66KJ4",
+    "66KJ3",
+    "66KJ2",
+    "66KT9",
+    "66KT8",
+    "66KT7",
+    "66KT5",
+    "66KT4",
+    "66KT3",
+    "66KT2",
+    "66K98",
+    "66K97",
+    "66K95",
+    "66K94",
+    "66K93",
+    "66K92",
+    "66K87",
+    "66K85",
+    "66K84",
+    "66K83",
+    "66K82",
+    "66K75",
+    "66K74",
+    "66K73",
+    "66K72",
+    "66K54",
+    "66K53",
+    "66K52",
+    "66K43",
+    "66K42",
+    "66K32",
+    "66QJT",
+    "66QJ9",
+    "66QJ8",
+    "66QJ7",
+    "66QJ5",
+    "66QJ4",
+    "66QJ3",
+    "66QJ2",
+    "66QT9",
+    "66QT8",
+    "66QT7",
+    "66QT5",
+    "66QT4",
+    "66QT3",
+    "66QT2",
+    "66Q98",
+    "66Q97",
+    "66Q95",
+    "66Q94",
+    "66Q93",
+    "66Q92",
+    "66Q87",
+    "66Q85",
+    "66Q84",
+    "66Q83",
+    "66Q82",
+    "66Q75",
+    "66Q74",
+    "66Q73",
+    "66Q72",
+    "66Q54",
+    "66Q53",
+    "66Q52",
+    "66Q43",
+    "66Q42",
+    "66Q32",
+    "66JT9",
+    "66JT8",
+    "66JT7",
+    "66JT5",
+    "66JT4",
+    "66JT3",
+    "66JT2",
+    "66J98",
+    "66J97",
+    "66J95",
+    "66J94",
+    "66J93",
+    "66J92",
+    "66J87",
+    "66J85",
+    "66J84",
+    "66J83",
+    "66J82",
+    "66J75",
+    "66J74",
+    "66J73",
+    "66J72",
+    "66J54",
+    "66J53",
+    "66J52",
+    "66J43",
+    "66J42",
+    "66J32",
+    "66T98",
+    "66T97",
+    "66T95",
+    "66T94",
+    "66T93",
+    "66T92",
+    "66T87",
+    "66T85",
+    "66T84",
+    "66T83",
+    "66T82",
+    "66T75",
+    "66T74",
+    "66T73",
+    "66T72",
+    "66T54",
+    "66T53",
+    "66T52",
+    "66T43",
+    "66T42",
+    "66T32",
+    "66987",
+    "66985",
+    "66984",
+    "66983",
+    "66982",
+    "66975",
+    "66974",
+    "66973",
+    "66972",
+    "66954",
+    "66953",
+    "66952",
+    "66943",
+    "66942",
+    "66932",
+    "66875",
+    "66874",
+    "66873",
+    "66872",
+    "66854",
+    "66853",
+    "66852",
+    "66843",
+    "66842",
+    "66832",
+    "66754",
+    "66753",
+    "66752",
+    "66743",
+    "66742",
+    "66732",
+    "66543",
+    "66542",
+    "66532",
+    "66432",
+    "55AKQ",
+    "55AKJ",
+    "55AKT",
+    "55AK9",
+    "55AK8",
+    "55AK7",
+    "55AK6",
+    "55AK4",
+    "55AK3",
+    "55AK2",
+    "55AQJ",
+    "55AQT",
+    "55AQ9",
+    "55AQ8",
+    "55AQ7",
+    "55AQ6",
+    "55AQ4",
+    "55AQ3",
+    "55AQ2",
+    "55AJT",
+    "55AJ9",
+    "55AJ8",
+    "55AJ7",
+    "55AJ6",
+    "55AJ4",
+    "55AJ3",
+    "55AJ2",
+    "55AT9",
+    "55AT8",
+    "55AT7",
+    "55AT6",
+    "55AT4",
+    "55AT3",
+    "55AT2",
+    "55A98",
+    "55A97",
+    "55A96",
+    "55A94",
+    "55A93",
+    "55A92",
+    "55A87",
+    "55A86",
+    "55A84",
+    "55A83",
+    "55A82",
+    "55A76",
+    "55A74",
+    "55A73",
+    "55A72",
+    "55A64",
+    "55A63",
+    "55A62",
+    "55A43",
+    "55A42",
+    "55A32",
+    "55KQJ",
+    "55KQT",
+    "55KQ9",
+    "55KQ8",
+    "55KQ7",
+    "55KQ6",
+    "55KQ4",
+    "55KQ3",
+    "55KQ2",
+    "55KJT",
+    "55KJ9",
+    "55KJ8",
+    "55KJ7",
+    "55KJ6",
+    "55KJ4",
+    "55KJ3",
+    "55KJ2",
+    "55KT9",
+    "55KT8",
+    "55KT7",
+    "55KT6",
+    "55KT4",
+    "55KT3",
+    "55KT2",
+    "55K98",
+    "55K97",
+    "55K96",
+    "55K94",
+    "55K93",
+    "55K92",
+    "55K87",
+    "55K86",
+    "55K84",
+    "55K83",
+    "55K82",
+    "55K76",
+    "55K74",
+    "55K73",
+    "55K72",
+    "55K64",
+    "55K63",
+    "55K62",
+    "55K43",
+    "55K42",
+    "55K32",
+    "55QJT",
+    "55QJ9",
+    "55QJ8",
+    "55QJ7",
+    "55QJ6",
+    "55QJ4",
+    "55QJ3",
+    "55QJ2",
+    "55QT9",
+    "55QT8",
+    "55QT7",
+    "55QT6",
+    "55QT4",
+    "55QT3",
+    "55QT2",
+    "55Q98",
+    "55Q97",
+    "55Q96",
+    "55Q94",
+    "55Q93",
+    "55Q92",
+    "55Q87",
+    "55Q86",
+    "55Q84",
+    "55Q83",
+    "55Q82",
+    "55Q76",
+    "55Q74",
+    "55Q73",
+    "55Q72",
+    "55Q64",
+    "55Q63",
+    "55Q62",
+    "55Q43",
+    "55Q42",
+    "55Q32",
+    "55JT9",
+    "55JT8",
+    "55JT7",
+    "55JT6",
+    "55JT4",
+    "55JT3",
+    "55JT2",
+    "55J98",
+    "55J97",
+    "55J96",
+    "55J94",
+    "55J93",
+    "55J92",
+    "55J87",
+    "55J86",
+    "55J84",
+    "55J83",
+    "55J82",
+    "55J76",
+    "55J74",
+    "55J73",
+    "55J72",
+    "55J64",
+    "55J63",
+    "55J62",
+    "55J43",
+    "55J42",
+    "55J32",
+    "55T98",
+    "55T97",
+    "55T96",
+    "55T94",
+    "55T93",
+    "55T92",
+    "55T87",
+    "55T86",
+    "55T84",
+    "55T83",
+    "55T82",
+    "55T76",
+    "55T74",
+    "55T73",
+    "55T72",
+    "55T64",
+    "55T63",
+    "55T62",
+    "55T43",
+    "55T42",
+    "55T32",
+    "55987",
+    "55986",
+    "55984",
+    "55983",
+    "55982",
+    "55976",
+    "55974",
+    "55973",
+    "55972",
+    "55964",
+    "55963",
+    "55962",
+    "55943",
+    "55942",
+    "55932",
+    "55876",
+    "55874",
+    "55873",
+    "55872",
+    "55864",
+    "55863",
+    "55862",
+    "55843",
+    "55842",
+    "55832",
+    "55764",
+    "55763",
+    "55762",
+    "55743",
+    "55742",
+    "55732",
+    "55643",
+    "55642",
+    "55632",
+    "55432",
+    "44AKQ",
+    "44AKJ",
+    "44AKT",
+    "44AK9",
+    "44AK8",
+    "44AK7",
+    "44AK6",
+    "44AK5",
+    "44AK3",
+    "44AK2",
+    "44AQJ",
+    "44AQT",
+    "44AQ9",
+    "44AQ8",
+    "44AQ7",
+    "44AQ6",
+    "44AQ5",
+    "44AQ3",
+    "44AQ2",
+    "44AJT",
+    "44AJ9",
+    "44AJ8",
+    "44AJ7",
+    "44AJ6",
+    "44AJ5",
+    "44AJ3",
+    "44AJ2",
+    "44AT9",
+    "44AT8",
+    "44AT7",
+    "44AT6",
+    "44AT5",
+    "44AT3",
+    "44AT2",
+    "44A98",
+    "44A97",
+    "44A96",
+    "44A95",
+    "44A93",
+    "44A92",
+    "44A87",
+    "44A86",
+    "44A85",
+    "44A83",
+    "44A82",
+    "44A76",
+    "44A75",
+    "44A73",
+    "44A72",
+    "44A65",
+    "44A63",
+    "44A62",
+    "44A53",
+    "44A52",
+    "44A32",
+    "44KQJ",
+    "44KQT",
+    "44KQ9",
+    "44KQ8",
+    "44KQ7",
+    "44KQ6",
+    "44KQ5",
+    "44KQ3",
+    "44KQ2",
+    "44KJT",
+    "44KJ9",
+    "44KJ8",
+    "44KJ7",
+    "44KJ6",
+    "44KJ5",
+    "44KJ3",
+    "44KJ2",
+    "44KT9",
+    "44KT8",
+    "44KT7",
+    "44KT6",
+    "44KT5",
+    "44KT3",
+    "44KT2",
+    "44K98",
+    "44K97",
+    "44K96",
+    "44K95",
+    "44K93",
+    "44K92",
+    "44K87",
+    "44K86",
+    "44K85",
+    "44K83",
+    "44K82",
+    "44K76",
+    "44K75",
+    "44K73",
+    "44K72",
+    "44K65",
+    "44K63",
+    "44K62",
+    "44K53",
+    "44K52",
+    "44K32",
+    "44QJT",
+    "44QJ9",
+    "44QJ8",
+    "44QJ7",
+    "44QJ6",
+    "44QJ5",
+    "44QJ3",
+    "44QJ2",
+    "44QT9",
+    "44QT8",
+    "44QT7",
+    "44QT6",
+    "44QT5",
+    "44QT3",
+    "44QT2",
+    "44Q98",
+    "44Q97",
+    "44Q96",
+    "44Q95",
+    "44Q93",
+    "44Q92",
+    "44Q87",
+    "44Q86",
+    "44Q85",
+    "44Q83",
+    "44Q82",
+    "44Q76",
+    "44Q75",
+    "44Q73",
+    "44Q72",
+    "44Q65",
+    "44Q63",
+    "44Q62",
+    "44Q53",
+    "44Q52",
+    "44Q32",
+    "44JT9",
+    "44JT8",
+    "44JT7",
+    "44JT6",
+    "44JT5",
+    "44JT3",
+    "44JT2",
+    "44J98",
+    "44J97",
+    "44J96",
+    "44J95",
+    "44J93",
+    "44J92",
+    "44J87",
+    "44J86",
+    "44J85",
+    "44J83",
+    "44J82",
+    "44J76",
+    "44J75",
+    "44J73",
+    "44J72",
+    "44J65",
+    "44J63",
+    "44J62",
+    "44J53",
+    "44J52",
+    "44J32",
+    "44T98",
+    "44T97",
+    "44T96",
+    "44T95",
+    "44T93",
+    "44T92",
+    "44T87",
+    "44T86",
+    "44T85",
+    "44T83",
+    "44T82",
+    "44T76",
+    "44T75",
+    "44T73",
+    "44T72",
+    "44T65",
+    "44T63",
+    "44T62",
+    "44T53",
+    "44T52",
+    "44T32",
+    "44987",
+    "44986",
+    "44985",
+    "44983",
+    "44982",
+    "44976",
+    "44975",
+    "44973",
+    "44972",
+    "44965",
+    "44963",
+    "44962",
+    "44953",
+    "44952",
+    "44932",
+    "44876",
+    "44875",
+    "44873",
+    "44872",
+    "44865",
+    "44863",
+    "44862",
+    "44853",
+    "44852",
+    "44832",
+    "44765",
+    "44763",
+    "44762",
+    "44753",
+    "44752",
+    "44732",
+    "44653",
+    "44652",
+    "44632",
+    "44532",
+    "33AKQ",
+    "33AKJ",
+    "33AKT",
+    "33AK9",
+    "33AK8",
+    "33AK7",
+    "33AK6",
+    "33AK5",
+    "33AK4",
+    "33AK2",
+    "33AQJ",
+    "33AQT",
+    "33AQ9",
+    "33AQ8",
+    "33AQ7",
+    "33AQ6",
+    "33AQ5",
+    "33AQ4",
+    "33AQ2",
+    "33AJT",
+    "33AJ9",
+    "33AJ8",
+    "33AJ7",
+    "33AJ6",
+    "33AJ5",
+    "33AJ4",
+    "33AJ2",
+    "33AT9",
+    "33AT8",
+    "33AT7",
+    "33AT6",
+    "33AT5",
+    "33AT4",
+    "33AT2",
+    "33A98",
+    "33A97",
+    "33A96",
+    "33A95",
+    "33A94",
+    "33A92",
+    "33A87",
+    "33A86",
+    "33A85",
+    "33A84",
+    "33A82",
+    "33A76",
+    "33A75",
+    "33A74",
+    "33A72",
+    "33A65",
+    "33A64",
+    "33A62",
+    "33A54",
+    "33A52",
+    "33A42",
+    "33KQJ",
+    "33KQT",
+    "33KQ9",
+    "33KQ8",
+    "33KQ7",
+    "33KQ6",
+    "33KQ5",
+    "33KQ4",
+    "33KQ2",
+    "33KJT",
+    "33KJ9",
+    "33KJ8",
+    "33KJ7",
+    "33KJ6",
+    "33KJ5",
+    "33KJ4",
+    "33KJ2",
+    "33KT9",
+    "33KT8",
+    "33KT7",
+    "33KT6",
+    "33KT5",
+    "33KT4",
+    "33KT2",
+    "33K98",
+    "33K97",
+    "33K96",
+    "33K95",
+    "33K94",
+    "33K92",
+    "33K87",
+    "33K86",
+    "33K85",
+    "33K84",
+    "33K82",
+    "33K76",
+    "33K75",
+    "33K74",
+    "33K72",
+    "33K65",
+    "33K64",
+    "33K62",
+    "33K54",
+    "33K52",
+    "33K42",
+    "33QJT",
+    "33QJ9",
+    "33QJ8",
+    "33QJ7",
+    "33QJ6",
+    "33QJ5",
+    "33QJ4",
+    "33QJ2",
+    "33QT9",
+    "33QT8",
+    "33QT7",
+    "33QT6",
+    "33QT5",
+    "33QT4",
+    "33QT2",
+    "33Q98",
+    "33Q97",
+    "33Q96",
+    "33Q95",
+    "33Q94",
+    "33Q92",
+    "33Q87",
+    "33Q86",
+    "33Q85",
+    "33Q84",
+    "33Q82",
+    "33Q76",
+    "33Q75",
+    "33Q74",
+    "33Q72",
+    "33Q65",
+    "33Q64",
+    "33Q62",
+    "33Q54",
+    "33Q52",
+    "33Q42",
+    "33JT9",
+    "33JT8",
+    "33JT7",
+    "33JT6",
+    "33JT5",
+    "33JT4",
+    "33JT2",
+    "33J98",
+    "33J97",
+    "33J96",
+    "33J95",
+    "33J94",
+    "33J92",
+    "33J87",
+    "33J86",
+    "33J85",
+    "33J84",
+    "33J82",
+    "33J76",
+    "33J75",
+    "33J74",
+    "33J72",
+    "33J65",
+    "33J64",
+    "33J62",
+    "33J54",
+    "33J52",
+    "33J42",
+    "33T98",
+    "33T97",
+    "33T96",
+    "33T95",
+    "33T94",
+    "33T92",
+    "33T87",
+    "33T86",
+    "33T85",
+    "33T84",
+    "33T82",
+    "33T76",
+    "33T75",
+    "33T74",
+    "33T72",
+    "33T65",
+    "33T64",
+    "33T62",
+    "33T54",
+    "33T52",
+    "33T42",
+    "33987",
+    "33986",
+    "33985",
+    "33984",
+    "33982",
+    "33976",
+    "33975",
+    "33974",
+    "33972",
+    "33965",
+    "33964",
+    "33962",
+    "33954",
+    "33952",
+    "33942",
+    "33876",
+    "33875",
+    "33874",
+    "33872",
+    "33865",
+    "33864",
+    "33862",
+    "33854",
+    "33852",
+    "33842",
+    "33765",
+    "33764",
+    "33762",
+    "33754",
+    "33752",
+    "33742",
+    "33654",
+    "33652",
+    "33642",
+    "33542",
+    "22AKQ",
+    "22AKJ",
+    "22AKT",
+    "22AK9",
+    "22AK8",
+    "22AK7",
+    "22AK6",
+    "22AK5",
+    "22AK4",
+    "22AK3",
+    "22AQJ",
+    "22AQT",
+    "22AQ9",
+    "22AQ8",
+    "22AQ7",
+    "22AQ6",
+    "22AQ5",
+    "22AQ4",
+    "22AQ3",
+    "22AJT",
+    "22AJ9",
+    "22AJ8",
+    "22AJ7",
+    "22AJ6",
+    "22AJ5",
+    "22AJ4",
+    "22AJ3",
+    "22AT9",
+    "22AT8",
+    "22AT7",
+    "22AT6",
+    "22AT5",
+    "22AT4",
+    "22AT3",
+    "22A98",
+    "22A97",
+    "22A96",
+    "22A95",
+    "22A94",
+    "22A93",
+    "22A87",
+    "22A86",
+    "22A85",
+    "22A84",
+    "22A83",
+    "22A76",
+    "22A75",
+    "22A74",
+    "22A73",
+    "22A65",
+    "22A64",
+    "22A63",
+    "22A54",
+    "22A53",
+    "22A43",
+    "22KQJ",
+    "22KQT",
+    "22KQ9",
+    "22KQ8",
+    "22KQ7",
+    "22KQ6",
+    "22KQ5",
+    "22KQ4",
+    "22KQ3",
+    "22KJT",
+    "22KJ9",
+    "22KJ8",
+    "22KJ7",
+    "22KJ6",
+    "22KJ5",
+    "22KJ4",
+    "22KJ3",
+    "22KT9",
+    "22KT8",
+    "22KT7",
+    "22KT6",
+    "22KT5",
+    "22KT4",
+    "22KT3",
+    "22K98",
+    "22K97",
+    "22K96",
+    "22K95",
+    "22K94",
+    "22K93",
+    "22K87",
+    "22K86",
+    "22K85",
+    "22K84",
+    "22K83",
+    "22K76",
+    "22K75",
+    "22K74",
+    "22K73",
+    "22K65",
+    "22K64",
+    "22K63",
+    "22K54",
+    "22K53",
+    "22K43",
+    "22QJT",
+    "22QJ9",
+    "22QJ8",
+    "22QJ7",
+    "22QJ6",
+    "22QJ5",
+    "22QJ4",
+    "22QJ3",
+    "22QT9",
+    "22QT8",
+    "22QT7",
+    "22QT6",
+    "22QT5",
+    "22QT4",
+    "22QT3",
+    "22Q98",
+    "22Q97",
+    "22Q96",
+    "22Q95",
+    "22Q94",
+    "22Q93",
+    "22Q87",
+    "22Q86",
+    "22Q85",
+    "22Q84",
+    "22Q83",
+    "22Q76",
+    "22Q75",
+    "22Q74",
+    "22Q73",
+    "22Q65",
+    "22Q64",
+    "22Q63",
+    "22Q54",
+    "22Q53",
+    "22Q43",
+    "22JT9",
+    "22JT8",
+    "22JT7",
+    "22JT6",
+    "22JT5",
+    "22JT4",
+    "22JT3",
+    "22J98",
+    "22J97",
+    "22J96",
+    "22J95",
+    "22J94",
+    "22J93",
+    "22J87",
+    "22J86",
+    "22J85",
+    "22J84",
+    "22J83",
+    "22J76",
+    "22J75",
+    "22J74",
+    "22J73",
+    "22J65",
+    "22J64",
+    "22J63",
+    "22J54",
+    "22J53",
+    "22J43",
+    "22T98",
+    "22T97",
+    "22T96",
+    "22T95",
+    "22T94",
+    "22T93",
+    "22T87",
+    "22T86",
+    "22T85",
+    "22T84",
+    "22T83",
+    "22T76",
+    "22T75",
+    "22T74",
+    "22T73",
+    "22T65",
+    "22T64",
+    "22T63",
+    "22T54",
+    "22T53",
+    "22T43",
+    "22987",
+    "22986",
+    "22985",
+    "22984",
+    "22983",
+    "22976",
+    "22975",
+    "22974",
+    "22973",
+    "22965",
+    "22964",
+    "22963",
+    "22954",
+    "22953",
+    "22943",
+    "22876",
+    "22875",
+    "22874",
+    "22873",
+    "22865",
+    "22864",
+    "22863",
+    "22854",
+    "22853",
+    "22843",
+    "22765",
+    "22764",
+    "22763",
+    "22754",
+    "22753",
+    "22743",
+    "22654",
+    "22653",
+    "22643",
+    "22543",
+    "AKQJ9",
+    "AKQJ8",
+    "AKQJ7",
+    "AKQJ6",
+    "AKQJ5",
+    "AKQJ4",
+    "AKQJ3",
+    "AKQJ2",
+    "AKQT9",
+    "AKQT8",
+    "AKQT7",
+    "AKQT6",
+    "AKQT5",
+    "AKQT4",
+    "AKQT3",
+    "AKQT2",
+    "AKQ98",
+    "AKQ97",
+    "AKQ96",
+    "AKQ95",
+    "AKQ94",
+    "AKQ93",
+    "AKQ92",
+    "AKQ87",
+    "AKQ86",
+    "AKQ85",
+    "AKQ84",
+    "AKQ83",
+    "AKQ82",
+    "AKQ76",
+    "AKQ75",
+    "AKQ74",
+    "AKQ73",
+    "AKQ72",
+    "AKQ65",
+    "AKQ64",
+    "AKQ63",
+    "AKQ62",
+    "AKQ54",
+    "AKQ53",
+    "AKQ52",
+    "AKQ43",
+    "AKQ42",
+    "AKQ32",
+    "AKJT9",
+    "AKJT8",
+    "AKJT7",
+    "AKJT6",
+    "AKJT5",
+    "AKJT4",
+    "AKJT3",
+    "AKJT2",
+    "AKJ98",
+    "AKJ97",
+    "AKJ96",
+    "AKJ95",
+    "AKJ94",
+    "AKJ93",
+    "AKJ92",
+    "AKJ87",
+    "AKJ86",
+    "AKJ85",
+    "AKJ84",
+    "AKJ83",
+    "AKJ82",
+    "AKJ76",
+    "AKJ75",
+    "AKJ74",
+    "AKJ73",
+    "AKJ72",
+    "AKJ65",
+    "AKJ64",
+    "AKJ63",
+    "AKJ62",
+    "AKJ54",
+    "AKJ53",
+    "AKJ52",
+    "AKJ43",
+    "AKJ42",
+    "AKJ32",
+    "AKT98",
+    "AKT97",
+    "AKT96",
+    "AKT95",
+    "AKT94",
+    "AKT93",
+    "AKT92",
+    "AKT87",
+    "AKT86",
+    "AKT85",
+    "AKT84",
+    "AKT83",
+    "AKT82",
+    "AKT76",
+    "AKT75",
+    "AKT74",
+    "AKT73",
+    "AKT72",
+    "AKT65",
+    "AKT64",
+    "AKT63",
+    "AKT62",
+    "AKT54",
+    "AKT53",
+    "AKT52",
+    "AKT43",
+    "AKT42",
+    "AKT32",
+    "AK987",
+    "AK986",
+    "AK985",
+    "AK984",
+    "AK983",
+    "AK982",
+    "AK976",
+    "AK975",
+    "AK974",
+    "AK973",
+    "AK972",
+    "AK965",
+    "AK964",
+    "AK963",
+    "AK962",
+    "AK954",
+    "AK953",
+    "AK952",
+    "AK943",
+    "AK942",
+    "AK932",
+    "AK876",
+    "AK875",
+    "AK874",
+    "AK873",
+    "AK872",
+    "AK865",
+    "AK864",
+    "AK863",
+    "AK862",
+    "AK854",
+    "AK853",
+    "AK852",
+    "AK843",
+    "AK842",
+    "AK832",
+    "AK765",
+    "AK764",
+    "AK763",
+    "AK762",
+    "AK754",
+    "AK753",
+    "AK752",
+    "AK743",
+    "AK742",
+    "AK732",
+    "AK654",
+    "AK653",
+    "AK652",
+    "AK643",
+    "AK642",
+    "AK632",
+    "AK543",
+    "AK542",
+    "AK532",
+    "AK432",
+    "AQJT9",
+    "AQJT8",
+    "AQJT7",
+    "AQJT6",
+    "AQJT5",
+    "AQJT4",
+    "AQJT3",
+    "AQJT2",
+    "AQJ98",
+    "AQJ97",
+    "AQJ96",
+    "AQJ95",
+    "AQJ94",
+    "AQJ93",
+    "AQJ92",
+    "AQJ87",
+    "AQJ86",
+    "AQJ85",
+    "AQJ84",
+    "AQJ83",
+    "AQJ82",
+    "AQJ76",
+    "AQJ75",
+    "AQJ74",
+    "AQJ73",
+    "AQJ72",
+    "AQJ65",
+    "AQJ64",
+    "AQJ63",
+    "AQJ62",
+    "AQJ54",
+    "AQJ53",
+    "AQJ52",
+    "AQJ43",
+    "AQJ42",
+    "AQJ32",
+    "AQT98",
+    "AQT97",
+    "AQT96",
+    "AQT95",
+    "AQT94",
+    "AQT93",
+    "AQT92",
+    "AQT87",
+    "AQT86",
+    "AQT85",
+    "AQT84",
+    "AQT83",
+    "AQT82",
+    "AQT76",
+    "AQT75",
+    "AQT74",
+    "AQT73",
+    "AQT72",
+    "AQT65",
+    "AQT64",
+    "AQT63",
+    "AQT62",
+    "AQT54",
+    "AQT53",
+    "AQT52",
+    "AQT43",
+    "AQT42",
+    "AQT32",
+    "AQ987",
+    "AQ986",
+    "AQ985",
+    "AQ984",
+    "AQ983",
+    "AQ982",
+    "AQ976",
+    "AQ975",
+    "AQ974",
+    "AQ973",
+    "AQ972",
+    "AQ965",
+    "AQ964",
+    "AQ963",
+    "AQ962",
+    "AQ954",
+    "AQ953",
+    "AQ952",
+    "AQ943",
+    "AQ942",
+    "AQ932",
+    "AQ876",
+    "AQ875",
+    "AQ874",
+    "AQ873",
+    "AQ872",
+    "AQ865",
+    "AQ864",
+    "AQ863",
+    "AQ862",
+    "AQ854",
+    "AQ853",
+    "AQ852",
+    "AQ843",
+    "AQ842",
+    "AQ832",
+    "AQ765",
+    "AQ764",
+    "AQ763",
+    "AQ762",
+    "AQ754",
+    "AQ753",
+    "AQ752",
+    "AQ743",
+    "AQ742",
+    "AQ732",
+    "AQ654",
+    "AQ653",
+    "AQ652",
+    "AQ643",
+    "AQ642",
+    "AQ632",
+    "AQ543",
+    "AQ542",
+    "AQ532",
+    "AQ432",
+    "AJT98",
+    "AJT97",
+    "AJT96",
+    "AJT95",
+    "AJT94",
+    "AJT93",
+    "AJT92",
+    "AJT87",
+    "AJT86",
+    "AJT85",
+    "AJT84",
+    "AJT83",
+    "AJT82",
+    "AJT76",
+    "AJT75",
+    "AJT74",
+    "AJT73",
+    "AJT72",
+    "AJT65",
+    "AJT64",
+    "AJT63",
+    "AJT62",
+    "AJT54",
+    "AJT53",
+    "AJT52",
+    "AJT43",
+    "AJT42",
+    "AJT32",
+    "AJ987",
+    "AJ986",
+    "AJ985",
+    "AJ984",
+    "AJ983",
+    "AJ982",
+    "AJ976",
+    "AJ975",
+    "AJ974",
+    "AJ973",
+    "AJ972",
+    "AJ965",
+    "AJ964",
+    "AJ963",
+    "AJ962",
+    "AJ954",
+    "AJ953",
+    "AJ952",
+    "AJ943",
+    "AJ942",
+    "AJ932",
+    "AJ876",
+    "AJ875",
+    "AJ874",
+    "AJ873",
+    "AJ872",
+    "AJ865",
+    "AJ864",
+    "AJ863",
+    "AJ862",
+    "AJ854",
+    "AJ853",
+    "AJ852",
+    "AJ843",
+    "AJ842",
+    "AJ832",
+    "AJ765",
+    "AJ764",
+    "AJ763",
+    "AJ762",
+    "AJ754",
+    "AJ753",
+    "AJ752",
+    "AJ743",
+    "AJ742",
+    "AJ732",
+    "AJ654",
+    "AJ653",
+    "AJ652",
+    "AJ643",
+    "AJ642",
+    "AJ632",
+    "AJ543",
+    "AJ542",
+    "AJ532",
+    "AJ432",
+    "AT987",
+    "AT986",
+    "AT985",
+    "AT984",
+    "AT983",
+    "AT982",
+    "AT976",
+    "AT975",
+    "AT974",
+    "AT973",
+    "AT972",
+    "AT965",
+    "AT964",
+    "AT963",
+    "AT962",
+    "AT954",
+    "AT953",
+    "AT952",
+    "AT943",
+    "AT942",
+    "AT932",
+    "AT876",
+    "AT875",
+    "AT874",
+    "AT873",
+    "AT872",
+    "AT865",
+    "AT864",
+    "AT863",
+    "AT862",
+    "AT854",
+    "AT853",
+    "AT852",
+    "AT843",
+    "AT842",
+    "AT832",
+    "AT765",
+    "AT764",
+    "AT763",
+    "AT762",
+    "AT754",
+    "AT753",
+    "AT752",
+    "AT743",
+    "AT742",
+    "AT732",
+    "AT654",
+    "AT653",
+    "AT652",
+    "AT643",
+    "AT642",
+    "AT632",
+    "AT543",
+    "AT542",
+    "AT532",
+    "AT432",
+    "A9876",
+    "A9875",
+    "A9874",
+    "A9873",
+    "A9872",
+    "A9865",
+    "A9864",
+    "A9863",
+    "A9862",
+    "A9854",
+    "A9853",
+    "A9852",
+    "A9843",
+    "A9842",
+    "A9832",
+    "A9765",
+    "A9764",
+    "A9763",
+    "A9762",
+    "A9754",
+    "A9753",
+    "A9752",
+    "A9743",
+    "A9742",
+    "A9732",
+    "A9654",
+    "A9653",
+    "A9652",
+    "A9643",
+    "A9642",
+    "A9632",
+    "A9543",
+    "A9542",
+    "A9532",
+    "A9432",
+    "A8765",
+    "A8764",
+    "A8763",
+    "A8762",
+    "A8754",
+    "A8753",
+    "A8752",
+    "A8743",
+    "A8742",
+    "A8732",
+    "A8654",
+    "A8653",
+    "A8652",
+    "A8643",
+    "A8642",
+    "A8632",
+    "A8543",
+    "A8542",
+    "A8532",
+    "A8432",
+    "A7654",
+    "A7653",
+    "A7652",
+    "A7643",
+    "A7642",
+    "A7632",
+    "A7543",
+    "A7542",
+    "A7532",
+    "A7432",
+    "A6543",
+    "A6542",
+    "A6532",
+    "A6432",
+    "KQJT8",
+    "KQJT7",
+    "KQJT6",
+    "KQJT5",
+    "KQJT4",
+    "KQJT3",
+    "KQJT2",
+    "KQJ98",
+    "KQJ97",
+    "KQJ96",
+    "KQJ95",
+    "KQJ94",
+    "KQJ93",
+    "KQJ92",
+    "KQJ87",
+    "KQJ86",
+    "KQJ85",
+    "KQJ84",
+    "KQJ83",
+    "KQJ82",
+    "KQJ76",
+    "KQJ75",
+    "KQJ74",
+    "KQJ73",
+    "KQJ72",
+    "KQJ65",
+    "KQJ64",
+    "KQJ63",
+    "KQJ62",
+    "KQJ54",
+    "KQJ53",
+    "KQJ52",
+    "KQJ43",
+    "KQJ42",
+    "KQJ32",
+    "KQT98",
+    "KQT97",
+    "KQT96",
+    "KQT95",
+    "KQT94",
+    "KQT93",
+    "KQT92",
+    "KQT87",
+    "KQT86",
+    "KQT85",
+    "KQT84",
+    "KQT83",
+    "KQT82",
+    "KQT76",
+    "KQT75",
+    "KQT74",
+    "KQT73",
+    "KQT72",
+    "KQT65",
+    "KQT64",
+    "KQT63",
+    "KQT62",
+    "KQT54",
+    "KQT53",
+    "KQT52",
+    "KQT43",
+    "KQT42",
+    "KQT32",
+    "KQ987",
+    "KQ986",
+    "KQ985",
+    "KQ984",
+    "KQ983",
+    "KQ982",
+    "KQ976",
+    "KQ975",
+    "KQ974",
+    "KQ973",
+    "KQ972",
+    "KQ965",
+    "KQ964",
+    "KQ963",
+    "KQ962",
+    "KQ954",
+    "KQ953",
+    "KQ952",
+    "KQ943",
+    "KQ942",
+    "KQ932",
+    "KQ876",
+    "KQ875",
+    "KQ874",
+    "KQ873",
+    "KQ872",
+    "KQ865",
+    "KQ864",
+    "KQ863",
+    "KQ862",
+    "KQ854",
+    "KQ853",
+    "KQ852",
+    "KQ843",
+    "KQ842",
+    "KQ832",
+    "KQ765",
+    "KQ764",
+    "KQ763",
+    "KQ762",
+    "KQ754",
+    "KQ753",
+    "KQ752",
+    "KQ743",
+    "KQ742",
+    "KQ732",
+    "KQ654",
+    "KQ653",
+    "KQ652",
+    "KQ643",
+    "KQ642",
+    "KQ632",
+    "KQ543",
+    "KQ542",
+    "KQ532",
+    "KQ432",
+    "KJT98",
+    "KJT97",
+    "KJT96",
+    "KJT95",
+    "KJT94",
+    "KJT93",
+    "KJT92",
+    "KJT87",
+    "KJT86",
+    "KJT85",
+    "KJT84",
+    "KJT83",
+    "KJT82",
+    "KJT76",
+    "KJT75",
+    "KJT74",
+    "KJT73",
+    "KJT72",
+    "KJT65",
+    "KJT64",
+    "KJT63",
+    "KJT62",
+    "KJT54",
+    "KJT53",
+    "KJT52",
+    "KJT43",
+    "KJT42",
+    "KJT32",
+    "KJ987",
+    "KJ986",
+    "KJ985",
+    "KJ984",
+    "KJ983",
+    "KJ982",
+    "KJ976",
+    "KJ975",
+    "KJ974",
+    "KJ973",
+    "KJ972",
+    "KJ965",
+    "KJ964",
+    "KJ963",
+    "KJ962",
+    "KJ954",
+    "KJ953",
+    "KJ952",
+    "KJ943",
+    "KJ942",
+    "KJ932",
+    "KJ876",
+    "KJ875",
+    "KJ874",
+    "KJ873",
+    "KJ872",
+    "KJ865",
+    "KJ864",
+    "KJ863",
+    "KJ862",
+    "KJ854",
+    "KJ853",
+    "KJ852",
+    "KJ843",
+    "KJ842",
+    "KJ832",
+    "KJ765",
+    "KJ764",
+    "KJ763",
+    "KJ762",
+    "KJ754",
+    "KJ753",
+    "KJ752",
+    "KJ743",
+    "KJ742",
+    "KJ732",
+    "KJ654",
+    "KJ653",
+    "KJ652",
+    "KJ643",
+    "KJ642",
+    "KJ632",
+    "KJ543",
+    "KJ542",
+    "KJ532",
+    "KJ432",
+    "KT987",
+    "KT986",
+    "KT985",
+    "KT984",
+    "KT983",
+    "KT982",
+    "KT976",
+    "KT975",
+    "KT974",
+    "KT973",
+    "KT972",
+    "KT965",
+    "KT964",
+    "KT963",
+    "KT962",
+    "KT954",
+    "KT953",
+    "KT952",
+    "KT943",
+    "KT942",
+    "KT932",
+    "KT876",
+    "KT875",
+    "KT874",
+    "KT873",
+    "KT872",
+    "KT865",
+    "KT864",
+    "KT863",
+    "KT862",
+    "KT854",
+    "KT853",
+    "KT852",
+    "KT843",
+    "KT842",
+    "KT832",
+    "KT765",
+    "KT764",
+    "KT763",
+    "KT762",
+    "KT754",
+    "KT753",
+    "KT752",
+    "KT743",
+    "KT742",
+    "KT732",
+    "KT654",
+    "KT653",
+    "KT652",
+    "KT643",
+    "KT642",
+    "KT632",
+    "KT543",
+    "KT542",
+    "KT532",
+    "KT432",
+    "K9876",
+    "K9875",
+    "K9874",
+    "K9873",
+    "K9872",
+    "K9865",
+    "K9864",
+    "K9863",
+    "K9862",
+    "K9854",
+    "K9853",
+    "K9852",
+    "K9843",
+    "K9842",
+    "K9832",
+    "K9765",
+    "K9764",
+    "K9763",
+    "K9762",
+    "K9754",
+    "K9753",
+    "K9752",
+    "K9743",
+    "K9742",
+    "K9732",
+    "K9654",
+    "K9653",
+    "K9652",
+    "K9643",
+    "K9642",
+    "K9632",
+    "K9543",
+    "K9542",
+    "K9532",
+    "K9432",
+    "K8765",
+    "K8764",
+    "K8763",
+    "K8762",
+    "K8754",
+    "K8753",
+    "K8752",
+    "K8743",
+    "K8742",
+    "K8732",
+    "K8654",
+    "K8653",
+    "K8652",
+    "K8643",
+    "K8642",
+    "K8632",
+    "K8543",
+    "K8542",
+    "K8532",
+    "K8432",
+    "K7654",
+    "K7653",
+    "K7652",
+    "K7643",
+    "K7642",
+    "K7632",
+    "K7543",
+    "K7542",
+    "K7532",
+    "K7432",
+    "K6543",
+    "K6542",
+    "K6532",
+    "K6432",
+    "K5432",
+    "QJT97",
+    "QJT96",
+    "QJT95",
+    "QJT94",
+    "QJT93",
+    "QJT92",
+    "QJT87",
+    "QJT86",
+    "QJT85",
+    "QJT84",
+    "QJT83",
+    "QJT82",
+    "QJT76",
+    "QJT75",
+    "QJT74",
+    "QJT73",
+    "QJT72",
+    "QJT65",
+    "QJT64",
+    "QJT63",
+    "QJT62",
+    "QJT54",
+    "QJT53",
+    "QJT52",
+    "QJT43",
+    "QJT42",
+    "QJT32",
+    "QJ987",
+    "QJ986",
+    "QJ985",
+    "QJ984",
+    "QJ983",
+    "QJ982",
+    "QJ976",
+    "QJ975",
+    "QJ974",
+    "QJ973",
+    "QJ972",
+    "QJ965",
+    "QJ964",
+    "QJ963",
+    "QJ962",
+    "QJ954",
+    "QJ953",
+    "QJ952",
+    "QJ943",
+    "QJ942",
+    "QJ932",
+    "QJ876",
+    "QJ875",
+    "QJ874",
+    "QJ873",
+    "QJ872",
+    "QJ865",
+    "QJ864",
+    "QJ863",
+    "QJ862",
+    "QJ854",
+    "QJ853",
+    "QJ852",
+    "QJ843",
+    "QJ842",
+    "QJ832",
+    "QJ765",
+    "QJ764",
+    "QJ763",
+    "QJ762",
+    "QJ754",
+    "QJ753",
+    "QJ752",
+    "QJ743",
+    "QJ742",
+    "QJ732",
+    "QJ654",
+    "QJ653",
+    "QJ652",
+    "QJ643",
+    "QJ642",
+    "QJ632",
+    "QJ543",
+    "QJ542",
+    "QJ532",
+    "QJ432",
+    "QT987",
+    "QT986",
+    "QT985",
+    "QT984",
+    "QT983",
+    "QT982",
+    "QT976",
+    "QT975",
+    "QT974",
+    "QT973",
+    "QT972",
+    "QT965",
+    "QT964",
+    "QT963",
+    "QT962",
+    "QT954",
+    "QT953",
+    "QT952",
+    "QT943",
+    "QT942",
+    "QT932",
+    "QT876",
+    "QT875",
+    "QT874",
+    "QT873",
+    "QT872",
+    "QT865",
+    "QT864",
+    "QT863",
+    "QT862",
+    "QT854",
+    "QT853",
+    "QT852",
+    "QT843",
+    "QT842",
+    "QT832",
+    "QT765",
+    "QT764",
+    "QT763",
+    "QT762",
+    "QT754",
+    "QT753",
+    "QT752",
+    "QT743",
+    "QT742",
+    "QT732",
+    "QT654",
+    "QT653",
+    "QT652",
+    "QT643",
+    "QT642",
+    "QT632",
+    "QT543",
+    "QT542",
+    "QT532",
+    "QT432",
+    "Q9876",
+    "Q9875",
+    "Q9874",
+    "Q9873",
+    "Q9872",
+    "Q9865",
+    "Q9864",
+    "Q9863",
+    "Q9862",
+    "Q9854",
+    "Q9853",
+    "Q9852",
+    "Q9843",
+    "Q9842",
+    "Q9832",
+    "Q9765",
+    "Q9764",
+    "Q9763",
+    "Q9762",
+    "Q9754",
+    "Q9753",
+    "Q9752",
+    "Q9743",
+    "Q9742",
+    "Q9732",
+    "Q9654",
+    "Q9653",
+    "Q9652",
+    "Q9643",
+    "Q9642",
+    "Q9632",
+    "Q9543",
+    "Q9542",
+    "Q9532",
+    "Q9432",
+    "Q8765",
+    "Q8764",
+    "Q8763",
+    "Q8762",
+    "Q8754",
+    "Q8753",
+    "Q8752",
+    "Q8743",
+    "Q8742",
+    "Q8732",
+    "Q8654",
+    "Q8653",
+    "Q8652",
+    "Q8643",
+    "Q8642",
+    "Q8632",
+    "Q8543",
+    "Q8542",
+    "Q8532",
+    "Q8432",
+    "Q7654",
+    "Q7653",
+    "Q7652",
+    "Q7643",
+    "Q7642",
+    "Q7632",
+    "Q7543",
+    "Q7542",
+    "Q7532",
+    "Q7432",
+    "Q6543",
+    "Q6542",
+    "Q6532",
+    "Q6432",
+    "Q5432",
+    "JT986",
+    "JT985",
+    "JT984",
+    "JT983",
+    "JT982",
+    "JT976",
+    "JT975",
+    "JT974",
+    "JT973",
+    "JT972",
+    "JT965",
+    "JT964",
+    "JT963",
+    "JT962",
+    "JT954",
+    "JT953",
+    "JT952",
+    "JT943",
+    "JT942",
+    "JT932",
+    "JT876",
+    "JT875",
+    "JT874",
+    "JT873",
+    "JT872",
+    "JT865",
+    "JT864",
+    "JT863",
+    "JT862",
+    "JT854",
+    "JT853",
+    "JT852",
+    "JT843",
+    "JT842",
+    "JT832",
+    "JT765",
+    "JT764",
+    "JT763",
+    "JT762",
+    "JT754",
+    "JT753",
+    "JT752",
+    "JT743",
+    "JT742",
+    "JT732",
+    "JT654",
+    "JT653",
+    "JT652",
+    "JT643",
+    "JT642",
+    "JT632",
+    "JT543",
+    "JT542",
+    "JT532",
+    "JT432",
+    "J9876",
+    "J9875",
+    "J9874",
+    "J9873",
+    "J9872",
+    "J9865",
+    "J9864",
+    "J9863",
+    "J9862",
+    "J9854",
+    "J9853",
+    "J9852",
+    "J9843",
+    "J9842",
+    "J9832",
+    "J9765",
+    "J9764",
+    "J9763",
+    "J9762",
+    "J9754",
+    "J9753",
+    "J9752",
+    "J9743",
+    "J9742",
+    "J9732",
+    "J9654",
+    "J9653",
+    "J9652",
+    "J9643",
+    "J9642",
+    "J9632",
+    "J9543",
+    "J9542",
+    "J9532",
+    "J9432",
+    "J8765",
+    "J8764",
+    "J8763",
+    "J8762",
+    "J8754",
+    "J8753",
+    "J8752",
+    "J8743",
+    "J8742",
+    "J8732",
+    "J8654",
+    "J8653",
+    "J8652",
+    "J8643",
+    "J8642",
+    "J8632",
+    "J8543",
+    "J8542",
+    "J8532",
+    "J8432",
+    "J7654",
+    "J7653",
+    "J7652",
+    "J7643",
+    "J7642",
+    "J7632",
+    "J7543",
+    "J7542",
+    "J7532",
+    "J7432",
+    "J6543",
+    "J6542",
+    "J6532",
+    "J6432",
+    "J5432",
+    "T9875",
+    "T9874",
+    "T9873",
+    "T9872",
+    "T9865",
+    "T9864",
+    "T9863",
+    "T9862",
+    "T9854",
+    "T9853",
+    "T9852",
+    "T9843",
+    "T9842",
+    "T9832",
+    "T9765",
+    "T9764",
+    "T9763",
+    "T9762",
+    "T9754",
+    "T9753",
+    "T9752",
+    "T9743",
+    "T9742",
+    "T9732",
+    "T9654",
+    "T9653",
+    "T9652",
+    "T9643",
+    "T9642",
+    "T9632",
+    "T9543",
+    "T9542",
+    "T9532",
+    "T9432",
+    "T8765",
+    "T8764",
+    "T8763",
+    "T8762",
+    "T8754",
+    "T8753",
+    "T8752",
+    "T8743",
+    "T8742",
+    "T8732",
+    "T8654",
+    "T8653",
+    "T8652",
+    "T8643",
+    "T8642",
+    "T8632",
+    "T8543",
+    "T8542",
+    "T8532",
+    "T8432",
+    "T7654",
+    "T7653",
+    "T7652",
+    "T7643",
+    "T7642",
+    "T7632",
+    "T7543",
+    "T7542",
+    "T7532",
+    "T7432",
+    "T6543",
+    "T6542",
+    "T6532",
+    "T6432",
+    "T5432",
+    "98764",
+    "98763",
+    "98762",
+    "98754",
+    "98753",
+    "98752",
+    "98743",
+    "98742",
+    "98732",
+    "98654",
+    "98653",
+    "98652",
+    "98643",
+    "98642",
+    "98632",
+    "98543",
+    "98542",
+    "98532",
+    "98432",
+    "97654",
+    "97653",
+    "97652",
+    "97643",
+    "97642",
+    "97632",
+    "97543",
+    "97542",
+    "97532",
+    "97432",
+    "96543",
+    "96542",
+    "96532",
+    "96432",
+    "95432",
+    "87653",
+    "87652",
+    "87643",
+    "87642",
+    "87632",
+    "87543",
+    "87542",
+    "87532",
+    "87432",
+    "86543",
+    "86542",
+    "86532",
+    "86432",
+    "85432",
+    "76542",
+    "76532",
+    "76432",
+    "75432",
+};
+
+/* category, flush, primary, kicker, description offset, length */
+const struct rank_info rank_info_table[7463] = {
+    {0, 0,  0,  0,    0,  0, 0},
+    {1, 1, 12, 12,    1, 11, 0},
+    {1, 1, 11, 11,   13, 24, 0},
+    {1, 1, 10, 10,   38, 25, 0},
+    {1, 1,  9,  9,   64, 24, 0},
+    {1, 1,  8,  8,   89, 23, 0},
+    {1, 1,  7,  7,  113, 24, 0},
+    {1, 1,  6,  6,  138, 25, 0},
+    {1, 1,  5,  5,  164, 25, 0},
+    {1, 1,  4,  4,  190, 23, 0},
+    {1, 1,  3,  3,  214, 24, 0},
+    {2, 0, 12, 11,  239,  9, 0},
+    {2, 0, 12, 10,  239,  9, 0},
+    {2, 0, 12,  9,  239,  9, 0},
+    {2, 0, 12,  8,  239,  9, 0},
+    {2, 0, 12,  7,  239,  9, 0},
+    {2, 0, 12,  6,  239,  9, 0},
+    {2, 0, 12,  5,  239,  9, 0},
+    {2, 0, 12,  4,  239,  9, 0},
+    {2, 0, 12,  3,  239,  9, 0},
+    {2, 0, 12,  2,  239,  9, 0},
+    {2, 0, 12,  1,  239,  9, 0},
+    {2, 0, 12,  0,  239,  9, 0},
+    {2, 0, 11, 12,  249, 10, 0},
+    {2, 0, 11, 10,  249, 10, 0},
+    {2, 0, 11,  9,  249, 10, 0},
+    {2, 0, 11,  8,  249, 10, 0},
+    {2, 0, 11,  7,  249, 10, 0},
+    {2, 0, 11,  6,  249, 10, 0},
+    {2, 0, 11,  5,  249, 10, 0},
+    {2, 0, 11,  4,  249, 10, 0},
+    {2, 0, 11,  3,  249, 10, 0},
+    {2, 0, 11,  2,  249, 10, 0},
+    {2, 0, 11,  1,  249, 10, 0},
+    {2, 0, 11,  0,  249, 10, 0},
+    {2, 0, 10, 12,  260, 11, 0},
+    {2, 0, 10, 11,  260, 11, 0},
+    {2, 0, 10,  9,  260, 11, 0},
+    {2, 0, 10,  8,  260, 11, 0},
+    {2, 0, 10,  7,  260, 11, 0},
+    {2, 0, 10,  6,  260, 11, 0},
+    {2, 0, 10,  5,  260, 11, 0},
+    {2, 0, 10,  4,  260, 11, 0},
+    {2, 0, 10,  3,  260, 11, 0},
+    {2, 0, 10,  2,  260, 11, 0},
+    {2, 0, 10,  1,  260, 11, 0},
+    {2, 0, 10,  0,  260, 11, 0},
+    {2, 0,  9, 12,  272, 10, 0},
+    {2, 0,  9, 11,  272, 10, 0},
+    {2, 0,  9, 10,  272, 10, 0},
+    {2, 0,  9,  8,  272, 10, 0},
+    {2, 0,  9,  7,  272, 10, 0},
+    {2, 0,  9,  6,  272, 10, 0},
+    {2, 0,  9,  5,  272, 10, 0},
+    {2, 0,  9,  4,  272, 10, 0},
+    {2, 0,  9,  3,  272, 10, 0},
+    {2, 0,  9,  2,  272, 10, 0},
+    {2, 0,  9,  1,  272, 10, 0},
+    {2, 0,  9,  0,  272, 10, 0},
+    {2, 0,  8, 12,  283,  9, 0},
+    {2, 0,  8, 11,  283,  9, 0},
+    {2, 0,  8, 10,  283,  9, 0},
+    {2, 0,  8,  9,  283,  9, 0},
+    {2, 0,  8,  7,  283,  9, 0},
+    {2, 0,  8,  6,  283,  9, 0},
+    {2, 0,  8,  5,  283,  9, 0},
+    {2, 0,  8,  4,  283,  9, 0},
+    {2, 0,  8,  3,  283,  9, 0},
+    {2, 0,  8,  2,  283,  9, 0},
+    {2, 0,  8,  1,  283,  9, 0},
+    {2, 0,  8,  0,  283,  9, 0},
+    {2, 0,  7, 12,  293, 10, 0},
+    {2, 0,  7, 11,  293, 10, 0},
+    {2, 0,  7, 10,  293, 10, 0},
+    {2, 0,  7,  9,  293, 10, 0},
+    {2, 0,  7,  8,  293, 10, 0},
+    {2, 0,  7,  6,  293, 10, 0},
+    {2, 0,  7,  5,  293, 10, 0},
+    {2, 0,  7,  4,  293, 10, 0},
+    {2, 0,  7,  3,  293, 10, 0},
+    {2, 0,  7,  2,  293, 10, 0},
+    {2, 0,  7,  1,  293, 10, 0},
+    {2, 0,  7,  0,  293, 10, 0},
+    {2, 0,  6, 12,  304, 11, 0},
+    {2, 0,  6, 11,  304, 11, 0},
+    {2, 0,  6, 10,  304, 11, 0},
+    {2, 0,  6,  9,  304, 11, 0},
+    {2, 0,  6,  8,  304, 11, 0},
+    {2, 0,  6,  7,  304, 11, 0},
+    {2, 0,  6,  5,  304, 11, 0},
+    {2, 0,  6,  4,  304, 11, 0},
+    {2, 0,  6,  3,  304, 11, 0},
+    {2, 0,  6,  2,  304, 11, 0},
+    {2, 0,  6,  1,  304, 11, 0},
+    {2, 0,  6,  0,  304, 11, 0},
+    {2, 0,  5, 12,  316, 11, 0},
+    {2, 0,  5, 11,  316, 11, 0},
+    {2, 0,  5, 10,  316, 11, 0},
+    {2, 0,  5,  9,  316, 11, 0},
+    {2, 0,  5,  8,  316, 11, 0},
+    {2, 0,  5,  7,  316, 11, 0},
+    {2, 0,  5,  6,  316, 11, 0},
+    {2, 0,  5,  4,  316, 11, 0},
+    {2, 0,  5,  3,  316, 11, 0},
+    {2, 0,  5,  2,  316, 11, 0},
+    {2, 0,  5,  1,  316, 11, 0},
+    {2, 0,  5,  0,  316, 11, 0},
+    {2, 0,  4, 12,  328, 10, 0},
+    {2, 0,  4, 11,  328, 10, 0},
+    {2, 0,  4, 10,  328, 10, 0},
+    {2, 0,  4,  9,  328, 10, 0},
+    {2, 0,  4,  8,  328, 10, 0},
+    {2, 0,  4,  7,  328, 10, 0},
+    {2, 0,  4,  6,  328, 10, 0},
+    {2, 0,  4,  5,  328, 10, 0},
+    {2, 0,  4,  3,  328, 10, 0},
+    {2, 0,  4,  2,  328, 10, 0},
+    {2, 0,  4,  1,  328, 10, 0},
+    {2, 0,  4,  0,  328, 10, 0},
+    {2, 0,  3, 12,  339, 10, 0},
+    {2, 0,  3, 11,  339, 10, 0},
+    {2, 0,  3, 10,  339, 10, 0},
+    {2, 0,  3,  9,  339, 10, 0},
+    {2, 0,  3,  8,  339, 10, 0},
+    {2, 0,  3,  7,  339, 10, 0},
+    {2, 0,  3,  6,  339, 10, 0},
+    {2, 0,  3,  5,  339, 10, 0},
+    {2, 0,  3,  4,  339, 10, 0},
+    {2, 0,  3,  2,  339, 10, 0},
+    {2, 0,  3,  1,  339, 10, 0},
+    {2, 0,  3,  0,  339, 10, 0},
+    {2, 0,  2, 12,  350, 10, 0},
+    {2, 0,  2, 11,  350, 10, 0},
+    {2, 0,  2, 10,  350, 10, 0},
+    {2, 0,  2,  9,  350, 10, 0},
+    {2, 0,  2,  8,  350, 10, 0},
+    {2, 0,  2,  7,  350, 10, 0},
+    {2, 0,  2,  6,  350, 10, 0},
+    {2, 0,  2,  5,  350, 10, 0},
+    {2, 0,  2,  4,  350, 10, 0},
+    {2, 0,  2,  3,  350, 10, 0},
+    {2, 0,  2,  1,  350, 10, 0},
+    {2, 0,  2,  0,  350, 10, 0},
+    {2, 0,  1, 12,  361, 10, 0},
+    {2, 0,  1, 11,  361, 10, 0},
+    {2, 0,  1, 10,  361, 10, 0},
+    {2, 0,  1,  9,  361, 10, 0},
+    {2, 0,  1,  8,  361, 10, 0},
+    {2, 0,  1,  7,  361, 10, 0},
+    {2, 0,  1,  6,  361, 10, 0},
+    {2, 0,  1,  5,  361, 10, 0},
+    {2, 0,  1,  4,  361, 10, 0},
+    {2, 0,  1,  3,  361, 10, 0},
+    {2, 0,  1,  2,  361, 10, 0},
+    {2, 0,  1,  0,  361, 10, 0},
+    {2, 0,  0, 12,  372, 11, 0},
+    {2, 0,  0, 11,  372, 11, 0},
+    {2, 0,  0, 10,  372, 11, 0},
+    {2, 0,  0,  9,  372, 11, 0},
+    {2, 0,  0,  8,  372, 11, 0},
+    {2, 0,  0,  7,  372, 11, 0},
+    {2, 0,  0,  6,  372, 11, 0},
+    {2, 0,  0,  5,  372, 11, 0},
+    {2, 0,  0,  4,  372, 11, 0},
+    {2, 0,  0,  3,  372, 11, 0},
+    {2, 0,  0,  2,  372, 11, 0},
+    {2, 0,  0,  1,  372, 11, 0},
+    {3, 0, 12, 11,  384, 20, 0},
+    {3, 0, 12, 10,  405, 21, 0},
+    {3, 0, 12,  9,  427, 20, 0},
+    {3, 0, 12,  8,  448, 19, 0},
+    {3, 0, 12,  7,  468, 20, 0},
+    {3, 0, 12,  6,  489, 21, 0},
+    {3, 0, 12,  5,  511, 21, 0},
+    {3, 0, 12,  4,  533, 20, 0},
+    {3, 0, 12,  3,  554, 20, 0},
+    {3, 0, 12,  2,  575, 20, 0},
+    {3, 0, 12,  1,  596, 20, 0},
+    {3, 0, 12,  0,  617, 21, 0},
+    {3, 0, 11, 12,  639, 20, 0},
+    {3, 0, 11, 10,  660, 22, 0},
+    {3, 0, 11,  9,  683, 21, 0},
+    {3, 0, 11,  8,  705, 20, 0},
+    {3, 0, 11,  7,  726, 21, 0},
+    {3, 0, 11,  6,  748, 22, 0},
+    {3, 0, 11,  5,  771, 22, 0},
+    {3, 0, 11,  4,  794, 21, 0},
+    {3, 0, 11,  3,  816, 21, 0},
+    {3, 0, 11,  2,  838, 21, 0},
+    {3, 0, 11,  1,  860, 21, 0},
+    {3, 0, 11,  0,  882, 22, 0},
+    {3, 0, 10, 12,  905, 21, 0},
+    {3, 0, 10, 11,  927, 22, 0},
+    {3, 0, 10,  9,  950, 22, 0},
+    {3, 0, 10,  8,  973, 21, 0},
+    {3, 0, 10,  7,  995, 22, 0},
+    {3, 0, 10,  6, 1018, 23, 0},
+    {3, 0, 10,  5, 1042, 23, 0},
+    {3, 0, 10,  4, 1066, 22, 0},
+    {3, 0, 10,  3, 1089, 22, 0},
+    {3, 0, 10,  2, 1112, 22, 0},
+    {3, 0, 10,  1, 1135, 22, 0},
+    {3, 0, 10,  0, 1158, 23, 0},
+    {3, 0,  9, 12, 1182, 20, 0},
+    {3, 0,  9, 11, 1203, 21, 0},
+    {3, 0,  9, 10, 1225, 22, 0},
+    {3, 0,  9,  8, 1248, 20, 0},
+    {3, 0,  9,  7, 1269, 21, 0},
+    {3, 0,  9,  6, 1291, 22, 0},
+    {3, 0,  9,  5, 1314, 22, 0},
+    {3, 0,  9,  4, 1337, 21, 0},
+    {3, 0,  9,  3, 1359, 21, 0},
+    {3, 0,  9,  2, 1381, 21, 0},
+    {3, 0,  9,  1, 1403, 21, 0},
+    {3, 0,  9,  0, 1425, 22, 0},
+    {3, 0,  8, 12, 1448, 19, 0},
+    {3, 0,  8, 11, 1468, 20, 0},
+    {3, 0,  8, 10, 1489, 21, 0},
+    {3, 0,  8,  9, 1511, 20, 0},
+    {3, 0,  8,  7, 1532, 20, 0},
+    {3, 0,  8,  6, 1553, 21, 0},
+    {3, 0,  8,  5, 1575, 21, 0},
+    {3, 0,  8,  4, 1597, 20, 0},
+    {3, 0,  8,  3, 1618, 20, 0},
+    {3, 0,  8,  2, 1639, 20, 0},
+    {3, 0,  8,  1, 1660, 20, 0},
+    {3, 0,  8,  0, 1681, 21, 0},
+    {3, 0,  7, 12, 1703, 20, 0},
+    {3, 0,  7, 11, 1724, 21, 0},
+    {3, 0,  7, 10, 1746, 22, 0},
+    {3, 0,  7,  9, 1769, 21, 0},
+    {3, 0,  7,  8, 1791, 20, 0},
+    {3, 0,  7,  6, 1812, 22, 0},
+    {3, 0,  7,  5, 1835, 22, 0},
+    {3, 0,  7,  4, 1858, 21, 0},
+    {3, 0,  7,  3, 1880, 21, 0},
+    {3, 0,  7,  2, 1902, 21, 0},
+    {3, 0,  7,  1, 1924, 21, 0},
+    {3, 0,  7,  0, 1946, 22, 0},
+    {3, 0,  6, 12, 1969, 21, 0},
+    {3, 0,  6, 11, 1991, 22, 0},
+    {3, 0,  6, 10, 2014, 23, 0},
+    {3, 0,  6,  9, 2038, 22, 0},
+    {3, 0,  6,  8, 2061, 21, 0},
+    {3, 0,  6,  7, 2083, 22, 0},
+    {3, 0,  6,  5, 2106, 23, 0},
+    {3, 0,  6,  4, 2130, 22, 0},
+    {3, 0,  6,  3, 2153, 22, 0},
+    {3, 0,  6,  2, 2176, 22, 0},
+    {3, 0,  6,  1, 2199, 22, 0},
+    {3, 0,  6,  0, 2222, 23, 0},
+    {3, 0,  5, 12, 2246, 21, 0},
+    {3, 0,  5, 11, 2268, 22, 0},
+    {3, 0,  5, 10, 2291, 23, 0},
+    {3, 0,  5,  9, 2315, 22, 0},
+    {3, 0,  5,  8, 2338, 21, 0},
+    {3, 0,  5,  7, 2360, 22, 0},
+    {3, 0,  5,  6, 2383, 23, 0},
+    {3, 0,  5,  4, 2407, 22, 0},
+    {3, 0,  5,  3, 2430, 22, 0},
+    {3, 0,  5,  2, 2453, 22, 0},
+    {3, 0,  5,  1, 2476, 22, 0},
+    {3, 0,  5,  0, 2499, 23, 0},
+    {3, 0,  4, 12, 2523, 20, 0},
+    {3, 0,  4, 11, 2544, 21, 0},
+    {3, 0,  4, 10, 2566, 22, 0},
+    {3, 0,  4,  9, 2589, 21, 0},
+    {3, 0,  4,  8, 2611, 20, 0},
+    {3, 0,  4,  7, 2632, 21, 0},
+    {3, 0,  4,  6, 2654, 22, 0},
+    {3, 0,  4,  5, 2677, 22, 0},
+    {3, 0,  4,  3, 2700, 21, 0},
+    {3, 0,  4,  2, 2722, 21, 0},
+    {3, 0,  4,  1, 2744, 21, 0},
+    {3, 0,  4,  0, 2766, 22, 0},
+    {3, 0,  3, 12, 2789, 20, 0},
+    {3, 0,  3, 11, 2810, 21, 0},
+    {3, 0,  3, 10, 2832, 22, 0},
+    {3, 0,  3,  9, 2855, 21, 0},
+    {3, 0,  3,  8, 2877, 20, 0},
+    {3, 0,  3,  7, 2898, 21, 0},
+    {3, 0,  3,  6, 2920, 22, 0},
+    {3, 0,  3,  5, 2943, 22, 0},
+    {3, 0,  3,  4, 2966, 21, 0},
+    {3, 0,  3,  2, 2988, 21, 0},
+    {3, 0,  3,  1, 3010, 21, 0},
+    {3, 0,  3,  0, 3032, 22, 0},
+    {3, 0,  2, 12, 3055, 20, 0},
+    {3, 0,  2, 11, 3076, 21, 0},
+    {3, 0,  2, 10, 3098, 22, 0},
+    {3, 0,  2,  9, 3121, 21, 0},
+    {3, 0,  2,  8, 3143, 20, 0},
+    {3, 0,  2,  7, 3164, 21, 0},
+    {3, 0,  2,  6, 3186, 22, 0},
+    {3, 0,  2,  5, 3209, 22, 0},
+    {3, 0,  2,  4, 3232, 21, 0},
+    {3, 0,  2,  3, 3254, 21, 0},
+    {3, 0,  2,  1, 3276, 21, 0},
+    {3, 0,  2,  0, 3298, 22, 0},
+    {3, 0,  1, 12, 3321, 20, 0},
+    {3, 0,  1, 11, 3342, 21, 0},
+    {3, 0,  1, 10, 3364, 22, 0},
+    {3, 0,  1,  9, 3387, 21, 0},
+    {3, 0,  1,  8, 3409, 20, 0},
+    {3, 0,  1,  7, 3430, 21, 0},
+    {3, 0,  1,  6, 3452, 22, 0},
+    {3, 0,  1,  5, 3475, 22, 0},
+    {3, 0,  1,  4, 3498, 21, 0},
+    {3, 0,  1,  3, 3520, 21, 0},
+    {3, 0,  1,  2, 3542, 21, 0},
+    {3, 0,  1,  0, 3564, 22, 0},
+    {3, 0,  0, 12, 3587, 21, 0},
+    {3, 0,  0, 11, 3609, 22, 0},
+    {3, 0,  0, 10, 3632, 23, 0},
+    {3, 0,  0,  9, 3656, 22, 0},
+    {3, 0,  0,  8, 3679, 21, 0},
+    {3, 0,  0,  7, 3701, 22, 0},
+    {3, 0,  0,  6, 3724, 23, 0},
+    {3, 0,  0,  5, 3748, 23, 0},
+    {3, 0,  0,  4, 3772, 22, 0},
+    {3, 0,  0,  3, 3795, 22, 0},
+    {3, 0,  0,  2, 3818, 22, 0},
+    {3, 0,  0,  1, 3841, 22, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 11, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12, 10, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  9, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  8, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  7, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  6, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  5, 3864, 14, 0},
+    {4, 1, 12,  4, 3864, 14, 0},
+    {4, 1, 12,  4, 3864, 14, 0},
+    {4, 1, 12,  4, 3864, 14, 0},
+    {4, 1, 12,  4, 3864, 14, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11, 10, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  9, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  8, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  7, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  6, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  5, 3879, 15, 0},
+    {4, 1, 11,  4, 3879, 15, 0},
+    {4, 1, 11,  4, 3879, 15, 0},
+    {4, 1, 11,  4, 3879, 15, 0},
+    {4, 1, 11,  4, 3879, 15, 0},
+    {4, 1, 11,  3, 3879, 15, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  9, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  8, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  7, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  6, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  5, 3895, 16, 0},
+    {4, 1, 10,  4, 3895, 16, 0},
+    {4, 1, 10,  4, 3895, 16, 0},
+    {4, 1, 10,  4, 3895, 16, 0},
+    {4, 1, 10,  4, 3895, 16, 0},
+    {4, 1, 10,  3, 3895, 16, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  8, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  7, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  6, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  5, 3912, 15, 0},
+    {4, 1,  9,  4, 3912, 15, 0},
+    {4, 1,  9,  4, 3912, 15, 0},
+    {4, 1,  9,  4, 3912, 15, 0},
+    {4, 1,  9,  4, 3912, 15, 0},
+    {4, 1,  9,  3, 3912, 15, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  7, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  6, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  5, 3928, 14, 0},
+    {4, 1,  8,  4, 3928, 14, 0},
+    {4, 1,  8,  4, 3928, 14, 0},
+    {4, 1,  8,  4, 3928, 14, 0},
+    {4, 1,  8,  4, 3928, 14, 0},
+    {4, 1,  8,  3, 3928, 14, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  6, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  5, 3943, 15, 0},
+    {4, 1,  7,  4, 3943, 15, 0},
+    {4, 1,  7,  4, 3943, 15, 0},
+    {4, 1,  7,  4, 3943, 15, 0},
+    {4, 1,  7,  4, 3943, 15, 0},
+    {4, 1,  7,  3, 3943, 15, 0},
+    {4, 1,  6,  5, 3959, 16, 0},
+    {4, 1,  6,  5, 3959, 16, 0},
+    {4, 1,  6,  5, 3959, 16, 0},
+    {4, 1,  6,  5, 3959, 16, 0},
+    {4, 1,  6,  5, 3959, 16, 0},
+    {4, 1,  6,  5, 3959, 16, 0},
+    {4, 1,  6,  5, 3959, 16, 0},
+    {4, 1,  6,  5, 3959, 16, 0},
+    {4, 1,  6,  5, 3959, 16, 0},
+    {4, 1,  6,  4, 3959, 16, 0},
+    {4, 1,  6,  4, 3959, 16, 0},
+    {4, 1,  6,  4, 3959, 16, 0},
+    {4, 1,  6,  4, 3959, 16, 0},
+    {4, 1,  6,  3, 3959, 16, 0},
+    {4, 1,  5,  4, 3976, 16, 0},
+    {4, 1,  5,  4, 3976, 16, 0},
+    {4, 1,  5,  4, 3976, 16, 0},
+    {4, 1,  5,  3, 3976, 16, 0},
+    {5, 0, 12, 12, 3993, 17, 0},
+    {5, 0, 11, 11, 4011, 18, 0},
+    {5, 0, 10, 10, 4030, 19, 0},
+    {5, 0,  9,  9, 4050, 18, 0},
+    {5, 0,  8,  8, 4069, 17, 0},
+    {5, 0,  7,  7, 4087, 18, 0},
+    {5, 0,  6,  6, 4106, 19, 0},
+    {5, 0,  5,  5, 4126, 19, 0},
+    {5, 0,  4,  4, 4146, 17, 0},
+    {5, 0,  3,  3, 4164, 18, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 11, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12, 10, 4183, 10, 0},
+    {6, 0, 12,  9, 4183, 10, 0},
+    {6, 0, 12,  9, 4183, 10, 0},
+    {6, 0, 12,  9, 4183, 10, 0},
+    {6, 0, 12,  9, 4183, 10, 0},
+    {6, 0, 12,  9, 4183, 10, 0},
+    {6, 0, 12,  9, 4183, 10, 0},
+    {6, 0, 12,  9, 4183, 10, 0},
+    {6, 0, 12,  9, 4183, 10, 0},
+    {6, 0, 12,  9, 4183, 10, 0},
+    {6, 0, 12,  8, 4183, 10, 0},
+    {6, 0, 12,  8, 4183, 10, 0},
+    {6, 0, 12,  8, 4183, 10, 0},
+    {6, 0, 12,  8, 4183, 10, 0},
+    {6, 0, 12,  8, 4183, 10, 0},
+    {6, 0, 12,  8, 4183, 10, 0},
+    {6, 0, 12,  8, 4183, 10, 0},
+    {6, 0, 12,  8, 4183, 10, 0},
+    {6, 0, 12,  7, 4183, 10, 0},
+    {6, 0, 12,  7, 4183, 10, 0},
+    {6, 0, 12,  7, 4183, 10, 0},
+    {6, 0, 12,  7, 4183, 10, 0},
+    {6, 0, 12,  7, 4183, 10, 0},
+    {6, 0, 12,  7, 4183, 10, 0},
+    {6, 0, 12,  7, 4183, 10, 0},
+    {6, 0, 12,  6, 4183, 10, 0},
+    {6, 0, 12,  6, 4183, 10, 0},
+    {6, 0, 12,  6, 4183, 10, 0},
+    {6, 0, 12,  6, 4183, 10, 0},
+    {6, 0, 12,  6, 4183, 10, 0},
+    {6, 0, 12,  6, 4183, 10, 0},
+    {6, 0, 12,  5, 4183, 10, 0},
+    {6, 0, 12,  5, 4183, 10, 0},
+    {6, 0, 12,  5, 4183, 10, 0},
+    {6, 0, 12,  5, 4183, 10, 0},
+    {6, 0, 12,  5, 4183, 10, 0},
+    {6, 0, 12,  4, 4183, 10, 0},
+    {6, 0, 12,  4, 4183, 10, 0},
+    {6, 0, 12,  4, 4183, 10, 0},
+    {6, 0, 12,  4, 4183, 10, 0},
+    {6, 0, 12,  3, 4183, 10, 0},
+    {6, 0, 12,  3, 4183, 10, 0},
+    {6, 0, 12,  3, 4183, 10, 0},
+    {6, 0, 12,  2, 4183, 10, 0},
+    {6, 0, 12,  2, 4183, 10, 0},
+    {6, 0, 12,  1, 4183, 10, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 12, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11, 10, 4194, 11, 0},
+    {6, 0, 11,  9, 4194, 11, 0},
+    {6, 0, 11,  9, 4194, 11, 0},
+    {6, 0, 11,  9, 4194, 11, 0},
+    {6, 0, 11,  9, 4194, 11, 0},
+    {6, 0, 11,  9, 4194, 11, 0},
+    {6, 0, 11,  9, 4194, 11, 0},
+    {6, 0, 11,  9, 4194, 11, 0},
+    {6, 0, 11,  9, 4194, 11, 0},
+    {6, 0, 11,  9, 4194, 11, 0},
+    {6, 0, 11,  8, 4194, 11, 0},
+    {6, 0, 11,  8, 4194, 11, 0},
+    {6, 0, 11,  8, 4194, 11, 0},
+    {6, 0, 11,  8, 4194, 11, 0},
+    {6, 0, 11,  8, 4194, 11, 0},
+    {6, 0, 11,  8, 4194, 11, 0},
+    {6, 0, 11,  8, 4194, 11, 0},
+    {6, 0, 11,  8, 4194, 11, 0},
+    {6, 0, 11,  7, 4194, 11, 0},
+    {6, 0, 11,  7, 4194, 11, 0},
+    {6, 0, 11,  7, 4194, 11, 0},
+    {6, 0, 11,  7, 4194, 11, 0},
+    {6, 0, 11,  7, 4194, 11, 0},
+    {6, 0, 11,  7, 4194, 11, 0},
+    {6, 0, 11,  7, 4194, 11, 0},
+    {6, 0, 11,  6, 4194, 11, 0},
+    {6, 0, 11,  6, 4194, 11, 0},
+    {6, 0, 11,  6, 4194, 11, 0},
+    {6, 0, 11,  6, 4194, 11, 0},
+    {6, 0, 11,  6, 4194, 11, 0},
+    {6, 0, 11,  6, 4194, 11, 0},
+    {6, 0, 11,  5, 4194, 11, 0},
+    {6, 0, 11,  5, 4194, 11, 0},
+    {6, 0, 11,  5, 4194, 11, 0},
+    {6, 0, 11,  5, 4194, 11, 0},
+    {6, 0, 11,  5, 4194, 11, 0},
+    {6, 0, 11,  4, 4194, 11, 0},
+    {6, 0, 11,  4, 4194, 11, 0},
+    {6, 0, 11,  4, 4194, 11, 0},
+    {6, 0, 11,  4, 4194, 11, 0},
+    {6, 0, 11,  3, 4194, 11, 0},
+    {6, 0, 11,  3, 4194, 11, 0},
+    {6, 0, 11,  3, 4194, 11, 0},
+    {6, 0, 11,  2, 4194, 11, 0},
+    {6, 0, 11,  2, 4194, 11, 0},
+    {6, 0, 11,  1, 4194, 11, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 12, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10, 11, 4206, 12, 0},
+    {6, 0, 10,  9, 4206, 12, 0},
+    {6, 0, 10,  9, 4206, 12, 0},
+    {6, 0, 10,  9, 4206, 12, 0},
+    {6, 0, 10,  9, 4206, 12, 0},
+    {6, 0, 10,  9, 4206, 12, 0},
+    {6, 0, 10,  9, 4206, 12, 0},
+    {6, 0, 10,  9, 4206, 12, 0},
+    {6, 0, 10,  9, 4206, 12, 0},
+    {6, 0, 10,  9, 4206, 12, 0},
+    {6, 0, 10,  8, 4206, 12, 0},
+    {6, 0, 10,  8, 4206, 12, 0},
+    {6, 0, 10,  8, 4206, 12, 0},
+    {6, 0, 10,  8, 4206, 12, 0},
+    {6, 0, 10,  8, 4206, 12, 0},
+    {6, 0, 10,  8, 4206, 12, 0},
+    {6, 0, 10,  8, 4206, 12, 0},
+    {6, 0, 10,  8, 4206, 12, 0},
+    {6, 0, 10,  7, 4206, 12, 0},
+    {6, 0, 10,  7, 4206, 12, 0},
+    {6, 0, 10,  7, 4206, 12, 0},
+    {6, 0, 10,  7, 4206, 12, 0},
+    {6, 0, 10,  7, 4206, 12, 0},
+    {6, 0, 10,  7, 4206, 12, 0},
+    {6, 0, 10,  7, 4206, 12, 0},
+    {6, 0, 10,  6, 4206, 12, 0},
+    {6, 0, 10,  6, 4206, 12, 0},
+    {6, 0, 10,  6, 4206, 12, 0},
+    {6, 0, 10,  6, 4206, 12, 0},
+    {6, 0, 10,  6, 4206, 12, 0},
+    {6, 0, 10,  6, 4206, 12, 0},
+    {6, 0, 10,  5, 4206, 12, 0},
+    {6, 0, 10,  5, 4206, 12, 0},
+    {6, 0, 10,  5, 4206, 12, 0},
+    {6, 0, 10,  5, 4206, 12, 0},
+    {6, 0, 10,  5, 4206, 12, 0},
+    {6, 0, 10,  4, 4206, 12, 0},
+    {6, 0, 10,  4, 4206, 12, 0},
+    {6, 0, 10,  4, 4206, 12, 0},
+    {6, 0, 10,  4, 4206, 12, 0},
+    {6, 0, 10,  3, 4206, 12, 0},
+    {6, 0, 10,  3, 4206, 12, 0},
+    {6, 0, 10,  3, 4206, 12, 0},
+    {6, 0, 10,  2, 4206, 12, 0},
+    {6, 0, 10,  2, 4206, 12, 0},
+    {6, 0, 10,  1, 4206, 12, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 12, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 11, 4219, 11, 0},
+    {6, 0,  9, 10, 4219, 11, 0},
+    {6, 0,  9, 10, 4219, 11, 0},
+    {6, 0,  9, 10, 4219, 11, 0},
+    {6, 0,  9, 10, 4219, 11, 0},
+    {6, 0,  9, 10, 4219, 11, 0},
+    {6, 0,  9, 10, 4219, 11, 0},
+    {6, 0,  9, 10, 4219, 11, 0},
+    {6, 0,  9, 10, 4219, 11, 0},
+    {6, 0,  9, 10, 4219, 11, 0},
+    {6, 0,  9,  8, 4219, 11, 0},
+    {6, 0,  9,  8, 4219, 11, 0},
+    {6, 0,  9,  8, 4219, 11, 0},
+    {6, 0,  9,  8, 4219, 11, 0},
+    {6, 0,  9,  8, 4219, 11, 0},
+    {6, 0,  9,  8, 4219, 11, 0},
+    {6, 0,  9,  8, 4219, 11, 0},
+    {6, 0,  9,  8, 4219, 11, 0},
+    {6, 0,  9,  7, 4219, 11, 0},
+    {6, 0,  9,  7, 4219, 11, 0},
+    {6, 0,  9,  7, 4219, 11, 0},
+    {6, 0,  9,  7, 4219, 11, 0},
+    {6, 0,  9,  7, 4219, 11, 0},
+    {6, 0,  9,  7, 4219, 11, 0},
+    {6, 0,  9,  7, 4219, 11, 0},
+    {6, 0,  9,  6, 4219, 11, 0},
+    {6, 0,  9,  6, 4219, 11, 0},
+    {6, 0,  9,  6, 4219, 11, 0},
+    {6, 0,  9,  6, 4219, 11, 0},
+    {6, 0,  9,  6, 4219, 11, 0},
+    {6, 0,  9,  6, 4219, 11, 0},
+    {6, 0,  9,  5, 4219, 11, 0},
+    {6, 0,  9,  5, 4219, 11, 0},
+    {6, 0,  9,  5, 4219, 11, 0},
+    {6, 0,  9,  5, 4219, 11, 0},
+    {6, 0,  9,  5, 4219, 11, 0},
+    {6, 0,  9,  4, 4219, 11, 0},
+    {6, 0,  9,  4, 4219, 11, 0},
+    {6, 0,  9,  4, 4219, 11, 0},
+    {6, 0,  9,  4, 4219, 11, 0},
+    {6, 0,  9,  3, 4219, 11, 0},
+    {6, 0,  9,  3, 4219, 11, 0},
+    {6, 0,  9,  3, 4219, 11, 0},
+    {6, 0,  9,  2, 4219, 11, 0},
+    {6, 0,  9,  2, 4219, 11, 0},
+    {6, 0,  9,  1, 4219, 11, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 12, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 11, 4231, 10, 0},
+    {6, 0,  8, 10, 4231, 10, 0},
+    {6, 0,  8, 10, 4231, 10, 0},
+    {6, 0,  8, 10, 4231, 10, 0},
+    {6, 0,  8, 10, 4231, 10, 0},
+    {6, 0,  8, 10, 4231, 10, 0},
+    {6, 0,  8, 10, 4231, 10, 0},
+    {6, 0,  8, 10, 4231, 10, 0},
+    {6, 0,  8, 10, 4231, 10, 0},
+    {6, 0,  8, 10, 4231, 10, 0},
+    {6, 0,  8,  9, 4231, 10, 0},
+    {6, 0,  8,  9, 4231, 10, 0},
+    {6, 0,  8,  9, 4231, 10, 0},
+    {6, 0,  8,  9, 4231, 10, 0},
+    {6, 0,  8,  9, 4231, 10, 0},
+    {6, 0,  8,  9, 4231, 10, 0},
+    {6, 0,  8,  9, 4231, 10, 0},
+    {6, 0,  8,  9, 4231, 10, 0},
+    {6, 0,  8,  7, 4231, 10, 0},
+    {6, 0,  8,  7, 4231, 10, 0},
+    {6, 0,  8,  7, 4231, 10, 0},
+    {6, 0,  8,  7, 4231, 10, 0},
+    {6, 0,  8,  7, 4231, 10, 0},
+    {6, 0,  8,  7, 4231, 10, 0},
+    {6, 0,  8,  7, 4231, 10, 0},
+    {6, 0,  8,  6, 4231, 10, 0},
+    {6, 0,  8,  6, 4231, 10, 0},
+    {6, 0,  8,  6, 4231, 10, 0},
+    {6, 0,  8,  6, 4231, 10, 0},
+    {6, 0,  8,  6, 4231, 10, 0},
+    {6, 0,  8,  6, 4231, 10, 0},
+    {6, 0,  8,  5, 4231, 10, 0},
+    {6, 0,  8,  5, 4231, 10, 0},
+    {6, 0,  8,  5, 4231, 10, 0},
+    {6, 0,  8,  5, 4231, 10, 0},
+    {6, 0,  8,  5, 4231, 10, 0},
+    {6, 0,  8,  4, 4231, 10, 0},
+    {6, 0,  8,  4, 4231, 10, 0},
+    {6, 0,  8,  4, 4231, 10, 0},
+    {6, 0,  8,  4, 4231, 10, 0},
+    {6, 0,  8,  3, 4231, 10, 0},
+    {6, 0,  8,  3, 4231, 10, 0},
+    {6, 0,  8,  3, 4231, 10, 0},
+    {6, 0,  8,  2, 4231, 10, 0},
+    {6, 0,  8,  2, 4231, 10, 0},
+    {6, 0,  8,  1, 4231, 10, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 12, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 11, 4242, 11, 0},
+    {6, 0,  7, 10, 4242, 11, 0},
+    {6, 0,  7, 10, 4242, 11, 0},
+    {6, 0,  7, 10, 4242, 11, 0},
+    {6, 0,  7, 10, 4242, 11, 0},
+    {6, 0,  7, 10, 4242, 11, 0},
+    {6, 0,  7, 10, 4242, 11, 0},
+    {6, 0,  7, 10, 4242, 11, 0},
+    {6, 0,  7, 10, 4242, 11, 0},
+    {6, 0,  7, 10, 4242, 11, 0},
+    {6, 0,  7,  9, 4242, 11, 0},
+    {6, 0,  7,  9, 4242, 11, 0},
+    {6, 0,  7,  9, 4242, 11, 0},
+    {6, 0,  7,  9, 4242, 11, 0},
+    {6, 0,  7,  9, 4242, 11, 0},
+    {6, 0,  7,  9, 4242, 11, 0},
+    {6, 0,  7,  9, 4242, 11, 0},
+    {6, 0,  7,  9, 4242, 11, 0},
+    {6, 0,  7,  8, 4242, 11, 0},
+    {6, 0,  7,  8, 4242, 11, 0},
+    {6, 0,  7,  8, 4242, 11, 0},
+    {6, 0,  7,  8, 4242, 11, 0},
+    {6, 0,  7,  8, 4242, 11, 0},
+    {6, 0,  7,  8, 4242, 11, 0},
+    {6, 0,  7,  8, 4242, 11, 0},
+    {6, 0,  7,  6, 4242, 11, 0},
+    {6, 0,  7,  6, 4242, 11, 0},
+    {6, 0,  7,  6, 4242, 11, 0},
+    {6, 0,  7,  6, 4242, 11, 0},
+    {6, 0,  7,  6, 4242, 11, 0},
+    {6, 0,  7,  6, 4242, 11, 0},
+    {6, 0,  7,  5, 4242, 11, 0},
+    {6, 0,  7,  5, 4242, 11, 0},
+    {6, 0,  7,  5, 4242, 11, 0},
+    {6, 0,  7,  5, 4242, 11, 0},
+    {6, 0,  7,  5, 4242, 11, 0},
+    {6, 0,  7,  4, 4242, 11, 0},
+    {6, 0,  7,  4, 4242, 11, 0},
+    {6, 0,  7,  4, 4242, 11, 0},
+    {6, 0,  7,  4, 4242, 11, 0},
+    {6, 0,  7,  3, 4242, 11, 0},
+    {6, 0,  7,  3, 4242, 11, 0},
+    {6, 0,  7,  3, 4242, 11, 0},
+    {6, 0,  7,  2, 4242, 11, 0},
+    {6, 0,  7,  2, 4242, 11, 0},
+    {6, 0,  7,  1, 4242, 11, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 12, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 11, 4254, 12, 0},
+    {6, 0,  6, 10, 4254, 12, 0},
+    {6, 0,  6, 10, 4254, 12, 0},
+    {6, 0,  6, 10, 4254, 12, 0},
+    {6, 0,  6, 10, 4254, 12, 0},
+    {6, 0,  6, 10, 4254, 12, 0},
+    {6, 0,  6, 10, 4254, 12, 0},
+    {6, 0,  6, 10, 4254, 12, 0},
+    {6, 0,  6, 10, 4254, 12, 0},
+    {6, 0,  6, 10, 4254, 12, 0},
+    {6, 0,  6,  9, 4254, 12, 0},
+    {6, 0,  6,  9, 4254, 12, 0},
+    {6, 0,  6,  9, 4254, 12, 0},
+    {6, 0,  6,  9, 4254, 12, 0},
+    {6, 0,  6,  9, 4254, 12, 0},
+    {6, 0,  6,  9, 4254, 12, 0},
+    {6, 0,  6,  9, 4254, 12, 0},
+    {6, 0,  6,  9, 4254, 12, 0},
+    {6, 0,  6,  8, 4254, 12, 0},
+    {6, 0,  6,  8, 4254, 12, 0},
+    {6, 0,  6,  8, 4254, 12, 0},
+    {6, 0,  6,  8, 4254, 12, 0},
+    {6, 0,  6,  8, 4254, 12, 0},
+    {6, 0,  6,  8, 4254, 12, 0},
+    {6, 0,  6,  8, 4254, 12, 0},
+    {6, 0,  6,  7, 4254, 12, 0},
+    {6, 0,  6,  7, 4254, 12, 0},
+    {6, 0,  6,  7, 4254, 12, 0},
+    {6, 0,  6,  7, 4254, 12, 0},
+    {6, 0,  6,  7, 4254, 12, 0},
+    {6, 0,  6,  7, 4254, 12, 0},
+    {6, 0,  6,  5, 4254, 12, 0},
+    {6, 0,  6,  5, 4254, 12, 0},
+    {6, 0,  6,  5, 4254, 12, 0},
+    {6, 0,  6,  5, 4254, 12, 0},
+    {6, 0,  6,  5, 4254, 12, 0},
+    {6, 0,  6,  4, 4254, 12, 0},
+    {6, 0,  6,  4, 4254, 12, 0},
+    {6, 0,  6,  4, 4254, 12, 0},
+    {6, 0,  6,  4, 4254, 12, 0},
+    {6, 0,  6,  3, 4254, 12, 0},
+    {6, 0,  6,  3, 4254, 12, 0},
+    {6, 0,  6,  3, 4254, 12, 0},
+    {6, 0,  6,  2, 4254, 12, 0},
+    {6, 0,  6,  2, 4254, 12, 0},
+    {6, 0,  6,  1, 4254, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 12, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 11, 4267, 12, 0},
+    {6, 0,  5, 10, 4267, 12, 0},
+    {6, 0,  5, 10, 4267, 12, 0},
+    {6, 0,  5, 10, 4267, 12, 0},
+    {6, 0,  5, 10, 4267, 12, 0},
+    {6, 0,  5, 10, 4267, 12, 0},
+    {6, 0,  5, 10, 4267, 12, 0},
+    {6, 0,  5, 10, 4267, 12, 0},
+    {6, 0,  5, 10, 4267, 12, 0},
+    {6, 0,  5, 10, 4267, 12, 0},
+    {6, 0,  5,  9, 4267, 12, 0},
+    {6, 0,  5,  9, 4267, 12, 0},
+    {6, 0,  5,  9, 4267, 12, 0},
+    {6, 0,  5,  9, 4267, 12, 0},
+    {6, 0,  5,  9, 4267, 12, 0},
+    {6, 0,  5,  9, 4267, 12, 0},
+    {6, 0,  5,  9, 4267, 12, 0},
+    {6, 0,  5,  9, 4267, 12, 0},
+    {6, 0,  5,  8, 4267, 12, 0},
+    {6, 0,  5,  8, 4267, 12, 0},
+    {6, 0,  5,  8, 4267, 12, 0},
+    {6, 0,  5,  8, 4267, 12, 0},
+    {6, 0,  5,  8, 4267, 12, 0},
+    {6, 0,  5,  8, 4267, 12, 0},
+    {6, 0,  5,  8, 4267, 12, 0},
+    {6, 0,  5,  7, 4267, 12, 0},
+    {6, 0,  5,  7, 4267, 12, 0},
+    {6, 0,  5,  7, 4267, 12, 0},
+    {6, 0,  5,  7, 4267, 12, 0},
+    {6, 0,  5,  7, 4267, 12, 0},
+    {6, 0,  5,  7, 4267, 12, 0},
+    {6, 0,  5,  6, 4267, 12, 0},
+    {6, 0,  5,  6, 4267, 12, 0},
+    {6, 0,  5,  6, 4267, 12, 0},
+    {6, 0,  5,  6, 4267, 12, 0},
+    {6, 0,  5,  6, 4267, 12, 0},
+    {6, 0,  5,  4, 4267, 12, 0},
+    {6, 0,  5,  4, 4267, 12, 0},
+    {6, 0,  5,  4, 4267, 12, 0},
+    {6, 0,  5,  4, 4267, 12, 0},
+    {6, 0,  5,  3, 4267, 12, 0},
+    {6, 0,  5,  3, 4267, 12, 0},
+    {6, 0,  5,  3, 4267, 12, 0},
+    {6, 0,  5,  2, 4267, 12, 0},
+    {6, 0,  5,  2, 4267, 12, 0},
+    {6, 0,  5,  1, 4267, 12, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 12, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 11, 4280, 11, 0},
+    {6, 0,  4, 10, 4280, 11, 0},
+    {6, 0,  4, 10, 4280, 11, 0},
+    {6, 0,  4, 10, 4280, 11, 0},
+    {6, 0,  4, 10, 4280, 11, 0},
+    {6, 0,  4, 10, 4280, 11, 0},
+    {6, 0,  4, 10, 4280, 11, 0},
+    {6, 0,  4, 10, 4280, 11, 0},
+    {6, 0,  4, 10, 4280, 11, 0},
+    {6, 0,  4, 10, 4280, 11, 0},
+    {6, 0,  4,  9, 4280, 11, 0},
+    {6, 0,  4,  9, 4280, 11, 0},
+    {6, 0,  4,  9, 4280, 11, 0},
+    {6, 0,  4,  9, 4280, 11, 0},
+    {6, 0,  4,  9, 4280, 11, 0},
+    {6, 0,  4,  9, 4280, 11, 0},
+    {6, 0,  4,  9, 4280, 11, 0},
+    {6, 0,  4,  9, 4280, 11, 0},
+    {6, 0,  4,  8, 4280, 11, 0},
+    {6, 0,  4,  8, 4280, 11, 0},
+    {6, 0,  4,  8, 4280, 11, 0},
+    {6, 0,  4,  8, 4280, 11, 0},
+    {6, 0,  4,  8, 4280, 11, 0},
+    {6, 0,  4,  8, 4280, 11, 0},
+    {6, 0,  4,  8, 4280, 11, 0},
+    {6, 0,  4,  7, 4280, 11, 0},
+    {6, 0,  4,  7, 4280, 11, 0},
+    {6, 0,  4,  7, 4280, 11, 0},
+    {6, 0,  4,  7, 4280, 11, 0},
+    {6, 0,  4,  7, 4280, 11, 0},
+    {6, 0,  4,  7, 4280, 11, 0},
+    {6, 0,  4,  6, 4280, 11, 0},
+    {6, 0,  4,  6, 4280, 11, 0},
+    {6, 0,  4,  6, 4280, 11, 0},
+    {6, 0,  4,  6, 4280, 11, 0},
+    {6, 0,  4,  6, 4280, 11, 0},
+    {6, 0,  4,  5, 4280, 11, 0},
+    {6, 0,  4,  5, 4280, 11, 0},
+    {6, 0,  4,  5, 4280, 11, 0},
+    {6, 0,  4,  5, 4280, 11, 0},
+    {6, 0,  4,  3, 4280, 11, 0},
+    {6, 0,  4,  3, 4280, 11, 0},
+    {6, 0,  4,  3, 4280, 11, 0},
+    {6, 0,  4,  2, 4280, 11, 0},
+    {6, 0,  4,  2, 4280, 11, 0},
+    {6, 0,  4,  1, 4280, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 12, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 11, 4292, 11, 0},
+    {6, 0,  3, 10, 4292, 11, 0},
+    {6, 0,  3, 10, 4292, 11, 0},
+    {6, 0,  3, 10, 4292, 11, 0},
+    {6, 0,  3, 10, 4292, 11, 0},
+    {6, 0,  3, 10, 4292, 11, 0},
+    {6, 0,  3, 10, 4292, 11, 0},
+    {6, 0,  3, 10, 4292, 11, 0},
+    {6, 0,  3, 10, 4292, 11, 0},
+    {6, 0,  3, 10, 4292, 11, 0},
+    {6, 0,  3,  9, 4292, 11, 0},
+    {6, 0,  3,  9, 4292, 11, 0},
+    {6, 0,  3,  9, 4292, 11, 0},
+    {6, 0,  3,  9, 4292, 11, 0},
+    {6, 0,  3,  9, 4292, 11, 0},
+    {6, 0,  3,  9, 4292, 11, 0},
+    {6, 0,  3,  9, 4292, 11, 0},
+    {6, 0,  3,  9, 4292, 11, 0},
+    {6, 0,  3,  8, 4292, 11, 0},
+    {6, 0,  3,  8, 4292, 11, 0},
+    {6, 0,  3,  8, 4292, 11, 0},
+    {6, 0,  3,  8, 4292, 11, 0},
+    {6, 0,  3,  8, 4292, 11, 0},
+    {6, 0,  3,  8, 4292, 11, 0},
+    {6, 0,  3,  8, 4292, 11, 0},
+    {6, 0,  3,  7, 4292, 11, 0},
+    {6, 0,  3,  7, 4292, 11, 0},
+    {6, 0,  3,  7, 4292, 11, 0},
+    {6, 0,  3,  7, 4292, 11, 0},
+    {6, 0,  3,  7, 4292, 11, 0},
+    {6, 0,  3,  7, 4292, 11, 0},
+    {6, 0,  3,  6, 4292, 11, 0},
+    {6, 0,  3,  6, 4292, 11, 0},
+    {6, 0,  3,  6, 4292, 11, 0},
+    {6, 0,  3,  6, 4292, 11, 0},
+    {6, 0,  3,  6, 4292, 11, 0},
+    {6, 0,  3,  5, 4292, 11, 0},
+    {6, 0,  3,  5, 4292, 11, 0},
+    {6, 0,  3,  5, 4292, 11, 0},
+    {6, 0,  3,  5, 4292, 11, 0},
+    {6, 0,  3,  4, 4292, 11, 0},
+    {6, 0,  3,  4, 4292, 11, 0},
+    {6, 0,  3,  4, 4292, 11, 0},
+    {6, 0,  3,  2, 4292, 11, 0},
+    {6, 0,  3,  2, 4292, 11, 0},
+    {6, 0,  3,  1, 4292, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 12, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 11, 4304, 11, 0},
+    {6, 0,  2, 10, 4304, 11, 0},
+    {6, 0,  2, 10, 4304, 11, 0},
+    {6, 0,  2, 10, 4304, 11, 0},
+    {6, 0,  2, 10, 4304, 11, 0},
+    {6, 0,  2, 10, 4304, 11, 0},
+    {6, 0,  2, 10, 4304, 11, 0},
+    {6, 0,  2, 10, 4304, 11, 0},
+    {6, 0,  2, 10, 4304, 11, 0},
+    {6, 0,  2, 10, 4304, 11, 0},
+    {6, 0,  2,  9, 4304, 11, 0},
+    {6, 0,  2,  9, 4304, 11, 0},
+    {6, 0,  2,  9, 4304, 11, 0},
+    {6, 0,  2,  9, 4304, 11, 0},
+    {6, 0,  2,  9, 4304, 11, 0},
+    {6, 0,  2,  9, 4304, 11, 0},
+    {6, 0,  2,  9, 4304, 11, 0},
+    {6, 0,  2,  9, 4304, 11, 0},
+    {6, 0,  2,  8, 4304, 11, 0},
+    {6, 0,  2,  8, 4304, 11, 0},
+    {6, 0,  2,  8, 4304, 11, 0},
+    {6, 0,  2,  8, 4304, 11, 0},
+    {6, 0,  2,  8, 4304, 11, 0},
+    {6, 0,  2,  8, 4304, 11, 0},
+    {6, 0,  2,  8, 4304, 11, 0},
+    {6, 0,  2,  7, 4304, 11, 0},
+    {6, 0,  2,  7, 4304, 11, 0},
+    {6, 0,  2,  7, 4304, 11, 0},
+    {6, 0,  2,  7, 4304, 11, 0},
+    {6, 0,  2,  7, 4304, 11, 0},
+    {6, 0,  2,  7, 4304, 11, 0},
+    {6, 0,  2,  6, 4304, 11, 0},
+    {6, 0,  2,  6, 4304, 11, 0},
+    {6, 0,  2,  6, 4304, 11, 0},
+    {6, 0,  2,  6, 4304, 11, 0},
+    {6, 0,  2,  6, 4304, 11, 0},
+    {6, 0,  2,  5, 4304, 11, 0},
+    {6, 0,  2,  5, 4304, 11, 0},
+    {6, 0,  2,  5, 4304, 11, 0},
+    {6, 0,  2,  5, 4304, 11, 0},
+    {6, 0,  2,  4, 4304, 11, 0},
+    {6, 0,  2,  4, 4304, 11, 0},
+    {6, 0,  2,  4, 4304, 11, 0},
+    {6, 0,  2,  3, 4304, 11, 0},
+    {6, 0,  2,  3, 4304, 11, 0},
+    {6, 0,  2,  1, 4304, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 12, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 11, 4316, 11, 0},
+    {6, 0,  1, 10, 4316, 11, 0},
+    {6, 0,  1, 10, 4316, 11, 0},
+    {6, 0,  1, 10, 4316, 11, 0},
+    {6, 0,  1, 10, 4316, 11, 0},
+    {6, 0,  1, 10, 4316, 11, 0},
+    {6, 0,  1, 10, 4316, 11, 0},
+    {6, 0,  1, 10, 4316, 11, 0},
+    {6, 0,  1, 10, 4316, 11, 0},
+    {6, 0,  1, 10, 4316, 11, 0},
+    {6, 0,  1,  9, 4316, 11, 0},
+    {6, 0,  1,  9, 4316, 11, 0},
+    {6, 0,  1,  9, 4316, 11, 0},
+    {6, 0,  1,  9, 4316, 11, 0},
+    {6, 0,  1,  9, 4316, 11, 0},
+    {6, 0,  1,  9, 4316, 11, 0},
+    {6, 0,  1,  9, 4316, 11, 0},
+    {6, 0,  1,  9, 4316, 11, 0},
+    {6, 0,  1,  8, 4316, 11, 0},
+    {6, 0,  1,  8, 4316, 11, 0},
+    {6, 0,  1,  8, 4316, 11, 0},
+    {6, 0,  1,  8, 4316, 11, 0},
+    {6, 0,  1,  8, 4316, 11, 0},
+    {6, 0,  1,  8, 4316, 11, 0},
+    {6, 0,  1,  8, 4316, 11, 0},
+    {6, 0,  1,  7, 4316, 11, 0},
+    {6, 0,  1,  7, 4316, 11, 0},
+    {6, 0,  1,  7, 4316, 11, 0},
+    {6, 0,  1,  7, 4316, 11, 0},
+    {6, 0,  1,  7, 4316, 11, 0},
+    {6, 0,  1,  7, 4316, 11, 0},
+    {6, 0,  1,  6, 4316, 11, 0},
+    {6, 0,  1,  6, 4316, 11, 0},
+    {6, 0,  1,  6, 4316, 11, 0},
+    {6, 0,  1,  6, 4316, 11, 0},
+    {6, 0,  1,  6, 4316, 11, 0},
+    {6, 0,  1,  5, 4316, 11, 0},
+    {6, 0,  1,  5, 4316, 11, 0},
+    {6, 0,  1,  5, 4316, 11, 0},
+    {6, 0,  1,  5, 4316, 11, 0},
+    {6, 0,  1,  4, 4316, 11, 0},
+    {6, 0,  1,  4, 4316, 11, 0},
+    {6, 0,  1,  4, 4316, 11, 0},
+    {6, 0,  1,  3, 4316, 11, 0},
+    {6, 0,  1,  3, 4316, 11, 0},
+    {6, 0,  1,  2, 4316, 11, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 12, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 11, 4328, 12, 0},
+    {6, 0,  0, 10, 4328, 12, 0},
+    {6, 0,  0, 10, 4328, 12, 0},
+    {6, 0,  0, 10, 4328, 12, 0},
+    {6, 0,  0, 10, 4328, 12, 0},
+    {6, 0,  0, 10, 4328, 12, 0},
+    {6, 0,  0, 10, 4328, 12, 0},
+    {6, 0,  0, 10, 4328, 12, 0},
+    {6, 0,  0, 10, 4328, 12, 0},
+    {6, 0,  0, 10, 4328, 12, 0},
+    {6, 0,  0,  9, 4328, 12, 0},
+    {6, 0,  0,  9, 4328, 12, 0},
+    {6, 0,  0,  9, 4328, 12, 0},
+    {6, 0,  0,  9, 4328, 12, 0},
+    {6, 0,  0,  9, 4328, 12, 0},
+    {6, 0,  0,  9, 4328, 12, 0},
+    {6, 0,  0,  9, 4328, 12, 0},
+    {6, 0,  0,  9, 4328, 12, 0},
+    {6, 0,  0,  8, 4328, 12, 0},
+    {6, 0,  0,  8, 4328, 12, 0},
+    {6, 0,  0,  8, 4328, 12, 0},
+    {6, 0,  0,  8, 4328, 12, 0},
+    {6, 0,  0,  8, 4328, 12, 0},
+    {6, 0,  0,  8, 4328, 12, 0},
+    {6, 0,  0,  8, 4328, 12, 0},
+    {6, 0,  0,  7, 4328, 12, 0},
+    {6, 0,  0,  7, 4328, 12, 0},
+    {6, 0,  0,  7, 4328, 12, 0},
+    {6, 0,  0,  7, 4328, 12, 0},
+    {6, 0,  0,  7, 4328, 12, 0},
+    {6, 0,  0,  7, 4328, 12, 0},
+    {6, 0,  0,  6, 4328, 12, 0},
+    {6, 0,  0,  6, 4328, 12, 0},
+    {6, 0,  0,  6, 4328, 12, 0},
+    {6, 0,  0,  6, 4328, 12, 0},
+    {6, 0,  0,  6, 4328, 12, 0},
+    {6, 0,  0,  5, 4328, 12, 0},
+    {6, 0,  0,  5, 4328, 12, 0},
+    {6, 0,  0,  5, 4328, 12, 0},
+    {6, 0,  0,  5, 4328, 12, 0},
+    {6, 0,  0,  4, 4328, 12, 0},
+    {6, 0,  0,  4, 4328, 12, 0},
+    {6, 0,  0,  4, 4328, 12, 0},
+    {6, 0,  0,  3, 4328, 12, 0},
+    {6, 0,  0,  3, 4328, 12, 0},
+    {6, 0,  0,  2, 4328, 12, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 11, 4341, 14, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12, 10, 4356, 15, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  9, 4372, 14, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  8, 4387, 13, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  7, 4401, 14, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  6, 4416, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  5, 4432, 15, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  4, 4448, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  3, 4463, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  2, 4478, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  1, 4493, 14, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 12,  0, 4508, 15, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11, 10, 4524, 16, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  9, 4541, 15, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  8, 4557, 14, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  7, 4572, 15, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  6, 4588, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  5, 4605, 16, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  4, 4622, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  3, 4638, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  2, 4654, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  1, 4670, 15, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 11,  0, 4686, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  9, 4703, 16, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  8, 4720, 15, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  7, 4736, 16, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  6, 4753, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  5, 4771, 17, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  4, 4789, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  3, 4806, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  2, 4823, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  1, 4840, 16, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0, 10,  0, 4857, 17, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  8, 4875, 14, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  7, 4890, 15, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  6, 4906, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  5, 4923, 16, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  4, 4940, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  3, 4956, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  2, 4972, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  1, 4988, 15, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  9,  0, 5004, 16, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  7, 5021, 14, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  6, 5036, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  5, 5052, 15, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  4, 5068, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  3, 5083, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  2, 5098, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  1, 5113, 14, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  8,  0, 5128, 15, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  6, 5144, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  5, 5161, 16, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  4, 5178, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  3, 5194, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  2, 5210, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  1, 5226, 15, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  7,  0, 5242, 16, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  5, 5259, 17, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  4, 5277, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  3, 5294, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  2, 5311, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  1, 5328, 16, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  6,  0, 5345, 17, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  4, 5363, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  3, 5380, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  2, 5397, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  1, 5414, 16, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  5,  0, 5431, 17, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  3, 5449, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  2, 5465, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  1, 5481, 15, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  4,  0, 5497, 16, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  2, 5514, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  1, 5530, 15, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  3,  0, 5546, 16, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  1, 5563, 15, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  2,  0, 5579, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {7, 0,  1,  0, 5596, 16, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 11, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12, 10, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  9, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  8, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  7, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  6, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  5, 5613, 12, 0},
+    {8, 0, 12,  4, 5613, 12, 0},
+    {8, 0, 12,  4, 5613, 12, 0},
+    {8, 0, 12,  4, 5613, 12, 0},
+    {8, 0, 12,  4, 5613, 12, 0},
+    {8, 0, 12,  4, 5613, 12, 0},
+    {8, 0, 12,  4, 5613, 12, 0},
+    {8, 0, 12,  3, 5613, 12, 0},
+    {8, 0, 12,  3, 5613, 12, 0},
+    {8, 0, 12,  3, 5613, 12, 0},
+    {8, 0, 12,  2, 5613, 12, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 12, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11, 10, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  9, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  8, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  7, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  6, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  5, 5626, 13, 0},
+    {8, 0, 11,  4, 5626, 13, 0},
+    {8, 0, 11,  4, 5626, 13, 0},
+    {8, 0, 11,  4, 5626, 13, 0},
+    {8, 0, 11,  4, 5626, 13, 0},
+    {8, 0, 11,  4, 5626, 13, 0},
+    {8, 0, 11,  4, 5626, 13, 0},
+    {8, 0, 11,  3, 5626, 13, 0},
+    {8, 0, 11,  3, 5626, 13, 0},
+    {8, 0, 11,  3, 5626, 13, 0},
+    {8, 0, 11,  2, 5626, 13, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 12, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10, 11, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  9, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  8, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  7, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  6, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  5, 5640, 14, 0},
+    {8, 0, 10,  4, 5640, 14, 0},
+    {8, 0, 10,  4, 5640, 14, 0},
+    {8, 0, 10,  4, 5640, 14, 0},
+    {8, 0, 10,  4, 5640, 14, 0},
+    {8, 0, 10,  4, 5640, 14, 0},
+    {8, 0, 10,  4, 5640, 14, 0},
+    {8, 0, 10,  3, 5640, 14, 0},
+    {8, 0, 10,  3, 5640, 14, 0},
+    {8, 0, 10,  3, 5640, 14, 0},
+    {8, 0, 10,  2, 5640, 14, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 12, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 11, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9, 10, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  8, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  7, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  6, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  5, 5655, 13, 0},
+    {8, 0,  9,  4, 5655, 13, 0},
+    {8, 0,  9,  4, 5655, 13, 0},
+    {8, 0,  9,  4, 5655, 13, 0},
+    {8, 0,  9,  4, 5655, 13, 0},
+    {8, 0,  9,  4, 5655, 13, 0},
+    {8, 0,  9,  4, 5655, 13, 0},
+    {8, 0,  9,  3, 5655, 13, 0},
+    {8, 0,  9,  3, 5655, 13, 0},
+    {8, 0,  9,  3, 5655, 13, 0},
+    {8, 0,  9,  2, 5655, 13, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 12, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 11, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8, 10, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  9, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  7, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  6, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  5, 5669, 12, 0},
+    {8, 0,  8,  4, 5669, 12, 0},
+    {8, 0,  8,  4, 5669, 12, 0},
+    {8, 0,  8,  4, 5669, 12, 0},
+    {8, 0,  8,  4, 5669, 12, 0},
+    {8, 0,  8,  4, 5669, 12, 0},
+    {8, 0,  8,  4, 5669, 12, 0},
+    {8, 0,  8,  3, 5669, 12, 0},
+    {8, 0,  8,  3, 5669, 12, 0},
+    {8, 0,  8,  3, 5669, 12, 0},
+    {8, 0,  8,  2, 5669, 12, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 12, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 11, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7, 10, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  9, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  8, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  6, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  5, 5682, 13, 0},
+    {8, 0,  7,  4, 5682, 13, 0},
+    {8, 0,  7,  4, 5682, 13, 0},
+    {8, 0,  7,  4, 5682, 13, 0},
+    {8, 0,  7,  4, 5682, 13, 0},
+    {8, 0,  7,  4, 5682, 13, 0},
+    {8, 0,  7,  4, 5682, 13, 0},
+    {8, 0,  7,  3, 5682, 13, 0},
+    {8, 0,  7,  3, 5682, 13, 0},
+    {8, 0,  7,  3, 5682, 13, 0},
+    {8, 0,  7,  2, 5682, 13, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 12, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 11, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6, 10, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  9, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  8, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  7, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  5, 5696, 14, 0},
+    {8, 0,  6,  4, 5696, 14, 0},
+    {8, 0,  6,  4, 5696, 14, 0},
+    {8, 0,  6,  4, 5696, 14, 0},
+    {8, 0,  6,  4, 5696, 14, 0},
+    {8, 0,  6,  4, 5696, 14, 0},
+    {8, 0,  6,  4, 5696, 14, 0},
+    {8, 0,  6,  3, 5696, 14, 0},
+    {8, 0,  6,  3, 5696, 14, 0},
+    {8, 0,  6,  3, 5696, 14, 0},
+    {8, 0,  6,  2, 5696, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 12, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 11, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5, 10, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  9, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  8, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  7, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  6, 5711, 14, 0},
+    {8, 0,  5,  4, 5711, 14, 0},
+    {8, 0,  5,  4, 5711, 14, 0},
+    {8, 0,  5,  4, 5711, 14, 0},
+    {8, 0,  5,  4, 5711, 14, 0},
+    {8, 0,  5,  4, 5711, 14, 0},
+    {8, 0,  5,  4, 5711, 14, 0},
+    {8, 0,  5,  3, 5711, 14, 0},
+    {8, 0,  5,  3, 5711, 14, 0},
+    {8, 0,  5,  3, 5711, 14, 0},
+    {8, 0,  5,  2, 5711, 14, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 12, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 11, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4, 10, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  9, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  8, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  7, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  6, 5726, 13, 0},
+    {8, 0,  4,  5, 5726, 13, 0},
+    {8, 0,  4,  5, 5726, 13, 0},
+    {8, 0,  4,  5, 5726, 13, 0},
+    {8, 0,  4,  5, 5726, 13, 0},
+    {8, 0,  4,  5, 5726, 13, 0},
+    {8, 0,  4,  5, 5726, 13, 0},
+    {8, 0,  4,  3, 5726, 13, 0},
+    {8, 0,  4,  3, 5726, 13, 0},
+    {8, 0,  4,  3, 5726, 13, 0},
+    {8, 0,  4,  2, 5726, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 12, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 11, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3, 10, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  9, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  8, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  7, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  6, 5740, 13, 0},
+    {8, 0,  3,  5, 5740, 13, 0},
+    {8, 0,  3,  5, 5740, 13, 0},
+    {8, 0,  3,  5, 5740, 13, 0},
+    {8, 0,  3,  5, 5740, 13, 0},
+    {8, 0,  3,  5, 5740, 13, 0},
+    {8, 0,  3,  5, 5740, 13, 0},
+    {8, 0,  3,  4, 5740, 13, 0},
+    {8, 0,  3,  4, 5740, 13, 0},
+    {8, 0,  3,  4, 5740, 13, 0},
+    {8, 0,  3,  2, 5740, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 12, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 11, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2, 10, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  9, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  8, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  7, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  6, 5754, 13, 0},
+    {8, 0,  2,  5, 5754, 13, 0},
+    {8, 0,  2,  5, 5754, 13, 0},
+    {8, 0,  2,  5, 5754, 13, 0},
+    {8, 0,  2,  5, 5754, 13, 0},
+    {8, 0,  2,  5, 5754, 13, 0},
+    {8, 0,  2,  5, 5754, 13, 0},
+    {8, 0,  2,  4, 5754, 13, 0},
+    {8, 0,  2,  4, 5754, 13, 0},
+    {8, 0,  2,  4, 5754, 13, 0},
+    {8, 0,  2,  3, 5754, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 12, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 11, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1, 10, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  9, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  8, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  7, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  6, 5768, 13, 0},
+    {8, 0,  1,  5, 5768, 13, 0},
+    {8, 0,  1,  5, 5768, 13, 0},
+    {8, 0,  1,  5, 5768, 13, 0},
+    {8, 0,  1,  5, 5768, 13, 0},
+    {8, 0,  1,  5, 5768, 13, 0},
+    {8, 0,  1,  5, 5768, 13, 0},
+    {8, 0,  1,  4, 5768, 13, 0},
+    {8, 0,  1,  4, 5768, 13, 0},
+    {8, 0,  1,  4, 5768, 13, 0},
+    {8, 0,  1,  3, 5768, 13, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 12, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 11, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0, 10, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  9, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  8, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  7, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  6, 5782, 14, 0},
+    {8, 0,  0,  5, 5782, 14, 0},
+    {8, 0,  0,  5, 5782, 14, 0},
+    {8, 0,  0,  5, 5782, 14, 0},
+    {8, 0,  0,  5, 5782, 14, 0},
+    {8, 0,  0,  5, 5782, 14, 0},
+    {8, 0,  0,  5, 5782, 14, 0},
+    {8, 0,  0,  4, 5782, 14, 0},
+    {8, 0,  0,  4, 5782, 14, 0},
+    {8, 0,  0,  4, 5782, 14, 0},
+    {8, 0,  0,  3, 5782, 14, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 11, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12, 10, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  9, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  8, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  7, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  6, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  5, 5797,  8, 0},
+    {9, 0, 12,  4, 5797,  8, 0},
+    {9, 0, 12,  4, 5797,  8, 0},
+    {9, 0, 12,  4, 5797,  8, 0},
+    {9, 0, 12,  4, 5797,  8, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11, 10, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  9, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  8, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  7, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  6, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  5, 5806,  9, 0},
+    {9, 0, 11,  4, 5806,  9, 0},
+    {9, 0, 11,  4, 5806,  9, 0},
+    {9, 0, 11,  4, 5806,  9, 0},
+    {9, 0, 11,  4, 5806,  9, 0},
+    {9, 0, 11,  3, 5806,  9, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  9, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  8, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  7, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  6, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  5, 5816, 10, 0},
+    {9, 0, 10,  4, 5816, 10, 0},
+    {9, 0, 10,  4, 5816, 10, 0},
+    {9, 0, 10,  4, 5816, 10, 0},
+    {9, 0, 10,  4, 5816, 10, 0},
+    {9, 0, 10,  3, 5816, 10, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  8, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  7, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  6, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  5, 5827,  9, 0},
+    {9, 0,  9,  4, 5827,  9, 0},
+    {9, 0,  9,  4, 5827,  9, 0},
+    {9, 0,  9,  4, 5827,  9, 0},
+    {9, 0,  9,  4, 5827,  9, 0},
+    {9, 0,  9,  3, 5827,  9, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  7, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  6, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  5, 5837,  8, 0},
+    {9, 0,  8,  4, 5837,  8, 0},
+    {9, 0,  8,  4, 5837,  8, 0},
+    {9, 0,  8,  4, 5837,  8, 0},
+    {9, 0,  8,  4, 5837,  8, 0},
+    {9, 0,  8,  3, 5837,  8, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  6, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  5, 5846,  9, 0},
+    {9, 0,  7,  4, 5846,  9, 0},
+    {9, 0,  7,  4, 5846,  9, 0},
+    {9, 0,  7,  4, 5846,  9, 0},
+    {9, 0,  7,  4, 5846,  9, 0},
+    {9, 0,  7,  3, 5846,  9, 0},
+    {9, 0,  6,  5, 5856, 10, 0},
+    {9, 0,  6,  5, 5856, 10, 0},
+    {9, 0,  6,  5, 5856, 10, 0},
+    {9, 0,  6,  5, 5856, 10, 0},
+    {9, 0,  6,  5, 5856, 10, 0},
+    {9, 0,  6,  5, 5856, 10, 0},
+    {9, 0,  6,  5, 5856, 10, 0},
+    {9, 0,  6,  5, 5856, 10, 0},
+    {9, 0,  6,  5, 5856, 10, 0},
+    {9, 0,  6,  4, 5856, 10, 0},
+    {9, 0,  6,  4, 5856, 10, 0},
+    {9, 0,  6,  4, 5856, 10, 0},
+    {9, 0,  6,  4, 5856, 10, 0},
+    {9, 0,  6,  3, 5856, 10, 0},
+    {9, 0,  5,  4, 5867, 10, 0},
+    {9, 0,  5,  4, 5867, 10, 0},
+    {9, 0,  5,  4, 5867, 10, 0},
+    {9, 0,  5,  3, 5867, 10, 0},
+};
@@ -3,6 +3,7 @@
 #include <stdio.h>
 
 #include "../../database/tables/tables.h"
+#include "../../evaluation/core/probes.h"
 
 int hash_quinary(const unsigned char q[], int k) {
 int sum = 0;
@@ -19,5 +20,8 @@ for (i = 0; i < len; i++) {
     }
 }
 
+PHEVAL_STATS_QUINARY_DEPTH(i < len ? i + 1 : len);
+PHEVAL_PROBE_QUINARY_DEPTH(i < len ? i + 1 : len);
+
 return sum;
 }
\ No newline at end of file
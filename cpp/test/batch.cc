@@ -0,0 +1,90 @@
+#include <phevaluator/batch.h>
+#include <phevaluator/card_sampler.h>
+#include <phevaluator/numa.h>
+#include <phevaluator/phevaluator.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+static card_sampler::CardSampler cs(38);
+
+// n hands of `cards` cards each, padded to `stride` bytes with 0xff
+static std::vector<uint8_t> RandomHands(size_t n, int cards, size_t stride) {
+  std::vector<uint8_t> hands(n * stride, 0xff);
+  int ids[52];
+  for (size_t i = 0; i < n; i++) {
+    cs.sample_into(ids, cards);
+    for (int k = 0; k < cards; k++) hands[i * stride + k] = ids[k];
+  }
+  return hands;
+}
+
+TEST(BatchTest, TestMatchesSingleHands) {
+  const size_t n = 1000;
+  std::vector<int16_t> out(n);
+
+  std::vector<uint8_t> h = RandomHands(n, 5, 5);
+  EXPECT_EQ(evaluate_5cards_batch(h.data(), n, 0, out.data()), 0u);
+  for (size_t i = 0; i < n; i++) {
+    const uint8_t* c = &h[i * 5];
+    ASSERT_EQ(out[i], evaluate_5cards(c[0], c[1], c[2], c[3], c[4]));
+  }
+
+  h = RandomHands(n, 6, 6);
+  EXPECT_EQ(evaluate_6cards_batch(h.data(), n, 6, out.data()), 0u);
+  for (size_t i = 0; i < n; i++) {
+    const uint8_t* c = &h[i * 6];
+    ASSERT_EQ(out[i], evaluate_6cards(c[0], c[1], c[2], c[3], c[4], c[5]));
+  }
+
+  // Hands inside 16-byte records
+  h = RandomHands(n, 7, 16);
+  EXPECT_EQ(evaluate_7cards_batch(h.data(), n, 16, out.data()), 0u);
+  for (size_t i = 0; i < n; i++) {
+    const uint8_t* c = &h[i * 16];
+    ASSERT_EQ(out[i],
+              evaluate_7cards(c[0], c[1], c[2], c[3], c[4], c[5], c[6]));
+  }
+}
+
+TEST(BatchTest, TestInvalidHands) {
+  uint8_t hands[3][5] = {{0, 1, 2, 3, 4}, {0, 1, 2, 3, 52}, {9, 1, 2, 9, 4}};
+  int16_t out[3];
+  EXPECT_EQ(evaluate_5cards_batch(&hands[0][0], 3, 0, out), 2u);
+  EXPECT_EQ(out[0], evaluate_5cards(0, 1, 2, 3, 4));
+  EXPECT_EQ(out[1], PHEVAL_INVALID_HAND);
+  EXPECT_EQ(out[2], PHEVAL_INVALID_HAND);
+}
+
+TEST(BatchTest, TestContext) {
+  EXPECT_EQ(pheval_context_create(nullptr), nullptr);
+
+  pheval_context* context = pheval_context_create(&pheval_engine_7cards);
+  ASSERT_NE(context, nullptr);
+  EXPECT_EQ(pheval_context_cards(context), 7);
+
+  const size_t n = 500;
+  std::vector<uint8_t> h = RandomHands(n, 7, 7);
+  h[7 * 10] = 60;
+  std::vector<int16_t> out(n), expected(n);
+  evaluate_7cards_batch(h.data(), n, 0, expected.data());
+
+  EXPECT_EQ(pheval_context_evaluate(context, h.data(), n, 0, out.data()), 1u);
+  EXPECT_EQ(out, expected);
+  EXPECT_EQ(pheval_context_hands(context), n);
+  EXPECT_EQ(pheval_context_invalid_hands(context), 1u);
+
+  // Choosing a replica doesn't create the copies, which would fix their
+  // count for the rest of the process; NumaTest covers evaluating on one
+  const int replicas = pheval_numa_replicas();
+  EXPECT_EQ(pheval_context_set_numa_replica(context, 0),
+            pheval_numa_enabled() ? 0 : -1);
+  EXPECT_EQ(pheval_numa_replicas(), replicas);
+  EXPECT_EQ(pheval_context_set_numa_replica(context, -1), -1);
+  EXPECT_EQ(pheval_context_set_numa_replica(context, 1000), -1);
+
+  pheval_context_destroy(context);
+  pheval_context_destroy(nullptr);
+}
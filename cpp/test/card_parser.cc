@@ -0,0 +1,114 @@
+#include <phevaluator/card.h>
+#include <phevaluator/card_sampler.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+static card_sampler::CardSampler cs{};
+
+TEST(CardParserTest, TestLookupTables) {
+  static_assert(CardIdOf('2', 'c') == 0);
+  static_assert(CardIdOf('A', 's') == 51);
+  static_assert(CardIdOf('T', 'H') == 34);
+  static_assert(CardIdOf('a', 's') == -1);
+  static_assert(CardIdOf('A', 'x') == -1);
+
+  for (int id = 0; id < 52; id++) {
+    const std::string name = Card(id).describeCard();
+    EXPECT_EQ(CardIdOf(name[0], name[1]), id);
+    EXPECT_EQ(static_cast<int>(Card(name)), id);
+    EXPECT_EQ(static_cast<int>(Card(name.c_str())), id);
+  }
+}
+
+TEST(CardParserTest, TestCardConstructorErrors) {
+  EXPECT_THROW(Card("1s"), std::invalid_argument);
+  EXPECT_THROW(Card("Ax"), std::invalid_argument);
+  EXPECT_THROW(Card("A"), std::invalid_argument);
+  EXPECT_THROW(Card(""), std::invalid_argument);
+  EXPECT_THROW(Card(std::string("K")), std::invalid_argument);
+}
+
+TEST(CardParserTest, TestParseSeparators) {
+  int cards[7];
+  const ParseResult result = ParseHand(" As, Kd\tQh  2C\n", cards, 7);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result.count, 4);
+  EXPECT_EQ(cards[0], Card("As"));
+  EXPECT_EQ(cards[1], Card("Kd"));
+  EXPECT_EQ(cards[2], Card("Qh"));
+  EXPECT_EQ(cards[3], Card("2c"));
+
+  uint64_t mask = ~uint64_t(0);
+  ASSERT_TRUE(ParseHand("AsKd", mask));
+  EXPECT_EQ(mask, (uint64_t(1) << 51) | (uint64_t(1) << 45));
+}
+
+TEST(CardParserTest, TestParseErrors) {
+  int cards[3];
+  ParseResult result = ParseHand("AsKdXh", cards, 3);
+  EXPECT_EQ(result.status, ParseStatus::kInvalidRank);
+  EXPECT_EQ(result.count, 2);
+  EXPECT_EQ(result.position, 4u);
+
+  result = ParseHand("As Kx", cards, 3);
+  EXPECT_EQ(result.status, ParseStatus::kInvalidSuit);
+  EXPECT_EQ(result.position, 4u);
+
+  result = ParseHand("AsK", cards, 3);
+  EXPECT_EQ(result.status, ParseStatus::kMissingSuit);
+  EXPECT_EQ(result.position, 3u);
+
+  result = ParseHand("AsKdAs", cards, 3);
+  EXPECT_EQ(result.status, ParseStatus::kDuplicate);
+  EXPECT_EQ(result.position, 4u);
+
+  result = ParseHand("AsKdQhJc", cards, 3);
+  EXPECT_EQ(result.status, ParseStatus::kTooManyCards);
+  EXPECT_EQ(result.count, 3);
+  EXPECT_EQ(result.position, 6u);
+}
+
+// Long inputs take the 16-byte path where it is compiled in; the results
+// must match card-by-card construction, including where errors are found.
+TEST(CardParserTest, TestParseLongHands) {
+  for (int i = 0; i < 1000; i++) {
+    const int size = 9 + i % 44;
+    const std::vector<int> sample = cs.sample(size);
+    std::string text;
+    for (int id : sample) text += Card(id).describeCard();
+
+    int cards[52];
+    ParseResult result = ParseHand(text, cards, 52);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result.count, size);
+    for (int k = 0; k < size; k++) EXPECT_EQ(cards[k], sample[k]);
+
+    uint64_t mask;
+    ASSERT_TRUE(ParseHand(text, mask));
+    uint64_t expected = 0;
+    for (int id : sample) expected |= uint64_t(1) << id;
+    EXPECT_EQ(mask, expected);
+
+    // Break one character and check the error lands on it
+    const size_t broken = (i * 7) % text.size();
+    std::string bad = text;
+    bad[broken] = 'x';
+    result = ParseHand(bad, cards, 52);
+    EXPECT_EQ(result.status, broken % 2 == 0 ? ParseStatus::kInvalidRank
+                                             : ParseStatus::kInvalidSuit);
+    EXPECT_EQ(result.position, broken);
+    EXPECT_EQ(result.count, static_cast<int>(broken / 2));
+
+    // Repeat the first card at the end
+    result = ParseHand(text + text.substr(0, 2), cards, 52);
+    EXPECT_EQ(result.status, ParseStatus::kDuplicate);
+    EXPECT_EQ(result.position, text.size());
+  }
+}
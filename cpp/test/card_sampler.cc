@@ -0,0 +1,183 @@
+#include <phevaluator/card_sampler.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using card_sampler::CardSampler;
+using card_sampler::Philox4x32;
+using card_sampler::Xoshiro256;
+
+TEST(CardSamplerTest, TestGeneratorIsDeterministic) {
+  Xoshiro256 a(42), b(42), c(43);
+  bool differs = false;
+  for (int i = 0; i < 100; i++) {
+    const uint64_t x = a();
+    EXPECT_EQ(x, b());
+    differs |= x != c();
+  }
+  EXPECT_TRUE(differs);
+}
+
+TEST(CardSamplerTest, TestBoundedIsUniform) {
+  Xoshiro256 rng(1);
+  const int kDraws = 52 * 20000;
+  std::array<int, 52> counts{};
+  for (int i = 0; i < kDraws; i++) {
+    const uint32_t x = rng.bounded(52);
+    ASSERT_LT(x, 52u);
+    counts[x]++;
+  }
+  // Chi-squared with 51 degrees of freedom; 100 is far in the tail
+  double chi2 = 0;
+  for (int c : counts) chi2 += (c - 20000.0) * (c - 20000.0) / 20000.0;
+  EXPECT_LT(chi2, 100.0);
+}
+
+TEST(CardSamplerTest, TestSampleIntoIsDistinct) {
+  CardSampler cs{};
+  int cards[52];
+  for (int size : {0, 1, 7, 9, 51, 52}) {
+    cs.sample_into(cards, size);
+    uint64_t mask = 0;
+    for (int i = 0; i < size; i++) {
+      ASSERT_GE(cards[i], 0);
+      ASSERT_LT(cards[i], 52);
+      mask |= uint64_t(1) << cards[i];
+    }
+    EXPECT_EQ(__builtin_popcountll(mask), size);
+  }
+  EXPECT_EQ(cs.sample(7).size(), 7u);
+  EXPECT_THROW(cs.sample_into(cards, 53), std::invalid_argument);
+}
+
+TEST(CardSamplerTest, TestDeadCards) {
+  CardSampler cs{};
+  const uint64_t dead = 0x000f00000000f0f1ULL;
+  const int live = 52 - __builtin_popcountll(dead);
+  int cards[52];
+  for (int i = 0; i < 1000; i++) {
+    cs.sample_into(cards, 7, dead);
+    for (int k = 0; k < 7; k++) EXPECT_FALSE((dead >> cards[k]) & 1);
+
+    const uint64_t mask = cs.sample_mask(5, dead);
+    EXPECT_EQ(__builtin_popcountll(mask), 5);
+    EXPECT_EQ(mask & dead, 0u);
+
+    // Switching back to a full deck must forget the dead cards
+    EXPECT_EQ(__builtin_popcountll(cs.sample_mask(52)), 52);
+  }
+  cs.sample_into(cards, live, dead);
+  EXPECT_THROW(cs.sample_into(cards, live + 1, dead), std::invalid_argument);
+}
+
+// Every card should be equally likely at every position.
+TEST(CardSamplerTest, TestSampleIsUniform) {
+  CardSampler cs(3);
+  const int kSamples = 52 * 4000 / 3;
+  std::array<int, 52> counts{};
+  int cards[3];
+  for (int i = 0; i < kSamples; i++) {
+    cs.sample_into(cards, 3);
+    for (int c : cards) counts[c]++;
+  }
+  const double expected = kSamples * 3 / 52.0;
+  double chi2 = 0;
+  for (int c : counts) chi2 += (c - expected) * (c - expected) / expected;
+  EXPECT_LT(chi2, 100.0);
+}
+
+// Samplers in different threads must not share state.
+TEST(CardSamplerTest, TestThreads) {
+  std::vector<std::thread> threads;
+  std::vector<int> failures(8, 0);
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&failures, t] {
+      CardSampler cs{};
+      for (int i = 0; i < 10000; i++) {
+        if (__builtin_popcountll(cs.sample_mask(7)) != 7) failures[t]++;
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  for (int f : failures) EXPECT_EQ(f, 0);
+}
+
+// Known answers from the Random123 distribution
+TEST(CardSamplerTest, TestPhilox) {
+  using Block = std::array<uint32_t, 4>;
+  EXPECT_EQ(Philox4x32({0, 0, 0, 0}, {0, 0}),
+            (Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(Philox4x32({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                       {0xffffffff, 0xffffffff}),
+            (Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(Philox4x32({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                       {0xa4093822, 0x299f31d0}),
+            (Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(CardSamplerTest, TestStreams) {
+  Xoshiro256 a = Xoshiro256::ForStream(7, 3);
+  Xoshiro256 b = Xoshiro256::ForStream(7, 3);
+  Xoshiro256 c = Xoshiro256::ForStream(7, 4);
+  Xoshiro256 d = Xoshiro256::ForStream(8, 3);
+  int same_c = 0, same_d = 0;
+  for (int i = 0; i < 100; i++) {
+    const uint64_t x = a();
+    EXPECT_EQ(x, b());
+    same_c += x == c();
+    same_d += x == d();
+  }
+  EXPECT_EQ(same_c, 0);
+  EXPECT_EQ(same_d, 0);
+
+  // A jumped generator continues somewhere else
+  Xoshiro256 e = Xoshiro256::ForStream(7, 3);
+  Xoshiro256 f = Xoshiro256::ForStream(7, 3);
+  f.jump();
+  EXPECT_NE(e(), f());
+}
+
+TEST(CardSamplerTest, TestReseed) {
+  CardSampler fresh(11, 5);
+  CardSampler reused(1);
+  reused.sample_mask(30, 0xff);
+  reused.reseed(11, 5);
+
+  int a[9], b[9];
+  for (int i = 0; i < 100; i++) {
+    fresh.sample_into(a, 9, i % 2 ? 0 : 0xf);
+    reused.sample_into(b, 9, i % 2 ? 0 : 0xf);
+    for (int k = 0; k < 9; k++) ASSERT_EQ(a[k], b[k]);
+  }
+}
+
+// Work units seeded by their index give the same results whichever thread
+// runs them.
+TEST(CardSamplerTest, TestStreamsAcrossThreads) {
+  const int kUnits = 64;
+  auto run = [](int threads) {
+    std::vector<uint64_t> results(kUnits);
+    std::atomic<int> next{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+      workers.emplace_back([&] {
+        CardSampler cs(2024);
+        for (int unit; (unit = next.fetch_add(1)) < kUnits;) {
+          cs.reseed(2024, unit);
+          uint64_t x = 0;
+          for (int i = 0; i < 100; i++) x = x * 31 + cs.sample_mask(7);
+          results[unit] = x;
+        }
+      });
+    }
+    for (std::thread& worker : workers) worker.join();
+    return results;
+  };
+  EXPECT_EQ(run(1), run(4));
+}
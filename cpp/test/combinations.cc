@@ -0,0 +1,112 @@
+#include <phevaluator/combinations.h>
+#include <phevaluator/parallel.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+TEST(CombinationsTest, TestSizes) {
+  EXPECT_EQ(Combinations(5).size(), 2598960u);
+  EXPECT_EQ(Combinations(7).size(), 133784560u);
+  EXPECT_EQ(Combinations(9).size(), 3679075400u);
+  EXPECT_EQ(Combinations(2, 0xfULL).size(), 1128u);
+  EXPECT_EQ(Combinations(2, 0xfULL).liveCards(), 48);
+
+  EXPECT_THROW(Combinations(0), std::invalid_argument);
+  EXPECT_THROW(Combinations(10), std::invalid_argument);
+  EXPECT_THROW(Combinations(3, (uint64_t(1) << 50) - 1), std::invalid_argument);
+}
+
+TEST(CombinationsTest, TestMatchesNestedLoops) {
+  // The same order as nested loops over increasing ids, innermost first
+  Combinations combinations(3);
+  uint64_t index = 0;
+  for (int c = 2; c < 52; c++) {
+    for (int b = 1; b < c; b++) {
+      for (int a = 0; a < b; a++) {
+        const uint64_t mask =
+            (uint64_t(1) << a) | (uint64_t(1) << b) | (uint64_t(1) << c);
+        ASSERT_EQ(combinations.rank(mask), index);
+        ASSERT_EQ(combinations.unrank(index), mask);
+        index++;
+      }
+    }
+  }
+  EXPECT_EQ(index, combinations.size());
+}
+
+TEST(CombinationsTest, TestDeadCards) {
+  const uint64_t dead = 0x8000000000f1ULL;
+  Combinations combinations(4, dead);
+  uint64_t expected = combinations.unrank(0);
+  uint64_t visited = 0;
+  combinations.forEach([&](uint64_t mask) {
+    ASSERT_EQ(mask, expected);
+    ASSERT_EQ(mask & dead, 0u);
+    ASSERT_EQ(__builtin_popcountll(mask), 4);
+    ASSERT_EQ(combinations.rank(mask), visited);
+    expected = combinations.next(mask);
+    visited++;
+  });
+  EXPECT_EQ(visited, combinations.size());
+  EXPECT_EQ(expected, 0u);
+
+  EXPECT_THROW(combinations.rank(0xf1), std::invalid_argument);
+  EXPECT_THROW(combinations.rank(0x700), std::invalid_argument);
+  EXPECT_THROW(combinations.unrank(combinations.size()), std::out_of_range);
+}
+
+TEST(CombinationsTest, TestUnrankAcrossTheRange) {
+  Combinations combinations(7, 0x3ULL);
+  for (uint64_t index = 0; index < combinations.size(); index += 9973) {
+    const uint64_t mask = combinations.unrank(index);
+    ASSERT_EQ(combinations.rank(mask), index);
+    if (index + 1 < combinations.size()) {
+      ASSERT_EQ(combinations.next(mask), combinations.unrank(index + 1));
+    }
+  }
+  const uint64_t last = combinations.unrank(combinations.size() - 1);
+  EXPECT_EQ(last, uint64_t(0x7f) << 45);
+  EXPECT_EQ(combinations.next(last), 0u);
+}
+
+TEST(CombinationsTest, TestShardsAndResume) {
+  Combinations combinations(5);
+  const uint64_t shards = 7;
+  uint64_t covered = 0;
+  for (uint64_t i = 0; i < shards; i++) {
+    const Combinations::Range range = combinations.shard(i, shards);
+    EXPECT_EQ(range.begin, covered);
+    covered = range.end;
+  }
+  EXPECT_EQ(covered, combinations.size());
+
+  // Sharded across a pool, and stopped and resumed halfway, the sum of
+  // the masks is the same as in one pass
+  uint64_t whole = 0;
+  combinations.forEach([&](uint64_t mask) { whole += mask % 1000003; });
+
+  std::atomic<uint64_t> sharded{0};
+  ThreadPool pool(3);
+  pool.parallelFor(shards, [&](size_t i, int) {
+    const Combinations::Range range = combinations.shard(i, shards);
+    const uint64_t checkpoint = (range.begin + range.end) / 2;
+    uint64_t sum = 0;
+    combinations.forEach(range.begin, checkpoint,
+                         [&](uint64_t mask) { sum += mask % 1000003; });
+    combinations.forEach(checkpoint, range.end,
+                         [&](uint64_t mask) { sum += mask % 1000003; });
+    sharded += sum;
+  });
+  EXPECT_EQ(sharded, whole);
+
+  int cards[Combinations::kMaxCards];
+  EXPECT_EQ(Combinations::Cards(combinations.unrank(0), cards), 5);
+  EXPECT_EQ(cards[0], 0);
+  EXPECT_EQ(cards[4], 4);
+}
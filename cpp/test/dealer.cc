@@ -0,0 +1,164 @@
+#include <phevaluator/dealer.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+using namespace card_sampler;
+
+static int Popcount(uint64_t x) { return __builtin_popcountll(x); }
+
+TEST(DealerTest, TestLayout) {
+  EXPECT_THROW(Dealer(0, 2, 5), std::invalid_argument);
+  EXPECT_THROW(Dealer(11, 2, 5), std::invalid_argument);
+  EXPECT_THROW(Dealer(2, 7, 5), std::invalid_argument);
+  EXPECT_THROW(Dealer(2, 2, 6), std::invalid_argument);
+  EXPECT_THROW(Dealer(10, 5, 5), std::invalid_argument);
+  EXPECT_NO_THROW(Dealer(10, 4, 5));
+
+  Dealer dealer(2, 2, 5);
+  HandRange plo(4);
+  EXPECT_THROW(dealer.setRange(0, plo), std::invalid_argument);
+  EXPECT_THROW(dealer.setRange(2, HandRange(2)), std::invalid_argument);
+  EXPECT_THROW(dealer.setRange(0, HandRange(2)), std::invalid_argument);
+
+  HandRange range(2);
+  const int bad[] = {3, 3};
+  EXPECT_THROW(range.add(bad), std::invalid_argument);
+  const int good[] = {3, 4};
+  EXPECT_THROW(range.add(good, 0), std::invalid_argument);
+}
+
+TEST(DealerTest, TestRandomDeals) {
+  const uint64_t dead = 0xff00000000ffULL;
+  Dealer dealer(9, 2, 5, 1);
+  dealer.setDeadCards(dead);
+  for (int i = 0; i < 1000; i++) {
+    Deal deal;
+    dealer.deal(deal);
+    uint64_t mask = 0;
+    for (int p = 0; p < 9; p++) {
+      for (int k = 0; k < 2; k++) mask |= uint64_t(1) << deal.hole[p][k];
+    }
+    for (int k = 0; k < 5; k++) mask |= uint64_t(1) << deal.board[k];
+    EXPECT_EQ(Popcount(mask), 23);
+    EXPECT_EQ(mask & dead, 0u);
+    EXPECT_EQ(mask, deal.mask);
+  }
+}
+
+TEST(DealerTest, TestRangeWeights) {
+  // AA with weight 3 and KK with weight 1, all suit combinations
+  HandRange range(2);
+  for (int rank : {12, 11}) {
+    for (int s0 = 0; s0 < 4; s0++) {
+      for (int s1 = s0 + 1; s1 < 4; s1++) {
+        const int cards[] = {rank * 4 + s0, rank * 4 + s1};
+        range.add(cards, rank == 12 ? 3.0 : 1.0);
+      }
+    }
+  }
+
+  Dealer dealer(2, 2, 5, 2);
+  dealer.setRange(0, range);
+  const int kDeals = 40000;
+  int aces = 0;
+  for (int i = 0; i < kDeals; i++) {
+    Deal deal;
+    dealer.deal(deal);
+    const int rank = deal.hole[0][0] / 4;
+    ASSERT_TRUE(rank == 12 || rank == 11);
+    EXPECT_EQ(deal.hole[0][1] / 4, rank);
+    EXPECT_EQ(deal.mask & (uint64_t(1) << deal.hole[1][0]),
+              uint64_t(1) << deal.hole[1][0]);
+    aces += rank == 12;
+  }
+  // 0.75 with a standard error of about 0.002
+  EXPECT_NEAR(static_cast<double>(aces) / kDeals, 0.75, 0.01);
+}
+
+TEST(DealerTest, TestOverlappingRanges) {
+  // Three players who all hold an ace from the same four
+  HandRange range(2);
+  for (int a = 48; a < 52; a++) {
+    for (int other = 0; other < 48; other++) {
+      const int cards[] = {a, other};
+      range.add(cards);
+    }
+  }
+  Dealer dealer(3, 2, 5, 3);
+  for (int p = 0; p < 3; p++) dealer.setRange(p, range);
+  for (int i = 0; i < 1000; i++) {
+    Deal deal;
+    dealer.deal(deal);
+    EXPECT_EQ(Popcount(deal.mask), 11);
+    for (int p = 0; p < 3; p++) EXPECT_GE(deal.hole[p][0], 48);
+  }
+
+  // A fourth ace holder is fine, a fifth is impossible
+  Dealer five(5, 2, 0, 4);
+  for (int p = 0; p < 5; p++) five.setRange(p, range);
+  Deal deal;
+  EXPECT_THROW(five.deal(deal), std::runtime_error);
+}
+
+TEST(DealerTest, TestSeededDealsRepeat) {
+  HandRange range(2);
+  const int cards[] = {0, 1};
+  range.add(cards);
+  Dealer a(4, 2, 5, 9, 1), b(4, 2, 5, 9, 1);
+  a.setRange(2, range);
+  b.setRange(2, range);
+  for (int i = 0; i < 100; i++) {
+    Deal x, y;
+    a.deal(x);
+    b.deal(y);
+    ASSERT_EQ(x.mask, y.mask);
+    ASSERT_EQ(x.board[4], y.board[4]);
+  }
+}
+
+TEST(RangeDealerTest, TestJointWeights) {
+  // Of AcAd / KcKd against AcAh / QcQd, three deals are possible, and AcAd
+  // is in one of them: a third, not the half it would get if player 0
+  // were dealt first.
+  HandRange first(2), second(2), deuces(2);
+  const int aces[] = {48, 49}, kings[] = {44, 45};
+  const int other_aces[] = {48, 50}, queens[] = {40, 41}, twos[] = {0, 1};
+  first.add(aces);
+  first.add(kings);
+  second.add(other_aces);
+  second.add(queens);
+  deuces.add(twos);
+
+  Xoshiro256 rng(6);
+  const RangeDealer joined({first, second});
+  // The same conflict between players 0 and 2, through whole redraws
+  const RangeDealer redrawn({first, deuces, second});
+  EXPECT_TRUE(joined.pairsJoined());
+  const int n = 30000;
+  int joined_aces = 0, redrawn_aces = 0;
+  for (int i = 0; i < n; i++) {
+    Deal deal;
+    joined.deal(rng, deal);
+    EXPECT_EQ(Popcount(deal.mask), 4);
+    joined_aces += deal.hole[0][1] == 49;
+    redrawn.deal(rng, deal);
+    EXPECT_EQ(Popcount(deal.mask), 6);
+    redrawn_aces += deal.hole[0][1] == 49;
+  }
+  EXPECT_NEAR(joined_aces / double(n), 1.0 / 3, 0.015);
+  EXPECT_NEAR(redrawn_aces / double(n), 1.0 / 3, 0.015);
+
+  // Dead cards drop hands, and no deal at all is an error
+  const RangeDealer dead({first, second}, uint64_t(1) << 40);
+  Deal deal;
+  dead.deal(rng, deal);
+  EXPECT_EQ(deal.hole[0][0], 44);
+  EXPECT_EQ(deal.hole[1][0], 48);
+  EXPECT_THROW(RangeDealer({first}, uint64_t(1) << 44 | uint64_t(1) << 48),
+               std::runtime_error);
+  EXPECT_THROW(RangeDealer({first, HandRange(3)}), std::invalid_argument);
+  EXPECT_THROW(RangeDealer({}), std::invalid_argument);
+}
@@ -0,0 +1,485 @@
+#include <phevaluator/card_sampler.h>
+#include <phevaluator/combinations.h>
+#include <phevaluator/equity.h>
+#include <phevaluator/phevaluator.h>
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+TEST(EquityTest, TestBoardEvaluator) {
+  card_sampler::CardSampler cs(42);
+  BoardEvaluator evaluator;
+  int c[7];
+  for (int i = 0; i < 200000; i++) {
+    cs.sample_into(c, 7);
+    const uint8_t board[5] = {uint8_t(c[0]), uint8_t(c[1]), uint8_t(c[2]),
+                              uint8_t(c[3]), uint8_t(c[4])};
+    evaluator.setBoard(board);
+    ASSERT_EQ(evaluator.evaluate(c[5], c[6]),
+              evaluate_7cards(c[0], c[1], c[2], c[3], c[4], c[5], c[6]));
+  }
+}
+
+TEST(EquityTest, TestAcesAgainstKings) {
+  EquityCalculator calculator(2);
+  calculator.setHand(0, Hand<2>::Parse("AcAd"));
+  calculator.setHand(1, Hand<2>::Parse("KhKs"));
+  EquityOptions options;
+  options.trials = 200000;
+  options.seed = 42;
+  const EquityResult result = calculator.calculate(options);
+
+  ASSERT_EQ(result.players.size(), 2u);
+  const EquityPlayerResult& aces = result.players[0];
+  // 0.81256 by enumerating every board
+  EXPECT_NEAR(aces.equity, 0.81256, 5 * aces.std_error);
+  EXPECT_NEAR(aces.equity + result.players[1].equity, 1.0, 1e-12);
+  EXPECT_NEAR(aces.win + aces.tie / 2, aces.equity, 1e-12);
+  EXPECT_GT(aces.tie, 0.0);
+}
+
+TEST(EquityTest, TestFlopShowdown) {
+  // On the flop as it stands, the set always beats the overpair
+  EquityCalculator calculator(2);
+  calculator.setHand(0, Hand<2>::Parse("AcAd"));
+  calculator.setHand(1, Hand<2>::Parse("7h7s"));
+  calculator.setBoard(Board::Parse("7c2d9h"));
+  EquityOptions options;
+  options.trials = 100;
+  options.board_cards = 3;
+  EXPECT_EQ(calculator.calculate(options).players[1].win, 1.0);
+
+  options.board_cards = 4;
+  const EquityResult turn = calculator.calculate(options);
+  EXPECT_GT(turn.players[1].win, 0.9);
+  EXPECT_LT(turn.players[1].win, 1.0);
+}
+
+TEST(EquityTest, TestSplitPots) {
+  // Both play the board's royal flush
+  EquityCalculator calculator(3);
+  calculator.setHand(0, Hand<2>::Parse("2c3d"));
+  calculator.setHand(1, Hand<2>::Parse("4c5d"));
+  calculator.setHand(2, Hand<2>::Parse("7h8h"));
+  calculator.setBoard(Board::Parse("AsKsQsJsTs"));
+  EquityOptions options;
+  options.trials = 10;
+  const EquityResult result = calculator.calculate(options);
+  for (const EquityPlayerResult& player : result.players) {
+    EXPECT_DOUBLE_EQ(player.equity, 1.0 / 3);
+    EXPECT_DOUBLE_EQ(player.tie, 1.0);
+    EXPECT_DOUBLE_EQ(player.win, 0.0);
+    EXPECT_DOUBLE_EQ(player.std_error, 0.0);
+  }
+}
+
+TEST(EquityTest, TestSameResultOnAnyPool) {
+  card_sampler::HandRange pairs(2);
+  for (int rank = 8; rank < 13; rank++) {
+    const int cards[] = {rank * 4, rank * 4 + 1};
+    pairs.add(cards);
+  }
+  EquityCalculator calculator(6);
+  calculator.setHand(0, Hand<2>::Parse("AhKh"));
+  calculator.setRange(1, pairs);
+  calculator.setBoard(Board::Parse("Qh7h2c"));
+  calculator.setDeadCards(uint64_t(1) << 4);
+  EquityOptions options;
+  options.trials = 50000;
+  options.chunk_trials = 1000;
+  options.seed = 5;
+
+  const EquityResult single = calculator.calculate(options);
+  ThreadPool one(1), three(3);
+  for (ThreadPool* pool : {&one, &three}) {
+    const EquityResult result = calculator.calculate(options, pool);
+    for (int p = 0; p < 6; p++) {
+      EXPECT_EQ(result.players[p].equity, single.players[p].equity);
+      EXPECT_EQ(result.players[p].win, single.players[p].win);
+    }
+  }
+
+  double total = 0;
+  for (const EquityPlayerResult& player : single.players) {
+    total += player.equity;
+  }
+  EXPECT_NEAR(total, 1.0, 1e-9);
+
+  options.stream = 1;
+  EXPECT_NE(calculator.calculate(options).players[0].equity,
+            single.players[0].equity);
+}
+
+// Every runout evaluated, with the same counting as the calculator
+static EquityResult BruteForce(const std::vector<Hand<2>>& hands,
+                               const Board& known_board, uint64_t dead) {
+  uint64_t known = known_board.mask() | dead;
+  for (const Hand<2>& hand : hands) known |= hand.mask();
+  const int players = hands.size();
+  const int missing = Board::kMaxCards - known_board.size();
+  std::vector<uint64_t> units(players), wins(players), ties(players);
+  uint64_t runouts = 0;
+  auto showdown = [&](uint64_t runout) {
+    int c[7];
+    for (int i = 0; i < known_board.size(); i++) c[i] = known_board.data()[i];
+    Combinations::Cards(runout, c + known_board.size());
+    int ranks[10], best = INT_MAX, winners = 0;
+    for (int p = 0; p < players; p++) {
+      const uint8_t* h = hands[p].data();
+      ranks[p] = evaluate_7cards(c[0], c[1], c[2], c[3], c[4], h[0], h[1]);
+      best = std::min(best, ranks[p]);
+    }
+    for (int p = 0; p < players; p++) winners += ranks[p] == best;
+    for (int p = 0; p < players; p++) {
+      if (ranks[p] != best) continue;
+      (winners == 1 ? wins : ties)[p]++;
+      units[p] += 2520 / winners;
+    }
+    runouts++;
+  };
+  if (missing > 0) {
+    Combinations(missing, known).forEach(showdown);
+  } else {
+    showdown(0);
+  }
+
+  EquityResult result;
+  result.trials = result.evaluated = runouts;
+  result.players.resize(players);
+  for (int p = 0; p < players; p++) {
+    result.players[p].win = wins[p] / double(runouts);
+    result.players[p].tie = ties[p] / double(runouts);
+    result.players[p].equity = units[p] / double(runouts) / 2520;
+  }
+  return result;
+}
+
+static void ExpectSameResult(const EquityResult& a, const EquityResult& b) {
+  ASSERT_EQ(a.trials, b.trials);
+  ASSERT_EQ(a.players.size(), b.players.size());
+  for (size_t p = 0; p < a.players.size(); p++) {
+    EXPECT_EQ(a.players[p].win, b.players[p].win);
+    EXPECT_EQ(a.players[p].tie, b.players[p].tie);
+    EXPECT_EQ(a.players[p].equity, b.players[p].equity);
+    EXPECT_EQ(a.players[p].std_error, 0.0);
+  }
+}
+
+TEST(EquityTest, TestEnumerateHeadsUp) {
+  EquityCalculator calculator(2);
+  const std::vector<Hand<2>> hands = {Hand<2>::Parse("AcAd"),
+                                      Hand<2>::Parse("KhKs")};
+  calculator.setHand(0, hands[0]);
+  calculator.setHand(1, hands[1]);
+  ThreadPool pool(3);
+  const EquityResult result = calculator.enumerate(&pool);
+
+  EXPECT_EQ(result.trials, 1712304u);
+  // Swapping clubs with diamonds, hearts with spades, or both, maps the
+  // hands onto themselves, so about a quarter of the runouts are evaluated
+  EXPECT_LT(result.evaluated, result.trials / 3);
+  EXPECT_NEAR(result.players[0].equity, 0.812555, 1e-6);
+  ExpectSameResult(result, BruteForce(hands, Board(), 0));
+  ExpectSameResult(result, calculator.enumerate());
+}
+
+TEST(EquityTest, TestEnumeratePartialBoard) {
+  EquityCalculator calculator(3);
+  const std::vector<Hand<2>> hands = {Hand<2>::Parse("AhKh"),
+                                      Hand<2>::Parse("QcQd"),
+                                      Hand<2>::Parse("9s8s")};
+  for (int p = 0; p < 3; p++) calculator.setHand(p, hands[p]);
+  const Board flop = Board::Parse("Jh7s2c");
+  const uint64_t dead = uint64_t(1) << 4;  // 3c
+  calculator.setBoard(flop);
+  calculator.setDeadCards(dead);
+  ExpectSameResult(calculator.enumerate(), BruteForce(hands, flop, dead));
+
+  calculator.setBoard(Board::Parse("Jh7s2cTs3d"));
+  const EquityResult river = calculator.enumerate();
+  EXPECT_EQ(river.trials, 1u);
+  EXPECT_EQ(river.players[2].win, 1.0);
+}
+
+TEST(EquityTest, TestInvalidSetups) {
+  EXPECT_THROW(EquityCalculator(1), std::invalid_argument);
+  EXPECT_THROW(EquityCalculator(11), std::invalid_argument);
+
+  EquityCalculator calculator(2);
+  EXPECT_THROW(calculator.setHand(2, Hand<2>::Parse("AcAd")),
+               std::invalid_argument);
+  EXPECT_THROW(calculator.setRange(0, card_sampler::HandRange(4)),
+               std::invalid_argument);
+
+  calculator.setHand(0, Hand<2>::Parse("AcAd"));
+  calculator.setHand(1, Hand<2>::Parse("AcKd"));
+  EXPECT_THROW(calculator.calculate(EquityOptions()), std::invalid_argument);
+
+  calculator.setHand(1, Hand<2>::Parse("KcKd"));
+  calculator.setBoard(Board::Parse("2c3c4c5c"));
+  EquityOptions flop;
+  flop.board_cards = 3;
+  EXPECT_THROW(calculator.calculate(flop), std::invalid_argument);
+  flop.board_cards = 6;
+  EXPECT_THROW(calculator.calculate(flop), std::invalid_argument);
+
+  calculator.setBoard(Board::Parse("2c3c4c"));
+  calculator.setDeadCards(uint64_t(1) << 0);
+  EXPECT_THROW(calculator.calculate(EquityOptions()), std::invalid_argument);
+
+  calculator.setDeadCards(0);
+  EXPECT_NO_THROW(calculator.enumerate());
+  calculator.setRandom(1);
+  EXPECT_THROW(calculator.enumerate(), std::invalid_argument);
+}
+
+TEST(EquityTest, TestStartingHandGrid) {
+  EquityOptions options;
+  options.trials = 100000;
+  options.seed = 3;
+  ThreadPool pool(2);
+  const StartingHandGrid grid = CalculateStartingHandGrid(1, options, &pool);
+  EXPECT_EQ(grid.trials, options.trials);
+
+  // Against one random hand: AA 0.8520, AKs 0.6704, 72o 0.3458
+  const EquityPlayerResult& aces = grid.cells[0][0];
+  const EquityPlayerResult& ace_king = grid.cells[0][1];
+  const EquityPlayerResult& seven_deuce = grid.cells[12][7];
+  EXPECT_NEAR(aces.equity, 0.8520, 5 * aces.std_error);
+  EXPECT_NEAR(ace_king.equity, 0.6704, 5 * ace_king.std_error);
+  EXPECT_NEAR(seven_deuce.equity, 0.3458, 5 * seven_deuce.std_error);
+  EXPECT_GT(aces.std_error, 0.0);
+  EXPECT_LT(aces.std_error, 0.002);
+
+  // Common deals keep the pairs in order with far fewer trials than
+  // separate runs would need
+  for (int i = 1; i < StartingHandGrid::kSize; i++) {
+    EXPECT_GT(grid.cells[i - 1][i - 1].equity, grid.cells[i][i].equity);
+  }
+
+  EXPECT_EQ(CalculateStartingHandGrid(1, options).cells[5][9].equity,
+            grid.cells[5][9].equity);
+
+  options.board_cards = 3;
+  options.trials = 1000;
+  const StartingHandGrid flop = CalculateStartingHandGrid(8, options);
+  EXPECT_GT(flop.cells[0][0].equity, flop.cells[12][12].equity);
+
+  EXPECT_THROW(CalculateStartingHandGrid(0, options), std::invalid_argument);
+  EXPECT_THROW(CalculateStartingHandGrid(10, options), std::invalid_argument);
+}
+
+TEST(EquityTest, TestTargetStdError) {
+  EquityCalculator calculator(3);
+  calculator.setHand(0, Hand<2>::Parse("AhKh"));
+  calculator.setHand(1, Hand<2>::Parse("QcQd"));
+  EquityOptions options;
+  options.trials = 10000000;
+  options.seed = 11;
+  options.target_std_error = 0.005 / 1.96;  // +-0.5% at 95%
+  const EquityResult result = calculator.calculate(options);
+
+  EXPECT_LT(result.trials, options.trials / 100);
+  EXPECT_EQ(result.trials % options.chunk_trials, 0u);
+  for (const EquityPlayerResult& player : result.players) {
+    EXPECT_LE(player.std_error, options.target_std_error);
+  }
+  // Rounds depend only on the results, not on the threads
+  ThreadPool pool(3);
+  const EquityResult pooled = calculator.calculate(options, &pool);
+  EXPECT_EQ(pooled.trials, result.trials);
+  EXPECT_EQ(pooled.players[0].equity, result.players[0].equity);
+
+  // A target that the trials can't reach runs them all
+  options.trials = 20000;
+  options.target_std_error = 1e-6;
+  EXPECT_EQ(calculator.calculate(options).trials, 20000u);
+
+  options.target_std_error = 0.01;
+  const StartingHandGrid grid = CalculateStartingHandGrid(2, options);
+  EXPECT_LT(grid.trials, 20000u);
+  EXPECT_LE(grid.cells[6][6].std_error, 0.01);
+
+  options.target_std_error = -1;
+  EXPECT_THROW(calculator.calculate(options), std::invalid_argument);
+}
+
+TEST(EquityTest, TestSamplingModes) {
+  EquityCalculator calculator(2);
+  calculator.setHand(0, Hand<2>::Parse("AhKh"));
+  calculator.setHand(1, Hand<2>::Parse("QcQd"));
+  calculator.setBoard(Board::Parse("Jh7s2c"));
+  const double exact = calculator.enumerate().players[0].equity;
+
+  EquityOptions options;
+  options.trials = 40000;
+  options.seed = 8;
+  const EquityResult plain = calculator.calculate(options);
+  ThreadPool pool(3);
+  for (EquitySampling sampling :
+       {EquitySampling::kStratified, EquitySampling::kAntithetic,
+        EquitySampling::kQuasiRandom}) {
+    options.sampling = sampling;
+    const EquityResult result = calculator.calculate(options);
+    const EquityPlayerResult& hero = result.players[0];
+    EXPECT_EQ(result.trials, options.trials);
+    EXPECT_GT(hero.std_error, 0.0);
+    EXPECT_NEAR(hero.equity, exact, 5 * hero.std_error);
+    EXPECT_EQ(calculator.calculate(options, &pool).players[0].equity,
+              hero.equity);
+    if (sampling != EquitySampling::kAntithetic) {
+      // The turn and river are spread evenly over their combinations
+      EXPECT_LT(hero.std_error, plain.players[0].std_error / 4);
+    }
+  }
+
+  // Dealt opponents get their own runouts, and odd chunks end unpaired
+  calculator.setRandom(1);
+  options.trials = 30001;
+  options.sampling = EquitySampling::kPlain;
+  const EquityResult random_plain = calculator.calculate(options);
+  for (EquitySampling sampling :
+       {EquitySampling::kStratified, EquitySampling::kAntithetic,
+        EquitySampling::kQuasiRandom}) {
+    options.sampling = sampling;
+    const EquityPlayerResult hero = calculator.calculate(options).players[0];
+    EXPECT_NEAR(hero.equity, random_plain.players[0].equity,
+                5 * random_plain.players[0].std_error);
+  }
+}
+
+// Range equities by weighting every compatible set of hands
+static std::vector<double> ExactRangeEquity(
+    const std::vector<HoldemRange>& ranges, const Board& board) {
+  std::vector<double> equity(ranges.size());
+  double total = 0;
+  std::vector<Hand<2>> hands;
+  std::function<void(size_t, uint64_t, double)> visit =
+      [&](size_t p, uint64_t taken, double weight) {
+        if (p == ranges.size()) {
+          const EquityResult result = BruteForce(hands, board, 0);
+          for (size_t i = 0; i < ranges.size(); i++) {
+            equity[i] += weight * result.players[i].equity;
+          }
+          total += weight;
+          return;
+        }
+        ranges[p].without(taken).forEach([&](int, int a, int b, double w) {
+          const int ids[] = {a, b};
+          hands.push_back(Hand<2>(ids));
+          visit(p + 1, taken | hands.back().mask(), weight * w);
+          hands.pop_back();
+        });
+      };
+  visit(0, board.mask(), 1.0);
+  for (double& e : equity) e /= total;
+  return equity;
+}
+
+TEST(EquityTest, TestRangeAgainstRange) {
+  // Both ranges lean on the same aces, so card removal decides the hands
+  const Board board = Board::Parse("Kh7c2d");
+  const std::vector<HoldemRange> ranges = {HoldemRange::Parse("AA,KK:0.5"),
+                                           HoldemRange::Parse("AA,AKs,77")};
+  const std::vector<double> exact = ExactRangeEquity(ranges, board);
+
+  EquityCalculator calculator(2);
+  calculator.setRange(0, ranges[0]);
+  calculator.setRange(1, ranges[1]);
+  calculator.setBoard(board);
+  EquityOptions options;
+  options.trials = 200000;
+  options.seed = 12;
+  const EquityResult result = calculator.calculate(options);
+  for (int p = 0; p < 2; p++) {
+    EXPECT_NEAR(result.players[p].equity, exact[p],
+                5 * result.players[p].std_error);
+  }
+
+  ThreadPool pool(3);
+  options.target_std_error = 0.002;
+  const EquityResult early = calculator.calculate(options);
+  EXPECT_LT(early.trials, options.trials);
+  EXPECT_EQ(calculator.calculate(options, &pool).players[0].equity,
+            early.players[0].equity);
+  EXPECT_NEAR(early.players[0].equity, exact[0], 0.01);
+}
+
+TEST(EquityTest, TestMultiwayRanges) {
+  const Board board = Board::Parse("Qh7c2d5s");
+  const std::vector<HoldemRange> ranges = {HoldemRange::Parse("AA,KK"),
+                                           HoldemRange::Parse("AK,QQ:2"),
+                                           HoldemRange::Parse("AQs,KQs,AhKh")};
+  const std::vector<double> exact = ExactRangeEquity(ranges, board);
+
+  EquityCalculator calculator(3);
+  for (int p = 0; p < 3; p++) calculator.setRange(p, ranges[p]);
+  calculator.setBoard(board);
+  EquityOptions options;
+  options.trials = 200000;
+  options.seed = 4;
+  const EquityResult result = calculator.calculate(options);
+  for (int p = 0; p < 3; p++) {
+    EXPECT_NEAR(result.players[p].equity, exact[p],
+                5 * result.players[p].std_error);
+  }
+
+  // Ranges that can't all be dealt
+  calculator.setRange(0, HoldemRange::Parse("AcAd"));
+  calculator.setRange(1, HoldemRange::Parse("AcAh"));
+  EXPECT_THROW(calculator.calculate(options), std::runtime_error);
+}
+
+TEST(EquityTest, TestEnumerateRangeEquity) {
+  const std::vector<HoldemRange> ranges = {
+      HoldemRange::Parse("AA, KK:0.5, 76s"),
+      HoldemRange::Parse("AA, AKs, 77, KQo:0.25")};
+  for (const char* text : {"Kh7c2d", "Kh7c2d9s", "Kh7c2d9sAs"}) {
+    const Board board = Board::Parse(text);
+    const std::vector<double> exact = ExactRangeEquity(ranges, board);
+    const RangeEquity result =
+        EnumerateRangeEquity(ranges[0], ranges[1], board);
+    EXPECT_NEAR(result.players[0].equity, exact[0], 1e-12) << text;
+    EXPECT_NEAR(result.players[1].equity, exact[1], 1e-12) << text;
+    EXPECT_NEAR(result.players[0].win + result.players[1].win +
+                    result.players[0].tie,
+                1.0, 1e-12);
+    EXPECT_EQ(result.players[0].tie, result.players[1].tie);
+
+    // One hand against the range
+    const HoldemRange sevens = HoldemRange::Parse("7h6h");
+    EXPECT_NEAR(result.hands[0][HoldemRange::Index(Card("7h"), Card("6h"))],
+                ExactRangeEquity({sevens, ranges[1]}, board)[0], 1e-12);
+  }
+  const Board flop = Board::Parse("Kh7c2d");
+  EXPECT_EQ(EnumerateRangeEquity(ranges[0], ranges[1], flop).runouts, 1176u);
+  // Hands on the board can't be dealt
+  EXPECT_EQ(EnumerateRangeEquity(ranges[0], ranges[1], flop)
+                .hands[1][HoldemRange::Index(Card("7c"), Card("7d"))],
+            0.0);
+
+  ThreadPool pool(3);
+  const RangeEquity single =
+      EnumerateRangeEquity(ranges[0], ranges[1], flop, uint64_t(1) << 51);
+  const RangeEquity pooled =
+      EnumerateRangeEquity(ranges[0], ranges[1], flop, uint64_t(1) << 51,
+                           &pool);
+  EXPECT_EQ(single.players[0].equity, pooled.players[0].equity);
+  EXPECT_EQ(single.hands[1], pooled.hands[1]);
+
+  EXPECT_THROW(EnumerateRangeEquity(ranges[0], ranges[1], Board()),
+               std::invalid_argument);
+  EXPECT_THROW(EnumerateRangeEquity(ranges[0], ranges[1], flop,
+                                    flop.mask()),
+               std::invalid_argument);
+  EXPECT_THROW(EnumerateRangeEquity(HoldemRange::Parse("AcAd"),
+                                    HoldemRange::Parse("AcKd"), flop),
+               std::runtime_error);
+}
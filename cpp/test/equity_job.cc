@@ -0,0 +1,142 @@
+#include <phevaluator/equity_job.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+using Clock = std::chrono::steady_clock;
+
+static EquityQuery AcesHeadsUp() {
+  EquityQuery query;
+  query.hero = Hand<2>::Parse("AsAh");
+  query.opponents = 1;
+  return query;
+}
+
+TEST(EquityJobTest, TestCompletes) {
+  JobOptions options;
+  options.max_trials = 20000;
+  options.seed = 39;
+  EquityJob job = StartEquityJob(AcesHeadsUp(), options);
+  const JobResult result = job.get();
+
+  EXPECT_EQ(result.status, JobStatus::kComplete);
+  EXPECT_EQ(result.estimate.trials, 20000u);
+  EXPECT_GT(result.estimate.std_error, 0.0);
+  // AA against a random hand is 85.2%
+  EXPECT_NEAR(result.estimate.equity, 0.852, 5 * result.estimate.std_error);
+  EXPECT_TRUE(job.done());
+  EXPECT_EQ(job.progress().trials, 20000u);
+}
+
+TEST(EquityJobTest, TestSeededJobsRepeat) {
+  JobOptions options;
+  options.max_trials = 5000;
+  options.seed = 7;
+  EquityJob a = StartEquityJob(AcesHeadsUp(), options);
+  EquityJob b = StartEquityJob(AcesHeadsUp(), options);
+  EXPECT_EQ(a.get().estimate.equity, b.get().estimate.equity);
+}
+
+TEST(EquityJobTest, TestDeadline) {
+  JobOptions options;
+  options.max_trials = UINT64_MAX;
+  options.deadline = Clock::now() + std::chrono::milliseconds(50);
+  const Clock::time_point start = Clock::now();
+  EquityJob job = StartEquityJob(AcesHeadsUp(), options);
+  const JobResult result = job.get();
+
+  EXPECT_EQ(result.status, JobStatus::kDeadline);
+  EXPECT_GT(result.estimate.trials, 0u);
+  EXPECT_LT(Clock::now() - start, std::chrono::seconds(2));
+}
+
+TEST(EquityJobTest, TestCancelAndProgress) {
+  std::atomic<int> reports{0};
+  JobOptions options;
+  options.max_trials = UINT64_MAX;
+  options.progress_interval = std::chrono::milliseconds(1);
+  options.on_progress = [&reports](const EquityEstimate& estimate) {
+    EXPECT_GT(estimate.trials, 0u);
+    reports++;
+  };
+  EquityJob job = StartEquityJob(AcesHeadsUp(), options);
+  while (reports < 3) std::this_thread::yield();
+  job.cancel();
+
+  const JobResult result = job.get();
+  EXPECT_EQ(result.status, JobStatus::kCancelled);
+  EXPECT_GT(result.estimate.trials, 0u);
+}
+
+TEST(EquityJobTest, TestSharedCancelFlag) {
+  JobOptions options;
+  options.max_trials = UINT64_MAX;
+  EquityJob a = StartEquityJob(AcesHeadsUp(), options);
+  EquityJob b = StartEquityJob(AcesHeadsUp(), options);
+  options.cancel.cancel();
+  EXPECT_EQ(a.get().status, JobStatus::kCancelled);
+  EXPECT_EQ(b.get().status, JobStatus::kCancelled);
+}
+
+TEST(EquityJobTest, TestWorkErrors) {
+  JobOptions options;
+  EquityJob job(
+      [](uint64_t, uint64_t, EquityAccumulator&) {
+        throw std::runtime_error("work failed");
+      },
+      options);
+  EXPECT_THROW(job.get(), std::runtime_error);
+
+  EquityQuery query = AcesHeadsUp();
+  query.board = Board::Parse("As2c3d");
+  EXPECT_THROW(StartEquityJob(query), std::invalid_argument);
+}
+
+TEST(EquityJobTest, TestThen) {
+  JobOptions options;
+  options.max_trials = 1000;
+  EquityJob job = StartEquityJob(AcesHeadsUp(), options);
+  std::atomic<bool> called{false};
+  job.then([&called] { called = true; });
+  job.get();
+  while (!called) std::this_thread::yield();
+
+  bool now = false;
+  job.then([&now] { now = true; });
+  EXPECT_TRUE(now);
+}
+
+#if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)
+// Just enough of a coroutine type to co_await a job
+struct Detached {
+  struct promise_type {
+    Detached get_return_object() { return {}; }
+    std::suspend_never initial_suspend() { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+static Detached AwaitJob(EquityJob& job, std::atomic<uint64_t>& trials) {
+  const JobResult result = co_await job;
+  trials = result.estimate.trials;
+}
+
+TEST(EquityJobTest, TestCoAwait) {
+  JobOptions options;
+  options.max_trials = 3000;
+  EquityJob job = StartEquityJob(AcesHeadsUp(), options);
+  std::atomic<uint64_t> trials{0};
+  AwaitJob(job, trials);
+  job.get();
+  while (trials == 0) std::this_thread::yield();
+  EXPECT_EQ(trials, 3000u);
+}
+#endif
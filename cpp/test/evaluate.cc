@@ -0,0 +1,55 @@
+#include <phevaluator/card_sampler.h>
+#include <phevaluator/evaluate.h>
+#include <phevaluator/phevaluator.h>
+
+#include <array>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+static card_sampler::CardSampler cs{};
+
+// Evaluated by the compiler, these fail the build rather than the test.
+static_assert(Evaluate(std::array<int, 5>{48, 44, 40, 36, 32}) == 1,
+              "royal flush");
+static_assert(Evaluate(std::array<int, 7>{0, 5, 8, 12, 17, 21, 49}) == 1607,
+              "seven high straight");
+static_assert(Evaluate<9>(std::array<int, 9>{48, 49, 50, 51, 44, 45, 46,
+                                             40, 36}
+                              .data()) == 11,
+              "four aces");
+
+constexpr std::array<Card, 7> kFullHouse = {Card(28), Card(8), Card(11),
+                                            Card(29), Card(10), Card(40),
+                                            Card(16)};
+static_assert(Evaluate(kFullHouse) == 292, "fours full of nines");
+
+TEST(EvaluateTest, TestMatchesCEvaluators) {
+  for (int i = 0; i < 100000; i++) {
+    std::vector<int> s = cs.sample(9);
+
+    ASSERT_EQ(Evaluate<5>(s.data()),
+              evaluate_5cards(s[0], s[1], s[2], s[3], s[4]));
+    ASSERT_EQ(Evaluate<6>(s.data()),
+              evaluate_6cards(s[0], s[1], s[2], s[3], s[4], s[5]));
+    ASSERT_EQ(Evaluate<7>(s.data()),
+              evaluate_7cards(s[0], s[1], s[2], s[3], s[4], s[5], s[6]));
+    ASSERT_EQ(Evaluate<8>(s.data()), evaluate_8cards(s[0], s[1], s[2], s[3],
+                                                     s[4], s[5], s[6], s[7]));
+    ASSERT_EQ(Evaluate<9>(s.data()),
+              evaluate_9cards(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7],
+                              s[8]));
+  }
+}
+
+TEST(EvaluateTest, TestCards) {
+  const std::array<Card, 7> cards = {"9c", "4c", "4s", "9d", "4h", "Qc", "6c"};
+
+  ASSERT_EQ(Evaluate(cards),
+            EvaluateCards(cards[0], cards[1], cards[2], cards[3], cards[4],
+                          cards[5], cards[6])
+                .value());
+  ASSERT_EQ(Evaluate<5>(cards.data()), 292);
+}
@@ -1,4 +1,6 @@
+#include <phevaluator/batch.h>
 #include <phevaluator/card_sampler.h>
+#include <phevaluator/hand_file.h>
 #include <phevaluator/phevaluator.h>
 #include <phevaluator/rank.h>
 
@@ -75,3 +77,51 @@ TEST(EvaluationTest, TestPlo4Cards) {
   std::printf("Complete testing Plo4 cards\n");
   std::printf("Tested %lld random hands in total\n", total);
 }
+
+TEST(EvaluationTest, TestPlo4Batch) {
+  const size_t n = 1000;
+  std::vector<uint8_t> hands(n * 9);
+  for (size_t i = 0; i < n; i++) {
+    std::vector<int> sample = cs.sample(9);
+    for (int k = 0; k < 9; k++) hands[i * 9 + k] = sample[k];
+  }
+  hands[9 * 3 + 8] = hands[9 * 3];
+
+  std::vector<int16_t> out(n);
+  EXPECT_EQ(evaluate_plo4_batch(hands.data(), n, 0, out.data()), 1u);
+  for (size_t i = 0; i < n; i++) {
+    const uint8_t* c = &hands[i * 9];
+    if (i == 3) {
+      EXPECT_EQ(out[i], PHEVAL_INVALID_HAND);
+      continue;
+    }
+    ASSERT_EQ(out[i], evaluate_plo4_cards(c[0], c[1], c[2], c[3], c[4], c[5],
+                                          c[6], c[7], c[8]));
+  }
+}
+
+TEST(EvaluationTest, TestPlo4HandFile) {
+  const std::string path = ::testing::TempDir() + "plo4_hands.bin";
+  const HandFileHeader header = MakeHandFileHeader(
+      HandVariant::kOmaha, HandEncoding::kPacked6, 5, 4, 2);
+  std::vector<int> expected;
+
+  {
+    HandWriter writer(path, header);
+    for (int i = 0; i < 1000; i++) {
+      std::vector<int> s = cs.sample(13);
+      writer.write(s.data());
+      for (int p = 0; p < 2; p++) {
+        const int* h = &s[5 + p * 4];
+        expected.push_back(evaluate_plo4_cards(s[0], s[1], s[2], s[3], s[4],
+                                               h[0], h[1], h[2], h[3]));
+      }
+    }
+  }
+
+  MappedHandFile file(path);
+  std::vector<short> ranks(file.size() * 2);
+  ASSERT_EQ(EvaluatePlo4HandFile(file, ranks.data()), expected.size());
+  ASSERT_TRUE(std::equal(ranks.begin(), ranks.end(), expected.begin()));
+  std::remove(path.c_str());
+}
@@ -0,0 +1,104 @@
+#include <phevaluator/card_sampler.h>
+#include <phevaluator/dealer.h>
+#include <phevaluator/evaluate.h>
+#include <phevaluator/hand.h>
+#include <phevaluator/phevaluator.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+static card_sampler::CardSampler cs(5);
+
+TEST(HandTest, TestConstruction) {
+  constexpr Hand<2> aces = {Card(51), Card(50)};
+  static_assert(aces.mask() == ((uint64_t(1) << 51) | (uint64_t(1) << 50)));
+  static_assert(aces.contains(Card(50)) && !aces.contains(Card(49)));
+
+  const Hand<2> parsed = Hand<2>::Parse("AsAh");
+  EXPECT_EQ(parsed, aces);
+  EXPECT_EQ(parsed.describe(), "AsAh");
+  EXPECT_EQ(static_cast<int>(parsed[1]), 50);
+
+  EXPECT_THROW(Hand<2>::Parse("AsAs"), std::invalid_argument);
+  EXPECT_THROW(Hand<2>::Parse("As"), std::invalid_argument);
+  EXPECT_THROW(Hand<2>::Parse("AsKdQh"), std::invalid_argument);
+  EXPECT_THROW((Hand<2>{Card(1)}), std::invalid_argument);
+  const int bad[] = {3, 52};
+  EXPECT_THROW(Hand<2>{bad}, std::invalid_argument);
+
+  Board board = Board::Parse("2c 7d Jh");
+  EXPECT_EQ(board.size(), 3);
+  board.add(Card("Qs"));
+  EXPECT_EQ(board.describe(), "2c7dJhQs");
+  EXPECT_THROW(board.add(Card("2c")), std::invalid_argument);
+  board.add(Card("3c"));
+  EXPECT_THROW(board.add(Card("4c")), std::invalid_argument);
+
+  EXPECT_EQ(Card().describeCard(), "2c");
+}
+
+TEST(HandTest, TestLayout) {
+  static_assert(std::is_trivially_copyable<Hand<2>>::value);
+  static_assert(std::is_trivially_copyable<Hand<4>>::value);
+  static_assert(sizeof(Hand<5>) == 16);
+
+  // A batch copies as plain bytes
+  Hand<7> hands[3];
+  for (Hand<7>& hand : hands) cs.sample_into(hand);
+  Hand<7> copy[3];
+  std::memcpy(copy, hands, sizeof(hands));
+  for (int i = 0; i < 3; i++) EXPECT_EQ(copy[i], hands[i]);
+}
+
+TEST(HandTest, TestEvaluate) {
+  for (int i = 0; i < 1000; i++) {
+    Hand<7> hand;
+    cs.sample_into(hand);
+    const uint8_t* c = hand.data();
+
+    int mask_cards = 0;
+    for (uint8_t id : hand) mask_cards += hand.contains(Card(id));
+    EXPECT_EQ(mask_cards, 7);
+
+    const Rank expected =
+        EvaluateCards(c[0], c[1], c[2], c[3], c[4], c[5], c[6]);
+    EXPECT_EQ(EvaluateHand(hand), expected);
+    EXPECT_EQ(Evaluate(hand), expected.value());
+
+    const Hand<2> hole(hand.ids().data() + 5);
+    const Board board(hand.ids().data(), 5);
+    EXPECT_EQ(EvaluateHand(hole, board), expected);
+
+    const Hand<5> five(hand.ids().data());
+    EXPECT_EQ(EvaluateHand(five),
+              EvaluateCards(c[0], c[1], c[2], c[3], c[4]));
+    EXPECT_EQ(EvaluateHand(hole, Board(hand.ids().data(), 3)),
+              EvaluateCards(c[0], c[1], c[2], c[5], c[6]));
+  }
+  EXPECT_THROW(EvaluateHand(Hand<2>::Parse("AsKs"), Board()),
+               std::invalid_argument);
+}
+
+TEST(HandTest, TestEvaluateEightAndNine) {
+  for (int i = 0; i < 1000; i++) {
+    Hand<9> nine;
+    cs.sample_into(nine);
+    const Hand<8> eight(nine.ids().data());
+    EXPECT_EQ(EvaluateHand(nine).value(), Evaluate(nine));
+    EXPECT_EQ(EvaluateHand(eight).value(), Evaluate(eight));
+  }
+}
+
+TEST(HandTest, TestDeal) {
+  card_sampler::Dealer dealer(3, 2, 5, 6);
+  card_sampler::Deal deal;
+  dealer.deal(deal);
+  uint64_t mask = deal.boardOf(5).mask();
+  for (int p = 0; p < 3; p++) mask |= deal.holeOf<2>(p).mask();
+  EXPECT_EQ(mask, deal.mask);
+}
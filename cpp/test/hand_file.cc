@@ -0,0 +1,298 @@
+#include <phevaluator/card_sampler.h>
+#include <phevaluator/hand_file.h>
+#include <phevaluator/phevaluator.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+static card_sampler::CardSampler cs{};
+
+static std::string TempPath(const char* name) {
+  return ::testing::TempDir() + name;
+}
+
+static std::vector<std::vector<int>> WriteHoldemFile(const std::string& path,
+                                                     HandEncoding encoding,
+                                                     int records) {
+  // board and 3 players, 11 cards, so packed records take two words
+  const HandFileHeader header =
+      MakeHandFileHeader(HandVariant::kCards, encoding, 5, 2, 3);
+  std::vector<std::vector<int>> written;
+
+  HandWriter writer(path, header);
+  for (int i = 0; i < records; i++) {
+    written.push_back(cs.sample(header.cards()));
+    writer.write(written.back().data());
+  }
+  writer.close();
+  EXPECT_EQ(writer.count(), static_cast<uint64_t>(records));
+  return written;
+}
+
+TEST(HandFileTest, TestHeaderLayout) {
+  const HandFileHeader packed =
+      MakeHandFileHeader(HandVariant::kCards, HandEncoding::kPacked6, 0, 7);
+  ASSERT_EQ(packed.cards(), 7);
+  ASSERT_EQ(packed.words(), 1);
+
+  const HandFileHeader masks =
+      MakeHandFileHeader(HandVariant::kCards, HandEncoding::kMask64, 5, 2, 9);
+  ASSERT_EQ(masks.cards(), 23);
+  ASSERT_EQ(masks.words(), 10);
+
+  ASSERT_THROW(MakeHandFileHeader(HandVariant::kCards, HandEncoding::kPacked6,
+                                  5, 2, 24),
+               std::invalid_argument);
+  ASSERT_THROW(MakeHandFileHeader(HandVariant::kOmaha, HandEncoding::kPacked6,
+                                  5, 2),
+               std::invalid_argument);
+  ASSERT_THROW(MakeHandFileHeader(HandVariant::kCards, HandEncoding::kPacked6,
+                                  0, 4),
+               std::invalid_argument);
+}
+
+TEST(HandFileTest, TestEncodeRejectsBadCards) {
+  const HandFileHeader header =
+      MakeHandFileHeader(HandVariant::kCards, HandEncoding::kPacked6, 0, 5);
+  uint64_t words[1];
+  const int duplicate[5] = {0, 1, 2, 3, 0};
+  const int out_of_range[5] = {0, 1, 2, 3, 52};
+
+  ASSERT_THROW(EncodeHandRecord(header, duplicate, words),
+               std::invalid_argument);
+  ASSERT_THROW(EncodeHandRecord(header, out_of_range, words),
+               std::invalid_argument);
+}
+
+TEST(HandFileTest, TestPackedRoundTrip) {
+  const std::string path = TempPath("packed_hands.bin");
+  const auto written = WriteHoldemFile(path, HandEncoding::kPacked6, 10000);
+
+  HandReader reader(path);
+  int cards[52];
+  for (const auto& record : written) {
+    ASSERT_TRUE(reader.next(cards));
+    ASSERT_TRUE(std::equal(record.begin(), record.end(), cards));
+  }
+  ASSERT_FALSE(reader.next(cards));
+
+  MappedHandFile file(path);
+  ASSERT_EQ(file.size(), written.size());
+  file.decode(1234, cards);
+  ASSERT_TRUE(std::equal(written[1234].begin(), written[1234].end(), cards));
+  std::remove(path.c_str());
+}
+
+TEST(HandFileTest, TestMaskRoundTrip) {
+  const std::string path = TempPath("mask_hands.bin");
+  auto written = WriteHoldemFile(path, HandEncoding::kMask64, 1000);
+
+  MappedHandFile file(path);
+  ASSERT_EQ(file.size(), written.size());
+
+  size_t i = 0;
+  file.forEach([&](const int* cards) {
+    // masks return the board and every player's cards sorted
+    std::vector<int>& record = written[i++];
+    std::sort(record.begin(), record.begin() + 5);
+    for (int p = 0; p < 3; p++) {
+      std::sort(record.begin() + 5 + p * 2, record.begin() + 7 + p * 2);
+    }
+    ASSERT_TRUE(std::equal(record.begin(), record.end(), cards));
+  });
+  ASSERT_EQ(i, written.size());
+  std::remove(path.c_str());
+}
+
+TEST(HandFileTest, TestEvaluateHandFile) {
+  const std::string path = TempPath("evaluate_hands.bin");
+  const auto written = WriteHoldemFile(path, HandEncoding::kPacked6, 5000);
+
+  std::vector<short> expected;
+  for (const auto& s : written) {
+    for (int p = 0; p < 3; p++) {
+      expected.push_back(evaluate_7cards(s[0], s[1], s[2], s[3], s[4],
+                                         s[5 + p * 2], s[6 + p * 2]));
+    }
+  }
+
+  MappedHandFile file(path);
+  std::vector<short> ranks(file.size() * 3);
+  ASSERT_EQ(EvaluateHandFile(file, ranks.data()), expected.size());
+  ASSERT_EQ(ranks, expected);
+
+  // the streaming reader in batches that don't divide the file
+  HandReader reader(path);
+  std::vector<short> streamed(expected.size());
+  size_t records = 0, n;
+  while ((n = EvaluateHands(reader, streamed.data() + records * 3, 777)) > 0) {
+    records += n;
+  }
+  ASSERT_EQ(records, written.size());
+  ASSERT_EQ(streamed, expected);
+
+  std::remove(path.c_str());
+}
+
+TEST(HandFileTest, TestEvaluateEightAndNineCards) {
+  const std::string path = TempPath("evaluate_big_hands.bin");
+  // 8 hole cards each, then a board and 4 hole cards each
+  const HandFileHeader headers[] = {
+      MakeHandFileHeader(HandVariant::kCards, HandEncoding::kPacked6, 0, 8, 2),
+      MakeHandFileHeader(HandVariant::kCards, HandEncoding::kMask64, 5, 4, 3),
+  };
+  for (const HandFileHeader& header : headers) {
+    std::vector<short> expected;
+    {
+      HandWriter writer(path, header);
+      for (int i = 0; i < 1000; i++) {
+        const std::vector<int> s = cs.sample(header.cards());
+        writer.write(s.data());
+        for (int p = 0; p < header.players; p++) {
+          const int* h = s.data() + header.board_cards + p * header.hole_cards;
+          expected.push_back(
+              header.board_cards == 0
+                  ? evaluate_8cards(h[0], h[1], h[2], h[3], h[4], h[5], h[6],
+                                    h[7])
+                  : evaluate_9cards(s[0], s[1], s[2], s[3], s[4], h[0], h[1],
+                                    h[2], h[3]));
+        }
+      }
+      writer.close();
+    }
+
+    MappedHandFile file(path);
+    std::vector<short> ranks(expected.size());
+    ASSERT_EQ(EvaluateHandFile(file, ranks.data()), expected.size());
+    // kMask64 records decode in id order, which doesn't change a rank
+    ASSERT_EQ(ranks, expected);
+  }
+  std::remove(path.c_str());
+}
+
+TEST(HandFileTest, TestStreamWithUnknownCount) {
+  const std::string path = TempPath("stream_hands.bin");
+  const HandFileHeader header =
+      MakeHandFileHeader(HandVariant::kCards, HandEncoding::kPacked6, 0, 7);
+  std::vector<std::vector<int>> written;
+
+  std::FILE* out = std::fopen(path.c_str(), "wb");
+  {
+    HandWriter writer(out, header);
+    for (int i = 0; i < 20000; i++) {
+      written.push_back(cs.sample(7));
+      writer.write(written.back().data());
+    }
+  }
+  std::fclose(out);
+
+  std::FILE* in = std::fopen(path.c_str(), "rb");
+  {
+    HandReader reader(in);
+    ASSERT_EQ(reader.header().count, kHandFileUnknownCount);
+    int cards[52];
+    size_t records = 0;
+    while (reader.next(cards)) {
+      ASSERT_TRUE(std::equal(written[records].begin(),
+                             written[records].end(), cards));
+      records++;
+    }
+    ASSERT_EQ(records, written.size());
+  }
+  std::fclose(in);
+
+  MappedHandFile file(path);
+  ASSERT_EQ(file.size(), written.size());
+  std::remove(path.c_str());
+}
+
+TEST(HandFileTest, TestRejectsOtherFiles) {
+  const std::string path = TempPath("not_hands.bin");
+  std::FILE* out = std::fopen(path.c_str(), "wb");
+  std::fputs("As Kd Qh Jc Ts 9s 8s and some more text", out);
+  std::fclose(out);
+
+  ASSERT_THROW(HandReader reader(path), std::runtime_error);
+  ASSERT_THROW(MappedHandFile file(path), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+static void WriteRawFile(const std::string& path, const HandFileHeader& header,
+                         const std::vector<uint64_t>& words) {
+  HandFileHeader out = header;
+  out.count = words.size() / header.words();
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  std::fwrite(&out, sizeof(out), 1, file);
+  std::fwrite(words.data(), sizeof(uint64_t), words.size(), file);
+  std::fclose(file);
+}
+
+TEST(HandFileTest, TestRejectsCorruptRecords) {
+  const HandFileHeader mask =
+      MakeHandFileHeader(HandVariant::kCards, HandEncoding::kMask64, 5, 2);
+  const HandFileHeader packed =
+      MakeHandFileHeader(HandVariant::kCards, HandEncoding::kPacked6, 0, 7);
+  const uint64_t kAll = ~0ull;
+  const std::vector<std::pair<HandFileHeader, std::vector<uint64_t>>> bad = {
+      {mask, {kAll, kAll}},               // too many cards
+      {mask, {0x1f, 0x3}},                // board and hole share cards
+      {mask, {0x1f, 0x60 | 1ull << 52}},  // a card past the deck
+      {mask, {0x1f, 0x20}},               // a hole card short
+      {packed, {kAll}},                   // ids of 63
+      {packed, {0}},                      // the two of clubs seven times
+  };
+
+  const std::string path = TempPath("corrupt_hands.bin");
+  int cards[52];
+  for (const auto& [header, words] : bad) {
+    WriteRawFile(path, header, words);
+
+    HandReader reader(path);
+    EXPECT_THROW(reader.next(cards), std::runtime_error);
+
+    MappedHandFile file(path);
+    ASSERT_EQ(file.size(), 1u);
+    EXPECT_THROW(file.decode(0, cards), std::runtime_error);
+    std::vector<short> ranks(header.players);
+    EXPECT_THROW(EvaluateHandFile(file, ranks.data()), std::runtime_error);
+  }
+
+  // the same file with a good record reads back
+  WriteRawFile(path, mask, {0x1f, 0x60});
+  MappedHandFile file(path);
+  file.decode(0, cards);
+  EXPECT_EQ(cards[4], 4);
+  EXPECT_EQ(cards[6], 6);
+  std::remove(path.c_str());
+}
+
+TEST(HandFileTest, TestWriteFailures) {
+  const HandFileHeader header =
+      MakeHandFileHeader(HandVariant::kCards, HandEncoding::kPacked6, 0, 7);
+
+  // A stream that can't be written fails on the header
+  const std::string path = TempPath("read_only_hands.bin");
+  std::FILE* out = std::fopen(path.c_str(), "wb");
+  std::fclose(out);
+  std::FILE* in = std::fopen(path.c_str(), "rb");
+  ASSERT_THROW(HandWriter writer(in, header), std::runtime_error);
+  std::fclose(in);
+  std::remove(path.c_str());
+
+  // A full disk fails on the records, and close() says so
+  std::FILE* full = std::fopen("/dev/full", "wb");
+  if (full == nullptr) GTEST_SKIP() << "no /dev/full";
+  std::fclose(full);
+  HandWriter writer("/dev/full", header);
+  const int cards[] = {0, 1, 2, 3, 4, 5, 6};
+  for (int i = 0; i < 10; i++) writer.write(cards);
+  EXPECT_THROW(writer.close(), std::runtime_error);
+}
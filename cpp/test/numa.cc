@@ -0,0 +1,133 @@
+#include <phevaluator/batch.h>
+#include <phevaluator/numa.h>
+#include <phevaluator/phevaluator.h>
+
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" const short noflush7[49205];
+
+using namespace phevaluator;
+
+namespace {
+
+// Replicate asks for two copies so a single-node machine still exercises
+// binding to a replica other than the first. Only the first call in the
+// process decides the count, hence every test goes through here.
+const int kReplicas = 2;
+
+std::vector<int> EvaluateSample() {
+  std::mt19937 rng(7);
+  std::vector<int> ranks;
+  for (int i = 0; i < 10000; i++) {
+    int cards[52];
+    for (int c = 0; c < 52; c++) cards[c] = c;
+    for (int c = 0; c < 7; c++) {
+      std::swap(cards[c], cards[c + rng() % (52 - c)]);
+    }
+    ranks.push_back(evaluate_7cards(cards[0], cards[1], cards[2], cards[3],
+                                    cards[4], cards[5], cards[6]));
+  }
+  return ranks;
+}
+
+}  // namespace
+
+TEST(NumaTest, TestDisabledBuild) {
+  if (pheval_numa_enabled()) GTEST_SKIP() << "built with PHEVAL_NUMA";
+
+  ASSERT_EQ(pheval_numa_replicate(kReplicas), 0);
+  ASSERT_EQ(pheval_numa_bind_thread(0), -1);
+  ASSERT_EQ(pheval_numa_local_table("noflush7"), nullptr);
+}
+
+TEST(NumaTest, TestUnboundThreadReadsCompiledTable) {
+  if (!pheval_numa_enabled()) GTEST_SKIP() << "built without PHEVAL_NUMA";
+
+  ASSERT_EQ(pheval_numa_replicate(kReplicas), kReplicas);
+
+  const void* local = nullptr;
+  std::thread([&local]() { local = pheval_numa_local_table("noflush7"); })
+      .join();
+  ASSERT_EQ(local, noflush7);
+}
+
+TEST(NumaTest, TestReplicasMatch) {
+  if (!pheval_numa_enabled()) GTEST_SKIP() << "built without PHEVAL_NUMA";
+
+  ASSERT_EQ(pheval_numa_replicate(kReplicas), kReplicas);
+
+  const std::vector<int> expected = EvaluateSample();
+  std::vector<const void*> copies;
+
+  for (int replica = 0; replica < kReplicas; replica++) {
+    std::thread([&, replica]() {
+      ASSERT_EQ(pheval_numa_bind_thread(replica), replica);
+
+      const void* local = pheval_numa_local_table("noflush7");
+      ASSERT_NE(local, nullptr);
+      ASSERT_EQ(std::memcmp(local, noflush7, sizeof(noflush7)), 0);
+      copies.push_back(local);
+
+      ASSERT_EQ(EvaluateSample(), expected);
+
+      pheval_numa_unbind_thread();
+      ASSERT_EQ(pheval_numa_local_table("noflush7"), noflush7);
+    }).join();
+  }
+
+  // Without libnuma every replica is the compiled-in table.
+  if (pheval_numa_available()) {
+    ASSERT_NE(copies[0], static_cast<const void*>(noflush7));
+    ASSERT_NE(copies[0], copies[1]);
+  } else {
+    ASSERT_EQ(copies[0], static_cast<const void*>(noflush7));
+    ASSERT_EQ(copies[1], static_cast<const void*>(noflush7));
+  }
+}
+
+TEST(NumaTest, TestBindOutOfRange) {
+  if (!pheval_numa_enabled()) GTEST_SKIP() << "built without PHEVAL_NUMA";
+
+  ASSERT_EQ(pheval_numa_replicate(kReplicas), kReplicas);
+  ASSERT_EQ(pheval_numa_bind_thread(kReplicas), -1);
+  ASSERT_EQ(pheval_numa_pin_thread(kReplicas), -1);
+
+  std::thread([]() {
+    const int replica = pheval_numa_bind_thread(-1);
+    ASSERT_GE(replica, 0);
+    ASSERT_LT(replica, kReplicas);
+  }).join();
+}
+
+TEST(NumaTest, TestContextKeepsThreadBinding) {
+  if (!pheval_numa_enabled()) GTEST_SKIP() << "built without PHEVAL_NUMA";
+
+  ASSERT_EQ(pheval_numa_replicate(kReplicas), kReplicas);
+
+  pheval_context* context = pheval_context_create(&pheval_engine_7cards);
+  ASSERT_NE(context, nullptr);
+  ASSERT_EQ(pheval_context_set_numa_replica(context, 0), 0);
+  ASSERT_EQ(pheval_context_set_numa_replica(context, kReplicas), -1);
+  const uint8_t hand[7] = {0, 5, 10, 15, 20, 25, 30};
+  int16_t rank = 0;
+
+  // A thread bound to another replica, as in a pinned pool, stays bound
+  std::thread([&]() {
+    ASSERT_EQ(pheval_numa_bind_thread(1), 1);
+    pheval_context_evaluate(context, hand, 1, 0, &rank);
+    EXPECT_EQ(pheval_numa_bound_replica(), 1);
+    pheval_numa_unbind_thread();
+    pheval_context_evaluate(context, hand, 1, 0, &rank);
+    EXPECT_EQ(pheval_numa_bound_replica(), -1);
+    EXPECT_EQ(pheval_numa_local_table("noflush7"),
+              static_cast<const void*>(noflush7));
+  }).join();
+  EXPECT_EQ(rank, evaluate_7cards(0, 5, 10, 15, 20, 25, 30));
+
+  pheval_context_destroy(context);
+}
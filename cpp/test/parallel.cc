@@ -0,0 +1,92 @@
+#include <phevaluator/batch.h>
+#include <phevaluator/card_sampler.h>
+#include <phevaluator/parallel.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+TEST(ParallelTest, TestEveryChunkOnce) {
+  ThreadPool pool(4);
+  EXPECT_EQ(pool.threads(), 4);
+
+  const size_t kChunks = 1000;
+  std::vector<std::atomic<int>> calls(kChunks);
+  std::atomic<int> bad_worker{0};
+  pool.parallelFor(kChunks, [&](size_t chunk, int worker) {
+    // Uneven work, so the other threads steal from the first one
+    if (chunk < 10) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    if (worker < 0 || worker >= 4) bad_worker++;
+    calls[chunk]++;
+  });
+  for (size_t i = 0; i < kChunks; i++) ASSERT_EQ(calls[i], 1) << i;
+  EXPECT_EQ(bad_worker, 0);
+
+  // Many short calls on the same pool
+  std::atomic<size_t> total{0};
+  for (int i = 0; i < 2000; i++) {
+    pool.parallelFor(3, [&](size_t chunk, int) { total += chunk + 1; });
+  }
+  EXPECT_EQ(total, 2000u * 6);
+}
+
+TEST(ParallelTest, TestErrors) {
+  ThreadPool pool(3);
+  std::atomic<int> calls{0};
+  EXPECT_THROW(pool.parallelFor(100,
+                                [&](size_t chunk, int) {
+                                  calls++;
+                                  if (chunk == 42) {
+                                    throw std::runtime_error("chunk failed");
+                                  }
+                                }),
+               std::runtime_error);
+  EXPECT_EQ(calls, 100);
+
+  // The pool is still usable
+  calls = 0;
+  pool.parallelFor(10, [&](size_t, int) { calls++; });
+  EXPECT_EQ(calls, 10);
+}
+
+TEST(ParallelTest, TestParallelEvaluate) {
+  card_sampler::CardSampler cs(40);
+  const size_t n = 100003;
+  std::vector<uint8_t> hands(n * 7);
+  int ids[7];
+  for (size_t i = 0; i < n; i++) {
+    cs.sample_into(ids, 7);
+    for (int k = 0; k < 7; k++) hands[i * 7 + k] = ids[k];
+  }
+  hands[7 * 500] = 99;
+  hands[7 * 90000 + 1] = hands[7 * 90000];
+
+  std::vector<int16_t> expected(n);
+  EXPECT_EQ(evaluate_7cards_batch(hands.data(), n, 0, expected.data()), 2u);
+
+  ThreadPool pool(4);
+  // Output starting mid-line, chunks not a multiple of the line
+  std::vector<int16_t> buffer(n + 1);
+  int16_t* out = buffer.data() + 1;
+  EXPECT_EQ(ParallelEvaluate(pool, pheval_engine_7cards, hands.data(), n, 0,
+                             out, 1000),
+            2u);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out));
+
+  std::fill(buffer.begin(), buffer.end(), 0);
+  EXPECT_EQ(ParallelEvaluate(pool, pheval_engine_7cards, hands.data(), n, 7,
+                             buffer.data()),
+            2u);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), buffer.begin()));
+
+  EXPECT_EQ(ParallelEvaluate(pool, pheval_engine_7cards, hands.data(), 0, 0,
+                             out),
+            0u);
+}
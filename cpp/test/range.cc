@@ -0,0 +1,106 @@
+#include <phevaluator/combinations.h>
+#include <phevaluator/range.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+TEST(RangeTest, TestHandOrder) {
+  // Hand i is the i-th subset of Combinations(2)
+  const Combinations pairs(2);
+  for (int i = 0; i < HoldemRange::kHands; i++) {
+    const std::array<uint8_t, 2>& cards = HoldemRange::kHandCards[i];
+    ASSERT_LT(cards[0], cards[1]);
+    ASSERT_EQ(HoldemRange::Index(cards[0], cards[1]), i);
+    ASSERT_EQ(HoldemRange::Index(cards[1], cards[0]), i);
+    ASSERT_EQ(pairs.unrank(i),
+              (uint64_t(1) << cards[0]) | (uint64_t(1) << cards[1]));
+  }
+
+  std::vector<int> seen;
+  HoldemRange::Parse("AKs, 22").forEach(
+      [&](int index, int a, int b, double weight) {
+        EXPECT_EQ(HoldemRange::Index(a, b), index);
+        EXPECT_EQ(weight, 1.0);
+        seen.push_back(index);
+      });
+  ASSERT_EQ(seen.size(), 10u);
+  EXPECT_TRUE(std::is_sorted(seen.begin(), seen.end()));
+}
+
+TEST(RangeTest, TestParse) {
+  EXPECT_EQ(HoldemRange::Parse("AKs").size(), 4);
+  EXPECT_EQ(HoldemRange::Parse("AKo").size(), 12);
+  EXPECT_EQ(HoldemRange::Parse("KA").size(), 16);
+  EXPECT_EQ(HoldemRange::Parse("TT").size(), 6);
+  EXPECT_EQ(HoldemRange::Parse("TT+").size(), 30);
+  EXPECT_EQ(HoldemRange::Parse("22+").size(), 78);
+  EXPECT_EQ(HoldemRange::Parse("TT-77").size(), 24);
+  EXPECT_EQ(HoldemRange::Parse("77-TT"), HoldemRange::Parse("77,88,99,TT"));
+  EXPECT_EQ(HoldemRange::Parse("A5s-A2s").size(), 16);
+  EXPECT_EQ(HoldemRange::Parse("ATs+"), HoldemRange::Parse("ATs-AKs"));
+  EXPECT_EQ(HoldemRange::Parse("KTo+").size(), 36);
+  EXPECT_EQ(HoldemRange::Parse("AhKh").size(), 1);
+  EXPECT_TRUE(HoldemRange::Parse("AhKh").contains(
+      HoldemRange::Index(Card("Ah"), Card("Kh"))));
+  EXPECT_TRUE(HoldemRange::Parse(" ,\n").empty());
+  EXPECT_EQ(HoldemRange::Parse("AKs, TT+,\tA5s-A2s KQo:0.5").size(),
+            4 + 30 + 16 + 12);
+
+  const HoldemRange weighted = HoldemRange::Parse("KQo:0.5, AA:2, 22");
+  EXPECT_EQ(weighted.weight(HoldemRange::Index(Card("Kc"), Card("Qd"))), 0.5);
+  EXPECT_EQ(weighted.weight(HoldemRange::Index(Card("Ac"), Card("Ad"))), 2.0);
+  EXPECT_EQ(weighted.weight(HoldemRange::Index(Card("2c"), Card("2d"))), 1.0);
+  EXPECT_EQ(weighted.weight(HoldemRange::Index(Card("Kc"), Card("Qc"))), 0.0);
+  EXPECT_DOUBLE_EQ(weighted.totalWeight(), 6 + 12 + 6);
+
+  for (const char* bad : {"AKx", "A", "AAs", "TT+3", "A5s-K2s", "A5s-A2o",
+                          "TT-A5", "AhAh", "AK:", "AK:0", "AK:x", "XY"}) {
+    EXPECT_THROW(HoldemRange::Parse(bad), std::invalid_argument) << bad;
+  }
+}
+
+TEST(RangeTest, TestSetOperations) {
+  EXPECT_EQ(HoldemRange::All().size(), 1326);
+
+  // Each card is in 51 hands, and two cards share one
+  const uint64_t dead =
+      (uint64_t(1) << Card("As")) | (uint64_t(1) << Card("Ks"));
+  EXPECT_EQ(HoldemRange::All().without(dead).size(), 1326 - 51 - 51 + 1);
+  EXPECT_EQ(HoldemRange::Parse("AK").without(dead).size(), 9);
+  EXPECT_EQ(HoldemRange::Parse("AKs").without(dead).size(), 3);
+
+  const HoldemRange a = HoldemRange::Parse("AA:0.5, KK");
+  const HoldemRange b = HoldemRange::Parse("AA, QQ:0.25");
+  const HoldemRange both = a | b;
+  EXPECT_EQ(both.size(), 18);
+  EXPECT_EQ(both.weight(HoldemRange::Index(0, 1)), 0.0);  // 2c2d
+  EXPECT_EQ(both.weight(HoldemRange::Index(Card("Ac"), Card("Ad"))), 1.0);
+  EXPECT_EQ(both.weight(HoldemRange::Index(Card("Qc"), Card("Qd"))), 0.25);
+
+  const HoldemRange common = a & b;
+  EXPECT_EQ(common.size(), 6);
+  EXPECT_EQ(common.weight(HoldemRange::Index(Card("Ac"), Card("Ad"))), 0.5);
+  EXPECT_NE(common, HoldemRange::Parse("AA"));
+  EXPECT_EQ(common, HoldemRange::Parse("AA:0.5"));
+
+  // A range without weights has weight 1 on either side
+  const int ak = HoldemRange::Index(Card("Ah"), Card("Kh"));
+  const HoldemRange heavy = HoldemRange::Parse("AKs:2");
+  const HoldemRange plain = HoldemRange::Parse("AKs");
+  EXPECT_EQ((heavy & plain).weight(ak), 1.0);
+  EXPECT_EQ((plain & heavy).weight(ak), 1.0);
+  EXPECT_EQ((heavy | plain).weight(ak), 2.0);
+  EXPECT_EQ((plain | heavy).weight(ak), 2.0);
+
+  HoldemRange range = HoldemRange::Parse("AKs");
+  range.remove(Card("As"), Card("Ks"));
+  EXPECT_EQ(range.size(), 3);
+  EXPECT_EQ(range.toHandRange().combos().size(), 3u);
+  EXPECT_THROW(range.add(3, 3), std::invalid_argument);
+  EXPECT_THROW(range.add(3, 4, -1), std::invalid_argument);
+}
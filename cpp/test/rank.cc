@@ -1,4 +1,5 @@
 #include <phevaluator/phevaluator.h>
+#include <phevaluator/rank_distribution.h>
 
 #include <algorithm>
 #include <cassert>
@@ -9,6 +10,8 @@
 
 using namespace phevaluator;
 
+extern "C" const char* rank_description[7463][2];
+
 TEST(RankTest, TestValue) {
   Rank a = EvaluateCards("9c", "4c", "4s", "9d", "4h");
   Rank b = EvaluateCards("9c", "4c", "4s", "9d", "9h");
@@ -345,3 +348,75 @@ TEST(RankTest, TestRankDescriptionHighCards) {
   ASSERT_FALSE(b.isFlush());
   ASSERT_FALSE(c.isFlush());
 }
+
+TEST(RankTest, TestRankInfoMatchesLegacyDescriptions) {
+  for (int value = 1; value <= 7462; value++) {
+    Rank rank(value);
+
+    ASSERT_EQ(rank.describeRankView(), rank_description[value][1]);
+    ASSERT_EQ(rank.describeSampleHandView(), rank_description[value][0]);
+    ASSERT_EQ(rank.describeCategoryView(),
+              describe_rank_category(rank.category()));
+    ASSERT_EQ(rank.isFlush(), rank.category() == rank_category::FLUSH ||
+                                  rank.category() == rank_category::STRAIGHT_FLUSH);
+  }
+}
+
+TEST(RankTest, TestRankInfoPrimaryAndKicker) {
+  Rank a = EvaluateCards("Ac", "Ad", "As", "Ah", "Ks");
+  Rank b = EvaluateCards("7h", "8s", "8h", "8c", "7d");
+  Rank c = EvaluateCards("9s", "7d", "9d", "7s", "Ah");
+  Rank d = EvaluateCards("6h", "5s", "4s", "3d", "2c");
+  Rank e = EvaluateCards("Qs", "3c", "Ah", "Kc", "2d");
+
+  ASSERT_EQ(a.primaryRank(), 12);
+  ASSERT_EQ(a.kickerRank(), 11);
+  ASSERT_EQ(b.primaryRank(), 6);
+  ASSERT_EQ(b.kickerRank(), 5);
+  ASSERT_EQ(c.primaryRank(), 7);
+  ASSERT_EQ(c.kickerRank(), 5);
+  ASSERT_EQ(d.primaryRank(), 4);
+  ASSERT_EQ(d.kickerRank(), 4);
+  ASSERT_EQ(e.primaryRank(), 12);
+  ASSERT_EQ(e.kickerRank(), 11);
+}
+
+TEST(RankTest, TestRankDistributionCategoryTotals) {
+  // Known number of 7-card hands per category, from straight flush to high card
+  const unsigned long long expected[10] = {
+      0,        41584,    224848,   3473184,  4047644,
+      6180020,  6461620,  31433400, 58627800, 23294460,
+  };
+  unsigned long long totals[10] = {0};
+
+  for (int value = 1; value <= 7462; value++) {
+    totals[get_rank_category(value)] +=
+        rank_frequency(RANK_VARIANT_7CARDS, value);
+  }
+
+  for (int category = 1; category <= 9; category++) {
+    ASSERT_EQ(totals[category], expected[category]);
+  }
+  ASSERT_EQ(rank_frequency_total[RANK_VARIANT_5CARDS], 2598960u);
+  ASSERT_EQ(rank_frequency_total[RANK_VARIANT_6CARDS], 20358520u);
+  ASSERT_EQ(rank_frequency_total[RANK_VARIANT_7CARDS], 133784560u);
+  ASSERT_EQ(rank_frequency_total[RANK_VARIANT_PLO4],
+            RANK_DISTRIBUTION_PLO4_SAMPLES);
+}
+
+TEST(RankTest, TestRankPercentile) {
+  for (int variant = 0; variant < RANK_VARIANT_COUNT; variant++) {
+    const enum rank_variant v = static_cast<enum rank_variant>(variant);
+
+    ASSERT_FLOAT_EQ(rank_percentile(v, 1), 1.0f);
+    for (int value = 2; value <= 7462; value++) {
+      ASSERT_LE(rank_percentile(v, value), rank_percentile(v, value - 1));
+    }
+  }
+
+  // Every 5-card rank occurs 4 times (or 1020 times for non-flush hands)
+  Rank worst = EvaluateCards("7c", "5d", "4h", "3s", "2c");
+  ASSERT_EQ(RankFrequency(RANK_VARIANT_5CARDS, worst), 1020u);
+  ASSERT_FLOAT_EQ(RankPercentile(RANK_VARIANT_5CARDS, worst),
+                  1020.0f / 2598960.0f);
+}
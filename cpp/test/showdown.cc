@@ -0,0 +1,103 @@
+#include <phevaluator/card_sampler.h>
+#include <phevaluator/phevaluator.h>
+#include <phevaluator/showdown.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+TEST(ShowdownTest, TestOrder) {
+  const Board board = Board::Parse("Ah Kh 7c 7d 2s");
+  const ShowdownTable table(board);
+  EXPECT_EQ(table.size(), 1081);  // C(47, 2)
+
+  const uint8_t* b = board.data();
+  for (int i = 0; i < table.size(); i++) {
+    const int hand = table.hands()[i];
+    const std::array<uint8_t, 2>& cards = HoldemRange::kHandCards[hand];
+    ASSERT_EQ(table.rankAt(i), evaluate_7cards(b[0], b[1], b[2], b[3], b[4],
+                                               cards[0], cards[1]));
+    ASSERT_EQ(table.positionOf(hand), i);
+    if (i > 0) {
+      ASSERT_LE(table.rankAt(i), table.rankAt(i - 1));
+    }
+  }
+  EXPECT_EQ(table.positionOf(HoldemRange::Index(Card("Ah"), Card("2c"))), -1);
+
+  // Groups cover the list and hold exactly the runs of equal ranks
+  EXPECT_EQ(table.groupBegin(0), 0);
+  EXPECT_EQ(table.groupBegin(table.groups()), table.size());
+  for (int g = 0; g < table.groups(); g++) {
+    const int begin = table.groupBegin(g), end = table.groupBegin(g + 1);
+    ASSERT_LT(begin, end);
+    for (int i = begin; i < end; i++) {
+      ASSERT_EQ(table.rankAt(i), table.rankAt(begin));
+    }
+    if (g > 0) {
+      ASSERT_NE(table.rankAt(begin), table.rankAt(begin - 1));
+    }
+  }
+  // The nuts are the other two sevens
+  const std::array<uint8_t, 2>& best =
+      HoldemRange::kHandCards[table.hands()[table.size() - 1]];
+  EXPECT_EQ(best[0] >> 2, 5);
+  EXPECT_EQ(best[1] >> 2, 5);
+
+  EXPECT_EQ(table.blockers(Card("2c")), 46);
+  EXPECT_EQ(table.blockers(Card("2s")), 0);
+
+  const ShowdownTable pairs(board, HoldemRange::Parse("QQ, JJ, 22"));
+  EXPECT_EQ(pairs.size(), 15);
+  EXPECT_EQ(pairs.groups(), 3);
+  EXPECT_EQ(pairs.blockers(Card("Qc")), 3);
+
+  EXPECT_THROW(ShowdownTable(Board::Parse("Ah Kh 7c")), std::invalid_argument);
+}
+
+TEST(ShowdownTest, TestShowdownAgainstEveryHand) {
+  card_sampler::CardSampler sampler(17);
+  const HoldemRange hero = HoldemRange::Parse("22+, A2s+, KTs+, ATo+, KQo");
+  const HoldemRange villain =
+      HoldemRange::Parse("88+, AJs+, KQs, AKo, 76s:0.5, 54s:0.25");
+  std::vector<double> weights(HoldemRange::kHands);
+  for (int i = 0; i < HoldemRange::kHands; i++) {
+    weights[i] = villain.weight(i);
+  }
+
+  ShowdownTable table;
+  std::vector<double> beaten(HoldemRange::kHands), tied(HoldemRange::kHands),
+      faced(HoldemRange::kHands), payoff(HoldemRange::kHands);
+  for (int trial = 0; trial < 20; trial++) {
+    int c[5];
+    sampler.sample_into(c, 5);
+    const uint8_t board[5] = {uint8_t(c[0]), uint8_t(c[1]), uint8_t(c[2]),
+                              uint8_t(c[3]), uint8_t(c[4])};
+    table.setBoard(board, hero | villain);
+    table.showdown(weights.data(), beaten.data(), tied.data(), faced.data());
+    table.payoffs(weights.data(), payoff.data());
+
+    uint64_t board_mask = 0;
+    for (int card : c) board_mask |= uint64_t(1) << card;
+    hero.forEach([&](int h, int a, int b, double) {
+      double win = 0, tie = 0, total = 0;
+      if (!((board_mask >> a | board_mask >> b) & 1)) {
+        const int rank = evaluate_7cards(c[0], c[1], c[2], c[3], c[4], a, b);
+        villain.without(board_mask | uint64_t(1) << a | uint64_t(1) << b)
+            .forEach([&](int, int x, int y, double w) {
+              const int other =
+                  evaluate_7cards(c[0], c[1], c[2], c[3], c[4], x, y);
+              win += rank < other ? w : 0;
+              tie += rank == other ? w : 0;
+              total += w;
+            });
+      }
+      ASSERT_DOUBLE_EQ(beaten[h], win);
+      ASSERT_DOUBLE_EQ(tied[h], tie);
+      ASSERT_DOUBLE_EQ(faced[h], total);
+      ASSERT_NEAR(payoff[h], win - (total - win - tie), 1e-9);
+    });
+  }
+}
@@ -0,0 +1,102 @@
+#include <phevaluator/phevaluator.h>
+#include <phevaluator/heatmap.h>
+#include <phevaluator/stats.h>
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace phevaluator;
+
+TEST(StatsTest, TestDisabledBuildIsEmpty) {
+  if (pheval_stats_enabled()) GTEST_SKIP() << "built with PHEVAL_STATS";
+
+  struct pheval_stats stats;
+  EvaluateCards("9c", "4c", "4s", "9d", "4h", "Qc", "6c");
+  pheval_stats_snapshot(&stats);
+
+  ASSERT_EQ(stats.evaluator[PHEVAL_STATS_7CARDS].calls, 0u);
+  ASSERT_EQ(stats.quinary_calls, 0u);
+}
+
+TEST(StatsTest, TestSevenCardCounters) {
+  if (!pheval_stats_enabled()) GTEST_SKIP() << "built without PHEVAL_STATS";
+
+  struct pheval_stats stats;
+  pheval_stats_reset();
+
+  EvaluateCards("9c", "4c", "4s", "9d", "4h", "Qc", "6c");  // full house
+  EvaluateCards("As", "Ks", "Qs", "Js", "9s", "2d", "3h");  // flush
+  pheval_stats_snapshot(&stats);
+
+  const struct pheval_stats_counters& seven =
+      stats.evaluator[PHEVAL_STATS_7CARDS];
+  ASSERT_EQ(seven.calls, 2u);
+  ASSERT_EQ(seven.flush_hits, 1u);
+  ASSERT_EQ(seven.noflush_only, 1u);
+
+  unsigned long long regions = 0;
+  for (int i = 0; i < PHEVAL_STATS_REGIONS; i++) regions += seven.region_hits[i];
+  ASSERT_EQ(regions, 1u);
+
+  unsigned long long depths = 0;
+  for (int i = 0; i < 14; i++) depths += stats.quinary_depth[i];
+  ASSERT_EQ(stats.quinary_calls, 1u);
+  ASSERT_EQ(depths, 1u);
+}
+
+TEST(StatsTest, TestCountersFromAllThreads) {
+  if (!pheval_stats_enabled()) GTEST_SKIP() << "built without PHEVAL_STATS";
+
+  struct pheval_stats stats;
+  pheval_stats_reset();
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < 1000; i++) {
+        evaluate_5cards(t, 8 + t, 16 + t, 24 + t, 33);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  pheval_stats_snapshot(&stats);
+  ASSERT_EQ(stats.evaluator[PHEVAL_STATS_5CARDS].calls, 4000u);
+
+  pheval_stats_reset();
+  pheval_stats_snapshot(&stats);
+  ASSERT_EQ(stats.evaluator[PHEVAL_STATS_5CARDS].calls, 0u);
+}
+
+TEST(HeatmapTest, TestDisabledBuildIsEmpty) {
+  if (pheval_heatmap_enabled()) GTEST_SKIP() << "built with PHEVAL_HEATMAP";
+
+  EvaluateCards("9c", "4c", "4s", "9d", "4h", "Qc", "6c");
+  ASSERT_EQ(pheval_heatmap_lines(PHEVAL_HEATMAP_NOFLUSH7), 0u);
+}
+
+TEST(HeatmapTest, TestSevenCardLines) {
+  if (!pheval_heatmap_enabled()) GTEST_SKIP() << "built without PHEVAL_HEATMAP";
+
+  pheval_heatmap_reset();
+  EvaluateCards("9c", "4c", "4s", "9d", "4h", "Qc", "6c");  // full house
+  EvaluateCards("As", "Ks", "Qs", "Js", "9s", "2d", "3h");  // flush
+  EvaluateCards("2c", "3d", "4h", "5s", "7c", "8d", "Th");  // high card
+
+  // noflush7 holds 49205 shorts
+  const size_t lines = pheval_heatmap_lines(PHEVAL_HEATMAP_NOFLUSH7);
+  ASSERT_GE(lines, 49205 * sizeof(short) / PHEVAL_HEATMAP_LINE_SIZE);
+  ASSERT_LE(lines, 49205 * sizeof(short) / PHEVAL_HEATMAP_LINE_SIZE + 2);
+
+  std::vector<unsigned long long> counts(lines);
+  pheval_heatmap_snapshot(PHEVAL_HEATMAP_NOFLUSH7, counts.data());
+  unsigned long long total = 0;
+  for (auto c : counts) total += c;
+  ASSERT_EQ(total, 2u);
+
+  pheval_heatmap_reset();
+  pheval_heatmap_snapshot(PHEVAL_HEATMAP_NOFLUSH7, counts.data());
+  for (auto c : counts) ASSERT_EQ(c, 0u);
+}
@@ -0,0 +1,183 @@
+/*
+gen_rank_distribution.cc
+Regenerates math/combinatorics/rank_distribution.c: the frequency and
+cumulative percentile of every rank across all 5-, 6- and 7-card hands, and
+across RANK_DISTRIBUTION_PLO4_SAMPLES random PLO4 deals.
+Compile:
+  //in the cpp directory of the project, after building the library
+  g++ -std=c++17 -O3 -pthread -I./include -o tools/gen_rank_distribution tools/gen_rank_distribution.cc -L. -lpheval -lphevalplo4
+Run: (the number of threads is optional, defaults to all cores)
+  ./tools/gen_rank_distribution [threads] > math/combinatorics/rank_distribution.c
+
+The work is split into fixed units (one per first card for the exhaustive
+variants, fixed-seed chunks for PLO4) that threads pull from a shared counter,
+so the output is identical whatever the thread count.
+*/
+
+#include <phevaluator/phevaluator.h>
+#include <phevaluator/rank_distribution.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using Counts = std::array<uint64_t, 7463>;
+
+static const int kPlo4Chunks = 256;
+
+static void CountFiveCards(int a, Counts& counts) {
+  for (int b = a + 1; b < 49; b++)
+    for (int c = b + 1; c < 50; c++)
+      for (int d = c + 1; d < 51; d++)
+        for (int e = d + 1; e < 52; e++)
+          counts[evaluate_5cards(a, b, c, d, e)]++;
+}
+
+static void CountSixCards(int a, Counts& counts) {
+  for (int b = a + 1; b < 48; b++)
+    for (int c = b + 1; c < 49; c++)
+      for (int d = c + 1; d < 50; d++)
+        for (int e = d + 1; e < 51; e++)
+          for (int f = e + 1; f < 52; f++)
+            counts[evaluate_6cards(a, b, c, d, e, f)]++;
+}
+
+static void CountSevenCards(int a, Counts& counts) {
+  for (int b = a + 1; b < 47; b++)
+    for (int c = b + 1; c < 48; c++)
+      for (int d = c + 1; d < 49; d++)
+        for (int e = d + 1; e < 50; e++)
+          for (int f = e + 1; f < 51; f++)
+            for (int g = f + 1; g < 52; g++)
+              counts[evaluate_7cards(a, b, c, d, e, f, g)]++;
+}
+
+// Unbiased draw in [0, bound), only relies on the fully specified mt19937_64
+// output so that the table is the same with any standard library.
+static int Bounded(std::mt19937_64& generator, uint64_t bound) {
+  const uint64_t limit = UINT64_MAX - UINT64_MAX % bound;
+  uint64_t x;
+  do {
+    x = generator();
+  } while (x >= limit);
+  return static_cast<int>(x % bound);
+}
+
+static void CountPlo4Chunk(int chunk, Counts& counts) {
+  std::mt19937_64 generator(0x9E3779B97F4A7C15ull * (chunk + 1));
+  std::array<int, 52> deck;
+  for (int i = 0; i < 52; i++) deck[i] = i;
+
+  const unsigned samples = RANK_DISTRIBUTION_PLO4_SAMPLES / kPlo4Chunks;
+  for (unsigned n = 0; n < samples; n++) {
+    // Partial Fisher-Yates, the 9 dealt cards end up at the tail of the deck
+    for (int i = 0; i < 9; i++) {
+      const int tail = 51 - i;
+      std::swap(deck[Bounded(generator, tail + 1)], deck[tail]);
+    }
+    counts[evaluate_plo4_cards(deck[51], deck[50], deck[49], deck[48],
+                               deck[47], deck[46], deck[45], deck[44],
+                               deck[43])]++;
+  }
+}
+
+static Counts Run(int units, void (*work)(int, Counts&), int threads) {
+  Counts total{};
+  std::atomic<int> next{0};
+  std::mutex merge;
+
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back([&]() {
+      Counts local{};
+      for (int unit = next++; unit < units; unit = next++) work(unit, local);
+
+      std::lock_guard<std::mutex> lock(merge);
+      for (int r = 0; r < 7463; r++) total[r] += local[r];
+    });
+  }
+  for (auto& thread : pool) thread.join();
+
+  return total;
+}
+
+int main(int argc, char** argv) {
+  int threads = std::thread::hardware_concurrency();
+  if (argc > 1) threads = std::atoi(argv[1]);
+  if (threads < 1) threads = 1;
+
+  const std::array<Counts, RANK_VARIANT_COUNT> counts = {
+      Run(48, CountFiveCards, threads),
+      Run(47, CountSixCards, threads),
+      Run(46, CountSevenCards, threads),
+      Run(kPlo4Chunks, CountPlo4Chunk, threads),
+  };
+  const char* names[RANK_VARIANT_COUNT] = {"5 cards", "6 cards", "7 cards",
+                                           "PLO4"};
+
+  std::printf(
+      "/* Generated by tools/gen_rank_distribution.cc, do not edit by hand. "
+      "*/\n\n");
+  std::printf("#include <phevaluator/rank_distribution.h>\n\n");
+
+  std::array<uint64_t, RANK_VARIANT_COUNT> totals{};
+  std::printf(
+      "const unsigned int "
+      "rank_frequency_table[RANK_VARIANT_COUNT][7463] = {\n");
+  for (int v = 0; v < RANK_VARIANT_COUNT; v++) {
+    std::printf("    /* %s */\n    {", names[v]);
+    for (int r = 0; r < 7463; r++) {
+      totals[v] += counts[v][r];
+      if (r % 8 == 0) std::printf("\n        ");
+      std::printf("%llu,", static_cast<unsigned long long>(counts[v][r]));
+      if (r % 8 != 7 && r != 7462) std::printf(" ");
+    }
+    std::printf("\n    },\n");
+  }
+  std::printf("};\n\n");
+
+  std::printf(
+      "const unsigned int rank_frequency_total[RANK_VARIANT_COUNT] = {\n");
+  for (int v = 0; v < RANK_VARIANT_COUNT; v++) {
+    std::printf("    %llu, /* %s */\n",
+                static_cast<unsigned long long>(totals[v]), names[v]);
+  }
+  std::printf("};\n\n");
+
+  std::printf(
+      "const float rank_percentile_table[RANK_VARIANT_COUNT][7463] = {\n");
+  for (int v = 0; v < RANK_VARIANT_COUNT; v++) {
+    std::array<double, 7463> percentile{};
+    uint64_t cumulative = 0;
+    for (int r = 7462; r >= 1; r--) {
+      cumulative += counts[v][r];
+      percentile[r] = static_cast<double>(cumulative) / totals[v];
+    }
+
+    std::printf("    /* %s */\n    {", names[v]);
+    for (int r = 0; r < 7463; r++) {
+      if (r % 6 == 0) std::printf("\n        ");
+      std::printf("%.9g,", percentile[r]);
+      if (r % 6 != 5 && r != 7462) std::printf(" ");
+    }
+    std::printf("\n    },\n");
+  }
+  std::printf("};\n\n");
+
+  std::printf(
+      "unsigned int rank_frequency(enum rank_variant variant, int rank) {\n"
+      "  return rank_frequency_table[variant][rank];\n"
+      "}\n\n"
+      "float rank_percentile(enum rank_variant variant, int rank) {\n"
+      "  return rank_percentile_table[variant][rank];\n"
+      "}\n");
+
+  return 0;
+}
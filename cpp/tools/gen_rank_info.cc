@@ -0,0 +1,109 @@
+/*
+gen_rank_info.cc
+Regenerates math/combinatorics/rank_info.c from the rank_description table in
+math/combinatorics/7462.c.
+Compile:
+  //in the cpp directory of the project
+  g++ -std=c++17 -O2 -I./include -o tools/gen_rank_info tools/gen_rank_info.cc math/combinatorics/7462.c
+Run:
+  ./tools/gen_rank_info > math/combinatorics/rank_info.c
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "../database/tables/tables.h"
+}
+
+// Same boundaries the old compare chain in rank.c used, kept here so the
+// generated table is the single place the library needs them.
+static int category_of(int rank) {
+  if (rank == 0) return 0;
+  if (rank > 6185) return 9;  // HIGH_CARD
+  if (rank > 3325) return 8;  // ONE_PAIR
+  if (rank > 2467) return 7;  // TWO_PAIR
+  if (rank > 1609) return 6;  // THREE_OF_A_KIND
+  if (rank > 1599) return 5;  // STRAIGHT
+  if (rank > 322) return 4;   // FLUSH
+  if (rank > 166) return 3;   // FULL_HOUSE
+  if (rank > 10) return 2;    // FOUR_OF_A_KIND
+  return 1;                   // STRAIGHT_FLUSH
+}
+
+static int rank_index(char c) {
+  static const char ranks[] = "23456789TJQKA";
+  return static_cast<int>(std::strchr(ranks, c) - ranks);
+}
+
+int main() {
+  // Unique descriptions, in order of first appearance
+  std::string pool;
+  std::map<std::string, size_t> offsets;
+  std::vector<size_t> description_offset(7463);
+
+  for (int rank = 0; rank < 7463; rank++) {
+    const std::string description = rank_description[rank][1];
+    auto it = offsets.find(description);
+    if (it == offsets.end()) {
+      it = offsets.emplace(description, pool.size()).first;
+      pool += description;
+      pool += '\0';
+    }
+    description_offset[rank] = it->second;
+  }
+
+  std::printf("/* Generated by tools/gen_rank_info.cc, do not edit by hand. */\n\n");
+  std::printf("#include <phevaluator/rank.h>\n\n");
+
+  // One NUL-terminated description per line, the literal adds the final NUL
+  std::printf("const char rank_description_pool[%zu] =\n", pool.size() + 1);
+  for (size_t begin = 0; begin < pool.size();) {
+    const size_t end = pool.find('\0', begin);
+    std::printf("    \"%s\\0\"\n", pool.substr(begin, end - begin).c_str());
+    begin = end + 1;
+  }
+  std::printf("    ;\n\n");
+
+  std::printf("const char rank_sample_pool[7463][6] = {\n");
+  for (int rank = 0; rank < 7463; rank++) {
+    std::printf("    \"%s\",\n", rank_description[rank][0]);
+  }
+  std::printf("};\n\n");
+
+  std::printf(
+      "/* category, flush, primary, kicker, description offset, length */\n");
+  std::printf("const struct rank_info rank_info_table[7463] = {\n");
+  for (int rank = 0; rank < 7463; rank++) {
+    const int category = category_of(rank);
+    const char* sample = rank_description[rank][0];
+    int primary = 0;
+    int kicker = 0;
+
+    if (rank > 0) {
+      primary = rank_index(sample[0]);
+      kicker = primary;
+      // Straights have no kicker, everything else takes the first card
+      // outside the primary group.
+      if (category != 1 && category != 5) {
+        for (int i = 1; i < 5; i++) {
+          if (sample[i] != sample[0]) {
+            kicker = rank_index(sample[i]);
+            break;
+          }
+        }
+      }
+    }
+
+    std::printf("    {%d, %d, %2d, %2d, %4zu, %2zu, 0},\n", category,
+                category == 1 || category == 4, primary, kicker,
+                description_offset[rank],
+                std::strlen(rank_description[rank][1]));
+  }
+  std::printf("};\n");
+
+  return 0;
+}
@@ -0,0 +1,351 @@
+/*
+optimize_table_layout.cc
+Offline layout optimiser for the noflush lookup tables.
+
+The noflush tables are indexed by hash_quinary, which orders the rank
+multisets lexicographically with the deuce as the most significant digit.
+Relabelling the ranks before hashing (card id -> slot instead of id >> 2)
+permutes the table without changing the hash function or its dp constants,
+so a layout chosen here costs one 52-byte table lookup per card at run time.
+
+For noflush7 the tool searches the rank relabelling that needs the fewest
+cache lines for a workload, prints the heatmap numbers before and after, and
+can emit the permuted table. For noflush_plo4 (board_hash * 1820 + hole_hash)
+it compares the board-major layout in use against a hole-major one
+(hole_hash * 6175 + board_hash), which is only a change of the two stride
+constants.
+
+Compile:
+  //in the cpp directory of the project
+  g++ -std=c++17 -O3 -I./include -o tools/optimize_table_layout tools/optimize_table_layout.cc math/hash/hash.c math/combinatorics/dptable.c database/tables/hashtable7.c
+Run:
+  ./tools/optimize_table_layout random7 [hands]      uniform random 7-card hands
+  ./tools/optimize_table_layout holdem [boards]      every holding on random boards
+  ./tools/optimize_table_layout file hands.txt       7 card ids per line, a blank
+                                                     line starts a new group
+  add --emit noflush7_relaid.c to write the chosen layout as C source
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "../database/tables/tables.h"
+#include "../math/hash/hash.h"
+}
+
+using Quinary = std::array<unsigned char, 13>;
+using Permutation = std::array<int, 13>;  // rank -> slot
+
+static const int kEntriesPerLine = 64 / sizeof(short);
+
+struct Access {
+  Quinary quinary;
+  int group;
+};
+
+// Returns false for hands that take the flush path and never read noflush7
+static bool ToQuinary(const int* cards, Quinary& quinary) {
+  int suit_count[4] = {0};
+  quinary.fill(0);
+  for (int i = 0; i < 7; i++) {
+    suit_count[cards[i] & 0x3]++;
+    quinary[cards[i] >> 2]++;
+  }
+  for (int s = 0; s < 4; s++) {
+    if (suit_count[s] >= 5) return false;
+  }
+  return true;
+}
+
+static int Hash(const Quinary& quinary, const Permutation& slot) {
+  Quinary relabelled{};
+  for (int r = 0; r < 13; r++) relabelled[slot[r]] = quinary[r];
+  return hash_quinary(relabelled.data(), 7);
+}
+
+struct Metrics {
+  int lines_touched;
+  int hot90;             // lines covering 90% of the accesses
+  int hot99;             // lines covering 99% of the accesses
+  double lines_per_group;
+};
+
+static Metrics Measure(const std::vector<Access>& accesses,
+                       const Permutation& slot) {
+  std::vector<uint64_t> heat(49205 / kEntriesPerLine + 1, 0);
+  std::set<int> group_lines;
+  uint64_t group_line_total = 0;
+  int groups = 0;
+  int current_group = -1;
+
+  for (const Access& access : accesses) {
+    const int line = Hash(access.quinary, slot) / kEntriesPerLine;
+    heat[line]++;
+    if (access.group != current_group) {
+      group_line_total += group_lines.size();
+      group_lines.clear();
+      current_group = access.group;
+      groups++;
+    }
+    group_lines.insert(line);
+  }
+  group_line_total += group_lines.size();
+
+  Metrics metrics{};
+  metrics.lines_per_group =
+      groups ? static_cast<double>(group_line_total) / groups : 0.0;
+
+  std::sort(heat.begin(), heat.end(), std::greater<uint64_t>());
+  uint64_t covered = 0;
+  for (size_t line = 0; line < heat.size() && heat[line] > 0; line++) {
+    covered += heat[line];
+    metrics.lines_touched++;
+    if (metrics.hot90 == 0 && covered * 10 >= accesses.size() * 9)
+      metrics.hot90 = line + 1;
+    if (metrics.hot99 == 0 && covered * 100 >= accesses.size() * 99)
+      metrics.hot99 = line + 1;
+  }
+  return metrics;
+}
+
+// Grouped workloads care about reuse inside a group, others about the size
+// of the hot set.
+static double Cost(const Metrics& metrics, bool grouped) {
+  return grouped ? metrics.lines_per_group : metrics.hot90;
+}
+
+static void Print(const char* name, const Metrics& metrics) {
+  std::printf(
+      "%-10s lines touched %5d, 90%% in %5d lines, 99%% in %5d lines, "
+      "%.1f lines per group\n",
+      name, metrics.lines_touched, metrics.hot90, metrics.hot99,
+      metrics.lines_per_group);
+}
+
+static void DealRandom(std::mt19937_64& generator, int* cards, int count) {
+  std::array<int, 52> deck;
+  std::iota(deck.begin(), deck.end(), 0);
+  for (int i = 0; i < count; i++) {
+    std::uniform_int_distribution<int> pick(i, 51);
+    std::swap(deck[i], deck[pick(generator)]);
+    cards[i] = deck[i];
+  }
+}
+
+static std::vector<Access> RandomWorkload(int hands) {
+  std::mt19937_64 generator(42);
+  std::vector<Access> accesses;
+  int cards[7];
+  for (int i = 0; i < hands; i++) {
+    DealRandom(generator, cards, 7);
+    Access access{{}, i};
+    if (ToQuinary(cards, access.quinary)) accesses.push_back(access);
+  }
+  return accesses;
+}
+
+static std::vector<Access> HoldemWorkload(int boards) {
+  std::mt19937_64 generator(42);
+  std::vector<Access> accesses;
+  int cards[7];
+  for (int b = 0; b < boards; b++) {
+    DealRandom(generator, cards, 5);
+    for (cards[5] = 0; cards[5] < 52; cards[5]++) {
+      for (cards[6] = cards[5] + 1; cards[6] < 52; cards[6]++) {
+        if (std::count(cards, cards + 5, cards[5]) ||
+            std::count(cards, cards + 5, cards[6]))
+          continue;
+        Access access{{}, b};
+        if (ToQuinary(cards, access.quinary)) accesses.push_back(access);
+      }
+    }
+  }
+  return accesses;
+}
+
+static std::vector<Access> FileWorkload(const char* path) {
+  std::ifstream in(path);
+  std::vector<Access> accesses;
+  std::string line;
+  int group = 0;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    int cards[7];
+    int n = 0;
+    while (n < 7 && fields >> cards[n]) n++;
+    if (n == 0) {
+      group++;
+      continue;
+    }
+    if (n != 7) continue;
+    Access access{{}, group};
+    if (ToQuinary(cards, access.quinary)) accesses.push_back(access);
+  }
+  return accesses;
+}
+
+// Hill climbing over rank transpositions
+static Permutation Optimize(const std::vector<Access>& accesses, bool grouped) {
+  Permutation best;
+  std::iota(best.begin(), best.end(), 0);
+  double best_cost = Cost(Measure(accesses, best), grouped);
+
+  for (bool improved = true; improved;) {
+    improved = false;
+    for (int i = 0; i < 13; i++) {
+      for (int j = i + 1; j < 13; j++) {
+        Permutation candidate = best;
+        std::swap(candidate[i], candidate[j]);
+        const double cost = Cost(Measure(accesses, candidate), grouped);
+        if (cost < best_cost) {
+          best = candidate;
+          best_cost = cost;
+          improved = true;
+        }
+      }
+    }
+  }
+  return best;
+}
+
+// Calls visit(quinary) for every rank multiset of 7 cards
+template <typename Visit>
+static void ForEachQuinary(Quinary& quinary, int rank, int left, Visit visit) {
+  if (rank == 13) {
+    if (left == 0) visit(quinary);
+    return;
+  }
+  for (int n = 0; n <= std::min(4, left); n++) {
+    quinary[rank] = n;
+    ForEachQuinary(quinary, rank + 1, left - n, visit);
+  }
+  quinary[rank] = 0;
+}
+
+static void Emit(const char* path, const Permutation& slot) {
+  std::vector<short> relaid(49205);
+  Permutation identity;
+  std::iota(identity.begin(), identity.end(), 0);
+  Quinary quinary{};
+  ForEachQuinary(quinary, 0, 7, [&](const Quinary& q) {
+    relaid[Hash(q, slot)] = noflush7[Hash(q, identity)];
+  });
+
+  FILE* out = std::fopen(path, "w");
+  if (out == nullptr) {
+    std::perror(path);
+    std::exit(1);
+  }
+  std::fprintf(out,
+               "/* Generated by tools/optimize_table_layout.cc, do not edit by "
+               "hand. */\n\n");
+  std::fprintf(out,
+               "/* Quinary slot of each card id, replaces (id >> 2) when "
+               "hashing */\nconst unsigned char noflush7_rank_slot[52] = {");
+  for (int id = 0; id < 52; id++) {
+    std::fprintf(out, "%s%d,", id % 13 ? " " : "\n    ", slot[id >> 2]);
+  }
+  std::fprintf(out, "\n};\n\nconst short noflush7_relaid[49205] = {");
+  for (int i = 0; i < 49205; i++) {
+    std::fprintf(out, "%s%d,", i % 12 ? " " : "\n    ", relaid[i]);
+  }
+  std::fprintf(out, "\n};\n");
+  std::fclose(out);
+}
+
+static void ComparePlo4Strides(int boards) {
+  // Every PLO4 holding on a board touches the same board row in the
+  // board-major layout; hole-major spreads them one per row.
+  std::mt19937_64 generator(42);
+  std::set<int64_t> board_major, hole_major;
+  uint64_t board_major_total = 0, hole_major_total = 0;
+  int cards[9];
+  for (int b = 0; b < boards; b++) {
+    board_major.clear();
+    hole_major.clear();
+    DealRandom(generator, cards, 5);
+    for (int h = 0; h < 2000; h++) {
+      std::array<int, 52> used{};
+      for (int i = 0; i < 5; i++) used[cards[i]] = 1;
+      for (int i = 5; i < 9; i++) {
+        do {
+          cards[i] = generator() % 52;
+        } while (used[cards[i]]);
+        used[cards[i]] = 1;
+      }
+      unsigned char quinary_board[13] = {0}, quinary_hole[13] = {0};
+      for (int i = 0; i < 5; i++) quinary_board[cards[i] >> 2]++;
+      for (int i = 5; i < 9; i++) quinary_hole[cards[i] >> 2]++;
+      const int64_t board_hash = hash_quinary(quinary_board, 5);
+      const int64_t hole_hash = hash_quinary(quinary_hole, 4);
+      board_major.insert((board_hash * 1820 + hole_hash) / kEntriesPerLine);
+      hole_major.insert((hole_hash * 6175 + board_hash) / kEntriesPerLine);
+    }
+    board_major_total += board_major.size();
+    hole_major_total += hole_major.size();
+  }
+  std::printf(
+      "noflush_plo4, 2000 holdings per board: board-major %.1f lines per "
+      "board, hole-major %.1f lines per board\n",
+      static_cast<double>(board_major_total) / boards,
+      static_cast<double>(hole_major_total) / boards);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::fprintf(stderr,
+                 "usage: %s random7 [hands] | holdem [boards] | file path "
+                 "[--emit out.c]\n",
+                 argv[0]);
+    return 1;
+  }
+
+  const std::string mode = argv[1];
+  const char* emit = nullptr;
+  for (int i = 2; i + 1 < argc; i++) {
+    if (std::strcmp(argv[i], "--emit") == 0) emit = argv[i + 1];
+  }
+  const bool has_arg = argc > 2 && std::strcmp(argv[2], "--emit") != 0;
+
+  std::vector<Access> accesses;
+  bool grouped = true;
+  if (mode == "random7") {
+    accesses = RandomWorkload(has_arg ? std::atoi(argv[2]) : 1000000);
+    grouped = false;
+  } else if (mode == "holdem") {
+    accesses = HoldemWorkload(has_arg ? std::atoi(argv[2]) : 200);
+  } else if (mode == "file" && has_arg) {
+    accesses = FileWorkload(argv[2]);
+  } else {
+    std::fprintf(stderr, "unknown workload %s\n", mode.c_str());
+    return 1;
+  }
+
+  std::printf("noflush7, %zu noflush accesses\n", accesses.size());
+  Permutation identity;
+  std::iota(identity.begin(), identity.end(), 0);
+  Print("current", Measure(accesses, identity));
+
+  const Permutation best = Optimize(accesses, grouped);
+  Print("optimized", Measure(accesses, best));
+  std::printf("rank slots (2..A):");
+  for (int r = 0; r < 13; r++) std::printf(" %d", best[r]);
+  std::printf("\n");
+
+  if (mode == "holdem") ComparePlo4Strides(has_arg ? std::atoi(argv[2]) : 200);
+
+  if (emit != nullptr) Emit(emit, best);
+  return 0;
+}